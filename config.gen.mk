@@ -0,0 +1,98 @@
+# Path/name of the C compiler
+CC=gcc
+# C compiler flags
+CFLAGS=-W -Wall -Wextra -O2 -ggdb -D_FORTIFY_SOURCE=2
+# Disable implicit fallthrough warnings
+CFLAGS_WNIF=-Wimplicit-fallthrough=0
+# Linker flags
+LDFLAGS=
+# Path/name of python interpreter
+PYTHON_BIN=python
+# Simplified Wrapper and Interface Generator
+SWIG=
+# Python config helper
+PYTHON_CONFIG=python-config
+# Python version (derived from python config)
+PYTHON_VER=3.1
+# Path to the system headers
+include_path=
+# Installation prefix
+prefix=/usr/local/
+# Where to install binaries
+bindir=/usr/local/bin
+# Where to install libraries
+libdir=/usr/local/lib64
+# Where to install headers
+includedir=/usr/local/include
+# Where to install man pages
+mandir=/usr/local/share/man
+# Where to install documentation
+docdir=/usr/local/share/doc/
+# Where to install info pages
+infodir=/usr/local/share/info
+# Where to place readonly arch independend datafiles
+datadir=/usr/local/share
+# Where to place configuration
+sysconfdir=/usr/local/etc
+# Where to place runtime modified datafiles
+localstatedir=/usr/local/local/var/
+# WARNING not used
+build=
+# WARNING not used
+host=
+# libpng - Portable Network Graphics Library
+HAVE_LIBPNG=yes
+# libsdl - Simple Direct Media Layer
+HAVE_LIBSDL=no
+# jpeg - Library to load, handle and manipulate images in the JPEG format
+HAVE_JPEG=yes
+# webp - A lossy image compression format
+HAVE_WEBP=no
+# openjpeg - An open-source JPEG 2000 library
+HAVE_OPENJPEG=no
+# giflib - Library to handle, display and manipulate GIF images
+HAVE_GIFLIB=no
+# tiff - Tag Image File Format (TIFF) library
+HAVE_TIFF=no
+# zlib - Standard (de)compression library
+HAVE_ZLIB=yes
+# libarchive - http://www.libarchive.org/
+HAVE_LIBARCHIVE=no
+# libX11 - X11 library
+HAVE_LIBX11=yes
+# libxcb - XCB library
+HAVE_LIBXCB=no
+# xcb-util-errors - XCB errors library
+HAVE_XCB-UTIL-ERRORS=no
+# X_SHM - MIT-SHM X Extension
+HAVE_X_SHM=yes
+# aalib - Portable ascii art GFX library
+HAVE_AALIB=no
+# freetype - A high-quality and portable font engine
+HAVE_FREETYPE=yes
+# fontconfig - A library for configuring and customizing font access
+HAVE_FONTCONFIG=yes
+# json-c - A JSON implementation in C
+HAVE_JSON-C=no
+# dl - Dynamic linker
+HAVE_DL=yes
+# V4L2 - Video for linux 2
+HAVE_V4L2=yes
+# pthread - Posix Threads
+HAVE_PTHREAD=yes
+# backtrace - C stack trace writeout
+HAVE_BACKTRACE=yes
+# freetype cflags
+FREETYPE_CFLAGS=-I/usr/include/freetype2 -I/usr/include/libpng16
+# pthread cflags
+PTHREAD_CFLAGS=-pthread
+# loaders linker flags
+LDLIBS_loaders=-lpng -ljpeg -lz
+# backends linker flags
+LDLIBS_backends=-lX11 -lXext
+# core linker flags
+LDLIBS_core=-lfreetype -lfontconfig -ldl -pthread
+# widgets linker flags
+LDLIBS_widgets=-ldl
+# grabbers linker flags
+LDLIBS_grabbers=
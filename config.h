@@ -0,0 +1,112 @@
+/*
+ * This file is genereated by configure script
+ */
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/*
+ * Portable Network Graphics Library
+ */
+#define HAVE_LIBPNG
+
+/*
+ * Simple Direct Media Layer
+ */
+//#define HAVE_LIBSDL
+
+/*
+ * Library to load, handle and manipulate images in the JPEG format
+ */
+#define HAVE_JPEG
+
+/*
+ * A lossy image compression format
+ */
+//#define HAVE_WEBP
+
+/*
+ * An open-source JPEG 2000 library
+ */
+//#define HAVE_OPENJPEG
+
+/*
+ * Library to handle, display and manipulate GIF images
+ */
+//#define HAVE_GIFLIB
+
+/*
+ * Tag Image File Format (TIFF) library
+ */
+//#define HAVE_TIFF
+
+/*
+ * Standard (de)compression library
+ */
+#define HAVE_ZLIB
+
+/*
+ * http://www.libarchive.org/
+ */
+//#define HAVE_LIBARCHIVE
+
+/*
+ * X11 library
+ */
+#define HAVE_LIBX11
+
+/*
+ * XCB library
+ */
+//#define HAVE_LIBXCB
+
+/*
+ * XCB errors library
+ */
+//#define HAVE_XCB_UTIL_ERRORS
+
+/*
+ * MIT-SHM X Extension
+ */
+#define HAVE_X_SHM
+
+/*
+ * Portable ascii art GFX library
+ */
+//#define HAVE_AALIB
+
+/*
+ * A high-quality and portable font engine
+ */
+#define HAVE_FREETYPE
+
+/*
+ * A library for configuring and customizing font access
+ */
+#define HAVE_FONTCONFIG
+
+/*
+ * A JSON implementation in C
+ */
+//#define HAVE_JSON_C
+
+/*
+ * Dynamic linker
+ */
+#define HAVE_DL
+
+/*
+ * Video for linux 2
+ */
+#define HAVE_V4L2
+
+/*
+ * Posix Threads
+ */
+#define HAVE_PTHREAD
+
+/*
+ * C stack trace writeout
+ */
+#define HAVE_BACKTRACE
+
+#endif /* CONFIG_H */
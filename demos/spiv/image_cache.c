@@ -18,6 +18,9 @@ struct image {
 	/* number of elevated get calls */
 	unsigned int elevated;
 
+	/* pinned images are not freed when cache is full */
+	int pinned;
+
 	/* this identifies an image */
 	char path[];
 };
@@ -26,6 +29,9 @@ struct image_cache {
 	unsigned int max_size;
 	unsigned int cur_size;
 
+	/* images hashed by path, the list below is kept in the LRU order */
+	gp_htable *index;
+
 	struct image *root;
 	struct image *end;
 };
@@ -84,6 +90,13 @@ struct image_cache *image_cache_create(unsigned int max_size_kbytes)
 	if (self == NULL)
 		return NULL;
 
+	self->index = gp_htable_new(0, 0);
+
+	if (self->index == NULL) {
+		free(self);
+		return NULL;
+	}
+
 	self->max_size = max_size_kbytes * 1024;
 	self->cur_size = sizeof(struct image_cache);
 
@@ -117,6 +130,10 @@ static void remove_img_free(struct image_cache *self,
 {
 	GP_DEBUG(2, "Freeing image '%s' size %zu", img->path, size);
 
+	/* The key may have been reused by a newer image */
+	if (gp_htable_get(self->index, img->path) == img)
+		gp_htable_rem(self->index, img->path);
+
 	remove_img(self, img, size);
 	gp_pixmap_free(img->pixmap);
 	gp_storage_destroy(img->meta_data);
@@ -142,25 +159,28 @@ static void add_img(struct image_cache *self, struct image *img, size_t size)
 		self->end = img;
 }
 
-int image_cache_get(struct image_cache *self, gp_pixmap **img,
-		    gp_storage **meta_data, int elevate, const char *key)
+/*
+ * Adds new image to the list and to the index
+ */
+static void insert_img(struct image_cache *self, struct image *img, size_t size)
 {
-	struct image *i;
+	gp_htable_rem(self->index, img->path);
+	gp_htable_put(self->index, img, img->path);
 
-	if (self == NULL)
-		return 1;
+	add_img(self, img, size);
+}
 
-	GP_DEBUG(2, "Looking for image '%s'", key);
+static struct image *lookup(struct image_cache *self, const char *key,
+                            int elevate)
+{
+	struct image *i;
 
-	for (i = self->root; i != NULL; i = i->next)
-		if (!strcmp(key, i->path))
-			break;
+	GP_DEBUG(2, "Looking for image '%s'", key);
 
-	if (i == NULL)
-		return 1;
+	i = gp_htable_get(self->index, key);
 
 	/* Push the image to the root of the list */
-	if (elevate) {
+	if (i && elevate) {
 		size_t size = image_size(i);
 
 		GP_DEBUG(2, "Refreshing image '%s'", key);
@@ -171,6 +191,22 @@ int image_cache_get(struct image_cache *self, gp_pixmap **img,
 		i->elevated++;
 	}
 
+	return i;
+}
+
+int image_cache_get(struct image_cache *self, gp_pixmap **img,
+		    gp_storage **meta_data, int elevate, const char *key)
+{
+	struct image *i;
+
+	if (self == NULL)
+		return 1;
+
+	i = lookup(self, key, elevate);
+
+	if (i == NULL)
+		return 1;
+
 	if (img)
 		*img = i->pixmap;
 
@@ -208,23 +244,7 @@ gp_pixmap *image_cache_get2(struct image_cache *self, int elevate,
 		va_end(va);
 	}
 
-	GP_DEBUG(2, "Looking for image '%s'", key);
-
-	for (i = self->root; i != NULL; i = i->next)
-		if (!strcmp(key, i->path))
-			break;
-
-	/* Push the image to the root of the list */
-	if (i && elevate) {
-		size_t size = image_size(i);
-
-		GP_DEBUG(2, "Refreshing image '%s'", key);
-
-		remove_img(self, i, size);
-		add_img(self, i, size);
-
-		i->elevated++;
-	}
+	i = lookup(self, key, elevate);
 
 	if (len >= sizeof(buf))
 		free(key);
@@ -244,28 +264,51 @@ void image_cache_print(struct image_cache *self)
 	printf("Image cache size %u used %u\n", self->max_size, self->cur_size);
 
 	for (i = self->root; i != NULL; i = i->next)
-		printf(" size=%10zu elevated=%u key='%s'\n",
-		       image_size(i), i->elevated, i->path);
+		printf(" size=%10zu elevated=%u pinned=%i key='%s'\n",
+		       image_size(i), i->elevated, i->pinned, i->path);
 }
 
 static int assert_size(struct image_cache *self, size_t size)
 {
+	struct image *i = self->end;
+
 	if (self->cur_size + size < self->max_size)
 		return 0;
 
 	while (self->cur_size + size > self->max_size) {
+		struct image *prev;
+
+		while (i && i->pinned)
+			i = i->prev;
 
-		if (self->end == NULL) {
+		if (i == NULL) {
 			GP_WARN("Cache too small for image size %zu", size);
 			return 1;
 		}
 
-		remove_img_free(self, self->end, image_size(self->end));
+		prev = i->prev;
+		remove_img_free(self, i, image_size(i));
+		i = prev;
 	}
 
 	return 0;
 }
 
+void image_cache_pin(struct image_cache *self, const char *key, int pin)
+{
+	struct image *i;
+
+	if (self == NULL)
+		return;
+
+	i = gp_htable_get(self->index, key);
+
+	if (i) {
+		GP_DEBUG(2, "%s image '%s'", pin ? "Pinning" : "Unpinning", key);
+		i->pinned = pin;
+	}
+}
+
 int image_cache_put(struct image_cache *self, gp_pixmap *pixmap,
                     gp_storage *meta_data, const char *key)
 {
@@ -293,11 +336,12 @@ int image_cache_put(struct image_cache *self, gp_pixmap *pixmap,
 	img->pixmap = pixmap;
 	img->meta_data = meta_data;
 	img->elevated = 0;
+	img->pinned = 0;
 	strcpy(img->path, key);
 
 	GP_DEBUG(2, "Adding image '%s' size %zu", img->path, size);
 
-	add_img(self, img, size);
+	insert_img(self, img, size);
 
 	return 0;
 }
@@ -335,6 +379,7 @@ int image_cache_put2(struct image_cache *self, gp_pixmap *pixmap,
 	img->pixmap = pixmap;
 	img->meta_data = meta_data;
 	img->elevated = 0;
+	img->pinned = 0;
 
 	va_start(va, fmt);
 	vsprintf(img->path, fmt, va);
@@ -343,7 +388,7 @@ int image_cache_put2(struct image_cache *self, gp_pixmap *pixmap,
 	GP_DEBUG(2, "Adding image '%s' size %zu",
 	         img->path, size);
 
-	add_img(self, img, size);
+	insert_img(self, img, size);
 
 	return 0;
 }
@@ -371,5 +416,6 @@ void image_cache_destroy(struct image_cache *self)
 	while (self->end != NULL)
 		remove_img_free(self, self->end, 0);
 
+	gp_htable_free(self->index);
 	free(self);
 }
@@ -47,6 +47,12 @@ int image_cache_put2(struct image_cache *self, gp_pixmap *img,
                      gp_storage *meta_data, const char *fmt, ...)
                      __attribute__ ((format (printf, 4, 5)));
 
+/*
+ * Pins or unpins an image, pinned images are not freed when the cache makes
+ * room for new images, e.g. the image that is currently shown.
+ */
+void image_cache_pin(struct image_cache *self, const char *key, int pin);
+
 /*
  * Drop all image in cache.
  */
@@ -224,14 +224,22 @@ static void set_cur_arg(struct image_list *self, int arg)
 	try_load_dir(self);
 }
 
+static void dir_file_path(struct image_list *self, int file,
+                          char *buf, size_t buf_size)
+{
+	const char *dir = cur_arg(self);
+	size_t len = strlen(dir);
+	const char *sep = len && dir[len - 1] == '/' ? "" : "/";
+
+	snprintf(buf, buf_size, "%s%s%s",
+	         dir, sep, self->dir_files[file]->d_name);
+}
+
 static void load_path(struct image_list *self)
 {
 	if (self->in_dir) {
-		//TODO: eliminate double /
-		snprintf(self->path, sizeof(self->path), "%s/%s",
-		         cur_arg(self),
-			 self->dir_files[self->cur_file]->d_name);
-
+		dir_file_path(self, self->cur_file,
+		              self->path, sizeof(self->path));
 	} else {
 		snprintf(self->path, sizeof(self->path), "%s", cur_arg(self));
 	}
@@ -254,6 +262,34 @@ const char *image_list_move(struct image_list *self, int direction)
 	return image_list_img_path(self);
 }
 
+const char *image_list_peek(struct image_list *self, int direction,
+                            char *buf, size_t buf_size)
+{
+	struct stat sb;
+	int arg;
+
+	if (self->in_dir) {
+		int file = self->cur_file + direction;
+
+		if (file < 0 || file >= self->max_file)
+			return NULL;
+
+		dir_file_path(self, file, buf, buf_size);
+		return buf;
+	}
+
+	arg = ((int)self->cur_arg + direction) % (int)self->max_arg;
+
+	if (arg < 0)
+		arg += self->max_arg;
+
+	if (stat(self->args[arg], &sb) || S_ISDIR(sb.st_mode))
+		return NULL;
+
+	snprintf(buf, buf_size, "%s", self->args[arg]);
+	return buf;
+}
+
 const char *image_list_dir_move(struct image_list *self, int direction)
 {
 	if (!self->in_dir) {
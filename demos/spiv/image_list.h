@@ -33,6 +33,16 @@ const char *image_list_img_path(struct image_list *self);
  */
 const char *image_list_move(struct image_list *self, int direction);
 
+/*
+ * Returns path to the image direction images away from the current one,
+ * without moving. The path is stored into the buf.
+ *
+ * Returns NULL if the image would be in a different directory, i.e. the
+ * directory content would have to be loaded.
+ */
+const char *image_list_peek(struct image_list *self, int direction,
+                            char *buf, size_t buf_size);
+
 /*
  * If we are in directory:
  *  if direction > 0: move to its end and if allready there, to the next arg
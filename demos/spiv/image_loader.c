@@ -59,8 +59,10 @@ gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate)
 
 	path = image_list_img_path(img_list);
 
-	if (!image_cache_get(img_cache, &cur_img, &cur_meta_data, elevate, path))
+	if (!image_cache_get(img_cache, &cur_img, &cur_meta_data, elevate, path)) {
+		image_cache_pin(img_cache, path, 1);
 		return cur_img;
+	}
 
 	cpu_timer_start(&timer, "Loading");
 
@@ -96,9 +98,49 @@ gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate)
 	}
 
 	image_cache_put(img_cache, img, cur_meta_data, path);
+	image_cache_pin(img_cache, path, 1);
+
+	cpu_timer_stop(&timer);
+
+	return img;
+}
+
+gp_pixmap *image_loader_prefetch(int direction, gp_progress_cb *callback,
+                                 gp_storage **meta_data,
+                                 char *path, size_t path_size)
+{
+	struct cpu_timer timer;
+	gp_storage *meta;
+	gp_pixmap *img;
+
+	if (cur_cont || !img_cache)
+		return NULL;
+
+	if (!image_list_peek(img_list, direction, path, path_size))
+		return NULL;
+
+	if (!image_cache_get(img_cache, &img, meta_data, 0, path))
+		return img;
+
+	cpu_timer_start(&timer, "Prefetching");
+
+	meta = gp_storage_create();
+
+	if (gp_load_image_ex(path, &img, meta, callback)) {
+		gp_storage_destroy(meta);
+		return NULL;
+	}
+
+	if (image_cache_put(img_cache, img, meta, path)) {
+		gp_pixmap_free(img);
+		gp_storage_destroy(meta);
+		return NULL;
+	}
 
 	cpu_timer_stop(&timer);
 
+	*meta_data = meta;
+
 	return img;
 }
 
@@ -138,6 +180,8 @@ static void drop_cur_img(void)
 	if (image_cache_get(img_cache, NULL, NULL, 0, path)) {
 		gp_pixmap_free(cur_img);
 		gp_storage_destroy(cur_meta_data);
+	} else {
+		image_cache_pin(img_cache, path, 0);
 	}
 
 	cur_img = NULL;
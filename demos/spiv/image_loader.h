@@ -31,6 +31,18 @@ int image_loader_init(const char *args[], unsigned int cache_max_bytes);
  */
 gp_pixmap *image_loader_get_image(gp_progress_cb *callback, int elevate);
 
+/*
+ * Loads image direction images away from the current one into the cache,
+ * the current position is not changed. The path to the image is stored into
+ * the path buffer.
+ *
+ * Returns NULL if the image couldn't be loaded or if it's not possible to
+ * find out the path without moving in the image list, e.g. in containers.
+ */
+gp_pixmap *image_loader_prefetch(int direction, gp_progress_cb *callback,
+                                 gp_storage **meta_data,
+                                 char *path, size_t path_size);
+
 /*
  * Retruns current image meta data or NULL there are none.
  */
@@ -386,42 +386,23 @@ static void update_display(struct loader_params *params, gp_pixmap *img,
 	gp_backend_flip(backend);
 }
 
-gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h)
+/*
+ * Resamples the image to w x h and puts the result into the resized cache.
+ */
+static gp_pixmap *resample_image(struct loader_params *params, gp_pixmap *img,
+                                 const char *img_path, float zoom_rat,
+                                 gp_size w, gp_size h, gp_progress_cb *callback)
 {
-	gp_pixmap *img, *res = NULL;
+	gp_pixmap *res = NULL;
 	struct cpu_timer timer;
-	gp_progress_cb callback = {.callback = image_loader_callback};
-
-	const char *img_path = image_loader_img_path();
-
-	/* Try to get resized cached image */
-	img = image_cache_get2(params->img_resized_cache, 1, "%s %ux%u r%i l%i",
-	                       img_path, w, h, params->resampling_method,
-	                       params->use_low_pass);
-
-	if (img != NULL)
-		return img;
-
-	/* Otherwise load image and resize it */
-	if ((img = load_image(1)) == NULL)
-		return NULL;
-
-	if (params->show_nn_first) {
-		/* Do simple interpolation and blit the result */
-		gp_pixmap *nn = gp_filter_resize_nn_alloc(img, w, h, NULL);
-		if (nn != NULL) {
-			update_display(params, nn, img);
-			gp_pixmap_free(nn);
-		}
-	}
 
 	/* Do low pass filter */
-	if (params->use_low_pass && params->zoom_rat < 1) {
+	if (params->use_low_pass && zoom_rat < 1) {
 		cpu_timer_start(&timer, "Blur");
-		callback.priv = "Blurring Image";
+		callback->priv = "Blurring Image";
 
-		res = gp_filter_gaussian_blur_alloc(img, 0.4/params->zoom_rat,
-		                                 0.4/params->zoom_rat, &callback);
+		res = gp_filter_gaussian_blur_alloc(img, 0.4/zoom_rat,
+		                                 0.4/zoom_rat, callback);
 
 		if (res == NULL)
 			return NULL;
@@ -434,16 +415,16 @@ gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h
 //	img->gamma = gp_gamma_acquire(img->pixel_type, 0.45);
 
 	cpu_timer_start(&timer, "Resampling");
-	callback.priv = "Resampling Image";
-	gp_pixmap *i1 = gp_filter_resize_alloc(img, w, h, params->resampling_method, &callback);
+	callback->priv = "Resampling Image";
+	gp_pixmap *i1 = gp_filter_resize_alloc(img, w, h, params->resampling_method, callback);
 	img = i1;
 	cpu_timer_stop(&timer);
 
 /*
-	if (params->zoom_rat > 1.5) {
+	if (zoom_rat > 1.5) {
 		cpu_timer_start(&timer, "Sharpening");
-		callback.priv = "Sharpening";
-		gp_filter_edge_sharpening(i1, i1, 0.1, &callback);
+		callback->priv = "Sharpening";
+		gp_filter_edge_sharpening(i1, i1, 0.1, callback);
 		cpu_timer_stop(&timer);
 	}
 */
@@ -461,37 +442,100 @@ gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h
 	return img;
 }
 
-static void exif_autorotate(void)
+gp_pixmap *load_resized_image(struct loader_params *params, gp_size w, gp_size h)
 {
-	gp_data_node *orientation;
+	gp_pixmap *img;
+	gp_progress_cb callback = {.callback = image_loader_callback};
 
-	config.combined_orientation = config.orientation;
+	const char *img_path = image_loader_img_path();
+
+	/* Try to get resized cached image */
+	img = image_cache_get2(params->img_resized_cache, 1, "%s %ux%u r%i l%i",
+	                       img_path, w, h, params->resampling_method,
+	                       params->use_low_pass);
+
+	if (img != NULL)
+		return img;
+
+	/* Otherwise load image and resize it */
+	if ((img = load_image(1)) == NULL)
+		return NULL;
+
+	if (params->show_nn_first) {
+		/* Do simple interpolation and blit the result */
+		gp_pixmap *nn = gp_filter_resize_nn_alloc(img, w, h, NULL);
+		if (nn != NULL) {
+			update_display(params, nn, img);
+			gp_pixmap_free(nn);
+		}
+	}
+
+	return resample_image(params, img, img_path, params->zoom_rat,
+	                      w, h, &callback);
+}
+
+/*
+ * Returns user orientation combined with the EXIF rotation.
+ */
+static enum orientation img_orientation(gp_storage *meta_data)
+{
+	gp_data_node *orientation;
+	int ret = config.orientation;
 
 	if (!config.exif_autorotate)
-		return;
+		return ret;
 
-	orientation = gp_storage_get_by_path(image_loader_get_meta_data(),
-	                                      NULL, "/Exif/Orientation");
+	orientation = gp_storage_get_by_path(meta_data, NULL, "/Exif/Orientation");
 	if (!orientation)
-		return;
+		return ret;
 
 	switch (orientation->value.i) {
 	case GP_EXIF_UPPER_LEFT:
-		config.combined_orientation += ROTATE_0;
+		ret += ROTATE_0;
 	break;
 	case GP_EXIF_LOWER_RIGHT:
-		config.combined_orientation += ROTATE_180;
+		ret += ROTATE_180;
 	break;
 	case GP_EXIF_UPPER_RIGHT:
-		config.combined_orientation += ROTATE_90;
+		ret += ROTATE_90;
 	break;
 	case GP_EXIF_LOWER_LEFT:
-		config.combined_orientation += ROTATE_270;
+		ret += ROTATE_270;
 	break;
 	}
 
-	if (config.combined_orientation > ROTATE_270)
-		config.combined_orientation -= ROTATE_360;
+	if (ret > ROTATE_270)
+		ret -= ROTATE_360;
+
+	return ret;
+}
+
+static void exif_autorotate(void)
+{
+	config.combined_orientation = img_orientation(image_loader_get_meta_data());
+}
+
+/*
+ * Returns zoom ratio for the image to fit into the window.
+ */
+static float fit_ratio(uint32_t img_w, uint32_t img_h,
+                       uint32_t win_w, uint32_t win_h)
+{
+	float w_rat, h_rat;
+
+	if (img_w <= win_w && img_h <= win_h) {
+		if (!(config.zoom_strategy & ZOOM_IMAGE_UPSCALE))
+			return 1.00;
+	} else {
+		if (!(config.zoom_strategy & ZOOM_IMAGE_DOWNSCALE))
+			return 1.00;
+
+	}
+
+	w_rat = 1.00 * win_w / img_w;
+	h_rat = 1.00 * win_h / img_h;
+
+	return GP_MIN(w_rat, h_rat);
 }
 
 static float calc_img_size(struct loader_params *params,
@@ -568,19 +612,78 @@ static float calc_img_size(struct loader_params *params,
 		}
 	}
 
-	if (img_w <= win_w && img_h <= win_h) {
-		if (!(config.zoom_strategy & ZOOM_IMAGE_UPSCALE))
-			return 1.00;
-	} else {
-		if (!(config.zoom_strategy & ZOOM_IMAGE_DOWNSCALE))
-			return 1.00;
+	return fit_ratio(img_w, img_h, win_w, win_h);
+}
+
+static int prefetch_callback(gp_progress_cb *self)
+{
+	(void) self;
+
+	return abort_flag;
+}
 
+/*
+ * Loads and resamples image direction images away from the current one into
+ * the caches, so that it's shown instantly once we move there.
+ */
+static void prefetch_image(struct loader_params *params, int direction)
+{
+	gp_progress_cb callback = {.callback = prefetch_callback};
+	gp_pixmap *img, *pixmap = backend->pixmap;
+	uint32_t win_w = pixmap->w, win_h = pixmap->h;
+	gp_storage *meta_data = NULL;
+	char path[1024];
+	gp_size w, h;
+	float rat;
+
+	img = image_loader_prefetch(direction, &callback, &meta_data,
+	                            path, sizeof(path));
+
+	if (!img || abort_flag)
+		return;
+
+	/* Window size depends on the image, we can't resample in advance */
+	if (config.win_strategy == ZOOM_WIN_RESIZABLE)
+		return;
+
+	switch (img_orientation(meta_data)) {
+	case ROTATE_90:
+	case ROTATE_270:
+		GP_SWAP(win_w, win_h);
+	break;
+	default:
+	break;
 	}
 
-	w_rat = 1.00 * win_w / img_w;
-	h_rat = 1.00 * win_h / img_h;
+	rat = fit_ratio(img->w, img->h, win_w, win_h);
 
-	return GP_MIN(w_rat, h_rat);
+	w = img->w * rat + 0.5;
+	h = img->h * rat + 0.5;
+
+	if (w == img->w && h == img->h)
+		return;
+
+	if (image_cache_get2(params->img_resized_cache, 0, "%s %ux%u r%i l%i",
+	                     path, w, h, params->resampling_method,
+	                     params->use_low_pass))
+		return;
+
+	resample_image(params, img, path, rat, w, h, &callback);
+}
+
+/*
+ * Prefetches next and previous images, interrupted by stop_loader().
+ */
+static void prefetch_images(struct loader_params *params)
+{
+	unsigned int i;
+
+	for (i = 1; i <= config.prefetch && !abort_flag; i++) {
+		prefetch_image(params, i);
+
+		if (!abort_flag)
+			prefetch_image(params, -i);
+	}
 }
 
 static void *image_loader(void *ptr)
@@ -627,6 +730,8 @@ update:
 
 	loader_running = 0;
 
+	prefetch_images(params);
+
 	return NULL;
 }
 
@@ -642,6 +747,25 @@ static void stop_loader(void)
 	}
 }
 
+/*
+ * The low pass variant, lanczos and area average the footprint of the
+ * destination pixel, the rest needs to blur the image before downscaling.
+ */
+static void set_low_pass(struct loader_params *params)
+{
+	switch (params->resampling_method) {
+	case GP_INTERP_LINEAR_LF_INT:
+	case GP_INTERP_LANCZOS_INT:
+	case GP_INTERP_AREA_INT:
+		params->use_low_pass = 0;
+		params->show_nn_first = 0;
+	break;
+	default:
+		params->use_low_pass = 1;
+		params->show_nn_first = 1;
+	}
+}
+
 static void show_image(struct loader_params *params)
 {
 	int ret;
@@ -953,13 +1077,7 @@ int main(int argc, char *argv[])
 						params.resampling_method = 0;
 					if (params.resampling_method == GP_INTERP_CUBIC)
 						params.resampling_method++;
-					if (params.resampling_method == GP_INTERP_LINEAR_LF_INT) {
-						params.use_low_pass = 0;
-						params.show_nn_first = 0;
-					} else {
-						params.use_low_pass = 1;
-						params.show_nn_first = 1;
-					}
+					set_low_pass(&params);
 
 					params.show_progress_once = 1;
 					show_image(&params);
@@ -971,13 +1089,7 @@ int main(int argc, char *argv[])
 						params.resampling_method--;
 					if (params.resampling_method == GP_INTERP_CUBIC)
 						params.resampling_method--;
-					if (params.resampling_method == GP_INTERP_LINEAR_LF_INT) {
-						params.use_low_pass = 0;
-						params.show_nn_first = 0;
-					} else {
-						params.use_low_pass = 1;
-						params.show_nn_first = 1;
-					}
+					set_low_pass(&params);
 
 					params.show_progress_once = 1;
 					show_image(&params);
@@ -989,6 +1101,7 @@ int main(int argc, char *argv[])
 					show_image(&params);
 				break;
 				case GP_KEY_C:
+					stop_loader();
 					image_cache_drop(params.img_resized_cache);
 					image_loader_drop_cache();
 				break;
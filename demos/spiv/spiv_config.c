@@ -26,6 +26,7 @@ struct spiv_config config = {
 	.exif_autorotate = 1,
 	.max_win_w = 1024,
 	.max_win_h = 768,
+	.prefetch = 1,
 
 	.font_path = NULL,
 	.font_height = 12,
@@ -178,6 +179,21 @@ static int set_slideshow(struct cfg_opt *self, unsigned int lineno)
 	return 0;
 }
 
+static int set_prefetch(struct cfg_opt *self, unsigned int lineno)
+{
+	int prefetch = atoi(self->val);
+
+	if (prefetch < 0) {
+		fprintf(stderr, "ERROR: %u: Invalid prefetch count '%s'\n",
+		        lineno, self->val);
+		return 1;
+	}
+
+	config.prefetch = prefetch;
+
+	return 0;
+}
+
 static int set_emulation(struct cfg_opt *self, unsigned int lineno)
 {
 	config.emul_type = gp_pixel_type_by_name(optarg);
@@ -342,6 +358,13 @@ struct cfg_opt spiv_opts[] = {
 	 .set = set_opt,
 	 .help = "Start fullscreen.",
 	},
+	{.name_space = "Gui",
+	 .key = "Prefetch",
+	 .opt_long = "prefetch",
+	 .opt_has_value = 1,
+	 .set = set_prefetch,
+	 .help = "Number of next and previous images to load in advance, 0 disables",
+	},
 	{.name_space = "Gui",
 	 .key = "BackendInit",
 	 .opt = 'b',
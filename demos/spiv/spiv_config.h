@@ -46,6 +46,8 @@ struct spiv_config {
 	int timers:1;
 	int full_screen:1;
 	int exif_autorotate:1;
+	/* number of next and previous images to load in advance */
+	unsigned int prefetch;
 	char backend_init[128];
 	gp_pixel_type emul_type;
 
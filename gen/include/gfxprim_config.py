@@ -132,5 +132,15 @@ config = GfxPrimConfig(
 
       PixelType(name='G16', pixelsize=PS_16BPP, chanslist=[
 	  ('V', 0, 16)]),
+
+      #
+      # Premultiplied alpha, added last to keep the pixel type ids stable
+      #
+      PixelType(name='RGBA8888_PM', pixelsize=PS_32BPP, chanslist=[
+	  ('R', 24, 8),
+	  ('G', 16, 8),
+	  ('B', 8, 8),
+	  ('A', 0, 8)],
+	  premultiplied=True),
       ]
     )
@@ -27,6 +27,24 @@
 	GP_SET_BITS({{ K.off }}+o2, {{ K.size }}, p2, GP_SCALE_VAL_{{ max_size }}_{{ K.size }}({{ max_val }} - _K)); \
 @ end
 @
+@ # Alpha to premultiplied alpha and back requires special handling
+@ def alpha_to_alpha(in_pix, out_pix):
+@     A1 = in_pix.chans['A']
+@     A2 = out_pix.chans['A']
+	gp_pixel _A = GP_GET_BITS({{ A1.off }}+o1, {{ A1.size }}, p1); \
+@     for name in 'RGB':
+@         c1 = in_pix.chans[name]
+@         c2 = out_pix.chans[name]
+@         if out_pix.is_premultiplied():
+	/* {{ name }}:={{ name }}*A */ GP_SET_BITS({{ c2.off }}+o2, {{ c2.size }}, p2, GP_SCALE_VAL_{{ c1.size }}_{{ c2.size }}( \
+		(GP_GET_BITS({{ c1.off }}+o1, {{ c1.size }}, p1) * _A + {{ A1.max // 2 }}) / {{ A1.C_max }})); \
+@         else:
+	/* {{ name }}:={{ name }}/A */ GP_SET_BITS({{ c2.off }}+o2, {{ c2.size }}, p2, GP_SCALE_VAL_{{ c1.size }}_{{ c2.size }}(!_A ? 0 : \
+		GP_MIN((GP_GET_BITS({{ c1.off }}+o1, {{ c1.size }}, p1) * {{ A1.C_max }} + _A / 2) / _A, {{ c1.C_max }}u))); \
+@     end
+	/* A:=A */ GP_SET_BITS({{ A2.off }}+o2, {{ A2.size }}, p2, GP_SCALE_VAL_{{ A1.size }}_{{ A2.size }}(_A)); \
+@ end
+@
 @ def pixel_type_to_type(pt1, pt2):
 /*** {{ pt1.name }} -> {{ pt2.name }} ***
  * macro reads p1 ({{ pt1.name }} at bit-offset o1)
@@ -36,6 +54,9 @@
 @     # special cases
 @     if pt1.is_rgb() and pt2.is_cmyk():
 @         rgb_to_cmyk(pt1, pt2)
+@     elif pt1.is_rgb() and pt2.is_rgb() and pt1.is_alpha() and pt2.is_alpha() and \
+@          pt1.is_premultiplied() != pt2.is_premultiplied():
+@         alpha_to_alpha(pt1, pt2)
 @     else:
 @         for c2 in pt2.chanslist:
 @             # case 1: just copy a channel
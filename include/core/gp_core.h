@@ -54,6 +54,9 @@
 /* Threads utils */
 #include <core/gp_threads.h>
 
+/* CPU features and runtime dispatch */
+#include <core/gp_cpu.h>
+
 /* Mix Pixel */
 #include <core/gp_mix_pixels.h>
 
@@ -0,0 +1,96 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   CPU features detection and runtime dispatch.
+
+   Performance critical kernels may have several implementations optimized for
+   a different instruction set extensions. The best implementation the CPU
+   supports is selected on the first call.
+
+  */
+
+#ifndef CORE_GP_CPU_H
+#define CORE_GP_CPU_H
+
+/*
+ * Set when the compiler can build x86 SIMD code, i.e. functions with
+ * __attribute__((target("avx2"))) and intrinsics from <immintrin.h>.
+ */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+# define GP_CPU_X86 1
+#endif
+
+enum gp_cpu_flags {
+	GP_CPU_SSE2 = 0x01,
+	GP_CPU_SSE41 = 0x02,
+	GP_CPU_AVX2 = 0x04,
+	GP_CPU_NEON = 0x08,
+};
+
+/*
+ * Returns bitmask of enum gp_cpu_flags the library may use.
+ *
+ * The features are detected on the first call and may be limited by the
+ * GP_SIMD environment variable, GP_SIMD=none disables all SIMD code paths.
+ */
+unsigned int gp_cpu_flags(void);
+
+/*
+ * Returns human readable name for a gp_cpu_flags bit.
+ */
+const char *gp_cpu_flag_name(enum gp_cpu_flags flag);
+
+/*
+ * An implementation that requires CPU features in flags.
+ */
+typedef struct gp_cpu_impl {
+	unsigned int flags;
+	void *fn;
+} gp_cpu_impl;
+
+/*
+ * Returns fn of the first implementation whose flags are all supported.
+ *
+ * The table is ordered from the most specialized implementation and ends
+ * with a generic implementation with flags set to 0.
+ */
+void *gp_cpu_select(const char *name, const gp_cpu_impl *impls);
+
+/*
+ * Defines a static function called name that returns a pointer to the best
+ * implementation from the impls table. The selection is done on the first
+ * call and cached.
+ *
+ * static const gp_cpu_impl write_row_impls[] = {
+ * #ifdef __x86_64__
+ *	{GP_CPU_AVX2, write_row_avx2},
+ *	{GP_CPU_SSE2, write_row_sse2},
+ * #endif
+ *	{0, write_row_c},
+ * };
+ *
+ * GP_CPU_DISPATCH(write_row, write_row_fn, write_row_impls);
+ *
+ * ...
+ *
+ *	write_row()(row, len);
+ */
+#define GP_CPU_DISPATCH(name, fn_type, impls)                                  \
+static fn_type name(void)                                                      \
+{                                                                              \
+	static fn_type name##_fn;                                              \
+	fn_type fn = __atomic_load_n(&name##_fn, __ATOMIC_RELAXED);            \
+                                                                               \
+	if (!fn) {                                                             \
+		fn = (fn_type)gp_cpu_select(#name, impls);                     \
+		__atomic_store_n(&name##_fn, fn, __ATOMIC_RELAXED);            \
+	}                                                                      \
+                                                                               \
+	return fn;                                                             \
+}
+
+#endif /* CORE_GP_CPU_H */
@@ -103,6 +103,8 @@ static inline gp_pixel gp_getpixel_raw_{{ ps.suffix }}(const gp_pixmap *c, gp_co
 	 *
 	 * The full list = {1, 2, 4, 8}
 	 */
+	x += c->offset / {{ ps.size }};
+
 	return GP_GET_BITS1_ALIGNED(GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x), {{ ps.size }},
 		*(GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y)));
 @     elif ps.size <= 10 or ps.size == 12 or ps.size == 16:
@@ -178,6 +180,8 @@ static inline void gp_putpixel_raw_{{ ps.suffix }}(gp_pixmap *c, gp_coord x, gp_
 	 *
 	 * The full list = {1, 2, 4, 8}
 	 */
+	x += c->offset / {{ ps.size }};
+
 	GP_SET_BITS1_ALIGNED(GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x), {{ ps.size }},
 	                     GP_PIXEL_ADDR_{{ ps.suffix }}(c, x, y), p);
 @     elif ps.size <= 10 or ps.size == 12 or ps.size == 16:
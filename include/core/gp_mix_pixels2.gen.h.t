@@ -40,9 +40,16 @@ static inline gp_pixel gp_mix_pixels_{{ src.name }}_{{ dst.name }}(gp_pixel src,
 
 @                     a_max = 2 ** src.chans['A'][2] - 1
 
+@                     if src.is_premultiplied():
+	/* Source color is already multiplied by alpha */
+	dr = GP_MIN(sr + (dr * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }}, 0xffu);
+	dg = GP_MIN(sg + (dg * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }}, 0xffu);
+	db = GP_MIN(sb + (db * ({{ a_max }} - alpha) + {{ a_max // 2 }}) / {{ a_max }}, 0xffu);
+@                     else:
 	dr = (dr * ({{ a_max }} - alpha) + sr * alpha + {{ a_max // 2 }}) / {{ a_max }};
 	dg = (dg * ({{ a_max }} - alpha) + sg * alpha + {{ a_max // 2 }}) / {{ a_max }};
 	db = (db * ({{ a_max }} - alpha) + sb * alpha + {{ a_max // 2 }}) / {{ a_max }};
+@                     end
 
 	dst_rgb = GP_PIXEL_CREATE_RGB888(dr, dg, db);
 
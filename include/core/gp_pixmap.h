@@ -27,6 +27,9 @@ struct gp_pixmap {
 	 * Row bit offset. The offset is ignored for byte aligned pixels.
 	 * Basically it's used for non aligned pixels with combination
 	 * with subpixmapes.
+	 *
+	 * For 1, 2 and 4 bpp this is the number of bits, in pixel order,
+	 * that precede the first pixel in the first byte of each row.
 	 */
 	uint8_t offset;
 
@@ -53,6 +56,7 @@ struct gp_pixmap {
 	uint8_t y_swap:1;	/* swap direction on y */
 	uint8_t bit_endian:1;	/* GP_BIT_ENDIAN */
 	uint8_t free_pixels:1;  /* If set pixels are freed on gp_pixmap_free */
+	uint8_t unmap_pixels:1; /* If set pixels are unmapped on gp_pixmap_free */
 };
 
 /* Determines the address of a pixel within the pixmap's image.
@@ -99,6 +103,10 @@ int gp_pixmap_set_gamma(gp_pixmap *self, float gamma);
  * Free pixmap.
  *
  * If pixmap->free_pixels, also free pixel data.
+ *
+ * If pixmap->unmap_pixels, the pixel data are a private file mapping that
+ * starts at the page pixels point into and ends with the last row, the
+ * mapping is unmapped.
  */
 void gp_pixmap_free(gp_pixmap *pixmap);
 
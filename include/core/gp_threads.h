@@ -80,4 +80,110 @@ struct gp_progress_cb_mp_priv {
  */
 int gp_progress_cb_mp(gp_progress_cb *self);
 
+/*
+ * Row band worker function.
+ *
+ * Processes rows [y, y + h) of the job. Returns non-zero and sets errno on a
+ * failure, which aborts the rest of the job.
+ */
+typedef int (*gp_threads_rows_fn)(void *priv, gp_coord y, gp_size h);
+
+/*
+ * Parallel for over rows.
+ *
+ * Splits h rows into bands of band_h rows and runs fn() on them in a
+ * process-wide pool of worker threads, the calling thread works on the bands
+ * as well. The pool is created lazily on the first call and grows up to the
+ * largest number of threads ever requested, the threads are reused for all
+ * subsequent calls.
+ *
+ * Each thread starts with a continuous range of bands and once it runs out of
+ * work it steals half of the remaining bands from the busiest thread, so a
+ * single slow thread does not stall the whole job.
+ *
+ * The threads parameter is usually a value returned from gp_nr_threads() and
+ * band_h a value returned from gp_threads_band_rows(), if band_h is 0 a
+ * default is used.
+ *
+ * If the pool is busy with a job started from a different thread, or if the
+ * function is called from a pool worker, the bands are processed in the
+ * calling thread.
+ *
+ * The callback, if not NULL, is called after each finished band and may
+ * abort the job, in that case errno is set to ECANCELED.
+ *
+ * Returns zero on success, non-zero and sets errno on a failure.
+ */
+int gp_threads_rows_ex(gp_size h, unsigned int threads, gp_size band_h,
+                       gp_threads_rows_fn fn, void *priv,
+                       gp_progress_cb *callback);
+
+/*
+ * Same as gp_threads_rows_ex() with default band height.
+ */
+int gp_threads_rows(gp_size h, unsigned int threads,
+                    gp_threads_rows_fn fn, void *priv,
+                    gp_progress_cb *callback);
+
+/*
+ * Returns band height for gp_threads_rows_ex().
+ *
+ * The bytes_per_row is the number of bytes processed per row, the kern_size
+ * is the filter kernel size, i.e. amount of work per pixel, which should be
+ * set to 1 for point filters. The ctx_rows is the kernel height, the band is
+ * at least ctx_rows high, since each band reads ctx_rows - 1 rows of context.
+ * Use 1 for filters that do not read neighbouring rows.
+ *
+ * The bands are sized so that there are several bands per thread, the band
+ * data fits into a cache and each band does enough work to amortize the
+ * scheduling overhead.
+ */
+gp_size gp_threads_band_rows(gp_size h, unsigned int threads,
+                             gp_size bytes_per_row, unsigned int kern_size,
+                             unsigned int ctx_rows);
+
+/*
+ * Scratch buffers for the gp_threads_rows() bands.
+ *
+ * There is at most one band per thread running at a time, hence one slot per
+ * thread is enough. Each band takes a free slot when it starts and returns it
+ * when it's done.
+ */
+typedef struct gp_threads_slots {
+	unsigned int nr;
+	size_t size;
+	void *slots;
+	uint8_t *busy;
+} gp_threads_slots;
+
+/*
+ * Makes sure there are at least nr slots of size bytes, allocates only if
+ * more or larger slots are needed. Newly allocated slots are zeroed.
+ *
+ * Returns zero on success, non-zero and sets errno on failure.
+ */
+int gp_threads_slots_alloc(gp_threads_slots *self, unsigned int nr,
+                           size_t size);
+
+void gp_threads_slots_free(gp_threads_slots *self);
+
+/*
+ * Takes a free slot and stores its index into slot.
+ *
+ * Returns NULL and sets errno if there is no free slot, which means that
+ * there are less slots than threads.
+ */
+void *gp_threads_slot_get(gp_threads_slots *self, unsigned int *slot);
+
+void gp_threads_slot_put(gp_threads_slots *self, unsigned int slot);
+
+/*
+ * Returns a pointer to the slot data.
+ */
+static inline void *gp_threads_slot(const gp_threads_slots *self,
+                                    unsigned int slot)
+{
+	return (char*)self->slots + (size_t)slot * self->size;
+}
+
 #endif /* CORE_GP_THREADS_H */
@@ -5,7 +5,7 @@
 
 /*
 
-   Gaussian blur implementation.
+   Gaussian and box blur implementation.
 
  */
 
@@ -51,4 +51,41 @@ static inline gp_pixmap *gp_filter_gaussian_blur_alloc(const gp_pixmap *src,
 	                                        x_sigma, y_sigma, callback);
 }
 
+/*
+ * Box blur, i.e. mean of the (2 * xrad + 1) x (2 * yrad + 1) rectangle.
+ *
+ * Computed from a summed area table, hence the cost per pixel does not depend
+ * on the radius. Works 'in-place'.
+ */
+int gp_filter_box_blur_ex(const gp_pixmap *src,
+                          gp_coord x_src, gp_coord y_src,
+                          gp_size w_src, gp_size h_src,
+                          gp_pixmap *dst,
+                          gp_coord x_dst, gp_coord y_dst,
+                          unsigned int xrad, unsigned int yrad,
+                          gp_progress_cb *callback);
+
+gp_pixmap *gp_filter_box_blur_ex_alloc(const gp_pixmap *src,
+                                       gp_coord x_src, gp_coord y_src,
+                                       gp_size w_src, gp_size h_src,
+                                       unsigned int xrad, unsigned int yrad,
+                                       gp_progress_cb *callback);
+
+static inline int gp_filter_box_blur(const gp_pixmap *src, gp_pixmap *dst,
+                                     unsigned int xrad, unsigned int yrad,
+                                     gp_progress_cb *callback)
+{
+	return gp_filter_box_blur_ex(src, 0, 0, src->w, src->h, dst, 0, 0,
+	                             xrad, yrad, callback);
+}
+
+static inline gp_pixmap *gp_filter_box_blur_alloc(const gp_pixmap *src,
+                                                  unsigned int xrad,
+                                                  unsigned int yrad,
+                                                  gp_progress_cb *callback)
+{
+	return gp_filter_box_blur_ex_alloc(src, 0, 0, src->w, src->h,
+	                                   xrad, yrad, callback);
+}
+
 #endif /* FILTERS_GP_BLUR_H */
@@ -0,0 +1,123 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Streaming filter pipeline.
+
+   The pipeline is a chain of filter stages the image rows are pushed through
+   in small bands, each stage keeps only the rows it needs to produce its next
+   band of output, i.e. the band plus the rows the kernel reaches into, which
+   keeps the working set small enough to stay in the cache and avoids
+   allocating a full sized intermediate pixmap for each stage.
+
+   The rows produced by the last stage are passed to a sink callback, e.g. a
+   row writer that encodes them into a file.
+
+  */
+
+#ifndef FILTERS_GP_FILTER_PIPE_H
+#define FILTERS_GP_FILTER_PIPE_H
+
+#include <filters/gp_filter.h>
+#include <filters/gp_apply_tables.h>
+#include <filters/gp_resize.h>
+
+typedef struct gp_filter_pipe gp_filter_pipe;
+
+/*
+ * Called with each band of rows produced by the pipeline, in order.
+ *
+ * Returns zero on success, non-zero aborts the pipeline and the value of
+ * errno is returned from gp_filter_pipe_push().
+ */
+typedef int (*gp_filter_pipe_sink)(const gp_pixmap *rows, void *priv);
+
+/*
+ * Creates an empty pipeline for an image of w x h pixels of pixel_type.
+ *
+ * Returns NULL and sets errno on failure.
+ */
+gp_filter_pipe *gp_filter_pipe_create(gp_size w, gp_size h,
+                                      gp_pixel_type pixel_type,
+                                      gp_filter_pipe_sink sink, void *priv);
+
+/*
+ * Functions to append a stage at the end of the pipeline, the stages can be
+ * appended only before first rows were pushed.
+ *
+ * All return zero on success, non-zero and set errno on failure, EINVAL for
+ * invalid parameters and ENOSYS if the stage does not support the pixel type
+ * of the previous stage.
+ */
+
+/*
+ * Point filter, i.e. brightness, contrast, etc. The tables are not copied
+ * and must not be freed before the pipeline.
+ */
+int gp_filter_pipe_tables(gp_filter_pipe *self,
+                          const gp_filter_tables *tables);
+
+/*
+ * Linear convolution with kw x kh kernel, see gp_linear.h.
+ */
+int gp_filter_pipe_convolution(gp_filter_pipe *self,
+                               const float kernel[], unsigned int kw,
+                               unsigned int kh, float kern_div);
+
+/*
+ * Separable linear convolution, horizontal pass runs on each row once as it
+ * enters the stage, vertical pass on the rows kept by the stage.
+ */
+int gp_filter_pipe_vhconvolution(gp_filter_pipe *self,
+                                 const float hkernel[], unsigned int kw,
+                                 float hkern_div,
+                                 const float vkernel[], unsigned int kh,
+                                 float vkern_div);
+
+/*
+ * Laplace edge sharpening, see gp_laplace.h.
+ */
+int gp_filter_pipe_edge_sharpening(gp_filter_pipe *self, float w);
+
+/*
+ * Resampling into w x h, only 8 bit per channel pixel types and the
+ * interpolations implemented by the separable resampler, i.e. all but
+ * GP_INTERP_NN and GP_INTERP_CUBIC, are supported.
+ */
+int gp_filter_pipe_resize(gp_filter_pipe *self, gp_size w, gp_size h,
+                          gp_interpolation_type type);
+
+/*
+ * Floyd Steinberg dithering into a gray or RGB pixel_type.
+ */
+int gp_filter_pipe_floyd_steinberg(gp_filter_pipe *self,
+                                   gp_pixel_type pixel_type);
+
+/*
+ * Pixel type conversion.
+ */
+int gp_filter_pipe_convert(gp_filter_pipe *self, gp_pixel_type pixel_type);
+
+/*
+ * Returns size and pixel type of the rows passed to the sink.
+ */
+void gp_filter_pipe_out(const gp_filter_pipe *self, gp_size *w, gp_size *h,
+                        gp_pixel_type *pixel_type);
+
+/*
+ * Pushes next rows->h rows of the image through the pipeline, the rows width
+ * and pixel type must match the pipeline and the rows must not be rotated.
+ *
+ * The sink is called for each band of output rows as soon as it's finished,
+ * all rows are passed to the sink once all image rows were pushed.
+ *
+ * Returns zero on success, non-zero and sets errno on failure.
+ */
+int gp_filter_pipe_push(gp_filter_pipe *self, const gp_pixmap *rows);
+
+void gp_filter_pipe_free(gp_filter_pipe *self);
+
+#endif /* FILTERS_GP_FILTER_PIPE_H */
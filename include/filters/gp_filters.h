@@ -24,6 +24,9 @@
 /* Histograms, ... */
 #include <filters/gp_stats.h>
 
+/* Summed area tables */
+#include <filters/gp_sat.h>
+
 /* Image rotations (90 180 270 grads) and mirroring */
 #include <filters/gp_rotate.h>
 
@@ -44,6 +47,8 @@
 #include <filters/gp_resize_nn.h>
 #include <filters/gp_resize_linear.h>
 #include <filters/gp_resize_cubic.h>
+#include <filters/gp_resize_lanczos.h>
+#include <filters/gp_resize_area.h>
 
 /* Bitmap dithering */
 #include <filters/gp_dither.h>
@@ -67,4 +72,7 @@
 #include <filters/gp_multi_tone.h>
 #include <filters/gp_sepia.h>
 
+/* Streaming filter pipeline */
+#include <filters/gp_filter_pipe.h>
+
 #endif /* FILTERS_GP_FILTERS_H */
@@ -13,5 +13,81 @@
 #define FILTERS_GP_POINT_H
 
 #include <filters/gp_point.gen.h>
+#include <filters/gp_apply_tables.h>
+
+/*
+ * Point operations that can be composed into a single set of lookup tables,
+ * the parameters are the same as for the corresponding filters above.
+ */
+enum gp_point_op_type {
+	GP_POINT_BRIGHTNESS,
+	GP_POINT_CONTRAST,
+	GP_POINT_BRIGHTNESS_CONTRAST,
+	GP_POINT_POSTERIZE,
+	GP_POINT_INVERT,
+};
+
+typedef struct gp_point_op {
+	enum gp_point_op_type type;
+	/* brightness */
+	float b;
+	/* contrast */
+	float c;
+	/* posterize */
+	unsigned int steps;
+} gp_point_op;
+
+#define GP_POINT_OP_BRIGHTNESS(p) {.type = GP_POINT_BRIGHTNESS, .b = (p)}
+#define GP_POINT_OP_CONTRAST(p) {.type = GP_POINT_CONTRAST, .c = (p)}
+#define GP_POINT_OP_BRIGHTNESS_CONTRAST(pb, pc) \
+	{.type = GP_POINT_BRIGHTNESS_CONTRAST, .b = (pb), .c = (pc)}
+#define GP_POINT_OP_POSTERIZE(s) {.type = GP_POINT_POSTERIZE, .steps = (s)}
+#define GP_POINT_OP_INVERT {.type = GP_POINT_INVERT}
+
+/*
+ * Applies ops, in order, on the tables initialized for the pixmap pixel type
+ * by gp_filter_tables_init(), i.e. the resulting tables map each channel
+ * value to the value the ops applied one after another would produce.
+ *
+ * Returns zero on success, non-zero and sets errno to EINVAL on invalid op.
+ */
+int gp_filter_tables_point_ops(gp_filter_tables *self, const gp_pixmap *pixmap,
+                               const gp_point_op ops[], unsigned int ops_cnt);
+
+/*
+ * Applies a chain of point operations in a single pass over the pixels.
+ */
+int gp_filter_point_ops_ex(const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_point_op ops[], unsigned int ops_cnt,
+                           gp_progress_cb *callback);
+
+gp_pixmap *gp_filter_point_ops_ex_alloc(const gp_pixmap *src,
+                                        gp_coord x_src, gp_coord y_src,
+                                        gp_size w_src, gp_size h_src,
+                                        const gp_point_op ops[],
+                                        unsigned int ops_cnt,
+                                        gp_progress_cb *callback);
+
+static inline int gp_filter_point_ops(const gp_pixmap *src, gp_pixmap *dst,
+                                      const gp_point_op ops[],
+                                      unsigned int ops_cnt,
+                                      gp_progress_cb *callback)
+{
+	return gp_filter_point_ops_ex(src, 0, 0, src->w, src->h,
+	                              dst, 0, 0, ops, ops_cnt, callback);
+}
+
+static inline gp_pixmap *gp_filter_point_ops_alloc(const gp_pixmap *src,
+                                                   const gp_point_op ops[],
+                                                   unsigned int ops_cnt,
+                                                   gp_progress_cb *callback)
+{
+	return gp_filter_point_ops_ex_alloc(src, 0, 0, src->w, src->h,
+	                                    ops, ops_cnt, callback);
+}
 
 #endif /* FILTERS_GP_POINT_H */
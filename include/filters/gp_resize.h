@@ -32,6 +32,19 @@
   low-pass filter (for example gaussian blur) must be used on original image
   before scaling is done.
 
+  Lanczos
+  ~~~~~~~
+
+  Lanczos-3, the kernel is stretched over the area of the destination pixel
+  on downscaling, hence works well for both up and downscaling. Slower than
+  bicubic, especially for large downscaling ratios.
+
+  Area
+  ~~~~
+
+  Each destination pixel is an average of the source area it covers. Fast
+  and alias free downscaling for any ratio, e.g. for thumbnails.
+
  */
 
 #ifndef FILTERS_GP_RESIZE_H
@@ -45,7 +58,9 @@ typedef enum gp_interpolation_type {
 	GP_INTERP_LINEAR_LF_INT, /* Bilinear + low pass filter on downscaling */
 	GP_INTERP_CUBIC,         /* Bicubic                                   */
 	GP_INTERP_CUBIC_INT,     /* Bicubic - fixed point arithmetics         */
-	GP_INTERP_MAX = GP_INTERP_CUBIC_INT,
+	GP_INTERP_LANCZOS_INT,   /* Lanczos-3 - fixed point arithmetics       */
+	GP_INTERP_AREA_INT,      /* Area averaging - fixed point arithmetics  */
+	GP_INTERP_MAX = GP_INTERP_AREA_INT,
 } gp_interpolation_type;
 
 const char *gp_interpolation_type_name(enum gp_interpolation_type interp_type);
@@ -71,4 +86,37 @@ gp_pixmap *gp_filter_resize_alloc(const gp_pixmap *src,
                                   gp_interpolation_type type,
                                   gp_progress_cb *callback);
 
+typedef struct gp_resize_plan gp_resize_plan;
+
+/*
+ * Creates a resize plan, i.e. precomputed weights and scratch buffers for
+ * repeated resizing of src_w x src_h pixmaps into dst_w x dst_h pixmaps of a
+ * given pixel type, e.g. video frames or a batch of thumbnails.
+ *
+ * Returns NULL in case of failure and errno is set correspondingly.
+ */
+gp_resize_plan *gp_resize_plan_create(gp_size src_w, gp_size src_h,
+                                      gp_size dst_w, gp_size dst_h,
+                                      gp_pixel_type pixel_type,
+                                      gp_interpolation_type type);
+
+/*
+ * Resizes src into dst, the pixmaps must match the sizes and the pixel type
+ * the plan was created for.
+ *
+ * Plans executed by the separable resampler, i.e. integer interpolations
+ * other than nearest neighbour on GP_PIXEL_IS_8BPC pixel types and no gamma
+ * correction for cubic, do not allocate once the plan was executed, unless
+ * the number of threads grows. Other plans are passed to gp_filter_resize()
+ * which allocates on each call. The plan must not be executed from several
+ * threads at once.
+ *
+ * Returns non-zero on error (interrupted from callback), zero on success.
+ */
+int gp_resize_plan_exec(gp_resize_plan *self,
+                        const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback);
+
+void gp_resize_plan_free(gp_resize_plan *self);
+
 #endif /* FILTERS_GP_RESIZE_H */
@@ -0,0 +1,32 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Area averaging (box) interpolation.
+
+ */
+
+#ifndef FILTERS_GP_RESIZE_AREA_H
+#define FILTERS_GP_RESIZE_AREA_H
+
+#include <filters/gp_filter.h>
+#include <filters/gp_resize.h>
+
+/*
+ * Area averaging, implemented only for pixel types with 8 bit per channel,
+ * fails with ENOSYS otherwise.
+ */
+int gp_filter_resize_area_int(const gp_pixmap *src, gp_pixmap *dst,
+                              gp_progress_cb *callback);
+
+static inline gp_pixmap *gp_filter_resize_area_int_alloc(const gp_pixmap *src,
+                                                         gp_size w, gp_size h,
+                                                         gp_progress_cb *callback)
+{
+	return gp_filter_resize_alloc(src, w, h, GP_INTERP_AREA_INT, callback);
+}
+
+#endif /* FILTERS_GP_RESIZE_AREA_H */
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Summed area tables (integral images).
+
+   The table holds for each position a sum of all channel values above and to
+   the left of it, which allows to compute a sum of any rectangle, and hence
+   a local mean and variance, in constant time regardless of its size.
+
+  */
+
+#ifndef FILTERS_GP_SAT_H
+#define FILTERS_GP_SAT_H
+
+#include <stdint.h>
+
+#include <filters/gp_filter.h>
+
+enum gp_sat_flags {
+	/* Build tables of squared values as well, needed for variance */
+	GP_SAT_SQUARES = 0x01,
+};
+
+typedef struct gp_sat {
+	/* Size of the area the table is built for */
+	gp_size w, h;
+	/* Offset of the source rectangle in the table area */
+	gp_size xoff, yoff;
+	unsigned int nr_chans;
+	/*
+	 * The accumulators are 32 bit if the sum over the largest rectangle
+	 * that can be queried fits, otherwise 64 bit. The 32 bit tables wrap
+	 * around, yet give exact sums for such rectangles.
+	 */
+	uint8_t sum_bits;
+	uint8_t sqsum_bits;
+	/*
+	 * (w + 1) x (h + 1) entries with the channels interleaved, the first
+	 * row and column are zeroes.
+	 */
+	void *sum;
+	/* NULL unless created with GP_SAT_SQUARES */
+	void *sqsum;
+} gp_sat;
+
+/*
+ * Builds summed area tables for querying rectangles of at most
+ * (2 * xrad + 1) x (2 * yrad + 1) pixels that reach at most xrad and yrad
+ * pixels outside of the w_src x h_src rectangle of the source.
+ *
+ * The pixels outside of the source pixmap are clamped to its edges, i.e. the
+ * same way the convolution filters handle the image borders. The table
+ * covers only the part of the extended rectangle that is inside of the
+ * pixmap, the rest is computed from the table edges on a query.
+ *
+ * The table is built in threads, the pixmap must not be palette.
+ *
+ * Returns NULL and sets errno on failure.
+ */
+gp_sat *gp_sat_alloc_ex(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_size xrad, gp_size yrad,
+                        int flags, gp_progress_cb *callback);
+
+/*
+ * Builds summed area tables for querying any rectangle inside of the pixmap.
+ */
+static inline gp_sat *gp_sat_alloc(const gp_pixmap *src, int flags,
+                                   gp_progress_cb *callback)
+{
+	return gp_sat_alloc_ex(src, 0, 0, src->w, src->h,
+	                       src->w / 2, src->h / 2, flags, callback);
+}
+
+void gp_sat_free(gp_sat *self);
+
+/*
+ * Returns sum over [x0, x1) x [y0, y1) rectangle of the table area.
+ */
+static inline uint64_t gp_sat_table_rect(const gp_sat *self, const void *table,
+                                         uint8_t bits, unsigned int chan,
+                                         gp_size x0, gp_size y0,
+                                         gp_size x1, gp_size y1)
+{
+	size_t stride = (size_t)(self->w + 1) * self->nr_chans;
+	size_t i00, i01, i10, i11;
+
+	i00 = y0 * stride + x0 * self->nr_chans + chan;
+	i01 = y0 * stride + x1 * self->nr_chans + chan;
+	i10 = y1 * stride + x0 * self->nr_chans + chan;
+	i11 = y1 * stride + x1 * self->nr_chans + chan;
+
+	if (bits == 32) {
+		const uint32_t *t = table;
+		return (uint32_t)(t[i11] - t[i01] - t[i10] + t[i00]);
+	} else {
+		const uint64_t *t = table;
+		return t[i11] - t[i01] - t[i10] + t[i00];
+	}
+}
+
+/*
+ * Slow path for rectangles reaching outside of the table area, the table edge
+ * rows and columns are repeated.
+ */
+uint64_t gp_sat_table_sum_clamped(const gp_sat *self, const void *table,
+                                  uint8_t bits, unsigned int chan,
+                                  gp_coord x0, gp_coord y0,
+                                  gp_coord x1, gp_coord y1);
+
+static inline uint64_t gp_sat_table_sum(const gp_sat *self, const void *table,
+                                        uint8_t bits, unsigned int chan,
+                                        gp_coord x0, gp_coord y0,
+                                        gp_coord x1, gp_coord y1)
+{
+	x0 += self->xoff;
+	x1 += self->xoff;
+	y0 += self->yoff;
+	y1 += self->yoff;
+
+	if (x0 < 0 || y0 < 0 ||
+	    x1 > (gp_coord)self->w || y1 > (gp_coord)self->h) {
+		return gp_sat_table_sum_clamped(self, table, bits, chan,
+		                                x0, y0, x1, y1);
+	}
+
+	return gp_sat_table_rect(self, table, bits, chan, x0, y0, x1, y1);
+}
+
+/*
+ * Returns sum of the channel values in [x0, x1) x [y0, y1) rectangle, the
+ * coordinates are relative to the table source rectangle and may reach up to
+ * xrad and yrad outside of it.
+ */
+static inline uint64_t gp_sat_sum(const gp_sat *self, unsigned int chan,
+                                  gp_coord x0, gp_coord y0,
+                                  gp_coord x1, gp_coord y1)
+{
+	return gp_sat_table_sum(self, self->sum, self->sum_bits,
+	                        chan, x0, y0, x1, y1);
+}
+
+/*
+ * Same as gp_sat_sum() but for squared values, the table must have been
+ * created with GP_SAT_SQUARES.
+ */
+static inline uint64_t gp_sat_sqsum(const gp_sat *self, unsigned int chan,
+                                    gp_coord x0, gp_coord y0,
+                                    gp_coord x1, gp_coord y1)
+{
+	return gp_sat_table_sum(self, self->sqsum, self->sqsum_bits,
+	                        chan, x0, y0, x1, y1);
+}
+
+/*
+ * Local mean of the channel values in the rectangle.
+ */
+static inline float gp_sat_mean(const gp_sat *self, unsigned int chan,
+                                gp_coord x0, gp_coord y0,
+                                gp_coord x1, gp_coord y1)
+{
+	float n = (float)(x1 - x0) * (y1 - y0);
+
+	return gp_sat_sum(self, chan, x0, y0, x1, y1) / n;
+}
+
+/*
+ * Local variance of the channel values in the rectangle, the table must have
+ * been created with GP_SAT_SQUARES.
+ */
+static inline float gp_sat_variance(const gp_sat *self, unsigned int chan,
+                                    gp_coord x0, gp_coord y0,
+                                    gp_coord x1, gp_coord y1)
+{
+	double n = (double)(x1 - x0) * (y1 - y0);
+	double mean = gp_sat_sum(self, chan, x0, y0, x1, y1) / n;
+	double var = gp_sat_sqsum(self, chan, x0, y0, x1, y1) / n - mean * mean;
+
+	return var > 0 ? var : 0;
+}
+
+#endif /* FILTERS_GP_SAT_H */
@@ -18,6 +18,9 @@
    value is computed as mean of the surrounding pixels (not including the
    center one).
 
+   Windows larger than a few pixels are computed from sliding histograms so the
+   cost per pixel does not depend on the radius.
+
   */
 
 #ifndef FILTERS_GP_SIGMA_H
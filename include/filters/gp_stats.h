@@ -36,8 +36,19 @@ gp_histogram_channel *gp_histogram_channel_by_name(gp_histogram *self,
 
 /*
  * Computes histogram. Returns non-zero on failure (i.e. canceled by callback).
+ *
+ * The image is split into row bands counted in parallel into per-thread
+ * partial histograms which are summed at the end.
  */
 int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
                         gp_progress_cb *callback);
 
+/*
+ * Same as gp_filter_histogram() but counts only every stride-th pixel of
+ * every stride-th row, i.e. approximately 1/(stride * stride) of the pixels,
+ * which is good enough for statistics of huge images.
+ */
+int gp_filter_histogram_stride(gp_histogram *self, const gp_pixmap *src,
+                               unsigned int stride, gp_progress_cb *callback);
+
 #endif /* FILTERS_GP_STATS_H */
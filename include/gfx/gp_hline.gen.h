@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_hline.gen.h
+ *
+ * GENERATED on 2026 10 18 07:44:56 from gp_hline.gen.h.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+#ifndef GP_HLINE_GEN_H
+#define GP_HLINE_GEN_H
+
+/*
+ * HLine generated header
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+void gp_hline_raw_1BPP_LE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_1BPP_BE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_2BPP_LE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_2BPP_BE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_4BPP_LE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_4BPP_BE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_8BPP(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_16BPP(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_24BPP(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_32BPP(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+void gp_hline_raw_18BPP_LE(gp_pixmap *pixmap, gp_coord x0,
+			gp_coord x1, gp_coord y, gp_pixel pixel);
+
+#endif /* GP_HLINE_GEN_H */
@@ -24,6 +24,11 @@ struct gp_io {
 	int (*close)(gp_io *self);
 
 	off_t mark;
+	/*
+	 * Set only by the memory backed I/O created by the library, see
+	 * gp_io_map().
+	 */
+	const void *(*map)(gp_io *self, size_t size);
 	char priv[];
 };
 
@@ -52,6 +57,18 @@ static inline off_t gp_io_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 	return io->seek(io, off, whence);
 }
 
+/*
+ * Returns a pointer to size bytes at the current offset and moves the offset
+ * after them. The data are valid until the I/O is closed and must not be
+ * modified.
+ *
+ * Works only for memory backed I/O, i.e. gp_io_mem() and gp_io_mmap(),
+ * otherwise NULL is returned and errno is set to ENOSYS, in that case the
+ * data has to be read with gp_io_read() instead. If there is less than size
+ * bytes left NULL is returned and errno is set to EIO.
+ */
+const void *gp_io_map(gp_io *io, size_t size);
+
 /*
  * PutC returns zero on success, non-zero on failure.
  */
@@ -185,6 +202,8 @@ enum gp_io_file_mode {
 
 /*
  * Creates I/O from a file. On error NULL is returned and errno is set.
+ *
+ * The read only I/O is buffered with gp_io_rbuffer().
  */
 gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode);
 
@@ -195,6 +214,16 @@ gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode);
  */
 gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *));
 
+/*
+ * Creates read only I/O from a file mapped into the memory.
+ *
+ * The reads are served from the mapping and the data can be accessed directly
+ * with gp_io_map(). The file must not be truncated while the I/O is open.
+ *
+ * On error NULL is returned and errno is set.
+ */
+gp_io *gp_io_mmap(const char *path);
+
 /*
  * Create a sub I/O from an I/O.
  *
@@ -215,4 +244,15 @@ gp_io *gp_io_sub_io(gp_io *pio, size_t size);
  */
 gp_io *gp_io_wbuffer(gp_io *pio, size_t bsize);
 
+/*
+ * Creates a readable buffered I/O on the top of the existing I/O.
+ *
+ * The data are read from the parent I/O in bsize blocks, small reads and
+ * seeks inside of the buffered block do not touch the parent I/O at all.
+ * Closing the buffered I/O does not close the parent I/O.
+ *
+ * Passing zero as bsize select default buffer size.
+ */
+gp_io *gp_io_rbuffer(gp_io *pio, size_t bsize);
+
 #endif /* LOADERS_GP_IO_H */
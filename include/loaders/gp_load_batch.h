@@ -0,0 +1,91 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Batch image loader, decodes a list of images on a pool of worker threads.
+
+   The images are queued with gp_load_batch_add() or gp_load_batch_add_io()
+   and picked up with gp_load_batch_get(), either in the order they were added
+   or as soon as they are decoded.
+
+   The memory is bounded by a byte budget, workers do not start decoding next
+   image while the decoded but not yet picked up images take more than the
+   budget. Since the image size is not known before it's decoded the budget
+   may be exceeded by at most one image per worker thread.
+
+  */
+
+#ifndef LOADERS_GP_LOAD_BATCH_H
+#define LOADERS_GP_LOAD_BATCH_H
+
+#include <stddef.h>
+
+#include <core/gp_types.h>
+#include <loaders/gp_io.h>
+
+typedef struct gp_load_batch gp_load_batch;
+
+enum gp_load_batch_flags {
+	/* Images are returned in the order they were added */
+	GP_LOAD_BATCH_ORDERED = 0x01,
+};
+
+struct gp_load_batch_res {
+	/* Index of the image in the order it was added, starting from 0 */
+	size_t idx;
+	/* The priv pointer passed to the add function */
+	void *priv;
+	/* Decoded image or NULL on a failure */
+	gp_pixmap *img;
+	/* Errno from the loader if img is NULL */
+	int err;
+};
+
+/*
+ * Creates a batch loader and starts the worker threads.
+ *
+ * If threads is 0 the number of online processors is used, the max_bytes is
+ * the byte budget for decoded images that were not picked up yet, 0 means no
+ * limit. The flags are bitwise or of enum gp_load_batch_flags.
+ *
+ * Returns NULL and sets errno on a failure.
+ */
+gp_load_batch *gp_load_batch_create(unsigned int threads, size_t max_bytes,
+                                    int flags);
+
+/*
+ * Queues an image file for loading, the image is loaded by gp_load_image_ex().
+ *
+ * Returns zero on success, non-zero and sets errno on a failure.
+ */
+int gp_load_batch_add(gp_load_batch *self, const char *path, void *priv);
+
+/*
+ * Queues an I/O stream for loading, the image is read by gp_read_image_ex().
+ *
+ * The I/O stream is not closed and must not be used by the caller until the
+ * result for it was returned from gp_load_batch_get().
+ *
+ * Returns zero on success, non-zero and sets errno on a failure.
+ */
+int gp_load_batch_add_io(gp_load_batch *self, gp_io *io, void *priv);
+
+/*
+ * Waits for next decoded image, the image is then owned by the caller.
+ *
+ * Returns zero on success, the image may have failed to load in that case
+ * res->img is NULL and res->err is set. Returns non-zero and sets errno to
+ * ENOENT if all queued images were returned already.
+ */
+int gp_load_batch_get(gp_load_batch *self, struct gp_load_batch_res *res);
+
+/*
+ * Aborts the images that are being decoded, stops the worker threads and
+ * frees images that were not picked up.
+ */
+void gp_load_batch_free(gp_load_batch *self);
+
+#endif /* LOADERS_GP_LOAD_BATCH_H */
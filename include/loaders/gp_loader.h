@@ -40,6 +40,39 @@ int gp_load_image_ex(const char *src_path,
                      gp_pixmap **img, gp_storage *meta_data,
                      gp_progress_cb *callback);
 
+/*
+ * Same as gp_load_image_ex() but the image may be decoded downscaled, for
+ * formats that support it (i.e. JPEG), which is much faster.
+ *
+ * The image is never smaller than the size needed to fit it into w x h with
+ * preserved aspect ratio, the caller is supposed to resize the result to the
+ * exact size. Zero w or h means no limit in that direction.
+ */
+int gp_load_image_scaled(const char *src_path,
+                         gp_pixmap **img, gp_storage *meta_data,
+                         gp_size w, gp_size h,
+                         gp_progress_cb *callback);
+
+/*
+ * Loads an image without decoding for uncompressed formats, i.e. binary PGM
+ * and PPM with 8 bits per channel and 16, 24 and 32 bpp BMP.
+ *
+ * The pixels of the returned pixmap point directly into the file mapped into
+ * the memory, the bytes_per_row is set to the file row stride and bottom-up
+ * BMP images have the y_swap flag set, which is honored by the gp_getpixel()
+ * and gp_putpixel() but not by the raw pixel access. The pixel type may
+ * differ from what gp_load_image() returns, e.g. raw PPM is mapped as
+ * BGR888.
+ *
+ * The mapping is private, pixel writes are not written back to the file. The
+ * file must not be truncated while the pixmap exists.
+ *
+ * Other formats are loaded by gp_load_image().
+ *
+ * If operation fails NULL is returned and errno is filled.
+ */
+gp_pixmap *gp_load_image_mmap(const char *src_path, gp_progress_cb *callback);
+
 /*
  * Loads image Meta Data (if possible).
  */
@@ -102,7 +135,32 @@ struct gp_loader {
 	const char *fmt_name;
 
 	/*
-	 * NULL terminated array of file extensions.
+	 * Optional, reads image and/or metadata, the image may be decoded
+	 * downscaled, see gp_load_image_scaled().
+	 */
+	int (*read_scaled)(gp_io *io, gp_pixmap **img, gp_storage *storage,
+	                   gp_size w, gp_size h, gp_progress_cb *callback);
+
+	/*
+	 * Optional, starts row by row decoding, see gp_row_reader_open().
+	 *
+	 * The reader is allocated by malloc(), the loader fills in the
+	 * callbacks, image size and pixel type.
+	 */
+	gp_row_reader *(*row_reader)(gp_io *io);
+
+	/*
+	 * Optional, starts row by row encoding, see gp_row_writer_open().
+	 *
+	 * The writer is allocated by malloc(), the loader fills in the
+	 * callbacks. Must fail with ENOSYS before writing anything if the
+	 * pixel type is not supported.
+	 */
+	gp_row_writer *(*row_writer)(gp_io *io, gp_size w, gp_size h,
+	                             gp_pixel_type pixel_type);
+
+	/*
+	 * NULL terminated array of file extensions, must be the last member.
 	 */
 	const char *extensions[];
 };
@@ -161,6 +219,16 @@ int gp_loader_read_image_ex(const gp_loader *self, gp_io *io,
                             gp_pixmap **img, gp_storage *data,
                             gp_progress_cb *callback);
 
+/*
+ * Generic ReadImageScaled for a given loader.
+ *
+ * Calls the loader ReadScaled() method if implemented, Read() otherwise.
+ */
+int gp_loader_read_image_scaled(const gp_loader *self, gp_io *io,
+                                gp_pixmap **img, gp_storage *data,
+                                gp_size w, gp_size h,
+                                gp_progress_cb *callback);
+
 /*
  * Generic LoadImageEx for a given loader.
  *
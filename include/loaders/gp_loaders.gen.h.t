@@ -28,6 +28,13 @@ static inline gp_pixmap *gp_read_{{fmt}}(gp_io *io, gp_progress_cb *callback)
 }
 @ end
 
+/*
+ * Decodes JPEG downscaled by 1/2, 1/4 or 1/8 as long as the result is not
+ * smaller than needed to fit into w x h, see gp_load_image_scaled().
+ */
+int gp_read_jpg_scaled(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                       gp_size w, gp_size h, gp_progress_cb *callback);
+
 @ for fmt in ['bmp', 'jpg', 'png', 'tiff', 'pbm', 'pgm', 'ppm', 'pnm']:
 {@ reader(fmt) @}
 
@@ -24,6 +24,8 @@
 #include <loaders/gp_exif.h>
 
 #include <loaders/gp_loader.h>
+#include <loaders/gp_load_batch.h>
+#include <loaders/gp_rows.h>
 
 #include <loaders/gp_container.h>
 #include <loaders/gp_zip.h>
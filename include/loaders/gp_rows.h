@@ -0,0 +1,171 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Streaming row by row image decoding and encoding.
+
+   The reader decodes the image a few rows at a time into a caller supplied
+   pixmap and the writer encodes rows as they are passed in, which allows for
+   conversion pipelines that run in memory bounded by the band of rows
+   instead of the whole image.
+
+   The rows are accessed as raw pixels, the pixmaps passed to the reader and
+   writer must not be rotated and must not be subpixmaps with non-zero
+   offset.
+
+  */
+
+#ifndef LOADERS_GP_ROWS_H
+#define LOADERS_GP_ROWS_H
+
+#include <core/gp_types.h>
+#include <loaders/gp_io.h>
+#include <loaders/gp_loader.h>
+#include <loaders/gp_line_convert.h>
+
+struct gp_row_reader {
+	/*
+	 * Decodes next rows->h rows into the rows pixmap.
+	 *
+	 * Returns zero on success, errno on failure.
+	 */
+	int (*read)(gp_row_reader *self, gp_pixmap *rows);
+
+	/*
+	 * Releases the decoder state, must not close the I/O or free the
+	 * reader itself.
+	 */
+	void (*close)(gp_row_reader *self);
+
+	gp_io *io;
+	/* The io was opened by the gp_row_reader_open() */
+	int close_io;
+
+	/* Image size and the pixel type rows are decoded into */
+	gp_size w;
+	gp_size h;
+	gp_pixel_type pixel_type;
+
+	/* Number of rows decoded so far */
+	gp_size row;
+
+	char priv[];
+};
+
+#define GP_ROW_READER_PRIV(self) ((void *)(self)->priv)
+
+struct gp_row_writer {
+	/*
+	 * Encodes rows->h rows from the rows pixmap.
+	 *
+	 * Returns zero on success, errno on failure.
+	 */
+	int (*write)(gp_row_writer *self, const gp_pixmap *rows);
+
+	/*
+	 * Finishes the image if all rows were written and releases the
+	 * encoder state, must not close the I/O or free the writer itself.
+	 *
+	 * Returns zero on success, errno on failure.
+	 */
+	int (*close)(gp_row_writer *self);
+
+	gp_io *io;
+
+	/* Set when the writer was opened by gp_row_writer_open() */
+	gp_io *file_io;
+	char *path;
+
+	/* Set when the rows are converted before they are passed to write() */
+	gp_line_convert convert;
+	gp_pixmap *conv;
+
+	/* Image size and the pixel type of the rows passed by the caller */
+	gp_size w;
+	gp_size h;
+	gp_pixel_type pixel_type;
+
+	/* Number of rows encoded so far */
+	gp_size row;
+
+	char priv[];
+};
+
+#define GP_ROW_WRITER_PRIV(self) ((void *)(self)->priv)
+
+/*
+ * Opens a file for row by row decoding, the format is matched by the file
+ * signature.
+ *
+ * Supported are PNG (not interlaced), JPEG, PNM, uncompressed BMP and TIFF
+ * saved in strips.
+ *
+ * Returns NULL and sets errno on failure, ENOSYS if the format does not
+ * support row by row decoding.
+ */
+gp_row_reader *gp_row_reader_open(const char *path);
+
+/*
+ * Same as gp_row_reader_open() but reads from an I/O, the I/O is not closed
+ * by the gp_row_reader_close().
+ */
+gp_row_reader *gp_row_reader_io(gp_io *io);
+
+/*
+ * Decodes next min(rows->h, remaining) rows into the rows pixmap, the pixmap
+ * width and pixel type must match the reader.
+ *
+ * Returns number of rows decoded, zero at the end of the image, -1 and sets
+ * errno on failure.
+ */
+int gp_row_reader_read(gp_row_reader *self, gp_pixmap *rows);
+
+void gp_row_reader_close(gp_row_reader *self);
+
+/*
+ * Creates a file for row by row encoding, the format is matched by the file
+ * extension.
+ *
+ * The rows are converted if the format does not support the pixel type but
+ * can save a pixel type that only differs in the channel order, see
+ * gp_line_convertible().
+ *
+ * Supported are PNG, JPEG, binary PGM and PPM and BMP.
+ *
+ * Returns NULL and sets errno on failure, ENOSYS if the format does not
+ * support row by row encoding or the pixel type.
+ */
+gp_row_writer *gp_row_writer_open(const char *path, gp_size w, gp_size h,
+                                  gp_pixel_type pixel_type);
+
+/*
+ * Same as gp_row_writer_open() but for a given loader and I/O, the I/O is not
+ * closed by gp_row_writer_close().
+ */
+gp_row_writer *gp_row_writer_io(const gp_loader *loader, gp_io *io,
+                                gp_size w, gp_size h,
+                                gp_pixel_type pixel_type);
+
+/*
+ * Encodes all rows from the rows pixmap, the pixmap width and pixel type must
+ * match the writer and the total number of rows must not exceed the image
+ * height.
+ *
+ * Returns zero on success, non-zero and sets errno on failure.
+ */
+int gp_row_writer_write(gp_row_writer *self, const gp_pixmap *rows);
+
+/*
+ * Finishes the image and frees the writer.
+ *
+ * Fails with EINVAL if not all rows were written, in that case the file
+ * created by gp_row_writer_open() is removed.
+ *
+ * Returns zero on success, non-zero and sets errno on failure.
+ */
+int gp_row_writer_close(gp_row_writer *self);
+
+#endif /* LOADERS_GP_ROWS_H */
@@ -9,5 +9,7 @@
 typedef struct gp_container gp_container;
 typedef struct gp_container_ops gp_container_ops;
 typedef struct gp_io gp_io;
+typedef struct gp_row_reader gp_row_reader;
+typedef struct gp_row_writer gp_row_writer;
 
 #endif /* LOADERS_GP_TYPES_H */
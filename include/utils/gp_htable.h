@@ -52,4 +52,16 @@ void gp_htable_put(gp_htable *self, void *val, char *key);
  */
 void *gp_htable_get(gp_htable *self, const char *key);
 
+/**
+ * @brief Removes an element given a string key.
+ *
+ * The key is freed if the table was created with GP_HTABLE_COPY_KEY or
+ * GP_HTABLE_FREE_KEY.
+ *
+ * @param Hash table.
+ * @param key A string key.
+ * @return A value pointer of the removed element or NULL if not found.
+ */
+void *gp_htable_rem(gp_htable *self, const char *key);
+
 #endif /* GP_HTABLE_H */
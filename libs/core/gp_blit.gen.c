@@ -0,0 +1,14426 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_blit.gen.c
+ *
+ * GENERATED on 2026 10 18 08:13:30 from gp_blit.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Specialized blit functions and macros.
+ *
+ * Copyright (C) 2011      Tomas Gavenciak <gavento@ucw.cz>
+ * Copyright (C) 2011-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <string.h>
+
+#include <core/gp_byte_order.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include "core/gp_pixmap.h"
+#include <core/gp_blit.h>
+#include <core/gp_debug.h>
+#include <core/gp_convert.h>
+#include <core/gp_convert.gen.h>
+#include <core/gp_convert_scale.gen.h>
+#include <core/gp_mix_pixels2.gen.h>
+
+#include "gp_blit_rows.h"
+
+/*
+ * Used for pixel sizes that are not handled by the specialized code below.
+ */
+static void blit_xyxy_naive_raw(const gp_pixmap *src,
+                                gp_coord x0, gp_coord y0,
+				gp_coord x1, gp_coord y1,
+                                gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (src->pixel_type != dst->pixel_type)
+				p = gp_convert_pixmap_pixel(p, src, dst);
+
+			gp_putpixel_raw(dst, x2 + (x - x0), y2 + (y - y0), p);
+		}
+
+	}
+}
+
+/*
+ * Bit-aligned row copy for 1, 2 and 4 bpp.
+ *
+ * The row is treated as a string of bits in pixel order, for LE the first
+ * pixel is in the least significant bits of a byte, for BE in the most
+ * significant bits. The soff and doff are bit offsets in the first byte.
+ *
+ * The destination head and tail are merged with the existing bits and the
+ * rest is written in 64 bit words, each assembled from two source words
+ * shifted by the difference in alignment.
+ */
+static inline uint64_t load_le64(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER == __BIG_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static inline void store_le64(uint8_t *p, uint64_t v)
+{
+#if __BYTE_ORDER == __BIG_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline uint64_t load_be64(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v)
+{
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	memcpy(p, &v, sizeof(v));
+}
+
+/* Returns n <= 8 bits starting at soff */
+static inline unsigned int get_bits_LE(const uint8_t *src, unsigned int soff,
+                                       unsigned int n)
+{
+	unsigned int v = src[0] >> soff;
+
+	if (soff + n > 8)
+		v |= src[1] << (8 - soff);
+
+	return v & ((1u << n) - 1);
+}
+
+static inline unsigned int get_bits_BE(const uint8_t *src, unsigned int soff,
+                                       unsigned int n)
+{
+	unsigned int v = src[0] << 8;
+
+	if (soff + n > 8)
+		v |= src[1];
+
+	return (v >> (16 - soff - n)) & ((1u << n) - 1);
+}
+
+/* Writes n bits into a byte at doff, n + doff <= 8 */
+static inline void merge_bits_LE(uint8_t *dst, unsigned int doff,
+                                 unsigned int v, unsigned int n)
+{
+	unsigned int mask = ((1u << n) - 1) << doff;
+
+	*dst = (*dst & ~mask) | ((v << doff) & mask);
+}
+
+static inline void merge_bits_BE(uint8_t *dst, unsigned int doff,
+                                 unsigned int v, unsigned int n)
+{
+	unsigned int shift = 8 - doff - n;
+	unsigned int mask = ((1u << n) - 1) << shift;
+
+	*dst = (*dst & ~mask) | ((v << shift) & mask);
+}
+
+static void copy_bits_LE(uint8_t *dst, unsigned int doff,
+                          const uint8_t *src, unsigned int soff, size_t nbits)
+{
+	unsigned int n;
+
+	/* Fill the first destination byte */
+	if (doff) {
+		n = GP_MIN(8 - doff, nbits);
+
+		merge_bits_LE(dst, doff, get_bits_LE(src, soff, n), n);
+
+		dst++;
+		src += (soff + n) / 8;
+		soff = (soff + n) % 8;
+		nbits -= n;
+	}
+
+	/* Destination is byte aligned now */
+	if (!soff) {
+		memcpy(dst, src, nbits / 8);
+		dst += nbits / 8;
+		src += nbits / 8;
+		nbits %= 8;
+	} else {
+		for (; nbits >= 64; nbits -= 64) {
+			uint64_t w = load_le64(src) >> soff |
+			             (uint64_t)src[8] << (64 - soff);
+
+			store_le64(dst, w);
+			src += 8;
+			dst += 8;
+		}
+
+		for (; nbits >= 8; nbits -= 8) {
+			*dst++ = src[0] >> soff | src[1] << (8 - soff);
+			src++;
+		}
+	}
+
+	if (nbits)
+		merge_bits_LE(dst, 0, get_bits_LE(src, soff, nbits), nbits);
+}
+
+static void copy_bits_BE(uint8_t *dst, unsigned int doff,
+                          const uint8_t *src, unsigned int soff, size_t nbits)
+{
+	unsigned int n;
+
+	/* Fill the first destination byte */
+	if (doff) {
+		n = GP_MIN(8 - doff, nbits);
+
+		merge_bits_BE(dst, doff, get_bits_BE(src, soff, n), n);
+
+		dst++;
+		src += (soff + n) / 8;
+		soff = (soff + n) % 8;
+		nbits -= n;
+	}
+
+	/* Destination is byte aligned now */
+	if (!soff) {
+		memcpy(dst, src, nbits / 8);
+		dst += nbits / 8;
+		src += nbits / 8;
+		nbits %= 8;
+	} else {
+		for (; nbits >= 64; nbits -= 64) {
+			uint64_t w = load_be64(src) << soff |
+			             src[8] >> (8 - soff);
+
+			store_be64(dst, w);
+			src += 8;
+			dst += 8;
+		}
+
+		for (; nbits >= 8; nbits -= 8) {
+			*dst++ = src[0] << soff | src[1] >> (8 - soff);
+			src++;
+		}
+	}
+
+	if (nbits)
+		merge_bits_BE(dst, 0, get_bits_BE(src, soff, nbits), nbits);
+}
+
+/*
+ * Blit for equal pixel types 1BPP_LE
+ */
+static void blitXYXY_Raw_1BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 1;
+	unsigned int dst_bit = dst->offset + x2 * 1;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 1;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_LE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 1BPP_BE
+ */
+static void blitXYXY_Raw_1BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 1;
+	unsigned int dst_bit = dst->offset + x2 * 1;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 1;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_BE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 2BPP_LE
+ */
+static void blitXYXY_Raw_2BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 2;
+	unsigned int dst_bit = dst->offset + x2 * 2;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 2;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_LE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 2BPP_BE
+ */
+static void blitXYXY_Raw_2BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 2;
+	unsigned int dst_bit = dst->offset + x2 * 2;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 2;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_BE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 4BPP_LE
+ */
+static void blitXYXY_Raw_4BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 4;
+	unsigned int dst_bit = dst->offset + x2 * 4;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 4;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_LE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 4BPP_BE
+ */
+static void blitXYXY_Raw_4BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * 4;
+	unsigned int dst_bit = dst->offset + x2 * 4;
+	size_t nbits = (size_t)(x1 - x0 + 1) * 4;
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_BE(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
+}
+
+/*
+ * Blit for equal pixel types 8BPP
+ */
+static void blitXYXY_Raw_8BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_8BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_8BPP(src, x0, y0 + y),
+		       1 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 16BPP
+ */
+static void blitXYXY_Raw_16BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_16BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_16BPP(src, x0, y0 + y),
+		       2 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 24BPP
+ */
+static void blitXYXY_Raw_24BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_24BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_24BPP(src, x0, y0 + y),
+		       3 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 32BPP
+ */
+static void blitXYXY_Raw_32BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	/* memcpy() each horizontal line */
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++)
+		memcpy(GP_PIXEL_ADDR_32BPP(dst, x2, y2 + y),
+		       GP_PIXEL_ADDR_32BPP(src, x0, y0 + y),
+		       4 * (x1 - x0 + 1));
+}
+
+/*
+ * Blit for equal pixel types 18BPP_LE
+ */
+static void blitXYXY_Raw_18BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+}
+
+/*
+ * Generate Blits, I know this is n^2 variants but the gain is in speed is
+ * more than 50% and the size footprint for two for cycles is really small.
+ */
+/*
+ * Blits xRGB8888 to RGBA8888
+ */
+static void blitXYXY_Raw_xRGB8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB888
+ */
+static void blitXYXY_Raw_xRGB8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to BGR888
+ */
+static void blitXYXY_Raw_xRGB8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB555
+ */
+static void blitXYXY_Raw_xRGB8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB565
+ */
+static void blitXYXY_Raw_xRGB8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB666
+ */
+static void blitXYXY_Raw_xRGB8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGB332
+ */
+static void blitXYXY_Raw_xRGB8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to CMYK8888
+ */
+static void blitXYXY_Raw_xRGB8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G1
+ */
+static void blitXYXY_Raw_xRGB8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G2
+ */
+static void blitXYXY_Raw_xRGB8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G4
+ */
+static void blitXYXY_Raw_xRGB8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G8
+ */
+static void blitXYXY_Raw_xRGB8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to GA88
+ */
+static void blitXYXY_Raw_xRGB8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to G16
+ */
+static void blitXYXY_Raw_xRGB8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits xRGB8888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_xRGB8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to xRGB8888
+ */
+static void blitXYXY_Raw_RGBA8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_xRGB8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB888
+ */
+static void blitXYXY_Raw_RGBA8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGB888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to BGR888
+ */
+static void blitXYXY_Raw_RGBA8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_BGR888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB555
+ */
+static void blitXYXY_Raw_RGBA8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGB555(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB565
+ */
+static void blitXYXY_Raw_RGBA8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGB565(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB666
+ */
+static void blitXYXY_Raw_RGBA8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGB666(p1, p2);
+			}
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGB332
+ */
+static void blitXYXY_Raw_RGBA8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGB332(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_CMYK8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G1
+ */
+static void blitXYXY_Raw_RGBA8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G1(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_G1(p1, p2);
+			}
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G2
+ */
+static void blitXYXY_Raw_RGBA8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G2(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_G2(p1, p2);
+			}
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G4
+ */
+static void blitXYXY_Raw_RGBA8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G4(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_G4(p1, p2);
+			}
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G8
+ */
+static void blitXYXY_Raw_RGBA8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G8(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_G8(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to GA88
+ */
+static void blitXYXY_Raw_RGBA8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_GA88(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to G16
+ */
+static void blitXYXY_Raw_RGBA8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G16(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_G16(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGBA8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_RGBA8888_PM(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to BGR888
+ */
+static void blitXYXY_Raw_RGB888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB555
+ */
+static void blitXYXY_Raw_RGB888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB565
+ */
+static void blitXYXY_Raw_RGB888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB666
+ */
+static void blitXYXY_Raw_RGB888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGB332
+ */
+static void blitXYXY_Raw_RGB888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G1
+ */
+static void blitXYXY_Raw_RGB888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G2
+ */
+static void blitXYXY_Raw_RGB888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G4
+ */
+static void blitXYXY_Raw_RGB888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G8
+ */
+static void blitXYXY_Raw_RGB888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to GA88
+ */
+static void blitXYXY_Raw_RGB888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to G16
+ */
+static void blitXYXY_Raw_RGB888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to xRGB8888
+ */
+static void blitXYXY_Raw_BGR888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGBA8888
+ */
+static void blitXYXY_Raw_BGR888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB888
+ */
+static void blitXYXY_Raw_BGR888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB555
+ */
+static void blitXYXY_Raw_BGR888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB565
+ */
+static void blitXYXY_Raw_BGR888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB666
+ */
+static void blitXYXY_Raw_BGR888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGB332
+ */
+static void blitXYXY_Raw_BGR888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to CMYK8888
+ */
+static void blitXYXY_Raw_BGR888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G1
+ */
+static void blitXYXY_Raw_BGR888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G2
+ */
+static void blitXYXY_Raw_BGR888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G4
+ */
+static void blitXYXY_Raw_BGR888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G8
+ */
+static void blitXYXY_Raw_BGR888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to GA88
+ */
+static void blitXYXY_Raw_BGR888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to G16
+ */
+static void blitXYXY_Raw_BGR888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits BGR888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_BGR888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_24BPP(src, x, y);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB555_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB555_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB888
+ */
+static void blitXYXY_Raw_RGB555_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to BGR888
+ */
+static void blitXYXY_Raw_RGB555_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB565
+ */
+static void blitXYXY_Raw_RGB555_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB666
+ */
+static void blitXYXY_Raw_RGB555_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGB332
+ */
+static void blitXYXY_Raw_RGB555_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB555_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G1
+ */
+static void blitXYXY_Raw_RGB555_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G2
+ */
+static void blitXYXY_Raw_RGB555_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G4
+ */
+static void blitXYXY_Raw_RGB555_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G8
+ */
+static void blitXYXY_Raw_RGB555_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to GA88
+ */
+static void blitXYXY_Raw_RGB555_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to G16
+ */
+static void blitXYXY_Raw_RGB555_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB555 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB555_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB565_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB565_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB888
+ */
+static void blitXYXY_Raw_RGB565_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to BGR888
+ */
+static void blitXYXY_Raw_RGB565_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB555
+ */
+static void blitXYXY_Raw_RGB565_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB666
+ */
+static void blitXYXY_Raw_RGB565_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGB332
+ */
+static void blitXYXY_Raw_RGB565_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB565_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G1
+ */
+static void blitXYXY_Raw_RGB565_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G2
+ */
+static void blitXYXY_Raw_RGB565_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G4
+ */
+static void blitXYXY_Raw_RGB565_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G8
+ */
+static void blitXYXY_Raw_RGB565_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to GA88
+ */
+static void blitXYXY_Raw_RGB565_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to G16
+ */
+static void blitXYXY_Raw_RGB565_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB565 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB565_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB666_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB666_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB888
+ */
+static void blitXYXY_Raw_RGB666_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to BGR888
+ */
+static void blitXYXY_Raw_RGB666_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB555
+ */
+static void blitXYXY_Raw_RGB666_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB565
+ */
+static void blitXYXY_Raw_RGB666_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGB332
+ */
+static void blitXYXY_Raw_RGB666_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB666_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G1
+ */
+static void blitXYXY_Raw_RGB666_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G2
+ */
+static void blitXYXY_Raw_RGB666_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G4
+ */
+static void blitXYXY_Raw_RGB666_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G8
+ */
+static void blitXYXY_Raw_RGB666_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to GA88
+ */
+static void blitXYXY_Raw_RGB666_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to G16
+ */
+static void blitXYXY_Raw_RGB666_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB666 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB666_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to xRGB8888
+ */
+static void blitXYXY_Raw_RGB332_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGBA8888
+ */
+static void blitXYXY_Raw_RGB332_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB888
+ */
+static void blitXYXY_Raw_RGB332_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to BGR888
+ */
+static void blitXYXY_Raw_RGB332_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB555
+ */
+static void blitXYXY_Raw_RGB332_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB565
+ */
+static void blitXYXY_Raw_RGB332_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGB666
+ */
+static void blitXYXY_Raw_RGB332_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to CMYK8888
+ */
+static void blitXYXY_Raw_RGB332_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G1
+ */
+static void blitXYXY_Raw_RGB332_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G2
+ */
+static void blitXYXY_Raw_RGB332_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G4
+ */
+static void blitXYXY_Raw_RGB332_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G8
+ */
+static void blitXYXY_Raw_RGB332_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to GA88
+ */
+static void blitXYXY_Raw_RGB332_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to G16
+ */
+static void blitXYXY_Raw_RGB332_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGB332 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_RGB332_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to xRGB8888
+ */
+static void blitXYXY_Raw_CMYK8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB888
+ */
+static void blitXYXY_Raw_CMYK8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to BGR888
+ */
+static void blitXYXY_Raw_CMYK8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB555
+ */
+static void blitXYXY_Raw_CMYK8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB565
+ */
+static void blitXYXY_Raw_CMYK8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB666
+ */
+static void blitXYXY_Raw_CMYK8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGB332
+ */
+static void blitXYXY_Raw_CMYK8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G1
+ */
+static void blitXYXY_Raw_CMYK8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G2
+ */
+static void blitXYXY_Raw_CMYK8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G4
+ */
+static void blitXYXY_Raw_CMYK8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G8
+ */
+static void blitXYXY_Raw_CMYK8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to GA88
+ */
+static void blitXYXY_Raw_CMYK8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to G16
+ */
+static void blitXYXY_Raw_CMYK8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_CMYK8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to xRGB8888
+ */
+static void blitXYXY_Raw_G1_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGBA8888
+ */
+static void blitXYXY_Raw_G1_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB888
+ */
+static void blitXYXY_Raw_G1_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to BGR888
+ */
+static void blitXYXY_Raw_G1_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB555
+ */
+static void blitXYXY_Raw_G1_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB565
+ */
+static void blitXYXY_Raw_G1_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB666
+ */
+static void blitXYXY_Raw_G1_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGB332
+ */
+static void blitXYXY_Raw_G1_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to CMYK8888
+ */
+static void blitXYXY_Raw_G1_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G2
+ */
+static void blitXYXY_Raw_G1_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G4
+ */
+static void blitXYXY_Raw_G1_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G8
+ */
+static void blitXYXY_Raw_G1_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to GA88
+ */
+static void blitXYXY_Raw_G1_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to G16
+ */
+static void blitXYXY_Raw_G1_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G1 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G1_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to xRGB8888
+ */
+static void blitXYXY_Raw_G2_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGBA8888
+ */
+static void blitXYXY_Raw_G2_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB888
+ */
+static void blitXYXY_Raw_G2_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to BGR888
+ */
+static void blitXYXY_Raw_G2_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB555
+ */
+static void blitXYXY_Raw_G2_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB565
+ */
+static void blitXYXY_Raw_G2_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB666
+ */
+static void blitXYXY_Raw_G2_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGB332
+ */
+static void blitXYXY_Raw_G2_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to CMYK8888
+ */
+static void blitXYXY_Raw_G2_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G1
+ */
+static void blitXYXY_Raw_G2_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G4
+ */
+static void blitXYXY_Raw_G2_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G8
+ */
+static void blitXYXY_Raw_G2_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to GA88
+ */
+static void blitXYXY_Raw_G2_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to G16
+ */
+static void blitXYXY_Raw_G2_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G2 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G2_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to xRGB8888
+ */
+static void blitXYXY_Raw_G4_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGBA8888
+ */
+static void blitXYXY_Raw_G4_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB888
+ */
+static void blitXYXY_Raw_G4_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to BGR888
+ */
+static void blitXYXY_Raw_G4_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB555
+ */
+static void blitXYXY_Raw_G4_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB565
+ */
+static void blitXYXY_Raw_G4_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB666
+ */
+static void blitXYXY_Raw_G4_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGB332
+ */
+static void blitXYXY_Raw_G4_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to CMYK8888
+ */
+static void blitXYXY_Raw_G4_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G1
+ */
+static void blitXYXY_Raw_G4_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G2
+ */
+static void blitXYXY_Raw_G4_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G8
+ */
+static void blitXYXY_Raw_G4_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to GA88
+ */
+static void blitXYXY_Raw_G4_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to G16
+ */
+static void blitXYXY_Raw_G4_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G4 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G4_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to xRGB8888
+ */
+static void blitXYXY_Raw_G8_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGBA8888
+ */
+static void blitXYXY_Raw_G8_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB888
+ */
+static void blitXYXY_Raw_G8_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to BGR888
+ */
+static void blitXYXY_Raw_G8_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB555
+ */
+static void blitXYXY_Raw_G8_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB565
+ */
+static void blitXYXY_Raw_G8_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB666
+ */
+static void blitXYXY_Raw_G8_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGB332
+ */
+static void blitXYXY_Raw_G8_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to CMYK8888
+ */
+static void blitXYXY_Raw_G8_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G1
+ */
+static void blitXYXY_Raw_G8_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G2
+ */
+static void blitXYXY_Raw_G8_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G4
+ */
+static void blitXYXY_Raw_G8_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to GA88
+ */
+static void blitXYXY_Raw_G8_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to G16
+ */
+static void blitXYXY_Raw_G8_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G8 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G8_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_8BPP(src, x, y);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to xRGB8888
+ */
+static void blitXYXY_Raw_GA88_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_xRGB8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA8888
+ */
+static void blitXYXY_Raw_GA88_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGBA8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB888
+ */
+static void blitXYXY_Raw_GA88_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGB888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to BGR888
+ */
+static void blitXYXY_Raw_GA88_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_BGR888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB555
+ */
+static void blitXYXY_Raw_GA88_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGB555(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB565
+ */
+static void blitXYXY_Raw_GA88_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGB565(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB666
+ */
+static void blitXYXY_Raw_GA88_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGB666(p1, p2);
+			}
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGB332
+ */
+static void blitXYXY_Raw_GA88_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGB332(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to CMYK8888
+ */
+static void blitXYXY_Raw_GA88_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_CMYK8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G1
+ */
+static void blitXYXY_Raw_GA88_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G1(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_G1(p1, p2);
+			}
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G2
+ */
+static void blitXYXY_Raw_GA88_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G2(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_G2(p1, p2);
+			}
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G4
+ */
+static void blitXYXY_Raw_GA88_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G4(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_G4(p1, p2);
+			}
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G8
+ */
+static void blitXYXY_Raw_GA88_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G8(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_G8(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to G16
+ */
+static void blitXYXY_Raw_GA88_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G16(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_G16(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits GA88 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_GA88_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_GA88(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!alpha)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_GA88_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_GA88_RGBA8888_PM(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to xRGB8888
+ */
+static void blitXYXY_Raw_G16_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA8888
+ */
+static void blitXYXY_Raw_G16_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB888
+ */
+static void blitXYXY_Raw_G16_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to BGR888
+ */
+static void blitXYXY_Raw_G16_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB555
+ */
+static void blitXYXY_Raw_G16_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB565
+ */
+static void blitXYXY_Raw_G16_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB666
+ */
+static void blitXYXY_Raw_G16_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGB332
+ */
+static void blitXYXY_Raw_G16_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to CMYK8888
+ */
+static void blitXYXY_Raw_G16_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G1
+ */
+static void blitXYXY_Raw_G16_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p3);
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G2
+ */
+static void blitXYXY_Raw_G16_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p3);
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G4
+ */
+static void blitXYXY_Raw_G16_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p3);
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to G8
+ */
+static void blitXYXY_Raw_G16_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p3);
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to GA88
+ */
+static void blitXYXY_Raw_G16_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits G16 to RGBA8888_PM
+ */
+static void blitXYXY_Raw_G16_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_16BPP(src, x, y);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p3);
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to xRGB8888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_xRGB8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_xRGB8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGBA8888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGBA8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGBA8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGB888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to BGR888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_BGR888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_24BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_BGR888(p1, p2);
+			}
+			gp_putpixel_raw_24BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB555
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB555(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGB555(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB565
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB565(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGB565(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB666
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB666(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_18BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGB666(p1, p2);
+			}
+			gp_putpixel_raw_18BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB332
+ */
+static void blitXYXY_Raw_RGBA8888_PM_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_RGB332(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_RGB332(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to CMYK8888
+ */
+static void blitXYXY_Raw_RGBA8888_PM_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_CMYK8888(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_32BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_CMYK8888(p1, p2);
+			}
+			gp_putpixel_raw_32BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G1
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G1(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_1BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_G1(p1, p2);
+			}
+			gp_putpixel_raw_1BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G2
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G2(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_2BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_G2(p1, p2);
+			}
+			gp_putpixel_raw_2BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G4
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G4(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_4BPP_LE(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_G4(p1, p2);
+			}
+			gp_putpixel_raw_4BPP_LE(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G8
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G8(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_8BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_G8(p1, p2);
+			}
+			gp_putpixel_raw_8BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to GA88
+ */
+static void blitXYXY_Raw_RGBA8888_PM_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_GA88(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_GA88(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+/*
+ * Blits RGBA8888_PM to G16
+ */
+static void blitXYXY_Raw_RGBA8888_PM_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, dx, dy;
+
+	for (y = y0; y <= y1; y++) {
+		for (x = x0; x <= x1; x++) {
+			dx = x2 + (x - x0);
+			dy = y2 + (y - y0);
+
+			gp_pixel p1, p2 = 0, p3 = 0;
+
+			p1 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel alpha = GP_PIXEL_GET_A_RGBA8888_PM(p1);
+
+			/* Transparent pixels do not change destination */
+			if (!p1)
+				continue;
+
+			if (alpha == 0xff) {
+				GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_G16(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_16BPP(dst, dx, dy);
+				p3 = gp_mix_pixels_RGBA8888_PM_G16(p1, p2);
+			}
+			gp_putpixel_raw_16BPP(dst, dx, dy, p3);
+		}
+	}
+}
+
+
+static void blit_xyxy_raw_rows(gp_blit_row_fn convert_row, const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		convert_row(GP_PIXEL_ADDR(src, x0, y0 + y),
+		            GP_PIXEL_ADDR(dst, x2, y2 + y), x1 - x0 + 1);
+	}
+}
+
+void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
+                           gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                           gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_blit_row_fn convert_row;
+
+	/* Same pixel type, could be (mostly) optimized to memcpy() */
+	if (src->pixel_type == dst->pixel_type) {
+		GP_FN_PER_BPP(blitXYXY_Raw, src->bpp, src->bit_endian,
+		              src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	/* Optimized row converters for common pixel type pairs */
+	convert_row = gp_blit_row_convert(src->pixel_type, dst->pixel_type);
+
+	if (convert_row) {
+		blit_xyxy_raw_rows(convert_row, src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	/* Specialized functions */
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_xRGB8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_xRGB8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_xRGB8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_xRGB8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_xRGB8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_xRGB8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_xRGB8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_xRGB8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_xRGB8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_xRGB8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_xRGB8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_xRGB8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_xRGB8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_xRGB8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_xRGB8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGBA8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGBA8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGBA8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGBA8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGBA8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGBA8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGBA8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGBA8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGBA8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGBA8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGBA8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGBA8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGBA8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGBA8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGBA8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGB888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGB888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGB888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGB888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_BGR888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_BGR888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_BGR888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_BGR888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_BGR888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_BGR888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_BGR888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_BGR888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_BGR888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_BGR888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_BGR888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_BGR888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_BGR888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_BGR888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_BGR888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB555_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB555_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB555_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB555_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB555_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB555_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB555_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB555_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGB555_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGB555_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGB555_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB555_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB555_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB555_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGB555_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB565_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB565_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB565_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB565_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB565_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB565_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB565_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB565_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGB565_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGB565_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGB565_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB565_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB565_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB565_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGB565_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB666:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB666_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB666_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB666_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB666_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB666_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB666_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGB666_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB666_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGB666_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGB666_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGB666_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB666_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB666_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB666_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGB666_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGB332_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGB332_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGB332_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGB332_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGB332_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGB332_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGB332_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGB332_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGB332_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGB332_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGB332_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGB332_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGB332_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGB332_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_RGB332_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_CMYK8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_CMYK8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_CMYK8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_CMYK8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_CMYK8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_CMYK8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_CMYK8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_CMYK8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_CMYK8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_CMYK8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_CMYK8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_CMYK8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_CMYK8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_CMYK8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_CMYK8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_CMYK8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G1_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G1_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G1_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G1_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G1_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G1_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G1_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G1_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G1_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_G1_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_G1_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G1_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G1_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G1_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_G1_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G2_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G2_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G2_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G2_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G2_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G2_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G2_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G2_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G2_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_G2_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_G2_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G2_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G2_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G2_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_G2_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G4_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G4_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G4_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G4_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G4_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G4_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G4_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G4_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G4_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_G4_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_G4_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G4_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G4_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G4_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_G4_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G8_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G8_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G8_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G8_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G8_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G8_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G8_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G8_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G8_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_G8_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_G8_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_G8_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G8_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_G8_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_G8_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_GA88_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_GA88_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_GA88_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_GA88_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_GA88_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_GA88_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_GA88_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_GA88_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_GA88_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_GA88_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_GA88_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_GA88_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_GA88_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_GA88_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_GA88_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G16:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_G16_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_G16_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_G16_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_G16_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_G16_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_G16_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_G16_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_G16_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_G16_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_G16_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_G16_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_G16_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_G16_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_G16_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_Raw_G16_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_Raw_RGBA8888_PM_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_Raw_RGBA8888_PM_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_Raw_RGBA8888_PM_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_Raw_RGBA8888_PM_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_Raw_RGBA8888_PM_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_Raw_RGBA8888_PM_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_Raw_RGBA8888_PM_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_Raw_RGBA8888_PM_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_Raw_RGBA8888_PM_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_Raw_RGBA8888_PM_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_Raw_RGBA8888_PM_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_Raw_RGBA8888_PM_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_Raw_RGBA8888_PM_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_Raw_RGBA8888_PM_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_Raw_RGBA8888_PM_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	default:
+		GP_ABORT("Invalid source pixel %s",
+		         gp_pixel_type_name(src->pixel_type));
+	}
+}
+
+/*
+ * And the same for non-raw variants.
+ */
+/*
+ * Blits xRGB8888 to RGBA8888
+ */
+static void blitXYXY_xRGB8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB888
+ */
+static void blitXYXY_xRGB8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to BGR888
+ */
+static void blitXYXY_xRGB8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB555
+ */
+static void blitXYXY_xRGB8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB565
+ */
+static void blitXYXY_xRGB8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB666
+ */
+static void blitXYXY_xRGB8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGB332
+ */
+static void blitXYXY_xRGB8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to CMYK8888
+ */
+static void blitXYXY_xRGB8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G1
+ */
+static void blitXYXY_xRGB8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G2
+ */
+static void blitXYXY_xRGB8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G4
+ */
+static void blitXYXY_xRGB8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G8
+ */
+static void blitXYXY_xRGB8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to GA88
+ */
+static void blitXYXY_xRGB8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to G16
+ */
+static void blitXYXY_xRGB8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits xRGB8888 to RGBA8888_PM
+ */
+static void blitXYXY_xRGB8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_xRGB8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to xRGB8888
+ */
+static void blitXYXY_RGBA8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB888
+ */
+static void blitXYXY_RGBA8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to BGR888
+ */
+static void blitXYXY_RGBA8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB555
+ */
+static void blitXYXY_RGBA8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB565
+ */
+static void blitXYXY_RGBA8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB666
+ */
+static void blitXYXY_RGBA8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGB332
+ */
+static void blitXYXY_RGBA8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to CMYK8888
+ */
+static void blitXYXY_RGBA8888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G1
+ */
+static void blitXYXY_RGBA8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G2
+ */
+static void blitXYXY_RGBA8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G4
+ */
+static void blitXYXY_RGBA8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G8
+ */
+static void blitXYXY_RGBA8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to GA88
+ */
+static void blitXYXY_RGBA8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to G16
+ */
+static void blitXYXY_RGBA8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888 to RGBA8888_PM
+ */
+static void blitXYXY_RGBA8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to xRGB8888
+ */
+static void blitXYXY_RGB888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGBA8888
+ */
+static void blitXYXY_RGB888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to BGR888
+ */
+static void blitXYXY_RGB888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB555
+ */
+static void blitXYXY_RGB888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB565
+ */
+static void blitXYXY_RGB888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB666
+ */
+static void blitXYXY_RGB888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGB332
+ */
+static void blitXYXY_RGB888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to CMYK8888
+ */
+static void blitXYXY_RGB888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G1
+ */
+static void blitXYXY_RGB888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G2
+ */
+static void blitXYXY_RGB888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G4
+ */
+static void blitXYXY_RGB888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G8
+ */
+static void blitXYXY_RGB888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to GA88
+ */
+static void blitXYXY_RGB888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to G16
+ */
+static void blitXYXY_RGB888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB888 to RGBA8888_PM
+ */
+static void blitXYXY_RGB888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_RGB888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to xRGB8888
+ */
+static void blitXYXY_BGR888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGBA8888
+ */
+static void blitXYXY_BGR888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB888
+ */
+static void blitXYXY_BGR888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB555
+ */
+static void blitXYXY_BGR888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB565
+ */
+static void blitXYXY_BGR888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB666
+ */
+static void blitXYXY_BGR888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGB332
+ */
+static void blitXYXY_BGR888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to CMYK8888
+ */
+static void blitXYXY_BGR888_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G1
+ */
+static void blitXYXY_BGR888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G2
+ */
+static void blitXYXY_BGR888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G4
+ */
+static void blitXYXY_BGR888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G8
+ */
+static void blitXYXY_BGR888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to GA88
+ */
+static void blitXYXY_BGR888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to G16
+ */
+static void blitXYXY_BGR888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits BGR888 to RGBA8888_PM
+ */
+static void blitXYXY_BGR888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_24BPP(src, xt, yt);
+			GP_PIXEL_BGR888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to xRGB8888
+ */
+static void blitXYXY_RGB555_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGBA8888
+ */
+static void blitXYXY_RGB555_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB888
+ */
+static void blitXYXY_RGB555_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to BGR888
+ */
+static void blitXYXY_RGB555_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB565
+ */
+static void blitXYXY_RGB555_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB666
+ */
+static void blitXYXY_RGB555_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGB332
+ */
+static void blitXYXY_RGB555_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to CMYK8888
+ */
+static void blitXYXY_RGB555_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G1
+ */
+static void blitXYXY_RGB555_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G2
+ */
+static void blitXYXY_RGB555_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G4
+ */
+static void blitXYXY_RGB555_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G8
+ */
+static void blitXYXY_RGB555_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to GA88
+ */
+static void blitXYXY_RGB555_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to G16
+ */
+static void blitXYXY_RGB555_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB555 to RGBA8888_PM
+ */
+static void blitXYXY_RGB555_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB555_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to xRGB8888
+ */
+static void blitXYXY_RGB565_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGBA8888
+ */
+static void blitXYXY_RGB565_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB888
+ */
+static void blitXYXY_RGB565_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to BGR888
+ */
+static void blitXYXY_RGB565_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB555
+ */
+static void blitXYXY_RGB565_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB666
+ */
+static void blitXYXY_RGB565_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGB332
+ */
+static void blitXYXY_RGB565_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to CMYK8888
+ */
+static void blitXYXY_RGB565_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G1
+ */
+static void blitXYXY_RGB565_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G2
+ */
+static void blitXYXY_RGB565_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G4
+ */
+static void blitXYXY_RGB565_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G8
+ */
+static void blitXYXY_RGB565_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to GA88
+ */
+static void blitXYXY_RGB565_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to G16
+ */
+static void blitXYXY_RGB565_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB565 to RGBA8888_PM
+ */
+static void blitXYXY_RGB565_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_RGB565_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to xRGB8888
+ */
+static void blitXYXY_RGB666_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGBA8888
+ */
+static void blitXYXY_RGB666_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB888
+ */
+static void blitXYXY_RGB666_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to BGR888
+ */
+static void blitXYXY_RGB666_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB555
+ */
+static void blitXYXY_RGB666_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB565
+ */
+static void blitXYXY_RGB666_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGB332
+ */
+static void blitXYXY_RGB666_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to CMYK8888
+ */
+static void blitXYXY_RGB666_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G1
+ */
+static void blitXYXY_RGB666_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G2
+ */
+static void blitXYXY_RGB666_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G4
+ */
+static void blitXYXY_RGB666_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G8
+ */
+static void blitXYXY_RGB666_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to GA88
+ */
+static void blitXYXY_RGB666_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to G16
+ */
+static void blitXYXY_RGB666_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB666 to RGBA8888_PM
+ */
+static void blitXYXY_RGB666_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			GP_PIXEL_RGB666_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to xRGB8888
+ */
+static void blitXYXY_RGB332_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGBA8888
+ */
+static void blitXYXY_RGB332_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB888
+ */
+static void blitXYXY_RGB332_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to BGR888
+ */
+static void blitXYXY_RGB332_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB555
+ */
+static void blitXYXY_RGB332_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB565
+ */
+static void blitXYXY_RGB332_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGB666
+ */
+static void blitXYXY_RGB332_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to CMYK8888
+ */
+static void blitXYXY_RGB332_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G1
+ */
+static void blitXYXY_RGB332_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G2
+ */
+static void blitXYXY_RGB332_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G4
+ */
+static void blitXYXY_RGB332_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G8
+ */
+static void blitXYXY_RGB332_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to GA88
+ */
+static void blitXYXY_RGB332_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to G16
+ */
+static void blitXYXY_RGB332_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGB332 to RGBA8888_PM
+ */
+static void blitXYXY_RGB332_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_RGB332_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to xRGB8888
+ */
+static void blitXYXY_CMYK8888_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888
+ */
+static void blitXYXY_CMYK8888_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB888
+ */
+static void blitXYXY_CMYK8888_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to BGR888
+ */
+static void blitXYXY_CMYK8888_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB555
+ */
+static void blitXYXY_CMYK8888_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB565
+ */
+static void blitXYXY_CMYK8888_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB666
+ */
+static void blitXYXY_CMYK8888_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGB332
+ */
+static void blitXYXY_CMYK8888_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G1
+ */
+static void blitXYXY_CMYK8888_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G2
+ */
+static void blitXYXY_CMYK8888_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G4
+ */
+static void blitXYXY_CMYK8888_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G8
+ */
+static void blitXYXY_CMYK8888_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to GA88
+ */
+static void blitXYXY_CMYK8888_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to G16
+ */
+static void blitXYXY_CMYK8888_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits CMYK8888 to RGBA8888_PM
+ */
+static void blitXYXY_CMYK8888_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_CMYK8888_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to xRGB8888
+ */
+static void blitXYXY_G1_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGBA8888
+ */
+static void blitXYXY_G1_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGB888
+ */
+static void blitXYXY_G1_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to BGR888
+ */
+static void blitXYXY_G1_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGB555
+ */
+static void blitXYXY_G1_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGB565
+ */
+static void blitXYXY_G1_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGB666
+ */
+static void blitXYXY_G1_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGB332
+ */
+static void blitXYXY_G1_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to CMYK8888
+ */
+static void blitXYXY_G1_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to G2
+ */
+static void blitXYXY_G1_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to G4
+ */
+static void blitXYXY_G1_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to G8
+ */
+static void blitXYXY_G1_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to GA88
+ */
+static void blitXYXY_G1_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to G16
+ */
+static void blitXYXY_G1_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G1 to RGBA8888_PM
+ */
+static void blitXYXY_G1_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			GP_PIXEL_G1_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to xRGB8888
+ */
+static void blitXYXY_G2_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGBA8888
+ */
+static void blitXYXY_G2_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGB888
+ */
+static void blitXYXY_G2_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to BGR888
+ */
+static void blitXYXY_G2_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGB555
+ */
+static void blitXYXY_G2_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGB565
+ */
+static void blitXYXY_G2_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGB666
+ */
+static void blitXYXY_G2_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGB332
+ */
+static void blitXYXY_G2_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to CMYK8888
+ */
+static void blitXYXY_G2_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to G1
+ */
+static void blitXYXY_G2_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to G4
+ */
+static void blitXYXY_G2_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to G8
+ */
+static void blitXYXY_G2_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to GA88
+ */
+static void blitXYXY_G2_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to G16
+ */
+static void blitXYXY_G2_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G2 to RGBA8888_PM
+ */
+static void blitXYXY_G2_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			GP_PIXEL_G2_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to xRGB8888
+ */
+static void blitXYXY_G4_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGBA8888
+ */
+static void blitXYXY_G4_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGB888
+ */
+static void blitXYXY_G4_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to BGR888
+ */
+static void blitXYXY_G4_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGB555
+ */
+static void blitXYXY_G4_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGB565
+ */
+static void blitXYXY_G4_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGB666
+ */
+static void blitXYXY_G4_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGB332
+ */
+static void blitXYXY_G4_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to CMYK8888
+ */
+static void blitXYXY_G4_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to G1
+ */
+static void blitXYXY_G4_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to G2
+ */
+static void blitXYXY_G4_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to G8
+ */
+static void blitXYXY_G4_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to GA88
+ */
+static void blitXYXY_G4_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to G16
+ */
+static void blitXYXY_G4_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G4 to RGBA8888_PM
+ */
+static void blitXYXY_G4_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			GP_PIXEL_G4_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to xRGB8888
+ */
+static void blitXYXY_G8_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGBA8888
+ */
+static void blitXYXY_G8_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB888
+ */
+static void blitXYXY_G8_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to BGR888
+ */
+static void blitXYXY_G8_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB555
+ */
+static void blitXYXY_G8_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB565
+ */
+static void blitXYXY_G8_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB666
+ */
+static void blitXYXY_G8_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGB332
+ */
+static void blitXYXY_G8_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to CMYK8888
+ */
+static void blitXYXY_G8_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G1
+ */
+static void blitXYXY_G8_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G2
+ */
+static void blitXYXY_G8_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G4
+ */
+static void blitXYXY_G8_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to GA88
+ */
+static void blitXYXY_G8_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to G16
+ */
+static void blitXYXY_G8_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G8 to RGBA8888_PM
+ */
+static void blitXYXY_G8_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_8BPP(src, xt, yt);
+			GP_PIXEL_G8_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to xRGB8888
+ */
+static void blitXYXY_GA88_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGBA8888
+ */
+static void blitXYXY_GA88_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB888
+ */
+static void blitXYXY_GA88_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to BGR888
+ */
+static void blitXYXY_GA88_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB555
+ */
+static void blitXYXY_GA88_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB565
+ */
+static void blitXYXY_GA88_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB666
+ */
+static void blitXYXY_GA88_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGB332
+ */
+static void blitXYXY_GA88_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to CMYK8888
+ */
+static void blitXYXY_GA88_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G1
+ */
+static void blitXYXY_GA88_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G2
+ */
+static void blitXYXY_GA88_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G4
+ */
+static void blitXYXY_GA88_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G8
+ */
+static void blitXYXY_GA88_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to G16
+ */
+static void blitXYXY_GA88_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits GA88 to RGBA8888_PM
+ */
+static void blitXYXY_GA88_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_GA88_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to xRGB8888
+ */
+static void blitXYXY_G16_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGBA8888
+ */
+static void blitXYXY_G16_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB888
+ */
+static void blitXYXY_G16_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to BGR888
+ */
+static void blitXYXY_G16_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB555
+ */
+static void blitXYXY_G16_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB565
+ */
+static void blitXYXY_G16_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB666
+ */
+static void blitXYXY_G16_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGB332
+ */
+static void blitXYXY_G16_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to CMYK8888
+ */
+static void blitXYXY_G16_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G1
+ */
+static void blitXYXY_G16_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G2
+ */
+static void blitXYXY_G16_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G4
+ */
+static void blitXYXY_G16_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to G8
+ */
+static void blitXYXY_G16_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to GA88
+ */
+static void blitXYXY_G16_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits G16 to RGBA8888_PM
+ */
+static void blitXYXY_G16_RGBA8888_PM(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_16BPP(src, xt, yt);
+			GP_PIXEL_G16_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888_PM(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to xRGB8888
+ */
+static void blitXYXY_RGBA8888_PM_xRGB8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_xRGB8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGBA8888
+ */
+static void blitXYXY_RGBA8888_PM_RGBA8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGBA8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB888
+ */
+static void blitXYXY_RGBA8888_PM_RGB888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to BGR888
+ */
+static void blitXYXY_RGBA8888_PM_BGR888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_BGR888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB555
+ */
+static void blitXYXY_RGBA8888_PM_RGB555(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB555(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB565
+ */
+static void blitXYXY_RGBA8888_PM_RGB565(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB565(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB666
+ */
+static void blitXYXY_RGBA8888_PM_RGB666(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB666(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to RGB332
+ */
+static void blitXYXY_RGBA8888_PM_RGB332(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_RGB332(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to CMYK8888
+ */
+static void blitXYXY_RGBA8888_PM_CMYK8888(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_CMYK8888(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to G1
+ */
+static void blitXYXY_RGBA8888_PM_G1(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G1(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to G2
+ */
+static void blitXYXY_RGBA8888_PM_G2(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G2(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to G4
+ */
+static void blitXYXY_RGBA8888_PM_G4(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G4(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to G8
+ */
+static void blitXYXY_RGBA8888_PM_G8(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G8(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to GA88
+ */
+static void blitXYXY_RGBA8888_PM_GA88(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_GA88(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+/*
+ * Blits RGBA8888_PM to G16
+ */
+static void blitXYXY_RGBA8888_PM_G16(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p1, p2 = 0;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p1 = gp_getpixel_raw_32BPP(src, xt, yt);
+			GP_PIXEL_RGBA8888_PM_TO_RGB888(p1, p2);
+			GP_PIXEL_RGB888_TO_G16(p2, p1);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p1);
+		}
+}
+
+
+/*
+ * Same pixel type but with rotation.
+ */
+/*
+ * Blits for same pixel type and bpp 1BPP_LE
+ */
+static void blitXYXY_1BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_1BPP_LE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_LE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 1BPP_BE
+ */
+static void blitXYXY_1BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_1BPP_BE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_1BPP_BE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 2BPP_LE
+ */
+static void blitXYXY_2BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_2BPP_LE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_LE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 2BPP_BE
+ */
+static void blitXYXY_2BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_2BPP_BE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_2BPP_BE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 4BPP_LE
+ */
+static void blitXYXY_4BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_4BPP_LE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_LE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 4BPP_BE
+ */
+static void blitXYXY_4BPP_BE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_4BPP_BE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_4BPP_BE(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 8BPP
+ */
+static void blitXYXY_8BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_8BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_8BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 16BPP
+ */
+static void blitXYXY_16BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_16BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_16BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 24BPP
+ */
+static void blitXYXY_24BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_24BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_24BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 32BPP
+ */
+static void blitXYXY_32BPP(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_32BPP(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_32BPP(dst, xt, yt, p);
+		}
+}
+/*
+ * Blits for same pixel type and bpp 18BPP_LE
+ */
+static void blitXYXY_18BPP_LE(const gp_pixmap *src,
+	gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+	gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord x, y, xt, yt;
+
+	for (y = y0; y <= y1; y++)
+		for (x = x0; x <= x1; x++) {
+			gp_pixel p;
+			xt = x; yt = y;
+			GP_TRANSFORM_POINT(src, xt, yt);
+			p = gp_getpixel_raw_18BPP_LE(src, xt, yt);
+			xt = x2 + (x - x0);
+			yt = y2 + (y - y0);
+			GP_TRANSFORM_POINT(dst, xt, yt);
+			gp_putpixel_raw_18BPP_LE(dst, xt, yt, p);
+		}
+}
+
+void gp_blit_xyxy_fast(const gp_pixmap *src,
+                       gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                       gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	GP_DEBUG(2, "Blitting %s -> %s",
+	         gp_pixel_type_name(src->pixel_type),
+	         gp_pixel_type_name(dst->pixel_type));
+
+	/* Same pixel type */
+	if (src->pixel_type == dst->pixel_type) {
+		GP_FN_PER_BPP(blitXYXY, src->bpp, src->bit_endian,
+		              src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	if (gp_pixmap_rotation_equal(src, dst)) {
+		gp_blit_xyxy_raw_fast(src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
+	/* Specialized functions */
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_xRGB8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_xRGB8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_xRGB8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_xRGB8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_xRGB8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_xRGB8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_xRGB8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_xRGB8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_xRGB8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_xRGB8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_xRGB8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_xRGB8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_xRGB8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_xRGB8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_xRGB8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGBA8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGBA8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGBA8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGBA8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGBA8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGBA8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGBA8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGBA8888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGBA8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGBA8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGBA8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGBA8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGBA8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGBA8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGBA8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGB888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGB888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGB888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGB888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_BGR888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_BGR888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_BGR888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_BGR888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_BGR888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_BGR888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_BGR888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_BGR888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_BGR888_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_BGR888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_BGR888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_BGR888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_BGR888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_BGR888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_BGR888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_BGR888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB555:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB555_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB555_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB555_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB555_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB555_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB555_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB555_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB555_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGB555_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGB555_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGB555_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB555_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB555_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB555_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGB555_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB565:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB565_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB565_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB565_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB565_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB565_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB565_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB565_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB565_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGB565_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGB565_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGB565_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB565_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB565_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB565_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGB565_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB666:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB666_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB666_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB666_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB666_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB666_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB666_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGB666_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB666_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGB666_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGB666_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGB666_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB666_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB666_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB666_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGB666_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGB332:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGB332_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGB332_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGB332_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGB332_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGB332_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGB332_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGB332_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGB332_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGB332_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGB332_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGB332_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGB332_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGB332_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGB332_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_RGB332_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_CMYK8888:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_CMYK8888_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_CMYK8888_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_CMYK8888_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_CMYK8888_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_CMYK8888_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_CMYK8888_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_CMYK8888_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_CMYK8888_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_CMYK8888_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_CMYK8888_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_CMYK8888_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_CMYK8888_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_CMYK8888_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_CMYK8888_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_CMYK8888_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G1:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G1_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G1_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G1_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G1_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G1_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G1_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G1_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G1_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G1_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_G1_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_G1_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G1_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G1_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G1_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_G1_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G2:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G2_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G2_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G2_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G2_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G2_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G2_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G2_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G2_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G2_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_G2_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_G2_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G2_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G2_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G2_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_G2_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G4:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G4_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G4_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G4_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G4_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G4_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G4_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G4_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G4_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G4_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_G4_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_G4_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G4_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G4_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G4_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_G4_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G8:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G8_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G8_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G8_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G8_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G8_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G8_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G8_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G8_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G8_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_G8_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_G8_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_G8_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G8_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_G8_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_G8_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_GA88:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_GA88_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_GA88_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_GA88_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_GA88_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_GA88_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_GA88_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_GA88_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_GA88_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_GA88_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_GA88_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_GA88_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_GA88_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_GA88_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_GA88_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_GA88_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_G16:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_G16_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_G16_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_G16_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_G16_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_G16_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_G16_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_G16_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_G16_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_G16_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_G16_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_G16_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_G16_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_G16_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_G16_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888_PM:
+			blitXYXY_G16_RGBA8888_PM(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		switch (dst->pixel_type) {
+		case GP_PIXEL_xRGB8888:
+			blitXYXY_RGBA8888_PM_xRGB8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGBA8888:
+			blitXYXY_RGBA8888_PM_RGBA8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB888:
+			blitXYXY_RGBA8888_PM_RGB888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_BGR888:
+			blitXYXY_RGBA8888_PM_BGR888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB555:
+			blitXYXY_RGBA8888_PM_RGB555(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB565:
+			blitXYXY_RGBA8888_PM_RGB565(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB666:
+			blitXYXY_RGBA8888_PM_RGB666(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_RGB332:
+			blitXYXY_RGBA8888_PM_RGB332(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_CMYK8888:
+			blitXYXY_RGBA8888_PM_CMYK8888(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G1:
+			blitXYXY_RGBA8888_PM_G1(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G2:
+			blitXYXY_RGBA8888_PM_G2(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G4:
+			blitXYXY_RGBA8888_PM_G4(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G8:
+			blitXYXY_RGBA8888_PM_G8(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_GA88:
+			blitXYXY_RGBA8888_PM_GA88(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		case GP_PIXEL_G16:
+			blitXYXY_RGBA8888_PM_G16(src, x0, y0, x1, y1, dst, x2, y2);
+		break;
+		default:
+			GP_ABORT("Invalid destination pixel %s",
+			         gp_pixel_type_name(dst->pixel_type));
+		}
+	break;
+	default:
+		GP_ABORT("Invalid source pixel %s",
+		         gp_pixel_type_name(src->pixel_type));
+	}
+}
@@ -8,6 +8,7 @@
 
 #include <string.h>
 
+#include <core/gp_byte_order.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_put_pixel.h>
 #include "core/gp_pixmap.h"
@@ -18,8 +19,10 @@
 #include <core/gp_convert_scale.gen.h>
 #include <core/gp_mix_pixels2.gen.h>
 
+#include "gp_blit_rows.h"
+
 /*
- * TODO: this is used for same pixel but different offset, could still be optimized
+ * Used for pixel sizes that are not handled by the specialized code below.
  */
 static void blit_xyxy_naive_raw(const gp_pixmap *src,
                                 gp_coord x0, gp_coord y0,
@@ -41,6 +44,152 @@ static void blit_xyxy_naive_raw(const gp_pixmap *src,
 	}
 }
 
+/*
+ * Bit-aligned row copy for 1, 2 and 4 bpp.
+ *
+ * The row is treated as a string of bits in pixel order, for LE the first
+ * pixel is in the least significant bits of a byte, for BE in the most
+ * significant bits. The soff and doff are bit offsets in the first byte.
+ *
+ * The destination head and tail are merged with the existing bits and the
+ * rest is written in 64 bit words, each assembled from two source words
+ * shifted by the difference in alignment.
+ */
+static inline uint64_t load_le64(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER == __BIG_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static inline void store_le64(uint8_t *p, uint64_t v)
+{
+#if __BYTE_ORDER == __BIG_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	memcpy(p, &v, sizeof(v));
+}
+
+static inline uint64_t load_be64(const uint8_t *p)
+{
+	uint64_t v;
+
+	memcpy(&v, p, sizeof(v));
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	return v;
+}
+
+static inline void store_be64(uint8_t *p, uint64_t v)
+{
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+	v = __builtin_bswap64(v);
+#endif
+	memcpy(p, &v, sizeof(v));
+}
+
+/* Returns n <= 8 bits starting at soff */
+static inline unsigned int get_bits_LE(const uint8_t *src, unsigned int soff,
+                                       unsigned int n)
+{
+	unsigned int v = src[0] >> soff;
+
+	if (soff + n > 8)
+		v |= src[1] << (8 - soff);
+
+	return v & ((1u << n) - 1);
+}
+
+static inline unsigned int get_bits_BE(const uint8_t *src, unsigned int soff,
+                                       unsigned int n)
+{
+	unsigned int v = src[0] << 8;
+
+	if (soff + n > 8)
+		v |= src[1];
+
+	return (v >> (16 - soff - n)) & ((1u << n) - 1);
+}
+
+/* Writes n bits into a byte at doff, n + doff <= 8 */
+static inline void merge_bits_LE(uint8_t *dst, unsigned int doff,
+                                 unsigned int v, unsigned int n)
+{
+	unsigned int mask = ((1u << n) - 1) << doff;
+
+	*dst = (*dst & ~mask) | ((v << doff) & mask);
+}
+
+static inline void merge_bits_BE(uint8_t *dst, unsigned int doff,
+                                 unsigned int v, unsigned int n)
+{
+	unsigned int shift = 8 - doff - n;
+	unsigned int mask = ((1u << n) - 1) << shift;
+
+	*dst = (*dst & ~mask) | ((v << shift) & mask);
+}
+
+@ for be in ['LE', 'BE']:
+static void copy_bits_{{ be }}(uint8_t *dst, unsigned int doff,
+                          const uint8_t *src, unsigned int soff, size_t nbits)
+{
+	unsigned int n;
+
+	/* Fill the first destination byte */
+	if (doff) {
+		n = GP_MIN(8 - doff, nbits);
+
+		merge_bits_{{ be }}(dst, doff, get_bits_{{ be }}(src, soff, n), n);
+
+		dst++;
+		src += (soff + n) / 8;
+		soff = (soff + n) % 8;
+		nbits -= n;
+	}
+
+	/* Destination is byte aligned now */
+	if (!soff) {
+		memcpy(dst, src, nbits / 8);
+		dst += nbits / 8;
+		src += nbits / 8;
+		nbits %= 8;
+	} else {
+		for (; nbits >= 64; nbits -= 64) {
+@     if be == 'LE':
+			uint64_t w = load_le64(src) >> soff |
+			             (uint64_t)src[8] << (64 - soff);
+
+			store_le64(dst, w);
+@     else:
+			uint64_t w = load_be64(src) << soff |
+			             src[8] >> (8 - soff);
+
+			store_be64(dst, w);
+@     end
+			src += 8;
+			dst += 8;
+		}
+
+		for (; nbits >= 8; nbits -= 8) {
+@     if be == 'LE':
+			*dst++ = src[0] >> soff | src[1] << (8 - soff);
+@     else:
+			*dst++ = src[0] << soff | src[1] >> (8 - soff);
+@     end
+			src++;
+		}
+	}
+
+	if (nbits)
+		merge_bits_{{ be }}(dst, 0, get_bits_{{ be }}(src, soff, nbits), nbits);
+}
+
+@ end
 @ for ps in pixelsizes:
 /*
  * Blit for equal pixel types {{ ps.suffix }}
@@ -57,42 +206,22 @@ static void blitXYXY_Raw_{{ ps.suffix }}(const gp_pixmap *src,
 		memcpy(GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2 + y),
 		       GP_PIXEL_ADDR_{{ ps.suffix }}(src, x0, y0 + y),
 		       {{ int(ps.size/8) }} * (x1 - x0 + 1));
+@     elif ps.size < 8:
+	/* Rows may be bit-aligned differently, shift and merge them */
+	unsigned int src_bit = src->offset + x0 * {{ ps.size }};
+	unsigned int dst_bit = dst->offset + x2 * {{ ps.size }};
+	size_t nbits = (size_t)(x1 - x0 + 1) * {{ ps.size }};
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		const uint8_t *s = src->pixels + (y0 + y) * src->bytes_per_row;
+		uint8_t *d = dst->pixels + (y2 + y) * dst->bytes_per_row;
+
+		copy_bits_{{ ps.bit_endian }}(d + dst_bit / 8, dst_bit % 8,
+		                         s + src_bit / 8, src_bit % 8, nbits);
+	}
 @     else:
-# if 0
-	/* Rectangles may not be bit-aligned in the same way! */
-	/* Alignment (index) of first bits in the first byte */
-	//TODO: This is wrong for subpixmaps where the offset
-	//      needs to be summed with pixmap->offset and moduled
-	int al1 = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x0);
-	int al2 = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x2);
-	/* Special case of the same alignment and width >=2 bytes */
-	if ((al1 == al2) && ((x1 - x0 + 1) * {{ ps.size }} >= 16)) {
-		/* Number of bits in the last partial byte */
-		int end_al = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x1);
-		GP_ASSERT(({{ ps.size }} * (x1 - x0 + 1) - al1 - end_al) % 8 == 0);
-		int copy_size = ({{ ps.size }} * (x1 - x0 + 1) - al1 - end_al) / 8;
-		/* First and last byte incident to the line */
-		uint8_t *p1 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(src, x1, y1);
-		uint8_t *p2 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2);
-		uint8_t *end_p1 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(src, x1, y0);
-		uint8_t *end_p2 = (uint8_t *) GP_PIXEL_ADDR_{{ ps.suffix }}(dst, x2, y2);
-
-		gp_coord i;
-
-		for (i = 0; i < (y1 - y0 + 1); i++) {
-			if (al1 != 0)
-				GP_SET_BITS(al1, 8-al1, *p2, GP_GET_BITS(al1, 8-al1, *p1));
-			memcpy(p2+(al1!=0), p1+(al1!=0), copy_size);
-			if (end_al != 0)
-				GP_SET_BITS(0, end_al, *end_p2, GP_GET_BITS(0, end_al, *end_p1));
-			p1 += src->bytes_per_row;
-			end_p1 += src->bytes_per_row;
-			p2 += dst->bytes_per_row;
-			end_p2 += dst->bytes_per_row;
-		}
-	} else /* Different bit-alignment, can't use memcpy() */
-#endif
-		blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
+	blit_xyxy_naive_raw(src, x0, y0, x1, y1, dst, x2, y2);
 @     end
 }
 
@@ -124,8 +253,24 @@ static void blitXYXY_Raw_{{ src.name }}_{{ dst.name }}(const gp_pixmap *src,
 
 			p1 = gp_getpixel_raw_{{ src.pixelsize.suffix }}(src, x, y);
 @                     if src.is_alpha():
-			p2 = gp_getpixel_raw_{{ dst.pixelsize.suffix }}(dst, dx, dy);
-			p3 = gp_mix_pixels_{{ src.name }}_{{ dst.name }}(p1, p2);
+@                         a_max = src.chans['A'].C_max
+			gp_pixel alpha = GP_PIXEL_GET_A_{{ src.name }}(p1);
+
+			/* Transparent pixels do not change destination */
+@                         if src.is_premultiplied():
+			if (!p1)
+@                         else:
+			if (!alpha)
+@                         end
+				continue;
+
+			if (alpha == {{ a_max }}) {
+				GP_PIXEL_{{ src.name }}_TO_RGB888(p1, p2);
+				GP_PIXEL_RGB888_TO_{{ dst.name }}(p2, p3);
+			} else {
+				p2 = gp_getpixel_raw_{{ dst.pixelsize.suffix }}(dst, dx, dy);
+				p3 = gp_mix_pixels_{{ src.name }}_{{ dst.name }}(p1, p2);
+			}
 @                     else:
 			GP_PIXEL_{{ src.name }}_TO_RGB888(p1, p2);
 			GP_PIXEL_RGB888_TO_{{ dst.name }}(p2, p3);
@@ -137,10 +282,24 @@ static void blitXYXY_Raw_{{ src.name }}_{{ dst.name }}(const gp_pixmap *src,
 
 @ end
 
+static void blit_xyxy_raw_rows(gp_blit_row_fn convert_row, const gp_pixmap *src,
+                               gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                               gp_pixmap *dst, gp_coord x2, gp_coord y2)
+{
+	gp_coord y;
+
+	for (y = 0; y <= (y1 - y0); y++) {
+		convert_row(GP_PIXEL_ADDR(src, x0, y0 + y),
+		            GP_PIXEL_ADDR(dst, x2, y2 + y), x1 - x0 + 1);
+	}
+}
+
 void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
                            gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
                            gp_pixmap *dst, gp_coord x2, gp_coord y2)
 {
+	gp_blit_row_fn convert_row;
+
 	/* Same pixel type, could be (mostly) optimized to memcpy() */
 	if (src->pixel_type == dst->pixel_type) {
 		GP_FN_PER_BPP(blitXYXY_Raw, src->bpp, src->bit_endian,
@@ -148,6 +307,14 @@ void gp_blit_xyxy_raw_fast(const gp_pixmap *src,
 		return;
 	}
 
+	/* Optimized row converters for common pixel type pairs */
+	convert_row = gp_blit_row_convert(src->pixel_type, dst->pixel_type);
+
+	if (convert_row) {
+		blit_xyxy_raw_rows(convert_row, src, x0, y0, x1, y1, dst, x2, y2);
+		return;
+	}
+
 	/* Specialized functions */
 	switch (src->pixel_type) {
 @ for src in pixeltypes:
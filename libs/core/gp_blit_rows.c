@@ -0,0 +1,563 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Row converters for the most common blit pixel type pairs.
+
+  These are used for blits between pixmaps with the same rotation, where whole
+  rows can be converted at once, and produce exactly the same pixels as the
+  generic conversion via RGB888.
+
+  Sources with an alpha channel are blended over the destination row. Fully
+  transparent pixels are skipped and fully opaque pixels are just converted,
+  the SIMD variants check that for a whole vector at once.
+
+  All the converters assume little endian pixel layout, which is always the
+  case on x86. That includes the scalar variants, which assemble the 32 bit
+  pixel values from the individual channel bytes as well.
+
+ */
+
+#include <stdint.h>
+
+#include <core/gp_pixel.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+#ifdef GP_CPU_X86
+# include <immintrin.h>
+#endif
+
+#include "gp_blit_rows.h"
+
+/*
+ * RGB888 is stored as B, G, R bytes, BGR888 as R, G, B bytes.
+ */
+static void RGB888_to_xRGB8888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	uint32_t *d = (uint32_t *)dst;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++, src += 3)
+		d[i] = src[0] | src[1]<<8 | src[2]<<16;
+}
+
+static void BGR888_to_xRGB8888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	uint32_t *d = (uint32_t *)dst;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++, src += 3)
+		d[i] = src[2] | src[1]<<8 | src[0]<<16;
+}
+
+static void xRGB8888_to_RGB565_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	uint16_t *d = (uint16_t *)dst;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++) {
+		uint32_t p = s[i];
+
+		d[i] = ((p >> 8) & 0xf800) | ((p >> 5) & 0x07e0) | ((p >> 3) & 0x001f);
+	}
+}
+
+/*
+ * Blends RGBA8888 or RGBA8888_PM over R, G, B channels.
+ *
+ * The division by 255 is exact, (t + 1 + (t >> 8)) >> 8 == t / 255 holds for
+ * 0 <= t < 65535 which is what the SIMD variants rely on.
+ */
+static inline unsigned int div255(unsigned int t)
+{
+	return (t + 1 + (t >> 8)) >> 8;
+}
+
+static inline unsigned int over(unsigned int s, unsigned int d, unsigned int a)
+{
+	return div255(s * a + d * (255 - a) + 127);
+}
+
+static inline unsigned int over_pm(unsigned int s, unsigned int d, unsigned int a)
+{
+	unsigned int r = s + div255(d * (255 - a) + 127);
+
+	return r > 255 ? 255 : r;
+}
+
+static void RGBA8888_over_xRGB8888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	uint32_t *d = (uint32_t *)dst;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++) {
+		uint32_t p = s[i];
+		unsigned int a = p & 0xff;
+
+		if (!a)
+			continue;
+
+		if (a == 0xff) {
+			d[i] = p >> 8;
+			continue;
+		}
+
+		d[i] = over(p >> 24, (d[i] >> 16) & 0xff, a) << 16 |
+		       over((p >> 16) & 0xff, (d[i] >> 8) & 0xff, a) << 8 |
+		       over((p >> 8) & 0xff, d[i] & 0xff, a);
+	}
+}
+
+static void RGBA8888_PM_over_xRGB8888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	uint32_t *d = (uint32_t *)dst;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++) {
+		uint32_t p = s[i];
+		unsigned int a = p & 0xff;
+
+		if (!p)
+			continue;
+
+		if (a == 0xff) {
+			d[i] = p >> 8;
+			continue;
+		}
+
+		d[i] = over_pm(p >> 24, (d[i] >> 16) & 0xff, a) << 16 |
+		       over_pm((p >> 16) & 0xff, (d[i] >> 8) & 0xff, a) << 8 |
+		       over_pm((p >> 8) & 0xff, d[i] & 0xff, a);
+	}
+}
+
+static void RGBA8888_over_RGB888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++, dst += 3) {
+		uint32_t p = s[i];
+		unsigned int a = p & 0xff;
+
+		if (!a)
+			continue;
+
+		dst[0] = over((p >> 8) & 0xff, dst[0], a);
+		dst[1] = over((p >> 16) & 0xff, dst[1], a);
+		dst[2] = over(p >> 24, dst[2], a);
+	}
+}
+
+static void RGBA8888_PM_over_RGB888_c(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	const uint32_t *s = (const uint32_t *)src;
+	gp_size i;
+
+	for (i = 0; i < cnt; i++, dst += 3) {
+		uint32_t p = s[i];
+		unsigned int a = p & 0xff;
+
+		if (!p)
+			continue;
+
+		dst[0] = over_pm((p >> 8) & 0xff, dst[0], a);
+		dst[1] = over_pm((p >> 16) & 0xff, dst[1], a);
+		dst[2] = over_pm(p >> 24, dst[2], a);
+	}
+}
+
+#ifdef GP_CPU_X86
+
+#define Z 0x80
+
+static const uint8_t RGB888_to_xRGB8888_shuf[16] = {
+	0, 1, 2, Z, 3, 4, 5, Z, 6, 7, 8, Z, 9, 10, 11, Z
+};
+
+static const uint8_t BGR888_to_xRGB8888_shuf[16] = {
+	2, 1, 0, Z, 5, 4, 3, Z, 8, 7, 6, Z, 11, 10, 9, Z
+};
+
+/*
+ * RGBA8888 is stored as A, B, G, R bytes, we blend it over xRGB8888 stored as
+ * B, G, R, x bytes.
+ *
+ * The x byte is blended with zero color and full alpha, unless the pixel is
+ * transparent, so that the result matches the generic code, which clears the
+ * x bits of changed pixels and keeps transparent pixels untouched.
+ */
+static const uint8_t RGBA8888_over_xRGB8888_col[16] = {
+	1, 2, 3, Z, 5, 6, 7, Z, 9, 10, 11, Z, 13, 14, 15, Z
+};
+
+static const uint8_t RGBA8888_over_xRGB8888_alpha[16] = {
+	0, 0, 0, Z, 4, 4, 4, Z, 8, 8, 8, Z, 12, 12, 12, Z
+};
+
+#undef Z
+
+/*
+ * Expands four 24bit pixels from each 16 bytes load, the last four bytes
+ * are not used so we stop while there are at least 16 bytes to read.
+ */
+__attribute__((target("sse4.1")))
+static gp_size x24_to_x32_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt,
+                                const uint8_t *shuf)
+{
+	__m128i mask = _mm_loadu_si128((const __m128i*)shuf);
+	gp_size i;
+
+	for (i = 0; i + 6 <= cnt; i += 4) {
+		__m128i v = _mm_loadu_si128((const __m128i*)(src + 3 * i));
+
+		_mm_storeu_si128((__m128i*)(dst + 4 * i), _mm_shuffle_epi8(v, mask));
+	}
+
+	return i;
+}
+
+__attribute__((target("avx2")))
+static gp_size x24_to_x32_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt,
+                               const uint8_t *shuf)
+{
+	__m256i mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)shuf));
+	gp_size i;
+
+	for (i = 0; i + 10 <= cnt; i += 8) {
+		const uint8_t *s = src + 3 * i;
+		__m256i v = _mm256_inserti128_si256(
+			_mm256_castsi128_si256(_mm_loadu_si128((const __m128i*)s)),
+			_mm_loadu_si128((const __m128i*)(s + 12)), 1);
+
+		_mm256_storeu_si256((__m256i*)(dst + 4 * i), _mm256_shuffle_epi8(v, mask));
+	}
+
+	return i;
+}
+
+__attribute__((target("sse4.1")))
+static void RGB888_to_xRGB8888_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i = x24_to_x32_sse41(src, dst, cnt, RGB888_to_xRGB8888_shuf);
+
+	RGB888_to_xRGB8888_c(src + 3 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("avx2")))
+static void RGB888_to_xRGB8888_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i = x24_to_x32_avx2(src, dst, cnt, RGB888_to_xRGB8888_shuf);
+
+	RGB888_to_xRGB8888_c(src + 3 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("sse4.1")))
+static void BGR888_to_xRGB8888_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i = x24_to_x32_sse41(src, dst, cnt, BGR888_to_xRGB8888_shuf);
+
+	BGR888_to_xRGB8888_c(src + 3 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("avx2")))
+static void BGR888_to_xRGB8888_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i = x24_to_x32_avx2(src, dst, cnt, BGR888_to_xRGB8888_shuf);
+
+	BGR888_to_xRGB8888_c(src + 3 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("sse4.1")))
+static inline __m128i x32_to_565_sse41(__m128i v)
+{
+	__m128i r = _mm_and_si128(_mm_srli_epi32(v, 8), _mm_set1_epi32(0xf800));
+	__m128i g = _mm_and_si128(_mm_srli_epi32(v, 5), _mm_set1_epi32(0x07e0));
+	__m128i b = _mm_and_si128(_mm_srli_epi32(v, 3), _mm_set1_epi32(0x001f));
+
+	return _mm_or_si128(_mm_or_si128(r, g), b);
+}
+
+__attribute__((target("sse4.1")))
+static void xRGB8888_to_RGB565_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i;
+
+	for (i = 0; i + 8 <= cnt; i += 8) {
+		__m128i v0 = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+		__m128i v1 = _mm_loadu_si128((const __m128i*)(src + 4 * i + 16));
+		__m128i res = _mm_packus_epi32(x32_to_565_sse41(v0), x32_to_565_sse41(v1));
+
+		_mm_storeu_si128((__m128i*)(dst + 2 * i), res);
+	}
+
+	xRGB8888_to_RGB565_c(src + 4 * i, dst + 2 * i, cnt - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i x32_to_565_avx2(__m256i v)
+{
+	__m256i r = _mm256_and_si256(_mm256_srli_epi32(v, 8), _mm256_set1_epi32(0xf800));
+	__m256i g = _mm256_and_si256(_mm256_srli_epi32(v, 5), _mm256_set1_epi32(0x07e0));
+	__m256i b = _mm256_and_si256(_mm256_srli_epi32(v, 3), _mm256_set1_epi32(0x001f));
+
+	return _mm256_or_si256(_mm256_or_si256(r, g), b);
+}
+
+__attribute__((target("avx2")))
+static void xRGB8888_to_RGB565_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	gp_size i;
+
+	for (i = 0; i + 16 <= cnt; i += 16) {
+		__m256i v0 = _mm256_loadu_si256((const __m256i*)(src + 4 * i));
+		__m256i v1 = _mm256_loadu_si256((const __m256i*)(src + 4 * i + 32));
+		/* The pack works in 128 bit lanes, fix the order afterwards */
+		__m256i res = _mm256_packus_epi32(x32_to_565_avx2(v0), x32_to_565_avx2(v1));
+
+		res = _mm256_permute4x64_epi64(res, _MM_SHUFFLE(3, 1, 2, 0));
+
+		_mm256_storeu_si256((__m256i*)(dst + 2 * i), res);
+	}
+
+	xRGB8888_to_RGB565_c(src + 4 * i, dst + 2 * i, cnt - i);
+}
+
+/*
+ * Blends four pixels, c and d are colors and a alpha in 16 bit lanes.
+ */
+__attribute__((target("sse4.1")))
+static inline __m128i over_sse41(__m128i c, __m128i d, __m128i a, int pm)
+{
+	__m128i t, ia = _mm_sub_epi16(_mm_set1_epi16(255), a);
+
+	if (pm)
+		t = _mm_mullo_epi16(d, ia);
+	else
+		t = _mm_add_epi16(_mm_mullo_epi16(c, a), _mm_mullo_epi16(d, ia));
+
+	t = _mm_add_epi16(t, _mm_set1_epi16(127));
+	t = _mm_srli_epi16(_mm_add_epi16(_mm_add_epi16(t, _mm_set1_epi16(1)),
+	                                 _mm_srli_epi16(t, 8)), 8);
+
+	return pm ? _mm_add_epi16(t, c) : t;
+}
+
+__attribute__((target("sse4.1")))
+static inline void over_x32_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt, int pm)
+{
+	__m128i col_shuf = _mm_loadu_si128((const __m128i*)RGBA8888_over_xRGB8888_col);
+	__m128i a_shuf = _mm_loadu_si128((const __m128i*)RGBA8888_over_xRGB8888_alpha);
+	__m128i a_mask = _mm_set1_epi32(0xff);
+	__m128i x_mask = _mm_set1_epi32(0xff000000);
+	gp_size i;
+
+	for (i = 0; i + 4 <= cnt; i += 4) {
+		__m128i s = _mm_loadu_si128((const __m128i*)(src + 4 * i));
+		__m128i transp = _mm_cmpeq_epi32(pm ? s : _mm_and_si128(s, a_mask),
+		                                 _mm_setzero_si128());
+		__m128i c, a, d, lo, hi;
+
+		if (_mm_movemask_epi8(transp) == 0xffff)
+			continue;
+
+		c = _mm_shuffle_epi8(s, col_shuf);
+
+		if (_mm_testc_si128(s, a_mask)) {
+			_mm_storeu_si128((__m128i*)(dst + 4 * i), c);
+			continue;
+		}
+
+		a = _mm_or_si128(_mm_shuffle_epi8(s, a_shuf), _mm_andnot_si128(transp, x_mask));
+		d = _mm_loadu_si128((const __m128i*)(dst + 4 * i));
+
+		lo = over_sse41(_mm_cvtepu8_epi16(c), _mm_cvtepu8_epi16(d),
+		                _mm_cvtepu8_epi16(a), pm);
+		hi = over_sse41(_mm_unpackhi_epi8(c, _mm_setzero_si128()),
+		                _mm_unpackhi_epi8(d, _mm_setzero_si128()),
+		                _mm_unpackhi_epi8(a, _mm_setzero_si128()), pm);
+
+		_mm_storeu_si128((__m128i*)(dst + 4 * i), _mm_packus_epi16(lo, hi));
+	}
+
+	if (pm)
+		RGBA8888_PM_over_xRGB8888_c(src + 4 * i, dst + 4 * i, cnt - i);
+	else
+		RGBA8888_over_xRGB8888_c(src + 4 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("avx2")))
+static inline __m256i over_avx2(__m256i c, __m256i d, __m256i a, int pm)
+{
+	__m256i t, ia = _mm256_sub_epi16(_mm256_set1_epi16(255), a);
+
+	if (pm)
+		t = _mm256_mullo_epi16(d, ia);
+	else
+		t = _mm256_add_epi16(_mm256_mullo_epi16(c, a), _mm256_mullo_epi16(d, ia));
+
+	t = _mm256_add_epi16(t, _mm256_set1_epi16(127));
+	t = _mm256_srli_epi16(_mm256_add_epi16(_mm256_add_epi16(t, _mm256_set1_epi16(1)),
+	                                       _mm256_srli_epi16(t, 8)), 8);
+
+	return pm ? _mm256_add_epi16(t, c) : t;
+}
+
+__attribute__((target("avx2")))
+static inline void over_x32_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt, int pm)
+{
+	__m256i col_shuf = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((const __m128i*)RGBA8888_over_xRGB8888_col));
+	__m256i a_shuf = _mm256_broadcastsi128_si256(
+		_mm_loadu_si128((const __m128i*)RGBA8888_over_xRGB8888_alpha));
+	__m256i a_mask = _mm256_set1_epi32(0xff);
+	__m256i x_mask = _mm256_set1_epi32(0xff000000);
+	__m256i zero = _mm256_setzero_si256();
+	gp_size i;
+
+	for (i = 0; i + 8 <= cnt; i += 8) {
+		__m256i s = _mm256_loadu_si256((const __m256i*)(src + 4 * i));
+		__m256i transp = _mm256_cmpeq_epi32(pm ? s : _mm256_and_si256(s, a_mask), zero);
+		__m256i c, a, d, res;
+
+		if (_mm256_movemask_epi8(transp) == -1)
+			continue;
+
+		c = _mm256_shuffle_epi8(s, col_shuf);
+
+		if (_mm256_testc_si256(s, a_mask)) {
+			_mm256_storeu_si256((__m256i*)(dst + 4 * i), c);
+			continue;
+		}
+
+		a = _mm256_or_si256(_mm256_shuffle_epi8(s, a_shuf), _mm256_andnot_si256(transp, x_mask));
+		d = _mm256_loadu_si256((const __m256i*)(dst + 4 * i));
+
+		/* The unpack works in 128 bit lanes, so does the pack below */
+		res = _mm256_packus_epi16(
+			over_avx2(_mm256_unpacklo_epi8(c, zero), _mm256_unpacklo_epi8(d, zero),
+			          _mm256_unpacklo_epi8(a, zero), pm),
+			over_avx2(_mm256_unpackhi_epi8(c, zero), _mm256_unpackhi_epi8(d, zero),
+			          _mm256_unpackhi_epi8(a, zero), pm));
+
+		_mm256_storeu_si256((__m256i*)(dst + 4 * i), res);
+	}
+
+	if (pm)
+		RGBA8888_PM_over_xRGB8888_c(src + 4 * i, dst + 4 * i, cnt - i);
+	else
+		RGBA8888_over_xRGB8888_c(src + 4 * i, dst + 4 * i, cnt - i);
+}
+
+__attribute__((target("sse4.1")))
+static void RGBA8888_over_xRGB8888_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	over_x32_sse41(src, dst, cnt, 0);
+}
+
+__attribute__((target("sse4.1")))
+static void RGBA8888_PM_over_xRGB8888_sse41(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	over_x32_sse41(src, dst, cnt, 1);
+}
+
+__attribute__((target("avx2")))
+static void RGBA8888_over_xRGB8888_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	over_x32_avx2(src, dst, cnt, 0);
+}
+
+__attribute__((target("avx2")))
+static void RGBA8888_PM_over_xRGB8888_avx2(const uint8_t *src, uint8_t *dst, gp_size cnt)
+{
+	over_x32_avx2(src, dst, cnt, 1);
+}
+
+#endif /* GP_CPU_X86 */
+
+static const gp_cpu_impl RGB888_to_xRGB8888_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, RGB888_to_xRGB8888_avx2},
+	{GP_CPU_SSE41, RGB888_to_xRGB8888_sse41},
+#endif
+	{0, RGB888_to_xRGB8888_c},
+};
+
+static const gp_cpu_impl BGR888_to_xRGB8888_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, BGR888_to_xRGB8888_avx2},
+	{GP_CPU_SSE41, BGR888_to_xRGB8888_sse41},
+#endif
+	{0, BGR888_to_xRGB8888_c},
+};
+
+static const gp_cpu_impl xRGB8888_to_RGB565_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, xRGB8888_to_RGB565_avx2},
+	{GP_CPU_SSE41, xRGB8888_to_RGB565_sse41},
+#endif
+	{0, xRGB8888_to_RGB565_c},
+};
+
+static const gp_cpu_impl RGBA8888_over_xRGB8888_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, RGBA8888_over_xRGB8888_avx2},
+	{GP_CPU_SSE41, RGBA8888_over_xRGB8888_sse41},
+#endif
+	{0, RGBA8888_over_xRGB8888_c},
+};
+
+static const gp_cpu_impl RGBA8888_PM_over_xRGB8888_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, RGBA8888_PM_over_xRGB8888_avx2},
+	{GP_CPU_SSE41, RGBA8888_PM_over_xRGB8888_sse41},
+#endif
+	{0, RGBA8888_PM_over_xRGB8888_c},
+};
+
+GP_CPU_DISPATCH(RGB888_to_xRGB8888, gp_blit_row_fn, RGB888_to_xRGB8888_impls);
+GP_CPU_DISPATCH(BGR888_to_xRGB8888, gp_blit_row_fn, BGR888_to_xRGB8888_impls);
+GP_CPU_DISPATCH(xRGB8888_to_RGB565, gp_blit_row_fn, xRGB8888_to_RGB565_impls);
+GP_CPU_DISPATCH(RGBA8888_over_xRGB8888, gp_blit_row_fn, RGBA8888_over_xRGB8888_impls);
+GP_CPU_DISPATCH(RGBA8888_PM_over_xRGB8888, gp_blit_row_fn, RGBA8888_PM_over_xRGB8888_impls);
+
+gp_blit_row_fn gp_blit_row_convert(gp_pixel_type src, gp_pixel_type dst)
+{
+	switch (src) {
+	case GP_PIXEL_RGB888:
+		if (dst == GP_PIXEL_xRGB8888)
+			return RGB888_to_xRGB8888();
+	break;
+	case GP_PIXEL_BGR888:
+		if (dst == GP_PIXEL_xRGB8888)
+			return BGR888_to_xRGB8888();
+	break;
+	case GP_PIXEL_xRGB8888:
+		if (dst == GP_PIXEL_RGB565)
+			return xRGB8888_to_RGB565();
+	break;
+	case GP_PIXEL_RGBA8888:
+		if (dst == GP_PIXEL_xRGB8888)
+			return RGBA8888_over_xRGB8888();
+		if (dst == GP_PIXEL_RGB888)
+			return RGBA8888_over_RGB888_c;
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		if (dst == GP_PIXEL_xRGB8888)
+			return RGBA8888_PM_over_xRGB8888();
+		if (dst == GP_PIXEL_RGB888)
+			return RGBA8888_PM_over_RGB888_c;
+	break;
+	default:
+	break;
+	}
+
+	return NULL;
+}
@@ -0,0 +1,31 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Row converters for the most common blit pixel type pairs.
+
+   Library internal, the functions are not exported.
+
+  */
+
+#ifndef CORE_GP_BLIT_ROWS_H
+#define CORE_GP_BLIT_ROWS_H
+
+#include <stdint.h>
+#include <core/gp_pixel.h>
+
+/*
+ * Converts or blends cnt pixels from the src row into the dst row.
+ */
+typedef void (*gp_blit_row_fn)(const uint8_t *src, uint8_t *dst, gp_size cnt);
+
+/*
+ * Returns the row converter for the pixel type pair or NULL if there is none.
+ */
+gp_blit_row_fn gp_blit_row_convert(gp_pixel_type src, gp_pixel_type dst)
+	__attribute__ ((visibility ("hidden")));
+
+#endif /* CORE_GP_BLIT_ROWS_H */
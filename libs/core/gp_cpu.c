@@ -0,0 +1,144 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+#if defined(__arm__) && defined(__linux__)
+# include <sys/auxv.h>
+# include <asm/hwcap.h>
+#endif
+
+#include <core/gp_common.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+static unsigned int cpu_flags;
+static pthread_once_t cpu_once = PTHREAD_ONCE_INIT;
+
+static const struct {
+	enum gp_cpu_flags flag;
+	const char *name;
+} flag_names[] = {
+	{GP_CPU_SSE2, "sse2"},
+	{GP_CPU_SSE41, "sse4.1"},
+	{GP_CPU_AVX2, "avx2"},
+	{GP_CPU_NEON, "neon"},
+};
+
+const char *gp_cpu_flag_name(enum gp_cpu_flags flag)
+{
+	unsigned int i;
+
+	for (i = 0; i < GP_ARRAY_SIZE(flag_names); i++) {
+		if (flag_names[i].flag == flag)
+			return flag_names[i].name;
+	}
+
+	return "unknown";
+}
+
+static unsigned int detect_flags(void)
+{
+	unsigned int flags = 0;
+
+#ifdef GP_CPU_X86
+	__builtin_cpu_init();
+
+	if (__builtin_cpu_supports("sse2"))
+		flags |= GP_CPU_SSE2;
+
+	if (__builtin_cpu_supports("sse4.1"))
+		flags |= GP_CPU_SSE41;
+
+	if (__builtin_cpu_supports("avx2"))
+		flags |= GP_CPU_AVX2;
+#endif
+
+#if defined(__aarch64__)
+	flags |= GP_CPU_NEON;
+#elif defined(__arm__) && defined(__linux__) && defined(HWCAP_NEON)
+	if (getauxval(AT_HWCAP) & HWCAP_NEON)
+		flags |= GP_CPU_NEON;
+#endif
+
+	return flags;
+}
+
+/*
+ * Parses comma separated list of flags, none (or 0) disables all of them.
+ */
+static unsigned int parse_flags(const char *str)
+{
+	unsigned int i, flags = 0;
+	size_t len;
+
+	while (*str) {
+		len = strcspn(str, ",");
+
+		if (len == 4 && !strncmp(str, "none", 4))
+			return 0;
+
+		if (len == 1 && str[0] == '0')
+			return 0;
+
+		for (i = 0; i < GP_ARRAY_SIZE(flag_names); i++) {
+			if (strlen(flag_names[i].name) == len &&
+			    !strncmp(flag_names[i].name, str, len))
+				break;
+		}
+
+		if (i < GP_ARRAY_SIZE(flag_names))
+			flags |= flag_names[i].flag;
+		else
+			GP_WARN("Invalid GP_SIMD flag '%.*s'", (int)len, str);
+
+		str += len;
+
+		if (*str)
+			str++;
+	}
+
+	return flags;
+}
+
+static void cpu_init(void)
+{
+	const char *env = getenv("GP_SIMD");
+	unsigned int i;
+
+	cpu_flags = detect_flags();
+
+	if (env) {
+		cpu_flags &= parse_flags(env);
+		GP_DEBUG(1, "Using GP_SIMD=%s from enviroment variable", env);
+	}
+
+	for (i = 0; i < GP_ARRAY_SIZE(flag_names); i++) {
+		if (cpu_flags & flag_names[i].flag)
+			GP_DEBUG(1, "Using CPU feature %s", flag_names[i].name);
+	}
+}
+
+unsigned int gp_cpu_flags(void)
+{
+	pthread_once(&cpu_once, cpu_init);
+
+	return cpu_flags;
+}
+
+void *gp_cpu_select(const char *name, const gp_cpu_impl *impls)
+{
+	unsigned int flags = gp_cpu_flags();
+	unsigned int i;
+
+	for (i = 0; impls[i].flags & ~flags; i++);
+
+	GP_DEBUG(1, "Selected %s implementation %u (flags 0x%02x)",
+	         name, i, impls[i].flags);
+
+	return impls[i].fn;
+}
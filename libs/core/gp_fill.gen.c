@@ -0,0 +1,137 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_fill.gen.c
+ *
+ * GENERATED on 2026 10 18 07:44:59 from gp_fill.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Optimized fill functions.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include "core/gp_pixmap.h"
+#include <core/gp_write_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_fn_per_bpp.h>
+#include "core/gp_fill.h"
+
+static void fill_1BPP_LE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_1BPP_LE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_1BPP_BE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_1BPP_BE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_2BPP_LE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_2BPP_LE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_2BPP_BE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_2BPP_BE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_4BPP_LE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_4BPP_LE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_4BPP_BE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_4BPP_BE(start, ctx->offset, ctx->w, val);
+	}
+}
+
+static void fill_8BPP(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_8BPP(start, ctx->w, val);
+	}
+}
+
+static void fill_16BPP(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_16BPP(start, ctx->w, val);
+	}
+}
+
+static void fill_24BPP(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_24BPP(start, ctx->w, val);
+	}
+}
+
+static void fill_32BPP(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		void *start = GP_PIXEL_ADDR(ctx, 0, y);
+		gp_write_pixels_32BPP(start, ctx->w, val);
+	}
+}
+
+static void fill_18BPP_LE(gp_pixmap *ctx, gp_pixel val)
+{
+	unsigned int y;
+
+	for (y = 0; y < ctx->h; y++) {
+		unsigned int x;
+
+		for (x = 0; x < ctx->w; x++)
+			gp_putpixel_raw_18BPP_LE(ctx, x, y, val);
+	}
+}
+
+
+void gp_fill(gp_pixmap *ctx, gp_pixel val)
+{
+	GP_FN_PER_BPP_PIXMAP(fill, ctx, ctx, val);
+}
@@ -21,7 +21,7 @@ static void fill_{{ ps.suffix }}(gp_pixmap *ctx, gp_pixel val)
 @     if ps.suffix in optimized_writepixels:
 		void *start = GP_PIXEL_ADDR(ctx, 0, y);
 @         if ps.needs_bit_endian():
-		gp_write_pixels_{{ ps.suffix }}(start, 0, ctx->w, val);
+		gp_write_pixels_{{ ps.suffix }}(start, ctx->offset, ctx->w, val);
 @         else:
 		gp_write_pixels_{{ ps.suffix }}(start, ctx->w, val);
 @     else:
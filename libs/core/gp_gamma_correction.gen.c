@@ -0,0 +1,1314 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_gamma_correction.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:01 from gp_gamma_correction.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Gamma correction tables for Gamma = 2.2
+ *
+ * Copyright (C) 2012-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdint.h>
+
+/*
+ * Converts 8 bit gamma to 10 bit linear.
+ */
+static uint16_t gamma8_linear10[] = {
+	0, /* 0 */
+	0, /* 1 */
+	0, /* 2 */
+	0, /* 3 */
+	0, /* 4 */
+	0, /* 5 */
+	0, /* 6 */
+	0, /* 7 */
+	1, /* 8 */
+	1, /* 9 */
+	1, /* 10 */
+	1, /* 11 */
+	1, /* 12 */
+	1, /* 13 */
+	2, /* 14 */
+	2, /* 15 */
+	2, /* 16 */
+	3, /* 17 */
+	3, /* 18 */
+	3, /* 19 */
+	4, /* 20 */
+	4, /* 21 */
+	5, /* 22 */
+	5, /* 23 */
+	6, /* 24 */
+	6, /* 25 */
+	7, /* 26 */
+	7, /* 27 */
+	8, /* 28 */
+	9, /* 29 */
+	9, /* 30 */
+	10, /* 31 */
+	11, /* 32 */
+	11, /* 33 */
+	12, /* 34 */
+	13, /* 35 */
+	14, /* 36 */
+	15, /* 37 */
+	16, /* 38 */
+	16, /* 39 */
+	17, /* 40 */
+	18, /* 41 */
+	19, /* 42 */
+	20, /* 43 */
+	21, /* 44 */
+	23, /* 45 */
+	24, /* 46 */
+	25, /* 47 */
+	26, /* 48 */
+	27, /* 49 */
+	28, /* 50 */
+	30, /* 51 */
+	31, /* 52 */
+	32, /* 53 */
+	34, /* 54 */
+	35, /* 55 */
+	36, /* 56 */
+	38, /* 57 */
+	39, /* 58 */
+	41, /* 59 */
+	42, /* 60 */
+	44, /* 61 */
+	46, /* 62 */
+	47, /* 63 */
+	49, /* 64 */
+	51, /* 65 */
+	52, /* 66 */
+	54, /* 67 */
+	56, /* 68 */
+	58, /* 69 */
+	60, /* 70 */
+	61, /* 71 */
+	63, /* 72 */
+	65, /* 73 */
+	67, /* 74 */
+	69, /* 75 */
+	71, /* 76 */
+	73, /* 77 */
+	76, /* 78 */
+	78, /* 79 */
+	80, /* 80 */
+	82, /* 81 */
+	84, /* 82 */
+	87, /* 83 */
+	89, /* 84 */
+	91, /* 85 */
+	94, /* 86 */
+	96, /* 87 */
+	99, /* 88 */
+	101, /* 89 */
+	104, /* 90 */
+	106, /* 91 */
+	109, /* 92 */
+	111, /* 93 */
+	114, /* 94 */
+	117, /* 95 */
+	119, /* 96 */
+	122, /* 97 */
+	125, /* 98 */
+	128, /* 99 */
+	131, /* 100 */
+	133, /* 101 */
+	136, /* 102 */
+	139, /* 103 */
+	142, /* 104 */
+	145, /* 105 */
+	148, /* 106 */
+	152, /* 107 */
+	155, /* 108 */
+	158, /* 109 */
+	161, /* 110 */
+	164, /* 111 */
+	168, /* 112 */
+	171, /* 113 */
+	174, /* 114 */
+	178, /* 115 */
+	181, /* 116 */
+	184, /* 117 */
+	188, /* 118 */
+	191, /* 119 */
+	195, /* 120 */
+	199, /* 121 */
+	202, /* 122 */
+	206, /* 123 */
+	210, /* 124 */
+	213, /* 125 */
+	217, /* 126 */
+	221, /* 127 */
+	225, /* 128 */
+	229, /* 129 */
+	233, /* 130 */
+	237, /* 131 */
+	241, /* 132 */
+	245, /* 133 */
+	249, /* 134 */
+	253, /* 135 */
+	257, /* 136 */
+	261, /* 137 */
+	265, /* 138 */
+	269, /* 139 */
+	274, /* 140 */
+	278, /* 141 */
+	282, /* 142 */
+	287, /* 143 */
+	291, /* 144 */
+	296, /* 145 */
+	300, /* 146 */
+	305, /* 147 */
+	309, /* 148 */
+	314, /* 149 */
+	319, /* 150 */
+	323, /* 151 */
+	328, /* 152 */
+	333, /* 153 */
+	338, /* 154 */
+	342, /* 155 */
+	347, /* 156 */
+	352, /* 157 */
+	357, /* 158 */
+	362, /* 159 */
+	367, /* 160 */
+	372, /* 161 */
+	377, /* 162 */
+	383, /* 163 */
+	388, /* 164 */
+	393, /* 165 */
+	398, /* 166 */
+	404, /* 167 */
+	409, /* 168 */
+	414, /* 169 */
+	420, /* 170 */
+	425, /* 171 */
+	431, /* 172 */
+	436, /* 173 */
+	442, /* 174 */
+	447, /* 175 */
+	453, /* 176 */
+	459, /* 177 */
+	464, /* 178 */
+	470, /* 179 */
+	476, /* 180 */
+	482, /* 181 */
+	488, /* 182 */
+	494, /* 183 */
+	499, /* 184 */
+	505, /* 185 */
+	511, /* 186 */
+	518, /* 187 */
+	524, /* 188 */
+	530, /* 189 */
+	536, /* 190 */
+	542, /* 191 */
+	548, /* 192 */
+	555, /* 193 */
+	561, /* 194 */
+	568, /* 195 */
+	574, /* 196 */
+	580, /* 197 */
+	587, /* 198 */
+	593, /* 199 */
+	600, /* 200 */
+	607, /* 201 */
+	613, /* 202 */
+	620, /* 203 */
+	627, /* 204 */
+	634, /* 205 */
+	640, /* 206 */
+	647, /* 207 */
+	654, /* 208 */
+	661, /* 209 */
+	668, /* 210 */
+	675, /* 211 */
+	682, /* 212 */
+	689, /* 213 */
+	696, /* 214 */
+	704, /* 215 */
+	711, /* 216 */
+	718, /* 217 */
+	725, /* 218 */
+	733, /* 219 */
+	740, /* 220 */
+	747, /* 221 */
+	755, /* 222 */
+	762, /* 223 */
+	770, /* 224 */
+	778, /* 225 */
+	785, /* 226 */
+	793, /* 227 */
+	801, /* 228 */
+	808, /* 229 */
+	816, /* 230 */
+	824, /* 231 */
+	832, /* 232 */
+	840, /* 233 */
+	848, /* 234 */
+	856, /* 235 */
+	864, /* 236 */
+	872, /* 237 */
+	880, /* 238 */
+	888, /* 239 */
+	896, /* 240 */
+	904, /* 241 */
+	913, /* 242 */
+	921, /* 243 */
+	929, /* 244 */
+	938, /* 245 */
+	946, /* 246 */
+	955, /* 247 */
+	963, /* 248 */
+	972, /* 249 */
+	980, /* 250 */
+	989, /* 251 */
+	998, /* 252 */
+	1006, /* 253 */
+	1015, /* 254 */
+	1024, /* 255 */
+};
+
+/*
+ * Converts 10 bit linear to 8 bit gamma.
+ */
+static uint8_t linear10_gamma8[] = {
+	0, /* 0 */
+	11, /* 1 */
+	15, /* 2 */
+	18, /* 3 */
+	21, /* 4 */
+	23, /* 5 */
+	25, /* 6 */
+	26, /* 7 */
+	28, /* 8 */
+	30, /* 9 */
+	31, /* 10 */
+	32, /* 11 */
+	34, /* 12 */
+	35, /* 13 */
+	36, /* 14 */
+	37, /* 15 */
+	39, /* 16 */
+	40, /* 17 */
+	41, /* 18 */
+	42, /* 19 */
+	43, /* 20 */
+	44, /* 21 */
+	45, /* 22 */
+	45, /* 23 */
+	46, /* 24 */
+	47, /* 25 */
+	48, /* 26 */
+	49, /* 27 */
+	50, /* 28 */
+	50, /* 29 */
+	51, /* 30 */
+	52, /* 31 */
+	53, /* 32 */
+	54, /* 33 */
+	54, /* 34 */
+	55, /* 35 */
+	56, /* 36 */
+	56, /* 37 */
+	57, /* 38 */
+	58, /* 39 */
+	58, /* 40 */
+	59, /* 41 */
+	60, /* 42 */
+	60, /* 43 */
+	61, /* 44 */
+	62, /* 45 */
+	62, /* 46 */
+	63, /* 47 */
+	63, /* 48 */
+	64, /* 49 */
+	65, /* 50 */
+	65, /* 51 */
+	66, /* 52 */
+	66, /* 53 */
+	67, /* 54 */
+	67, /* 55 */
+	68, /* 56 */
+	69, /* 57 */
+	69, /* 58 */
+	70, /* 59 */
+	70, /* 60 */
+	71, /* 61 */
+	71, /* 62 */
+	72, /* 63 */
+	72, /* 64 */
+	73, /* 65 */
+	73, /* 66 */
+	74, /* 67 */
+	74, /* 68 */
+	75, /* 69 */
+	75, /* 70 */
+	76, /* 71 */
+	76, /* 72 */
+	77, /* 73 */
+	77, /* 74 */
+	78, /* 75 */
+	78, /* 76 */
+	79, /* 77 */
+	79, /* 78 */
+	80, /* 79 */
+	80, /* 80 */
+	80, /* 81 */
+	81, /* 82 */
+	81, /* 83 */
+	82, /* 84 */
+	82, /* 85 */
+	83, /* 86 */
+	83, /* 87 */
+	84, /* 88 */
+	84, /* 89 */
+	84, /* 90 */
+	85, /* 91 */
+	85, /* 92 */
+	86, /* 93 */
+	86, /* 94 */
+	87, /* 95 */
+	87, /* 96 */
+	87, /* 97 */
+	88, /* 98 */
+	88, /* 99 */
+	89, /* 100 */
+	89, /* 101 */
+	89, /* 102 */
+	90, /* 103 */
+	90, /* 104 */
+	91, /* 105 */
+	91, /* 106 */
+	91, /* 107 */
+	92, /* 108 */
+	92, /* 109 */
+	92, /* 110 */
+	93, /* 111 */
+	93, /* 112 */
+	94, /* 113 */
+	94, /* 114 */
+	94, /* 115 */
+	95, /* 116 */
+	95, /* 117 */
+	95, /* 118 */
+	96, /* 119 */
+	96, /* 120 */
+	97, /* 121 */
+	97, /* 122 */
+	97, /* 123 */
+	98, /* 124 */
+	98, /* 125 */
+	98, /* 126 */
+	99, /* 127 */
+	99, /* 128 */
+	99, /* 129 */
+	100, /* 130 */
+	100, /* 131 */
+	100, /* 132 */
+	101, /* 133 */
+	101, /* 134 */
+	102, /* 135 */
+	102, /* 136 */
+	102, /* 137 */
+	103, /* 138 */
+	103, /* 139 */
+	103, /* 140 */
+	104, /* 141 */
+	104, /* 142 */
+	104, /* 143 */
+	105, /* 144 */
+	105, /* 145 */
+	105, /* 146 */
+	106, /* 147 */
+	106, /* 148 */
+	106, /* 149 */
+	107, /* 150 */
+	107, /* 151 */
+	107, /* 152 */
+	107, /* 153 */
+	108, /* 154 */
+	108, /* 155 */
+	108, /* 156 */
+	109, /* 157 */
+	109, /* 158 */
+	109, /* 159 */
+	110, /* 160 */
+	110, /* 161 */
+	110, /* 162 */
+	111, /* 163 */
+	111, /* 164 */
+	111, /* 165 */
+	112, /* 166 */
+	112, /* 167 */
+	112, /* 168 */
+	112, /* 169 */
+	113, /* 170 */
+	113, /* 171 */
+	113, /* 172 */
+	114, /* 173 */
+	114, /* 174 */
+	114, /* 175 */
+	115, /* 176 */
+	115, /* 177 */
+	115, /* 178 */
+	115, /* 179 */
+	116, /* 180 */
+	116, /* 181 */
+	116, /* 182 */
+	117, /* 183 */
+	117, /* 184 */
+	117, /* 185 */
+	117, /* 186 */
+	118, /* 187 */
+	118, /* 188 */
+	118, /* 189 */
+	119, /* 190 */
+	119, /* 191 */
+	119, /* 192 */
+	119, /* 193 */
+	120, /* 194 */
+	120, /* 195 */
+	120, /* 196 */
+	121, /* 197 */
+	121, /* 198 */
+	121, /* 199 */
+	121, /* 200 */
+	122, /* 201 */
+	122, /* 202 */
+	122, /* 203 */
+	122, /* 204 */
+	123, /* 205 */
+	123, /* 206 */
+	123, /* 207 */
+	124, /* 208 */
+	124, /* 209 */
+	124, /* 210 */
+	124, /* 211 */
+	125, /* 212 */
+	125, /* 213 */
+	125, /* 214 */
+	125, /* 215 */
+	126, /* 216 */
+	126, /* 217 */
+	126, /* 218 */
+	126, /* 219 */
+	127, /* 220 */
+	127, /* 221 */
+	127, /* 222 */
+	128, /* 223 */
+	128, /* 224 */
+	128, /* 225 */
+	128, /* 226 */
+	129, /* 227 */
+	129, /* 228 */
+	129, /* 229 */
+	129, /* 230 */
+	130, /* 231 */
+	130, /* 232 */
+	130, /* 233 */
+	130, /* 234 */
+	131, /* 235 */
+	131, /* 236 */
+	131, /* 237 */
+	131, /* 238 */
+	132, /* 239 */
+	132, /* 240 */
+	132, /* 241 */
+	132, /* 242 */
+	133, /* 243 */
+	133, /* 244 */
+	133, /* 245 */
+	133, /* 246 */
+	134, /* 247 */
+	134, /* 248 */
+	134, /* 249 */
+	134, /* 250 */
+	135, /* 251 */
+	135, /* 252 */
+	135, /* 253 */
+	135, /* 254 */
+	136, /* 255 */
+	136, /* 256 */
+	136, /* 257 */
+	136, /* 258 */
+	137, /* 259 */
+	137, /* 260 */
+	137, /* 261 */
+	137, /* 262 */
+	137, /* 263 */
+	138, /* 264 */
+	138, /* 265 */
+	138, /* 266 */
+	138, /* 267 */
+	139, /* 268 */
+	139, /* 269 */
+	139, /* 270 */
+	139, /* 271 */
+	140, /* 272 */
+	140, /* 273 */
+	140, /* 274 */
+	140, /* 275 */
+	141, /* 276 */
+	141, /* 277 */
+	141, /* 278 */
+	141, /* 279 */
+	141, /* 280 */
+	142, /* 281 */
+	142, /* 282 */
+	142, /* 283 */
+	142, /* 284 */
+	143, /* 285 */
+	143, /* 286 */
+	143, /* 287 */
+	143, /* 288 */
+	143, /* 289 */
+	144, /* 290 */
+	144, /* 291 */
+	144, /* 292 */
+	144, /* 293 */
+	145, /* 294 */
+	145, /* 295 */
+	145, /* 296 */
+	145, /* 297 */
+	146, /* 298 */
+	146, /* 299 */
+	146, /* 300 */
+	146, /* 301 */
+	146, /* 302 */
+	147, /* 303 */
+	147, /* 304 */
+	147, /* 305 */
+	147, /* 306 */
+	147, /* 307 */
+	148, /* 308 */
+	148, /* 309 */
+	148, /* 310 */
+	148, /* 311 */
+	149, /* 312 */
+	149, /* 313 */
+	149, /* 314 */
+	149, /* 315 */
+	149, /* 316 */
+	150, /* 317 */
+	150, /* 318 */
+	150, /* 319 */
+	150, /* 320 */
+	151, /* 321 */
+	151, /* 322 */
+	151, /* 323 */
+	151, /* 324 */
+	151, /* 325 */
+	152, /* 326 */
+	152, /* 327 */
+	152, /* 328 */
+	152, /* 329 */
+	152, /* 330 */
+	153, /* 331 */
+	153, /* 332 */
+	153, /* 333 */
+	153, /* 334 */
+	153, /* 335 */
+	154, /* 336 */
+	154, /* 337 */
+	154, /* 338 */
+	154, /* 339 */
+	154, /* 340 */
+	155, /* 341 */
+	155, /* 342 */
+	155, /* 343 */
+	155, /* 344 */
+	156, /* 345 */
+	156, /* 346 */
+	156, /* 347 */
+	156, /* 348 */
+	156, /* 349 */
+	157, /* 350 */
+	157, /* 351 */
+	157, /* 352 */
+	157, /* 353 */
+	157, /* 354 */
+	158, /* 355 */
+	158, /* 356 */
+	158, /* 357 */
+	158, /* 358 */
+	158, /* 359 */
+	159, /* 360 */
+	159, /* 361 */
+	159, /* 362 */
+	159, /* 363 */
+	159, /* 364 */
+	160, /* 365 */
+	160, /* 366 */
+	160, /* 367 */
+	160, /* 368 */
+	160, /* 369 */
+	161, /* 370 */
+	161, /* 371 */
+	161, /* 372 */
+	161, /* 373 */
+	161, /* 374 */
+	162, /* 375 */
+	162, /* 376 */
+	162, /* 377 */
+	162, /* 378 */
+	162, /* 379 */
+	162, /* 380 */
+	163, /* 381 */
+	163, /* 382 */
+	163, /* 383 */
+	163, /* 384 */
+	163, /* 385 */
+	164, /* 386 */
+	164, /* 387 */
+	164, /* 388 */
+	164, /* 389 */
+	164, /* 390 */
+	165, /* 391 */
+	165, /* 392 */
+	165, /* 393 */
+	165, /* 394 */
+	165, /* 395 */
+	166, /* 396 */
+	166, /* 397 */
+	166, /* 398 */
+	166, /* 399 */
+	166, /* 400 */
+	167, /* 401 */
+	167, /* 402 */
+	167, /* 403 */
+	167, /* 404 */
+	167, /* 405 */
+	167, /* 406 */
+	168, /* 407 */
+	168, /* 408 */
+	168, /* 409 */
+	168, /* 410 */
+	168, /* 411 */
+	169, /* 412 */
+	169, /* 413 */
+	169, /* 414 */
+	169, /* 415 */
+	169, /* 416 */
+	170, /* 417 */
+	170, /* 418 */
+	170, /* 419 */
+	170, /* 420 */
+	170, /* 421 */
+	170, /* 422 */
+	171, /* 423 */
+	171, /* 424 */
+	171, /* 425 */
+	171, /* 426 */
+	171, /* 427 */
+	172, /* 428 */
+	172, /* 429 */
+	172, /* 430 */
+	172, /* 431 */
+	172, /* 432 */
+	172, /* 433 */
+	173, /* 434 */
+	173, /* 435 */
+	173, /* 436 */
+	173, /* 437 */
+	173, /* 438 */
+	174, /* 439 */
+	174, /* 440 */
+	174, /* 441 */
+	174, /* 442 */
+	174, /* 443 */
+	174, /* 444 */
+	175, /* 445 */
+	175, /* 446 */
+	175, /* 447 */
+	175, /* 448 */
+	175, /* 449 */
+	175, /* 450 */
+	176, /* 451 */
+	176, /* 452 */
+	176, /* 453 */
+	176, /* 454 */
+	176, /* 455 */
+	177, /* 456 */
+	177, /* 457 */
+	177, /* 458 */
+	177, /* 459 */
+	177, /* 460 */
+	177, /* 461 */
+	178, /* 462 */
+	178, /* 463 */
+	178, /* 464 */
+	178, /* 465 */
+	178, /* 466 */
+	178, /* 467 */
+	179, /* 468 */
+	179, /* 469 */
+	179, /* 470 */
+	179, /* 471 */
+	179, /* 472 */
+	180, /* 473 */
+	180, /* 474 */
+	180, /* 475 */
+	180, /* 476 */
+	180, /* 477 */
+	180, /* 478 */
+	181, /* 479 */
+	181, /* 480 */
+	181, /* 481 */
+	181, /* 482 */
+	181, /* 483 */
+	181, /* 484 */
+	182, /* 485 */
+	182, /* 486 */
+	182, /* 487 */
+	182, /* 488 */
+	182, /* 489 */
+	182, /* 490 */
+	183, /* 491 */
+	183, /* 492 */
+	183, /* 493 */
+	183, /* 494 */
+	183, /* 495 */
+	183, /* 496 */
+	184, /* 497 */
+	184, /* 498 */
+	184, /* 499 */
+	184, /* 500 */
+	184, /* 501 */
+	184, /* 502 */
+	185, /* 503 */
+	185, /* 504 */
+	185, /* 505 */
+	185, /* 506 */
+	185, /* 507 */
+	185, /* 508 */
+	186, /* 509 */
+	186, /* 510 */
+	186, /* 511 */
+	186, /* 512 */
+	186, /* 513 */
+	186, /* 514 */
+	187, /* 515 */
+	187, /* 516 */
+	187, /* 517 */
+	187, /* 518 */
+	187, /* 519 */
+	187, /* 520 */
+	188, /* 521 */
+	188, /* 522 */
+	188, /* 523 */
+	188, /* 524 */
+	188, /* 525 */
+	188, /* 526 */
+	189, /* 527 */
+	189, /* 528 */
+	189, /* 529 */
+	189, /* 530 */
+	189, /* 531 */
+	189, /* 532 */
+	190, /* 533 */
+	190, /* 534 */
+	190, /* 535 */
+	190, /* 536 */
+	190, /* 537 */
+	190, /* 538 */
+	190, /* 539 */
+	191, /* 540 */
+	191, /* 541 */
+	191, /* 542 */
+	191, /* 543 */
+	191, /* 544 */
+	191, /* 545 */
+	192, /* 546 */
+	192, /* 547 */
+	192, /* 548 */
+	192, /* 549 */
+	192, /* 550 */
+	192, /* 551 */
+	193, /* 552 */
+	193, /* 553 */
+	193, /* 554 */
+	193, /* 555 */
+	193, /* 556 */
+	193, /* 557 */
+	194, /* 558 */
+	194, /* 559 */
+	194, /* 560 */
+	194, /* 561 */
+	194, /* 562 */
+	194, /* 563 */
+	194, /* 564 */
+	195, /* 565 */
+	195, /* 566 */
+	195, /* 567 */
+	195, /* 568 */
+	195, /* 569 */
+	195, /* 570 */
+	196, /* 571 */
+	196, /* 572 */
+	196, /* 573 */
+	196, /* 574 */
+	196, /* 575 */
+	196, /* 576 */
+	196, /* 577 */
+	197, /* 578 */
+	197, /* 579 */
+	197, /* 580 */
+	197, /* 581 */
+	197, /* 582 */
+	197, /* 583 */
+	198, /* 584 */
+	198, /* 585 */
+	198, /* 586 */
+	198, /* 587 */
+	198, /* 588 */
+	198, /* 589 */
+	198, /* 590 */
+	199, /* 591 */
+	199, /* 592 */
+	199, /* 593 */
+	199, /* 594 */
+	199, /* 595 */
+	199, /* 596 */
+	200, /* 597 */
+	200, /* 598 */
+	200, /* 599 */
+	200, /* 600 */
+	200, /* 601 */
+	200, /* 602 */
+	200, /* 603 */
+	201, /* 604 */
+	201, /* 605 */
+	201, /* 606 */
+	201, /* 607 */
+	201, /* 608 */
+	201, /* 609 */
+	202, /* 610 */
+	202, /* 611 */
+	202, /* 612 */
+	202, /* 613 */
+	202, /* 614 */
+	202, /* 615 */
+	202, /* 616 */
+	203, /* 617 */
+	203, /* 618 */
+	203, /* 619 */
+	203, /* 620 */
+	203, /* 621 */
+	203, /* 622 */
+	203, /* 623 */
+	204, /* 624 */
+	204, /* 625 */
+	204, /* 626 */
+	204, /* 627 */
+	204, /* 628 */
+	204, /* 629 */
+	204, /* 630 */
+	205, /* 631 */
+	205, /* 632 */
+	205, /* 633 */
+	205, /* 634 */
+	205, /* 635 */
+	205, /* 636 */
+	206, /* 637 */
+	206, /* 638 */
+	206, /* 639 */
+	206, /* 640 */
+	206, /* 641 */
+	206, /* 642 */
+	206, /* 643 */
+	207, /* 644 */
+	207, /* 645 */
+	207, /* 646 */
+	207, /* 647 */
+	207, /* 648 */
+	207, /* 649 */
+	207, /* 650 */
+	208, /* 651 */
+	208, /* 652 */
+	208, /* 653 */
+	208, /* 654 */
+	208, /* 655 */
+	208, /* 656 */
+	208, /* 657 */
+	209, /* 658 */
+	209, /* 659 */
+	209, /* 660 */
+	209, /* 661 */
+	209, /* 662 */
+	209, /* 663 */
+	209, /* 664 */
+	210, /* 665 */
+	210, /* 666 */
+	210, /* 667 */
+	210, /* 668 */
+	210, /* 669 */
+	210, /* 670 */
+	210, /* 671 */
+	211, /* 672 */
+	211, /* 673 */
+	211, /* 674 */
+	211, /* 675 */
+	211, /* 676 */
+	211, /* 677 */
+	211, /* 678 */
+	212, /* 679 */
+	212, /* 680 */
+	212, /* 681 */
+	212, /* 682 */
+	212, /* 683 */
+	212, /* 684 */
+	212, /* 685 */
+	213, /* 686 */
+	213, /* 687 */
+	213, /* 688 */
+	213, /* 689 */
+	213, /* 690 */
+	213, /* 691 */
+	213, /* 692 */
+	214, /* 693 */
+	214, /* 694 */
+	214, /* 695 */
+	214, /* 696 */
+	214, /* 697 */
+	214, /* 698 */
+	214, /* 699 */
+	215, /* 700 */
+	215, /* 701 */
+	215, /* 702 */
+	215, /* 703 */
+	215, /* 704 */
+	215, /* 705 */
+	215, /* 706 */
+	215, /* 707 */
+	216, /* 708 */
+	216, /* 709 */
+	216, /* 710 */
+	216, /* 711 */
+	216, /* 712 */
+	216, /* 713 */
+	216, /* 714 */
+	217, /* 715 */
+	217, /* 716 */
+	217, /* 717 */
+	217, /* 718 */
+	217, /* 719 */
+	217, /* 720 */
+	217, /* 721 */
+	218, /* 722 */
+	218, /* 723 */
+	218, /* 724 */
+	218, /* 725 */
+	218, /* 726 */
+	218, /* 727 */
+	218, /* 728 */
+	219, /* 729 */
+	219, /* 730 */
+	219, /* 731 */
+	219, /* 732 */
+	219, /* 733 */
+	219, /* 734 */
+	219, /* 735 */
+	219, /* 736 */
+	220, /* 737 */
+	220, /* 738 */
+	220, /* 739 */
+	220, /* 740 */
+	220, /* 741 */
+	220, /* 742 */
+	220, /* 743 */
+	221, /* 744 */
+	221, /* 745 */
+	221, /* 746 */
+	221, /* 747 */
+	221, /* 748 */
+	221, /* 749 */
+	221, /* 750 */
+	221, /* 751 */
+	222, /* 752 */
+	222, /* 753 */
+	222, /* 754 */
+	222, /* 755 */
+	222, /* 756 */
+	222, /* 757 */
+	222, /* 758 */
+	223, /* 759 */
+	223, /* 760 */
+	223, /* 761 */
+	223, /* 762 */
+	223, /* 763 */
+	223, /* 764 */
+	223, /* 765 */
+	223, /* 766 */
+	224, /* 767 */
+	224, /* 768 */
+	224, /* 769 */
+	224, /* 770 */
+	224, /* 771 */
+	224, /* 772 */
+	224, /* 773 */
+	225, /* 774 */
+	225, /* 775 */
+	225, /* 776 */
+	225, /* 777 */
+	225, /* 778 */
+	225, /* 779 */
+	225, /* 780 */
+	225, /* 781 */
+	226, /* 782 */
+	226, /* 783 */
+	226, /* 784 */
+	226, /* 785 */
+	226, /* 786 */
+	226, /* 787 */
+	226, /* 788 */
+	227, /* 789 */
+	227, /* 790 */
+	227, /* 791 */
+	227, /* 792 */
+	227, /* 793 */
+	227, /* 794 */
+	227, /* 795 */
+	227, /* 796 */
+	228, /* 797 */
+	228, /* 798 */
+	228, /* 799 */
+	228, /* 800 */
+	228, /* 801 */
+	228, /* 802 */
+	228, /* 803 */
+	228, /* 804 */
+	229, /* 805 */
+	229, /* 806 */
+	229, /* 807 */
+	229, /* 808 */
+	229, /* 809 */
+	229, /* 810 */
+	229, /* 811 */
+	229, /* 812 */
+	230, /* 813 */
+	230, /* 814 */
+	230, /* 815 */
+	230, /* 816 */
+	230, /* 817 */
+	230, /* 818 */
+	230, /* 819 */
+	231, /* 820 */
+	231, /* 821 */
+	231, /* 822 */
+	231, /* 823 */
+	231, /* 824 */
+	231, /* 825 */
+	231, /* 826 */
+	231, /* 827 */
+	232, /* 828 */
+	232, /* 829 */
+	232, /* 830 */
+	232, /* 831 */
+	232, /* 832 */
+	232, /* 833 */
+	232, /* 834 */
+	232, /* 835 */
+	233, /* 836 */
+	233, /* 837 */
+	233, /* 838 */
+	233, /* 839 */
+	233, /* 840 */
+	233, /* 841 */
+	233, /* 842 */
+	233, /* 843 */
+	234, /* 844 */
+	234, /* 845 */
+	234, /* 846 */
+	234, /* 847 */
+	234, /* 848 */
+	234, /* 849 */
+	234, /* 850 */
+	234, /* 851 */
+	235, /* 852 */
+	235, /* 853 */
+	235, /* 854 */
+	235, /* 855 */
+	235, /* 856 */
+	235, /* 857 */
+	235, /* 858 */
+	235, /* 859 */
+	236, /* 860 */
+	236, /* 861 */
+	236, /* 862 */
+	236, /* 863 */
+	236, /* 864 */
+	236, /* 865 */
+	236, /* 866 */
+	236, /* 867 */
+	237, /* 868 */
+	237, /* 869 */
+	237, /* 870 */
+	237, /* 871 */
+	237, /* 872 */
+	237, /* 873 */
+	237, /* 874 */
+	237, /* 875 */
+	238, /* 876 */
+	238, /* 877 */
+	238, /* 878 */
+	238, /* 879 */
+	238, /* 880 */
+	238, /* 881 */
+	238, /* 882 */
+	238, /* 883 */
+	239, /* 884 */
+	239, /* 885 */
+	239, /* 886 */
+	239, /* 887 */
+	239, /* 888 */
+	239, /* 889 */
+	239, /* 890 */
+	239, /* 891 */
+	239, /* 892 */
+	240, /* 893 */
+	240, /* 894 */
+	240, /* 895 */
+	240, /* 896 */
+	240, /* 897 */
+	240, /* 898 */
+	240, /* 899 */
+	240, /* 900 */
+	241, /* 901 */
+	241, /* 902 */
+	241, /* 903 */
+	241, /* 904 */
+	241, /* 905 */
+	241, /* 906 */
+	241, /* 907 */
+	241, /* 908 */
+	242, /* 909 */
+	242, /* 910 */
+	242, /* 911 */
+	242, /* 912 */
+	242, /* 913 */
+	242, /* 914 */
+	242, /* 915 */
+	242, /* 916 */
+	243, /* 917 */
+	243, /* 918 */
+	243, /* 919 */
+	243, /* 920 */
+	243, /* 921 */
+	243, /* 922 */
+	243, /* 923 */
+	243, /* 924 */
+	243, /* 925 */
+	244, /* 926 */
+	244, /* 927 */
+	244, /* 928 */
+	244, /* 929 */
+	244, /* 930 */
+	244, /* 931 */
+	244, /* 932 */
+	244, /* 933 */
+	245, /* 934 */
+	245, /* 935 */
+	245, /* 936 */
+	245, /* 937 */
+	245, /* 938 */
+	245, /* 939 */
+	245, /* 940 */
+	245, /* 941 */
+	246, /* 942 */
+	246, /* 943 */
+	246, /* 944 */
+	246, /* 945 */
+	246, /* 946 */
+	246, /* 947 */
+	246, /* 948 */
+	246, /* 949 */
+	246, /* 950 */
+	247, /* 951 */
+	247, /* 952 */
+	247, /* 953 */
+	247, /* 954 */
+	247, /* 955 */
+	247, /* 956 */
+	247, /* 957 */
+	247, /* 958 */
+	248, /* 959 */
+	248, /* 960 */
+	248, /* 961 */
+	248, /* 962 */
+	248, /* 963 */
+	248, /* 964 */
+	248, /* 965 */
+	248, /* 966 */
+	248, /* 967 */
+	249, /* 968 */
+	249, /* 969 */
+	249, /* 970 */
+	249, /* 971 */
+	249, /* 972 */
+	249, /* 973 */
+	249, /* 974 */
+	249, /* 975 */
+	249, /* 976 */
+	250, /* 977 */
+	250, /* 978 */
+	250, /* 979 */
+	250, /* 980 */
+	250, /* 981 */
+	250, /* 982 */
+	250, /* 983 */
+	250, /* 984 */
+	251, /* 985 */
+	251, /* 986 */
+	251, /* 987 */
+	251, /* 988 */
+	251, /* 989 */
+	251, /* 990 */
+	251, /* 991 */
+	251, /* 992 */
+	251, /* 993 */
+	252, /* 994 */
+	252, /* 995 */
+	252, /* 996 */
+	252, /* 997 */
+	252, /* 998 */
+	252, /* 999 */
+	252, /* 1000 */
+	252, /* 1001 */
+	252, /* 1002 */
+	253, /* 1003 */
+	253, /* 1004 */
+	253, /* 1005 */
+	253, /* 1006 */
+	253, /* 1007 */
+	253, /* 1008 */
+	253, /* 1009 */
+	253, /* 1010 */
+	254, /* 1011 */
+	254, /* 1012 */
+	254, /* 1013 */
+	254, /* 1014 */
+	254, /* 1015 */
+	254, /* 1016 */
+	254, /* 1017 */
+	254, /* 1018 */
+	254, /* 1019 */
+	255, /* 1020 */
+	255, /* 1021 */
+	255, /* 1022 */
+	255, /* 1023 */
+	255, /* 1024 */
+};
+
+/*
+ * Pointers to tables
+ */
+uint16_t *gp_gamma8_linear10 = gamma8_linear10;
+uint8_t *gp_linear10_gamma8 = linear10_gamma8;
@@ -14,6 +14,8 @@
 @     flags = []
 @     if pt.is_alpha():
 @         flags.append('GP_PIXEL_HAS_ALPHA')
+@     if pt.is_premultiplied():
+@         flags.append('GP_PIXEL_IS_PREMULTIPLIED')
 @     if pt.is_rgb():
 @         flags.append('GP_PIXEL_IS_RGB')
 @     if pt.is_palette():
@@ -22,6 +24,8 @@
 @         flags.append('GP_PIXEL_IS_GRAYSCALE')
 @     if pt.is_cmyk():
 @         flags.append('GP_PIXEL_IS_CMYK')
+@     if pt.is_8bpc():
+@         flags.append('GP_PIXEL_IS_8BPC')
 @     if flags:
 @         return ' | '.join(flags)
 @     else:
@@ -8,6 +8,9 @@
 
 #include <errno.h>
 #include <string.h>
+#include <stdint.h>
+#include <unistd.h>
+#include <sys/mman.h>
 
 #include <core/gp_debug.h>
 #include <core/gp_transform.h>
@@ -93,6 +96,7 @@ gp_pixmap *gp_pixmap_alloc(gp_size w, gp_size h, gp_pixel_type type)
 	gp_pixmap_set_rotation(pixmap, 0, 0, 0);
 
 	pixmap->free_pixels = 1;
+	pixmap->unmap_pixels = 0;
 
 	return pixmap;
 }
@@ -106,6 +110,17 @@ int gp_pixmap_set_gamma(gp_pixmap *self, float gamma)
 	return !self->gamma;
 }
 
+static void unmap_pixels(gp_pixmap *pixmap)
+{
+	uintptr_t page_mask = sysconf(_SC_PAGESIZE) - 1;
+	uint8_t *start = (uint8_t*)((uintptr_t)pixmap->pixels & ~page_mask);
+	size_t size = pixmap->pixels - start +
+	              (size_t)pixmap->bytes_per_row * pixmap->h;
+
+	if (munmap(start, size))
+		GP_WARN("Failed to unmap pixels: %s", strerror(errno));
+}
+
 void gp_pixmap_free(gp_pixmap *pixmap)
 {
 	GP_DEBUG(1, "Freeing pixmap (%p)", pixmap);
@@ -116,6 +131,9 @@ void gp_pixmap_free(gp_pixmap *pixmap)
 	if (pixmap->free_pixels)
 		free(pixmap->pixels);
 
+	if (pixmap->unmap_pixels)
+		unmap_pixels(pixmap);
+
 	if (pixmap->gamma)
 		gp_gamma_release(pixmap->gamma);
 
@@ -145,6 +163,7 @@ gp_pixmap *gp_pixmap_init(gp_pixmap *pixmap, gp_size w, gp_size h,
 	gp_pixmap_set_rotation(pixmap, 0, 0, 0);
 
 	pixmap->free_pixels = 0;
+	pixmap->unmap_pixels = 0;
 
 	return pixmap;
 }
@@ -193,7 +212,7 @@ gp_pixmap *gp_pixmap_copy(const gp_pixmap *src, int flags)
 
 	new->bpp           = src->bpp;
 	new->bytes_per_row = src->bytes_per_row;
-	new->offset        = 0;
+	new->offset        = src->offset;
 
 	new->w = src->w;
 	new->h = src->h;
@@ -210,6 +229,7 @@ gp_pixmap *gp_pixmap_copy(const gp_pixmap *src, int flags)
 	new->gamma = NULL;
 
 	new->free_pixels = 1;
+	new->unmap_pixels = 0;
 
 	return new;
 }
@@ -282,8 +302,18 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 
 	subpixmap->bpp           = pixmap->bpp;
 	subpixmap->bytes_per_row = pixmap->bytes_per_row;
-	subpixmap->offset        = (pixmap->offset +
-	                            gp_pixel_addr_offset(x, pixmap->pixel_type)) % 8;
+
+	if (pixmap->bpp < 8) {
+		unsigned int bit = pixmap->offset + x * pixmap->bpp;
+
+		subpixmap->offset = bit % 8;
+		subpixmap->pixels = pixmap->pixels + bit / 8 +
+		                    pixmap->bytes_per_row * y;
+	} else {
+		subpixmap->offset = (pixmap->offset +
+		                     gp_pixel_addr_offset(x, pixmap->pixel_type)) % 8;
+		subpixmap->pixels = GP_PIXEL_ADDR(pixmap, x, y);
+	}
 
 	subpixmap->w = w;
 	subpixmap->h = h;
@@ -297,9 +327,8 @@ gp_pixmap *gp_sub_pixmap(const gp_pixmap *pixmap, gp_pixmap *subpixmap,
 	/* rotation and mirroring */
 	gp_pixmap_copy_rotation(pixmap, subpixmap);
 
-	subpixmap->pixels = GP_PIXEL_ADDR(pixmap, x, y);
-
 	subpixmap->free_pixels = 0;
+	subpixmap->unmap_pixels = 0;
 
 	return subpixmap;
 }
@@ -314,8 +343,9 @@ void gp_pixmap_print_info(const gp_pixmap *self)
 	printf("Pixel\t%s (%u)\n", gp_pixel_type_name(self->pixel_type),
 	       self->pixel_type);
 	printf("Offset\t%u (only unaligned pixel types)\n", self->offset);
-	printf("Flags\taxes_swap=%u x_swap=%u y_swap=%u free_pixels=%u\n",
-	       self->axes_swap, self->x_swap, self->y_swap, self->free_pixels);
+	printf("Flags\taxes_swap=%u x_swap=%u y_swap=%u free_pixels=%u "
+	       "unmap_pixels=%u\n", self->axes_swap, self->x_swap,
+	       self->y_swap, self->free_pixels, self->unmap_pixels);
 
 	if (self->gamma)
 		gp_gamma_print(self->gamma);
@@ -5,6 +5,7 @@
 
 #include <unistd.h>
 #include <stdlib.h>
+#include <errno.h>
 
 #include <core/gp_common.h>
 #include <core/gp_debug.h>
@@ -13,8 +14,18 @@
 
 static unsigned int nr_threads = 0;
 
+/* Number of bands per thread, the more the better the load balancing is */
+#define GP_THREADS_BANDS 8
+
+/* Band working set upper limit, should fit into L2 cache */
+#define GP_THREADS_BAND_BYTES (256 * 1024)
+
+/* Minimal band cost, i.e. bytes_per_row * kern_size * rows */
+#define GP_THREADS_BAND_MIN_COST (64 * 1024)
+
 unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
 {
+	unsigned int nr = nr_threads;
 	int count, threads;
 	char *env;
 
@@ -22,23 +33,23 @@ unsigned int gp_nr_threads(gp_size w, gp_size h, gp_progress_cb *callback)
 	if (callback != NULL && callback->threads) {
 		GP_DEBUG(1, "Overriding nr_threads from callback to %i",
 		         callback->threads);
-		nr_threads = callback->threads;
+		nr = callback->threads;
 	} else {
 		/* Then try to override it from the enviroment variable */
 		env = getenv("GP_THREADS");
 
 		if (env) {
-			nr_threads = atoi(env);
+			nr = atoi(env);
 			GP_DEBUG(1, "Using GP_THREADS=%u from enviroment "
-			            "variable", nr_threads);
+			            "variable", nr);
 		}
 	}
 
-	if (nr_threads == 0) {
+	if (nr == 0) {
 		count = sysconf(_SC_NPROCESSORS_ONLN);
 		GP_DEBUG(1, "Found %i CPUs", count);
 	} else {
-		count = nr_threads;
+		count = nr;
 		GP_DEBUG(1, "Using nr_threads=%i", count);
 	}
 
@@ -91,3 +102,434 @@ int gp_progress_cb_mp(gp_progress_cb *self)
 
 	return ret;
 }
+
+/*
+ * Range of bands owned by a thread.
+ *
+ * The owner takes bands from the front, idle threads steal from the back.
+ */
+struct rows_range {
+	pthread_mutex_t lock;
+	unsigned int first;
+	unsigned int last;
+};
+
+/*
+ * A single parallel for rows job, lives on the stack of the caller.
+ */
+struct rows_job {
+	gp_threads_rows_fn fn;
+	void *priv;
+
+	gp_size h;
+	gp_size band_h;
+
+	/* Number of threads (including the caller) to run the job */
+	unsigned int threads;
+	/* Per thread band ranges, the caller uses ranges[0] */
+	struct rows_range *ranges;
+
+	/* Guards the fields below */
+	pthread_mutex_t lock;
+	gp_size rows_done;
+	int abort;
+	int err;
+
+	/* Number of pool workers currently working on the job, guarded by pool lock */
+	unsigned int active;
+
+	struct gp_progress_cb_mp_priv cb_priv;
+};
+
+struct pool_worker {
+	pthread_t thread;
+	unsigned int id;
+	unsigned long gen;
+};
+
+static struct {
+	/* Guards all the fields below */
+	pthread_mutex_t lock;
+	/* Signalled when new job was published */
+	pthread_cond_t wake;
+	/* Signalled when last worker finished its part of a job */
+	pthread_cond_t done;
+
+	unsigned int nr_workers;
+
+	/* Incremented for each new job */
+	unsigned long gen;
+	struct rows_job *job;
+} pool = {
+	.lock = PTHREAD_MUTEX_INITIALIZER,
+	.wake = PTHREAD_COND_INITIALIZER,
+	.done = PTHREAD_COND_INITIALIZER,
+};
+
+/* Serializes jobs submitted from different threads */
+static pthread_mutex_t pool_run_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/* Set in the pool workers, nested jobs are executed inline */
+static __thread int in_pool_worker;
+
+static int take_band(struct rows_range *range, unsigned int *band)
+{
+	int ret = 0;
+
+	pthread_mutex_lock(&range->lock);
+
+	if (range->first < range->last) {
+		*band = range->first++;
+		ret = 1;
+	}
+
+	pthread_mutex_unlock(&range->lock);
+
+	return ret;
+}
+
+/*
+ * Moves back half of the bands from the busiest thread into our range.
+ */
+static int steal_bands(struct rows_job *job, unsigned int self)
+{
+	struct rows_range *victim, *own = &job->ranges[self];
+	unsigned int i, max, first, last;
+
+	for (;;) {
+		victim = NULL;
+		max = 0;
+
+		/* Unlocked read, just picks a candidate */
+		for (i = 0; i < job->threads; i++) {
+			unsigned int left = job->ranges[i].last - job->ranges[i].first;
+
+			if (i != self && job->ranges[i].first < job->ranges[i].last &&
+			    left > max) {
+				victim = &job->ranges[i];
+				max = left;
+			}
+		}
+
+		if (!victim)
+			return 0;
+
+		pthread_mutex_lock(&victim->lock);
+
+		if (victim->first >= victim->last) {
+			pthread_mutex_unlock(&victim->lock);
+			continue;
+		}
+
+		last = victim->last;
+		first = last - (last - victim->first + 1) / 2;
+		victim->last = first;
+
+		pthread_mutex_unlock(&victim->lock);
+
+		pthread_mutex_lock(&own->lock);
+		own->first = first;
+		own->last = last;
+		pthread_mutex_unlock(&own->lock);
+
+		return 1;
+	}
+}
+
+static void job_fail(struct rows_job *job, int err)
+{
+	pthread_mutex_lock(&job->lock);
+	if (!job->err)
+		job->err = err;
+	job->abort = 1;
+	pthread_mutex_unlock(&job->lock);
+}
+
+static void run_bands(struct rows_job *job, unsigned int self)
+{
+	struct rows_range *own = &job->ranges[self];
+	unsigned int band;
+
+	for (;;) {
+		gp_coord y;
+		gp_size h, done;
+		int abort;
+
+		if (!take_band(own, &band)) {
+			if (!steal_bands(job, self))
+				return;
+			continue;
+		}
+
+		y = band * job->band_h;
+		h = GP_MIN(job->band_h, job->h - y);
+
+		if (job->fn(job->priv, y, h)) {
+			job_fail(job, errno ? errno : EINVAL);
+			return;
+		}
+
+		pthread_mutex_lock(&job->lock);
+		job->rows_done += h;
+		done = job->rows_done;
+		abort = job->abort;
+		pthread_mutex_unlock(&job->lock);
+
+		if (abort)
+			return;
+
+		if (!job->cb_priv.orig_callback)
+			continue;
+
+		GP_PROGRESS_CALLBACK(cb, gp_progress_cb_mp, &job->cb_priv);
+
+		cb.percentage = 100.00 * done / job->h;
+
+		if (gp_progress_cb_mp(&cb)) {
+			job_fail(job, ECANCELED);
+			return;
+		}
+	}
+}
+
+static void *pool_worker_main(void *arg)
+{
+	struct pool_worker *self = arg;
+	struct rows_job *job;
+
+	in_pool_worker = 1;
+
+	pthread_mutex_lock(&pool.lock);
+
+	for (;;) {
+		while (self->gen == pool.gen)
+			pthread_cond_wait(&pool.wake, &pool.lock);
+
+		self->gen = pool.gen;
+		job = pool.job;
+
+		if (!job || self->id + 1 >= job->threads)
+			continue;
+
+		job->active++;
+		pthread_mutex_unlock(&pool.lock);
+
+		run_bands(job, self->id + 1);
+
+		pthread_mutex_lock(&pool.lock);
+		if (!--job->active)
+			pthread_cond_signal(&pool.done);
+	}
+
+	return NULL;
+}
+
+/*
+ * Makes sure that there are at least nr workers in the pool.
+ *
+ * Must be called with the pool lock held, returns number of workers available.
+ */
+static unsigned int pool_grow(unsigned int nr)
+{
+	while (pool.nr_workers < nr) {
+		struct pool_worker *w = malloc(sizeof(*w));
+
+		if (!w) {
+			GP_WARN("Malloc failed :(");
+			break;
+		}
+
+		w->id = pool.nr_workers;
+		w->gen = pool.gen;
+
+		if (pthread_create(&w->thread, NULL, pool_worker_main, w)) {
+			GP_WARN("Failed to create worker thread");
+			free(w);
+			break;
+		}
+
+		pthread_detach(w->thread);
+		pool.nr_workers++;
+
+		GP_DEBUG(1, "Thread pool has %u workers", pool.nr_workers);
+	}
+
+	return pool.nr_workers;
+}
+
+gp_size gp_threads_band_rows(gp_size h, unsigned int threads,
+                             gp_size bytes_per_row, unsigned int kern_size,
+                             unsigned int ctx_rows)
+{
+	gp_size band_h, min_h;
+
+	/* Split the job so that there is enough bands for stealing */
+	band_h = (h + GP_THREADS_BANDS * threads - 1) / (GP_THREADS_BANDS * threads);
+
+	if (bytes_per_row) {
+		gp_size cost = bytes_per_row * GP_MAX(kern_size, 1u);
+
+		/* Keep band working set in cache */
+		band_h = GP_MIN(band_h, GP_THREADS_BAND_BYTES / bytes_per_row);
+
+		/* But do enough work to amortize band overhead */
+		min_h = (GP_THREADS_BAND_MIN_COST + cost - 1) / cost;
+		band_h = GP_MAX(band_h, min_h);
+	}
+
+	/* Vertical kernels read ctx_rows - 1 rows of context for each band */
+	band_h = GP_MAX(band_h, ctx_rows);
+
+	return GP_MAX(band_h, 1u);
+}
+
+int gp_threads_rows_ex(gp_size h, unsigned int threads, gp_size band_h,
+                       gp_threads_rows_fn fn, void *priv,
+                       gp_progress_cb *callback)
+{
+	struct rows_job job = {
+		.fn = fn,
+		.priv = priv,
+		.lock = PTHREAD_MUTEX_INITIALIZER,
+		.h = h,
+		.threads = 1,
+		.cb_priv = {
+			.mutex = PTHREAD_MUTEX_INITIALIZER,
+			.orig_callback = callback,
+		},
+	};
+	unsigned int i, bands;
+	int pooled = 0;
+
+	if (threads > 1 && !in_pool_worker && !pthread_mutex_trylock(&pool_run_lock))
+		pooled = 1;
+
+	if (pooled) {
+		pthread_mutex_lock(&pool.lock);
+		job.threads = GP_MIN(threads, pool_grow(threads - 1) + 1);
+		pthread_mutex_unlock(&pool.lock);
+	}
+
+	if (!band_h)
+		band_h = gp_threads_band_rows(h, job.threads, 0, 1, 1);
+
+	job.band_h = band_h;
+	bands = (h + band_h - 1) / band_h;
+	job.threads = GP_MAX(1u, GP_MIN(job.threads, bands));
+
+	struct rows_range ranges[job.threads];
+
+	for (i = 0; i < job.threads; i++) {
+		pthread_mutex_init(&ranges[i].lock, NULL);
+		ranges[i].first = (unsigned long)bands * i / job.threads;
+		ranges[i].last = (unsigned long)bands * (i + 1) / job.threads;
+	}
+
+	job.ranges = ranges;
+
+	GP_DEBUG(2, "Running %u rows in %u bands of %u rows in %u threads",
+	         h, bands, band_h, job.threads);
+
+	if (job.threads > 1) {
+		pthread_mutex_lock(&pool.lock);
+		pool.job = &job;
+		pool.gen++;
+		pthread_cond_broadcast(&pool.wake);
+		pthread_mutex_unlock(&pool.lock);
+	}
+
+	run_bands(&job, 0);
+
+	if (job.threads > 1) {
+		pthread_mutex_lock(&pool.lock);
+		pool.job = NULL;
+		while (job.active)
+			pthread_cond_wait(&pool.done, &pool.lock);
+		pthread_mutex_unlock(&pool.lock);
+	}
+
+	if (pooled)
+		pthread_mutex_unlock(&pool_run_lock);
+
+	for (i = 0; i < job.threads; i++)
+		pthread_mutex_destroy(&ranges[i].lock);
+
+	if (job.err) {
+		errno = job.err;
+		return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+int gp_threads_rows(gp_size h, unsigned int threads,
+                    gp_threads_rows_fn fn, void *priv,
+                    gp_progress_cb *callback)
+{
+	return gp_threads_rows_ex(h, threads, 0, fn, priv, callback);
+}
+
+int gp_threads_slots_alloc(gp_threads_slots *self, unsigned int nr,
+                           size_t size)
+{
+	void *slots;
+	uint8_t *busy;
+
+	if (nr <= self->nr && size <= self->size)
+		return 0;
+
+	nr = GP_MAX(nr, self->nr);
+	size = GP_MAX(size, self->size);
+
+	slots = calloc(nr, size);
+	busy = calloc(nr, 1);
+
+	if (!slots || !busy) {
+		free(slots);
+		free(busy);
+		errno = ENOMEM;
+		return 1;
+	}
+
+	gp_threads_slots_free(self);
+
+	self->nr = nr;
+	self->size = size;
+	self->slots = slots;
+	self->busy = busy;
+
+	return 0;
+}
+
+void gp_threads_slots_free(gp_threads_slots *self)
+{
+	free(self->slots);
+	free(self->busy);
+
+	self->nr = 0;
+	self->size = 0;
+	self->slots = NULL;
+	self->busy = NULL;
+}
+
+void *gp_threads_slot_get(gp_threads_slots *self, unsigned int *slot)
+{
+	unsigned int i;
+
+	for (i = 0; i < self->nr; i++) {
+		if (!__atomic_exchange_n(&self->busy[i], 1, __ATOMIC_ACQUIRE)) {
+			*slot = i;
+			return gp_threads_slot(self, i);
+		}
+	}
+
+	GP_BUG("No free slot, %u slots allocated", self->nr);
+	errno = EINVAL;
+	return NULL;
+}
+
+void gp_threads_slot_put(gp_threads_slots *self, unsigned int slot)
+{
+	__atomic_store_n(&self->busy[slot], 0, __ATOMIC_RELEASE);
+}
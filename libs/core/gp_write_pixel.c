@@ -9,6 +9,11 @@
 #include <string.h>
 #include <core/gp_get_set_bits.h>
 #include <core/gp_write_pixel.h>
+#include <core/gp_cpu.h>
+
+#ifdef GP_CPU_X86
+# include <immintrin.h>
+#endif
 
 static const uint8_t bytes_1BPP[] = {0x00, 0xff};
 
@@ -328,7 +333,7 @@ void gp_write_pixels_8BPP(void *start, size_t count, unsigned int value)
 	memset(start, value, count);
 }
 
-void gp_write_pixels_16BPP(void *start, size_t count, unsigned int value)
+static void write_pixels_16BPP_c(void *start, size_t count, unsigned int value)
 {
 	uint16_t *p = (uint16_t *) start;
 	size_t i;
@@ -476,7 +481,7 @@ void gp_write_pixels_24BPP(void *start, size_t count, unsigned int value)
 	}
 }
 
-void gp_write_pixels_32BPP(void *start, size_t count, unsigned int value)
+static void write_pixels_32BPP_c(void *start, size_t count, unsigned int value)
 {
 	/*
 	 * Inspired by GNU libc's wmemset() (by Ulrich Drepper, licensed under LGPL).
@@ -507,3 +512,86 @@ void gp_write_pixels_32BPP(void *start, size_t count, unsigned int value)
 		}
 	}
 }
+
+typedef void (*write_pixels_fn)(void *start, size_t count, unsigned int value);
+
+#ifdef GP_CPU_X86
+
+__attribute__((target("sse2")))
+static void write_pixels_16BPP_sse2(void *start, size_t count, unsigned int value)
+{
+	__m128i *p = start;
+	__m128i v = _mm_set1_epi16(value);
+
+	for (; count >= 8; count -= 8)
+		_mm_storeu_si128(p++, v);
+
+	write_pixels_16BPP_c(p, count, value);
+}
+
+__attribute__((target("avx2")))
+static void write_pixels_16BPP_avx2(void *start, size_t count, unsigned int value)
+{
+	__m256i *p = start;
+	__m256i v = _mm256_set1_epi16(value);
+
+	for (; count >= 16; count -= 16)
+		_mm256_storeu_si256(p++, v);
+
+	write_pixels_16BPP_c(p, count, value);
+}
+
+__attribute__((target("sse2")))
+static void write_pixels_32BPP_sse2(void *start, size_t count, unsigned int value)
+{
+	__m128i *p = start;
+	__m128i v = _mm_set1_epi32(value);
+
+	for (; count >= 4; count -= 4)
+		_mm_storeu_si128(p++, v);
+
+	write_pixels_32BPP_c(p, count, value);
+}
+
+__attribute__((target("avx2")))
+static void write_pixels_32BPP_avx2(void *start, size_t count, unsigned int value)
+{
+	__m256i *p = start;
+	__m256i v = _mm256_set1_epi32(value);
+
+	for (; count >= 8; count -= 8)
+		_mm256_storeu_si256(p++, v);
+
+	write_pixels_32BPP_c(p, count, value);
+}
+
+#endif /* GP_CPU_X86 */
+
+static const gp_cpu_impl write_pixels_16BPP_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, write_pixels_16BPP_avx2},
+	{GP_CPU_SSE2, write_pixels_16BPP_sse2},
+#endif
+	{0, write_pixels_16BPP_c},
+};
+
+static const gp_cpu_impl write_pixels_32BPP_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, write_pixels_32BPP_avx2},
+	{GP_CPU_SSE2, write_pixels_32BPP_sse2},
+#endif
+	{0, write_pixels_32BPP_c},
+};
+
+GP_CPU_DISPATCH(write_pixels_16BPP, write_pixels_fn, write_pixels_16BPP_impls);
+GP_CPU_DISPATCH(write_pixels_32BPP, write_pixels_fn, write_pixels_32BPP_impls);
+
+void gp_write_pixels_16BPP(void *start, size_t count, unsigned int value)
+{
+	write_pixels_16BPP()(start, count, value);
+}
+
+void gp_write_pixels_32BPP(void *start, size_t count, unsigned int value)
+{
+	write_pixels_32BPP()(start, count, value);
+}
@@ -1,7 +1,12 @@
+@ include thread_dispatcher.t
+@
 @ def filter_arithmetic(name, filter_op, opts='', params=''):
+#include <errno.h>
+
 #include <core/gp_pixmap.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 #include <filters/gp_filter.h>
 #include <filters/gp_arithmetic.h>
@@ -9,14 +14,14 @@
 @     for pt in pixeltypes:
 @         if not pt.is_unknown():
 static int filter_{{ name }}_{{ pt.name }}(const gp_pixmap *src_a, const gp_pixmap *src_b,
-	gp_pixmap *dst, {{ maybe_opts_r(opts) }}gp_progress_cb *callback)
+	gp_pixmap *dst, {{ maybe_opts_r(opts) }}gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
 {
-	uint32_t x, y, w, h;
+	uint32_t x, y, w;
 
 	w = GP_MIN(src_a->w, src_b->w);
-	h = GP_MIN(src_a->h, src_b->h);
 
-	for (y = 0; y < h; y++) {
+	for (y = y_src; y < y_src + h_src; y++) {
 		for (x = 0; x < w; x++) {
 			gp_pixel pix_a = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src_a, x, y);
 			gp_pixel pix_b = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src_b, x, y);
@@ -37,7 +42,7 @@ static int filter_{{ name }}_{{ pt.name }}(const gp_pixmap *src_a, const gp_pixm
 			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y, pix);
 		}
 
-		if (gp_progress_cb_report(callback, y, h, w))
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
 			return 1;
 	}
 
@@ -47,24 +52,45 @@ static int filter_{{ name }}_{{ pt.name }}(const gp_pixmap *src_a, const gp_pixm
 
 @     end
 @
-int gp_filter_{{ name }}_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
-	gp_pixmap *dst{{ maybe_opts_l(opts) }}, gp_progress_cb *callback)
+static int filter_{{ name }}(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, {{ maybe_opts_r(opts) }}gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
 {
-	GP_DEBUG(1, "Running filter {{ name }}");
-
 	switch (src_a->pixel_type) {
 @     for pt in pixeltypes:
 @         if not pt.is_unknown():
 	case GP_PIXEL_{{ pt.name }}:
-		return filter_{{ name }}_{{ pt.name }}(src_a, src_b, dst{{ maybe_opts_l(params) }}, callback);
+		return filter_{{ name }}_{{ pt.name }}(src_a, src_b, dst{{ maybe_opts_l(params) }},
+		                                      y_src, h_src, callback);
 @     end
 	default:
 	break;
 	}
 
+	errno = EINVAL;
 	return 1;
 }
 
+@     fn_params = [('const gp_pixmap *', 'src_a'), ('const gp_pixmap *', 'src_b'),
+@                  ('gp_pixmap *', 'dst')]
+@     if opts:
+@         for opt in opts.split(','):
+@             fn_params.append(tuple(opt.strip().rsplit(' ', 1)))
+@     end
+@     fn_params += [('gp_coord', 'y_src'), ('gp_size', 'h_src'),
+@                   ('gp_progress_cb *', 'callback')]
+{@ dispatcher('filter_' + name, fn_params, 'GP_MIN(src_a->w, src_b->w)', 'h_src', 'GP_CALC_ROW_SIZE(src_a->pixel_type, GP_MIN(src_a->w, src_b->w))') @}
+
+int gp_filter_{{ name }}_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst{{ maybe_opts_l(opts) }}, gp_progress_cb *callback)
+{
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	GP_DEBUG(1, "Running filter {{ name }}");
+
+	return filter_{{ name }}_mp(src_a, src_b, dst{{ maybe_opts_l(params) }}, 0, h, callback);
+}
+
 int gp_filter_{{ name }}(const gp_pixmap *src_a, const gp_pixmap *src_b,
                          gp_pixmap *dst{{ maybe_opts_l(opts) }},
                          gp_progress_cb *callback)
@@ -0,0 +1,960 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_add.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:14 from gp_add.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Addition of two bitmaps.
+ *
+ * Copyright (C) 2012-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_clamp.h>
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_arithmetic.h>
+
+static int filter_add_xRGB8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_xRGB8888(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_xRGB8888(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_xRGB8888(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_xRGB8888(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_xRGB8888(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_xRGB8888(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_xRGB8888(R, G, B);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGBA8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGBA8888(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGBA8888(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGBA8888(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGBA8888(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGBA8888(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGBA8888(pix_b);
+			int32_t A_A = GP_PIXEL_GET_A_RGBA8888(pix_a);
+			int32_t A_B = GP_PIXEL_GET_A_RGBA8888(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGBA8888(R, G, B, A);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_24BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_24BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB888(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGB888(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGB888(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGB888(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGB888(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGB888(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB888(R, G, B);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_BGR888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_24BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_24BPP(src_b, x, y);
+
+			int32_t B_A = GP_PIXEL_GET_B_BGR888(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_BGR888(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_BGR888(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_BGR888(pix_b);
+			int32_t R_A = GP_PIXEL_GET_R_BGR888(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_BGR888(pix_b);
+
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_BGR888(B, G, R);
+
+			gp_putpixel_raw_24BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB555(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB555(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGB555(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGB555(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGB555(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGB555(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGB555(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 31);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 31);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 31);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB555(R, G, B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB565(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB565(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGB565(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGB565(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGB565(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGB565(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGB565(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 31);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 63);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 31);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB565(R, G, B);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB666(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_18BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_18BPP_LE(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB666(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGB666(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGB666(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGB666(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGB666(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGB666(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 63);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 63);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 63);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB666(R, G, B);
+
+			gp_putpixel_raw_18BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGB332(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_8BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_8BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGB332(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGB332(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGB332(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGB332(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGB332(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGB332(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 7);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 7);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 3);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGB332(R, G, B);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_CMYK8888(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t K_A = GP_PIXEL_GET_K_CMYK8888(pix_a);
+			int32_t K_B = GP_PIXEL_GET_K_CMYK8888(pix_b);
+			int32_t Y_A = GP_PIXEL_GET_Y_CMYK8888(pix_a);
+			int32_t Y_B = GP_PIXEL_GET_Y_CMYK8888(pix_b);
+			int32_t M_A = GP_PIXEL_GET_M_CMYK8888(pix_a);
+			int32_t M_B = GP_PIXEL_GET_M_CMYK8888(pix_b);
+			int32_t C_A = GP_PIXEL_GET_C_CMYK8888(pix_a);
+			int32_t C_B = GP_PIXEL_GET_C_CMYK8888(pix_b);
+
+			int32_t K;
+			K = K_A + K_B;
+			GP_CLAMP_GENERIC(K, 0, 255);
+			int32_t Y;
+			Y = Y_A + Y_B;
+			GP_CLAMP_GENERIC(Y, 0, 255);
+			int32_t M;
+			M = M_A + M_B;
+			GP_CLAMP_GENERIC(M, 0, 255);
+			int32_t C;
+			C = C_A + C_B;
+			GP_CLAMP_GENERIC(C, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_CMYK8888(K, Y, M, C);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P2(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_2BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_2BPP_LE(src_b, x, y);
+
+			int32_t P_A = GP_PIXEL_GET_P_P2(pix_a);
+			int32_t P_B = GP_PIXEL_GET_P_P2(pix_b);
+
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 3);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_P2(P);
+
+			gp_putpixel_raw_2BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P4(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_4BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_4BPP_LE(src_b, x, y);
+
+			int32_t P_A = GP_PIXEL_GET_P_P4(pix_a);
+			int32_t P_B = GP_PIXEL_GET_P_P4(pix_b);
+
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 15);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_P4(P);
+
+			gp_putpixel_raw_4BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_P8(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_8BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_8BPP(src_b, x, y);
+
+			int32_t P_A = GP_PIXEL_GET_P_P8(pix_a);
+			int32_t P_B = GP_PIXEL_GET_P_P8(pix_b);
+
+			int32_t P;
+			P = P_A + P_B;
+			GP_CLAMP_GENERIC(P, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_P8(P);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G1(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_1BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_1BPP_LE(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G1(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_G1(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 1);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G1(V);
+
+			gp_putpixel_raw_1BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G2(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_2BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_2BPP_LE(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G2(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_G2(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 3);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G2(V);
+
+			gp_putpixel_raw_2BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G4(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_4BPP_LE(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_4BPP_LE(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G4(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_G4(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 15);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G4(V);
+
+			gp_putpixel_raw_4BPP_LE(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G8(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_8BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_8BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G8(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_G8(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G8(V);
+
+			gp_putpixel_raw_8BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_GA88(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_GA88(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_GA88(pix_b);
+			int32_t A_A = GP_PIXEL_GET_A_GA88(pix_a);
+			int32_t A_B = GP_PIXEL_GET_A_GA88(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 255);
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_GA88(V, A);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_G16(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_16BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_16BPP(src_b, x, y);
+
+			int32_t V_A = GP_PIXEL_GET_V_G16(pix_a);
+			int32_t V_B = GP_PIXEL_GET_V_G16(pix_b);
+
+			int32_t V;
+			V = V_A + V_B;
+			GP_CLAMP_GENERIC(V, 0, 65535);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_G16(V);
+
+			gp_putpixel_raw_16BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add_RGBA8888_PM(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	uint32_t x, y, w;
+
+	w = GP_MIN(src_a->w, src_b->w);
+
+	for (y = y_src; y < y_src + h_src; y++) {
+		for (x = 0; x < w; x++) {
+			gp_pixel pix_a = gp_getpixel_raw_32BPP(src_a, x, y);
+			gp_pixel pix_b = gp_getpixel_raw_32BPP(src_b, x, y);
+
+			int32_t R_A = GP_PIXEL_GET_R_RGBA8888_PM(pix_a);
+			int32_t R_B = GP_PIXEL_GET_R_RGBA8888_PM(pix_b);
+			int32_t G_A = GP_PIXEL_GET_G_RGBA8888_PM(pix_a);
+			int32_t G_B = GP_PIXEL_GET_G_RGBA8888_PM(pix_b);
+			int32_t B_A = GP_PIXEL_GET_B_RGBA8888_PM(pix_a);
+			int32_t B_B = GP_PIXEL_GET_B_RGBA8888_PM(pix_b);
+			int32_t A_A = GP_PIXEL_GET_A_RGBA8888_PM(pix_a);
+			int32_t A_B = GP_PIXEL_GET_A_RGBA8888_PM(pix_b);
+
+			int32_t R;
+			R = R_A + R_B;
+			GP_CLAMP_GENERIC(R, 0, 255);
+			int32_t G;
+			G = G_A + G_B;
+			GP_CLAMP_GENERIC(G, 0, 255);
+			int32_t B;
+			B = B_A + B_B;
+			GP_CLAMP_GENERIC(B, 0, 255);
+			int32_t A;
+			A = A_A + A_B;
+			GP_CLAMP_GENERIC(A, 0, 255);
+
+			gp_pixel pix;
+			pix = GP_PIXEL_CREATE_RGBA8888_PM(R, G, B, A);
+
+			gp_putpixel_raw_32BPP(dst, x, y, pix);
+		}
+
+		if (gp_progress_cb_report(callback, y - y_src, h_src, w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int filter_add(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_coord y_src, gp_size h_src,
+	gp_progress_cb *callback)
+{
+	switch (src_a->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return filter_add_xRGB8888(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGBA8888:
+		return filter_add_RGBA8888(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGB888:
+		return filter_add_RGB888(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_BGR888:
+		return filter_add_BGR888(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGB555:
+		return filter_add_RGB555(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGB565:
+		return filter_add_RGB565(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGB666:
+		return filter_add_RGB666(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGB332:
+		return filter_add_RGB332(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_CMYK8888:
+		return filter_add_CMYK8888(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_P2:
+		return filter_add_P2(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_P4:
+		return filter_add_P4(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_P8:
+		return filter_add_P8(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_G1:
+		return filter_add_G1(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_G2:
+		return filter_add_G2(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_G4:
+		return filter_add_G4(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_G8:
+		return filter_add_G8(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_GA88:
+		return filter_add_GA88(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_G16:
+		return filter_add_G16(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	case GP_PIXEL_RGBA8888_PM:
+		return filter_add_RGBA8888_PM(src_a, src_b, dst,
+		                                      y_src, h_src, callback);
+	default:
+	break;
+	}
+
+	errno = EINVAL;
+	return 1;
+}
+
+struct filter_add_rows {
+	const gp_pixmap *src_a;
+	const gp_pixmap *src_b;
+	gp_pixmap *dst;
+	gp_coord y_src;
+	gp_size h_src;
+};
+
+static int filter_add_rows(void *priv, gp_coord y, gp_size h)
+{
+	const struct filter_add_rows *rows = priv;
+
+	return filter_add(rows->src_a, rows->src_b, rows->dst, rows->y_src + y, h, NULL);
+}
+
+static int filter_add_mp(const gp_pixmap *src_a,
+                         const gp_pixmap *src_b,
+                         gp_pixmap *dst,
+                         gp_coord y_src,
+                         gp_size h_src,
+                         gp_progress_cb *callback)
+{
+	unsigned int t = gp_nr_threads(GP_MIN(src_a->w, src_b->w), h_src, callback);
+	gp_size band_h;
+
+	if (t == 1)
+		return filter_add(src_a, src_b, dst, y_src, h_src, callback);
+
+	struct filter_add_rows rows = {
+		.src_a = src_a,
+		.src_b = src_b,
+		.dst = dst,
+		.y_src = y_src,
+		.h_src = h_src,
+	};
+
+	band_h = gp_threads_band_rows(h_src, t, GP_CALC_ROW_SIZE(src_a->pixel_type, GP_MIN(src_a->w, src_b->w)), 1, 1);
+
+	return gp_threads_rows_ex(h_src, t, band_h, filter_add_rows, &rows, callback);
+}
+
+int gp_filter_add_raw(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	GP_DEBUG(1, "Running filter add");
+
+	return filter_add_mp(src_a, src_b, dst, 0, h, callback);
+}
+
+int gp_filter_add(const gp_pixmap *src_a, const gp_pixmap *src_b,
+                         gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	GP_ASSERT(src_a->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(w <= dst->w && h <= dst->h,
+	          "Destination is not big enough");
+
+	if (gp_filter_add_raw(src_a, src_b, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+
+gp_pixmap *gp_filter_add_alloc(const gp_pixmap *src_a, const gp_pixmap *src_b,
+	                              gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	GP_ASSERT(src_a->pixel_type == src_b->pixel_type,
+	          "Pixel types for sources must match.");
+
+	gp_size w = GP_MIN(src_a->w, src_b->w);
+	gp_size h = GP_MIN(src_a->h, src_b->h);
+
+	res = gp_pixmap_alloc(w, h, src_a->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_add_raw(src_a, src_b, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+
+		gp_pixmap_free(res);
+
+		return NULL;
+	}
+
+	return res;
+}
@@ -10,9 +10,12 @@
 #include <core/gp_pixmap.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_debug.h>
+#include <core/gp_threads.h>
 
 #include <filters/gp_apply_tables.h>
 
+@ include thread_dispatcher.t
+
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
@@ -23,8 +26,6 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
                                       const gp_filter_tables *const tables,
                                       gp_progress_cb *callback)
 {
-	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
-
 	unsigned int x, y;
 
 @         for c in pt.chanslist:
@@ -62,17 +63,14 @@ static int apply_tables_{{ pt.name }}(const gp_pixmap *const src,
 
 @ end
 @
-int gp_filter_tables_apply(const gp_pixmap *const src,
-                           gp_coord x_src, gp_coord y_src,
-                           gp_size w_src, gp_size h_src,
-                           gp_pixmap *dst,
-                           gp_coord x_dst, gp_coord y_dst,
-                           const gp_filter_tables *const tables,
-                           gp_progress_cb *callback)
+static int apply_tables_raw(const gp_pixmap *const src,
+                            gp_coord x_src, gp_coord y_src,
+                            gp_size w_src, gp_size h_src,
+                            gp_pixmap *dst,
+                            gp_coord x_dst, gp_coord y_dst,
+                            const gp_filter_tables *const tables,
+                            gp_progress_cb *callback)
 {
-	GP_ASSERT(src->pixel_type == dst->pixel_type);
-	//TODO: Assert size
-
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
@@ -88,3 +86,29 @@ int gp_filter_tables_apply(const gp_pixmap *const src,
 		return -1;
 	}
 }
+
+@ params = [('const gp_pixmap *', 'src'),
+@           ('gp_coord', 'x_src'), ('gp_coord', 'y_src'),
+@           ('gp_size', 'w_src'), ('gp_size', 'h_src'),
+@           ('gp_pixmap *', 'dst'),
+@           ('gp_coord', 'x_dst'), ('gp_coord', 'y_dst'),
+@           ('const gp_filter_tables *', 'tables'),
+@           ('gp_progress_cb *', 'callback')]
+{@ dispatcher('apply_tables_raw', params, 'w_src', 'h_src', 'GP_CALC_ROW_SIZE(src->pixel_type, w_src)') @}
+
+int gp_filter_tables_apply(const gp_pixmap *const src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_filter_tables *const tables,
+                           gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type);
+	//TODO: Assert size
+
+	GP_DEBUG(1, "Point filter %ux%u", w_src, h_src);
+
+	return apply_tables_raw_mp(src, x_src, y_src, w_src, h_src,
+	                           dst, x_dst, y_dst, tables, callback);
+}
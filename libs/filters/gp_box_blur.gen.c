@@ -0,0 +1,563 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_box_blur.gen.c
+ *
+ * GENERATED on 2026 10 18 07:49:42 from gp_box_blur.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Box blur using summed area tables
+ *
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_sat.h>
+#include <filters/gp_blur.h>
+
+struct box_blur_job {
+	const gp_sat *sat;
+	gp_size w_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xrad, yrad;
+};
+
+static int box_blur_xRGB8888(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_32BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_xRGB8888(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGBA8888(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel A = (gp_sat_sum(sat, 3, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_32BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGBA8888(R, G, B, A));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGB888(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_24BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGB888(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_BGR888(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel B = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel R = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_24BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_BGR888(B, G, R));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGB555(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_16BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGB555(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGB565(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_16BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGB565(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGB666(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_18BPP_LE(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGB666(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGB332(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_8BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGB332(R, G, B));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_CMYK8888(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel K = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel Y = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel M = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel C = (gp_sat_sum(sat, 3, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_32BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_CMYK8888(K, Y, M, C));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_G1(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_1BPP_LE(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_G1(V));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_G2(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_2BPP_LE(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_G2(V));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_G4(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_4BPP_LE(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_G4(V));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_G8(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_8BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_G8(V));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_GA88(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel A = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_16BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_GA88(V, A));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_G16(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel V = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_16BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_G16(V));
+		}
+	}
+
+	return 0;
+}
+
+static int box_blur_RGBA8888_PM(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+			gp_pixel R = (gp_sat_sum(sat, 0, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel G = (gp_sat_sum(sat, 1, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel B = (gp_sat_sum(sat, 2, x0, y0, x1, y1) + area/2) / area;
+			gp_pixel A = (gp_sat_sum(sat, 3, x0, y0, x1, y1) + area/2) / area;
+
+			gp_putpixel_raw_32BPP(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_RGBA8888_PM(R, G, B, A));
+		}
+	}
+
+	return 0;
+}
+
+static gp_threads_rows_fn box_blur_fn(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return box_blur_xRGB8888;
+	case GP_PIXEL_RGBA8888:
+		return box_blur_RGBA8888;
+	case GP_PIXEL_RGB888:
+		return box_blur_RGB888;
+	case GP_PIXEL_BGR888:
+		return box_blur_BGR888;
+	case GP_PIXEL_RGB555:
+		return box_blur_RGB555;
+	case GP_PIXEL_RGB565:
+		return box_blur_RGB565;
+	case GP_PIXEL_RGB666:
+		return box_blur_RGB666;
+	case GP_PIXEL_RGB332:
+		return box_blur_RGB332;
+	case GP_PIXEL_CMYK8888:
+		return box_blur_CMYK8888;
+	case GP_PIXEL_G1:
+		return box_blur_G1;
+	case GP_PIXEL_G2:
+		return box_blur_G2;
+	case GP_PIXEL_G4:
+		return box_blur_G4;
+	case GP_PIXEL_G8:
+		return box_blur_G8;
+	case GP_PIXEL_GA88:
+		return box_blur_GA88;
+	case GP_PIXEL_G16:
+		return box_blur_G16;
+	case GP_PIXEL_RGBA8888_PM:
+		return box_blur_RGBA8888_PM;
+	default:
+		return NULL;
+	}
+}
+
+static int box_blur_raw(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        unsigned int xrad, unsigned int yrad,
+                        gp_progress_cb *callback)
+{
+	gp_threads_rows_fn fn = box_blur_fn(src->pixel_type);
+	unsigned int t;
+	gp_sat *sat;
+	int ret;
+
+	if (!fn) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	GP_DEBUG(1, "Box blur %ux%u xrad=%u yrad=%u", w_src, h_src, xrad, yrad);
+
+	/* The whole table is built first so the filter works in-place */
+	sat = gp_sat_alloc_ex(src, x_src, y_src, w_src, h_src, xrad, yrad, 0, NULL);
+	if (!sat)
+		return 1;
+
+	struct box_blur_job job = {
+		.sat = sat,
+		.w_src = w_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+		.xrad = xrad,
+		.yrad = yrad,
+	};
+
+	t = gp_nr_threads(w_src, h_src, callback);
+
+	ret = gp_threads_rows(h_src, t, fn, &job, callback);
+
+	gp_sat_free(sat);
+
+	return ret;
+}
+
+int gp_filter_box_blur_ex(const gp_pixmap *src,
+                          gp_coord x_src, gp_coord y_src,
+                          gp_size w_src, gp_size h_src,
+                          gp_pixmap *dst,
+                          gp_coord x_dst, gp_coord y_dst,
+                          unsigned int xrad, unsigned int yrad,
+                          gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	return box_blur_raw(src, x_src, y_src, w_src, h_src,
+	                    dst, x_dst, y_dst, xrad, yrad, callback);
+}
+
+gp_pixmap *gp_filter_box_blur_ex_alloc(const gp_pixmap *src,
+                                       gp_coord x_src, gp_coord y_src,
+                                       gp_size w_src, gp_size h_src,
+                                       unsigned int xrad, unsigned int yrad,
+                                       gp_progress_cb *callback)
+{
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	if (box_blur_raw(src, x_src, y_src, w_src, h_src, dst,
+	                 0, 0, xrad, yrad, callback)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		errno = err;
+		return NULL;
+	}
+
+	return dst;
+}
@@ -0,0 +1,151 @@
+@ include source.t
+/*
+ * Box blur using summed area tables
+ *
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_sat.h>
+#include <filters/gp_blur.h>
+
+struct box_blur_job {
+	const gp_sat *sat;
+	gp_size w_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xrad, yrad;
+};
+
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+static int box_blur_{{ pt.name }}(void *priv, gp_coord y, gp_size h)
+{
+	const struct box_blur_job *job = priv;
+	const gp_sat *sat = job->sat;
+	uint64_t area = (2 * (uint64_t)job->xrad + 1) *
+	                (2 * (uint64_t)job->yrad + 1);
+	gp_coord x, y_end = y + h;
+
+	for (; y < y_end; y++) {
+		gp_coord y0 = y - job->yrad, y1 = y + job->yrad + 1;
+
+		for (x = 0; x < (gp_coord)job->w_src; x++) {
+			gp_coord x0 = x - job->xrad, x1 = x + job->xrad + 1;
+
+@         for c in pt.chanslist:
+			gp_pixel {{ c.name }} = (gp_sat_sum(sat, {{ c.idx }}, x0, y0, x1, y1) + area/2) / area;
+@         end
+
+			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(job->dst, job->x_dst + x, job->y_dst + y,
+				GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names) }}));
+		}
+	}
+
+	return 0;
+}
+
+@ end
+@
+static gp_threads_rows_fn box_blur_fn(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		return box_blur_{{ pt.name }};
+@ end
+	default:
+		return NULL;
+	}
+}
+
+static int box_blur_raw(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        unsigned int xrad, unsigned int yrad,
+                        gp_progress_cb *callback)
+{
+	gp_threads_rows_fn fn = box_blur_fn(src->pixel_type);
+	unsigned int t;
+	gp_sat *sat;
+	int ret;
+
+	if (!fn) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	GP_DEBUG(1, "Box blur %ux%u xrad=%u yrad=%u", w_src, h_src, xrad, yrad);
+
+	/* The whole table is built first so the filter works in-place */
+	sat = gp_sat_alloc_ex(src, x_src, y_src, w_src, h_src, xrad, yrad, 0, NULL);
+	if (!sat)
+		return 1;
+
+	struct box_blur_job job = {
+		.sat = sat,
+		.w_src = w_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+		.xrad = xrad,
+		.yrad = yrad,
+	};
+
+	t = gp_nr_threads(w_src, h_src, callback);
+
+	ret = gp_threads_rows(h_src, t, fn, &job, callback);
+
+	gp_sat_free(sat);
+
+	return ret;
+}
+
+int gp_filter_box_blur_ex(const gp_pixmap *src,
+                          gp_coord x_src, gp_coord y_src,
+                          gp_size w_src, gp_size h_src,
+                          gp_pixmap *dst,
+                          gp_coord x_dst, gp_coord y_dst,
+                          unsigned int xrad, unsigned int yrad,
+                          gp_progress_cb *callback)
+{
+	GP_CHECK(src->pixel_type == dst->pixel_type);
+
+	/* Check that destination is large enough */
+	GP_CHECK(x_dst + (gp_coord)w_src <= (gp_coord)dst->w);
+	GP_CHECK(y_dst + (gp_coord)h_src <= (gp_coord)dst->h);
+
+	return box_blur_raw(src, x_src, y_src, w_src, h_src,
+	                    dst, x_dst, y_dst, xrad, yrad, callback);
+}
+
+gp_pixmap *gp_filter_box_blur_ex_alloc(const gp_pixmap *src,
+                                       gp_coord x_src, gp_coord y_src,
+                                       gp_size w_src, gp_size h_src,
+                                       unsigned int xrad, unsigned int yrad,
+                                       gp_progress_cb *callback)
+{
+	gp_pixmap *dst = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (dst == NULL)
+		return NULL;
+
+	if (box_blur_raw(src, x_src, y_src, w_src, h_src, dst,
+	                 0, 0, xrad, yrad, callback)) {
+		int err = errno;
+		gp_pixmap_free(dst);
+		errno = err;
+		return NULL;
+	}
+
+	return dst;
+}
@@ -0,0 +1,781 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Streaming filter pipeline.
+
+  Each stage produces its output in bands of rows. Stages that need rows
+  around the output rows, i.e. convolutions and resampling, keep a window of
+  input rows that slides down the image, the rows that are no longer needed
+  are dropped from the top of the window and the rows pushed by the previous
+  stage are appended at the bottom. The window is a contiguous pixmap so that
+  the existing filters can run on it unchanged, only the few context rows are
+  moved when the window slides.
+
+  The window starts at the first image row or ends at the last image row when
+  the kernel reaches out of the image, hence the filters clamp the coordinates
+  at the same rows as they would do for the whole image and the result is
+  exactly the same as if the filters were applied on full sized pixmaps.
+
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+
+#include <filters/gp_linear.h>
+#include <filters/gp_filter_pipe.h>
+
+#include "gp_floyd_steinberg.h"
+#include "gp_resize_sep.h"
+
+/* Output band size limit */
+#define BAND_BYTES (32 * 1024)
+#define BAND_MAX_ROWS 64
+
+/* Window size limit, the band is made smaller until the window fits */
+#define WINDOW_BYTES (256 * 1024)
+
+struct pipe_stage {
+	const char *name;
+
+	/*
+	 * Returns input rows [*y0, *y1) needed for output rows [y, y + h).
+	 *
+	 * NULL for stages that map input rows one to one to output rows and
+	 * run directly on the pushed rows.
+	 */
+	void (*in_rows)(struct pipe_stage *self, gp_coord y, gp_size h,
+	                gp_coord *y0, gp_coord *y1);
+
+	/*
+	 * Produces out->h output rows starting at image row out_y, the first
+	 * in row is image row in_y.
+	 *
+	 * Returns zero on success, non-zero and sets errno on failure.
+	 */
+	int (*run)(struct pipe_stage *self, const gp_pixmap *in, gp_coord in_y,
+	           gp_pixmap *out, gp_coord out_y);
+
+	/* Frees stage private data, may be NULL */
+	void (*free)(struct pipe_stage *self);
+
+	gp_size in_w;
+	gp_size in_h;
+	gp_pixel_type in_type;
+
+	gp_size out_w;
+	gp_size out_h;
+	gp_pixel_type out_type;
+
+	/* Output band */
+	gp_pixmap *out;
+	gp_size band;
+	gp_coord out_y;
+
+	/* Input rows [win_y, win_y + win_rows), NULL for one to one stages */
+	gp_pixmap *win;
+	gp_coord win_y;
+	gp_size win_rows;
+
+	gp_progress_cb *callback;
+
+	struct pipe_stage *next;
+
+	char priv[];
+};
+
+struct gp_filter_pipe {
+	gp_size w;
+	gp_size h;
+	gp_pixel_type pixel_type;
+
+	/* Output of the last stage */
+	gp_size out_w;
+	gp_size out_h;
+	gp_pixel_type out_type;
+
+	/* Number of image rows pushed so far */
+	gp_size pushed;
+
+	gp_filter_pipe_sink sink;
+	void *priv;
+
+	/* The stages run in the calling thread, the bands are too small */
+	gp_progress_cb callback;
+
+	struct pipe_stage *first;
+	struct pipe_stage *last;
+};
+
+static int no_progress(gp_progress_cb GP_UNUSED(*self))
+{
+	return 0;
+}
+
+gp_filter_pipe *gp_filter_pipe_create(gp_size w, gp_size h,
+                                      gp_pixel_type pixel_type,
+                                      gp_filter_pipe_sink sink, void *priv)
+{
+	gp_filter_pipe *self;
+
+	if (!w || !h || !sink || pixel_type == GP_PIXEL_UNKNOWN ||
+	    pixel_type >= GP_PIXEL_MAX) {
+		GP_WARN("Invalid pipeline %ux%u %s", w, h,
+		        gp_pixel_type_name(pixel_type));
+		errno = EINVAL;
+		return NULL;
+	}
+
+	self = calloc(1, sizeof(*self));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->w = self->out_w = w;
+	self->h = self->out_h = h;
+	self->pixel_type = self->out_type = pixel_type;
+	self->sink = sink;
+	self->priv = priv;
+	self->callback.callback = no_progress;
+	self->callback.threads = 1;
+
+	return self;
+}
+
+static size_t row_bytes(gp_size w, gp_pixel_type pixel_type)
+{
+	return GP_CALC_ROW_SIZE(pixel_type, (size_t)w);
+}
+
+static gp_size max_in_rows(struct pipe_stage *self, gp_size band)
+{
+	gp_size y, max = 0;
+
+	for (y = 0; y < self->out_h; y += band) {
+		gp_size h = GP_MIN(band, self->out_h - y);
+		gp_coord y0, y1;
+
+		self->in_rows(self, y, h, &y0, &y1);
+
+		max = GP_MAX(max, (gp_size)(y1 - y0));
+	}
+
+	return max;
+}
+
+static struct pipe_stage *stage_new(gp_filter_pipe *pipe, const char *name,
+                                    size_t priv_size)
+{
+	struct pipe_stage *self;
+
+	if (pipe->pushed) {
+		GP_WARN("Cannot add stage, rows were already pushed");
+		errno = EINVAL;
+		return NULL;
+	}
+
+	self = calloc(1, sizeof(*self) + priv_size);
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	self->name = name;
+	self->in_w = self->out_w = pipe->out_w;
+	self->in_h = self->out_h = pipe->out_h;
+	self->in_type = self->out_type = pipe->out_type;
+	self->callback = &pipe->callback;
+
+	return self;
+}
+
+static void stage_free(struct pipe_stage *self)
+{
+	if (self->free)
+		self->free(self);
+
+	gp_pixmap_free(self->win);
+	gp_pixmap_free(self->out);
+	free(self);
+}
+
+/*
+ * Allocates the buffers and appends the stage, the stage is freed on failure.
+ */
+static int stage_add(gp_filter_pipe *pipe, struct pipe_stage *self)
+{
+	size_t out_bytes = row_bytes(self->out_w, self->out_type);
+	size_t in_bytes = row_bytes(self->in_w, self->in_type);
+	gp_size band, win_rows = 0;
+
+	band = GP_MAX((size_t)1, BAND_BYTES / out_bytes);
+	band = GP_MIN(band, GP_MIN((gp_size)BAND_MAX_ROWS, self->out_h));
+
+	if (self->in_rows) {
+		win_rows = max_in_rows(self, band);
+
+		while (band > 1 && win_rows * in_bytes > WINDOW_BYTES) {
+			band /= 2;
+			win_rows = max_in_rows(self, band);
+		}
+
+		/* Space for at least one band of incoming rows */
+		win_rows += band;
+
+		self->win = gp_pixmap_alloc(self->in_w, win_rows, self->in_type);
+		if (!self->win)
+			goto err;
+	}
+
+	self->band = band;
+
+	self->out = gp_pixmap_alloc(self->out_w, band, self->out_type);
+	if (!self->out)
+		goto err;
+
+	GP_DEBUG(1, "Pipeline stage %s %ux%u %s -> %ux%u %s band %u window %u",
+	         self->name, self->in_w, self->in_h,
+	         gp_pixel_type_name(self->in_type), self->out_w, self->out_h,
+	         gp_pixel_type_name(self->out_type), band, win_rows);
+
+	if (pipe->last)
+		pipe->last->next = self;
+	else
+		pipe->first = self;
+
+	pipe->last = self;
+
+	pipe->out_w = self->out_w;
+	pipe->out_h = self->out_h;
+	pipe->out_type = self->out_type;
+
+	return 0;
+err:
+	stage_free(self);
+	return 1;
+}
+
+/*
+ * Removes and frees the last stage.
+ */
+static void stage_pop(gp_filter_pipe *pipe)
+{
+	struct pipe_stage *i, *prev = NULL;
+
+	for (i = pipe->first; i != pipe->last; i = i->next)
+		prev = i;
+
+	if (prev) {
+		prev->next = NULL;
+		pipe->out_w = prev->out_w;
+		pipe->out_h = prev->out_h;
+		pipe->out_type = prev->out_type;
+	} else {
+		pipe->first = NULL;
+		pipe->out_w = pipe->w;
+		pipe->out_h = pipe->h;
+		pipe->out_type = pipe->pixel_type;
+	}
+
+	stage_free(pipe->last);
+	pipe->last = prev;
+}
+
+static int stage_push(gp_filter_pipe *pipe, struct pipe_stage *self,
+                      const gp_pixmap *rows);
+
+static int stage_emit(gp_filter_pipe *pipe, struct pipe_stage *self,
+                      const gp_pixmap *rows)
+{
+	if (self->next)
+		return stage_push(pipe, self->next, rows);
+
+	return pipe->sink(rows, pipe->priv);
+}
+
+static int stage_run(gp_filter_pipe *pipe, struct pipe_stage *self,
+                     const gp_pixmap *in, gp_coord in_y, gp_size h)
+{
+	gp_pixmap out;
+
+	gp_sub_pixmap(self->out, &out, 0, 0, self->out_w, h);
+
+	if (self->run(self, in, in_y, &out, self->out_y))
+		return 1;
+
+	self->out_y += h;
+
+	return stage_emit(pipe, self, &out);
+}
+
+/*
+ * Produces as many output bands as possible from the rows in the window and
+ * drops the rows that are not needed for the rest of the output.
+ */
+static int stage_produce(gp_filter_pipe *pipe, struct pipe_stage *self)
+{
+	gp_coord win_end = self->win_y + self->win_rows;
+	gp_coord y0, y1;
+	gp_size drop;
+	gp_pixmap in;
+
+	while ((gp_size)self->out_y < self->out_h) {
+		gp_size h = GP_MIN(self->band, self->out_h - self->out_y);
+
+		self->in_rows(self, self->out_y, h, &y0, &y1);
+
+		if (y1 > win_end)
+			break;
+
+		gp_sub_pixmap(self->win, &in, 0, 0, self->in_w, self->win_rows);
+
+		if (stage_run(pipe, self, &in, self->win_y, h))
+			return 1;
+	}
+
+	if ((gp_size)self->out_y < self->out_h) {
+		self->in_rows(self, self->out_y, 1, &y0, &y1);
+		drop = GP_MIN((gp_size)(y0 - self->win_y), self->win_rows);
+	} else {
+		drop = self->win_rows;
+	}
+
+	if (!drop)
+		return 0;
+
+	memmove(self->win->pixels, GP_PIXEL_ADDR(self->win, 0, drop),
+	        (size_t)(self->win_rows - drop) * self->win->bytes_per_row);
+
+	self->win_y += drop;
+	self->win_rows -= drop;
+
+	return 0;
+}
+
+static int stage_push(gp_filter_pipe *pipe, struct pipe_stage *self,
+                      const gp_pixmap *rows)
+{
+	size_t bytes = row_bytes(self->in_w, self->in_type);
+	gp_size pos, n, i;
+	gp_pixmap in;
+
+	if (!self->in_rows) {
+		for (pos = 0; pos < rows->h; pos += n) {
+			n = GP_MIN(self->band, rows->h - pos);
+
+			gp_sub_pixmap(rows, &in, 0, pos, rows->w, n);
+
+			if (stage_run(pipe, self, &in, self->out_y, n))
+				return 1;
+		}
+
+		return 0;
+	}
+
+	for (pos = 0; pos < rows->h; pos += n) {
+		n = GP_MIN(rows->h - pos, self->win->h - self->win_rows);
+
+		for (i = 0; i < n; i++) {
+			memcpy(GP_PIXEL_ADDR(self->win, 0, self->win_rows + i),
+			       GP_PIXEL_ADDR(rows, 0, pos + i), bytes);
+		}
+
+		self->win_rows += n;
+
+		if (stage_produce(pipe, self))
+			return 1;
+	}
+
+	return 0;
+}
+
+int gp_filter_pipe_push(gp_filter_pipe *self, const gp_pixmap *rows)
+{
+	if (rows->w != self->w || rows->pixel_type != self->pixel_type ||
+	    rows->h > self->h - self->pushed) {
+		GP_WARN("Invalid rows %ux%u %s expected width %u %s",
+		        rows->w, rows->h, gp_pixel_type_name(rows->pixel_type),
+		        self->w, gp_pixel_type_name(self->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	self->pushed += rows->h;
+
+	if (!self->first)
+		return self->sink(rows, self->priv);
+
+	return stage_push(self, self->first, rows);
+}
+
+void gp_filter_pipe_out(const gp_filter_pipe *self, gp_size *w, gp_size *h,
+                        gp_pixel_type *pixel_type)
+{
+	*w = self->out_w;
+	*h = self->out_h;
+	*pixel_type = self->out_type;
+}
+
+void gp_filter_pipe_free(gp_filter_pipe *self)
+{
+	struct pipe_stage *i, *next;
+
+	if (!self)
+		return;
+
+	for (i = self->first; i; i = next) {
+		next = i->next;
+		stage_free(i);
+	}
+
+	free(self);
+}
+
+static int no_palette(gp_pixel_type pixel_type)
+{
+	if (gp_pixel_has_flags(pixel_type, GP_PIXEL_IS_PALETTE)) {
+		GP_DEBUG(1, "Unsupported pixel type %s",
+		         gp_pixel_type_name(pixel_type));
+		errno = ENOSYS;
+		return 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Point filter.
+ */
+struct tables_stage {
+	const gp_filter_tables *tables;
+};
+
+static int tables_run(struct pipe_stage *self, const gp_pixmap *in,
+                      gp_coord GP_UNUSED(in_y), gp_pixmap *out,
+                      gp_coord GP_UNUSED(out_y))
+{
+	struct tables_stage *priv = (void*)self->priv;
+
+	return gp_filter_tables_apply(in, 0, 0, in->w, in->h, out, 0, 0,
+	                              priv->tables, self->callback);
+}
+
+int gp_filter_pipe_tables(gp_filter_pipe *self, const gp_filter_tables *tables)
+{
+	struct pipe_stage *stage;
+	struct tables_stage *priv;
+
+	if (no_palette(self->out_type))
+		return 1;
+
+	stage = stage_new(self, "point", sizeof(*priv));
+	if (!stage)
+		return 1;
+
+	priv = (void*)stage->priv;
+	priv->tables = tables;
+
+	stage->run = tables_run;
+
+	return stage_add(self, stage);
+}
+
+/*
+ * Convolutions, the kernel is stored after the stage.
+ */
+struct conv_stage {
+	unsigned int kw;
+	unsigned int kh;
+	float kern_div;
+	float kernel[];
+};
+
+static struct pipe_stage *conv_stage_new(gp_filter_pipe *self, const char *name,
+                                         const float kernel[], unsigned int kw,
+                                         unsigned int kh, float kern_div)
+{
+	struct pipe_stage *stage;
+	struct conv_stage *priv;
+
+	if (!kw || !kh || !kern_div) {
+		GP_WARN("Invalid kernel %ux%u div %f", kw, kh, kern_div);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (no_palette(self->out_type))
+		return NULL;
+
+	stage = stage_new(self, name, sizeof(*priv) + sizeof(float) * kw * kh);
+	if (!stage)
+		return NULL;
+
+	priv = (void*)stage->priv;
+	priv->kw = kw;
+	priv->kh = kh;
+	priv->kern_div = kern_div;
+	memcpy(priv->kernel, kernel, sizeof(float) * kw * kh);
+
+	return stage;
+}
+
+static void conv_in_rows(struct pipe_stage *self, gp_coord y, gp_size h,
+                         gp_coord *y0, gp_coord *y1)
+{
+	struct conv_stage *priv = (void*)self->priv;
+	gp_coord top = priv->kh / 2;
+	gp_coord bottom = priv->kh - 1 - top;
+
+	*y0 = GP_MAX(y - top, 0);
+	*y1 = GP_MIN(y + (gp_coord)h + bottom, (gp_coord)self->in_h);
+}
+
+static int conv_run(struct pipe_stage *self, const gp_pixmap *in,
+                    gp_coord in_y, gp_pixmap *out, gp_coord out_y)
+{
+	struct conv_stage *priv = (void*)self->priv;
+
+	return gp_filter_linear_convolution_raw(in, 0, out_y - in_y,
+	                                        out->w, out->h, out, 0, 0,
+	                                        priv->kernel, priv->kw, priv->kh,
+	                                        priv->kern_div, self->callback);
+}
+
+int gp_filter_pipe_convolution(gp_filter_pipe *self,
+                               const float kernel[], unsigned int kw,
+                               unsigned int kh, float kern_div)
+{
+	struct pipe_stage *stage;
+
+	stage = conv_stage_new(self, "convolution", kernel, kw, kh, kern_div);
+	if (!stage)
+		return 1;
+
+	stage->in_rows = conv_in_rows;
+	stage->run = conv_run;
+
+	return stage_add(self, stage);
+}
+
+static int hconv_run(struct pipe_stage *self, const gp_pixmap *in,
+                     gp_coord GP_UNUSED(in_y), gp_pixmap *out,
+                     gp_coord GP_UNUSED(out_y))
+{
+	struct conv_stage *priv = (void*)self->priv;
+
+	return gp_filter_hlinear_convolution_raw(in, 0, 0, in->w, in->h,
+	                                         out, 0, 0, priv->kernel,
+	                                         priv->kw, priv->kern_div,
+	                                         self->callback);
+}
+
+static int vconv_run(struct pipe_stage *self, const gp_pixmap *in,
+                     gp_coord in_y, gp_pixmap *out, gp_coord out_y)
+{
+	struct conv_stage *priv = (void*)self->priv;
+
+	return gp_filter_vlinear_convolution_raw(in, 0, out_y - in_y,
+	                                         out->w, out->h, out, 0, 0,
+	                                         priv->kernel, priv->kh,
+	                                         priv->kern_div, self->callback);
+}
+
+int gp_filter_pipe_vhconvolution(gp_filter_pipe *self,
+                                 const float hkernel[], unsigned int kw,
+                                 float hkern_div,
+                                 const float vkernel[], unsigned int kh,
+                                 float vkern_div)
+{
+	struct pipe_stage *stage;
+
+	stage = conv_stage_new(self, "hconvolution", hkernel, kw, 1, hkern_div);
+	if (!stage)
+		return 1;
+
+	stage->run = hconv_run;
+
+	if (stage_add(self, stage))
+		return 1;
+
+	stage = conv_stage_new(self, "vconvolution", vkernel, 1, kh, vkern_div);
+	if (!stage)
+		goto err;
+
+	stage->in_rows = conv_in_rows;
+	stage->run = vconv_run;
+
+	if (stage_add(self, stage))
+		goto err;
+
+	return 0;
+err:
+	stage_pop(self);
+	return 1;
+}
+
+int gp_filter_pipe_edge_sharpening(gp_filter_pipe *self, float w)
+{
+	/* Identity minus weighted Laplace kernel */
+	float kern[9] = {0,  -w,    0,
+	                 -w, 1+4*w, -w,
+	                 0,  -w,    0};
+
+	return gp_filter_pipe_convolution(self, kern, 3, 3, 1);
+}
+
+/*
+ * Resampling.
+ */
+struct resize_stage {
+	struct gp_resize_sep *sep;
+};
+
+static void resize_in_rows(struct pipe_stage *self, gp_coord y, gp_size h,
+                           gp_coord *y0, gp_coord *y1)
+{
+	struct resize_stage *priv = (void*)self->priv;
+
+	gp_resize_sep_src_rows(priv->sep, y, h, y0, y1);
+}
+
+static int resize_run(struct pipe_stage *self, const gp_pixmap *in,
+                      gp_coord in_y, gp_pixmap *out, gp_coord out_y)
+{
+	struct resize_stage *priv = (void*)self->priv;
+
+	return gp_resize_sep_rows(priv->sep, in, in_y, out, out_y);
+}
+
+static void resize_free(struct pipe_stage *self)
+{
+	struct resize_stage *priv = (void*)self->priv;
+
+	gp_resize_sep_free(priv->sep);
+}
+
+int gp_filter_pipe_resize(gp_filter_pipe *self, gp_size w, gp_size h,
+                          gp_interpolation_type type)
+{
+	enum gp_resize_kernel kern_x, kern_y;
+	struct resize_stage *priv;
+	struct pipe_stage *stage;
+
+	if (!w || !h || type > GP_INTERP_MAX) {
+		GP_WARN("Invalid resize %ux%u %s", w, h,
+		        gp_interpolation_type_name(type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!gp_resize_sep_supported(self->out_type) ||
+	    !gp_resize_sep_kernels(type, self->out_w, self->out_h, w, h,
+	                           &kern_x, &kern_y)) {
+		GP_DEBUG(1, "Unsupported resize %s %s",
+		         gp_interpolation_type_name(type),
+		         gp_pixel_type_name(self->out_type));
+		errno = ENOSYS;
+		return 1;
+	}
+
+	stage = stage_new(self, "resize", sizeof(*priv));
+	if (!stage)
+		return 1;
+
+	priv = (void*)stage->priv;
+	priv->sep = gp_resize_sep_create(self->out_type, self->out_w,
+	                                 self->out_h, w, h, kern_x, kern_y);
+	if (!priv->sep) {
+		stage_free(stage);
+		return 1;
+	}
+
+	stage->out_w = w;
+	stage->out_h = h;
+	stage->in_rows = resize_in_rows;
+	stage->run = resize_run;
+	stage->free = resize_free;
+
+	return stage_add(self, stage);
+}
+
+/*
+ * Dithering, the error buffer is carried over between the bands.
+ */
+static int dither_run(struct pipe_stage *self, const gp_pixmap *in,
+                      gp_coord GP_UNUSED(in_y), gp_pixmap *out,
+                      gp_coord out_y)
+{
+	float *errors = (void*)self->priv;
+
+	return gp_floyd_steinberg_rows(in, out, out_y, errors);
+}
+
+int gp_filter_pipe_floyd_steinberg(gp_filter_pipe *self,
+                                   gp_pixel_type pixel_type)
+{
+	struct pipe_stage *stage;
+
+	if (no_palette(self->out_type))
+		return 1;
+
+	if (!gp_floyd_steinberg_supported(pixel_type)) {
+		GP_DEBUG(1, "Cannot dither into %s",
+		         gp_pixel_type_name(pixel_type));
+		errno = ENOSYS;
+		return 1;
+	}
+
+	/* The stage is zeroed, so is the error buffer */
+	stage = stage_new(self, "floyd steinberg",
+	                  sizeof(float) * GP_FLOYD_STEINBERG_ERRORS(self->out_w));
+	if (!stage)
+		return 1;
+
+	stage->out_type = pixel_type;
+	stage->run = dither_run;
+
+	return stage_add(self, stage);
+}
+
+/*
+ * Pixel type conversion.
+ */
+static int convert_run(struct pipe_stage GP_UNUSED(*self), const gp_pixmap *in,
+                       gp_coord GP_UNUSED(in_y), gp_pixmap *out,
+                       gp_coord GP_UNUSED(out_y))
+{
+	gp_blit_xywh_raw(in, 0, 0, in->w, in->h, out, 0, 0);
+
+	return 0;
+}
+
+int gp_filter_pipe_convert(gp_filter_pipe *self, gp_pixel_type pixel_type)
+{
+	struct pipe_stage *stage;
+
+	if (pixel_type == GP_PIXEL_UNKNOWN || pixel_type >= GP_PIXEL_MAX) {
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (pixel_type == self->out_type)
+		return 0;
+
+	stage = stage_new(self, "convert", 0);
+	if (!stage)
+		return 1;
+
+	stage->out_type = pixel_type;
+	stage->run = convert_run;
+
+	return stage_add(self, stage);
+}
@@ -14,6 +14,7 @@
 #include "core/gp_clamp.h"
 #include <filters/gp_filter.h>
 #include <filters/gp_dither.h>
+#include "gp_floyd_steinberg.h"
 
 @ def distribute_error(errors, x, y, w, err):
 if ({{ x }} + 1 < {{ w }})
@@ -34,11 +35,12 @@ if ({{ x }} + 1 < {{ w }})
  * Floyd Steinberg to {{ pt.name }}
  */
 static int floyd_steinberg_to_{{ pt.name }}_raw(const gp_pixmap *src,
-                                                gp_pixmap *dst,
+                                                gp_pixmap *dst, gp_coord y0,
+                                                float *errors,
                                                 gp_progress_cb *callback)
 {
-@         for c in pt.chanslist:
-	float errors_{{ c.name }}[2][src->w];
+@         for i, c in enumerate(pt.chanslist):
+	float (*errors_{{ c.name }})[src->w] = (void*)(errors + {{ 2 * i }} * src->w);
 @         end
 
 	GP_DEBUG(1, "Floyd Steinberg %s to %s %ux%u",
@@ -48,16 +50,11 @@ static int floyd_steinberg_to_{{ pt.name }}_raw(const gp_pixmap *src,
 
 	gp_coord x, y;
 
-@         for c in pt.chanslist:
-	memset(errors_{{ c.name }}[0], 0, src->w * sizeof(float));
-	memset(errors_{{ c.name }}[1], 0, src->w * sizeof(float));
-@         end
-
-	for (y = 0; y < (gp_coord)src->h; y++) {
+	for (y = y0; y < y0 + (gp_coord)src->h; y++) {
 		for (x = 0; x < (gp_coord)src->w; x++) {
 			gp_pixel pix;
 
-			pix = gp_getpixel_raw(src, x, y);
+			pix = gp_getpixel_raw(src, x, y - y0);
 			pix = gp_pixel_to_RGB888(pix, src->pixel_type);
 
 @         for c in pt.chanslist:
@@ -85,11 +82,11 @@ static int floyd_steinberg_to_{{ pt.name }}_raw(const gp_pixmap *src,
 @         end
 
 @         if pt.is_gray():
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y, res_V);
+			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y - y0, res_V);
 @         else:
 			gp_pixel res = GP_PIXEL_CREATE_{{ pt.name }}({{ arr_to_params(pt.chan_names, 'res_') }});
 
-			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y, res);
+			gp_putpixel_raw_{{ pt.pixelsize.suffix }}(dst, x, y - y0, res);
 @         end
 		}
 
@@ -97,7 +94,7 @@ static int floyd_steinberg_to_{{ pt.name }}_raw(const gp_pixmap *src,
 		memset(errors_{{ c.name }}[y%2], 0, src->w * sizeof(float));
 @         end
 
-		if (gp_progress_cb_report(callback, y, src->h, src->w))
+		if (gp_progress_cb_report(callback, y - y0, src->h, src->w))
 			return 1;
 	}
 
@@ -107,8 +104,8 @@ static int floyd_steinberg_to_{{ pt.name }}_raw(const gp_pixmap *src,
 
 @ end
 @
-static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
-                           gp_progress_cb *callback)
+static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst, gp_coord y,
+                           float *errors, gp_progress_cb *callback)
 {
 	if (gp_pixel_has_flags(src->pixel_type, GP_PIXEL_IS_PALETTE)) {
 		GP_DEBUG(1, "Unsupported source pixel type %s",
@@ -121,7 +118,7 @@ static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
 @ for pt in pixeltypes:
 @     if pt.is_gray() or pt.is_rgb() and not pt.is_alpha():
 	case GP_PIXEL_{{ pt.name }}:
-		return floyd_steinberg_to_{{ pt.name }}_raw(src, dst, callback);
+		return floyd_steinberg_to_{{ pt.name }}_raw(src, dst, y, errors, callback);
 @ end
 	default:
 		errno = EINVAL;
@@ -129,13 +126,42 @@ static int floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
 	}
 }
 
+int gp_floyd_steinberg_supported(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+@ for pt in pixeltypes:
+@     if pt.is_gray() or pt.is_rgb() and not pt.is_alpha():
+	case GP_PIXEL_{{ pt.name }}:
+@ end
+		return 1;
+	default:
+		return 0;
+	}
+}
+
+int gp_floyd_steinberg_rows(const gp_pixmap *src, gp_pixmap *dst, gp_coord y,
+                            float *errors)
+{
+	return floyd_steinberg(src, dst, y, errors, NULL);
+}
+
+static int floyd_steinberg_image(const gp_pixmap *src, gp_pixmap *dst,
+                                 gp_progress_cb *callback)
+{
+	float errors[GP_FLOYD_STEINBERG_ERRORS(src->w)];
+
+	memset(errors, 0, sizeof(errors));
+
+	return floyd_steinberg(src, dst, 0, errors, callback);
+}
+
 int gp_filter_floyd_steinberg(const gp_pixmap *src, gp_pixmap *dst,
                             gp_progress_cb *callback)
 {
 	GP_CHECK(src->w <= dst->w);
 	GP_CHECK(src->h <= dst->h);
 
-	return floyd_steinberg(src, dst, callback);
+	return floyd_steinberg_image(src, dst, callback);
 }
 
 
@@ -150,7 +176,7 @@ gp_pixmap *gp_filter_floyd_steinberg_alloc(const gp_pixmap *src,
 	if (ret == NULL)
 		return NULL;
 
-	if (floyd_steinberg(src, ret, callback)) {
+	if (floyd_steinberg_image(src, ret, callback)) {
 		gp_pixmap_free(ret);
 		return NULL;
 	}
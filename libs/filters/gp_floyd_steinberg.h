@@ -0,0 +1,43 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Floyd Steinberg dithering of an image passed in bands of rows.
+
+   Library internal, the functions are not exported.
+
+  */
+
+#ifndef FILTERS_GP_FLOYD_STEINBERG_H
+#define FILTERS_GP_FLOYD_STEINBERG_H
+
+#include <core/gp_pixmap.h>
+
+/*
+ * Size of the error buffer in floats, two rows for each of at most three
+ * channels of the destination pixel type.
+ */
+#define GP_FLOYD_STEINBERG_ERRORS(w) (2 * 3 * (w))
+
+/*
+ * Returns non-zero if pixel type can be dithered into.
+ */
+int gp_floyd_steinberg_supported(gp_pixel_type pixel_type)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Dithers all src rows into dst, y is the image row of the first src row.
+ *
+ * The errors buffer has to be zeroed before the first call and is carried
+ * over between the calls, the rows have to be passed in order.
+ *
+ * Returns zero on success, non-zero and sets errno on failure.
+ */
+int gp_floyd_steinberg_rows(const gp_pixmap *src, gp_pixmap *dst, gp_coord y,
+                            float *errors)
+	__attribute__ ((visibility ("hidden")));
+
+#endif /* FILTERS_GP_FLOYD_STEINBERG_H */
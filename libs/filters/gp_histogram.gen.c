@@ -0,0 +1,482 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_histogram.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:10 from gp_histogram.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Histogram filter -- Compute image histogram
+ *
+ * Copyright (C) 2009-2015 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_pixel.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+#include <filters/gp_filter.h>
+#include <filters/gp_stats.h>
+
+typedef void (*histogram_fn)(uint32_t *hist[], const gp_pixmap *src,
+                             gp_coord y, gp_size h, unsigned int stride);
+
+/* First row of the band that is sampled */
+static inline gp_coord first_row(gp_coord y, unsigned int stride)
+{
+	return (y + stride - 1) / stride * stride;
+}
+
+static void histogram_xRGB8888(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_xRGB8888(pix)]++;
+			hist[1][GP_PIXEL_GET_G_xRGB8888(pix)]++;
+			hist[2][GP_PIXEL_GET_B_xRGB8888(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGBA8888(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGBA8888(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGBA8888(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGBA8888(pix)]++;
+			hist[3][GP_PIXEL_GET_A_RGBA8888(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGB888(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGB888(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGB888(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGB888(pix)]++;
+		}
+	}
+}
+
+static void histogram_BGR888(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_B_BGR888(pix)]++;
+			hist[1][GP_PIXEL_GET_G_BGR888(pix)]++;
+			hist[2][GP_PIXEL_GET_R_BGR888(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGB555(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGB555(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGB555(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGB555(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGB565(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGB565(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGB565(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGB565(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGB666(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGB666(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGB666(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGB666(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGB332(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGB332(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGB332(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGB332(pix)]++;
+		}
+	}
+}
+
+static void histogram_CMYK8888(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_K_CMYK8888(pix)]++;
+			hist[1][GP_PIXEL_GET_Y_CMYK8888(pix)]++;
+			hist[2][GP_PIXEL_GET_M_CMYK8888(pix)]++;
+			hist[3][GP_PIXEL_GET_C_CMYK8888(pix)]++;
+		}
+	}
+}
+
+static void histogram_G1(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, x, y);
+			hist[0][GP_PIXEL_GET_V_G1(pix)]++;
+		}
+	}
+}
+
+static void histogram_G2(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, x, y);
+			hist[0][GP_PIXEL_GET_V_G2(pix)]++;
+		}
+	}
+}
+
+static void histogram_G4(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, x, y);
+			hist[0][GP_PIXEL_GET_V_G4(pix)]++;
+		}
+	}
+}
+
+static void histogram_G8(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_8BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_V_G8(pix)]++;
+		}
+	}
+}
+
+static void histogram_GA88(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_V_GA88(pix)]++;
+			hist[1][GP_PIXEL_GET_A_GA88(pix)]++;
+		}
+	}
+}
+
+static void histogram_G16(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_16BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_V_G16(pix)]++;
+		}
+	}
+}
+
+static void histogram_RGBA8888_PM(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
+{
+	gp_coord x, y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw_32BPP(src, x, y);
+			hist[0][GP_PIXEL_GET_R_RGBA8888_PM(pix)]++;
+			hist[1][GP_PIXEL_GET_G_RGBA8888_PM(pix)]++;
+			hist[2][GP_PIXEL_GET_B_RGBA8888_PM(pix)]++;
+			hist[3][GP_PIXEL_GET_A_RGBA8888_PM(pix)]++;
+		}
+	}
+}
+
+/*
+ * Fast path for pixel types with byte aligned 8 bit channels, the channels
+ * are counted directly from the pixel bytes.
+ */
+static void histogram_8bpc(uint32_t *hist[], const gp_pixmap *src,
+                           gp_coord y, gp_size h, unsigned int stride)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	unsigned int i, n = desc->numchannels;
+	gp_size step = desc->size / 8 * stride;
+	gp_size row_size = (src->w - 1) / stride * step + 1;
+	gp_coord y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		const uint8_t *row = GP_PIXEL_ADDR(src, 0, y);
+
+		for (i = 0; i < n; i++) {
+			const uint8_t *p = row + desc->channels[i].offset / 8;
+			uint32_t *chan = hist[i];
+			gp_size x;
+
+			for (x = 0; x < row_size; x += step)
+				chan[p[x]]++;
+		}
+	}
+}
+
+static histogram_fn histogram_fn_get(gp_pixel_type pixel_type)
+{
+	if (gp_pixel_has_flags(pixel_type, GP_PIXEL_IS_8BPC))
+		return histogram_8bpc;
+
+	switch (pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return histogram_xRGB8888;
+	case GP_PIXEL_RGBA8888:
+		return histogram_RGBA8888;
+	case GP_PIXEL_RGB888:
+		return histogram_RGB888;
+	case GP_PIXEL_BGR888:
+		return histogram_BGR888;
+	case GP_PIXEL_RGB555:
+		return histogram_RGB555;
+	case GP_PIXEL_RGB565:
+		return histogram_RGB565;
+	case GP_PIXEL_RGB666:
+		return histogram_RGB666;
+	case GP_PIXEL_RGB332:
+		return histogram_RGB332;
+	case GP_PIXEL_CMYK8888:
+		return histogram_CMYK8888;
+	case GP_PIXEL_G1:
+		return histogram_G1;
+	case GP_PIXEL_G2:
+		return histogram_G2;
+	case GP_PIXEL_G4:
+		return histogram_G4;
+	case GP_PIXEL_G8:
+		return histogram_G8;
+	case GP_PIXEL_GA88:
+		return histogram_GA88;
+	case GP_PIXEL_G16:
+		return histogram_G16;
+	case GP_PIXEL_RGBA8888_PM:
+		return histogram_RGBA8888_PM;
+	default:
+		return NULL;
+	}
+}
+
+struct histogram_job {
+	const gp_pixmap *src;
+	unsigned int stride;
+	histogram_fn fn;
+	unsigned int nr_chans;
+	size_t offs[GP_PIXELTYPE_MAX_CHANNELS];
+	/* Partial histograms for the bands, one per thread */
+	gp_threads_slots parts;
+};
+
+static int histogram_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct histogram_job *job = priv;
+	uint32_t *hist[GP_PIXELTYPE_MAX_CHANNELS];
+	unsigned int i, slot;
+	uint32_t *part;
+
+	part = gp_threads_slot_get(&job->parts, &slot);
+	if (!part)
+		return 1;
+
+	for (i = 0; i < job->nr_chans; i++)
+		hist[i] = part + job->offs[i];
+
+	job->fn(hist, job->src, y, h, job->stride);
+
+	gp_threads_slot_put(&job->parts, slot);
+
+	return 0;
+}
+
+static int histogram_mp(gp_histogram *self, struct histogram_job *job,
+                        gp_progress_cb *callback)
+{
+	const gp_pixmap *src = job->src;
+	gp_size w = (src->w + job->stride - 1) / job->stride;
+	gp_size h = (src->h + job->stride - 1) / job->stride;
+	unsigned int t = gp_nr_threads(w, h, callback);
+	gp_size bytes_per_row = (size_t)gp_pixel_size(src->pixel_type) * w / 8;
+	gp_size band_h;
+	size_t j, len = 0;
+	unsigned int i;
+	int ret;
+
+	for (i = 0; i < job->nr_chans; i++) {
+		job->offs[i] = len;
+		len += self->channels[i]->len;
+	}
+
+	if (gp_threads_slots_alloc(&job->parts, t, len * sizeof(uint32_t)))
+		return 1;
+
+	/* Band size is computed for the sampled rows */
+	band_h = gp_threads_band_rows(h, t, bytes_per_row, 1, 1) * job->stride;
+
+	GP_DEBUG(1, "Histogram %ux%u stride %u in %u threads",
+	         src->w, src->h, job->stride, t);
+
+	ret = gp_threads_rows_ex(src->h, t, band_h, histogram_rows, job, callback);
+
+	if (!ret) {
+		for (i = 0; i < job->nr_chans; i++) {
+			gp_histogram_channel *chan = self->channels[i];
+			unsigned int k;
+
+			for (k = 0; k < t; k++) {
+				const uint32_t *part = gp_threads_slot(&job->parts, k);
+
+				part += job->offs[i];
+
+				for (j = 0; j < chan->len; j++)
+					chan->hist[j] += part[j];
+			}
+		}
+	}
+
+	gp_threads_slots_free(&job->parts);
+
+	return ret;
+}
+
+int gp_filter_histogram_stride(gp_histogram *self, const gp_pixmap *src,
+                               unsigned int stride, gp_progress_cb *callback)
+{
+	struct histogram_job job = {
+		.src = src,
+		.stride = stride,
+	};
+	unsigned int i, j;
+
+	GP_DEBUG(1, "Running Histogram filter");
+
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!stride) {
+		GP_WARN("Invalid stride 0");
+		errno = EINVAL;
+		return 1;
+	}
+
+	job.fn = histogram_fn_get(src->pixel_type);
+	if (!job.fn) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	job.nr_chans = gp_pixel_channel_count(self->pixel_type);
+
+	for (i = 0; i < job.nr_chans; i++) {
+		gp_histogram_channel *chan = self->channels[i];
+		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	}
+
+	if (src->w && src->h && histogram_mp(self, &job, callback))
+		return 1;
+
+	for (i = 0; i < job.nr_chans; i++) {
+		gp_histogram_channel *chan = self->channels[i];
+
+		chan->max = chan->hist[0];
+		chan->min = chan->hist[0];
+
+		for (j = 1; j < chan->len; j++) {
+			if (chan->hist[j] > chan->max)
+				chan->max = chan->hist[j];
+
+			if (chan->hist[j] < chan->min)
+				chan->min = chan->hist[j];
+		}
+	}
+
+	return 0;
+}
+
+int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
+                        gp_progress_cb *callback)
+{
+	return gp_filter_histogram_stride(self, src, 1, callback);
+}
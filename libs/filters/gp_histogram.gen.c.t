@@ -5,86 +5,212 @@
  * Copyright (C) 2009-2015 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
 #include <core/gp_pixmap.h>
 #include <core/gp_pixel.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
 #include <core/gp_debug.h>
 #include <filters/gp_filter.h>
 #include <filters/gp_stats.h>
 
+typedef void (*histogram_fn)(uint32_t *hist[], const gp_pixmap *src,
+                             gp_coord y, gp_size h, unsigned int stride);
+
+/* First row of the band that is sampled */
+static inline gp_coord first_row(gp_coord y, unsigned int stride)
+{
+	return (y + stride - 1) / stride * stride;
+}
+
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
-static int histogram_{{ pt.name }}(gp_histogram *self, const gp_pixmap *src, gp_progress_cb *callback)
+static void histogram_{{ pt.name }}(uint32_t *hist[], const gp_pixmap *src,
+                                    gp_coord y, gp_size h, unsigned int stride)
 {
-	if (self->pixel_type != src->pixel_type) {
-		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
-		        gp_pixel_type_name(self->pixel_type),
-			gp_pixel_type_name(src->pixel_type));
-		errno = EINVAL;
-		return 1;
-	}
+	gp_coord x, y_end = y + h;
 
-@         for c in pt.chanslist:
-	gp_histogram_channel *chan_{{ c.name }} = self->channels[{{ c.idx }}];
-@         end
-
-	uint32_t x, y;
-
-	for (y = 0; y < src->h; y++) {
-		for (x = 0; x < src->w; x++) {
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		for (x = 0; x < (gp_coord)src->w; x += stride) {
 			gp_pixel pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, x, y);
 @         for c in pt.chanslist:
-			int32_t {{ c.name }} = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+			hist[{{ c.idx }}][GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix)]++;
 @         end
+		}
+	}
+}
 
-@         for c in pt.chanslist:
-			chan_{{ c.name }}->hist[{{ c.name }}]++;
-@         end
+@ end
+@
+/*
+ * Fast path for pixel types with byte aligned 8 bit channels, the channels
+ * are counted directly from the pixel bytes.
+ */
+static void histogram_8bpc(uint32_t *hist[], const gp_pixmap *src,
+                           gp_coord y, gp_size h, unsigned int stride)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	unsigned int i, n = desc->numchannels;
+	gp_size step = desc->size / 8 * stride;
+	gp_size row_size = (src->w - 1) / stride * step + 1;
+	gp_coord y_end = y + h;
+
+	for (y = first_row(y, stride); y < y_end; y += stride) {
+		const uint8_t *row = GP_PIXEL_ADDR(src, 0, y);
+
+		for (i = 0; i < n; i++) {
+			const uint8_t *p = row + desc->channels[i].offset / 8;
+			uint32_t *chan = hist[i];
+			gp_size x;
+
+			for (x = 0; x < row_size; x += step)
+				chan[p[x]]++;
 		}
+	}
+}
+
+static histogram_fn histogram_fn_get(gp_pixel_type pixel_type)
+{
+	if (gp_pixel_has_flags(pixel_type, GP_PIXEL_IS_8BPC))
+		return histogram_8bpc;
 
-		if (gp_progress_cb_report(callback, y, src->h, src->w))
-			return 1;
+	switch (pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		return histogram_{{ pt.name }};
+@ end
+	default:
+		return NULL;
 	}
+}
+
+struct histogram_job {
+	const gp_pixmap *src;
+	unsigned int stride;
+	histogram_fn fn;
+	unsigned int nr_chans;
+	size_t offs[GP_PIXELTYPE_MAX_CHANNELS];
+	/* Partial histograms for the bands, one per thread */
+	gp_threads_slots parts;
+};
+
+static int histogram_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct histogram_job *job = priv;
+	uint32_t *hist[GP_PIXELTYPE_MAX_CHANNELS];
+	unsigned int i, slot;
+	uint32_t *part;
+
+	part = gp_threads_slot_get(&job->parts, &slot);
+	if (!part)
+		return 1;
+
+	for (i = 0; i < job->nr_chans; i++)
+		hist[i] = part + job->offs[i];
+
+	job->fn(hist, job->src, y, h, job->stride);
+
+	gp_threads_slot_put(&job->parts, slot);
 
-	gp_progress_cb_done(callback);
 	return 0;
 }
 
-@ end
-@
-int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
-                       gp_progress_cb *callback)
+static int histogram_mp(gp_histogram *self, struct histogram_job *job,
+                        gp_progress_cb *callback)
 {
-	unsigned int i, j;
+	const gp_pixmap *src = job->src;
+	gp_size w = (src->w + job->stride - 1) / job->stride;
+	gp_size h = (src->h + job->stride - 1) / job->stride;
+	unsigned int t = gp_nr_threads(w, h, callback);
+	gp_size bytes_per_row = (size_t)gp_pixel_size(src->pixel_type) * w / 8;
+	gp_size band_h;
+	size_t j, len = 0;
+	unsigned int i;
 	int ret;
 
+	for (i = 0; i < job->nr_chans; i++) {
+		job->offs[i] = len;
+		len += self->channels[i]->len;
+	}
+
+	if (gp_threads_slots_alloc(&job->parts, t, len * sizeof(uint32_t)))
+		return 1;
+
+	/* Band size is computed for the sampled rows */
+	band_h = gp_threads_band_rows(h, t, bytes_per_row, 1, 1) * job->stride;
+
+	GP_DEBUG(1, "Histogram %ux%u stride %u in %u threads",
+	         src->w, src->h, job->stride, t);
+
+	ret = gp_threads_rows_ex(src->h, t, band_h, histogram_rows, job, callback);
+
+	if (!ret) {
+		for (i = 0; i < job->nr_chans; i++) {
+			gp_histogram_channel *chan = self->channels[i];
+			unsigned int k;
+
+			for (k = 0; k < t; k++) {
+				const uint32_t *part = gp_threads_slot(&job->parts, k);
+
+				part += job->offs[i];
+
+				for (j = 0; j < chan->len; j++)
+					chan->hist[j] += part[j];
+			}
+		}
+	}
+
+	gp_threads_slots_free(&job->parts);
+
+	return ret;
+}
+
+int gp_filter_histogram_stride(gp_histogram *self, const gp_pixmap *src,
+                               unsigned int stride, gp_progress_cb *callback)
+{
+	struct histogram_job job = {
+		.src = src,
+		.stride = stride,
+	};
+	unsigned int i, j;
+
 	GP_DEBUG(1, "Running Histogram filter");
 
-	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
-		gp_histogram_channel *chan = self->channels[i];
-		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	if (self->pixel_type != src->pixel_type) {
+		GP_WARN("Histogram (%s) and pixmap (%s) pixel type must match",
+		        gp_pixel_type_name(self->pixel_type),
+			gp_pixel_type_name(src->pixel_type));
+		errno = EINVAL;
+		return 1;
 	}
 
-	switch (src->pixel_type) {
-@ for pt in pixeltypes:
-@     if not pt.is_unknown() and not pt.is_palette():
-	case GP_PIXEL_{{ pt.name }}:
-		ret = histogram_{{ pt.name }}(self, src, callback);
-	break;
-@ end
-	default:
+	if (!stride) {
+		GP_WARN("Invalid stride 0");
+		errno = EINVAL;
+		return 1;
+	}
+
+	job.fn = histogram_fn_get(src->pixel_type);
+	if (!job.fn) {
 		errno = ENOSYS;
 		return 1;
-	break;
 	}
 
-	if (ret)
-		return ret;
+	job.nr_chans = gp_pixel_channel_count(self->pixel_type);
 
-	for (i = 0; i < gp_pixel_channel_count(self->pixel_type); i++) {
+	for (i = 0; i < job.nr_chans; i++) {
+		gp_histogram_channel *chan = self->channels[i];
+		memset(chan->hist, 0, sizeof(uint32_t) * chan->len);
+	}
+
+	if (src->w && src->h && histogram_mp(self, &job, callback))
+		return 1;
+
+	for (i = 0; i < job.nr_chans; i++) {
 		gp_histogram_channel *chan = self->channels[i];
 
 		chan->max = chan->hist[0];
@@ -101,3 +227,9 @@ int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
 
 	return 0;
 }
+
+int gp_filter_histogram(gp_histogram *self, const gp_pixmap *src,
+                        gp_progress_cb *callback)
+{
+	return gp_filter_histogram_stride(self, src, 1, callback);
+}
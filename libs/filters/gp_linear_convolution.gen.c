@@ -0,0 +1,4455 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_linear_convolution.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:01 from gp_linear_convolution.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Linear Convolution
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_linear.h>
+
+#include "gp_linear_convolution_8bpc.h"
+
+#define MUL 1024
+
+
+
+static int h_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 31);
+			G_sum = GP_CLAMP(G_sum, 0, 31);
+			B_sum = GP_CLAMP(B_sum, 0, 31);
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 31);
+			G_sum = GP_CLAMP(G_sum, 0, 63);
+			B_sum = GP_CLAMP(B_sum, 0, 31);
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_18BPP_LE(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 63);
+			G_sum = GP_CLAMP(G_sum, 0, 63);
+			B_sum = GP_CLAMP(B_sum, 0, 63);
+			gp_putpixel_raw_18BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + x;
+			int32_t G_sum = MUL/2;
+			int *pG = G + x;
+			int32_t B_sum = MUL/2;
+			int *pB = B + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 7);
+			G_sum = GP_CLAMP(G_sum, 0, 7);
+			B_sum = GP_CLAMP(B_sum, 0, 3);
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G1(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_1BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 1);
+			gp_putpixel_raw_1BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G2(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_2BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 3);
+			gp_putpixel_raw_2BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G4(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_4BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 15);
+			gp_putpixel_raw_4BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int h_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+				    float kernel[], uint32_t kw, float kern_div,
+				    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kw], ikern_div;
+	uint32_t size = w_src + kw - 1;
+
+	for (i = 0; i < kw; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do horizontal linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		int yi = GP_MIN(y_src + y, (int)src->h - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, 0, yi);
+
+		int xi = x_src - kw/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (xi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+			i++;
+			xi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (xi < (int)src->w && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+
+			i++;
+			xi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+
+			i++;
+		}
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + x;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 65535);
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G16(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_hlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kw, float kern_div,
+				      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Horizontal linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u",
+		    kw, x_src, y_src, w_src, h_src);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   4, 0xffffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   3, 0xffffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   3, 0xffffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return h_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return h_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return h_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return h_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_G1:
+		return h_lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return h_lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return h_lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   1, 0xff,
+		                                   callback);
+	break;
+	case GP_PIXEL_GA88:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   2, 0xffff,
+		                                   callback);
+	break;
+	case GP_PIXEL_G16:
+		return h_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kw, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int v_lin_conv_xRGB8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   4, 0xffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[i] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[i] = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[i] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[i] = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_xRGB8888(pix);
+			G[i] = GP_PIXEL_GET_G_xRGB8888(pix);
+			B[i] = GP_PIXEL_GET_B_xRGB8888(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 255);
+			G_sum = GP_CLAMP(G_sum, 0, 255);
+			B_sum = GP_CLAMP(B_sum, 0, 255);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_xRGB8888(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+			int32_t A_sum = MUL/2;
+			int *pA = A + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 255);
+			G_sum = GP_CLAMP(G_sum, 0, 255);
+			B_sum = GP_CLAMP(B_sum, 0, 255);
+			A_sum = GP_CLAMP(A_sum, 0, 255);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888(
+					      R_sum, G_sum, B_sum, A_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   3, 0xffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888(pix);
+			G[i] = GP_PIXEL_GET_G_RGB888(pix);
+			B[i] = GP_PIXEL_GET_B_RGB888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB888(pix);
+			G[i] = GP_PIXEL_GET_G_RGB888(pix);
+			B[i] = GP_PIXEL_GET_B_RGB888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB888(pix);
+			G[i] = GP_PIXEL_GET_G_RGB888(pix);
+			B[i] = GP_PIXEL_GET_B_RGB888(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 255);
+			G_sum = GP_CLAMP(G_sum, 0, 255);
+			B_sum = GP_CLAMP(B_sum, 0, 255);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_BGR888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   3, 0xffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888(pix);
+			G[i] = GP_PIXEL_GET_G_BGR888(pix);
+			R[i] = GP_PIXEL_GET_R_BGR888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			B[i] = GP_PIXEL_GET_B_BGR888(pix);
+			G[i] = GP_PIXEL_GET_G_BGR888(pix);
+			R[i] = GP_PIXEL_GET_R_BGR888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			B[i] = GP_PIXEL_GET_B_BGR888(pix);
+			G[i] = GP_PIXEL_GET_G_BGR888(pix);
+			R[i] = GP_PIXEL_GET_R_BGR888(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				B_sum += (*pB++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				R_sum += (*pR++) * ikernel[i];
+			}
+
+			/* divide the result */
+			B_sum /= ikern_div;
+			G_sum /= ikern_div;
+			R_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			B_sum = GP_CLAMP(B_sum, 0, 255);
+			G_sum = GP_CLAMP(G_sum, 0, 255);
+			R_sum = GP_CLAMP(R_sum, 0, 255);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_BGR888(
+					      B_sum, G_sum, R_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB555(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB555(pix);
+			G[i] = GP_PIXEL_GET_G_RGB555(pix);
+			B[i] = GP_PIXEL_GET_B_RGB555(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 31);
+			G_sum = GP_CLAMP(G_sum, 0, 31);
+			B_sum = GP_CLAMP(B_sum, 0, 31);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB555(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB565(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB565(pix);
+			G[i] = GP_PIXEL_GET_G_RGB565(pix);
+			B[i] = GP_PIXEL_GET_B_RGB565(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 31);
+			G_sum = GP_CLAMP(G_sum, 0, 63);
+			B_sum = GP_CLAMP(B_sum, 0, 31);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB565(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB666(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_18BPP_LE(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_18BPP_LE(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB666(pix);
+			G[i] = GP_PIXEL_GET_G_RGB666(pix);
+			B[i] = GP_PIXEL_GET_B_RGB666(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 63);
+			G_sum = GP_CLAMP(G_sum, 0, 63);
+			B_sum = GP_CLAMP(B_sum, 0, 63);
+
+			gp_putpixel_raw_18BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB666(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGB332(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 3 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGB332(pix);
+			G[i] = GP_PIXEL_GET_G_RGB332(pix);
+			B[i] = GP_PIXEL_GET_B_RGB332(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 7);
+			G_sum = GP_CLAMP(G_sum, 0, 7);
+			B_sum = GP_CLAMP(B_sum, 0, 3);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB332(
+					      R_sum, G_sum, B_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_CMYK8888(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *K = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *Y = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *M = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *C = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[i] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[i] = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			K[i] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[i] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[i] = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			K[i] = GP_PIXEL_GET_K_CMYK8888(pix);
+			Y[i] = GP_PIXEL_GET_Y_CMYK8888(pix);
+			M[i] = GP_PIXEL_GET_M_CMYK8888(pix);
+			C[i] = GP_PIXEL_GET_C_CMYK8888(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t K_sum = MUL/2;
+			int *pK = K + y;
+			int32_t Y_sum = MUL/2;
+			int *pY = Y + y;
+			int32_t M_sum = MUL/2;
+			int *pM = M + y;
+			int32_t C_sum = MUL/2;
+			int *pC = C + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				K_sum += (*pK++) * ikernel[i];
+				Y_sum += (*pY++) * ikernel[i];
+				M_sum += (*pM++) * ikernel[i];
+				C_sum += (*pC++) * ikernel[i];
+			}
+
+			/* divide the result */
+			K_sum /= ikern_div;
+			Y_sum /= ikern_div;
+			M_sum /= ikern_div;
+			C_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			K_sum = GP_CLAMP(K_sum, 0, 255);
+			Y_sum = GP_CLAMP(Y_sum, 0, 255);
+			M_sum = GP_CLAMP(M_sum, 0, 255);
+			C_sum = GP_CLAMP(C_sum, 0, 255);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_CMYK8888(
+					      K_sum, Y_sum, M_sum, C_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G1(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_1BPP_LE(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_1BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G1(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 1);
+
+			gp_putpixel_raw_1BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G1(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G2(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_2BPP_LE(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_2BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G2(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 3);
+
+			gp_putpixel_raw_2BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G2(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G4(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_4BPP_LE(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_4BPP_LE(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G4(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 15);
+
+			gp_putpixel_raw_4BPP_LE(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G4(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G8(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   1, 0xff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_8BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G8(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G8(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G8(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 255);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G8(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_GA88(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   2, 0xffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 2 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88(pix);
+			A[i] = GP_PIXEL_GET_A_GA88(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_GA88(pix);
+			A[i] = GP_PIXEL_GET_A_GA88(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_GA88(pix);
+			A[i] = GP_PIXEL_GET_A_GA88(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+			int32_t A_sum = MUL/2;
+			int *pA = A + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 255);
+			A_sum = GP_CLAMP(A_sum, 0, 255);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_GA88(
+					      V_sum, A_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_G16(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 1 * size * sizeof(int));
+
+	int *V = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_16BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			V[i] = GP_PIXEL_GET_V_G16(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t V_sum = MUL/2;
+			int *pV = V + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				V_sum += (*pV++) * ikernel[i];
+			}
+
+			/* divide the result */
+			V_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			V_sum = GP_CLAMP(V_sum, 0, 65535);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_G16(
+					      V_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int v_lin_conv_RGBA8888_PM(const gp_pixmap *src,
+                                    gp_coord x_src, gp_coord y_src,
+                                    gp_size w_src, gp_size h_src,
+                                    gp_pixmap *dst,
+                                    gp_coord x_dst, gp_coord y_dst,
+                                    float kernel[], uint32_t kh, float kern_div,
+                                    gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	uint32_t i;
+	int ikernel[kh], ikern_div;
+	uint32_t size = h_src + kh - 1;
+
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   4, 0xffffffff,
+		                                   callback);
+	}
+
+	for (i = 0; i < kh; i++)
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+	ikern_div = kern_div * MUL + 0.5;
+
+	/* Create temporary buffers */
+	gp_temp_alloc_create(temp, 4 * size * sizeof(int));
+
+	int *R = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *G = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *B = gp_temp_alloc_get(temp, size * sizeof(int));
+	int *A = gp_temp_alloc_get(temp, size * sizeof(int));
+
+	/* Do vertical linear convolution */
+	for (x = 0; x < (gp_coord)w_src; x++) {
+		int xi = GP_MIN(x_src + x, (int)src->w - 1);
+
+		/* Fetch the whole row */
+		gp_pixel pix = gp_getpixel_raw_32BPP(src, xi, 0);
+
+		int yi = y_src - kh/2;
+		i = 0;
+
+		/* Copy border pixel until the source image starts */
+		while (yi <= 0 && i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Use as much source image pixels as possible */
+		while (yi < (int)src->h && i < size) {
+			pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+			R[i] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+
+			i++;
+			yi++;
+		}
+
+		/* Copy the rest the border pixel when we are out again */
+		while (i < size) {
+			R[i] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+			G[i] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+			B[i] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+			A[i] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+
+			i++;
+		}
+
+		for (y = 0; y < (gp_coord)h_src; y++) {
+			int32_t R_sum = MUL/2;
+			int *pR = R + y;
+			int32_t G_sum = MUL/2;
+			int *pG = G + y;
+			int32_t B_sum = MUL/2;
+			int *pB = B + y;
+			int32_t A_sum = MUL/2;
+			int *pA = A + y;
+
+			/* count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kh; i++) {
+				R_sum += (*pR++) * ikernel[i];
+				G_sum += (*pG++) * ikernel[i];
+				B_sum += (*pB++) * ikernel[i];
+				A_sum += (*pA++) * ikernel[i];
+			}
+
+			/* divide the result */
+			R_sum /= ikern_div;
+			G_sum /= ikern_div;
+			B_sum /= ikern_div;
+			A_sum /= ikern_div;
+
+			/* and clamp just to be extra sure */
+			R_sum = GP_CLAMP(R_sum, 0, 255);
+			G_sum = GP_CLAMP(G_sum, 0, 255);
+			B_sum = GP_CLAMP(B_sum, 0, 255);
+			A_sum = GP_CLAMP(A_sum, 0, 255);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGBA8888_PM(
+					      R_sum, G_sum, B_sum, A_sum
+					      ));
+		}
+
+		if (gp_progress_cb_report(callback, x, w_src, h_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_vlinear_convolution_raw(const gp_pixmap *src,
+                                      gp_coord x_src, gp_coord y_src,
+                                      gp_size w_src, gp_size h_src,
+                                      gp_pixmap *dst,
+                                      gp_coord x_dst, gp_coord y_dst,
+                                      float kernel[], uint32_t kh, float kern_div,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Vertical linear convolution kernel width %u "
+	            "offset %ix%i rectangle %ux%u",
+		    kh, x_src, y_src, w_src, h_src);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return v_lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return v_lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return v_lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return v_lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return v_lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return v_lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return v_lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return v_lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return v_lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1:
+		return v_lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return v_lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return v_lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return v_lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return v_lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return v_lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return v_lin_conv_RGBA8888_PM(src, x_src, y_src, w_src, h_src,
+                                                dst, x_dst, y_dst,
+		                                kernel, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+
+static int lin_conv_xRGB8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_xRGB8888(pix);
+				G[i][j] = GP_PIXEL_GET_G_xRGB8888(pix);
+				B[i][j] = GP_PIXEL_GET_B_xRGB8888(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_xRGB8888(pix);
+				G[idx][j] = GP_PIXEL_GET_G_xRGB8888(pix);
+				B[idx][j] = GP_PIXEL_GET_B_xRGB8888(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 255);
+			int G_res = GP_CLAMP((int)G_sum, 0, 255);
+			int B_res = GP_CLAMP((int)B_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_xRGB8888(R_res, G_res, B_res);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		uint32_t A[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGBA8888(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGBA8888(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGBA8888(pix);
+				A[i][j] = GP_PIXEL_GET_A_RGBA8888(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGBA8888(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGBA8888(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGBA8888(pix);
+				A[idx][j] = GP_PIXEL_GET_A_RGBA8888(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+					A_sum += A[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 255);
+			int G_res = GP_CLAMP((int)G_sum, 0, 255);
+			int B_res = GP_CLAMP((int)B_sum, 0, 255);
+			int A_res = GP_CLAMP((int)A_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGBA8888(R_res, G_res, B_res, A_res);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB888(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGB888(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGB888(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB888(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGB888(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGB888(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 255);
+			int G_res = GP_CLAMP((int)G_sum, 0, 255);
+			int B_res = GP_CLAMP((int)B_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGB888(R_res, G_res, B_res);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_BGR888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t B[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t R[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				B[i][j] = GP_PIXEL_GET_B_BGR888(pix);
+				G[i][j] = GP_PIXEL_GET_G_BGR888(pix);
+				R[i][j] = GP_PIXEL_GET_R_BGR888(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float B_sum = 0;
+			float G_sum = 0;
+			float R_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+				B[idx][j] = GP_PIXEL_GET_B_BGR888(pix);
+				G[idx][j] = GP_PIXEL_GET_G_BGR888(pix);
+				R[idx][j] = GP_PIXEL_GET_R_BGR888(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					B_sum += B[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					R_sum += R[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			B_sum /= kern_div;
+			G_sum /= kern_div;
+			R_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int B_res = GP_CLAMP((int)B_sum, 0, 255);
+			int G_res = GP_CLAMP((int)G_sum, 0, 255);
+			int R_res = GP_CLAMP((int)R_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_BGR888(B_res, G_res, R_res);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB555(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB555(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGB555(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGB555(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB555(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGB555(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGB555(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 31);
+			int G_res = GP_CLAMP((int)G_sum, 0, 31);
+			int B_res = GP_CLAMP((int)B_sum, 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB555(R_res, G_res, B_res);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB565(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB565(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGB565(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGB565(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB565(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGB565(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGB565(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 31);
+			int G_res = GP_CLAMP((int)G_sum, 0, 63);
+			int B_res = GP_CLAMP((int)B_sum, 0, 31);
+
+			pix = GP_PIXEL_CREATE_RGB565(R_res, G_res, B_res);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB666(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_18BPP_LE(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB666(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGB666(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGB666(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_18BPP_LE(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB666(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGB666(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGB666(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 63);
+			int G_res = GP_CLAMP((int)G_sum, 0, 63);
+			int B_res = GP_CLAMP((int)B_sum, 0, 63);
+
+			pix = GP_PIXEL_CREATE_RGB666(R_res, G_res, B_res);
+
+			gp_putpixel_raw_18BPP_LE(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGB332(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGB332(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGB332(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGB332(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGB332(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGB332(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGB332(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 7);
+			int G_res = GP_CLAMP((int)G_sum, 0, 7);
+			int B_res = GP_CLAMP((int)B_sum, 0, 3);
+
+			pix = GP_PIXEL_CREATE_RGB332(R_res, G_res, B_res);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_CMYK8888(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t K[kw][kh];
+		uint32_t Y[kw][kh];
+		uint32_t M[kw][kh];
+		uint32_t C[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				K[i][j] = GP_PIXEL_GET_K_CMYK8888(pix);
+				Y[i][j] = GP_PIXEL_GET_Y_CMYK8888(pix);
+				M[i][j] = GP_PIXEL_GET_M_CMYK8888(pix);
+				C[i][j] = GP_PIXEL_GET_C_CMYK8888(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float K_sum = 0;
+			float Y_sum = 0;
+			float M_sum = 0;
+			float C_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				K[idx][j] = GP_PIXEL_GET_K_CMYK8888(pix);
+				Y[idx][j] = GP_PIXEL_GET_Y_CMYK8888(pix);
+				M[idx][j] = GP_PIXEL_GET_M_CMYK8888(pix);
+				C[idx][j] = GP_PIXEL_GET_C_CMYK8888(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					K_sum += K[i][j] * kernel[k + j * kw];
+					Y_sum += Y[i][j] * kernel[k + j * kw];
+					M_sum += M[i][j] * kernel[k + j * kw];
+					C_sum += C[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			K_sum /= kern_div;
+			Y_sum /= kern_div;
+			M_sum /= kern_div;
+			C_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int K_res = GP_CLAMP((int)K_sum, 0, 255);
+			int Y_res = GP_CLAMP((int)Y_sum, 0, 255);
+			int M_res = GP_CLAMP((int)M_sum, 0, 255);
+			int C_res = GP_CLAMP((int)C_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_CMYK8888(K_res, Y_res, M_res, C_res);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G1(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_LE(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G1(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_1BPP_LE(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G1(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 1);
+
+			pix = GP_PIXEL_CREATE_G1(V_res);
+
+			gp_putpixel_raw_1BPP_LE(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G2(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_LE(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G2(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_2BPP_LE(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G2(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 3);
+
+			pix = GP_PIXEL_CREATE_G2(V_res);
+
+			gp_putpixel_raw_2BPP_LE(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G4(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_LE(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G4(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_4BPP_LE(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G4(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 15);
+
+			pix = GP_PIXEL_CREATE_G4(V_res);
+
+			gp_putpixel_raw_4BPP_LE(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G8(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G8(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_8BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G8(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_G8(V_res);
+
+			gp_putpixel_raw_8BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_GA88(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		uint32_t A[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_GA88(pix);
+				A[i][j] = GP_PIXEL_GET_A_GA88(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+			float A_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_GA88(pix);
+				A[idx][j] = GP_PIXEL_GET_A_GA88(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+					A_sum += A[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 255);
+			int A_res = GP_CLAMP((int)A_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_GA88(V_res, A_res);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_G16(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t V[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[i][j] = GP_PIXEL_GET_V_G16(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float V_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_16BPP(src, xi, yi);
+
+				V[idx][j] = GP_PIXEL_GET_V_G16(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					V_sum += V[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			V_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int V_res = GP_CLAMP((int)V_sum, 0, 65535);
+
+			pix = GP_PIXEL_CREATE_G16(V_res);
+
+			gp_putpixel_raw_16BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+static int lin_conv_RGBA8888_PM(const gp_pixmap *src,
+                                  gp_coord x_src, gp_coord y_src,
+                                  gp_size w_src, gp_size h_src,
+                                  gp_pixmap *dst,
+                                  gp_coord x_dst, gp_coord y_dst,
+                                  float kernel[], uint32_t kw, uint32_t kh,
+                                  float kern_div, gp_progress_cb *callback)
+{
+	gp_coord x, y;
+	unsigned int i, j;
+
+	/* Do linear convolution */
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		uint32_t R[kw][kh];
+		uint32_t G[kw][kh];
+		uint32_t B[kw][kh];
+		uint32_t A[kw][kh];
+		gp_pixel pix;
+
+		/* Prefill the buffer on the start */
+		for (j = 0; j < kh; j++) {
+			for (i = 0; i < kw - 1; i++) {
+				int xi = x_src + i - kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[i][j] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+				G[i][j] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+				B[i][j] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+				A[i][j] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+			}
+		}
+
+		int idx = kw - 1;
+
+		for (x = 0; x < (gp_coord)w_src; x++) {
+			float R_sum = 0;
+			float G_sum = 0;
+			float B_sum = 0;
+			float A_sum = 0;
+
+			for (j = 0; j < kh; j++) {
+				int xi = x_src + x + kw/2;
+				int yi = y_src + y + j - kh/2;
+
+				xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+				yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+				pix = gp_getpixel_raw_32BPP(src, xi, yi);
+
+				R[idx][j] = GP_PIXEL_GET_R_RGBA8888_PM(pix);
+				G[idx][j] = GP_PIXEL_GET_G_RGBA8888_PM(pix);
+				B[idx][j] = GP_PIXEL_GET_B_RGBA8888_PM(pix);
+				A[idx][j] = GP_PIXEL_GET_A_RGBA8888_PM(pix);
+			}
+
+			/* Count the pixel value from neighbours weighted by kernel */
+			for (i = 0; i < kw; i++) {
+				int k;
+
+				if ((int)i < idx + 1)
+					k = kw - idx - 1 + i;
+				else
+					k = i - idx - 1;
+
+				for (j = 0; j < kh; j++) {
+					R_sum += R[i][j] * kernel[k + j * kw];
+					G_sum += G[i][j] * kernel[k + j * kw];
+					B_sum += B[i][j] * kernel[k + j * kw];
+					A_sum += A[i][j] * kernel[k + j * kw];
+				}
+			}
+
+			/* divide the result */
+			R_sum /= kern_div;
+			G_sum /= kern_div;
+			B_sum /= kern_div;
+			A_sum /= kern_div;
+
+			/* and clamp just to be extra sure */
+			int R_res = GP_CLAMP((int)R_sum, 0, 255);
+			int G_res = GP_CLAMP((int)G_sum, 0, 255);
+			int B_res = GP_CLAMP((int)B_sum, 0, 255);
+			int A_res = GP_CLAMP((int)A_sum, 0, 255);
+
+			pix = GP_PIXEL_CREATE_RGBA8888_PM(R_res, G_res, B_res, A_res);
+
+			gp_putpixel_raw_32BPP(dst, x_dst + x, y_dst + y, pix);
+
+			idx++;
+
+			if (idx >= (int)kw)
+				idx = 0;
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+
+int gp_filter_linear_convolution_raw(const gp_pixmap *src,
+                                     gp_coord x_src, gp_coord y_src,
+                                     gp_size w_src, gp_size h_src,
+                                     gp_pixmap *dst,
+                                     gp_coord x_dst, gp_coord y_dst,
+                                     float kernel[], uint32_t kw, uint32_t kh,
+                                     float kern_div, gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Linear convolution kernel %ix%i rectangle %ux%u",
+	            kw, kh, w_src, h_src);
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return lin_conv_xRGB8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return lin_conv_RGBA8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return lin_conv_RGB888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return lin_conv_BGR888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return lin_conv_RGB555(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return lin_conv_RGB565(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return lin_conv_RGB666(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return lin_conv_RGB332(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return lin_conv_CMYK8888(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G1:
+		return lin_conv_G1(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G2:
+		return lin_conv_G2(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G4:
+		return lin_conv_G4(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G8:
+		return lin_conv_G8(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return lin_conv_GA88(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_G16:
+		return lin_conv_G16(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return lin_conv_RGBA8888_PM(src, x_src, y_src, w_src, h_src,
+                                              dst, x_dst, y_dst,
+		                              kernel, kw, kh, kern_div, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
@@ -15,10 +15,16 @@
 
 #include <filters/gp_linear.h>
 
+#include "gp_linear_convolution_8bpc.h"
+
 #define MUL 1024
 
+@ def chan_mask(pt):
+@     return hex(sum([c.mask for c in pt.chanslist]))
+@ end
+
 @ for pt in pixeltypes:
-@     if not pt.is_unknown() and not pt.is_palette():
+@     if not pt.is_unknown() and not pt.is_palette() and not pt.is_8bpc():
 
 static int h_lin_conv_{{ pt.name }}(const gp_pixmap *src,
                                     gp_coord x_src, gp_coord y_src,
@@ -143,9 +149,17 @@ int gp_filter_hlinear_convolution_raw(const gp_pixmap *src,
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 	case GP_PIXEL_{{ pt.name }}:
+@         if pt.is_8bpc():
+		return gp_hlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kw, kern_div,
+		                                   {{ pt.pixelsize.size // 8 }}, {{ chan_mask(pt) }},
+		                                   callback);
+@         else:
 		return h_lin_conv_{{ pt.name }}(src, x_src, y_src, w_src, h_src,
                                                 dst, x_dst, y_dst,
 		                                kernel, kw, kern_div, callback);
+@         end
 	break;
 @ end
 	default:
@@ -170,6 +184,17 @@ static int v_lin_conv_{{ pt.name }}(const gp_pixmap *src,
 	int ikernel[kh], ikern_div;
 	uint32_t size = h_src + kh - 1;
 
+@         if pt.is_8bpc():
+	/* Row based code works in-place only if dst rows are not ahead */
+	if (src != dst || y_dst <= y_src) {
+		return gp_vlinear_convolution_8bpc(src, x_src, y_src, w_src, h_src,
+		                                   dst, x_dst, y_dst,
+		                                   kernel, kh, kern_div,
+		                                   {{ pt.pixelsize.size // 8 }}, {{ chan_mask(pt) }},
+		                                   callback);
+	}
+
+@         end
 	for (i = 0; i < kh; i++)
 		ikernel[i] = kernel[i] * MUL + 0.5;
 
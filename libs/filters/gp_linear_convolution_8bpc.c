@@ -0,0 +1,516 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Linear convolution for 8 bit per channel pixel types.
+
+  The pixels are processed as rows of bytes, all channels at once. The
+  arithmetics is exactly the same as in the generic implementation, i.e. the
+  kernel is converted into fixed point with MUL, the sums are computed in
+  32 bit integers and then divided by the fixed point kernel divisor.
+
+  The SIMD implementations multiply pairs of 16 bit values, hence are used
+  only when the fixed point kernel fits into 16 bits, which is true unless the
+  kernel weights are larger than 32. The integer division is done in double
+  precision floating point, which gives exactly the same result as integer
+  division for 32 bit integers.
+
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_common.h>
+#include <core/gp_clamp.h>
+#include <core/gp_temp_alloc.h>
+#include <core/gp_debug.h>
+#include <core/gp_cpu.h>
+
+#include "gp_linear_convolution_8bpc.h"
+
+#define MUL 1024
+
+#ifdef GP_CPU_X86
+# include <immintrin.h>
+#endif
+
+struct conv_8bpc {
+	unsigned int ksize;
+	int div;
+	const int *ikernel;
+	/* Pairs of 16 bit kernel values for SIMD or NULL */
+	const int32_t *pairs;
+};
+
+static inline uint8_t div_clamp(int32_t sum, int div)
+{
+	sum /= div;
+
+	return GP_CLAMP(sum, 0, 255);
+}
+
+static void h_row_scalar(uint8_t *out, const uint8_t *ext, unsigned int n,
+                         unsigned int step, const struct conv_8bpc *conv)
+{
+	unsigned int j, k;
+
+	for (j = 0; j < n; j++) {
+		int32_t sum = MUL/2;
+		const uint8_t *p = ext + j;
+
+		for (k = 0; k < conv->ksize; k++) {
+			sum += *p * conv->ikernel[k];
+			p += step;
+		}
+
+		out[j] = div_clamp(sum, conv->div);
+	}
+}
+
+static void v_row_scalar(uint8_t *out, const uint8_t *const *rows,
+                         unsigned int off, unsigned int n,
+                         const struct conv_8bpc *conv)
+{
+	unsigned int j, k;
+
+	for (j = off; j < n; j++) {
+		int32_t sum = MUL/2;
+
+		for (k = 0; k < conv->ksize; k++)
+			sum += rows[k][j] * conv->ikernel[k];
+
+		out[j] = div_clamp(sum, conv->div);
+	}
+}
+
+#ifdef GP_CPU_X86
+
+__attribute__((target("sse2")))
+static inline __m128i sse2_div4(__m128i acc, __m128d div)
+{
+	__m128d lo = _mm_cvtepi32_pd(acc);
+	__m128d hi = _mm_cvtepi32_pd(_mm_shuffle_epi32(acc, _MM_SHUFFLE(1, 0, 3, 2)));
+
+	return _mm_unpacklo_epi64(_mm_cvttpd_epi32(_mm_div_pd(lo, div)),
+	                          _mm_cvttpd_epi32(_mm_div_pd(hi, div)));
+}
+
+__attribute__((target("sse2")))
+static inline void sse2_store8(uint8_t *out, __m128i acc0, __m128i acc1, __m128d div)
+{
+	__m128i res = _mm_packs_epi32(sse2_div4(acc0, div), sse2_div4(acc1, div));
+
+	_mm_storel_epi64((__m128i*)out, _mm_packus_epi16(res, res));
+}
+
+__attribute__((target("sse2")))
+static inline __m128i sse2_load8(const uint8_t *p)
+{
+	return _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i*)p), _mm_setzero_si128());
+}
+
+__attribute__((target("sse2")))
+static void h_row_sse2(uint8_t *out, const uint8_t *ext, unsigned int n,
+                       unsigned int step, const struct conv_8bpc *conv)
+{
+	__m128d div = _mm_set1_pd(conv->div);
+	unsigned int j, k;
+
+	for (j = 0; j + 8 <= n; j += 8) {
+		__m128i acc0 = _mm_set1_epi32(MUL/2);
+		__m128i acc1 = acc0;
+		const uint8_t *p = ext + j;
+
+		for (k = 0; k + 1 < conv->ksize; k += 2) {
+			__m128i a = sse2_load8(p);
+			__m128i b = sse2_load8(p + step);
+			__m128i c = _mm_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+			p += 2 * step;
+		}
+
+		if (k < conv->ksize) {
+			__m128i a = sse2_load8(p);
+			__m128i c = _mm_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, a), c));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, a), c));
+		}
+
+		sse2_store8(out + j, acc0, acc1, div);
+	}
+
+	h_row_scalar(out + j, ext + j, n - j, step, conv);
+}
+
+__attribute__((target("sse2")))
+static void v_row_sse2(uint8_t *out, const uint8_t *const *rows,
+                       unsigned int n, const struct conv_8bpc *conv)
+{
+	__m128d div = _mm_set1_pd(conv->div);
+	unsigned int j, k;
+
+	for (j = 0; j + 8 <= n; j += 8) {
+		__m128i acc0 = _mm_set1_epi32(MUL/2);
+		__m128i acc1 = acc0;
+
+		for (k = 0; k + 1 < conv->ksize; k += 2) {
+			__m128i a = sse2_load8(rows[k] + j);
+			__m128i b = sse2_load8(rows[k+1] + j);
+			__m128i c = _mm_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+		}
+
+		if (k < conv->ksize) {
+			__m128i a = sse2_load8(rows[k] + j);
+			__m128i c = _mm_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, a), c));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, a), c));
+		}
+
+		sse2_store8(out + j, acc0, acc1, div);
+	}
+
+	v_row_scalar(out, rows, j, n, conv);
+}
+
+__attribute__((target("avx2")))
+static inline __m128i avx2_div4(__m128i acc, __m256d div)
+{
+	return _mm256_cvttpd_epi32(_mm256_div_pd(_mm256_cvtepi32_pd(acc), div));
+}
+
+/*
+ * The madd on unpacked values works in 128 bit lanes, acc0 holds sums for
+ * bytes 0-3 and 8-11, acc1 for bytes 4-7 and 12-15.
+ */
+__attribute__((target("avx2")))
+static inline void avx2_store16(uint8_t *out, __m256i acc0, __m256i acc1, __m256d div)
+{
+	__m256i s0 = _mm256_permute2x128_si256(acc0, acc1, 0x20);
+	__m256i s1 = _mm256_permute2x128_si256(acc0, acc1, 0x31);
+
+	__m128i r0 = _mm_packs_epi32(avx2_div4(_mm256_castsi256_si128(s0), div),
+	                             avx2_div4(_mm256_extracti128_si256(s0, 1), div));
+	__m128i r1 = _mm_packs_epi32(avx2_div4(_mm256_castsi256_si128(s1), div),
+	                             avx2_div4(_mm256_extracti128_si256(s1, 1), div));
+
+	_mm_storeu_si128((__m128i*)out, _mm_packus_epi16(r0, r1));
+}
+
+__attribute__((target("avx2")))
+static inline __m256i avx2_load16(const uint8_t *p)
+{
+	return _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)p));
+}
+
+__attribute__((target("avx2")))
+static void h_row_avx2(uint8_t *out, const uint8_t *ext, unsigned int n,
+                       unsigned int step, const struct conv_8bpc *conv)
+{
+	__m256d div = _mm256_set1_pd(conv->div);
+	unsigned int j, k;
+
+	for (j = 0; j + 16 <= n; j += 16) {
+		__m256i acc0 = _mm256_set1_epi32(MUL/2);
+		__m256i acc1 = acc0;
+		const uint8_t *p = ext + j;
+
+		for (k = 0; k + 1 < conv->ksize; k += 2) {
+			__m256i a = avx2_load16(p);
+			__m256i b = avx2_load16(p + step);
+			__m256i c = _mm256_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c));
+			acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c));
+			p += 2 * step;
+		}
+
+		if (k < conv->ksize) {
+			__m256i a = avx2_load16(p);
+			__m256i c = _mm256_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, a), c));
+			acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, a), c));
+		}
+
+		avx2_store16(out + j, acc0, acc1, div);
+	}
+
+	h_row_scalar(out + j, ext + j, n - j, step, conv);
+}
+
+__attribute__((target("avx2")))
+static void v_row_avx2(uint8_t *out, const uint8_t *const *rows,
+                       unsigned int n, const struct conv_8bpc *conv)
+{
+	__m256d div = _mm256_set1_pd(conv->div);
+	unsigned int j, k;
+
+	for (j = 0; j + 16 <= n; j += 16) {
+		__m256i acc0 = _mm256_set1_epi32(MUL/2);
+		__m256i acc1 = acc0;
+
+		for (k = 0; k + 1 < conv->ksize; k += 2) {
+			__m256i a = avx2_load16(rows[k] + j);
+			__m256i b = avx2_load16(rows[k+1] + j);
+			__m256i c = _mm256_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c));
+			acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c));
+		}
+
+		if (k < conv->ksize) {
+			__m256i a = avx2_load16(rows[k] + j);
+			__m256i c = _mm256_set1_epi32(conv->pairs[k/2]);
+
+			acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, a), c));
+			acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, a), c));
+		}
+
+		avx2_store16(out + j, acc0, acc1, div);
+	}
+
+	v_row_scalar(out, rows, j, n, conv);
+}
+
+#endif /* GP_CPU_X86 */
+
+static void v_row_scalar_all(uint8_t *out, const uint8_t *const *rows,
+                             unsigned int n, const struct conv_8bpc *conv)
+{
+	v_row_scalar(out, rows, 0, n, conv);
+}
+
+typedef void (*h_row_fn)(uint8_t *out, const uint8_t *ext, unsigned int n,
+                         unsigned int step, const struct conv_8bpc *conv);
+
+typedef void (*v_row_fn)(uint8_t *out, const uint8_t *const *rows,
+                         unsigned int n, const struct conv_8bpc *conv);
+
+static const gp_cpu_impl h_row_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, h_row_avx2},
+	{GP_CPU_SSE2, h_row_sse2},
+#endif
+	{0, h_row_scalar},
+};
+
+static const gp_cpu_impl v_row_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, v_row_avx2},
+	{GP_CPU_SSE2, v_row_sse2},
+#endif
+	{0, v_row_scalar_all},
+};
+
+GP_CPU_DISPATCH(h_row_simd, h_row_fn, h_row_impls);
+GP_CPU_DISPATCH(v_row_simd, v_row_fn, v_row_impls);
+
+/*
+ * Converts kernel into fixed point, exactly as the generic implementation does.
+ */
+static void conv_init(struct conv_8bpc *conv, int *ikernel, int32_t *pairs,
+                      float kernel[], uint32_t ksize, float kern_div)
+{
+	uint32_t i;
+	int fits_16 = 1;
+
+	for (i = 0; i < ksize; i++) {
+		ikernel[i] = kernel[i] * MUL + 0.5;
+
+		if (ikernel[i] < INT16_MIN || ikernel[i] > INT16_MAX)
+			fits_16 = 0;
+	}
+
+	for (i = 0; i < ksize; i += 2) {
+		uint32_t hi = i + 1 < ksize ? (uint16_t)ikernel[i+1] : 0;
+
+		pairs[i/2] = (hi << 16) | (uint16_t)ikernel[i];
+	}
+
+	conv->ksize = ksize;
+	conv->div = kern_div * MUL + 0.5;
+	conv->ikernel = ikernel;
+	conv->pairs = fits_16 ? pairs : NULL;
+}
+
+/*
+ * Copies w pixels starting at x from a row, clamps at the right border.
+ */
+static void fetch_row(uint8_t *buf, const gp_pixmap *src, gp_coord x,
+                      gp_coord y, gp_size w, unsigned int bpp)
+{
+	const uint8_t *row = src->pixels + (size_t)y * src->bytes_per_row;
+	gp_size avail = (gp_size)x < src->w ? GP_MIN(w, src->w - x) : 0;
+	gp_size i;
+
+	if (!avail) {
+		x = src->w - 1;
+		avail = 1;
+	}
+
+	memcpy(buf, row + x * bpp, avail * bpp);
+
+	for (i = avail; i < w; i++)
+		memcpy(buf + i * bpp, buf + (avail - 1) * bpp, bpp);
+}
+
+static void clear_pad(uint8_t *out, gp_size w, unsigned int bpp,
+                      gp_pixel chan_mask)
+{
+	uint8_t mask[sizeof(gp_pixel)];
+	unsigned int i;
+	gp_size x;
+
+	if (bpp != sizeof(gp_pixel))
+		return;
+
+	memcpy(mask, &chan_mask, sizeof(mask));
+
+	for (i = 0; i < bpp; i++) {
+		if (mask[i])
+			continue;
+
+		for (x = 0; x < w; x++)
+			out[x * bpp + i] = 0;
+	}
+}
+
+int gp_hlinear_convolution_8bpc(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float kernel[], uint32_t kw, float kern_div,
+                                unsigned int bpp, gp_pixel chan_mask,
+                                gp_progress_cb *callback)
+{
+	struct conv_8bpc conv;
+	int ikernel[kw];
+	int32_t pairs[(kw + 1) / 2];
+	gp_size size = w_src + kw - 1;
+	gp_coord y;
+	uint8_t *ext;
+	h_row_fn h_row;
+
+	conv_init(&conv, ikernel, pairs, kernel, kw, kern_div);
+
+	h_row = conv.pairs ? h_row_simd() : h_row_scalar;
+
+	ext = gp_temp_alloc(size * bpp);
+
+	if (!ext) {
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)h_src; y++) {
+		gp_coord yi = GP_MIN(y_src + y, (int)src->h - 1);
+		gp_coord xi = x_src - (int)kw/2;
+		gp_size l = 0;
+		uint8_t *out = GP_PIXEL_ADDR(dst, x_dst, y_dst + y);
+		gp_size i;
+
+		/* Left border, replicate the first pixel */
+		if (xi < 0) {
+			l = GP_MIN((gp_size)-xi, size);
+			fetch_row(ext, src, 0, yi, 1, bpp);
+			for (i = 1; i < l; i++)
+				memcpy(ext + i * bpp, ext, bpp);
+			xi = 0;
+		}
+
+		/* Rest of the row, right border is replicated by fetch_row() */
+		if (l < size)
+			fetch_row(ext + l * bpp, src, xi, yi, size - l, bpp);
+
+		h_row(out, ext, w_src * bpp, bpp, &conv);
+
+		clear_pad(out, w_src, bpp, chan_mask);
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_free(size * bpp, ext);
+			return 1;
+		}
+	}
+
+	gp_temp_free(size * bpp, ext);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+int gp_vlinear_convolution_8bpc(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float kernel[], uint32_t kh, float kern_div,
+                                unsigned int bpp, gp_pixel chan_mask,
+                                gp_progress_cb *callback)
+{
+	struct conv_8bpc conv;
+	int ikernel[kh];
+	int32_t pairs[(kh + 1) / 2];
+	const uint8_t *rows[kh];
+	size_t row_size = (size_t)w_src * bpp;
+	gp_coord y;
+	uint32_t k;
+	uint8_t *ring;
+	v_row_fn v_row;
+
+	conv_init(&conv, ikernel, pairs, kernel, kh, kern_div);
+
+	v_row = conv.pairs ? v_row_simd() : v_row_scalar_all;
+
+	/*
+	 * Ring buffer of kh source rows, each source row is copied once before
+	 * any destination row that may overwrite it is written.
+	 */
+	ring = malloc(row_size * kh);
+
+	if (!ring) {
+		GP_DEBUG(1, "Malloc failed :(");
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (y = 0; y < (gp_coord)(h_src + kh - 1); y++) {
+		gp_coord yi = GP_CLAMP(y_src - (int)kh/2 + y, 0, (int)src->h - 1);
+
+		fetch_row(ring + (y % kh) * row_size, src, x_src, yi, w_src, bpp);
+
+		if (y < (gp_coord)kh - 1)
+			continue;
+
+		gp_coord yo = y - (kh - 1);
+		uint8_t *out = GP_PIXEL_ADDR(dst, x_dst, y_dst + yo);
+
+		for (k = 0; k < kh; k++)
+			rows[k] = ring + ((yo + k) % kh) * row_size;
+
+		v_row(out, rows, row_size, &conv);
+
+		clear_pad(out, w_src, bpp, chan_mask);
+
+		if (gp_progress_cb_report(callback, yo, h_src, w_src)) {
+			free(ring);
+			return 1;
+		}
+	}
+
+	free(ring);
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
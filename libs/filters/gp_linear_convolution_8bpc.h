@@ -0,0 +1,51 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Linear convolution for pixel types with 8 bit per channel byte aligned
+   channels, i.e. RGB888, xRGB8888, RGBA8888, G8, etc.
+
+   These work on whole rows of bytes and all channels at once and use SIMD
+   instructions, picked at runtime, where available. The results are exactly
+   the same as the results of the generic implementation.
+
+  */
+
+#ifndef FILTERS_GP_LINEAR_CONVOLUTION_8BPC_H
+#define FILTERS_GP_LINEAR_CONVOLUTION_8BPC_H
+
+#include <core/gp_pixmap.h>
+#include <core/gp_progress_callback.h>
+
+/*
+ * The bpp is a pixel size in bytes and chan_mask is a mask of the channel bits
+ * in a pixel value. Pixel bytes that are not part of any channel (i.e. the x
+ * in xRGB8888) are set to zero in the output.
+ */
+int gp_hlinear_convolution_8bpc(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float kernel[], uint32_t kw, float kern_div,
+                                unsigned int bpp, gp_pixel chan_mask,
+                                gp_progress_cb *callback)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Works in-place as long as y_dst <= y_src.
+ */
+int gp_vlinear_convolution_8bpc(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+                                float kernel[], uint32_t kh, float kern_div,
+                                unsigned int bpp, gp_pixel chan_mask,
+                                gp_progress_cb *callback)
+	__attribute__ ((visibility ("hidden")));
+
+#endif /* FILTERS_GP_LINEAR_CONVOLUTION_8BPC_H */
@@ -3,11 +3,6 @@
  * Copyright (C) 2009-2012 Cyril Hrubis <metan@ucw.cz>
  */
 
-#include <unistd.h>
-#include <pthread.h>
-#include <string.h>
-#include <errno.h>
-
 #include "core/gp_common.h"
 #include <core/gp_debug.h>
 #include <core/gp_threads.h>
@@ -15,201 +10,62 @@
 #include <filters/gp_linear.h>
 #include <filters/gp_linear_threads.h>
 
-static void *h_linear_convolution(void *arg)
-{
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
-
-	if (gp_filter_hconvolution_raw(params))
-		ret = errno;
-
-	return (void*)ret;
-}
+struct conv_rows {
+	const gp_convolution_params *params;
+	int (*conv)(const gp_convolution_params *params);
+};
 
-static void *v_linear_convolution(void *arg)
+static int conv_rows(void *priv, gp_coord y, gp_size h)
 {
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
+	const struct conv_rows *rows = priv;
+	gp_convolution_params params = *rows->params;
 
-	if (gp_filter_vconvolution_raw(params))
-		ret = errno;
+	params.y_src += y;
+	params.y_dst += y;
+	params.h_src = h;
+	params.callback = NULL;
 
-	return (void*)ret;
+	return rows->conv(&params);
 }
 
-static void *linear_convolution(void *arg)
+static int convolution_mp(const gp_convolution_params *params,
+                          int (*conv)(const gp_convolution_params *params))
 {
-	struct gp_convolution_params *params = arg;
-	long ret = 0;
-
-	if (gp_filter_convolution_raw(params))
-		ret = errno;
-
-	return (void*)ret;
-}
-
-int gp_filter_hconvolution_mp_raw(const gp_convolution_params *params)
-{
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
+	unsigned int t = gp_nr_threads(params->w_src, params->h_src,
+	                               params->callback);
+	gp_size bpr = GP_CALC_ROW_SIZE(params->src->pixel_type, params->w_src);
+	gp_size band_h;
+	struct conv_rows rows = {
+		.params = params,
+		.conv = conv,
+	};
 
 	if (t == 1)
-		return gp_filter_hconvolution_raw(params);
+		return conv(params);
 
 	if (params->src == params->dst) {
 		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_hconvolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-		pthread_create(&threads[i], NULL, h_linear_convolution, &convs[i]);
+		return conv(params);
 	}
 
-	int err = 0;
+	band_h = gp_threads_band_rows(params->h_src, t, bpr,
+	                              params->kw * params->kh, params->kh);
 
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
-	}
-
-	return 0;
+	return gp_threads_rows_ex(params->h_src, t, band_h, conv_rows, &rows,
+	                          params->callback);
 }
 
+int gp_filter_hconvolution_mp_raw(const gp_convolution_params *params)
+{
+	return convolution_mp(params, gp_filter_hconvolution_raw);
+}
 
 int gp_filter_vconvolution_mp_raw(const gp_convolution_params *params)
 {
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
-
-	if (t == 1)
-		return gp_filter_vconvolution_raw(params);
-
-	if (params->src == params->dst) {
-		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_vconvolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-
-		pthread_create(&threads[i], NULL, v_linear_convolution, &convs[i]);
-	}
-
-	int err = 0;
-
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
-	}
-
-	return 0;
+	return convolution_mp(params, gp_filter_vconvolution_raw);
 }
 
-
 int gp_filter_convolution_mp_raw(const gp_convolution_params *params)
 {
-	int i, t = gp_nr_threads(params->w_src, params->h_src,
-				 params->callback);
-
-	if (t == 1)
-		return gp_filter_convolution_raw(params);
-
-	if (params->src == params->dst) {
-		GP_DEBUG(1, "In-place filter detected, running in one thread.");
-		return gp_filter_convolution_raw(params);
-	}
-
-	GP_PROGRESS_CALLBACK_MP(callback_mp, params->callback);
-
-	/* Run t threads */
-	pthread_t threads[t];
-	struct gp_convolution_params convs[t];
-	gp_size h = params->h_src/t;
-
-	for (i = 0; i < t; i++) {
-		gp_coord y_src_2 = params->y_src + i * h;
-		gp_coord y_dst_2 = params->y_dst + i * h;
-		gp_size  h_src_2 = h;
-
-		if (i == t - 1)
-			h_src_2 = params->h_src - i * h;
-
-		convs[i] = *params;
-		convs[i].y_src = y_src_2;
-		convs[i].h_src = h_src_2;
-		convs[i].y_dst = y_dst_2;
-		convs[i].callback = params->callback ? &callback_mp : NULL;
-
-		pthread_create(&threads[i], NULL, linear_convolution, &convs[i]);
-	}
-
-	int err = 0;
-
-	for (i = 0; i < t; i++) {
-		long r;
-		pthread_join(threads[i], (void*)&r);
-
-		if (r)
-			err = r;
-	}
-
-	if (err) {
-		errno = err;
-		return -1;
-	}
-
-	return 0;
+	return convolution_mp(params, gp_filter_convolution_raw);
 }
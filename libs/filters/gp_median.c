@@ -10,6 +10,7 @@
 #include <core/gp_temp_alloc.h>
 #include "core/gp_clamp.h"
 #include <core/gp_debug.h>
+#include <core/gp_threads.h>
 
 #include <filters/gp_median.h>
 
@@ -149,42 +150,41 @@ static inline unsigned int hist8_median(struct hist8u *h, struct hist8 *row,
 	return 0;
 }
 
-static int gp_filter_median_raw(const gp_pixmap *src,
-                                gp_coord x_src, gp_coord y_src,
-                                gp_size w_src, gp_size h_src,
-                                gp_pixmap *dst,
-                                gp_coord x_dst, gp_coord y_dst,
-		                int xmed, int ymed,
-                                gp_progress_cb *callback)
+/*
+ * Size of the buffer for row of histograms, the row is w + 2*xmed + 1 wide
+ * because we read the last value but we don't use it.
+ */
+static size_t median_buf_size(gp_size w_src, int xmed)
 {
-	int i, x, y;
-	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+	size_t size = w_src + 2 * xmed + 1;
 
-	if (src->pixel_type != GP_PIXEL_RGB888) {
-		errno = ENOSYS;
-		return -1;
-	}
-
-	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
-	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+	return 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u);
+}
 
-	/* The buffer is w + 2*xmed + 1 size because we read the last value but we don't use it */
+static int median_rows(const gp_pixmap *src,
+                       gp_coord x_src, gp_coord y_src,
+                       gp_size w_src, gp_size h_src,
+                       gp_pixmap *dst,
+                       gp_coord x_dst, gp_coord y_dst,
+                       int xmed, int ymed, void *buf,
+                       gp_progress_cb *callback)
+{
+	int i, x, y;
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
 	unsigned int size = (w_src + 2 * xmed + 1);
 
-	/* Create and initalize arrays for row of histograms */
-	gp_temp_alloc_create(temp, 3 * sizeof(struct hist8) * size + 3 * sizeof(struct hist8u));
-
-	struct hist8 *R = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
-	struct hist8 *G = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
-	struct hist8 *B = gp_temp_alloc_get(temp, sizeof(struct hist8) * size);
+	/* Initalize arrays for row of histograms */
+	struct hist8 *R = buf;
+	struct hist8 *G = R + size;
+	struct hist8 *B = G + size;
 
 	memset(R, 0, sizeof(*R) * size);
 	memset(G, 0, sizeof(*G) * size);
 	memset(B, 0, sizeof(*B) * size);
 
-	struct hist8u *XR = gp_temp_alloc_get(temp, sizeof(struct hist8u));
-	struct hist8u *XG = gp_temp_alloc_get(temp, sizeof(struct hist8u));
-	struct hist8u *XB = gp_temp_alloc_get(temp, sizeof(struct hist8u));
+	struct hist8u *XR = (struct hist8u *)(B + size);
+	struct hist8u *XG = XR + 1;
+	struct hist8u *XB = XG + 1;
 
 	/* Prefill row of histograms */
 	for (x = 0; x < (int)w_src + 2*xmed; x++) {
@@ -253,18 +253,144 @@ static int gp_filter_median_raw(const gp_pixmap *src,
 			hist8_inc(B, x, GP_PIXEL_GET_B_RGB888(pix));
 		}
 
-		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
-			gp_temp_alloc_free(temp);
+		if (gp_progress_cb_report(callback, y, h_src, w_src))
 			return 1;
-		}
 	}
 
-	gp_temp_alloc_free(temp);
 	gp_progress_cb_done(callback);
 
 	return 0;
 }
 
+static int gp_filter_median_raw(const gp_pixmap *src,
+                                gp_coord x_src, gp_coord y_src,
+                                gp_size w_src, gp_size h_src,
+                                gp_pixmap *dst,
+                                gp_coord x_dst, gp_coord y_dst,
+		                int xmed, int ymed,
+                                gp_progress_cb *callback)
+{
+	size_t size = median_buf_size(w_src, xmed);
+	int ret;
+
+	if (src->pixel_type != GP_PIXEL_RGB888) {
+		errno = ENOSYS;
+		return -1;
+	}
+
+	GP_DEBUG(1, "Median filter size %ux%u xmed=%u ymed=%u",
+	            w_src, h_src, 2 * xmed + 1, 2 * ymed + 1);
+
+	gp_temp_alloc_create(temp, size);
+
+	ret = median_rows(src, x_src, y_src, w_src, h_src, dst, x_dst, y_dst,
+	                  xmed, ymed, gp_temp_alloc_get(temp, size), callback);
+
+	gp_temp_alloc_free(temp);
+
+	return ret;
+}
+
+/*
+ * The image is split into vertical stripes, each stripe keeps its own row of
+ * column histograms, which are xmed wider on each side than the stripe, so
+ * that the stripes are independent and could be processed in parallel.
+ *
+ * The results are exactly the same as for the whole image processed at once
+ * since the borders are clamped to the source pixmap, not to the stripe.
+ *
+ * The buffers for the rows of histograms are allocated once per thread.
+ */
+struct median_stripes {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xmed, ymed;
+	gp_size stripe_w;
+	gp_threads_slots bufs;
+};
+
+static int median_stripes(void *priv, gp_coord i, gp_size n)
+{
+	struct median_stripes *s = priv;
+	gp_coord x, x_end = GP_MIN((i + n) * s->stripe_w, s->w_src);
+	unsigned int slot;
+	void *buf;
+	int ret = 0;
+
+	buf = gp_threads_slot_get(&s->bufs, &slot);
+	if (!buf)
+		return 1;
+
+	for (x = i * s->stripe_w; x < x_end && !ret; x += s->stripe_w) {
+		gp_size w = GP_MIN(s->stripe_w, (gp_size)(x_end - x));
+
+		ret = median_rows(s->src, s->x_src + x, s->y_src, w, s->h_src,
+		                  s->dst, s->x_dst + x, s->y_dst,
+		                  s->xmed, s->ymed, buf, NULL);
+	}
+
+	gp_threads_slot_put(&s->bufs, slot);
+
+	return ret;
+}
+
+static int gp_filter_median_mp(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xmed, int ymed,
+                               gp_progress_cb *callback)
+{
+	unsigned int t = gp_nr_threads(w_src, h_src, callback);
+	gp_size stripe_w, stripes;
+	int ret;
+
+	if (src->pixel_type != GP_PIXEL_RGB888) {
+		return gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
+		                            dst, x_dst, y_dst, xmed, ymed, callback);
+	}
+
+	/*
+	 * Several stripes per thread for load balancing. The stripes are narrow
+	 * enough for the row of histograms to stay in cache, which is faster
+	 * even for a single thread, but wide enough so that the histogram
+	 * columns shared with neighbours are a small overhead.
+	 */
+	stripe_w = GP_MIN(w_src / (4 * t), 256u);
+	stripe_w = GP_MAX(stripe_w, GP_MAX(64u, 8u * xmed));
+	stripes = (w_src + stripe_w - 1) / stripe_w;
+
+	GP_DEBUG(1, "Median filter in %u threads %zu stripes %zupx wide",
+	         t, (size_t)stripes, (size_t)stripe_w);
+
+	struct median_stripes s = {
+		.src = src,
+		.x_src = x_src,
+		.y_src = y_src,
+		.w_src = w_src,
+		.h_src = h_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+		.xmed = xmed,
+		.ymed = ymed,
+		.stripe_w = stripe_w,
+	};
+
+	if (gp_threads_slots_alloc(&s.bufs, t, median_buf_size(stripe_w, xmed)))
+		return 1;
+
+	ret = gp_threads_rows_ex(stripes, t, 1, median_stripes, &s, callback);
+
+	gp_threads_slots_free(&s.bufs);
+
+	return ret;
+}
+
 int gp_filter_median_ex(const gp_pixmap *src,
                         gp_coord x_src, gp_coord y_src,
                         gp_size w_src, gp_size h_src,
@@ -281,8 +407,8 @@ int gp_filter_median_ex(const gp_pixmap *src,
 
 	GP_CHECK(xmed >= 0 && ymed >= 0);
 
-	return gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
-	                            dst, x_dst, y_dst, xmed, ymed, callback);
+	return gp_filter_median_mp(src, x_src, y_src, w_src, h_src,
+	                           dst, x_dst, y_dst, xmed, ymed, callback);
 }
 
 gp_pixmap *gp_filter_median_ex_alloc(const gp_pixmap *src,
@@ -300,7 +426,7 @@ gp_pixmap *gp_filter_median_ex_alloc(const gp_pixmap *src,
 	if (dst == NULL)
 		return NULL;
 
-	ret = gp_filter_median_raw(src, x_src, y_src, w_src, h_src,
+	ret = gp_filter_median_mp(src, x_src, y_src, w_src, h_src,
 	                          dst, 0, 0, xmed, ymed, callback);
 
 	if (ret) {
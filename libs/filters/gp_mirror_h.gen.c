@@ -0,0 +1,410 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_mirror_h.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:25 from gp_mirror_h.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Horizontal Mirror alogorithm
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_debug.h>
+#include <filters/gp_rotate.h>
+
+static int mirror_h_raw_1BPP_LE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_1BPP_LE(src, x, y);
+			gp_putpixel_raw_1BPP_LE(dst, x, y, gp_getpixel_raw_1BPP_LE(src, xm, y));
+			gp_putpixel_raw_1BPP_LE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_1BPP_LE(dst, x, y, gp_getpixel_raw_1BPP_LE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_1BPP_BE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_1BPP_BE(src, x, y);
+			gp_putpixel_raw_1BPP_BE(dst, x, y, gp_getpixel_raw_1BPP_BE(src, xm, y));
+			gp_putpixel_raw_1BPP_BE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_1BPP_BE(dst, x, y, gp_getpixel_raw_1BPP_BE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_2BPP_LE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_2BPP_LE(src, x, y);
+			gp_putpixel_raw_2BPP_LE(dst, x, y, gp_getpixel_raw_2BPP_LE(src, xm, y));
+			gp_putpixel_raw_2BPP_LE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_2BPP_LE(dst, x, y, gp_getpixel_raw_2BPP_LE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_2BPP_BE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_2BPP_BE(src, x, y);
+			gp_putpixel_raw_2BPP_BE(dst, x, y, gp_getpixel_raw_2BPP_BE(src, xm, y));
+			gp_putpixel_raw_2BPP_BE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_2BPP_BE(dst, x, y, gp_getpixel_raw_2BPP_BE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_4BPP_LE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_4BPP_LE(src, x, y);
+			gp_putpixel_raw_4BPP_LE(dst, x, y, gp_getpixel_raw_4BPP_LE(src, xm, y));
+			gp_putpixel_raw_4BPP_LE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_4BPP_LE(dst, x, y, gp_getpixel_raw_4BPP_LE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_4BPP_BE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_4BPP_BE(src, x, y);
+			gp_putpixel_raw_4BPP_BE(dst, x, y, gp_getpixel_raw_4BPP_BE(src, xm, y));
+			gp_putpixel_raw_4BPP_BE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_4BPP_BE(dst, x, y, gp_getpixel_raw_4BPP_BE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_8BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_8BPP(src, x, y);
+			gp_putpixel_raw_8BPP(dst, x, y, gp_getpixel_raw_8BPP(src, xm, y));
+			gp_putpixel_raw_8BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_8BPP(dst, x, y, gp_getpixel_raw_8BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_16BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_16BPP(src, x, y);
+			gp_putpixel_raw_16BPP(dst, x, y, gp_getpixel_raw_16BPP(src, xm, y));
+			gp_putpixel_raw_16BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_16BPP(dst, x, y, gp_getpixel_raw_16BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_24BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_24BPP(src, x, y);
+			gp_putpixel_raw_24BPP(dst, x, y, gp_getpixel_raw_24BPP(src, xm, y));
+			gp_putpixel_raw_24BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_24BPP(dst, x, y, gp_getpixel_raw_24BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_32BPP(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_32BPP(src, x, y);
+			gp_putpixel_raw_32BPP(dst, x, y, gp_getpixel_raw_32BPP(src, xm, y));
+			gp_putpixel_raw_32BPP(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_32BPP(dst, x, y, gp_getpixel_raw_32BPP(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int mirror_h_raw_18BPP_LE(const gp_pixmap *src,
+                                        gp_pixmap *dst,
+                                        gp_progress_cb *callback)
+{
+	uint32_t x, y;
+	gp_pixel tmp;
+
+	GP_DEBUG(1, "Mirroring image %ux%u horizontally", src->w, src->h);
+
+	for (x = 0; x < src->w/2; x++) {
+		uint32_t xm = src->w - x - 1;
+		for (y = 0; y < src->h; y++) {
+			tmp = gp_getpixel_raw_18BPP_LE(src, x, y);
+			gp_putpixel_raw_18BPP_LE(dst, x, y, gp_getpixel_raw_18BPP_LE(src, xm, y));
+			gp_putpixel_raw_18BPP_LE(dst, xm, y, tmp);
+		}
+
+		if (gp_progress_cb_report(callback, 2 * x, src->w, src->h))
+			return 1;
+	}
+
+	/* Copy the middle odd line */
+	if (src != dst && src->w % 2) {
+		x = src->w / 2;
+		for (y = 0; y < src->h; y++)
+			gp_putpixel_raw_18BPP_LE(dst, x, y, gp_getpixel_raw_18BPP_LE(src, x, y));
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int gp_filter_mirror_h_raw(const gp_pixmap *src, gp_pixmap *dst,
+                                  gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_BPP_PIXMAP(mirror_h_raw, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_mirror_h(const gp_pixmap *src, gp_pixmap *dst,
+                       gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (gp_filter_mirror_h_raw(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_mirror_h_alloc(const gp_pixmap *src,
+                                    gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (gp_filter_mirror_h_raw(src, res, callback)) {
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
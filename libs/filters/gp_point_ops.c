@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Point operations composed into a single set of lookup tables.
+
+  Since the point filters map each channel value independently the ops can be
+  applied on the tables instead of the pixels, which replaces a pass over the
+  image for each op with a single pass.
+
+ */
+
+#include <errno.h>
+
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_point.h>
+
+/* The same formulas as in the gp_*.gen.c.t point filters */
+static gp_pixel point_op(const gp_point_op *op, int val, int val_max)
+{
+	switch (op->type) {
+	case GP_POINT_BRIGHTNESS:
+		return GP_CLAMP_GENERIC(val + (op->b * val_max + 0.5), 0, val_max);
+	case GP_POINT_CONTRAST:
+		return GP_CLAMP_GENERIC(val * op->c + 0.5, 0, val_max);
+	case GP_POINT_BRIGHTNESS_CONTRAST:
+		return GP_CLAMP_GENERIC(op->c * val + op->b * val_max + 0.5, 0, val_max);
+	case GP_POINT_POSTERIZE:
+		return ((val + (val_max / op->steps)/2) / (val_max / op->steps)) * (val_max / op->steps);
+	case GP_POINT_INVERT:
+		return val_max - val;
+	}
+
+	return val;
+}
+
+static int check_op(const gp_point_op *op, const gp_pixel_type_desc *desc)
+{
+	unsigned int i;
+
+	switch (op->type) {
+	case GP_POINT_BRIGHTNESS:
+	case GP_POINT_CONTRAST:
+	case GP_POINT_BRIGHTNESS_CONTRAST:
+	case GP_POINT_INVERT:
+		return 0;
+	case GP_POINT_POSTERIZE:
+		for (i = 0; i < desc->numchannels; i++) {
+			gp_pixel chan_max = (1 << desc->channels[i].size) - 1;
+
+			if (!op->steps || op->steps > chan_max) {
+				GP_WARN("Invalid posterize steps %u for channel %s",
+				        op->steps, desc->channels[i].name);
+				return 1;
+			}
+		}
+		return 0;
+	}
+
+	GP_WARN("Invalid point op type %u", (unsigned int)op->type);
+	return 1;
+}
+
+int gp_filter_tables_point_ops(gp_filter_tables *self, const gp_pixmap *pixmap,
+                               const gp_point_op ops[], unsigned int ops_cnt)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixmap->pixel_type);
+	unsigned int i, k;
+	gp_pixel j;
+
+	for (k = 0; k < ops_cnt; k++) {
+		if (check_op(&ops[k], desc)) {
+			errno = EINVAL;
+			return 1;
+		}
+	}
+
+	GP_DEBUG(1, "Composing %u point ops for %s",
+	         ops_cnt, gp_pixel_type_name(pixmap->pixel_type));
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel chan_max = (1 << desc->channels[i].size);
+		gp_pixel *table = self->table[i];
+
+		for (j = 0; j < chan_max; j++) {
+			for (k = 0; k < ops_cnt; k++)
+				table[j] = point_op(&ops[k], table[j], chan_max - 1);
+		}
+	}
+
+	return 0;
+}
+
+int gp_filter_point_ops_ex(const gp_pixmap *src,
+                           gp_coord x_src, gp_coord y_src,
+                           gp_size w_src, gp_size h_src,
+                           gp_pixmap *dst,
+                           gp_coord x_dst, gp_coord y_dst,
+                           const gp_point_op ops[], unsigned int ops_cnt,
+                           gp_progress_cb *callback)
+{
+	gp_filter_tables tables;
+	int ret, err;
+
+	if (gp_filter_tables_init(&tables, src))
+		return 1;
+
+	if (gp_filter_tables_point_ops(&tables, src, ops, ops_cnt)) {
+		gp_filter_tables_free(&tables);
+		errno = EINVAL;
+		return 1;
+	}
+
+	ret = gp_filter_tables_apply(src, x_src, y_src, w_src, h_src,
+	                             dst, x_dst, y_dst, &tables, callback);
+
+	err = errno;
+	gp_filter_tables_free(&tables);
+	errno = err;
+
+	return ret;
+}
+
+gp_pixmap *gp_filter_point_ops_ex_alloc(const gp_pixmap *src,
+                                        gp_coord x_src, gp_coord y_src,
+                                        gp_size w_src, gp_size h_src,
+                                        const gp_point_op ops[],
+                                        unsigned int ops_cnt,
+                                        gp_progress_cb *callback)
+{
+	gp_pixmap *new = gp_pixmap_alloc(w_src, h_src, src->pixel_type);
+
+	if (!new)
+		return NULL;
+
+	if (gp_filter_point_ops_ex(src, x_src, y_src, w_src, h_src, new, 0, 0,
+	                           ops, ops_cnt, callback)) {
+		int err = errno;
+		gp_pixmap_free(new);
+		errno = err;
+		return NULL;
+	}
+
+	return new;
+}
@@ -4,13 +4,17 @@
  */
 
 #include <errno.h>
+#include <stdlib.h>
 
 #include <core/gp_pixmap.h>
 #include <core/gp_debug.h>
 #include <filters/gp_resize_nn.h>
 #include <filters/gp_resize_linear.h>
 #include <filters/gp_resize_cubic.h>
+#include <filters/gp_resize_lanczos.h>
+#include <filters/gp_resize_area.h>
 #include <filters/gp_resize.h>
+#include "gp_resize_sep.h"
 
 static const char *interp_types[] = {
 	"Nearest Neighbour",
@@ -18,6 +22,8 @@ static const char *interp_types[] = {
 	"Linear with Low Pass (Int)",
 	"Cubic (Float)",
 	"Cubic (Int)",
+	"Lanczos (Int)",
+	"Area (Int)",
 };
 
 const char *gp_interpolation_type_name(enum gp_interpolation_type interp_type)
@@ -43,6 +49,10 @@ static int resize(const gp_pixmap *src, gp_pixmap *dst,
 		return gp_filter_resize_cubic(src, dst, callback);
 	case GP_INTERP_CUBIC_INT:
 		return gp_filter_resize_cubic_int(src, dst, callback);
+	case GP_INTERP_LANCZOS_INT:
+		return gp_filter_resize_lanczos_int(src, dst, callback);
+	case GP_INTERP_AREA_INT:
+		return gp_filter_resize_area_int(src, dst, callback);
 	}
 
 	GP_WARN("Invalid interpolation type %u", (unsigned int)type);
@@ -94,3 +104,97 @@ gp_pixmap *gp_filter_resize_alloc(const gp_pixmap *src,
 
 	return res;
 }
+
+struct gp_resize_plan {
+	gp_size src_w, src_h;
+	gp_size dst_w, dst_h;
+	gp_pixel_type pixel_type;
+	gp_interpolation_type type;
+	/* Separable resampler, NULL if not supported for the type */
+	struct gp_resize_sep *sep;
+};
+
+gp_resize_plan *gp_resize_plan_create(gp_size src_w, gp_size src_h,
+                                      gp_size dst_w, gp_size dst_h,
+                                      gp_pixel_type pixel_type,
+                                      gp_interpolation_type type)
+{
+	enum gp_resize_kernel kern_x, kern_y;
+	gp_resize_plan *plan;
+
+	if (!src_w || !src_h || !dst_w || !dst_h) {
+		GP_WARN("Invalid resize %ux%u -> %ux%u", src_w, src_h, dst_w, dst_h);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (type > GP_INTERP_MAX) {
+		GP_WARN("Invalid interpolation type %u", (unsigned int)type);
+		errno = EINVAL;
+		return NULL;
+	}
+
+	plan = malloc(sizeof(*plan));
+	if (!plan) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	plan->src_w = src_w;
+	plan->src_h = src_h;
+	plan->dst_w = dst_w;
+	plan->dst_h = dst_h;
+	plan->pixel_type = pixel_type;
+	plan->type = type;
+	plan->sep = NULL;
+
+	if (!gp_resize_sep_supported(pixel_type) ||
+	    !gp_resize_sep_kernels(type, src_w, src_h, dst_w, dst_h,
+	                           &kern_x, &kern_y))
+		return plan;
+
+	plan->sep = gp_resize_sep_create(pixel_type, src_w, src_h,
+	                                 dst_w, dst_h, kern_x, kern_y);
+	if (!plan->sep) {
+		free(plan);
+		return NULL;
+	}
+
+	return plan;
+}
+
+int gp_resize_plan_exec(gp_resize_plan *self,
+                        const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	if (src->pixel_type != self->pixel_type ||
+	    dst->pixel_type != self->pixel_type) {
+		GP_WARN("The src and dst pixel types must match the plan");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (src->w != self->src_w || src->h != self->src_h ||
+	    dst->w != self->dst_w || dst->h != self->dst_h) {
+		GP_WARN("Pixmap sizes %ux%u -> %ux%u do not match the plan %ux%u -> %ux%u",
+		        src->w, src->h, dst->w, dst->h,
+		        self->src_w, self->src_h, self->dst_w, self->dst_h);
+		errno = EINVAL;
+		return 1;
+	}
+
+	/* Cubic with gamma correction is not done by the separable resampler */
+	if (!self->sep || (self->type == GP_INTERP_CUBIC_INT && src->gamma))
+		return resize(src, dst, self->type, callback);
+
+	return gp_resize_sep_exec(self->sep, src, dst, callback);
+}
+
+void gp_resize_plan_free(gp_resize_plan *self)
+{
+	if (!self)
+		return;
+
+	gp_resize_sep_free(self->sep);
+	free(self);
+}
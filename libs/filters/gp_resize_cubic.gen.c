@@ -0,0 +1,2713 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_resize_cubic.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:05 from gp_resize_cubic.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Cubic resampling
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <math.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_gamma.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize.h>
+#include "gp_cubic.h"
+#include "gp_resize_sep.h"
+
+#define MUL 1024
+
+#define MUL_I(a, b) ({ \
+	a[0] *= b[0]; \
+	a[1] *= b[1]; \
+	a[2] *= b[2]; \
+	a[3] *= b[3]; \
+})
+
+#define SUM_I(a) \
+	((a)[0] + (a)[1] + (a)[2] + (a)[3])
+
+static int resize_cubic_xRGB8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *R_2_LIN = NULL;
+	uint16_t *G_2_LIN = NULL;
+	uint16_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u16;
+		G_2_LIN = src->gamma->tables[1]->u16;
+		B_2_LIN = src->gamma->tables[2]->u16;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_xRGB8888(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_xRGB8888(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_xRGB8888(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_xRGB8888(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_xRGB8888(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_xRGB8888(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_xRGB8888(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_xRGB8888(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_xRGB8888(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_xRGB8888(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_xRGB8888(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_xRGB8888(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 1023);
+				G = GP_CLAMP_GENERIC(G, 0, 1023);
+				B = GP_CLAMP_GENERIC(B, 0, 1023);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_xRGB8888((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGBA8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+	int32_t col_A[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *R_2_LIN = NULL;
+	uint16_t *G_2_LIN = NULL;
+	uint16_t *B_2_LIN = NULL;
+	uint16_t *A_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+	uint8_t *A_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u16;
+		G_2_LIN = src->gamma->tables[1]->u16;
+		B_2_LIN = src->gamma->tables[2]->u16;
+		A_2_LIN = src->gamma->tables[3]->u16;
+		R_2_GAMMA = src->gamma->tables[4]->u8;
+		G_2_GAMMA = src->gamma->tables[5]->u8;
+		B_2_GAMMA = src->gamma->tables[6]->u8;
+		A_2_GAMMA = src->gamma->tables[7]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			int32_t Av[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGBA8888(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGBA8888(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGBA8888(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGBA8888(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGBA8888(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGBA8888(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGBA8888(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGBA8888(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGBA8888(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGBA8888(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGBA8888(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGBA8888(pix[3]);
+			Av[0] = GP_PIXEL_GET_A_RGBA8888(pix[0]);
+			Av[1] = GP_PIXEL_GET_A_RGBA8888(pix[1]);
+			Av[2] = GP_PIXEL_GET_A_RGBA8888(pix[2]);
+			Av[3] = GP_PIXEL_GET_A_RGBA8888(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+				Av[0] = A_2_LIN[Av[0]];
+				Av[1] = A_2_LIN[Av[1]];
+				Av[2] = A_2_LIN[Av[2]];
+				Av[3] = A_2_LIN[Av[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+			MUL_I(Av, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+			col_A[j] = SUM_I(Av);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+			int32_t Av[4];
+			int32_t A;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+			Av[0] = col_A[xmap[j][0]];
+			Av[1] = col_A[xmap[j][1]];
+			Av[2] = col_A[xmap[j][2]];
+			Av[3] = col_A[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+			MUL_I(Av, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+			A = (SUM_I(Av) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 1023);
+				G = GP_CLAMP_GENERIC(G, 0, 1023);
+				B = GP_CLAMP_GENERIC(B, 0, 1023);
+				A = GP_CLAMP_GENERIC(A, 0, 1023);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+				A = A_2_GAMMA[A];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+				A = GP_CLAMP_GENERIC(A, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGBA8888((uint8_t)R, (uint8_t)G, (uint8_t)B, (uint8_t)A);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *R_2_LIN = NULL;
+	uint16_t *G_2_LIN = NULL;
+	uint16_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u16;
+		G_2_LIN = src->gamma->tables[1]->u16;
+		B_2_LIN = src->gamma->tables[2]->u16;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_24BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_24BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_24BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_24BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB888(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGB888(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGB888(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGB888(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGB888(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGB888(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGB888(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGB888(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGB888(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGB888(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGB888(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGB888(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 1023);
+				G = GP_CLAMP_GENERIC(G, 0, 1023);
+				B = GP_CLAMP_GENERIC(B, 0, 1023);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB888((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_24BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_BGR888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_B[src->w];
+	int32_t col_G[src->w];
+	int32_t col_R[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *B_2_LIN = NULL;
+	uint16_t *G_2_LIN = NULL;
+	uint16_t *R_2_LIN = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		B_2_LIN = src->gamma->tables[0]->u16;
+		G_2_LIN = src->gamma->tables[1]->u16;
+		R_2_LIN = src->gamma->tables[2]->u16;
+		B_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		R_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Bv[4];
+			int32_t Gv[4];
+			int32_t Rv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_24BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_24BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_24BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_24BPP(src, j, yi[3]);
+
+			Bv[0] = GP_PIXEL_GET_B_BGR888(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_BGR888(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_BGR888(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_BGR888(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_BGR888(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_BGR888(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_BGR888(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_BGR888(pix[3]);
+			Rv[0] = GP_PIXEL_GET_R_BGR888(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_BGR888(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_BGR888(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_BGR888(pix[3]);
+
+			if (src->gamma) {
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+			}
+
+			MUL_I(Bv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Rv, cvy);
+
+			col_B[j] = SUM_I(Bv);
+			col_G[j] = SUM_I(Gv);
+			col_R[j] = SUM_I(Rv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Bv[4];
+			int32_t B;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Rv[4];
+			int32_t R;
+
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+
+			MUL_I(Bv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Rv, xmap_c[j]);
+
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				B = GP_CLAMP_GENERIC(B, 0, 1023);
+				G = GP_CLAMP_GENERIC(G, 0, 1023);
+				R = GP_CLAMP_GENERIC(R, 0, 1023);
+				B = B_2_GAMMA[B];
+				G = G_2_GAMMA[G];
+				R = R_2_GAMMA[R];
+			} else {
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_BGR888((uint8_t)B, (uint8_t)G, (uint8_t)R);
+			gp_putpixel_raw_24BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB555(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *R_2_LIN = NULL;
+	uint8_t *G_2_LIN = NULL;
+	uint8_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u8;
+		G_2_LIN = src->gamma->tables[1]->u8;
+		B_2_LIN = src->gamma->tables[2]->u8;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB555(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGB555(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGB555(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGB555(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGB555(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGB555(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGB555(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGB555(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGB555(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGB555(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGB555(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGB555(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 127);
+				G = GP_CLAMP_GENERIC(G, 0, 127);
+				B = GP_CLAMP_GENERIC(B, 0, 127);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 31);
+				G = GP_CLAMP_GENERIC(G, 0, 31);
+				B = GP_CLAMP_GENERIC(B, 0, 31);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB555((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_16BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB565(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *R_2_LIN = NULL;
+	uint8_t *G_2_LIN = NULL;
+	uint8_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u8;
+		G_2_LIN = src->gamma->tables[1]->u8;
+		B_2_LIN = src->gamma->tables[2]->u8;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB565(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGB565(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGB565(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGB565(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGB565(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGB565(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGB565(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGB565(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGB565(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGB565(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGB565(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGB565(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 127);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 127);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 31);
+				G = GP_CLAMP_GENERIC(G, 0, 63);
+				B = GP_CLAMP_GENERIC(B, 0, 31);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB565((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_16BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB666(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *R_2_LIN = NULL;
+	uint8_t *G_2_LIN = NULL;
+	uint8_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u8;
+		G_2_LIN = src->gamma->tables[1]->u8;
+		B_2_LIN = src->gamma->tables[2]->u8;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_18BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_18BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_18BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_18BPP_LE(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB666(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGB666(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGB666(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGB666(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGB666(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGB666(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGB666(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGB666(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGB666(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGB666(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGB666(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGB666(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 63);
+				G = GP_CLAMP_GENERIC(G, 0, 63);
+				B = GP_CLAMP_GENERIC(B, 0, 63);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB666((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_18BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGB332(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *R_2_LIN = NULL;
+	uint8_t *G_2_LIN = NULL;
+	uint8_t *B_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u8;
+		G_2_LIN = src->gamma->tables[1]->u8;
+		B_2_LIN = src->gamma->tables[2]->u8;
+		R_2_GAMMA = src->gamma->tables[3]->u8;
+		G_2_GAMMA = src->gamma->tables[4]->u8;
+		B_2_GAMMA = src->gamma->tables[5]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_8BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_8BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_8BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_8BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGB332(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGB332(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGB332(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGB332(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGB332(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGB332(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGB332(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGB332(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGB332(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGB332(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGB332(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGB332(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 31);
+				G = GP_CLAMP_GENERIC(G, 0, 31);
+				B = GP_CLAMP_GENERIC(B, 0, 15);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 7);
+				G = GP_CLAMP_GENERIC(G, 0, 7);
+				B = GP_CLAMP_GENERIC(B, 0, 3);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGB332((uint8_t)R, (uint8_t)G, (uint8_t)B);
+			gp_putpixel_raw_8BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_CMYK8888(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_K[src->w];
+	int32_t col_Y[src->w];
+	int32_t col_M[src->w];
+	int32_t col_C[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *K_2_LIN = NULL;
+	uint16_t *Y_2_LIN = NULL;
+	uint16_t *M_2_LIN = NULL;
+	uint16_t *C_2_LIN = NULL;
+	uint8_t *K_2_GAMMA = NULL;
+	uint8_t *Y_2_GAMMA = NULL;
+	uint8_t *M_2_GAMMA = NULL;
+	uint8_t *C_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		K_2_LIN = src->gamma->tables[0]->u16;
+		Y_2_LIN = src->gamma->tables[1]->u16;
+		M_2_LIN = src->gamma->tables[2]->u16;
+		C_2_LIN = src->gamma->tables[3]->u16;
+		K_2_GAMMA = src->gamma->tables[4]->u8;
+		Y_2_GAMMA = src->gamma->tables[5]->u8;
+		M_2_GAMMA = src->gamma->tables[6]->u8;
+		C_2_GAMMA = src->gamma->tables[7]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Kv[4];
+			int32_t Yv[4];
+			int32_t Mv[4];
+			int32_t Cv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Kv[0] = GP_PIXEL_GET_K_CMYK8888(pix[0]);
+			Kv[1] = GP_PIXEL_GET_K_CMYK8888(pix[1]);
+			Kv[2] = GP_PIXEL_GET_K_CMYK8888(pix[2]);
+			Kv[3] = GP_PIXEL_GET_K_CMYK8888(pix[3]);
+			Yv[0] = GP_PIXEL_GET_Y_CMYK8888(pix[0]);
+			Yv[1] = GP_PIXEL_GET_Y_CMYK8888(pix[1]);
+			Yv[2] = GP_PIXEL_GET_Y_CMYK8888(pix[2]);
+			Yv[3] = GP_PIXEL_GET_Y_CMYK8888(pix[3]);
+			Mv[0] = GP_PIXEL_GET_M_CMYK8888(pix[0]);
+			Mv[1] = GP_PIXEL_GET_M_CMYK8888(pix[1]);
+			Mv[2] = GP_PIXEL_GET_M_CMYK8888(pix[2]);
+			Mv[3] = GP_PIXEL_GET_M_CMYK8888(pix[3]);
+			Cv[0] = GP_PIXEL_GET_C_CMYK8888(pix[0]);
+			Cv[1] = GP_PIXEL_GET_C_CMYK8888(pix[1]);
+			Cv[2] = GP_PIXEL_GET_C_CMYK8888(pix[2]);
+			Cv[3] = GP_PIXEL_GET_C_CMYK8888(pix[3]);
+
+			if (src->gamma) {
+				Kv[0] = K_2_LIN[Kv[0]];
+				Kv[1] = K_2_LIN[Kv[1]];
+				Kv[2] = K_2_LIN[Kv[2]];
+				Kv[3] = K_2_LIN[Kv[3]];
+				Yv[0] = Y_2_LIN[Yv[0]];
+				Yv[1] = Y_2_LIN[Yv[1]];
+				Yv[2] = Y_2_LIN[Yv[2]];
+				Yv[3] = Y_2_LIN[Yv[3]];
+				Mv[0] = M_2_LIN[Mv[0]];
+				Mv[1] = M_2_LIN[Mv[1]];
+				Mv[2] = M_2_LIN[Mv[2]];
+				Mv[3] = M_2_LIN[Mv[3]];
+				Cv[0] = C_2_LIN[Cv[0]];
+				Cv[1] = C_2_LIN[Cv[1]];
+				Cv[2] = C_2_LIN[Cv[2]];
+				Cv[3] = C_2_LIN[Cv[3]];
+			}
+
+			MUL_I(Kv, cvy);
+			MUL_I(Yv, cvy);
+			MUL_I(Mv, cvy);
+			MUL_I(Cv, cvy);
+
+			col_K[j] = SUM_I(Kv);
+			col_Y[j] = SUM_I(Yv);
+			col_M[j] = SUM_I(Mv);
+			col_C[j] = SUM_I(Cv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Kv[4];
+			int32_t K;
+			int32_t Yv[4];
+			int32_t Y;
+			int32_t Mv[4];
+			int32_t M;
+			int32_t Cv[4];
+			int32_t C;
+
+			Kv[0] = col_K[xmap[j][0]];
+			Kv[1] = col_K[xmap[j][1]];
+			Kv[2] = col_K[xmap[j][2]];
+			Kv[3] = col_K[xmap[j][3]];
+			Yv[0] = col_Y[xmap[j][0]];
+			Yv[1] = col_Y[xmap[j][1]];
+			Yv[2] = col_Y[xmap[j][2]];
+			Yv[3] = col_Y[xmap[j][3]];
+			Mv[0] = col_M[xmap[j][0]];
+			Mv[1] = col_M[xmap[j][1]];
+			Mv[2] = col_M[xmap[j][2]];
+			Mv[3] = col_M[xmap[j][3]];
+			Cv[0] = col_C[xmap[j][0]];
+			Cv[1] = col_C[xmap[j][1]];
+			Cv[2] = col_C[xmap[j][2]];
+			Cv[3] = col_C[xmap[j][3]];
+
+			MUL_I(Kv, xmap_c[j]);
+			MUL_I(Yv, xmap_c[j]);
+			MUL_I(Mv, xmap_c[j]);
+			MUL_I(Cv, xmap_c[j]);
+
+			K = (SUM_I(Kv) + MUL*MUL/2) / MUL / MUL;
+			Y = (SUM_I(Yv) + MUL*MUL/2) / MUL / MUL;
+			M = (SUM_I(Mv) + MUL*MUL/2) / MUL / MUL;
+			C = (SUM_I(Cv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				K = GP_CLAMP_GENERIC(K, 0, 1023);
+				Y = GP_CLAMP_GENERIC(Y, 0, 1023);
+				M = GP_CLAMP_GENERIC(M, 0, 1023);
+				C = GP_CLAMP_GENERIC(C, 0, 1023);
+				K = K_2_GAMMA[K];
+				Y = Y_2_GAMMA[Y];
+				M = M_2_GAMMA[M];
+				C = C_2_GAMMA[C];
+			} else {
+				K = GP_CLAMP_GENERIC(K, 0, 255);
+				Y = GP_CLAMP_GENERIC(Y, 0, 255);
+				M = GP_CLAMP_GENERIC(M, 0, 255);
+				C = GP_CLAMP_GENERIC(C, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_CMYK8888((uint8_t)K, (uint8_t)Y, (uint8_t)M, (uint8_t)C);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G1(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *V_2_LIN = NULL;
+	uint8_t *V_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u8;
+		V_2_GAMMA = src->gamma->tables[1]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_1BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_1BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_1BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_1BPP_LE(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G1(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_G1(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_G1(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_G1(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+			}
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 7);
+				V = V_2_GAMMA[V];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 1);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_G1((uint8_t)V);
+			gp_putpixel_raw_1BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G2(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *V_2_LIN = NULL;
+	uint8_t *V_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u8;
+		V_2_GAMMA = src->gamma->tables[1]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_2BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_2BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_2BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_2BPP_LE(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G2(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_G2(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_G2(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_G2(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+			}
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 15);
+				V = V_2_GAMMA[V];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 3);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_G2((uint8_t)V);
+			gp_putpixel_raw_2BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G4(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint8_t *V_2_LIN = NULL;
+	uint8_t *V_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u8;
+		V_2_GAMMA = src->gamma->tables[1]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_4BPP_LE(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_4BPP_LE(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_4BPP_LE(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_4BPP_LE(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G4(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_G4(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_G4(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_G4(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+			}
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 63);
+				V = V_2_GAMMA[V];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 15);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_G4((uint8_t)V);
+			gp_putpixel_raw_4BPP_LE(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G8(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *V_2_LIN = NULL;
+	uint8_t *V_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u16;
+		V_2_GAMMA = src->gamma->tables[1]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_8BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_8BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_8BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_8BPP(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G8(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_G8(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_G8(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_G8(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+			}
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 1023);
+				V = V_2_GAMMA[V];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_G8((uint8_t)V);
+			gp_putpixel_raw_8BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_GA88(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+	int32_t col_A[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *V_2_LIN = NULL;
+	uint16_t *A_2_LIN = NULL;
+	uint8_t *V_2_GAMMA = NULL;
+	uint8_t *A_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u16;
+		A_2_LIN = src->gamma->tables[1]->u16;
+		V_2_GAMMA = src->gamma->tables[2]->u8;
+		A_2_GAMMA = src->gamma->tables[3]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			int32_t Av[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_GA88(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_GA88(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_GA88(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_GA88(pix[3]);
+			Av[0] = GP_PIXEL_GET_A_GA88(pix[0]);
+			Av[1] = GP_PIXEL_GET_A_GA88(pix[1]);
+			Av[2] = GP_PIXEL_GET_A_GA88(pix[2]);
+			Av[3] = GP_PIXEL_GET_A_GA88(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+				Av[0] = A_2_LIN[Av[0]];
+				Av[1] = A_2_LIN[Av[1]];
+				Av[2] = A_2_LIN[Av[2]];
+				Av[3] = A_2_LIN[Av[3]];
+			}
+
+			MUL_I(Vv, cvy);
+			MUL_I(Av, cvy);
+
+			col_V[j] = SUM_I(Vv);
+			col_A[j] = SUM_I(Av);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+			int32_t Av[4];
+			int32_t A;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+			Av[0] = col_A[xmap[j][0]];
+			Av[1] = col_A[xmap[j][1]];
+			Av[2] = col_A[xmap[j][2]];
+			Av[3] = col_A[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+			MUL_I(Av, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+			A = (SUM_I(Av) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 1023);
+				A = GP_CLAMP_GENERIC(A, 0, 1023);
+				V = V_2_GAMMA[V];
+				A = A_2_GAMMA[A];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 255);
+				A = GP_CLAMP_GENERIC(A, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_GA88((uint8_t)V, (uint8_t)A);
+			gp_putpixel_raw_16BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_G16(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_V[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *V_2_LIN = NULL;
+	uint16_t *V_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		V_2_LIN = src->gamma->tables[0]->u16;
+		V_2_GAMMA = src->gamma->tables[1]->u16;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Vv[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_16BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_16BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_16BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_16BPP(src, j, yi[3]);
+
+			Vv[0] = GP_PIXEL_GET_V_G16(pix[0]);
+			Vv[1] = GP_PIXEL_GET_V_G16(pix[1]);
+			Vv[2] = GP_PIXEL_GET_V_G16(pix[2]);
+			Vv[3] = GP_PIXEL_GET_V_G16(pix[3]);
+
+			if (src->gamma) {
+				Vv[0] = V_2_LIN[Vv[0]];
+				Vv[1] = V_2_LIN[Vv[1]];
+				Vv[2] = V_2_LIN[Vv[2]];
+				Vv[3] = V_2_LIN[Vv[3]];
+			}
+
+			MUL_I(Vv, cvy);
+
+			col_V[j] = SUM_I(Vv);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Vv[4];
+			int32_t V;
+
+			Vv[0] = col_V[xmap[j][0]];
+			Vv[1] = col_V[xmap[j][1]];
+			Vv[2] = col_V[xmap[j][2]];
+			Vv[3] = col_V[xmap[j][3]];
+
+			MUL_I(Vv, xmap_c[j]);
+
+			V = (SUM_I(Vv) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				V = GP_CLAMP_GENERIC(V, 0, 262143);
+				V = V_2_GAMMA[V];
+			} else {
+				V = GP_CLAMP_GENERIC(V, 0, 65535);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_G16((uint8_t)V);
+			gp_putpixel_raw_16BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic_RGBA8888_PM(const gp_pixmap *src,
+	gp_pixmap *dst, gp_progress_cb *callback)
+{
+	int32_t col_R[src->w];
+	int32_t col_G[src->w];
+	int32_t col_B[src->w];
+	int32_t col_A[src->w];
+
+	uint32_t i, j;
+
+	GP_DEBUG(1, "Scaling image %ux%u -> %ux%u %2.2f %2.2f",
+	            src->w, src->h, dst->w, dst->h,
+		    1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	/* prepare Gamma tables */
+	uint16_t *R_2_LIN = NULL;
+	uint16_t *G_2_LIN = NULL;
+	uint16_t *B_2_LIN = NULL;
+	uint16_t *A_2_LIN = NULL;
+	uint8_t *R_2_GAMMA = NULL;
+	uint8_t *G_2_GAMMA = NULL;
+	uint8_t *B_2_GAMMA = NULL;
+	uint8_t *A_2_GAMMA = NULL;
+
+	if (src->gamma) {
+		R_2_LIN = src->gamma->tables[0]->u16;
+		G_2_LIN = src->gamma->tables[1]->u16;
+		B_2_LIN = src->gamma->tables[2]->u16;
+		A_2_LIN = src->gamma->tables[3]->u16;
+		R_2_GAMMA = src->gamma->tables[4]->u8;
+		G_2_GAMMA = src->gamma->tables[5]->u8;
+		B_2_GAMMA = src->gamma->tables[6]->u8;
+		A_2_GAMMA = src->gamma->tables[7]->u8;
+	}
+
+	/* pre-generate x mapping and constants */
+	int32_t xmap[dst->w][4];
+	int32_t xmap_c[dst->w][4];
+
+	for (i = 0; i < dst->w; i++) {
+		float x = (1.00 * i / (dst->w - 1)) * (src->w - 1);
+
+		xmap[i][0] = floor(x - 1);
+		xmap[i][1] = x;
+		xmap[i][2] = x + 1;
+		xmap[i][3] = x + 2;
+
+		xmap_c[i][0] = cubic_int((xmap[i][0] - x) * MUL + 0.5);
+		xmap_c[i][1] = cubic_int((xmap[i][1] - x) * MUL + 0.5);
+		xmap_c[i][2] = cubic_int((xmap[i][2] - x) * MUL + 0.5);
+		xmap_c[i][3] = cubic_int((xmap[i][3] - x) * MUL + 0.5);
+
+		xmap[i][0] = GP_MAX(xmap[i][0], 0);
+		xmap[i][2] = GP_MIN(xmap[i][2], (int)src->w - 1);
+		xmap[i][3] = GP_MIN(xmap[i][3], (int)src->w - 1);
+	}
+
+	/* cubic resampling */
+	for (i = 0; i < dst->h; i++) {
+		float y = (1.00 * i / (dst->h - 1)) * (src->h - 1);
+		int32_t cvy[4];
+		int yi[4];
+
+		yi[0] = floor(y - 1);
+		yi[1] = y;
+		yi[2] = y + 1;
+		yi[3] = y + 2;
+
+		cvy[0] = cubic_int((yi[0] - y) * MUL + 0.5);
+		cvy[1] = cubic_int((yi[1] - y) * MUL + 0.5);
+		cvy[2] = cubic_int((yi[2] - y) * MUL + 0.5);
+		cvy[3] = cubic_int((yi[3] - y) * MUL + 0.5);
+
+		yi[0] = GP_MAX(yi[0], 0);
+		yi[2] = GP_MIN(yi[2], (int)src->h - 1);
+		yi[3] = GP_MIN(yi[3], (int)src->h - 1);	
+
+		/* Generate interpolated row */
+		for (j = 0; j < src->w; j++) {
+			int32_t Rv[4];
+			int32_t Gv[4];
+			int32_t Bv[4];
+			int32_t Av[4];
+			gp_pixel pix[4];
+
+			pix[0] = gp_getpixel_raw_32BPP(src, j, yi[0]);
+			pix[1] = gp_getpixel_raw_32BPP(src, j, yi[1]);
+			pix[2] = gp_getpixel_raw_32BPP(src, j, yi[2]);
+			pix[3] = gp_getpixel_raw_32BPP(src, j, yi[3]);
+
+			Rv[0] = GP_PIXEL_GET_R_RGBA8888_PM(pix[0]);
+			Rv[1] = GP_PIXEL_GET_R_RGBA8888_PM(pix[1]);
+			Rv[2] = GP_PIXEL_GET_R_RGBA8888_PM(pix[2]);
+			Rv[3] = GP_PIXEL_GET_R_RGBA8888_PM(pix[3]);
+			Gv[0] = GP_PIXEL_GET_G_RGBA8888_PM(pix[0]);
+			Gv[1] = GP_PIXEL_GET_G_RGBA8888_PM(pix[1]);
+			Gv[2] = GP_PIXEL_GET_G_RGBA8888_PM(pix[2]);
+			Gv[3] = GP_PIXEL_GET_G_RGBA8888_PM(pix[3]);
+			Bv[0] = GP_PIXEL_GET_B_RGBA8888_PM(pix[0]);
+			Bv[1] = GP_PIXEL_GET_B_RGBA8888_PM(pix[1]);
+			Bv[2] = GP_PIXEL_GET_B_RGBA8888_PM(pix[2]);
+			Bv[3] = GP_PIXEL_GET_B_RGBA8888_PM(pix[3]);
+			Av[0] = GP_PIXEL_GET_A_RGBA8888_PM(pix[0]);
+			Av[1] = GP_PIXEL_GET_A_RGBA8888_PM(pix[1]);
+			Av[2] = GP_PIXEL_GET_A_RGBA8888_PM(pix[2]);
+			Av[3] = GP_PIXEL_GET_A_RGBA8888_PM(pix[3]);
+
+			if (src->gamma) {
+				Rv[0] = R_2_LIN[Rv[0]];
+				Rv[1] = R_2_LIN[Rv[1]];
+				Rv[2] = R_2_LIN[Rv[2]];
+				Rv[3] = R_2_LIN[Rv[3]];
+				Gv[0] = G_2_LIN[Gv[0]];
+				Gv[1] = G_2_LIN[Gv[1]];
+				Gv[2] = G_2_LIN[Gv[2]];
+				Gv[3] = G_2_LIN[Gv[3]];
+				Bv[0] = B_2_LIN[Bv[0]];
+				Bv[1] = B_2_LIN[Bv[1]];
+				Bv[2] = B_2_LIN[Bv[2]];
+				Bv[3] = B_2_LIN[Bv[3]];
+				Av[0] = A_2_LIN[Av[0]];
+				Av[1] = A_2_LIN[Av[1]];
+				Av[2] = A_2_LIN[Av[2]];
+				Av[3] = A_2_LIN[Av[3]];
+			}
+
+			MUL_I(Rv, cvy);
+			MUL_I(Gv, cvy);
+			MUL_I(Bv, cvy);
+			MUL_I(Av, cvy);
+
+			col_R[j] = SUM_I(Rv);
+			col_G[j] = SUM_I(Gv);
+			col_B[j] = SUM_I(Bv);
+			col_A[j] = SUM_I(Av);
+		}
+
+		/* now interpolate column for new image */
+		for (j = 0; j < dst->w; j++) {
+			int32_t Rv[4];
+			int32_t R;
+			int32_t Gv[4];
+			int32_t G;
+			int32_t Bv[4];
+			int32_t B;
+			int32_t Av[4];
+			int32_t A;
+
+			Rv[0] = col_R[xmap[j][0]];
+			Rv[1] = col_R[xmap[j][1]];
+			Rv[2] = col_R[xmap[j][2]];
+			Rv[3] = col_R[xmap[j][3]];
+			Gv[0] = col_G[xmap[j][0]];
+			Gv[1] = col_G[xmap[j][1]];
+			Gv[2] = col_G[xmap[j][2]];
+			Gv[3] = col_G[xmap[j][3]];
+			Bv[0] = col_B[xmap[j][0]];
+			Bv[1] = col_B[xmap[j][1]];
+			Bv[2] = col_B[xmap[j][2]];
+			Bv[3] = col_B[xmap[j][3]];
+			Av[0] = col_A[xmap[j][0]];
+			Av[1] = col_A[xmap[j][1]];
+			Av[2] = col_A[xmap[j][2]];
+			Av[3] = col_A[xmap[j][3]];
+
+			MUL_I(Rv, xmap_c[j]);
+			MUL_I(Gv, xmap_c[j]);
+			MUL_I(Bv, xmap_c[j]);
+			MUL_I(Av, xmap_c[j]);
+
+			R = (SUM_I(Rv) + MUL*MUL/2) / MUL / MUL;
+			G = (SUM_I(Gv) + MUL*MUL/2) / MUL / MUL;
+			B = (SUM_I(Bv) + MUL*MUL/2) / MUL / MUL;
+			A = (SUM_I(Av) + MUL*MUL/2) / MUL / MUL;
+
+			if (src->gamma) {
+				R = GP_CLAMP_GENERIC(R, 0, 1023);
+				G = GP_CLAMP_GENERIC(G, 0, 1023);
+				B = GP_CLAMP_GENERIC(B, 0, 1023);
+				A = GP_CLAMP_GENERIC(A, 0, 1023);
+				R = R_2_GAMMA[R];
+				G = G_2_GAMMA[G];
+				B = B_2_GAMMA[B];
+				A = A_2_GAMMA[A];
+			} else {
+				R = GP_CLAMP_GENERIC(R, 0, 255);
+				G = GP_CLAMP_GENERIC(G, 0, 255);
+				B = GP_CLAMP_GENERIC(B, 0, 255);
+				A = GP_CLAMP_GENERIC(A, 0, 255);
+			}
+
+			gp_pixel pix = GP_PIXEL_CREATE_RGBA8888_PM((uint8_t)R, (uint8_t)G, (uint8_t)B, (uint8_t)A);
+			gp_putpixel_raw_32BPP(dst, j, i, pix);
+		}
+
+		if (gp_progress_cb_report(callback, i, dst->h, dst->w))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int resize_cubic(const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	/* The separable code does not linearize the values */
+	if (!src->gamma && gp_resize_sep_supported(src->pixel_type)) {
+		return gp_resize_sep(src, dst, GP_RESIZE_KERN_CUBIC,
+		                     GP_RESIZE_KERN_CUBIC, callback);
+	}
+
+	switch (src->pixel_type) {
+	case GP_PIXEL_xRGB8888:
+		return resize_cubic_xRGB8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888:
+		return resize_cubic_RGBA8888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB888:
+		return resize_cubic_RGB888(src, dst, callback);
+	break;
+	case GP_PIXEL_BGR888:
+		return resize_cubic_BGR888(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB555:
+		return resize_cubic_RGB555(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB565:
+		return resize_cubic_RGB565(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB666:
+		return resize_cubic_RGB666(src, dst, callback);
+	break;
+	case GP_PIXEL_RGB332:
+		return resize_cubic_RGB332(src, dst, callback);
+	break;
+	case GP_PIXEL_CMYK8888:
+		return resize_cubic_CMYK8888(src, dst, callback);
+	break;
+	case GP_PIXEL_G1:
+		return resize_cubic_G1(src, dst, callback);
+	break;
+	case GP_PIXEL_G2:
+		return resize_cubic_G2(src, dst, callback);
+	break;
+	case GP_PIXEL_G4:
+		return resize_cubic_G4(src, dst, callback);
+	break;
+	case GP_PIXEL_G8:
+		return resize_cubic_G8(src, dst, callback);
+	break;
+	case GP_PIXEL_GA88:
+		return resize_cubic_GA88(src, dst, callback);
+	break;
+	case GP_PIXEL_G16:
+		return resize_cubic_G16(src, dst, callback);
+	break;
+	case GP_PIXEL_RGBA8888_PM:
+		return resize_cubic_RGBA8888_PM(src, dst, callback);
+	break;
+	default:
+		errno = EINVAL;
+		return -1;
+	}
+}
+
+int gp_filter_resize_cubic_int(const gp_pixmap *src, gp_pixmap *dst,
+                               gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	return resize_cubic(src, dst, callback);
+}
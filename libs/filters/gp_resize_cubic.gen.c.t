@@ -15,6 +15,7 @@
 #include <core/gp_debug.h>
 #include <filters/gp_resize.h>
 #include "gp_cubic.h"
+#include "gp_resize_sep.h"
 
 #define MUL 1024
 
@@ -176,6 +177,12 @@ static int resize_cubic_{{ pt.name }}(const gp_pixmap *src,
 static int resize_cubic(const gp_pixmap *src, gp_pixmap *dst,
                         gp_progress_cb *callback)
 {
+	/* The separable code does not linearize the values */
+	if (!src->gamma && gp_resize_sep_supported(src->pixel_type)) {
+		return gp_resize_sep(src, dst, GP_RESIZE_KERN_CUBIC,
+		                     GP_RESIZE_KERN_CUBIC, callback);
+	}
+
 	switch (src->pixel_type) {
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
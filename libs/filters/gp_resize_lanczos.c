@@ -0,0 +1,36 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+ * Lanczos-3 resampling
+ */
+
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_debug.h>
+#include <filters/gp_resize_lanczos.h>
+
+#include "gp_resize_sep.h"
+
+int gp_filter_resize_lanczos_int(const gp_pixmap *src, gp_pixmap *dst,
+                                 gp_progress_cb *callback)
+{
+	if (src->pixel_type != dst->pixel_type) {
+		GP_WARN("The src and dst pixel types must match");
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!gp_resize_sep_supported(src->pixel_type)) {
+		GP_DEBUG(1, "Pixel type %s not supported",
+		         gp_pixel_type_name(src->pixel_type));
+		errno = ENOSYS;
+		return 1;
+	}
+
+	return gp_resize_sep(src, dst, GP_RESIZE_KERN_LANCZOS3,
+	                     GP_RESIZE_KERN_LANCZOS3, callback);
+}
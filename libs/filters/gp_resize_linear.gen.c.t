@@ -13,6 +13,8 @@
 #include <core/gp_gamma.h>
 #include <core/gp_debug.h>
 #include <filters/gp_resize.h>
+
+#include "gp_resize_sep.h"
 @
 @ def fetch_rows(pt, y):
 for (x = 0; x < src->w; x++) {
@@ -46,7 +48,7 @@ for (x = 0; x < dst->w; x++) {
 @ end
 
 @ for pt in pixeltypes:
-@     if not pt.is_unknown() and not pt.is_palette():
+@     if not pt.is_unknown() and not pt.is_palette() and not pt.is_8bpc():
 static int resize_lin_lf_{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
                                        gp_progress_cb *callback)
 {
@@ -128,7 +130,7 @@ static int resize_lin_lf_{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
 @ end
 @
 @ for pt in pixeltypes:
-@     if not pt.is_unknown() and not pt.is_palette():
+@     if not pt.is_unknown() and not pt.is_palette() and not pt.is_8bpc():
 static int resize_lin{{ pt.name }}(const gp_pixmap *src, gp_pixmap *dst,
                                    gp_progress_cb *callback)
 {
@@ -226,7 +228,12 @@ static int resize_lin(const gp_pixmap *src, gp_pixmap *dst,
 @ for pt in pixeltypes:
 @     if not pt.is_unknown() and not pt.is_palette():
 	case GP_PIXEL_{{ pt.name }}:
+@         if pt.is_8bpc():
+		return gp_resize_sep(src, dst, GP_RESIZE_KERN_LINEAR,
+		                     GP_RESIZE_KERN_LINEAR, callback);
+@         else:
 		return resize_lin{{ pt.name }}(src, dst, callback);
+@         end
 	break;
 @ end
 	default:
@@ -255,6 +262,14 @@ static int resize_lin_lf(const gp_pixmap *src, gp_pixmap *dst,
 	float x_rat = 1.00 * dst->w / src->w;
 	float y_rat = 1.00 * dst->h / src->h;
 
+	/* Area averaging on downscaled axes, linear otherwise */
+	if (gp_resize_sep_supported(src->pixel_type)) {
+		return gp_resize_sep(src, dst,
+		                     x_rat < 1.00 ? GP_RESIZE_KERN_AREA : GP_RESIZE_KERN_LINEAR,
+		                     y_rat < 1.00 ? GP_RESIZE_KERN_AREA : GP_RESIZE_KERN_LINEAR,
+		                     callback);
+	}
+
 	if (x_rat < 1.00 && y_rat < 1.00) {
 
 		GP_DEBUG(1, "Downscaling image %ux%u -> %ux%u %2.2f %2.2f",
@@ -262,7 +277,7 @@ static int resize_lin_lf(const gp_pixmap *src, gp_pixmap *dst,
 
 		switch (src->pixel_type) {
 @ for pt in pixeltypes:
-@     if not pt.is_unknown() and not pt.is_palette():
+@     if not pt.is_unknown() and not pt.is_palette() and not pt.is_8bpc():
 		case GP_PIXEL_{{ pt.name }}:
 			return resize_lin_lf_{{ pt.name }}(src, dst, callback);
 		break;
@@ -0,0 +1,814 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Separable resampling for 8 bit per channel pixel types.
+
+  The weights for each destination column and row are precomputed once in 2.14
+  fixed point. The pixels are processed as rows of bytes, all channels at once.
+
+  Each source row is first resampled horizontally into a row of int16_t values
+  with 6 fractional bits, the vertical pass then combines taps of these rows
+  into a destination row. The destination is split into bands of rows that are
+  processed in parallel, each band keeps a ring buffer of taps horizontally
+  resampled rows so that each source row is resampled only once per band.
+
+  The intermediate values are at most about 1.2 * 255 * 64 even for the cubic
+  overshoots, hence both passes can multiply pairs of 16 bit values and
+  accumulate in 32 bit integers.
+
+ */
+
+#include <errno.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <core/gp_common.h>
+#include <core/gp_clamp.h>
+#include <core/gp_debug.h>
+#include <core/gp_threads.h>
+#include <core/gp_cpu.h>
+
+#include "gp_cubic.h"
+#include "gp_resize_sep.h"
+
+#ifdef GP_CPU_X86
+# include <immintrin.h>
+#endif
+
+#define W_BITS 14
+#define W_ONE (1<<W_BITS)
+
+/* Fractional bits of the intermediate values */
+#define I_BITS 6
+
+#define H_SHIFT (W_BITS - I_BITS)
+#define V_SHIFT (W_BITS + I_BITS)
+
+/*
+ * Maps destination pixel i onto source pixel j + frac / W_ONE, corners of the
+ * images are mapped onto each other.
+ */
+static void map_corners(gp_size i, gp_size src_size, gp_size dst_size,
+                        gp_size *j, int *frac)
+{
+	uint64_t num = (uint64_t)i * (src_size - 1);
+	uint64_t den = dst_size - 1;
+
+	if (dst_size == 1) {
+		num = src_size - 1;
+		den = 2;
+	}
+
+	*j = num / den;
+	*frac = (((num % den) << W_BITS) + den/2) / den;
+
+	if (*frac == W_ONE) {
+		(*j)++;
+		*frac = 0;
+	}
+}
+
+#define LANCZOS_A 3
+
+static double sinc(double x)
+{
+	if (x == 0)
+		return 1;
+
+	x *= M_PI;
+
+	return sin(x) / x;
+}
+
+static double lanczos(double x)
+{
+	if (x <= -LANCZOS_A || x >= LANCZOS_A)
+		return 0;
+
+	return sinc(x) * sinc(x / LANCZOS_A);
+}
+
+/*
+ * Returns the kernel radius in source pixels, the kernel is stretched on
+ * downscaling so that it covers the footprint of the destination pixel.
+ */
+static double lanczos_radius(gp_size src_size, gp_size dst_size)
+{
+	return LANCZOS_A * GP_MAX(1.00 * src_size / dst_size, 1.00);
+}
+
+static gp_size kern_support(enum gp_resize_kernel kern,
+                            gp_size src_size, gp_size dst_size)
+{
+	switch (kern) {
+	case GP_RESIZE_KERN_LANCZOS3:
+		return ceil(2 * lanczos_radius(src_size, dst_size)) + 1;
+	case GP_RESIZE_KERN_LINEAR:
+		return 2;
+	case GP_RESIZE_KERN_CUBIC:
+		return 4;
+	case GP_RESIZE_KERN_AREA:
+		return (src_size + dst_size - 1) / dst_size + 1;
+	}
+
+	return 0;
+}
+
+/*
+ * Computes weights for destination pixel i, the first weight is for source
+ * pixel *first, which may be out of the image for the cubic kernel.
+ *
+ * Returns number of weights.
+ */
+static gp_size kern_weights(enum gp_resize_kernel kern, gp_size i,
+                            gp_size src_size, gp_size dst_size,
+                            int32_t *w, int64_t *first)
+{
+	uint64_t a, b, j, k;
+	gp_size n = 0, pj;
+	int frac;
+	double c, r, sum = 0;
+	int64_t jl;
+
+	switch (kern) {
+	case GP_RESIZE_KERN_LANCZOS3:
+		/* Pixel centers are mapped onto each other */
+		c = (i + 0.5) * src_size / dst_size - 0.5;
+		r = lanczos_radius(src_size, dst_size);
+		*first = floor(c - r) + 1;
+		for (jl = *first; jl < c + r; jl++)
+			sum += lanczos((jl - c) * LANCZOS_A / r);
+		for (jl = *first; jl < c + r; jl++)
+			w[n++] = round(lanczos((jl - c) * LANCZOS_A / r) * W_ONE / sum);
+		return n;
+	case GP_RESIZE_KERN_LINEAR:
+		map_corners(i, src_size, dst_size, &pj, &frac);
+		*first = pj;
+		w[0] = W_ONE - frac;
+		w[1] = frac;
+		return 2;
+	case GP_RESIZE_KERN_CUBIC:
+		map_corners(i, src_size, dst_size, &pj, &frac);
+		*first = (int64_t)pj - 1;
+		for (k = 0; k < 4; k++) {
+			float x = (float)k - 1 - (float)frac / W_ONE;
+
+			w[k] = roundf(cubic_float(x) * W_ONE);
+		}
+		return 4;
+	case GP_RESIZE_KERN_AREA:
+		/* Footprint [a, b) in 1/dst_size pixel units */
+		a = (uint64_t)i * src_size;
+		b = a + src_size;
+		*first = a / dst_size;
+		for (j = a / dst_size; j * dst_size < b; j++) {
+			uint64_t overlap = GP_MIN(b, (j+1) * dst_size) -
+			                   GP_MAX(a, j * dst_size);
+
+			w[n++] = (overlap * W_ONE + src_size/2) / src_size;
+		}
+		return n;
+	}
+
+	return 0;
+}
+
+int gp_resize_axis_init(struct gp_resize_axis *self, enum gp_resize_kernel kern,
+                        gp_size src_size, gp_size dst_size)
+{
+	gp_size support = kern_support(kern, src_size, dst_size);
+	gp_size taps = GP_MIN(support, src_size);
+	int32_t w[support], acc[taps];
+	gp_size i, k, n;
+
+	self->taps = taps;
+	self->size = dst_size;
+	self->src_size = src_size;
+	self->off = malloc(sizeof(uint32_t) * dst_size);
+	self->w = malloc(sizeof(int16_t) * dst_size * taps);
+
+	if (!self->off || !self->w) {
+		gp_resize_axis_free(self);
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (i = 0; i < dst_size; i++) {
+		int64_t first = 0, off;
+		int32_t sum = 0;
+		gp_size max = 0;
+
+		n = kern_weights(kern, i, src_size, dst_size, w, &first);
+
+		/* Move the window into the image, fold the outside weights */
+		off = GP_CLAMP(first, 0, (int64_t)(src_size - taps));
+
+		memset(acc, 0, sizeof(acc));
+
+		for (k = 0; k < n; k++) {
+			int64_t j = GP_CLAMP(first + (int64_t)k, 0, (int64_t)src_size - 1);
+
+			acc[j - off] += w[k];
+		}
+
+		/* Make the weights add up to exactly one */
+		for (k = 0; k < taps; k++) {
+			sum += acc[k];
+			if (acc[k] > acc[max])
+				max = k;
+		}
+
+		acc[max] += W_ONE - sum;
+
+		self->off[i] = off;
+
+		for (k = 0; k < taps; k++)
+			self->w[i * taps + k] = acc[k];
+	}
+
+	return 0;
+}
+
+void gp_resize_axis_free(struct gp_resize_axis *self)
+{
+	free(self->off);
+	free(self->w);
+	self->off = NULL;
+	self->w = NULL;
+}
+
+typedef void (*h_row_fn)(int16_t *out, const uint8_t *row,
+                         const struct gp_resize_axis *ax, unsigned int bpp);
+
+typedef void (*v_row_fn)(uint8_t *out, const int16_t *const *rows,
+                         const int16_t *w, gp_size taps, size_t n);
+
+static inline void h_row_bpp(int16_t *out, const uint8_t *row,
+                             const struct gp_resize_axis *ax, gp_size i,
+                             const unsigned int bpp)
+{
+	gp_size k, taps = ax->taps;
+	unsigned int c;
+
+	for (; i < ax->size; i++) {
+		const uint8_t *p = row + (size_t)ax->off[i] * bpp;
+		const int16_t *w = ax->w + i * taps;
+
+		int32_t sum[4];
+
+		for (c = 0; c < bpp; c++)
+			sum[c] = 1<<(H_SHIFT-1);
+
+		for (k = 0; k < taps; k++) {
+			for (c = 0; c < bpp; c++)
+				sum[c] += p[k * bpp + c] * w[k];
+		}
+
+		for (c = 0; c < bpp; c++)
+			out[i * bpp + c] = sum[c] >> H_SHIFT;
+	}
+}
+
+static void h_row_scalar(int16_t *out, const uint8_t *row,
+                         const struct gp_resize_axis *ax, unsigned int bpp)
+{
+	/* Let the compiler unroll the loop over channels */
+	switch (bpp) {
+	case 1:
+		h_row_bpp(out, row, ax, 0, 1);
+	break;
+	case 2:
+		h_row_bpp(out, row, ax, 0, 2);
+	break;
+	case 3:
+		h_row_bpp(out, row, ax, 0, 3);
+	break;
+	case 4:
+		h_row_bpp(out, row, ax, 0, 4);
+	break;
+	}
+}
+
+static void v_row_range(uint8_t *out, const int16_t *const *rows,
+                        const int16_t *w, gp_size taps, size_t j, size_t n)
+{
+	gp_size k;
+
+	for (; j < n; j++) {
+		int32_t sum = 1<<(V_SHIFT-1);
+
+		for (k = 0; k < taps; k++)
+			sum += rows[k][j] * w[k];
+
+		sum >>= V_SHIFT;
+
+		out[j] = GP_CLAMP(sum, 0, 255);
+	}
+}
+
+static void v_row_scalar(uint8_t *out, const int16_t *const *rows,
+                         const int16_t *w, gp_size taps, size_t n)
+{
+	v_row_range(out, rows, w, taps, 0, n);
+}
+
+#ifdef GP_CPU_X86
+
+/* Pair of weights for _mm_madd_epi16() */
+static inline int32_t w_pair(const int16_t *w, gp_size k, gp_size taps)
+{
+	uint32_t hi = k + 1 < taps ? (uint16_t)w[k+1] : 0;
+
+	return (hi << 16) | (uint16_t)w[k];
+}
+
+/*
+ * Three channels at once, works as h_row4_sse2() but the loads read a few
+ * bytes past the pixels, hence the pixels whose window ends at the end of
+ * the source row and the last destination pixel, which would write one value
+ * past the row, are done by the scalar code.
+ */
+__attribute__((target("sse2")))
+static void h_row3_sse2(int16_t *out, const uint8_t *row,
+                        const struct gp_resize_axis *ax,
+                        unsigned int bpp __attribute__((unused)))
+{
+	__m128i zero = _mm_setzero_si128();
+	gp_size i, k, taps = ax->taps;
+
+	for (i = 0; i + 1 < ax->size && ax->off[i] + taps < ax->src_size; i++) {
+		const uint8_t *p = row + (size_t)ax->off[i] * 3;
+		const int16_t *w = ax->w + i * taps;
+		__m128i acc = _mm_set1_epi32(1<<(H_SHIFT-1));
+
+		for (k = 0; k + 1 < taps; k += 2) {
+			__m128i a = _mm_loadl_epi64((const __m128i*)(p + 3 * k));
+			__m128i c = _mm_set1_epi32(w_pair(w, k, taps));
+
+			a = _mm_unpacklo_epi8(a, zero);
+			a = _mm_unpacklo_epi16(a, _mm_srli_si128(a, 6));
+
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(a, c));
+		}
+
+		if (k < taps) {
+			int32_t px;
+			__m128i a, c = _mm_set1_epi32(w_pair(w, k, taps));
+
+			memcpy(&px, p + 3 * k, 4);
+
+			a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(px), zero);
+			a = _mm_unpacklo_epi16(a, zero);
+
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(a, c));
+		}
+
+		acc = _mm_srai_epi32(acc, H_SHIFT);
+
+		_mm_storel_epi64((__m128i*)(out + 3 * i), _mm_packs_epi32(acc, acc));
+	}
+
+	h_row_bpp(out, row, ax, i, 3);
+}
+
+/*
+ * Four channels at once, the two neighbouring pixels are interleaved so that
+ * the madd sums channel values of both pixels multiplied by their weights.
+ */
+__attribute__((target("sse2")))
+static void h_row4_sse2(int16_t *out, const uint8_t *row,
+                        const struct gp_resize_axis *ax,
+                        unsigned int bpp __attribute__((unused)))
+{
+	__m128i zero = _mm_setzero_si128();
+	gp_size i, k, taps = ax->taps;
+
+	for (i = 0; i < ax->size; i++) {
+		const uint8_t *p = row + (size_t)ax->off[i] * 4;
+		const int16_t *w = ax->w + i * taps;
+		__m128i acc = _mm_set1_epi32(1<<(H_SHIFT-1));
+
+		for (k = 0; k + 1 < taps; k += 2) {
+			__m128i a = _mm_loadl_epi64((const __m128i*)(p + 4 * k));
+			__m128i c = _mm_set1_epi32(w_pair(w, k, taps));
+
+			a = _mm_unpacklo_epi8(a, zero);
+			a = _mm_unpacklo_epi16(a, _mm_srli_si128(a, 8));
+
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(a, c));
+		}
+
+		if (k < taps) {
+			int32_t px;
+			__m128i a, c = _mm_set1_epi32(w_pair(w, k, taps));
+
+			memcpy(&px, p + 4 * k, 4);
+
+			a = _mm_unpacklo_epi8(_mm_cvtsi32_si128(px), zero);
+			a = _mm_unpacklo_epi16(a, zero);
+
+			acc = _mm_add_epi32(acc, _mm_madd_epi16(a, c));
+		}
+
+		acc = _mm_srai_epi32(acc, H_SHIFT);
+
+		_mm_storel_epi64((__m128i*)(out + 4 * i), _mm_packs_epi32(acc, acc));
+	}
+}
+
+__attribute__((target("sse2")))
+static void v_row_sse2(uint8_t *out, const int16_t *const *rows,
+                       const int16_t *w, gp_size taps, size_t n)
+{
+	__m128i zero = _mm_setzero_si128();
+	size_t j;
+	gp_size k;
+
+	for (j = 0; j + 8 <= n; j += 8) {
+		__m128i acc0 = _mm_set1_epi32(1<<(V_SHIFT-1));
+		__m128i acc1 = acc0;
+		__m128i res;
+
+		for (k = 0; k < taps; k += 2) {
+			__m128i a = _mm_loadu_si128((const __m128i*)(rows[k] + j));
+			__m128i b = k + 1 < taps ?
+			            _mm_loadu_si128((const __m128i*)(rows[k+1] + j)) : zero;
+			__m128i c = _mm_set1_epi32(w_pair(w, k, taps));
+
+			acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_unpacklo_epi16(a, b), c));
+			acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_unpackhi_epi16(a, b), c));
+		}
+
+		res = _mm_packs_epi32(_mm_srai_epi32(acc0, V_SHIFT),
+		                      _mm_srai_epi32(acc1, V_SHIFT));
+
+		_mm_storel_epi64((__m128i*)(out + j), _mm_packus_epi16(res, res));
+	}
+
+	v_row_range(out, rows, w, taps, j, n);
+}
+
+/*
+ * The unpack and pack instructions work in 128 bit lanes, acc0 holds sums for
+ * values 0-3 and 8-11, acc1 for 4-7 and 12-15, so the packed result ends up in
+ * the right order.
+ */
+__attribute__((target("avx2")))
+static void v_row_avx2(uint8_t *out, const int16_t *const *rows,
+                       const int16_t *w, gp_size taps, size_t n)
+{
+	__m256i zero = _mm256_setzero_si256();
+	size_t j;
+	gp_size k;
+
+	for (j = 0; j + 16 <= n; j += 16) {
+		__m256i acc0 = _mm256_set1_epi32(1<<(V_SHIFT-1));
+		__m256i acc1 = acc0;
+		__m256i res;
+
+		for (k = 0; k < taps; k += 2) {
+			__m256i a = _mm256_loadu_si256((const __m256i*)(rows[k] + j));
+			__m256i b = k + 1 < taps ?
+			            _mm256_loadu_si256((const __m256i*)(rows[k+1] + j)) : zero;
+			__m256i c = _mm256_set1_epi32(w_pair(w, k, taps));
+
+			acc0 = _mm256_add_epi32(acc0, _mm256_madd_epi16(_mm256_unpacklo_epi16(a, b), c));
+			acc1 = _mm256_add_epi32(acc1, _mm256_madd_epi16(_mm256_unpackhi_epi16(a, b), c));
+		}
+
+		res = _mm256_packs_epi32(_mm256_srai_epi32(acc0, V_SHIFT),
+		                         _mm256_srai_epi32(acc1, V_SHIFT));
+		res = _mm256_permute4x64_epi64(_mm256_packus_epi16(res, res), 0x08);
+
+		_mm_storeu_si128((__m128i*)(out + j), _mm256_castsi256_si128(res));
+	}
+
+	v_row_range(out, rows, w, taps, j, n);
+}
+
+#endif /* GP_CPU_X86 */
+
+static const gp_cpu_impl h_row3_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_SSE2, h_row3_sse2},
+#endif
+	{0, h_row_scalar},
+};
+
+static const gp_cpu_impl h_row4_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_SSE2, h_row4_sse2},
+#endif
+	{0, h_row_scalar},
+};
+
+static const gp_cpu_impl v_row_impls[] = {
+#ifdef GP_CPU_X86
+	{GP_CPU_AVX2, v_row_avx2},
+	{GP_CPU_SSE2, v_row_sse2},
+#endif
+	{0, v_row_scalar},
+};
+
+GP_CPU_DISPATCH(h_row3_simd, h_row_fn, h_row3_impls);
+GP_CPU_DISPATCH(h_row4_simd, h_row_fn, h_row4_impls);
+GP_CPU_DISPATCH(v_row_simd, v_row_fn, v_row_impls);
+
+int gp_resize_sep_supported(gp_pixel_type pixel_type)
+{
+	if (!GP_VALID_PIXELTYPE(pixel_type))
+		return 0;
+
+	return gp_pixel_has_flags(pixel_type, GP_PIXEL_IS_8BPC);
+}
+
+struct gp_resize_sep {
+	struct gp_resize_axis x;
+	struct gp_resize_axis y;
+	gp_pixel_type pixel_type;
+	unsigned int bpp;
+	/* Channel bytes of a 32 bit pixel or 0 if there is no padding */
+	uint32_t chan_mask;
+	h_row_fn h_row;
+	v_row_fn v_row;
+	/* Ring buffers for the bands, one per thread */
+	size_t ring_size;
+	gp_threads_slots rings;
+};
+
+struct resize_sep_job {
+	struct gp_resize_sep *rs;
+	/* The first src and dst pixmap rows are image rows src_y and dst_y */
+	const gp_pixmap *src;
+	gp_coord src_y;
+	gp_pixmap *dst;
+	gp_coord dst_y;
+};
+
+static void clear_pad(const struct gp_resize_sep *rs, uint8_t *out)
+{
+	gp_size x;
+
+	for (x = 0; x < rs->x.size; x++) {
+		uint32_t p;
+
+		memcpy(&p, out + 4 * x, 4);
+		p &= rs->chan_mask;
+		memcpy(out + 4 * x, &p, 4);
+	}
+}
+
+static int resize_sep_rows(void *priv, gp_coord y0, gp_size h)
+{
+	const struct resize_sep_job *job = priv;
+	struct gp_resize_sep *rs = job->rs;
+	gp_size taps = rs->y.taps;
+	size_t row_len = (size_t)rs->x.size * rs->bpp;
+	const int16_t *rows[taps];
+	uint32_t next = rs->y.off[y0];
+	unsigned int slot;
+	gp_coord y;
+	gp_size k;
+	int16_t *ring;
+
+	ring = gp_threads_slot_get(&rs->rings, &slot);
+	if (!ring)
+		return 1;
+
+	for (y = y0; y < y0 + (gp_coord)h; y++) {
+		uint32_t off = rs->y.off[y];
+		uint8_t *out = GP_PIXEL_ADDR(job->dst, 0, y - job->dst_y);
+		uint32_t sy;
+
+		/* Resample the source rows that are not in the ring yet */
+		for (sy = GP_MAX(next, off); sy < off + taps; sy++) {
+			rs->h_row(ring + (sy % taps) * row_len,
+			          GP_PIXEL_ADDR(job->src, 0, sy - job->src_y),
+			          &rs->x, rs->bpp);
+		}
+
+		next = off + taps;
+
+		for (k = 0; k < taps; k++)
+			rows[k] = ring + ((off + k) % taps) * row_len;
+
+		rs->v_row(out, rows, rs->y.w + y * taps, taps, row_len);
+
+		if (rs->chan_mask)
+			clear_pad(rs, out);
+	}
+
+	gp_threads_slot_put(&rs->rings, slot);
+	return 0;
+}
+
+/*
+ * Pixel bytes that are not part of any channel, i.e. the x in xRGB8888, are
+ * set to zero in the output.
+ */
+static void init_pad(struct gp_resize_sep *rs, gp_pixel_type pixel_type)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixel_type);
+	uint8_t mask[4] = {};
+	unsigned int i;
+
+	rs->chan_mask = 0;
+
+	if (rs->bpp != 4)
+		return;
+
+	for (i = 0; i < desc->numchannels; i++)
+		mask[desc->channels[i].offset / 8] = 0xff;
+
+	memcpy(&rs->chan_mask, mask, 4);
+
+	if (rs->chan_mask == 0xffffffff)
+		rs->chan_mask = 0;
+}
+
+struct gp_resize_sep *gp_resize_sep_create(gp_pixel_type pixel_type,
+                                           gp_size src_w, gp_size src_h,
+                                           gp_size dst_w, gp_size dst_h,
+                                           enum gp_resize_kernel kern_x,
+                                           enum gp_resize_kernel kern_y)
+{
+	struct gp_resize_sep *rs;
+
+	if (!gp_resize_sep_supported(pixel_type)) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	rs = calloc(1, sizeof(*rs));
+	if (!rs) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	rs->pixel_type = pixel_type;
+	rs->bpp = gp_pixel_size(pixel_type) / 8;
+
+	init_pad(rs, pixel_type);
+
+	if (gp_resize_axis_init(&rs->x, kern_x, src_w, dst_w))
+		goto err0;
+
+	if (gp_resize_axis_init(&rs->y, kern_y, src_h, dst_h))
+		goto err1;
+
+	switch (rs->bpp) {
+	case 3:
+		rs->h_row = h_row3_simd();
+	break;
+	case 4:
+		rs->h_row = h_row4_simd();
+	break;
+	default:
+		rs->h_row = h_row_scalar;
+	}
+
+	rs->v_row = v_row_simd();
+
+	rs->ring_size = sizeof(int16_t) * dst_w * rs->bpp * rs->y.taps;
+
+	return rs;
+err1:
+	gp_resize_axis_free(&rs->x);
+err0:
+	free(rs);
+	return NULL;
+}
+
+int gp_resize_sep_exec(struct gp_resize_sep *self,
+                       const gp_pixmap *src, gp_pixmap *dst,
+                       gp_progress_cb *callback)
+{
+	struct resize_sep_job job = {.rs = self, .dst = dst};
+	gp_pixmap *tmp = NULL;
+	unsigned int t;
+	gp_size band_h;
+	int ret;
+
+	GP_DEBUG(1, "Separable resampling %ux%u -> %ux%u %2.2f %2.2f",
+	         src->w, src->h, dst->w, dst->h,
+	         1.00 * dst->w / src->w, 1.00 * dst->h / src->h);
+
+	t = gp_nr_threads(dst->w, dst->h, callback);
+
+	if (gp_threads_slots_alloc(&self->rings, t, self->ring_size))
+		return 1;
+
+	/* The bands read source rows that may be written by other bands */
+	if (src->pixels == dst->pixels) {
+		tmp = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+		if (!tmp)
+			return 1;
+		src = tmp;
+	}
+
+	job.src = src;
+
+	/*
+	 * The taps are source rows, the bands are destination rows, hence the
+	 * taps count only as the cost and not as a band height limit, otherwise
+	 * heavily downscaled images would run in a single band.
+	 */
+	band_h = gp_threads_band_rows(dst->h, t, (gp_size)dst->w * self->bpp,
+	                              self->x.taps + self->y.taps, 1);
+
+	ret = gp_threads_rows_ex(dst->h, t, band_h, resize_sep_rows, &job, callback);
+
+	gp_pixmap_free(tmp);
+	return ret;
+}
+
+void gp_resize_sep_src_rows(const struct gp_resize_sep *self,
+                            gp_coord dst_y, gp_size h,
+                            gp_coord *src_y0, gp_coord *src_y1)
+{
+	*src_y0 = self->y.off[dst_y];
+	*src_y1 = self->y.off[dst_y + h - 1] + self->y.taps;
+}
+
+int gp_resize_sep_rows(struct gp_resize_sep *self,
+                       const gp_pixmap *src, gp_coord src_y,
+                       gp_pixmap *dst, gp_coord dst_y)
+{
+	struct resize_sep_job job = {
+		.rs = self,
+		.src = src,
+		.src_y = src_y,
+		.dst = dst,
+		.dst_y = dst_y,
+	};
+
+	if (gp_threads_slots_alloc(&self->rings, 1, self->ring_size))
+		return 1;
+
+	return resize_sep_rows(&job, dst_y, dst->h);
+}
+
+void gp_resize_sep_free(struct gp_resize_sep *self)
+{
+	if (!self)
+		return;
+
+	gp_resize_axis_free(&self->x);
+	gp_resize_axis_free(&self->y);
+	gp_threads_slots_free(&self->rings);
+	free(self);
+}
+
+int gp_resize_sep(const gp_pixmap *src, gp_pixmap *dst,
+                  enum gp_resize_kernel kern_x, enum gp_resize_kernel kern_y,
+                  gp_progress_cb *callback)
+{
+	struct gp_resize_sep *rs;
+	int ret;
+
+	rs = gp_resize_sep_create(src->pixel_type, src->w, src->h,
+	                          dst->w, dst->h, kern_x, kern_y);
+	if (!rs)
+		return 1;
+
+	ret = gp_resize_sep_exec(rs, src, dst, callback);
+
+	gp_resize_sep_free(rs);
+
+	return ret;
+}
+
+int gp_resize_sep_kernels(gp_interpolation_type type,
+                          gp_size src_w, gp_size src_h,
+                          gp_size dst_w, gp_size dst_h,
+                          enum gp_resize_kernel *kern_x,
+                          enum gp_resize_kernel *kern_y)
+{
+	switch (type) {
+	case GP_INTERP_LINEAR_INT:
+		*kern_x = *kern_y = GP_RESIZE_KERN_LINEAR;
+	break;
+	case GP_INTERP_LINEAR_LF_INT:
+		*kern_x = dst_w < src_w ? GP_RESIZE_KERN_AREA : GP_RESIZE_KERN_LINEAR;
+		*kern_y = dst_h < src_h ? GP_RESIZE_KERN_AREA : GP_RESIZE_KERN_LINEAR;
+	break;
+	case GP_INTERP_CUBIC_INT:
+		*kern_x = *kern_y = GP_RESIZE_KERN_CUBIC;
+	break;
+	case GP_INTERP_LANCZOS_INT:
+		*kern_x = *kern_y = GP_RESIZE_KERN_LANCZOS3;
+	break;
+	case GP_INTERP_AREA_INT:
+		*kern_x = *kern_y = GP_RESIZE_KERN_AREA;
+	break;
+	default:
+		return 0;
+	}
+
+	return 1;
+}
@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Separable resampling for pixel types with 8 bit per channel byte aligned
+   channels, i.e. RGB888, xRGB8888, RGBA8888, G8, etc.
+
+   The image is resampled horizontally and vertically in two passes, the
+   weights for both axes are precomputed once, the destination is processed
+   in bands of rows in parallel and the passes use SIMD instructions, picked
+   at runtime, where available.
+
+  */
+
+#ifndef FILTERS_GP_RESIZE_SEP_H
+#define FILTERS_GP_RESIZE_SEP_H
+
+#include <stdint.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_progress_callback.h>
+#include <filters/gp_resize.h>
+
+enum gp_resize_kernel {
+	/* Linear interpolation, the image corners are mapped onto each other */
+	GP_RESIZE_KERN_LINEAR,
+	/* Cubic interpolation with A=0.5, corners mapped as for linear */
+	GP_RESIZE_KERN_CUBIC,
+	/* Area averaging, each destination pixel is an average of its footprint */
+	GP_RESIZE_KERN_AREA,
+	/* Lanczos with a=3, stretched over the footprint on downscaling */
+	GP_RESIZE_KERN_LANCZOS3,
+};
+
+/*
+ * Precomputed weights for one axis.
+ *
+ * Destination pixel i is a weighted sum of taps source pixels starting at
+ * off[i] with weights w[i * taps] ... w[i * taps + taps - 1]. The weights are
+ * in 2.14 fixed point and add up to exactly 1 << 14.
+ */
+struct gp_resize_axis {
+	gp_size taps;
+	gp_size size;
+	gp_size src_size;
+	uint32_t *off;
+	int16_t *w;
+};
+
+/*
+ * Computes weights for resampling src_size pixels into dst_size pixels.
+ *
+ * Returns zero on success, non-zero and sets errno on a failure.
+ */
+int gp_resize_axis_init(struct gp_resize_axis *self, enum gp_resize_kernel kern,
+                        gp_size src_size, gp_size dst_size)
+	__attribute__ ((visibility ("hidden")));
+
+void gp_resize_axis_free(struct gp_resize_axis *self)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Returns non-zero if pixel type is supported by gp_resize_sep().
+ */
+int gp_resize_sep_supported(gp_pixel_type pixel_type)
+	__attribute__ ((visibility ("hidden")));
+
+struct gp_resize_sep;
+
+/*
+ * Precomputes weights for resampling src_w x src_h into dst_w x dst_h.
+ *
+ * Returns NULL and sets errno on a failure, ENOSYS if pixel type is not
+ * supported.
+ */
+struct gp_resize_sep *gp_resize_sep_create(gp_pixel_type pixel_type,
+                                           gp_size src_w, gp_size src_h,
+                                           gp_size dst_w, gp_size dst_h,
+                                           enum gp_resize_kernel kern_x,
+                                           enum gp_resize_kernel kern_y)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Resamples src into dst, the pixmaps must match the sizes and pixel type the
+ * resampler was created for.
+ *
+ * The ring buffers for the threads are allocated on the first call and when
+ * the number of threads grows, otherwise there is no allocation. Must not be
+ * called concurrently on the same resampler.
+ *
+ * Returns zero on success, non-zero on a failure or abort from the callback.
+ */
+int gp_resize_sep_exec(struct gp_resize_sep *self,
+                       const gp_pixmap *src, gp_pixmap *dst,
+                       gp_progress_cb *callback)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Returns range of source rows [*src_y0, *src_y1) that are needed for
+ * destination rows [dst_y, dst_y + h). The ranges do not decrease with
+ * growing dst_y.
+ */
+void gp_resize_sep_src_rows(const struct gp_resize_sep *self,
+                            gp_coord dst_y, gp_size h,
+                            gp_coord *src_y0, gp_coord *src_y1)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Resamples destination rows [dst_y, dst_y + dst->h) into dst, the src pixmap
+ * holds the source rows returned by gp_resize_sep_src_rows() and the first
+ * src row is the source image row src_y. Runs in the calling thread.
+ *
+ * Returns zero on success, non-zero on a failure.
+ */
+int gp_resize_sep_rows(struct gp_resize_sep *self,
+                       const gp_pixmap *src, gp_coord src_y,
+                       gp_pixmap *dst, gp_coord dst_y)
+	__attribute__ ((visibility ("hidden")));
+
+void gp_resize_sep_free(struct gp_resize_sep *self)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Maps interpolation type to kernels for the separable resampler, returns
+ * zero if the interpolation is not implemented by the resampler.
+ */
+int gp_resize_sep_kernels(gp_interpolation_type type,
+                          gp_size src_w, gp_size src_h,
+                          gp_size dst_w, gp_size dst_h,
+                          enum gp_resize_kernel *kern_x,
+                          enum gp_resize_kernel *kern_y)
+	__attribute__ ((visibility ("hidden")));
+
+/*
+ * Resamples src into dst, the pixel types must match and must be supported.
+ *
+ * The kernels for horizontal and vertical direction may differ.
+ *
+ * Returns zero on success, non-zero on a failure or abort from the callback.
+ */
+int gp_resize_sep(const gp_pixmap *src, gp_pixmap *dst,
+                  enum gp_resize_kernel kern_x, enum gp_resize_kernel kern_y,
+                  gp_progress_cb *callback)
+	__attribute__ ((visibility ("hidden")));
+
+#endif /* FILTERS_GP_RESIZE_SEP_H */
@@ -0,0 +1,1151 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gp_rotate.gen.c
+ *
+ * GENERATED on 2026 10 18 07:45:24 from gp_rotate.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Vertical Mirror alogorithm
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <filters/gp_rotate.h>
+
+/*
+ * Byte aligned pixels are rotated in square tiles, both the source rows and
+ * destination rows of a tile fit into L1 cache so that each cache line is
+ * read and written only once.
+ *
+ * The work is split into bands of destination rows, i.e. source columns, and
+ * run in threads.
+ */
+#define TILE 32
+
+struct rotate_rows {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	int (*rotate)(const gp_pixmap *src, gp_pixmap *dst,
+	              gp_coord y, gp_size h, gp_progress_cb *callback);
+};
+
+static int rotate_rows(void *priv, gp_coord y, gp_size h)
+{
+	const struct rotate_rows *rows = priv;
+
+	return rows->rotate(rows->src, rows->dst, y, h, NULL);
+}
+
+static int rotate_tiled_mp(const gp_pixmap *src, gp_pixmap *dst,
+                           int (*rotate)(const gp_pixmap *src, gp_pixmap *dst,
+                                         gp_coord y, gp_size h,
+                                         gp_progress_cb *callback),
+                           gp_progress_cb *callback)
+{
+	unsigned int t = gp_nr_threads(src->w, src->h, callback);
+	struct rotate_rows rows = {
+		.src = src,
+		.dst = dst,
+		.rotate = rotate,
+	};
+	gp_size band_h;
+
+	if (t == 1)
+		return rotate(src, dst, 0, src->w, callback);
+
+	band_h = gp_threads_band_rows(src->w, t, src->bytes_per_row, 1, 1);
+	band_h = (band_h + TILE - 1) / TILE * TILE;
+
+	return gp_threads_rows_ex(src->w, t, band_h, rotate_rows, &rows, callback);
+}
+
+
+static int rotate_90_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_1BPP_LE(dst, yr, x, gp_getpixel_raw_1BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_1BPP_BE(dst, yr, x, gp_getpixel_raw_1BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_2BPP_LE(dst, yr, x, gp_getpixel_raw_2BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_2BPP_BE(dst, yr, x, gp_getpixel_raw_2BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_4BPP_LE(dst, yr, x, gp_getpixel_raw_4BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_4BPP_BE(dst, yr, x, gp_getpixel_raw_4BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 90.
+ */
+static int rotate_90_tiled_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row x from the right */
+				uint8_t *d = GP_PIXEL_ADDR(dst, src->h - y0 - 1, x);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 1);
+					s += src->bytes_per_row;
+					d -= 1;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_90_tiled_8BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 90.
+ */
+static int rotate_90_tiled_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row x from the right */
+				uint8_t *d = GP_PIXEL_ADDR(dst, src->h - y0 - 1, x);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 2);
+					s += src->bytes_per_row;
+					d -= 2;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_90_tiled_16BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 90.
+ */
+static int rotate_90_tiled_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row x from the right */
+				uint8_t *d = GP_PIXEL_ADDR(dst, src->h - y0 - 1, x);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 3);
+					s += src->bytes_per_row;
+					d -= 3;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_90_tiled_24BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 90.
+ */
+static int rotate_90_tiled_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row x from the right */
+				uint8_t *d = GP_PIXEL_ADDR(dst, src->h - y0 - 1, x);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 4);
+					s += src->bytes_per_row;
+					d -= 4;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_90_tiled_32BPP, callback);
+}
+
+static int rotate_90_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t yr = src->h - y - 1;
+			gp_putpixel_raw_18BPP_LE(dst, yr, x, gp_getpixel_raw_18BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                     gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_BPP_PIXMAP(rotate_90, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_90(const gp_pixmap *src, gp_pixmap *dst,
+                        gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (rotate_90(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_90_alloc(const gp_pixmap *src,
+                                     gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_90(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+static int rotate_180_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_LE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_LE(src, xr, yr);
+			gp_putpixel_raw_1BPP_LE(dst, x, y, pix1);
+			gp_putpixel_raw_1BPP_LE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_1BPP_BE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_1BPP_BE(src, xr, yr);
+			gp_putpixel_raw_1BPP_BE(dst, x, y, pix1);
+			gp_putpixel_raw_1BPP_BE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_LE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_LE(src, xr, yr);
+			gp_putpixel_raw_2BPP_LE(dst, x, y, pix1);
+			gp_putpixel_raw_2BPP_LE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_2BPP_BE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_2BPP_BE(src, xr, yr);
+			gp_putpixel_raw_2BPP_BE(dst, x, y, pix1);
+			gp_putpixel_raw_2BPP_BE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_LE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_LE(src, xr, yr);
+			gp_putpixel_raw_4BPP_LE(dst, x, y, pix1);
+			gp_putpixel_raw_4BPP_LE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_4BPP_BE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_4BPP_BE(src, xr, yr);
+			gp_putpixel_raw_4BPP_BE(dst, x, y, pix1);
+			gp_putpixel_raw_4BPP_BE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_8BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_8BPP(src, xr, yr);
+			gp_putpixel_raw_8BPP(dst, x, y, pix1);
+			gp_putpixel_raw_8BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_16BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_16BPP(src, xr, yr);
+			gp_putpixel_raw_16BPP(dst, x, y, pix1);
+			gp_putpixel_raw_16BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_24BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_24BPP(src, xr, yr);
+			gp_putpixel_raw_24BPP(dst, x, y, pix1);
+			gp_putpixel_raw_24BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_32BPP(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_32BPP(src, xr, yr);
+			gp_putpixel_raw_32BPP(dst, x, y, pix1);
+			gp_putpixel_raw_32BPP(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 180 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+			uint32_t xr = src->w - x - 1;
+			uint32_t yr = src->h - y - 1;
+
+			gp_pixel pix0 = gp_getpixel_raw_18BPP_LE(src, x, y);
+			gp_pixel pix1 = gp_getpixel_raw_18BPP_LE(src, xr, yr);
+			gp_putpixel_raw_18BPP_LE(dst, x, y, pix1);
+			gp_putpixel_raw_18BPP_LE(dst, xr, yr, pix0);
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_BPP_PIXMAP(rotate_180, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_180(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->w && src->h <= dst->h,
+	          "Destination is not large enough");
+
+	if (rotate_180(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_copy(src, 0);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_180(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
+
+static int rotate_270_1BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_1BPP_LE(dst, y, xr, gp_getpixel_raw_1BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_1BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_1BPP_BE(dst, y, xr, gp_getpixel_raw_1BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_2BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_2BPP_LE(dst, y, xr, gp_getpixel_raw_2BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_2BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_2BPP_BE(dst, y, xr, gp_getpixel_raw_2BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_4BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_4BPP_LE(dst, y, xr, gp_getpixel_raw_4BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_4BPP_BE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_4BPP_BE(dst, y, xr, gp_getpixel_raw_4BPP_BE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 270.
+ */
+static int rotate_270_tiled_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row w - x - 1 */
+				uint8_t *d = GP_PIXEL_ADDR(dst, y0, src->w - x - 1);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 1);
+					s += src->bytes_per_row;
+					d += 1;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_8BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_270_tiled_8BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 270.
+ */
+static int rotate_270_tiled_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row w - x - 1 */
+				uint8_t *d = GP_PIXEL_ADDR(dst, y0, src->w - x - 1);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 2);
+					s += src->bytes_per_row;
+					d += 2;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_16BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_270_tiled_16BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 270.
+ */
+static int rotate_270_tiled_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row w - x - 1 */
+				uint8_t *d = GP_PIXEL_ADDR(dst, y0, src->w - x - 1);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 3);
+					s += src->bytes_per_row;
+					d += 3;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_24BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_270_tiled_24BPP, callback);
+}
+
+/*
+ * Rotates source columns [x_start, x_start + cols) by 270.
+ */
+static int rotate_270_tiled_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+				/* Source column x is written to destination row w - x - 1 */
+				uint8_t *d = GP_PIXEL_ADDR(dst, y0, src->w - x - 1);
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, 4);
+					s += src->bytes_per_row;
+					d += 4;
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270_32BPP(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_270_tiled_32BPP, callback);
+}
+
+static int rotate_270_18BPP_LE(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	uint32_t x, y;
+
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	for (x = 0; x < src->w; x++) {
+		for (y = 0; y < src->h; y++) {
+				uint32_t xr = src->w - x - 1;
+				gp_putpixel_raw_18BPP_LE(dst, y, xr, gp_getpixel_raw_18BPP_LE(src, x, y));
+		}
+
+		if (gp_progress_cb_report(callback, x, src->w, src->h))
+			return 1;
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+static int rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                      gp_progress_cb *callback)
+{
+	GP_FN_RET_PER_BPP_PIXMAP(rotate_270, src, src, dst, callback);
+	return 1;
+}
+
+int gp_filter_rotate_270(const gp_pixmap *src, gp_pixmap *dst,
+                         gp_progress_cb *callback)
+{
+	GP_ASSERT(src->pixel_type == dst->pixel_type,
+	          "The src and dst pixel types must match");
+	GP_ASSERT(src->w <= dst->h && src->h <= dst->w,
+	          "Destination is not large enough");
+
+	if (rotate_270(src, dst, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		return 1;
+	}
+
+	return 0;
+}
+
+gp_pixmap *gp_filter_rotate_270_alloc(const gp_pixmap *src,
+                                      gp_progress_cb *callback)
+{
+	gp_pixmap *res;
+
+	res = gp_pixmap_alloc(src->h, src->w, src->pixel_type);
+
+	if (res == NULL)
+		return NULL;
+
+	if (rotate_270(src, res, callback)) {
+		GP_DEBUG(1, "Operation aborted");
+		gp_pixmap_free(res);
+		return NULL;
+	}
+
+	return res;
+}
@@ -5,11 +5,125 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <errno.h>
+#include <string.h>
+
 #include <core/gp_debug.h>
 #include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
 #include <filters/gp_rotate.h>
 
+/*
+ * Byte aligned pixels are rotated in square tiles, both the source rows and
+ * destination rows of a tile fit into L1 cache so that each cache line is
+ * read and written only once.
+ *
+ * The work is split into bands of destination rows, i.e. source columns, and
+ * run in threads.
+ */
+#define TILE 32
+
+struct rotate_rows {
+	const gp_pixmap *src;
+	gp_pixmap *dst;
+	int (*rotate)(const gp_pixmap *src, gp_pixmap *dst,
+	              gp_coord y, gp_size h, gp_progress_cb *callback);
+};
+
+static int rotate_rows(void *priv, gp_coord y, gp_size h)
+{
+	const struct rotate_rows *rows = priv;
+
+	return rows->rotate(rows->src, rows->dst, y, h, NULL);
+}
+
+static int rotate_tiled_mp(const gp_pixmap *src, gp_pixmap *dst,
+                           int (*rotate)(const gp_pixmap *src, gp_pixmap *dst,
+                                         gp_coord y, gp_size h,
+                                         gp_progress_cb *callback),
+                           gp_progress_cb *callback)
+{
+	unsigned int t = gp_nr_threads(src->w, src->h, callback);
+	struct rotate_rows rows = {
+		.src = src,
+		.dst = dst,
+		.rotate = rotate,
+	};
+	gp_size band_h;
+
+	if (t == 1)
+		return rotate(src, dst, 0, src->w, callback);
+
+	band_h = gp_threads_band_rows(src->w, t, src->bytes_per_row, 1, 1);
+	band_h = (band_h + TILE - 1) / TILE * TILE;
+
+	return gp_threads_rows_ex(src->w, t, band_h, rotate_rows, &rows, callback);
+}
+
+@ def rotate_tiled(ps, deg):
+@     bpp = ps.size // 8
+/*
+ * Rotates source columns [x_start, x_start + cols) by {{ deg }}.
+ */
+static int rotate_{{ deg }}_tiled_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_coord x_start, gp_size cols,
+                                     gp_progress_cb *callback)
+{
+	gp_coord x_end = x_start + cols;
+	gp_coord x0, y0, x, y;
+
+	for (x0 = x_start; x0 < x_end; x0 += TILE) {
+		gp_coord x1 = GP_MIN(x0 + TILE, x_end);
+
+		for (y0 = 0; y0 < (gp_coord)src->h; y0 += TILE) {
+			gp_coord y1 = GP_MIN(y0 + TILE, (gp_coord)src->h);
+
+			for (x = x0; x < x1; x++) {
+@     if deg == 90:
+				/* Source column x is written to destination row x from the right */
+				uint8_t *d = GP_PIXEL_ADDR(dst, src->h - y0 - 1, x);
+@     else:
+				/* Source column x is written to destination row w - x - 1 */
+				uint8_t *d = GP_PIXEL_ADDR(dst, y0, src->w - x - 1);
+@     end
+				const uint8_t *s = GP_PIXEL_ADDR(src, x, y0);
+
+				for (y = y0; y < y1; y++) {
+					memcpy(d, s, {{ bpp }});
+					s += src->bytes_per_row;
+@     if deg == 90:
+					d -= {{ bpp }};
+@     else:
+					d += {{ bpp }};
+@     end
+				}
+			}
+		}
+
+		if (gp_progress_cb_report(callback, x1, src->w, src->h)) {
+			errno = ECANCELED;
+			return 1;
+		}
+	}
+
+	gp_progress_cb_done(callback);
+	return 0;
+}
+
+@ end
+
 @ for ps in pixelsizes:
+@     if ps.size % 8 == 0:
+{@ rotate_tiled(ps, 90) @}
+static int rotate_90_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
+                                     gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 90 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_90_tiled_{{ ps.suffix }}, callback);
+}
+
+@     else:
 static int rotate_90_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
                                      gp_progress_cb *callback)
 {
@@ -31,6 +145,7 @@ static int rotate_90_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
 	return 0;
 }
 
+@     end
 @ end
 @
 static int rotate_90(const gp_pixmap *src, gp_pixmap *dst,
@@ -151,6 +266,17 @@ gp_pixmap *gp_filter_rotate_180_alloc(const gp_pixmap *src,
 }
 
 @ for ps in pixelsizes:
+@     if ps.size % 8 == 0:
+{@ rotate_tiled(ps, 270) @}
+static int rotate_270_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
+                                      gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Rotating image by 270 %ux%u", src->w, src->h);
+
+	return rotate_tiled_mp(src, dst, rotate_270_tiled_{{ ps.suffix }}, callback);
+}
+
+@     else:
 static int rotate_270_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
                                       gp_progress_cb *callback)
 {
@@ -172,6 +298,7 @@ static int rotate_270_{{ ps.suffix }}(const gp_pixmap *src, gp_pixmap *dst,
 	return 0;
 }
 
+@     end
 @ end
 @
 static int rotate_270(const gp_pixmap *src, gp_pixmap *dst,
@@ -0,0 +1,379 @@
+@ include source.t
+/*
+ * Summed area tables
+ *
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <core/gp_debug.h>
+
+#include <filters/gp_sat.h>
+
+/*
+ * Loads channel values of w pixels starting at x into vals, the coordinates
+ * are clamped to the pixmap.
+ */
+typedef void (*sat_load_fn)(const gp_pixmap *src, gp_coord x, gp_coord y,
+                            gp_size w, uint32_t *vals);
+
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+static void sat_load_{{ pt.name }}(const gp_pixmap *src, gp_coord x, gp_coord y,
+                                   gp_size w, uint32_t *vals)
+{
+	gp_coord x_max = (gp_coord)src->w - 1;
+	gp_size i;
+
+	y = GP_CLAMP(y, 0, (gp_coord)src->h - 1);
+
+	for (i = 0; i < w; i++) {
+		gp_coord xi = GP_CLAMP(x + (gp_coord)i, 0, x_max);
+		gp_pixel pix = gp_getpixel_raw_{{ pt.pixelsize.suffix }}(src, xi, y);
+
+@         for c in pt.chanslist:
+		*(vals++) = GP_PIXEL_GET_{{ c.name }}_{{ pt.name }}(pix);
+@         end
+	}
+}
+
+@ end
+@
+static sat_load_fn sat_load_get(gp_pixel_type pixel_type)
+{
+	switch (pixel_type) {
+@ for pt in pixeltypes:
+@     if not pt.is_unknown() and not pt.is_palette():
+	case GP_PIXEL_{{ pt.name }}:
+		return sat_load_{{ pt.name }};
+@ end
+	default:
+		return NULL;
+	}
+}
+
+struct sat_job {
+	gp_sat *sat;
+	const gp_pixmap *src;
+	gp_coord x, y;
+	sat_load_fn load;
+	size_t stride;
+};
+
+/*
+ * First pass, prefix sums of each row, the rows are independent.
+ */
+static void row_prefix(void *table, uint8_t bits, const uint32_t *vals,
+                       size_t n, unsigned int nr_chans, int square)
+{
+	size_t i;
+
+	if (bits == 32) {
+		uint32_t *t = table;
+
+		for (i = 0; i < nr_chans; i++)
+			t[i] = 0;
+
+		for (i = nr_chans; i < n; i++) {
+			uint32_t v = vals[i - nr_chans];
+			t[i] = t[i - nr_chans] + (square ? v * v : v);
+		}
+	} else {
+		uint64_t *t = table;
+
+		for (i = 0; i < nr_chans; i++)
+			t[i] = 0;
+
+		for (i = nr_chans; i < n; i++) {
+			uint64_t v = vals[i - nr_chans];
+			t[i] = t[i - nr_chans] + (square ? v * v : v);
+		}
+	}
+}
+
+static void *table_row(void *table, uint8_t bits, size_t stride, gp_coord y)
+{
+	return (char*)table + (size_t)y * stride * (bits / 8);
+}
+
+static int sat_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct sat_job *job = priv;
+	gp_sat *sat = job->sat;
+	uint32_t *vals = malloc(sizeof(uint32_t) * sat->w * sat->nr_chans);
+	gp_coord i;
+
+	if (!vals) {
+		errno = ENOMEM;
+		return 1;
+	}
+
+	for (i = y; i < y + (gp_coord)h; i++) {
+		job->load(job->src, job->x, job->y + i, sat->w, vals);
+
+		row_prefix(table_row(sat->sum, sat->sum_bits, job->stride, i + 1),
+		           sat->sum_bits, vals, job->stride, sat->nr_chans, 0);
+
+		if (sat->sqsum) {
+			row_prefix(table_row(sat->sqsum, sat->sqsum_bits, job->stride, i + 1),
+			           sat->sqsum_bits, vals, job->stride, sat->nr_chans, 1);
+		}
+	}
+
+	free(vals);
+	return 0;
+}
+
+/*
+ * Second pass, prefix sums of each column, done in blocks of columns, which
+ * keeps the accesses sequential and the blocks independent.
+ */
+#define COL_BLOCK 1024
+
+static void col_prefix(void *table, uint8_t bits, size_t stride, gp_size h,
+                       size_t start, size_t end)
+{
+	gp_size y;
+	size_t i;
+
+	for (y = 1; y <= h; y++) {
+		if (bits == 32) {
+			uint32_t *prev = table_row(table, bits, stride, y - 1);
+			uint32_t *cur = table_row(table, bits, stride, y);
+
+			for (i = start; i < end; i++)
+				cur[i] += prev[i];
+		} else {
+			uint64_t *prev = table_row(table, bits, stride, y - 1);
+			uint64_t *cur = table_row(table, bits, stride, y);
+
+			for (i = start; i < end; i++)
+				cur[i] += prev[i];
+		}
+	}
+}
+
+static int sat_cols(void *priv, gp_coord b, gp_size n)
+{
+	struct sat_job *job = priv;
+	gp_sat *sat = job->sat;
+	size_t start = (size_t)b * COL_BLOCK;
+	size_t end = GP_MIN(start + n * COL_BLOCK, job->stride);
+
+	col_prefix(sat->sum, sat->sum_bits, job->stride, sat->h, start, end);
+
+	if (sat->sqsum)
+		col_prefix(sat->sqsum, sat->sqsum_bits, job->stride, sat->h, start, end);
+
+	return 0;
+}
+
+/*
+ * Returns 32 if the sum over area pixels fits into 32 bits, 64 otherwise.
+ */
+static uint8_t acc_bits(const gp_pixel_type_desc *desc, uint64_t area,
+                        int square)
+{
+	uint64_t max = 0, chan_max;
+	unsigned int i;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		chan_max = (1ull << desc->channels[i].size) - 1;
+
+		if (square)
+			chan_max *= chan_max;
+
+		max = GP_MAX(max, chan_max);
+	}
+
+	if (max && area > UINT32_MAX / max)
+		return 64;
+
+	return 32;
+}
+
+/*
+ * Clips [c0, c1) extended by rad to [0, size).
+ */
+static int clip_range(gp_coord c0, gp_size len, gp_size rad, gp_size size,
+                      gp_coord *t0, gp_coord *t1)
+{
+	*t0 = GP_MAX(c0 - (gp_coord)rad, 0);
+	*t1 = GP_MIN(c0 + (gp_coord)(len + rad), (gp_coord)size);
+
+	return *t0 >= *t1;
+}
+
+gp_sat *gp_sat_alloc_ex(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_size xrad, gp_size yrad,
+                        int flags, gp_progress_cb *callback)
+{
+	const gp_pixel_type_desc *desc;
+	gp_coord x0, y0, x1, y1;
+	uint64_t area;
+	struct sat_job job;
+	unsigned int t;
+	gp_size w, h;
+	gp_sat *sat;
+	size_t size;
+
+	job.load = sat_load_get(src->pixel_type);
+	if (!job.load) {
+		GP_WARN("Unsupported pixel type %s",
+		        gp_pixel_type_name(src->pixel_type));
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	if (!src->w || !src->h || !w_src || !h_src) {
+		GP_WARN("Empty source rectangle");
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (clip_range(x_src, w_src, xrad, src->w, &x0, &x1) ||
+	    clip_range(y_src, h_src, yrad, src->h, &y0, &y1)) {
+		GP_WARN("Source rectangle outside of the pixmap");
+		errno = EINVAL;
+		return NULL;
+	}
+
+	w = x1 - x0;
+	h = y1 - y0;
+
+	desc = gp_pixel_desc(src->pixel_type);
+
+	sat = malloc(sizeof(gp_sat));
+	if (!sat) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	area = (2 * (uint64_t)xrad + 1) * (2 * (uint64_t)yrad + 1);
+
+	sat->w = w;
+	sat->h = h;
+	sat->xoff = x_src - x0;
+	sat->yoff = y_src - y0;
+	sat->nr_chans = desc->numchannels;
+	sat->sum_bits = acc_bits(desc, area, 0);
+	sat->sqsum_bits = acc_bits(desc, area, 1);
+	sat->sqsum = NULL;
+
+	size = (size_t)(w + 1) * (h + 1) * sat->nr_chans;
+
+	sat->sum = malloc(size * sat->sum_bits / 8);
+
+	if (flags & GP_SAT_SQUARES)
+		sat->sqsum = malloc(size * sat->sqsum_bits / 8);
+
+	if (!sat->sum || ((flags & GP_SAT_SQUARES) && !sat->sqsum)) {
+		errno = ENOMEM;
+		goto err;
+	}
+
+	GP_DEBUG(1, "Summed area table %ux%u (%u bit) squares %u bit",
+	         w, h, sat->sum_bits, sat->sqsum ? sat->sqsum_bits : 0);
+
+	job.sat = sat;
+	job.src = src;
+	job.x = x0;
+	job.y = y0;
+	job.stride = (size_t)(w + 1) * sat->nr_chans;
+
+	/* The first row is zero */
+	memset(sat->sum, 0, job.stride * sat->sum_bits / 8);
+	if (sat->sqsum)
+		memset(sat->sqsum, 0, job.stride * sat->sqsum_bits / 8);
+
+	t = gp_nr_threads(w, h, callback);
+
+	if (gp_threads_rows(h, t, sat_rows, &job, callback))
+		goto err;
+
+	if (gp_threads_rows_ex((job.stride + COL_BLOCK - 1) / COL_BLOCK, t, 1,
+	                       sat_cols, &job, NULL))
+		goto err;
+
+	return sat;
+err:
+	gp_sat_free(sat);
+	return NULL;
+}
+
+/*
+ * Splits [c0, c1) into parts inside of [0, size) each with a multiplier, the
+ * coordinates outside are clamped to the first or the last one.
+ */
+struct sat_span {
+	gp_size c0, c1;
+	uint64_t mul;
+};
+
+static unsigned int split_span(gp_coord c0, gp_coord c1, gp_size size,
+                               struct sat_span spans[3])
+{
+	gp_coord in0 = GP_MAX(c0, 0);
+	gp_coord in1 = GP_MIN(c1, (gp_coord)size);
+	unsigned int n = 0;
+
+	if (c0 < 0)
+		spans[n++] = (struct sat_span){0, 1, GP_MIN(c1, 0) - c0};
+
+	if (in0 < in1)
+		spans[n++] = (struct sat_span){in0, in1, 1};
+
+	if (c1 > (gp_coord)size) {
+		spans[n++] = (struct sat_span){size - 1, size,
+		                               c1 - GP_MAX(c0, (gp_coord)size)};
+	}
+
+	return n;
+}
+
+uint64_t gp_sat_table_sum_clamped(const gp_sat *self, const void *table,
+                                  uint8_t bits, unsigned int chan,
+                                  gp_coord x0, gp_coord y0,
+                                  gp_coord x1, gp_coord y1)
+{
+	struct sat_span xs[3], ys[3];
+	unsigned int nx, ny, i, j;
+	uint64_t sum = 0;
+
+	nx = split_span(x0, x1, self->w, xs);
+	ny = split_span(y0, y1, self->h, ys);
+
+	for (j = 0; j < ny; j++) {
+		for (i = 0; i < nx; i++) {
+			sum += xs[i].mul * ys[j].mul *
+			       gp_sat_table_rect(self, table, bits, chan,
+			                         xs[i].c0, ys[j].c0,
+			                         xs[i].c1, ys[j].c1);
+		}
+	}
+
+	return sum;
+}
+
+void gp_sat_free(gp_sat *self)
+{
+	int err = errno;
+
+	if (!self)
+		return;
+
+	free(self->sum);
+	free(self->sqsum);
+	free(self);
+
+	errno = err;
+}
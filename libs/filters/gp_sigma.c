@@ -12,28 +12,25 @@
 #include <core/gp_temp_alloc.h>
 #include <core/gp_clamp.h>
 #include <core/gp_debug.h>
+#include <core/gp_threads.h>
 #include <filters/gp_sigma.h>
 
-static int gp_filter_sigma_raw(const gp_pixmap *src,
-                               gp_coord x_src, gp_coord y_src,
-                               gp_size w_src, gp_size h_src,
-                               gp_pixmap *dst,
-                               gp_coord x_dst, gp_coord y_dst,
-                               int xrad, int yrad,
-                               unsigned int min, float sigma,
-                               gp_progress_cb *callback)
+/*
+ * Sums all pixels in the window for each output pixel, fastest for small
+ * windows.
+ */
+static int sigma_direct(const gp_pixmap *src,
+                        gp_coord x_src, gp_coord y_src,
+                        gp_size w_src, gp_size h_src,
+                        gp_pixmap *dst,
+                        gp_coord x_dst, gp_coord y_dst,
+                        int xrad, int yrad,
+                        unsigned int min, float sigma,
+                        gp_progress_cb *callback)
 {
 	int x, y;
 	unsigned int x1, y1;
 
-	if (src->pixel_type != GP_PIXEL_RGB888) {
-		errno = ENOSYS;
-		return -1;
-	}
-
-	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f",
-	         w_src, h_src, xrad, yrad, sigma);
-
 	unsigned int R_sigma = 255 * sigma;
 	unsigned int G_sigma = 255 * sigma;
 	unsigned int B_sigma = 255 * sigma;
@@ -186,6 +183,365 @@ static int gp_filter_sigma_raw(const gp_pixmap *src,
 	return 0;
 }
 
+/*
+ * Column histograms split into 16 coarse and 16x16 fine bins, the coarse bins
+ * keep the sum of the values as well.
+ */
+struct shist {
+	unsigned int coarse[16];
+	unsigned int sum[16];
+	unsigned int fine[16][16];
+};
+
+/*
+ * Window histogram, the fine bins are updated lazily only when needed, lx
+ * is the window position of the last update.
+ */
+struct shistw {
+	unsigned int coarse[16];
+	unsigned int sum[16];
+	unsigned int fine[16][16];
+	unsigned int lx[16];
+};
+
+static inline void shist_inc(struct shist *h, unsigned int val)
+{
+	h->coarse[val>>4]++;
+	h->sum[val>>4] += val;
+	h->fine[val>>4][val&0x0f]++;
+}
+
+static inline void shist_dec(struct shist *h, unsigned int val)
+{
+	h->coarse[val>>4]--;
+	h->sum[val>>4] -= val;
+	h->fine[val>>4][val&0x0f]--;
+}
+
+static inline void shistw_add(struct shistw *out, const struct shist *in)
+{
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		out->coarse[i] += in->coarse[i];
+		out->sum[i] += in->sum[i];
+	}
+}
+
+static inline void shistw_sub(struct shistw *out, const struct shist *in)
+{
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		out->coarse[i] -= in->coarse[i];
+		out->sum[i] -= in->sum[i];
+	}
+}
+
+static void shistw_init(struct shistw *h, const struct shist *cols,
+                        unsigned int xdiam)
+{
+	unsigned int i, j, k;
+
+	memset(h, 0, sizeof(*h));
+
+	for (k = 0; k < xdiam; k++) {
+		shistw_add(h, &cols[k]);
+
+		for (i = 0; i < 16; i++) {
+			for (j = 0; j < 16; j++)
+				h->fine[i][j] += cols[k].fine[i][j];
+		}
+	}
+}
+
+/*
+ * Updates fine bins of the coarse bin i for window at x, either from scratch
+ * or by moving the window from the last update, whatever is cheaper.
+ */
+static inline void shistw_update(struct shistw *h, unsigned int i,
+                                 const struct shist *cols, unsigned int x,
+                                 unsigned int xdiam)
+{
+	unsigned int j, k;
+	unsigned int lx = h->lx[i];
+	unsigned int dx = x - lx;
+
+	if (!dx)
+		return;
+
+	if (dx >= xdiam) {
+		memset(h->fine[i], 0, sizeof(h->fine[i]));
+
+		for (k = 0; k < xdiam; k++) {
+			for (j = 0; j < 16; j++)
+				h->fine[i][j] += cols[x + k].fine[i][j];
+		}
+	} else {
+		for (k = 0; k < dx; k++) {
+			for (j = 0; j < 16; j++) {
+				h->fine[i][j] -= cols[lx + k].fine[i][j];
+				h->fine[i][j] += cols[lx + k + xdiam].fine[i][j];
+			}
+		}
+	}
+
+	h->lx[i] = x;
+}
+
+/*
+ * Computes the new value from number and sum of the window values within
+ * sigma from the center value c, i.e. values in [c - s + 1, c + s - 1].
+ */
+static inline unsigned int shistw_sigma(struct shistw *h,
+                                        const struct shist *cols,
+                                        unsigned int x, unsigned int xdiam,
+                                        int c, int s, unsigned int min,
+                                        unsigned int cnt)
+{
+	int lo = GP_MAX(c - s + 1, 0);
+	int hi = GP_MIN(c + s - 1, 255);
+	unsigned int i, s_cnt = 0, s_sum = 0, sum = 0;
+	int j;
+
+	for (i = 0; i < 16; i++)
+		sum += h->sum[i];
+
+	for (i = lo>>4; lo <= hi && i <= (unsigned int)hi>>4; i++) {
+		int first = i<<4, last = first + 15;
+
+		if (first >= lo && last <= hi) {
+			s_cnt += h->coarse[i];
+			s_sum += h->sum[i];
+			continue;
+		}
+
+		shistw_update(h, i, cols, x, xdiam);
+
+		for (j = GP_MAX(first, lo); j <= GP_MIN(last, hi); j++) {
+			s_cnt += h->fine[i][j & 0x0f];
+			s_sum += j * h->fine[i][j & 0x0f];
+		}
+	}
+
+	if (s_cnt >= min && s_cnt)
+		return s_sum / s_cnt;
+
+	return (sum - c) / cnt;
+}
+
+/*
+ * Keeps a row of column histograms and a window histogram with coarse and
+ * fine bins, the same way as the constant time median filter does, so the
+ * cost per pixel does not depend on the window size.
+ */
+static int sigma_hist(const gp_pixmap *src,
+                      gp_coord x_src, gp_coord y_src,
+                      gp_size w_src, gp_size h_src,
+                      gp_pixmap *dst,
+                      gp_coord x_dst, gp_coord y_dst,
+                      int xrad, int yrad,
+                      unsigned int min, float sigma,
+                      gp_progress_cb *callback)
+{
+	int x, y;
+	int s = 255 * sigma;
+	unsigned int xdiam = 2 * xrad + 1;
+	unsigned int cnt = xdiam * (2 * yrad + 1) - 1;
+	unsigned int size = w_src + 2 * xrad;
+
+	gp_temp_alloc_create(temp, 3 * sizeof(struct shist) * size + 3 * sizeof(struct shistw));
+
+	struct shist *R = gp_temp_alloc_get(temp, sizeof(struct shist) * size);
+	struct shist *G = gp_temp_alloc_get(temp, sizeof(struct shist) * size);
+	struct shist *B = gp_temp_alloc_get(temp, sizeof(struct shist) * size);
+
+	struct shistw *XR = gp_temp_alloc_get(temp, sizeof(struct shistw));
+	struct shistw *XG = gp_temp_alloc_get(temp, sizeof(struct shistw));
+	struct shistw *XB = gp_temp_alloc_get(temp, sizeof(struct shistw));
+
+	memset(R, 0, sizeof(*R) * size);
+	memset(G, 0, sizeof(*G) * size);
+	memset(B, 0, sizeof(*B) * size);
+
+	/* Prefill row of histograms */
+	for (x = 0; x < (int)size; x++) {
+		int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+
+		for (y = -yrad; y <= yrad; y++) {
+			int yi = GP_CLAMP(y_src + y, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			shist_inc(&R[x], GP_PIXEL_GET_R_RGB888(pix));
+			shist_inc(&G[x], GP_PIXEL_GET_G_RGB888(pix));
+			shist_inc(&B[x], GP_PIXEL_GET_B_RGB888(pix));
+		}
+	}
+
+	for (y = 0; y < (int)h_src; y++) {
+		shistw_init(XR, R, xdiam);
+		shistw_init(XG, G, xdiam);
+		shistw_init(XB, B, xdiam);
+
+		for (x = 0; x < (int)w_src; x++) {
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, x_src + x, y_src + y);
+
+			int r = shistw_sigma(XR, R, x, xdiam, GP_PIXEL_GET_R_RGB888(pix), s, min, cnt);
+			int g = shistw_sigma(XG, G, x, xdiam, GP_PIXEL_GET_G_RGB888(pix), s, min, cnt);
+			int b = shistw_sigma(XB, B, x, xdiam, GP_PIXEL_GET_B_RGB888(pix), s, min, cnt);
+
+			gp_putpixel_raw_24BPP(dst, x_dst + x, y_dst + y,
+			                      GP_PIXEL_CREATE_RGB888(r, g, b));
+
+			if (x + 1 == (int)w_src)
+				break;
+
+			shistw_sub(XR, &R[x]);
+			shistw_sub(XG, &G[x]);
+			shistw_sub(XB, &B[x]);
+
+			shistw_add(XR, &R[x + xdiam]);
+			shistw_add(XG, &G[x + xdiam]);
+			shistw_add(XB, &B[x + xdiam]);
+		}
+
+		/* Recompute histograms, remove y - yrad pixel add y + yrad + 1 */
+		for (x = 0; x < (int)size; x++) {
+			int xi = GP_CLAMP(x_src + x - xrad, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y_src + y - yrad, 0, (int)src->h - 1);
+
+			gp_pixel pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			shist_dec(&R[x], GP_PIXEL_GET_R_RGB888(pix));
+			shist_dec(&G[x], GP_PIXEL_GET_G_RGB888(pix));
+			shist_dec(&B[x], GP_PIXEL_GET_B_RGB888(pix));
+
+			yi = GP_CLAMP(y_src + y + yrad + 1, 0, (int)src->h - 1);
+
+			pix = gp_getpixel_raw_24BPP(src, xi, yi);
+
+			shist_inc(&R[x], GP_PIXEL_GET_R_RGB888(pix));
+			shist_inc(&G[x], GP_PIXEL_GET_G_RGB888(pix));
+			shist_inc(&B[x], GP_PIXEL_GET_B_RGB888(pix));
+		}
+
+		if (gp_progress_cb_report(callback, y, h_src, w_src)) {
+			gp_temp_alloc_free(temp);
+			return 1;
+		}
+	}
+
+	gp_temp_alloc_free(temp);
+	gp_progress_cb_done(callback);
+
+	return 0;
+}
+
+/*
+ * Windows larger than this are processed by sigma_hist().
+ */
+#define SIGMA_DIRECT_MAX_AREA 49
+
+/*
+ * The image is split into vertical stripes the same way as for the median
+ * filter, the results are exactly the same as for the whole image processed
+ * at once.
+ */
+struct sigma_stripes {
+	const gp_pixmap *src;
+	gp_coord x_src, y_src;
+	gp_size w_src, h_src;
+	gp_pixmap *dst;
+	gp_coord x_dst, y_dst;
+	int xrad, yrad;
+	unsigned int min;
+	float sigma;
+	gp_size stripe_w;
+	int direct;
+};
+
+static int sigma_stripes(void *priv, gp_coord i, gp_size n)
+{
+	const struct sigma_stripes *s = priv;
+	gp_coord x = i * s->stripe_w;
+	gp_size w = GP_MIN(n * s->stripe_w, s->w_src - x);
+
+	if (s->direct) {
+		return sigma_direct(s->src, s->x_src + x, s->y_src, w, s->h_src,
+		                    s->dst, s->x_dst + x, s->y_dst,
+		                    s->xrad, s->yrad, s->min, s->sigma, NULL);
+	}
+
+	return sigma_hist(s->src, s->x_src + x, s->y_src, w, s->h_src,
+	                  s->dst, s->x_dst + x, s->y_dst,
+	                  s->xrad, s->yrad, s->min, s->sigma, NULL);
+}
+
+static int gp_filter_sigma_raw(const gp_pixmap *src,
+                               gp_coord x_src, gp_coord y_src,
+                               gp_size w_src, gp_size h_src,
+                               gp_pixmap *dst,
+                               gp_coord x_dst, gp_coord y_dst,
+                               int xrad, int yrad,
+                               unsigned int min, float sigma,
+                               gp_progress_cb *callback)
+{
+	unsigned int t = gp_nr_threads(w_src, h_src, callback);
+	gp_size stripe_w, stripes;
+	gp_pixmap *tmp = NULL;
+	int ret;
+
+	if (src->pixel_type != GP_PIXEL_RGB888) {
+		errno = ENOSYS;
+		return -1;
+	}
+
+	if (!w_src || !h_src)
+		return 0;
+
+	struct sigma_stripes s = {
+		.src = src,
+		.x_src = x_src,
+		.y_src = y_src,
+		.w_src = w_src,
+		.h_src = h_src,
+		.dst = dst,
+		.x_dst = x_dst,
+		.y_dst = y_dst,
+		.xrad = xrad,
+		.yrad = yrad,
+		.min = min,
+		.sigma = sigma,
+		.direct = (2 * xrad + 1) * (2 * yrad + 1) <= SIGMA_DIRECT_MAX_AREA,
+	};
+
+	/* The stripes read rows and columns the neighbours have written */
+	if (src == dst) {
+		tmp = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+		if (!tmp)
+			return 1;
+		s.src = tmp;
+	}
+
+	stripe_w = GP_MIN(w_src / (4 * t), 256u);
+	stripe_w = GP_MAX(stripe_w, GP_MAX(64u, 8u * xrad));
+	stripes = (w_src + stripe_w - 1) / stripe_w;
+
+	s.stripe_w = stripe_w;
+
+	GP_DEBUG(1, "Sigma Mean filter size %ux%u xrad=%u yrad=%u sigma=%.2f "
+	         "(%s) in %u threads %zu stripes",
+	         w_src, h_src, xrad, yrad, sigma,
+	         s.direct ? "direct" : "histogram", t, (size_t)stripes);
+
+	ret = gp_threads_rows_ex(stripes, t, 1, sigma_stripes, &s, callback);
+
+	gp_pixmap_free(tmp);
+
+	return ret;
+}
+
 int gp_filter_sigma_ex(const gp_pixmap *src,
                        gp_coord x_src, gp_coord y_src,
                        gp_size w_src, gp_size h_src,
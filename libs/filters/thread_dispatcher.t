@@ -1,8 +1,68 @@
-#
-# Generator for filter thread dispatcher code, licenced under LGPLv2+
-#
-# Copyright (c) 2018 Cyril Hrubis <metan@ucw.cz>
-#
-@ def dispatcher(fn_params):
+@ #
+@ # Generator for filter thread dispatcher code, licenced under LGPLv2+
+@ #
+@ # Copyright (c) 2018 Cyril Hrubis <metan@ucw.cz>
+@ #
+@ # Generates a fn_name_mp() function with the same parameters as fn_name() that
+@ # splits the work into row bands and runs them in the thread pool.
+@ #
+@ # The fn_params is a list of (type, name) tuples, the rows to process are
+@ # passed in 'y_src' and 'h_src' parameters, the optional 'y_dst' is moved
+@ # along with 'y_src' and the 'callback' has to be the last parameter.
+@ #
+@ # The w, h and bytes_per_row are C expressions used to pick number of threads
+@ # and band size.
+@ #
+@ def dispatcher_arg(name):
+@     if name == 'y_src' or name == 'y_dst':
+@         return 'rows->' + name + ' + y'
+@     if name == 'h_src':
+@         return 'h'
+@     if name == 'callback':
+@         return 'NULL'
+@     return 'rows->' + name
+@ end
+@
+@ def dispatcher_param(t, n):
+@     if t.endswith('*'):
+@         return t + n
+@     return t + ' ' + n
+@ end
+@
+@ def dispatcher_params(fn_params, padd):
+@     return (',\n' + ' ' * padd).join([dispatcher_param(t, n) for (t, n) in fn_params])
+@ end
+@
+@ def dispatcher(fn_name, fn_params, w, h, bytes_per_row):
+struct {{ fn_name }}_rows {
+@     for (t, n) in fn_params[:-1]:
+	{{ dispatcher_param(t, n) }};
+@     end
+};
 
+static int {{ fn_name }}_rows(void *priv, gp_coord y, gp_size h)
+{
+	const struct {{ fn_name }}_rows *rows = priv;
 
+	return {{ fn_name }}({{ ', '.join([dispatcher_arg(n) for (t, n) in fn_params]) }});
+}
+
+static int {{ fn_name }}_mp({{ dispatcher_params(fn_params, len(fn_name) + 15) }})
+{
+	unsigned int t = gp_nr_threads({{ w }}, {{ h }}, callback);
+	gp_size band_h;
+
+	if (t == 1)
+		return {{ fn_name }}({{ ', '.join([n for (t, n) in fn_params]) }});
+
+	struct {{ fn_name }}_rows rows = {
+@     for (t, n) in fn_params[:-1]:
+		.{{ n }} = {{ n }},
+@     end
+	};
+
+	band_h = gp_threads_band_rows({{ h }}, t, {{ bytes_per_row }}, 1, 1);
+
+	return gp_threads_rows_ex({{ h }}, t, band_h, {{ fn_name }}_rows, &rows, callback);
+}
+@ end
@@ -36,14 +36,20 @@ void gp_hline_raw_{{ ps.suffix }}(gp_pixmap *pixmap, int x0, int x1, int y,
 	x1 = GP_MIN(x1, (int) pixmap->w - 1);
 
 @     if ps.suffix in have_writepixels:
+@         if ps.needs_bit_endian():
 	size_t length = 1 + x1 - x0;
-	void *start = GP_PIXEL_ADDR(pixmap, x0, y);
 
-@         if ps.needs_bit_endian():
+	/* Subpixmap bit offset */
+	x0 += pixmap->offset / {{ ps.size }};
+
+	void *start = GP_PIXEL_ADDR(pixmap, x0, y);
 	unsigned int offset = GP_PIXEL_ADDR_OFFSET_{{ ps.suffix }}(x0);
 
 	gp_write_pixels_{{ ps.suffix }}(start, offset, length, pixel);
 @         else:
+	size_t length = 1 + x1 - x0;
+	void *start = GP_PIXEL_ADDR(pixmap, x0, y);
+
 	gp_write_pixels_{{ ps.suffix }}(start, length, pixel);
 @     else:
 	for (;x0 <= x1; x0++)
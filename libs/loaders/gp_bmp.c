@@ -17,6 +17,7 @@
 #include <ctype.h>
 #include <errno.h>
 #include <string.h>
+#include <stdlib.h>
 #include <stdio.h>
 
 #include <core/gp_debug.h>
@@ -26,9 +27,12 @@
 
 #include <loaders/gp_line_convert.h>
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_rows.h>
 
 #include <loaders/gp_bmp.h>
 
+#include "gp_raw_map.h"
+
 #define BMP_HEADER_OFFSET  0x0a       /* info header offset - 4 bytes */
 
 static const char *bmp_compress_names[] = {
@@ -711,6 +715,212 @@ err1:
 	return 1;
 }
 
+int gp_bmp_raw_map(gp_io *io, struct gp_raw_map *map)
+{
+	struct gp_bmp_info_header header;
+	uint32_t row_size;
+	int err;
+
+	if ((err = read_bitmap_header(io, &header))) {
+		errno = err;
+		return 1;
+	}
+
+	if (header.w <= 0 || header.h == 0 || header.h == INT32_MIN) {
+		GP_DEBUG(1, "Invalid size %"PRId32"x%"PRId32,
+		         header.w, header.h);
+		errno = EINVAL;
+		return 1;
+	}
+
+	switch (header.compress_type) {
+	case COMPRESS_RGB:
+	case COMPRESS_BITFIELDS:
+	case COMPRESS_ALPHABITFIELDS:
+	break;
+	default:
+		GP_DEBUG(1, "Cannot map compressed bitmap");
+		errno = ENOSYS;
+		return 1;
+	}
+
+	switch (header.bpp) {
+	case 16:
+	case 24:
+	case 32:
+	break;
+	default:
+		GP_DEBUG(1, "Cannot map %"PRIu16" bpp", header.bpp);
+		errno = ENOSYS;
+		return 1;
+	}
+
+	map->pixel_type = gp_bmp_pixel_type(&header);
+	if (map->pixel_type == GP_PIXEL_UNKNOWN) {
+		errno = ENOSYS;
+		return 1;
+	}
+
+	if ((uint32_t)header.w > (UINT32_MAX - 3) / (header.bpp / 8)) {
+		errno = EINVAL;
+		return 1;
+	}
+
+	/* Rows are four byte aligned */
+	row_size = header.w * (header.bpp / 8);
+
+	map->w = header.w;
+	map->h = GP_ABS(header.h);
+	map->bytes_per_row = (row_size + 3) & ~3u;
+	map->offset = header.pixel_offset;
+	map->bottom_up = header.h > 0;
+
+	return 0;
+}
+
+struct bmp_rows {
+	struct gp_bmp_info_header header;
+	/* Four byte aligned size of a row in the file */
+	uint32_t row_size;
+	uint32_t palette_size;
+	gp_pixel palette[256];
+	uint8_t row[];
+};
+
+static int bmp_read_rows(gp_row_reader *self, gp_pixmap *rows)
+{
+	struct bmp_rows *priv = GP_ROW_READER_PRIV(self);
+	struct gp_bmp_info_header *header = &priv->header;
+	uint32_t data_size = (uint32_t)header->w * (header->bpp / 8);
+	uint32_t x, y;
+
+	for (y = 0; y < rows->h; y++) {
+		uint32_t ry = self->row + y;
+		uint8_t *addr = GP_PIXEL_ADDR(rows, 0, y);
+		off_t off;
+
+		/* Bottom-up bitmap is read backwards */
+		if (header->h > 0)
+			ry = self->h - 1 - ry;
+
+		off = header->pixel_offset + (off_t)ry * priv->row_size;
+
+		if (gp_io_seek(self->io, off, GP_SEEK_SET) != off)
+			return errno;
+
+		if (!priv->palette_size) {
+			if (gp_io_fill(self->io, addr, data_size))
+				return errno;
+			continue;
+		}
+
+		if (gp_io_fill(self->io, priv->row, priv->row_size))
+			return errno;
+
+		for (x = 0; x < self->w; x++) {
+			uint8_t idx = get_idx(header, priv->row, x);
+			gp_pixel p = 0;
+
+			if (idx < priv->palette_size)
+				p = priv->palette[idx];
+
+			gp_putpixel_raw_24BPP(rows, x, y, p);
+		}
+	}
+
+	return 0;
+}
+
+static void bmp_close_rows(gp_row_reader GP_UNUSED(*self))
+{
+}
+
+static gp_row_reader *bmp_row_reader(gp_io *io)
+{
+	struct gp_bmp_info_header header;
+	gp_pixel_type pixel_type;
+	struct bmp_rows *priv;
+	gp_row_reader *self;
+	uint32_t row_size;
+	int err;
+
+	if ((err = read_bitmap_header(io, &header)))
+		goto err0;
+
+	if (header.w <= 0 || header.h == 0 || header.h == INT32_MIN) {
+		GP_DEBUG(1, "Invalid size %"PRId32"x%"PRId32,
+		         header.w, header.h);
+		err = EINVAL;
+		goto err0;
+	}
+
+	switch (header.compress_type) {
+	case COMPRESS_RGB:
+	case COMPRESS_BITFIELDS:
+	case COMPRESS_ALPHABITFIELDS:
+	break;
+	default:
+		GP_DEBUG(1, "Cannot decode rows of compressed bitmap");
+		err = ENOSYS;
+		goto err0;
+	}
+
+	if ((pixel_type = gp_bmp_pixel_type(&header)) == GP_PIXEL_UNKNOWN) {
+		err = ENOSYS;
+		goto err0;
+	}
+
+	switch (header.bpp) {
+	case 1:
+	case 2:
+	case 4:
+	case 8:
+		row_size = bitmap_row_size(&header);
+	break;
+	default:
+		if ((uint32_t)header.w > (UINT32_MAX - 3) / (header.bpp / 8)) {
+			err = EINVAL;
+			goto err0;
+		}
+		row_size = (header.w * (header.bpp / 8) + 3) & ~3u;
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv) + row_size);
+	if (!self) {
+		err = ENOMEM;
+		goto err0;
+	}
+
+	priv = GP_ROW_READER_PRIV(self);
+	priv->palette_size = 0;
+	priv->row_size = row_size;
+
+	if (header.bpp <= 8) {
+		check_palette_size(&header);
+		priv->palette_size = get_palette_size(&header);
+
+		err = read_bitmap_palette(io, &header, priv->palette,
+		                          priv->palette_size);
+		if (err)
+			goto err1;
+	}
+
+	priv->header = header;
+
+	self->read = bmp_read_rows;
+	self->close = bmp_close_rows;
+	self->w = header.w;
+	self->h = GP_ABS(header.h);
+	self->pixel_type = pixel_type;
+
+	return self;
+err1:
+	free(self);
+err0:
+	errno = err;
+	return NULL;
+}
+
 /*
  * Rows in bmp are four byte aligned.
  */
@@ -729,7 +939,7 @@ static uint32_t bmp_align_row_size(uint32_t width_bits)
  */
 static uint32_t bmp_count_bitmap_size(struct gp_bmp_info_header *header)
 {
-	return header->h * bmp_align_row_size(header->bpp * header->w);
+	return GP_ABS(header->h) * bmp_align_row_size(header->bpp * header->w);
 }
 
 static int bmp_write_header(gp_io *io, struct gp_bmp_info_header *header)
@@ -871,9 +1081,74 @@ err:
 	return 1;
 }
 
+static int bmp_write_rows(gp_row_writer *self, const gp_pixmap *rows)
+{
+	uint32_t row_size = bmp_align_row_size(24 * rows->w);
+	uint32_t data_size = 3 * rows->w;
+	char padd[3] = {0};
+	uint32_t y;
+
+	for (y = 0; y < rows->h; y++) {
+		if (gp_io_flush(self->io, GP_PIXEL_ADDR(rows, 0, y), data_size))
+			return errno;
+
+		if (row_size > data_size &&
+		    gp_io_flush(self->io, padd, row_size - data_size))
+			return errno;
+	}
+
+	return 0;
+}
+
+static int bmp_close_writer(gp_row_writer GP_UNUSED(*self))
+{
+	return 0;
+}
+
+static gp_row_writer *bmp_row_writer(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	struct gp_bmp_info_header header = {
+		.bpp = 24,
+		.w = w,
+		/* Rows are written top-down */
+		.h = -(int32_t)h,
+		.header_size = BITMAPINFOHEADER,
+		.palette_colors = 0,
+		.compress_type = COMPRESS_RGB,
+		.pixel_offset = BITMAPINFOHEADER + 14,
+	};
+	gp_row_writer *self;
+	int err;
+
+	if (pixel_type != GP_PIXEL_RGB888) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	if ((err = bmp_write_header(io, &header))) {
+		free(self);
+		errno = err;
+		return NULL;
+	}
+
+	self->write = bmp_write_rows;
+	self->close = bmp_close_writer;
+
+	return self;
+}
+
 const struct gp_loader gp_bmp = {
 	.read = gp_read_bmp_ex,
+	.row_reader = bmp_row_reader,
 	.write = gp_write_bmp,
+	.row_writer = bmp_row_writer,
 	.save_ptypes = out_pixel_types,
 	.match = gp_match_bmp,
 
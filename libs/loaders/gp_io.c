@@ -8,6 +8,7 @@
 #include <unistd.h>
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <fcntl.h>
 #include <stdarg.h>
 #include <inttypes.h>
@@ -18,6 +19,168 @@
 
 #include <loaders/gp_io.h>
 
+struct rbuf_io {
+	gp_io *io;
+	/* Offset of the buffer start in the parent I/O */
+	off_t off;
+	size_t bsize;
+	size_t bpos;
+	size_t bfill;
+	int close_parent;
+	uint8_t buf[];
+};
+
+/*
+ * The parent I/O offset is always at the end of the buffered data, i.e.
+ * off + bfill.
+ */
+static ssize_t rbuf_read(gp_io *io, void *buf, size_t size)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+	size_t avail = rbuf_io->bfill - rbuf_io->bpos;
+	size_t copied = 0;
+	ssize_t ret;
+
+	if (avail) {
+		copied = GP_MIN(avail, size);
+		memcpy(buf, rbuf_io->buf + rbuf_io->bpos, copied);
+		rbuf_io->bpos += copied;
+
+		if (copied == size)
+			return size;
+	}
+
+	rbuf_io->off += rbuf_io->bfill;
+	rbuf_io->bpos = 0;
+	rbuf_io->bfill = 0;
+
+	/* Large reads go directly into the caller buffer */
+	if (size - copied >= rbuf_io->bsize) {
+		ret = gp_io_read(rbuf_io->io, (uint8_t*)buf + copied,
+		                 size - copied);
+		if (ret <= 0)
+			return copied ? (ssize_t)copied : ret;
+
+		rbuf_io->off += ret;
+		return copied + ret;
+	}
+
+	ret = gp_io_read(rbuf_io->io, rbuf_io->buf, rbuf_io->bsize);
+	if (ret <= 0)
+		return copied ? (ssize_t)copied : ret;
+
+	rbuf_io->bfill = ret;
+	rbuf_io->bpos = GP_MIN((size_t)ret, size - copied);
+	memcpy((uint8_t*)buf + copied, rbuf_io->buf, rbuf_io->bpos);
+
+	return copied + rbuf_io->bpos;
+}
+
+static off_t rbuf_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+	off_t ret;
+
+	switch (whence) {
+	case GP_SEEK_CUR:
+		off += rbuf_io->off + rbuf_io->bpos;
+		whence = GP_SEEK_SET;
+	/* fallthrough */
+	case GP_SEEK_SET:
+		/* Seeks inside of the buffer are just pointer moves */
+		if (off >= rbuf_io->off &&
+		    off <= rbuf_io->off + (off_t)rbuf_io->bfill) {
+			rbuf_io->bpos = off - rbuf_io->off;
+			return off;
+		}
+	break;
+	case GP_SEEK_END:
+	break;
+	default:
+		GP_WARN("Invalid whence");
+		errno = EINVAL;
+		return -1;
+	}
+
+	ret = gp_io_seek(rbuf_io->io, off, whence);
+	if (ret == (off_t)-1)
+		return ret;
+
+	rbuf_io->off = ret;
+	rbuf_io->bpos = 0;
+	rbuf_io->bfill = 0;
+
+	return ret;
+}
+
+static int rbuf_close(gp_io *io)
+{
+	struct rbuf_io *rbuf_io = GP_IO_PRIV(io);
+	int ret = 0;
+
+	GP_DEBUG(1, "Closing IORBuffer (from %p)", rbuf_io->io);
+
+	if (rbuf_io->close_parent)
+		ret = gp_io_close(rbuf_io->io);
+
+	free(io);
+
+	return ret;
+}
+
+static gp_io *rbuffer(gp_io *pio, size_t bsize, int close_parent)
+{
+	struct rbuf_io *rbuf_io;
+	gp_io *io;
+	off_t off;
+
+	if (!bsize)
+		bsize = 16384;
+
+	GP_DEBUG(1, "Creating IORBuffer (from %p) size=%zu", pio, bsize);
+
+	off = gp_io_tell(pio);
+	if (off == (off_t)-1)
+		goto err;
+
+	io = malloc(sizeof(gp_io) + sizeof(*rbuf_io) + bsize);
+	if (!io) {
+		GP_DEBUG(1, "Malloc failed :(");
+		errno = ENOMEM;
+		goto err;
+	}
+
+	io->read = rbuf_read;
+	io->seek = rbuf_seek;
+	io->close = rbuf_close;
+	io->map = NULL;
+	io->write = NULL;
+	io->mark = 0;
+
+	rbuf_io = GP_IO_PRIV(io);
+	rbuf_io->io = pio;
+	rbuf_io->off = off;
+	rbuf_io->bsize = bsize;
+	rbuf_io->bpos = 0;
+	rbuf_io->bfill = 0;
+	rbuf_io->close_parent = close_parent;
+
+	return io;
+err:
+	if (close_parent) {
+		int err = errno;
+		gp_io_close(pio);
+		errno = err;
+	}
+
+	return NULL;
+}
+
+gp_io *gp_io_rbuffer(gp_io *pio, size_t bsize)
+{
+	return rbuffer(pio, bsize, 0);
+}
+
 struct file_io {
 	int fd;
 };
@@ -117,6 +280,11 @@ gp_io *gp_io_file(const char *path, enum gp_io_file_mode mode)
 		io->read = NULL;
 
 	io->close = file_close;
+	io->map = NULL;
+
+	/* Readers do a lot of small reads, buffer them */
+	if (mode == GP_IO_RDONLY)
+		return rbuffer(io, 0, 1);
 
 	return io;
 err1:
@@ -187,6 +355,21 @@ static off_t mem_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 	return mem_io->pos;
 }
 
+static const void *mem_map(gp_io *io, size_t size)
+{
+	struct mem_io *mem_io = GP_IO_PRIV(io);
+	const void *ret = mem_io->buf + mem_io->pos;
+
+	if (size > mem_io->size - mem_io->pos) {
+		errno = EIO;
+		return NULL;
+	}
+
+	mem_io->pos += size;
+
+	return ret;
+}
+
 static int mem_close(gp_io *io)
 {
 	struct mem_io *mem_io = GP_IO_PRIV(io);
@@ -219,6 +402,7 @@ gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *))
 	io->read = mem_read;
 	io->seek = mem_seek;
 	io->close = mem_close;
+	io->map = mem_map;
 	io->write = NULL;
 
 	mem_io = GP_IO_PRIV(io);
@@ -231,6 +415,100 @@ gp_io *gp_io_mem(void *buf, size_t size, void (*free)(void *))
 	return io;
 }
 
+static int mmap_close(gp_io *io)
+{
+	struct mem_io *mem_io = GP_IO_PRIV(io);
+	int ret = 0;
+
+	GP_DEBUG(1, "Closing IOMmap");
+
+	if (mem_io->size)
+		ret = munmap(mem_io->buf, mem_io->size);
+
+	free(io);
+
+	return ret;
+}
+
+gp_io *gp_io_mmap(const char *path)
+{
+	struct mem_io *mem_io;
+	struct stat st;
+	void *buf = NULL;
+	gp_io *io;
+	int fd, err;
+
+	GP_DEBUG(1, "Creating IOMmap '%s'", path);
+
+	fd = open(path, O_RDONLY);
+	if (fd < 0) {
+		err = errno;
+		GP_DEBUG(1, "Failed to open '%s': %s", path, strerror(errno));
+		goto err0;
+	}
+
+	if (fstat(fd, &st)) {
+		err = errno;
+		goto err1;
+	}
+
+	if (!S_ISREG(st.st_mode)) {
+		GP_DEBUG(1, "File '%s' is not a regular file", path);
+		err = EINVAL;
+		goto err1;
+	}
+
+	if ((uintmax_t)st.st_size > SIZE_MAX) {
+		err = EFBIG;
+		goto err1;
+	}
+
+	if (st.st_size) {
+		buf = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if (buf == MAP_FAILED) {
+			err = errno;
+			GP_DEBUG(1, "Failed to mmap '%s': %s",
+			         path, strerror(errno));
+			goto err1;
+		}
+
+		madvise(buf, st.st_size, MADV_SEQUENTIAL);
+	}
+
+	/* The mapping stays valid after the file is closed */
+	close(fd);
+
+	io = malloc(sizeof(gp_io) + sizeof(*mem_io));
+	if (!io) {
+		GP_DEBUG(1, "Malloc failed :(");
+		if (st.st_size)
+			munmap(buf, st.st_size);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	io->read = mem_read;
+	io->seek = mem_seek;
+	io->close = mmap_close;
+	io->map = mem_map;
+	io->write = NULL;
+	io->mark = 0;
+
+	mem_io = GP_IO_PRIV(io);
+
+	mem_io->free = NULL;
+	mem_io->buf = buf;
+	mem_io->size = st.st_size;
+	mem_io->pos = 0;
+
+	return io;
+err1:
+	close(fd);
+err0:
+	errno = err;
+	return NULL;
+}
+
 struct sub_io {
 	/* Points to parent IO */
 	off_t start;
@@ -318,6 +596,24 @@ static off_t sub_seek(gp_io *io, off_t off, enum gp_seek_whence whence)
 	return sub_io->cur - sub_io->start;
 }
 
+static const void *sub_map(gp_io *io, size_t size)
+{
+	struct sub_io *sub_io = GP_IO_PRIV(io);
+	const void *ret;
+
+	if (size > (size_t)(sub_io->end - sub_io->cur)) {
+		errno = EIO;
+		return NULL;
+	}
+
+	ret = gp_io_map(sub_io->io, size);
+
+	if (ret)
+		sub_io->cur += size;
+
+	return ret;
+}
+
 static int sub_close(gp_io *io)
 {
 	struct sub_io *sub_io = GP_IO_PRIV(io);
@@ -347,6 +643,7 @@ gp_io *gp_io_sub_io(gp_io *pio, size_t size)
 	io->read = sub_read;
 	io->seek = sub_seek;
 	io->close = sub_close;
+	io->map = sub_map;
 	io->write = NULL;
 
 	sub_io = GP_IO_PRIV(io);
@@ -359,6 +656,21 @@ gp_io *gp_io_sub_io(gp_io *pio, size_t size)
 	return io;
 }
 
+const void *gp_io_map(gp_io *io, size_t size)
+{
+	/*
+	 * The map callback is not initialized by I/O streams implemented
+	 * outside of the library, so it's used only for the memory backed
+	 * ones created here.
+	 */
+	if (io->read != mem_read && io->read != sub_read) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	return io->map(io, size);
+}
+
 struct buf_io {
 	gp_io *io;
 	size_t bsize;
@@ -387,7 +699,7 @@ static ssize_t buf_write(gp_io *io, const void *buf, size_t size)
 	struct buf_io *buf_io = GP_IO_PRIV(io);
 	size_t bfree = buf_io->bsize - buf_io->bpos;
 
-	if (bfree < size) {
+	if (bfree < size && buf_io->bpos) {
 		GP_DEBUG(1, "Flusing BufferIO (%p)", io);
 		if (gp_io_flush(buf_io->io, buf_io->buf, buf_io->bpos))
 			return -1;
@@ -426,6 +738,7 @@ gp_io *gp_io_wbuffer(gp_io *pio, size_t bsize)
 	io->close = wbuf_close;
 	io->read = NULL;
 	io->seek = NULL;
+	io->map = NULL;
 
 	buf_io = GP_IO_PRIV(io);
 	buf_io->io = pio;
@@ -233,6 +233,7 @@ gp_io *gp_io_zlib(gp_io *io, size_t comp_size)
 	new->read  = zlib_read;
 	new->write = NULL;
 	new->seek = zlib_seek;
+	new->map = NULL;
 
 	GP_DEBUG(1, "Initialized ZlibIO (%p)", new);
 
@@ -13,6 +13,7 @@
 #include <inttypes.h>
 
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <setjmp.h>
@@ -23,6 +24,7 @@
 #include <loaders/gp_exif.h>
 #include <loaders/gp_line_convert.h>
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_rows.h>
 
 /*
  * 0xff 0xd8 - start of image
@@ -94,6 +96,20 @@ static int load(struct jpeg_decompress_struct *cinfo, gp_pixmap *ret,
 	return 0;
 }
 
+static void invert_cmyk_row(uint8_t *buf, unsigned int w)
+{
+	unsigned int i;
+
+	for (i = 0; i < w; i++) {
+		unsigned int j = 4 * i;
+
+		buf[j]   = 0xff - buf[j];
+		buf[j+1] = 0xff - buf[j+1];
+		buf[j+2] = 0xff - buf[j+2];
+		buf[j+3] = 0xff - buf[j+3];
+	}
+}
+
 static int load_cmyk(struct jpeg_decompress_struct *cinfo, gp_pixmap *ret,
                        gp_progress_cb *callback)
 {
@@ -103,17 +119,7 @@ static int load_cmyk(struct jpeg_decompress_struct *cinfo, gp_pixmap *ret,
 		JSAMPROW addr = (void*)GP_PIXEL_ADDR(ret, 0, y);
 		jpeg_read_scanlines(cinfo, &addr, 1);
 
-		unsigned int i;
-		uint8_t *buf = GP_PIXEL_ADDR(ret, 0, y);
-
-		for (i = 0; i < ret->w; i++) {
-			unsigned int j = 4 * i;
-
-			buf[j]   = 0xff - buf[j];
-			buf[j+1] = 0xff - buf[j+1];
-			buf[j+2] = 0xff - buf[j+2];
-			buf[j+3] = 0xff - buf[j+3];
-		}
+		invert_cmyk_row(GP_PIXEL_ADDR(ret, 0, y), ret->w);
 
 		if (gp_progress_cb_report(callback, y, ret->h, ret->w)) {
 			GP_DEBUG(1, "Operation aborted");
@@ -257,8 +263,47 @@ static void save_jpg_markers(struct jpeg_decompress_struct *cinfo)
 	jpeg_save_markers(cinfo, JPEG_APP0 + 1, 0xffff);
 }
 
-int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
-		 gp_storage *storage, gp_progress_cb *callback)
+static gp_pixel_type out_pixel_type(struct jpeg_decompress_struct *cinfo)
+{
+	switch (cinfo->out_color_space) {
+	case JCS_GRAYSCALE:
+		return GP_PIXEL_G8;
+	case JCS_RGB:
+		return GP_PIXEL_BGR888;
+	case JCS_CMYK:
+		return GP_PIXEL_CMYK8888;
+	default:
+		GP_DEBUG(1, "Can't handle %s JPEG output format",
+		            get_colorspace(cinfo->out_color_space));
+		return GP_PIXEL_UNKNOWN;
+	}
+}
+
+/*
+ * Returns the largest DCT scaling denominator libjpeg can decode with such
+ * that the image is still large enough to be resized to fit w x h.
+ */
+static unsigned int scale_denom(unsigned int img_w, unsigned int img_h,
+                                gp_size w, gp_size h)
+{
+	unsigned int denom;
+
+	if (!w && !h)
+		return 1;
+
+	for (denom = 8; denom > 1; denom /= 2) {
+		int w_ok = w && (img_w + denom - 1) / denom >= w;
+		int h_ok = h && (img_h + denom - 1) / denom >= h;
+
+		if (w_ok || h_ok)
+			return denom;
+	}
+
+	return 1;
+}
+
+int gp_read_jpg_scaled(gp_io *io, gp_pixmap **img, gp_storage *storage,
+                       gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	struct jpeg_decompress_struct cinfo;
 	struct my_source_mgr src;
@@ -296,30 +341,25 @@ int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
 	if (!img)
 		goto exit;
 
-	gp_pixel pixel_type;
-
-	switch (cinfo.out_color_space) {
-	case JCS_GRAYSCALE:
-		pixel_type = GP_PIXEL_G8;
-	break;
-	case JCS_RGB:
-		pixel_type = GP_PIXEL_BGR888;
-	break;
-	case JCS_CMYK:
-		pixel_type = GP_PIXEL_CMYK8888;
-	break;
-	default:
-		pixel_type = GP_PIXEL_UNKNOWN;
-	}
+	gp_pixel pixel_type = out_pixel_type(&cinfo);
 
 	if (pixel_type == GP_PIXEL_UNKNOWN) {
-		GP_DEBUG(1, "Can't handle %s JPEG output format",
-		            get_colorspace(cinfo.out_color_space));
 		err = ENOSYS;
 		goto err1;
 	}
 
-	ret = gp_pixmap_alloc(cinfo.image_width, cinfo.image_height,
+	cinfo.scale_num = 1;
+	cinfo.scale_denom = scale_denom(cinfo.image_width, cinfo.image_height, w, h);
+
+	jpeg_calc_output_dimensions(&cinfo);
+
+	if (cinfo.scale_denom > 1) {
+		GP_DEBUG(1, "Decoding scaled by 1/%u to %ux%u",
+		         cinfo.scale_denom, cinfo.output_width,
+		         cinfo.output_height);
+	}
+
+	ret = gp_pixmap_alloc(cinfo.output_width, cinfo.output_height,
 			      pixel_type);
 
 	if (ret == NULL) {
@@ -363,6 +403,109 @@ err1:
 	return 1;
 }
 
+int gp_read_jpg_ex(gp_io *io, gp_pixmap **img,
+		 gp_storage *storage, gp_progress_cb *callback)
+{
+	return gp_read_jpg_scaled(io, img, storage, 0, 0, callback);
+}
+
+struct jpg_rows {
+	struct jpeg_decompress_struct cinfo;
+	struct my_source_mgr src;
+	struct my_jpg_err my_err;
+	uint8_t buf[1024];
+};
+
+static int jpg_read_rows(gp_row_reader *self, gp_pixmap *rows)
+{
+	struct jpg_rows *priv = GP_ROW_READER_PRIV(self);
+	uint32_t y;
+
+	if (setjmp(priv->my_err.setjmp_buf))
+		return EIO;
+
+	for (y = 0; y < rows->h; y++) {
+		JSAMPROW addr = (void*)GP_PIXEL_ADDR(rows, 0, y);
+
+		jpeg_read_scanlines(&priv->cinfo, &addr, 1);
+
+		if (rows->pixel_type == GP_PIXEL_CMYK8888)
+			invert_cmyk_row(addr, rows->w);
+	}
+
+	return 0;
+}
+
+static void jpg_close_rows(gp_row_reader *self)
+{
+	struct jpg_rows *priv = GP_ROW_READER_PRIV(self);
+
+	jpeg_destroy_decompress(&priv->cinfo);
+}
+
+/*
+ * Starts the decompression, kept separate from jpg_row_reader() so that there
+ * are no local variables modified after the setjmp().
+ */
+static int jpg_start_rows(struct jpg_rows *priv, gp_io *io,
+                          gp_pixel_type *pixel_type)
+{
+	priv->cinfo.err = jpeg_std_error(&priv->my_err.error_mgr);
+	priv->my_err.error_mgr.error_exit = my_error_exit;
+
+	if (setjmp(priv->my_err.setjmp_buf)) {
+		jpeg_destroy_decompress(&priv->cinfo);
+		return EIO;
+	}
+
+	jpeg_create_decompress(&priv->cinfo);
+	init_source_mgr(&priv->src, io, priv->buf, sizeof(priv->buf));
+	priv->cinfo.src = (void*)&priv->src;
+
+	jpeg_read_header(&priv->cinfo, TRUE);
+
+	*pixel_type = out_pixel_type(&priv->cinfo);
+	if (*pixel_type == GP_PIXEL_UNKNOWN) {
+		jpeg_destroy_decompress(&priv->cinfo);
+		return ENOSYS;
+	}
+
+	jpeg_start_decompress(&priv->cinfo);
+
+	return 0;
+}
+
+static gp_row_reader *jpg_row_reader(gp_io *io)
+{
+	gp_pixel_type pixel_type;
+	struct jpg_rows *priv;
+	gp_row_reader *self;
+	int err;
+
+	self = malloc(sizeof(*self) + sizeof(*priv));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	priv = GP_ROW_READER_PRIV(self);
+
+	err = jpg_start_rows(priv, io, &pixel_type);
+	if (err) {
+		free(self);
+		errno = err;
+		return NULL;
+	}
+
+	self->read = jpg_read_rows;
+	self->close = jpg_close_rows;
+	self->w = priv->cinfo.output_width;
+	self->h = priv->cinfo.output_height;
+	self->pixel_type = pixel_type;
+
+	return self;
+}
+
 static int save_convert(struct jpeg_compress_struct *cinfo,
                         const gp_pixmap *src,
                         gp_pixel_type out_pix,
@@ -470,6 +613,23 @@ static gp_pixel_type out_pixel_types[] = {
 	GP_PIXEL_UNKNOWN
 };
 
+static void set_color_space(struct jpeg_compress_struct *cinfo,
+                            gp_pixel_type out_pix)
+{
+	switch (out_pix) {
+	case GP_PIXEL_BGR888:
+		cinfo->input_components = 3;
+		cinfo->in_color_space = JCS_RGB;
+	break;
+	case GP_PIXEL_G8:
+		cinfo->input_components = 1;
+		cinfo->in_color_space = JCS_GRAYSCALE;
+	break;
+	default:
+		GP_BUG("Don't know how to set color_space and compoments");
+	}
+}
+
 int gp_write_jpg(const gp_pixmap *src, gp_io *io,
                 gp_progress_cb *callback)
 {
@@ -508,18 +668,7 @@ int gp_write_jpg(const gp_pixmap *src, gp_io *io,
 	cinfo.image_width  = src->w;
 	cinfo.image_height = src->h;
 
-	switch (out_pix) {
-	case GP_PIXEL_BGR888:
-		cinfo.input_components = 3;
-		cinfo.in_color_space = JCS_RGB;
-	break;
-	case GP_PIXEL_G8:
-		cinfo.input_components = 1;
-		cinfo.in_color_space = JCS_GRAYSCALE;
-	break;
-	default:
-		GP_BUG("Don't know how to set color_space and compoments");
-	}
+	set_color_space(&cinfo, out_pix);
 
 	jpeg_set_defaults(&cinfo);
 
@@ -543,6 +692,101 @@ int gp_write_jpg(const gp_pixmap *src, gp_io *io,
 	return 0;
 }
 
+struct jpg_row_writer {
+	struct jpeg_compress_struct cinfo;
+	struct my_dest_mgr dst;
+	struct my_jpg_err my_err;
+	uint8_t buf[1024];
+};
+
+static int jpg_write_rows(gp_row_writer *self, const gp_pixmap *rows)
+{
+	struct jpg_row_writer *priv = GP_ROW_WRITER_PRIV(self);
+	uint32_t y;
+
+	if (setjmp(priv->my_err.setjmp_buf))
+		return EIO;
+
+	for (y = 0; y < rows->h; y++) {
+		JSAMPROW row = (void*)GP_PIXEL_ADDR(rows, 0, y);
+
+		jpeg_write_scanlines(&priv->cinfo, &row, 1);
+	}
+
+	return 0;
+}
+
+static int jpg_close_writer(gp_row_writer *self)
+{
+	struct jpg_row_writer *priv = GP_ROW_WRITER_PRIV(self);
+
+	if (setjmp(priv->my_err.setjmp_buf)) {
+		jpeg_destroy_compress(&priv->cinfo);
+		return EIO;
+	}
+
+	if (self->row == self->h)
+		jpeg_finish_compress(&priv->cinfo);
+
+	jpeg_destroy_compress(&priv->cinfo);
+
+	return 0;
+}
+
+static gp_row_writer *jpg_row_writer(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	struct jpg_row_writer *priv;
+	gp_row_writer *self;
+
+	switch (pixel_type) {
+	case GP_PIXEL_BGR888:
+	case GP_PIXEL_G8:
+	break;
+	default:
+		GP_DEBUG(1, "Unsupported pixel type %s",
+		         gp_pixel_type_name(pixel_type));
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	priv = GP_ROW_WRITER_PRIV(self);
+
+	priv->cinfo.err = jpeg_std_error(&priv->my_err.error_mgr);
+	priv->my_err.error_mgr.error_exit = my_error_exit;
+
+	if (setjmp(priv->my_err.setjmp_buf)) {
+		jpeg_destroy_compress(&priv->cinfo);
+		free(self);
+		errno = EIO;
+		return NULL;
+	}
+
+	jpeg_create_compress(&priv->cinfo);
+
+	init_dest_mgr(&priv->dst, io, priv->buf, sizeof(priv->buf));
+	priv->cinfo.dest = (void*)&priv->dst;
+
+	priv->cinfo.image_width = w;
+	priv->cinfo.image_height = h;
+
+	set_color_space(&priv->cinfo, pixel_type);
+
+	jpeg_set_defaults(&priv->cinfo);
+	jpeg_start_compress(&priv->cinfo, TRUE);
+
+	self->write = jpg_write_rows;
+	self->close = jpg_close_writer;
+
+	return self;
+}
+
 #else
 
 int gp_read_jpg_ex(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
@@ -553,6 +797,15 @@ int gp_read_jpg_ex(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
 	return 1;
 }
 
+int gp_read_jpg_scaled(gp_io GP_UNUSED(*io), gp_pixmap GP_UNUSED(**img),
+                       gp_storage GP_UNUSED(*storage),
+                       gp_size GP_UNUSED(w), gp_size GP_UNUSED(h),
+                       gp_progress_cb GP_UNUSED(*callback))
+{
+	errno = ENOSYS;
+	return 1;
+}
+
 int gp_write_jpg(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
                 gp_progress_cb GP_UNUSED(*callback))
 {
@@ -565,7 +818,10 @@ int gp_write_jpg(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
 const gp_loader gp_jpg = {
 #ifdef HAVE_JPEG
 	.read = gp_read_jpg_ex,
+	.read_scaled = gp_read_jpg_scaled,
+	.row_reader = jpg_row_reader,
 	.write = gp_write_jpg,
+	.row_writer = jpg_row_writer,
 	.save_ptypes = out_pixel_types,
 #endif
 	.match = gp_match_jpg,
@@ -0,0 +1,382 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Batch image loader, the images are decoded on a set of worker threads.
+
+ */
+
+#include <pthread.h>
+#include <unistd.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+
+#include <loaders/gp_loader.h>
+#include <loaders/gp_load_batch.h>
+
+#define NO_ITEM SIZE_MAX
+
+enum item_state {
+	ITEM_QUEUED,
+	ITEM_LOADING,
+	ITEM_DONE,
+	ITEM_DELIVERED,
+};
+
+struct batch_item {
+	/* Either path or io is set */
+	char *path;
+	gp_io *io;
+	void *priv;
+
+	gp_pixmap *img;
+	int err;
+
+	enum item_state state;
+	/* Next item in the list of decoded items */
+	size_t next_done;
+};
+
+struct gp_load_batch {
+	pthread_mutex_t lock;
+	/* Signalled when an item was queued or the budget was freed */
+	pthread_cond_t work;
+	/* Signalled when an item was decoded */
+	pthread_cond_t done;
+
+	/* Items are accessed by index, the array may be reallocated */
+	struct batch_item *items;
+	size_t items_size;
+	size_t items_cnt;
+
+	/* First item that was not picked up by a worker */
+	size_t next_load;
+	/* Next item to return in the ordered mode */
+	size_t next_get;
+	size_t delivered;
+
+	/* List of decoded items in the order they were finished */
+	size_t done_head;
+	size_t done_tail;
+
+	size_t max_bytes;
+	size_t bytes;
+
+	int flags;
+	int exit;
+
+	unsigned int nr_threads;
+	pthread_t threads[];
+};
+
+static size_t img_bytes(const gp_pixmap *img)
+{
+	return img ? (size_t)img->bytes_per_row * img->h : 0;
+}
+
+static int over_budget(gp_load_batch *self)
+{
+	return self->max_bytes && self->bytes >= self->max_bytes;
+}
+
+static int abort_callback(gp_progress_cb *self)
+{
+	gp_load_batch *batch = self->priv;
+
+	return __atomic_load_n(&batch->exit, __ATOMIC_RELAXED);
+}
+
+static void item_done(gp_load_batch *self, size_t idx, gp_pixmap *img, int err)
+{
+	struct batch_item *item = &self->items[idx];
+
+	item->img = img;
+	item->err = img ? 0 : err;
+	item->state = ITEM_DONE;
+	item->next_done = NO_ITEM;
+
+	self->bytes += img_bytes(img);
+
+	if (self->done_tail != NO_ITEM)
+		self->items[self->done_tail].next_done = idx;
+	else
+		self->done_head = idx;
+
+	self->done_tail = idx;
+
+	pthread_cond_broadcast(&self->done);
+}
+
+static void *worker_main(void *arg)
+{
+	gp_load_batch *self = arg;
+	/* The decoding is parallelized over images, run loaders in one thread */
+	gp_progress_cb callback = {
+		.callback = abort_callback,
+		.priv = self,
+		.threads = 1,
+	};
+
+	pthread_mutex_lock(&self->lock);
+
+	for (;;) {
+		struct batch_item *item;
+		gp_pixmap *img = NULL;
+		char *path;
+		gp_io *io;
+		size_t idx;
+		int ret;
+
+		while (!self->exit &&
+		       (self->next_load >= self->items_cnt || over_budget(self)))
+			pthread_cond_wait(&self->work, &self->lock);
+
+		if (self->exit)
+			break;
+
+		idx = self->next_load++;
+		item = &self->items[idx];
+		item->state = ITEM_LOADING;
+		path = item->path;
+		io = item->io;
+
+		pthread_mutex_unlock(&self->lock);
+
+		if (path)
+			ret = gp_load_image_ex(path, &img, NULL, &callback);
+		else
+			ret = gp_read_image_ex(io, &img, NULL, &callback);
+
+		if (ret) {
+			GP_DEBUG(1, "Failed to load image %zu: %s",
+			         idx, strerror(errno));
+		}
+
+		pthread_mutex_lock(&self->lock);
+		item_done(self, idx, ret ? NULL : img, ret ? errno : 0);
+	}
+
+	pthread_mutex_unlock(&self->lock);
+
+	return NULL;
+}
+
+static void stop_workers(gp_load_batch *self, unsigned int nr_threads)
+{
+	unsigned int i;
+
+	pthread_mutex_lock(&self->lock);
+	__atomic_store_n(&self->exit, 1, __ATOMIC_RELAXED);
+	pthread_cond_broadcast(&self->work);
+	pthread_mutex_unlock(&self->lock);
+
+	for (i = 0; i < nr_threads; i++)
+		pthread_join(self->threads[i], NULL);
+}
+
+gp_load_batch *gp_load_batch_create(unsigned int threads, size_t max_bytes,
+                                    int flags)
+{
+	gp_load_batch *self;
+	unsigned int i;
+	int err;
+
+	if (!threads) {
+		long count = sysconf(_SC_NPROCESSORS_ONLN);
+
+		threads = count > 0 ? count : 1;
+	}
+
+	GP_DEBUG(1, "Creating batch loader %u threads budget %zu bytes",
+	         threads, max_bytes);
+
+	self = malloc(sizeof(*self) + threads * sizeof(pthread_t));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	memset(self, 0, sizeof(*self));
+
+	pthread_mutex_init(&self->lock, NULL);
+	pthread_cond_init(&self->work, NULL);
+	pthread_cond_init(&self->done, NULL);
+
+	self->done_head = NO_ITEM;
+	self->done_tail = NO_ITEM;
+	self->max_bytes = max_bytes;
+	self->flags = flags;
+
+	for (i = 0; i < threads; i++) {
+		err = pthread_create(&self->threads[i], NULL, worker_main, self);
+		if (err) {
+			GP_WARN("Failed to create worker thread: %s",
+			        strerror(err));
+			stop_workers(self, i);
+			free(self);
+			errno = err;
+			return NULL;
+		}
+	}
+
+	self->nr_threads = threads;
+
+	return self;
+}
+
+static int batch_add(gp_load_batch *self, char *path, gp_io *io, void *priv)
+{
+	struct batch_item *item;
+
+	pthread_mutex_lock(&self->lock);
+
+	if (self->items_cnt >= self->items_size) {
+		size_t size = self->items_size ? 2 * self->items_size : 64;
+		struct batch_item *items;
+
+		items = realloc(self->items, size * sizeof(*items));
+		if (!items) {
+			pthread_mutex_unlock(&self->lock);
+			errno = ENOMEM;
+			return 1;
+		}
+
+		self->items = items;
+		self->items_size = size;
+	}
+
+	item = &self->items[self->items_cnt++];
+
+	item->path = path;
+	item->io = io;
+	item->priv = priv;
+	item->img = NULL;
+	item->err = 0;
+	item->state = ITEM_QUEUED;
+	item->next_done = NO_ITEM;
+
+	pthread_cond_signal(&self->work);
+	pthread_mutex_unlock(&self->lock);
+
+	return 0;
+}
+
+int gp_load_batch_add(gp_load_batch *self, const char *path, void *priv)
+{
+	char *dup = strdup(path);
+
+	if (!dup) {
+		errno = ENOMEM;
+		return 1;
+	}
+
+	if (batch_add(self, dup, NULL, priv)) {
+		free(dup);
+		return 1;
+	}
+
+	return 0;
+}
+
+int gp_load_batch_add_io(gp_load_batch *self, gp_io *io, void *priv)
+{
+	return batch_add(self, NULL, io, priv);
+}
+
+/*
+ * Returns index of the next decoded item to return or NO_ITEM.
+ */
+static size_t next_done(gp_load_batch *self)
+{
+	size_t idx;
+
+	if (self->flags & GP_LOAD_BATCH_ORDERED) {
+		idx = self->next_get;
+
+		if (idx >= self->items_cnt || self->items[idx].state != ITEM_DONE)
+			return NO_ITEM;
+
+		self->next_get++;
+		return idx;
+	}
+
+	idx = self->done_head;
+
+	if (idx != NO_ITEM) {
+		self->done_head = self->items[idx].next_done;
+
+		if (self->done_head == NO_ITEM)
+			self->done_tail = NO_ITEM;
+	}
+
+	return idx;
+}
+
+int gp_load_batch_get(gp_load_batch *self, struct gp_load_batch_res *res)
+{
+	struct batch_item *item;
+	size_t idx;
+
+	pthread_mutex_lock(&self->lock);
+
+	while ((idx = next_done(self)) == NO_ITEM) {
+		if (self->delivered >= self->items_cnt) {
+			pthread_mutex_unlock(&self->lock);
+			errno = ENOENT;
+			return 1;
+		}
+
+		pthread_cond_wait(&self->done, &self->lock);
+	}
+
+	item = &self->items[idx];
+
+	res->idx = idx;
+	res->priv = item->priv;
+	res->img = item->img;
+	res->err = item->err;
+
+	self->bytes -= img_bytes(item->img);
+	self->delivered++;
+
+	item->state = ITEM_DELIVERED;
+	item->img = NULL;
+	free(item->path);
+	item->path = NULL;
+
+	/* The budget may have been freed */
+	pthread_cond_broadcast(&self->work);
+	pthread_mutex_unlock(&self->lock);
+
+	return 0;
+}
+
+void gp_load_batch_free(gp_load_batch *self)
+{
+	size_t i;
+
+	if (!self)
+		return;
+
+	stop_workers(self, self->nr_threads);
+
+	for (i = 0; i < self->items_cnt; i++) {
+		gp_pixmap_free(self->items[i].img);
+		free(self->items[i].path);
+	}
+
+	pthread_cond_destroy(&self->work);
+	pthread_cond_destroy(&self->done);
+	pthread_mutex_destroy(&self->lock);
+
+	free(self->items);
+	free(self);
+}
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Maps pixels of uncompressed images directly from a file.
+
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+
+#include <loaders/gp_loader.h>
+#include "gp_raw_map.h"
+
+static int raw_map(gp_io *io, struct gp_raw_map *map)
+{
+	char sig[2];
+
+	if (gp_io_peek(io, sig, sizeof(sig)) == -1)
+		return 1;
+
+	if (sig[0] == 'P')
+		return gp_pnm_raw_map(io, map);
+
+	if (sig[0] == 'B' && sig[1] == 'M')
+		return gp_bmp_raw_map(io, map);
+
+	errno = ENOSYS;
+	return 1;
+}
+
+static gp_pixmap *map_pixels(const char *src_path, struct gp_raw_map *map)
+{
+	off_t page_off = map->offset & ~(off_t)(sysconf(_SC_PAGESIZE) - 1);
+	size_t size = map->offset - page_off +
+	              (size_t)map->bytes_per_row * map->h;
+	gp_pixmap *pixmap;
+	uint8_t *start;
+	int fd, err;
+
+	fd = open(src_path, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+
+	/* Writes to a private mapping are copied on write */
+	start = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+	             fd, page_off);
+	err = errno;
+	close(fd);
+
+	if (start == MAP_FAILED) {
+		GP_DEBUG(1, "Failed to mmap '%s': %s", src_path, strerror(err));
+		errno = err;
+		return NULL;
+	}
+
+	pixmap = malloc(sizeof(gp_pixmap));
+	if (!pixmap) {
+		munmap(start, size);
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	gp_pixmap_init(pixmap, map->w, map->h, map->pixel_type,
+	               start + (map->offset - page_off));
+
+	pixmap->bytes_per_row = map->bytes_per_row;
+	pixmap->unmap_pixels = 1;
+
+	if (map->bottom_up)
+		gp_pixmap_set_rotation(pixmap, 0, 0, 1);
+
+	return pixmap;
+}
+
+gp_pixmap *gp_load_image_mmap(const char *src_path, gp_progress_cb *callback)
+{
+	struct gp_raw_map map;
+	gp_pixmap *ret;
+	off_t size;
+	gp_io *io;
+	int err;
+
+	io = gp_io_mmap(src_path);
+	if (!io)
+		goto load;
+
+	size = gp_io_size(io);
+	err = raw_map(io, &map);
+	gp_io_close(io);
+
+	if (err)
+		goto load;
+
+	if (size == (off_t)-1 || (uint64_t)map.offset +
+	    (uint64_t)map.bytes_per_row * map.h > (uint64_t)size) {
+		GP_DEBUG(1, "File '%s' is truncated", src_path);
+		goto load;
+	}
+
+	GP_DEBUG(1, "Mapping '%s' %ux%u %s offset %zu", src_path,
+	         map.w, map.h, gp_pixel_type_name(map.pixel_type),
+	         (size_t)map.offset);
+
+	ret = map_pixels(src_path, &map);
+	if (ret) {
+		gp_progress_cb_done(callback);
+		return ret;
+	}
+
+load:
+	return gp_load_image(src_path, callback);
+}
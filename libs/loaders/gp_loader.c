@@ -270,9 +270,35 @@ int gp_read_image_ex(gp_io *io, gp_pixmap **img, gp_storage *meta_data,
 	return loader->read(io, img, meta_data, callback);
 }
 
-int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
-                            gp_pixmap **img, gp_storage *storage,
-                            gp_progress_cb *callback)
+static int loader_read(const gp_loader *self, gp_io *io,
+                       gp_pixmap **img, gp_storage *storage,
+                       gp_size w, gp_size h, gp_progress_cb *callback)
+{
+	if (self->read_scaled && img && (w || h))
+		return self->read_scaled(io, img, storage, w, h, callback);
+
+	return self->read(io, img, storage, callback);
+}
+
+/*
+ * Regular files are mapped into the memory so that the loaders read from the
+ * page cache without a syscall per read, falls back to read() otherwise.
+ */
+static gp_io *open_file(const char *path)
+{
+	gp_io *io = gp_io_mmap(path);
+
+	if (io)
+		return io;
+
+	GP_DEBUG(1, "Failed to mmap '%s', using read()", path);
+
+	return gp_io_file(path, GP_IO_RDONLY);
+}
+
+static int loader_load(const gp_loader *self, const char *src_path,
+                       gp_pixmap **img, gp_storage *storage,
+                       gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	gp_io *io;
 	int err, ret;
@@ -284,11 +310,11 @@ int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
 		return ENOSYS;
 	}
 
-	io = gp_io_file(src_path, GP_IO_RDONLY);
+	io = open_file(src_path);
 	if (!io)
 		return 1;
 
-	ret = self->read(io, img, storage, callback);
+	ret = loader_read(self, io, img, storage, w, h, callback);
 
 	err = errno;
 	gp_io_close(io);
@@ -297,6 +323,12 @@ int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
 	return ret;
 }
 
+int gp_loader_load_image_ex(const gp_loader *self, const char *src_path,
+                            gp_pixmap **img, gp_storage *storage,
+                            gp_progress_cb *callback)
+{
+	return loader_load(self, src_path, img, storage, 0, 0, callback);
+}
 
 gp_pixmap *gp_loader_load_image(const gp_loader *self, const char *src_path,
                                gp_progress_cb *callback)
@@ -332,6 +364,21 @@ int gp_loader_read_image_ex(const gp_loader *self, gp_io *io,
 	return self->read(io, img, data, callback);
 }
 
+int gp_loader_read_image_scaled(const gp_loader *self, gp_io *io,
+                                gp_pixmap **img, gp_storage *data,
+                                gp_size w, gp_size h,
+                                gp_progress_cb *callback)
+{
+	GP_DEBUG(1, "Reading image (I/O %p) scaled to fit %ux%u", io, w, h);
+
+	if (!self->read) {
+		errno = ENOSYS;
+		return ENOSYS;
+	}
+
+	return loader_read(self, io, img, data, w, h, callback);
+}
+
 gp_pixmap *gp_load_image(const char *src_path, gp_progress_cb *callback)
 {
 	gp_pixmap *ret = NULL;
@@ -341,9 +388,9 @@ gp_pixmap *gp_load_image(const char *src_path, gp_progress_cb *callback)
 	return ret;
 }
 
-int gp_load_image_ex(const char *src_path,
-                     gp_pixmap **img, gp_storage *meta_data,
-                     gp_progress_cb *callback)
+static int load_image(const char *src_path,
+                      gp_pixmap **img, gp_storage *meta_data,
+                      gp_size w, gp_size h, gp_progress_cb *callback)
 {
 	int err;
 	struct stat st;
@@ -370,8 +417,8 @@ int gp_load_image_ex(const char *src_path,
 	ext_load = gp_loader_by_filename(src_path);
 
 	if (ext_load) {
-		if (!gp_loader_load_image_ex(ext_load, src_path,
-		                             img, meta_data, callback))
+		if (!loader_load(ext_load, src_path, img, meta_data,
+		                 w, h, callback))
 			return 0;
 	}
 
@@ -400,8 +447,8 @@ int gp_load_image_ex(const char *src_path,
 	}
 
 	if (sig_load) {
-		if (!gp_loader_load_image_ex(sig_load, src_path,
-		                          img, meta_data, callback))
+		if (!loader_load(sig_load, src_path, img, meta_data,
+		                 w, h, callback))
 			return 0;
 	}
 
@@ -409,6 +456,21 @@ int gp_load_image_ex(const char *src_path,
 	return 1;
 }
 
+int gp_load_image_ex(const char *src_path,
+                     gp_pixmap **img, gp_storage *meta_data,
+                     gp_progress_cb *callback)
+{
+	return load_image(src_path, img, meta_data, 0, 0, callback);
+}
+
+int gp_load_image_scaled(const char *src_path,
+                         gp_pixmap **img, gp_storage *meta_data,
+                         gp_size w, gp_size h,
+                         gp_progress_cb *callback)
+{
+	return load_image(src_path, img, meta_data, w, h, callback);
+}
+
 int gp_load_meta_data(const char *src_path, gp_storage *storage)
 {
 	const gp_loader *loader;
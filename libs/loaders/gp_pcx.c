@@ -144,6 +144,7 @@ static gp_io *rle(gp_io *io)
 	rle->write = NULL;
 	rle->seek = rle_seek;
 	rle->close = rle_close;
+	rle->map = NULL;
 
 	return rle;
 }
@@ -13,6 +13,7 @@
 #include <inttypes.h>
 
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "../../config.h"
@@ -23,6 +24,7 @@
 #include <loaders/gp_io.h>
 #include <loaders/gp_line_convert.h>
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_rows.h>
 
 #ifdef HAVE_LIBPNG
 
@@ -163,6 +165,26 @@ static int read_bitmap(gp_pixmap *res, gp_progress_cb *callback,
 	return 0;
 }
 
+static void convert_row(uint8_t *rrow, const uint16_t *row, unsigned int w,
+                        double gamma)
+{
+	unsigned int x;
+
+	if (gamma > 0.1) {
+		for (x = 0; x < w; x++) {
+			rrow[3*x] = row[3 * x]>>8;
+			rrow[3*x + 1] = row[3 * x + 1]>>8;
+			rrow[3*x + 2] = row[3 * x + 2]>>8;
+		}
+	} else {
+		for (x = 0; x < w; x++) {
+			rrow[3*x] = gp_linear16_to_gamma8(row[3 * x]);
+			rrow[3*x + 1] = gp_linear16_to_gamma8(row[3 * x + 1]);
+			rrow[3*x + 2] = gp_linear16_to_gamma8(row[3 * x + 2]);
+		}
+	}
+}
+
 static int read_convert_bitmap(gp_pixmap *res, gp_progress_cb *callback,
 		               png_structp png, int passes, double gamma)
 {
@@ -186,23 +208,7 @@ static int read_convert_bitmap(gp_pixmap *res, gp_progress_cb *callback,
 
 	for (y = 0; y < res->h; y++) {
 		png_read_row(png, (void*)row, NULL);
-		uint8_t *rrow = GP_PIXEL_ADDR(res, 0, y);
-		unsigned int x = 0;
-
-
-		if (gamma > 0.1) {
-			for (x = 0; x < res->w; x++) {
-				rrow[3*x] = row[3 * x]>>8;
-				rrow[3*x + 1] = row[3 * x + 1]>>8;
-				rrow[3*x + 2] = row[3 * x + 2]>>8;
-			}
-		} else {
-			for (x = 0; x < res->w; x++) {
-				rrow[3*x] = gp_linear16_to_gamma8(row[3 * x]);
-				rrow[3*x + 1] = gp_linear16_to_gamma8(row[3 * x + 1]);
-				rrow[3*x + 2] = gp_linear16_to_gamma8(row[3 * x + 2]);
-			}
-		}
+		convert_row(GP_PIXEL_ADDR(res, 0, y), row, res->w, gamma);
 
 		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
 			GP_DEBUG(1, "Operation aborted");
@@ -215,66 +221,32 @@ static int read_convert_bitmap(gp_pixmap *res, gp_progress_cb *callback,
 	return 0;
 }
 
-int gp_read_png_ex(gp_io *io, gp_pixmap **img,
-                 gp_storage *storage, gp_progress_cb *callback)
+/*
+ * Sets up the libpng transformations after png_read_info() and returns the
+ * pixel type the rows are decoded into.
+ */
+static gp_pixel_type png_setup(png_structp png, png_infop png_info,
+                               png_uint_32 *w, png_uint_32 *h, int *passes,
+                               double *gamma, int *convert_16_to_8)
 {
-	png_structp png;
-	png_infop png_info = NULL;
-	png_uint_32 w, h;
-	int depth, color_type, interlace_type;
 	gp_pixel_type pixel_type = GP_PIXEL_UNKNOWN;
-	gp_pixmap *res = NULL;
-	int err, passes = 1;
-	double gamma;
-	int convert_16_to_8 = 0;
-
-	png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
-
-	if (png == NULL) {
-		GP_DEBUG(1, "Failed to allocate PNG read buffer");
-		err = ENOMEM;
-		goto err1;
-	}
-
-	png_info = png_create_info_struct(png);
-
-	if (png_info == NULL) {
-		GP_DEBUG(1, "Failed to allocate PNG info buffer");
-		err = ENOMEM;
-		goto err2;
-	}
-
-	if (setjmp(png_jmpbuf(png))) {
-		GP_DEBUG(1, "Failed to read PNG file :(");
-		//TODO: should we get better error description from libpng?
-		err = EIO;
-		goto err2;
-	}
-
-	png_set_read_fn(png, io, read_data);
-	png_set_sig_bytes(png, 0);
-	png_read_info(png, png_info);
-
-	if (storage)
-		load_meta_data(png, png_info,  storage);
-
-	if (!img)
-		goto exit;
+	int depth, color_type, interlace_type;
 
-	png_get_IHDR(png, png_info, &w, &h, &depth,
+	png_get_IHDR(png, png_info, w, h, &depth,
 	             &color_type, &interlace_type, NULL, NULL);
 
-	png_get_gAMA(png, png_info, &gamma);
+	*gamma = 0;
+	png_get_gAMA(png, png_info, gamma);
 
 	GP_DEBUG(2, "Interlace=%s%s %s PNG%s size %ux%u depth %i gamma %.2lf",
 	         interlace_type_name(interlace_type),
 	         color_type & PNG_COLOR_MASK_PALETTE ? " pallete" : "",
 	         color_type & PNG_COLOR_MASK_COLOR ? "color" : "gray",
 		 color_type & PNG_COLOR_MASK_ALPHA ? " with alpha channel" : "",
-		 (unsigned int)w, (unsigned int)h, depth, gamma);
+		 (unsigned int)*w, (unsigned int)*h, depth, *gamma);
 
 	if (interlace_type == PNG_INTERLACE_ADAM7)
-		passes = png_set_interlace_handling(png);
+		*passes = png_set_interlace_handling(png);
 
 	switch (color_type) {
 	case PNG_COLOR_TYPE_GRAY:
@@ -315,7 +287,7 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 		break;
 		case 16:
 			pixel_type = GP_PIXEL_RGB888;
-			convert_16_to_8 = 1;
+			*convert_16_to_8 = 1;
 		break;
 		}
 	break;
@@ -348,7 +320,7 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 
 		png_read_update_info(png, png_info);
 
-		png_get_IHDR(png, png_info, &w, &h, &depth,
+		png_get_IHDR(png, png_info, w, h, &depth,
 		             &color_type, NULL, NULL, NULL);
 
 		if (color_type & PNG_COLOR_MASK_ALPHA) {
@@ -360,6 +332,71 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 	break;
 	}
 
+	if (color_type == PNG_COLOR_TYPE_GRAY && depth < 8)
+		png_set_packswap(png);
+
+#if __BYTE_ORDER == __LITTLE_ENDIAN
+	/*
+	 * PNG stores 16 bit values in big endian, turn
+	 * on conversion to little endian if needed.
+	 */
+	if (depth > 8) {
+		GP_DEBUG(1, "Enabling byte swap for bpp = %u", depth);
+		png_set_swap(png);
+	}
+#endif
+
+	return pixel_type;
+}
+
+int gp_read_png_ex(gp_io *io, gp_pixmap **img,
+                 gp_storage *storage, gp_progress_cb *callback)
+{
+	png_structp png;
+	png_infop png_info = NULL;
+	png_uint_32 w, h;
+	gp_pixel_type pixel_type;
+	gp_pixmap *res = NULL;
+	int err, passes = 1;
+	double gamma;
+	int convert_16_to_8 = 0;
+
+	png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+
+	if (png == NULL) {
+		GP_DEBUG(1, "Failed to allocate PNG read buffer");
+		err = ENOMEM;
+		goto err1;
+	}
+
+	png_info = png_create_info_struct(png);
+
+	if (png_info == NULL) {
+		GP_DEBUG(1, "Failed to allocate PNG info buffer");
+		err = ENOMEM;
+		goto err2;
+	}
+
+	if (setjmp(png_jmpbuf(png))) {
+		GP_DEBUG(1, "Failed to read PNG file :(");
+		//TODO: should we get better error description from libpng?
+		err = EIO;
+		goto err2;
+	}
+
+	png_set_read_fn(png, io, read_data);
+	png_set_sig_bytes(png, 0);
+	png_read_info(png, png_info);
+
+	if (storage)
+		load_meta_data(png, png_info,  storage);
+
+	if (!img)
+		goto exit;
+
+	pixel_type = png_setup(png, png_info, &w, &h, &passes, &gamma,
+	                      &convert_16_to_8);
+
 	if (pixel_type == GP_PIXEL_UNKNOWN) {
 		GP_DEBUG(1, "Unimplemented png format");
 		err = ENOSYS;
@@ -376,19 +413,6 @@ int gp_read_png_ex(gp_io *io, gp_pixmap **img,
 	if (gamma > 0.1)
 		gp_pixmap_set_gamma(res, 1 / gamma);
 
-	if (color_type == PNG_COLOR_TYPE_GRAY && depth < 8)
-		png_set_packswap(png);
-
-#if __BYTE_ORDER == __LITTLE_ENDIAN
-	/*
-	 * PNG stores 16 bit values in big endian, turn
-	 * on conversion to little endian if needed.
-	 */
-	if (depth > 8) {
-		GP_DEBUG(1, "Enabling byte swap for bpp = %u", depth);
-		png_set_swap(png);
-	}
-#endif
 	if (convert_16_to_8) {
 		if ((err = read_convert_bitmap(res, callback, png, passes, gamma)))
 			goto err3;
@@ -415,6 +439,143 @@ err1:
 	return 1;
 }
 
+struct png_rows {
+	png_structp png;
+	png_infop png_info;
+	double gamma;
+	int convert_16_to_8;
+	uint16_t *row;
+};
+
+static int read_png_rows(gp_row_reader *self, gp_pixmap *rows)
+{
+	struct png_rows *priv = GP_ROW_READER_PRIV(self);
+	uint32_t y;
+
+	if (setjmp(png_jmpbuf(priv->png))) {
+		GP_DEBUG(1, "Failed to read PNG rows");
+		return EIO;
+	}
+
+	for (y = 0; y < rows->h; y++) {
+		uint8_t *addr = GP_PIXEL_ADDR(rows, 0, y);
+
+		if (priv->convert_16_to_8) {
+			png_read_row(priv->png, (void*)priv->row, NULL);
+			convert_row(addr, priv->row, rows->w, priv->gamma);
+		} else {
+			png_read_row(priv->png, addr, NULL);
+		}
+	}
+
+	return 0;
+}
+
+static void close_png_rows(gp_row_reader *self)
+{
+	struct png_rows *priv = GP_ROW_READER_PRIV(self);
+
+	png_destroy_read_struct(&priv->png, &priv->png_info, NULL);
+	free(priv->row);
+}
+
+/*
+ * Reads the header, kept separate from open_png_rows() so that there are no
+ * local variables modified after the setjmp().
+ */
+static int start_png_rows(struct png_rows *priv, gp_io *io,
+                          png_uint_32 *w, png_uint_32 *h,
+                          gp_pixel_type *pixel_type)
+{
+	int passes = 1;
+
+	if (setjmp(png_jmpbuf(priv->png))) {
+		GP_DEBUG(1, "Failed to read PNG header");
+		return EIO;
+	}
+
+	png_set_read_fn(priv->png, io, read_data);
+	png_set_sig_bytes(priv->png, 0);
+	png_read_info(priv->png, priv->png_info);
+
+	*pixel_type = png_setup(priv->png, priv->png_info, w, h, &passes,
+	                        &priv->gamma, &priv->convert_16_to_8);
+
+	if (*pixel_type == GP_PIXEL_UNKNOWN) {
+		GP_DEBUG(1, "Unimplemented png format");
+		return ENOSYS;
+	}
+
+	/* The whole image is needed for adam7 interlacing */
+	if (passes > 1) {
+		GP_DEBUG(1, "Interlaced PNG cannot be decoded row by row");
+		return ENOSYS;
+	}
+
+	return 0;
+}
+
+static gp_row_reader *open_png_rows(gp_io *io)
+{
+	gp_row_reader *self;
+	struct png_rows *priv;
+	gp_pixel_type pixel_type;
+	png_uint_32 w, h;
+	int err;
+
+	self = malloc(sizeof(*self) + sizeof(*priv));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	priv = GP_ROW_READER_PRIV(self);
+	priv->png_info = NULL;
+	priv->row = NULL;
+	priv->convert_16_to_8 = 0;
+
+	priv->png = png_create_read_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	if (!priv->png) {
+		GP_DEBUG(1, "Failed to allocate PNG read buffer");
+		err = ENOMEM;
+		goto err0;
+	}
+
+	priv->png_info = png_create_info_struct(priv->png);
+	if (!priv->png_info) {
+		GP_DEBUG(1, "Failed to allocate PNG info buffer");
+		err = ENOMEM;
+		goto err1;
+	}
+
+	err = start_png_rows(priv, io, &w, &h, &pixel_type);
+	if (err)
+		goto err1;
+
+	if (priv->convert_16_to_8) {
+		priv->row = malloc(6 * w);
+		if (!priv->row) {
+			err = ENOMEM;
+			goto err1;
+		}
+	}
+
+	self->read = read_png_rows;
+	self->close = close_png_rows;
+	self->w = w;
+	self->h = h;
+	self->pixel_type = pixel_type;
+
+	return self;
+err1:
+	png_destroy_read_struct(&priv->png,
+	                        priv->png_info ? &priv->png_info : NULL, NULL);
+err0:
+	free(self);
+	errno = err;
+	return NULL;
+}
+
 static gp_pixel_type save_ptypes[] = {
 	GP_PIXEL_BGR888,
 	GP_PIXEL_RGB888,
@@ -659,6 +820,111 @@ err:
 	return 1;
 }
 
+struct png_row_writer {
+	png_structp png;
+	png_infop png_info;
+};
+
+static int write_png_rows(gp_row_writer *self, const gp_pixmap *rows)
+{
+	struct png_row_writer *priv = GP_ROW_WRITER_PRIV(self);
+	uint32_t y;
+
+	if (setjmp(png_jmpbuf(priv->png))) {
+		GP_DEBUG(1, "Failed to write PNG rows");
+		return EIO;
+	}
+
+	for (y = 0; y < rows->h; y++)
+		png_write_row(priv->png, GP_PIXEL_ADDR(rows, 0, y));
+
+	return 0;
+}
+
+static int finish_png_rows(gp_row_writer *self)
+{
+	struct png_row_writer *priv = GP_ROW_WRITER_PRIV(self);
+
+	if (setjmp(png_jmpbuf(priv->png))) {
+		GP_DEBUG(1, "Failed to finish PNG file");
+		png_destroy_write_struct(&priv->png, &priv->png_info);
+		return EIO;
+	}
+
+	if (self->row == self->h)
+		png_write_end(priv->png, priv->png_info);
+
+	png_destroy_write_struct(&priv->png, &priv->png_info);
+
+	return 0;
+}
+
+static gp_row_writer *create_png_rows(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	struct png_row_writer *priv;
+	gp_row_writer *self;
+	int err, bit_endian_flag = 0;
+
+	if (prepare_png_header(pixel_type, 0, 0, 0, NULL, NULL, NULL)) {
+		GP_DEBUG(1, "Can't save png with %s pixel type",
+		         gp_pixel_type_name(pixel_type));
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	priv = GP_ROW_WRITER_PRIV(self);
+	priv->png_info = NULL;
+
+	priv->png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	if (!priv->png) {
+		GP_DEBUG(1, "Failed to allocate PNG write buffer");
+		err = ENOMEM;
+		goto err0;
+	}
+
+	priv->png_info = png_create_info_struct(priv->png);
+	if (!priv->png_info) {
+		GP_DEBUG(1, "Failed to allocate PNG info buffer");
+		err = ENOMEM;
+		goto err1;
+	}
+
+	if (setjmp(png_jmpbuf(priv->png))) {
+		GP_DEBUG(1, "Failed to write PNG header");
+		err = EIO;
+		goto err1;
+	}
+
+	png_set_write_fn(priv->png, io, write_data, flush_data);
+
+	/* Rows are expected in the default bit order for the pixel type */
+	prepare_png_header(pixel_type, w, h,
+	                   gp_pixel_types[pixel_type].bit_endian,
+	                   priv->png, priv->png_info, &bit_endian_flag);
+
+	if (bit_endian_flag)
+		png_set_packswap(priv->png);
+
+	self->write = write_png_rows;
+	self->close = finish_png_rows;
+
+	return self;
+err1:
+	png_destroy_write_struct(&priv->png,
+	                         priv->png_info ? &priv->png_info : NULL);
+err0:
+	free(self);
+	errno = err;
+	return NULL;
+}
+
 #else
 
 int gp_match_png(const void GP_UNUSED(*buf))
@@ -687,7 +953,9 @@ int gp_write_png(const gp_pixmap *src, gp_io GP_UNUSED(*io),
 const gp_loader gp_png = {
 #ifdef HAVE_LIBPNG
 	.read = gp_read_png_ex,
+	.row_reader = open_png_rows,
 	.write = gp_write_png,
+	.row_writer = create_png_rows,
 	.save_ptypes = save_ptypes,
 #endif
 	.match = gp_match_png,
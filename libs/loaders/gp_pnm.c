@@ -36,6 +36,7 @@
 #include <ctype.h>
 
 #include <string.h>
+#include <stdlib.h>
 
 #include <core/gp_debug.h>
 #include "core/gp_pixmap.h"
@@ -43,6 +44,9 @@
 
 #include <loaders/gp_line_convert.h>
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_rows.h>
+
+#include "gp_raw_map.h"
 
 struct pnm_header {
 	char magic;
@@ -1133,6 +1137,255 @@ int gp_read_pnm_ex(gp_io *io, gp_pixmap **img, gp_storage *storage,
 	return ret;
 }
 
+int gp_pnm_raw_map(gp_io *io, struct gp_raw_map *map)
+{
+	struct pnm_header header;
+	DECLARE_BUFFER(buf, io);
+	unsigned int bpp;
+	int err;
+
+	err = load_header(&buf, &header);
+	if (err) {
+		errno = err;
+		return 1;
+	}
+
+	switch (header.magic) {
+	case '5':
+		map->pixel_type = GP_PIXEL_G8;
+		bpp = 1;
+	break;
+	/* Raw PPM is stored as R G B bytes */
+	case '6':
+		map->pixel_type = GP_PIXEL_BGR888;
+		bpp = 3;
+	break;
+	default:
+		GP_DEBUG(1, "Cannot map P%c", header.magic);
+		errno = ENOSYS;
+		return 1;
+	}
+
+	if (header.depth != 255) {
+		GP_DEBUG(1, "Cannot map depth %"PRIu32, header.depth);
+		errno = ENOSYS;
+		return 1;
+	}
+
+	if (!header.w || !header.h || header.w > UINT32_MAX / bpp) {
+		GP_DEBUG(1, "Invalid size %"PRIu32"x%"PRIu32,
+		         header.w, header.h);
+		errno = EINVAL;
+		return 1;
+	}
+
+	map->w = header.w;
+	map->h = header.h;
+	map->bytes_per_row = header.w * bpp;
+	map->bottom_up = 0;
+	/* Pixels start right after the header, part of it may be buffered */
+	map->offset = gp_io_tell(io) - (buf.buf_end - buf.buf_pos);
+
+	return 0;
+}
+
+struct pnm_rows {
+	struct buf buf;
+	struct pnm_header header;
+};
+
+static int pnm_read_rows(gp_row_reader *self, gp_pixmap *rows)
+{
+	struct pnm_rows *priv = GP_ROW_READER_PRIV(self);
+	struct pnm_header *header = &priv->header;
+	struct buf *buf = &priv->buf;
+
+	switch (header->magic) {
+	case '1':
+		return load_ascii_g1_inv(buf, rows, NULL);
+	case '4':
+		return load_raw_g1_inv(buf, rows, NULL);
+	case '2':
+		return load_ascii_graymap(buf, header, rows, NULL);
+	case '5':
+		return load_bin_graymap(buf, header, rows, NULL);
+	case '3':
+		return load_ascii_rgb888(buf, rows, NULL);
+	case '6':
+		return load_bin_rgb888(buf, rows, NULL);
+	}
+
+	return ENOSYS;
+}
+
+static void pnm_close_rows(gp_row_reader GP_UNUSED(*self))
+{
+}
+
+static gp_row_reader *pnm_row_reader(gp_io *io)
+{
+	gp_pixel_type pixel_type = GP_PIXEL_UNKNOWN;
+	struct pnm_header header;
+	DECLARE_BUFFER(buf, io);
+	struct pnm_rows *priv;
+	gp_row_reader *self;
+	int err;
+
+	err = load_header(&buf, &header);
+	if (err) {
+		errno = err;
+		return NULL;
+	}
+
+	switch (header.magic) {
+	case '1':
+	case '4':
+		pixel_type = GP_PIXEL_G1;
+	break;
+	case '2':
+		pixel_type = depth_to_pixel(header.depth);
+	break;
+	case '5':
+		if (header.depth == 255)
+			pixel_type = GP_PIXEL_G8;
+	break;
+	case '3':
+	case '6':
+		if (header.depth == 255)
+			pixel_type = GP_PIXEL_RGB888;
+	break;
+	}
+
+	if (pixel_type == GP_PIXEL_UNKNOWN) {
+		GP_DEBUG(1, "Unsupported P%c depth %"PRIu32,
+		         header.magic, header.depth);
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv));
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	priv = GP_ROW_READER_PRIV(self);
+	priv->buf = buf;
+	priv->header = header;
+
+	self->read = pnm_read_rows;
+	self->close = pnm_close_rows;
+	self->w = header.w;
+	self->h = header.h;
+	self->pixel_type = pixel_type;
+
+	return self;
+}
+
+struct pnm_row_writer {
+	int swap;
+	uint8_t row[];
+};
+
+static int pnm_write_rows(gp_row_writer *self, const gp_pixmap *rows)
+{
+	struct pnm_row_writer *priv = GP_ROW_WRITER_PRIV(self);
+	size_t size = (size_t)rows->w * (rows->bpp / 8);
+	gp_size x, y;
+
+	for (y = 0; y < rows->h; y++) {
+		uint8_t *addr = GP_PIXEL_ADDR(rows, 0, y);
+
+		/* Raw PPM is stored as R G B bytes */
+		if (priv->swap) {
+			for (x = 0; x < rows->w; x++) {
+				priv->row[3*x] = addr[3*x + 2];
+				priv->row[3*x + 1] = addr[3*x + 1];
+				priv->row[3*x + 2] = addr[3*x];
+			}
+			addr = priv->row;
+		}
+
+		if (gp_io_flush(self->io, addr, size))
+			return errno;
+	}
+
+	return 0;
+}
+
+static int pnm_close_writer(gp_row_writer GP_UNUSED(*self))
+{
+	return 0;
+}
+
+static gp_row_writer *pnm_row_writer(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	struct pnm_row_writer *priv;
+	gp_row_writer *self;
+	size_t row_size = 0;
+	char magic;
+
+	switch (pixel_type) {
+	case GP_PIXEL_G8:
+		magic = '5';
+	break;
+	case GP_PIXEL_RGB888:
+		row_size = 3 * (size_t)w;
+		/* fallthrough */
+	case GP_PIXEL_BGR888:
+		magic = '6';
+	break;
+	default:
+		GP_DEBUG(1, "Unsupported pixel type %s",
+		         gp_pixel_type_name(pixel_type));
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv) + row_size);
+	if (!self) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	if (gp_io_printf(io, "P%c\n%u %u\n255\n", magic,
+	                 (unsigned int) w, (unsigned int) h)) {
+		free(self);
+		return NULL;
+	}
+
+	priv = GP_ROW_WRITER_PRIV(self);
+	priv->swap = !!row_size;
+
+	self->write = pnm_write_rows;
+	self->close = pnm_close_writer;
+
+	return self;
+}
+
+static gp_row_writer *pgm_row_writer(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	if (pixel_type != GP_PIXEL_G8) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	return pnm_row_writer(io, w, h, pixel_type);
+}
+
+static gp_row_writer *ppm_row_writer(gp_io *io, gp_size w, gp_size h,
+                                     gp_pixel_type pixel_type)
+{
+	if (pixel_type == GP_PIXEL_G8) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	return pnm_row_writer(io, w, h, pixel_type);
+}
+
 static gp_pixel_type pnm_save_pixels[] = {
 	GP_PIXEL_G1,
 	GP_PIXEL_G2,
@@ -1164,6 +1417,7 @@ int gp_write_pnm(const gp_pixmap *src, gp_io *io,
 
 const gp_loader gp_pbm = {
 	.read = gp_read_pbm_ex,
+	.row_reader = pnm_row_reader,
 	.write = gp_write_pbm,
 	.save_ptypes = pbm_save_pixels,
 	.match = gp_match_pbm,
@@ -1174,7 +1428,9 @@ const gp_loader gp_pbm = {
 
 const gp_loader gp_pgm = {
 	.read = gp_read_pgm_ex,
+	.row_reader = pnm_row_reader,
 	.write = gp_write_pgm,
+	.row_writer = pgm_row_writer,
 	.save_ptypes = pgm_save_pixels,
 	.match = gp_match_pgm,
 
@@ -1184,7 +1440,9 @@ const gp_loader gp_pgm = {
 
 const gp_loader gp_ppm = {
 	.read = gp_read_ppm_ex,
+	.row_reader = pnm_row_reader,
 	.write = gp_write_ppm,
+	.row_writer = ppm_row_writer,
 	.save_ptypes = ppm_save_pixels,
 	.match = gp_match_ppm,
 
@@ -1194,7 +1452,9 @@ const gp_loader gp_ppm = {
 
 const gp_loader gp_pnm = {
 	.read = gp_read_pnm_ex,
+	.row_reader = pnm_row_reader,
 	.write = gp_write_pnm,
+	.row_writer = pnm_row_writer,
 	.save_ptypes = pnm_save_pixels,
 	/*
 	 * Avoid double Match
@@ -535,6 +535,7 @@ static gp_io *rle(gp_io *io)
 	rle->write = NULL;
 	rle->seek = NULL;
 	rle->close = rle_close;
+	rle->map = NULL;
 
 	return rle;
 }
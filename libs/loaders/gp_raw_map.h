@@ -0,0 +1,47 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Layout of uncompressed image data in a file, used to map the pixels
+  directly from the file into a pixmap.
+
+  Library internal, the functions are not exported.
+
+ */
+
+#ifndef LOADERS_GP_RAW_MAP_H
+#define LOADERS_GP_RAW_MAP_H
+
+#include <sys/types.h>
+
+#include <core/gp_types.h>
+#include <loaders/gp_io.h>
+
+struct gp_raw_map {
+	gp_pixel_type pixel_type;
+	gp_size w;
+	gp_size h;
+	/* Offset to the first row in the file */
+	off_t offset;
+	/* Distance between rows in the file */
+	uint32_t bytes_per_row;
+	/* The rows are stored from the bottom one */
+	int bottom_up;
+};
+
+/*
+ * Parse the image header and fill in the pixel data layout.
+ *
+ * Returns zero on success, non-zero and sets errno on a failure, ENOSYS if
+ * the pixel data cannot be used as they are.
+ */
+int gp_pnm_raw_map(gp_io *io, struct gp_raw_map *map)
+	__attribute__ ((visibility ("hidden")));
+
+int gp_bmp_raw_map(gp_io *io, struct gp_raw_map *map)
+	__attribute__ ((visibility ("hidden")));
+
+#endif /* LOADERS_GP_RAW_MAP_H */
@@ -0,0 +1,341 @@
+// SPDX-License-Identifier: LGPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Streaming row by row decoding and encoding, the format specific parts are
+  implemented in the loaders.
+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <core/gp_debug.h>
+#include <core/gp_pixmap.h>
+
+#include <loaders/gp_loader.h>
+#include <loaders/gp_rows.h>
+
+static gp_row_reader *reader_init(gp_io *io)
+{
+	const gp_loader *loader;
+	gp_row_reader *self;
+	char buf[32];
+	off_t start;
+
+	start = gp_io_tell(io);
+	if (start == (off_t)-1)
+		return NULL;
+
+	if (gp_io_fill(io, buf, sizeof(buf))) {
+		GP_DEBUG(1, "Failed to read first 32 bytes: %s",
+		         strerror(errno));
+		return NULL;
+	}
+
+	if (gp_io_seek(io, start, GP_SEEK_SET) != start)
+		return NULL;
+
+	loader = gp_loader_by_signature(buf);
+	if (!loader) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	if (!loader->row_reader) {
+		GP_DEBUG(1, "Loader for '%s' cannot decode rows",
+		         loader->fmt_name);
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = loader->row_reader(io);
+	if (!self)
+		return NULL;
+
+	GP_DEBUG(1, "Decoding %s %ux%u %s rows", loader->fmt_name,
+	         self->w, self->h, gp_pixel_type_name(self->pixel_type));
+
+	self->io = io;
+	self->close_io = 0;
+	self->row = 0;
+
+	return self;
+}
+
+gp_row_reader *gp_row_reader_io(gp_io *io)
+{
+	return reader_init(io);
+}
+
+gp_row_reader *gp_row_reader_open(const char *path)
+{
+	gp_row_reader *self;
+	gp_io *io;
+	int err;
+
+	/* Bottom-up BMP is read backwards, avoid refilling a read buffer */
+	io = gp_io_mmap(path);
+	if (!io)
+		io = gp_io_file(path, GP_IO_RDONLY);
+
+	if (!io)
+		return NULL;
+
+	self = reader_init(io);
+	if (!self) {
+		err = errno;
+		gp_io_close(io);
+		errno = err;
+		return NULL;
+	}
+
+	self->close_io = 1;
+
+	return self;
+}
+
+int gp_row_reader_read(gp_row_reader *self, gp_pixmap *rows)
+{
+	gp_pixmap view;
+	int err;
+
+	if (rows->w != self->w || rows->pixel_type != self->pixel_type) {
+		GP_WARN("Invalid rows %ux%u %s expected width %u %s",
+		        rows->w, rows->h, gp_pixel_type_name(rows->pixel_type),
+		        self->w, gp_pixel_type_name(self->pixel_type));
+		errno = EINVAL;
+		return -1;
+	}
+
+	view = *rows;
+	view.h = GP_MIN(rows->h, self->h - self->row);
+
+	if (!view.h)
+		return 0;
+
+	err = self->read(self, &view);
+	if (err) {
+		errno = err;
+		return -1;
+	}
+
+	self->row += view.h;
+
+	return view.h;
+}
+
+void gp_row_reader_close(gp_row_reader *self)
+{
+	if (!self)
+		return;
+
+	self->close(self);
+
+	if (self->close_io)
+		gp_io_close(self->io);
+
+	free(self);
+}
+
+static gp_row_writer *writer_init(const gp_loader *loader, gp_io *io,
+                                  gp_size w, gp_size h,
+                                  gp_pixel_type pixel_type)
+{
+	gp_pixel_type out_pix = pixel_type;
+	gp_row_writer *self;
+	gp_pixmap *conv = NULL;
+
+	if (!loader->row_writer) {
+		GP_DEBUG(1, "Loader for '%s' cannot encode rows",
+		         loader->fmt_name);
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	self = loader->row_writer(io, w, h, pixel_type);
+
+	if (!self && errno == ENOSYS && loader->save_ptypes) {
+		out_pix = gp_line_convertible(pixel_type,
+		                              (gp_pixel_type*)loader->save_ptypes);
+
+		if (out_pix == GP_PIXEL_UNKNOWN || out_pix == pixel_type) {
+			errno = ENOSYS;
+			return NULL;
+		}
+
+		conv = gp_pixmap_alloc(w, 1, out_pix);
+		if (!conv)
+			return NULL;
+
+		self = loader->row_writer(io, w, h, out_pix);
+	}
+
+	if (!self) {
+		gp_pixmap_free(conv);
+		return NULL;
+	}
+
+	GP_DEBUG(1, "Encoding %s %ux%u %s rows%s%s", loader->fmt_name, w, h,
+	         gp_pixel_type_name(pixel_type), conv ? " converted to " : "",
+	         conv ? gp_pixel_type_name(out_pix) : "");
+
+	self->io = io;
+	self->file_io = NULL;
+	self->path = NULL;
+	self->conv = conv;
+	self->convert = conv ? gp_line_convert_get(pixel_type, out_pix) : NULL;
+	self->w = w;
+	self->h = h;
+	self->pixel_type = pixel_type;
+	self->row = 0;
+
+	return self;
+}
+
+gp_row_writer *gp_row_writer_io(const gp_loader *loader, gp_io *io,
+                                gp_size w, gp_size h,
+                                gp_pixel_type pixel_type)
+{
+	return writer_init(loader, io, w, h, pixel_type);
+}
+
+gp_row_writer *gp_row_writer_open(const char *path, gp_size w, gp_size h,
+                                  gp_pixel_type pixel_type)
+{
+	const gp_loader *loader = gp_loader_by_filename(path);
+	gp_row_writer *self;
+	gp_io *io, *bio;
+	char *dup;
+	int err;
+
+	if (!loader) {
+		errno = EINVAL;
+		return NULL;
+	}
+
+	if (!loader->row_writer) {
+		errno = ENOSYS;
+		return NULL;
+	}
+
+	dup = strdup(path);
+	if (!dup) {
+		errno = ENOMEM;
+		return NULL;
+	}
+
+	io = gp_io_file(path, GP_IO_WRONLY);
+	if (!io) {
+		err = errno;
+		goto err0;
+	}
+
+	bio = gp_io_wbuffer(io, 0);
+	if (!bio) {
+		err = errno;
+		goto err1;
+	}
+
+	self = writer_init(loader, bio, w, h, pixel_type);
+	if (!self) {
+		err = errno;
+		goto err2;
+	}
+
+	self->file_io = io;
+	self->path = dup;
+
+	return self;
+err2:
+	gp_io_close(bio);
+err1:
+	gp_io_close(io);
+	unlink(path);
+err0:
+	free(dup);
+	errno = err;
+	return NULL;
+}
+
+int gp_row_writer_write(gp_row_writer *self, const gp_pixmap *rows)
+{
+	gp_size y;
+	int err;
+
+	if (rows->w != self->w || rows->pixel_type != self->pixel_type ||
+	    rows->h > self->h - self->row) {
+		GP_WARN("Invalid rows %ux%u %s expected width %u %s",
+		        rows->w, rows->h, gp_pixel_type_name(rows->pixel_type),
+		        self->w, gp_pixel_type_name(self->pixel_type));
+		errno = EINVAL;
+		return 1;
+	}
+
+	if (!self->convert) {
+		err = self->write(self, rows);
+		if (err)
+			goto err;
+
+		self->row += rows->h;
+		return 0;
+	}
+
+	for (y = 0; y < rows->h; y++) {
+		self->convert(GP_PIXEL_ADDR(rows, 0, y), self->conv->pixels,
+		              self->w);
+
+		err = self->write(self, self->conv);
+		if (err)
+			goto err;
+
+		self->row++;
+	}
+
+	return 0;
+err:
+	errno = err;
+	return 1;
+}
+
+int gp_row_writer_close(gp_row_writer *self)
+{
+	int err = 0, ret;
+
+	if (self->row != self->h) {
+		GP_WARN("Only %u rows out of %u were written",
+		        self->row, self->h);
+		err = EINVAL;
+	}
+
+	ret = self->close(self);
+	if (!err)
+		err = ret;
+
+	if (self->file_io) {
+		if (gp_io_close(self->io) && !err)
+			err = errno;
+
+		if (gp_io_close(self->file_io) && !err)
+			err = errno;
+
+		if (err)
+			unlink(self->path);
+	}
+
+	gp_pixmap_free(self->conv);
+	free(self->path);
+	free(self);
+
+	if (err) {
+		errno = err;
+		return 1;
+	}
+
+	return 0;
+}
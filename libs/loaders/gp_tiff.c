@@ -13,6 +13,7 @@
 #include <inttypes.h>
 
 #include <errno.h>
+#include <stdlib.h>
 #include <string.h>
 
 #include "../../config.h"
@@ -22,6 +23,7 @@
 #include <core/gp_debug.h>
 
 #include <loaders/gp_loaders.gen.h>
+#include <loaders/gp_rows.h>
 
 #define TIFF_HEADER_LITTLE "II\x2a\0"
 #define TIFF_HEADER_BIG    "MM\0\x2a"
@@ -341,6 +343,30 @@ static uint16_t get_idx(uint8_t *row, uint32_t x, uint16_t bps)
 	return 0;
 }
 
+static void palette_row(gp_pixmap *res, uint32_t y, uint8_t *buf,
+                        struct tiff_header *header, uint16_t *palette_r,
+                        uint16_t *palette_g, uint16_t *palette_b)
+{
+	unsigned int palette_size = (1<<header->bits_per_sample);
+	uint32_t x;
+
+	for (x = 0; x < header->w; x++) {
+		uint16_t i = get_idx(buf, x, header->bits_per_sample);
+
+		if (i >= palette_size) {
+			GP_WARN("Invalid palette index %u",
+			         (unsigned) i);
+			i = 0;
+		}
+
+		gp_pixel p = GP_PIXEL_CREATE_RGB888(palette_r[i]>>8,
+		                                    palette_g[i]>>8,
+		                                    palette_b[i]>>8);
+
+		gp_putpixel_raw_24BPP(res, x, y, p);
+	}
+}
+
 static int tiff_read_palette(TIFF *tiff, gp_pixmap *res,
                              struct tiff_header *header,
                              gp_progress_cb *callback)
@@ -356,11 +382,10 @@ static int tiff_read_palette(TIFF *tiff, gp_pixmap *res,
 		return EINVAL;
 	}
 
-	unsigned int palette_size = (1<<header->bits_per_sample);
 	uint16_t *palette_r, *palette_g, *palette_b;
-	uint32_t x, y, scanline_size;
+	uint32_t y, scanline_size;
 
-	GP_DEBUG(1, "Pallete size %u", palette_size);
+	GP_DEBUG(1, "Pallete size %u", 1u<<header->bits_per_sample);
 
 	if (!TIFFGetField(tiff, TIFFTAG_COLORMAP, &palette_r, &palette_g, &palette_b)) {
 		GP_DEBUG(1, "Failed to read palette");
@@ -381,21 +406,7 @@ static int tiff_read_palette(TIFF *tiff, gp_pixmap *res,
 			return EIO;
 		}
 
-		for (x = 0; x < header->w; x++) {
-			uint16_t i = get_idx(buf, x, header->bits_per_sample);
-
-			if (i >= palette_size) {
-				GP_WARN("Invalid palette index %u",
-				         (unsigned) i);
-				i = 0;
-			}
-
-			gp_pixel p = GP_PIXEL_CREATE_RGB888(palette_r[i]>>8,
-					                    palette_g[i]>>8,
-			                                    palette_b[i]>>8);
-
-			gp_putpixel_raw_24BPP(res, x, y, p);
-		}
+		palette_row(res, y, buf, header, palette_r, palette_g, palette_b);
 
 		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
 			GP_DEBUG(1, "Operation aborted");
@@ -413,20 +424,9 @@ static int tiff_read_palette(TIFF *tiff, gp_pixmap *res,
 /*
  * Direct read -> data in image are in right format.
  */
-static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
-                     gp_progress_cb *callback)
+static int get_samples(TIFF *tiff, uint16_t *samples)
 {
-	uint32_t i, y;
-	uint16_t planar_config, samples, s;
-
-	GP_DEBUG(1, "Reading tiff data");
-
-	if (TIFFIsTiled(tiff)) {
-		//TODO
-		return ENOSYS;
-	}
-
-	//ASSERT ScanlineSize == w!
+	uint16_t planar_config;
 
 	/* Figure out number of planes */
 	if (!TIFFGetField(tiff, TIFFTAG_PLANARCONFIG, &planar_config))
@@ -435,14 +435,14 @@ static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
 	switch (planar_config) {
 	case 1:
 		GP_DEBUG(1, "Planar config = 1, all samples are in one plane");
-		samples = 1;
+		*samples = 1;
 	break;
 	case 2:
-		if (!TIFFGetField(tiff, TIFFTAG_SAMPLESPERPIXEL, &samples)) {
+		if (!TIFFGetField(tiff, TIFFTAG_SAMPLESPERPIXEL, samples)) {
 			GP_DEBUG(1, "Planar config = 2, samples per pixel undefined");
 			return EINVAL;
 		}
-		GP_DEBUG(1, "Have %u samples per pixel", (unsigned)samples);
+		GP_DEBUG(1, "Have %u samples per pixel", (unsigned)*samples);
 	break;
 	default:
 		GP_DEBUG(1, "Unimplemented planar config = %u",
@@ -450,39 +450,75 @@ static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
 		return EINVAL;
 	}
 
-	/* Read image strips scanline by scanline */
-	for (y = 0; y < header->h; y++) {
-		uint8_t *addr = GP_PIXEL_ADDR(res, 0, y);
-
-		//TODO: Does not work with RowsPerStrip > 1 -> needs StripOrientedIO
-		for (s = 0; s < samples; s++) {
-			if (TIFFReadScanline(tiff, addr, y, s) != 1) {
-				//TODO: Make use of TIFF ERROR
-				GP_DEBUG(1, "Error reading scanline");
-				return EIO;
-			}
+	return 0;
+}
 
-			//Temporary, till bitendians are fixed
-			switch (res->pixel_type) {
-			case GP_PIXEL_G1:
-				gp_bit_swap_row_b1(addr, res->bytes_per_row);
-			break;
-			case GP_PIXEL_G2:
-				gp_bit_swap_row_b2(addr, res->bytes_per_row);
-			break;
-			case GP_PIXEL_G4:
-				gp_bit_swap_row_b4(addr, res->bytes_per_row);
-			break;
-			default:
-			break;
-			}
+/*
+ * Reads all samples of the row into the y-th row of res.
+ */
+static int read_row(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
+                    uint16_t samples, uint32_t y, uint32_t row)
+{
+	uint8_t *addr = GP_PIXEL_ADDR(res, 0, y);
+	uint16_t s;
+	uint32_t i;
 
-			/* We need to negate the values when Min is White */
-			if (header->photometric == PHOTOMETRIC_MINISWHITE)
-				for (i = 0; i < res->bytes_per_row; i++)
-					addr[i] = ~addr[i];
+	//TODO: Does not work with RowsPerStrip > 1 -> needs StripOrientedIO
+	for (s = 0; s < samples; s++) {
+		if (TIFFReadScanline(tiff, addr, row, s) != 1) {
+			//TODO: Make use of TIFF ERROR
+			GP_DEBUG(1, "Error reading scanline");
+			return EIO;
+		}
+
+		//Temporary, till bitendians are fixed
+		switch (res->pixel_type) {
+		case GP_PIXEL_G1:
+			gp_bit_swap_row_b1(addr, res->bytes_per_row);
+		break;
+		case GP_PIXEL_G2:
+			gp_bit_swap_row_b2(addr, res->bytes_per_row);
+		break;
+		case GP_PIXEL_G4:
+			gp_bit_swap_row_b4(addr, res->bytes_per_row);
+		break;
+		default:
+		break;
 		}
 
+		/* We need to negate the values when Min is White */
+		if (header->photometric == PHOTOMETRIC_MINISWHITE)
+			for (i = 0; i < res->bytes_per_row; i++)
+				addr[i] = ~addr[i];
+	}
+
+	return 0;
+}
+
+static int tiff_read(TIFF *tiff, gp_pixmap *res, struct tiff_header *header,
+                     gp_progress_cb *callback)
+{
+	uint16_t samples;
+	uint32_t y;
+	int err;
+
+	GP_DEBUG(1, "Reading tiff data");
+
+	if (TIFFIsTiled(tiff)) {
+		//TODO
+		return ENOSYS;
+	}
+
+	//ASSERT ScanlineSize == w!
+
+	if ((err = get_samples(tiff, &samples)))
+		return err;
+
+	/* Read image strips scanline by scanline */
+	for (y = 0; y < header->h; y++) {
+		if ((err = read_row(tiff, res, header, samples, y, y)))
+			return err;
+
 		if (gp_progress_cb_report(callback, y, res->h, res->w)) {
 			GP_DEBUG(1, "Operation aborted");
 			return ECANCELED;
@@ -599,6 +635,132 @@ err0:
 	return 1;
 }
 
+struct tiff_rows {
+	TIFF *tiff;
+	struct tiff_header header;
+	uint16_t samples;
+	uint16_t *palette_r, *palette_g, *palette_b;
+	uint8_t buf[];
+};
+
+static int tiff_read_rows(gp_row_reader *self, gp_pixmap *rows)
+{
+	struct tiff_rows *priv = GP_ROW_READER_PRIV(self);
+	struct tiff_header *header = &priv->header;
+	uint32_t y;
+	int err;
+
+	for (y = 0; y < rows->h; y++) {
+		uint32_t row = self->row + y;
+
+		if (header->photometric != PHOTOMETRIC_PALETTE) {
+			err = read_row(priv->tiff, rows, header,
+			               priv->samples, y, row);
+			if (err)
+				return err;
+			continue;
+		}
+
+		if (TIFFReadScanline(priv->tiff, priv->buf, row, 0) != 1) {
+			GP_DEBUG(1, "Error reading scanline");
+			return EIO;
+		}
+
+		palette_row(rows, y, priv->buf, header, priv->palette_r,
+		            priv->palette_g, priv->palette_b);
+	}
+
+	return 0;
+}
+
+static void tiff_close_rows(gp_row_reader *self)
+{
+	struct tiff_rows *priv = GP_ROW_READER_PRIV(self);
+
+	TIFFClose(priv->tiff);
+}
+
+static gp_row_reader *tiff_row_reader(gp_io *io)
+{
+	struct tiff_header header;
+	gp_pixel_type pixel_type;
+	struct tiff_rows *priv;
+	gp_row_reader *self;
+	size_t buf_size = 0;
+	TIFF *tiff;
+	int err;
+
+	tiff = TIFFClientOpen("GFXprim IO", "r", io, tiff_io_read,
+	                      tiff_io_write, tiff_io_seek, tiff_io_close,
+	                      tiff_io_size, NULL, NULL);
+
+	if (!tiff) {
+		GP_DEBUG(1, "TIFFClientOpen failed");
+		errno = EIO;
+		return NULL;
+	}
+
+	if ((err = read_header(tiff, &header)))
+		goto err0;
+
+	if (TIFFIsTiled(tiff)) {
+		GP_DEBUG(1, "Tiled TIFF cannot be decoded row by row");
+		err = ENOSYS;
+		goto err0;
+	}
+
+	pixel_type = match_pixel_type(tiff, &header);
+	if (pixel_type == GP_PIXEL_UNKNOWN) {
+		err = ENOSYS;
+		goto err0;
+	}
+
+	if (header.photometric == PHOTOMETRIC_PALETTE) {
+		if (header.bits_per_sample > 16) {
+			err = EINVAL;
+			goto err0;
+		}
+		buf_size = TIFFScanlineSize(tiff);
+	}
+
+	self = malloc(sizeof(*self) + sizeof(*priv) + buf_size);
+	if (!self) {
+		err = ENOMEM;
+		goto err0;
+	}
+
+	priv = GP_ROW_READER_PRIV(self);
+	priv->tiff = tiff;
+	priv->header = header;
+	priv->samples = 1;
+
+	if (header.photometric == PHOTOMETRIC_PALETTE) {
+		if (!TIFFGetField(tiff, TIFFTAG_COLORMAP, &priv->palette_r,
+		                  &priv->palette_g, &priv->palette_b)) {
+			GP_DEBUG(1, "Failed to read palette");
+			err = EIO;
+			goto err1;
+		}
+	} else {
+		if ((err = get_samples(tiff, &priv->samples)))
+			goto err1;
+	}
+
+	self->read = tiff_read_rows;
+	self->close = tiff_close_rows;
+	self->w = header.w;
+	self->h = header.h;
+	self->pixel_type = pixel_type;
+
+	return self;
+err1:
+	free(self);
+err0:
+	TIFFClose(tiff);
+	errno = err;
+	return NULL;
+}
+
 static int save_grayscale(TIFF *tiff, const gp_pixmap *src,
                           gp_progress_cb *callback)
 {
@@ -804,6 +966,7 @@ int gp_write_tiff(const gp_pixmap GP_UNUSED(*src), gp_io GP_UNUSED(*io),
 const struct gp_loader gp_tiff = {
 #ifdef HAVE_TIFF
 	.read = gp_read_tiff_ex,
+	.row_reader = tiff_row_reader,
 	.write = gp_write_tiff,
 	.save_ptypes = save_ptypes,
 #endif
@@ -178,3 +178,65 @@ void *gp_htable_get(gp_htable *self, const char *key)
 
 	return NULL;
 }
+
+/*
+ * Returns non-zero if an element hashed to h and stored at j has to stay
+ * there after the slot i was freed, i.e. h lies cyclically in (i, j].
+ */
+static int in_range(unsigned int h, unsigned int i, unsigned int j)
+{
+	if (i <= j)
+		return i < h && h <= j;
+
+	return i < h || h <= j;
+}
+
+void *gp_htable_rem(gp_htable *self, const char *key)
+{
+	unsigned int h, i;
+	void *val;
+
+	if (!self)
+		return NULL;
+
+	i = hash(key, self->size);
+
+	while (self->elems[i].val) {
+		if (!strcmp(self->elems[i].key, key))
+			break;
+		i = (i + 1) % self->size;
+	}
+
+	val = self->elems[i].val;
+	if (!val)
+		return NULL;
+
+	if (self->flags & GP_HTABLE_COPY_KEY ||
+	    self->flags & GP_HTABLE_FREE_KEY)
+		free(self->elems[i].key);
+
+	/*
+	 * Move the rest of the cluster back so that the linear probing in
+	 * gp_htable_get() does not stop at the freed slot.
+	 */
+	h = i;
+
+	for (;;) {
+		h = (h + 1) % self->size;
+
+		if (!self->elems[h].val)
+			break;
+
+		if (in_range(hash(self->elems[h].key, self->size), i, h))
+			continue;
+
+		self->elems[i] = self->elems[h];
+		i = h;
+	}
+
+	self->elems[i].val = NULL;
+	self->elems[i].key = NULL;
+	self->used--;
+
+	return val;
+}
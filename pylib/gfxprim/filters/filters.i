@@ -96,6 +96,12 @@ FILTER_FUNC(resize_cubic);
 FILTER_FUNC(resize_cubic_int);
 %include "gp_resize_cubic.h"
 
+FILTER_FUNC(resize_lanczos_int);
+%include "gp_resize_lanczos.h"
+
+FILTER_FUNC(resize_area_int);
+%include "gp_resize_area.h"
+
 /* Ditherings */
 FILTER_FUNC(floyd_steinberg);
 FILTER_FUNC(hilbert_peano);
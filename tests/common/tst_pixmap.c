@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_get_put_pixel.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+void tst_pixmap_fill_rand(gp_pixmap *p)
+{
+	gp_size i;
+
+	for (i = 0; i < p->bytes_per_row * p->h; i++)
+		p->pixels[i] = random();
+}
+
+void tst_pixmap_fill_rand_range(gp_pixmap *p, uint8_t min, unsigned int range)
+{
+	gp_size i;
+
+	for (i = 0; i < p->bytes_per_row * p->h; i++)
+		p->pixels[i] = min + random() % range;
+}
+
+int tst_pixmap_cmp(const gp_pixmap *ref, const gp_pixmap *res)
+{
+	gp_size x, y;
+
+	if (ref->w != res->w || ref->h != res->h ||
+	    ref->pixel_type != res->pixel_type) {
+		tst_msg("Pixmap %ux%u %s expected %ux%u %s",
+		        res->w, res->h, gp_pixel_type_name(res->pixel_type),
+		        ref->w, ref->h, gp_pixel_type_name(ref->pixel_type));
+		return 1;
+	}
+
+	for (y = 0; y < ref->h; y++) {
+		for (x = 0; x < ref->w; x++) {
+			gp_pixel pr = gp_getpixel_raw(ref, x, y);
+			gp_pixel ps = gp_getpixel_raw(res, x, y);
+
+			if (pr != ps) {
+				tst_msg("Pixel %ux%u %08x expected %08x",
+				        x, y, ps, pr);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
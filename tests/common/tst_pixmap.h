@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+ /*
+
+   Pixmap helpers shared between the tests.
+
+  */
+
+#ifndef TST_PIXMAP_H
+#define TST_PIXMAP_H
+
+#include <core/gp_pixmap.h>
+
+/*
+ * Fills the pixmap buffer, including the padding, with random bytes.
+ */
+void tst_pixmap_fill_rand(gp_pixmap *p);
+
+/*
+ * Fills the pixmap buffer with random bytes in [min, min + range).
+ */
+void tst_pixmap_fill_rand_range(gp_pixmap *p, uint8_t min, unsigned int range);
+
+/*
+ * Compares the pixmap sizes, pixel types and raw pixel values.
+ *
+ * Returns zero if the pixmaps are equal, prints the first difference and
+ * returns non-zero otherwise.
+ */
+int tst_pixmap_cmp(const gp_pixmap *ref, const gp_pixmap *res);
+
+#endif /* TST_PIXMAP_H */
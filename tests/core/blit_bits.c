@@ -0,0 +1,163 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Blit tests for 1, 2 and 4 bpp pixmaps with arbitrary bit alignment.
+
+  The blits are done between subpixmaps, which may start in the middle of a
+  byte, and the result is compared against a pixel by pixel copy.
+
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct blit_bits {
+	gp_pixel_type pixel_type;
+	int bit_endian;
+};
+
+static gp_pixmap *alloc_rand(gp_size w, gp_size h, struct blit_bits *params)
+{
+	gp_pixmap *p = gp_pixmap_alloc(w, h, params->pixel_type);
+
+	if (!p)
+		return NULL;
+
+	p->bit_endian = params->bit_endian;
+	tst_pixmap_fill_rand(p);
+
+	return p;
+}
+
+#define W 157
+#define H 4
+
+static int blit_bits(struct blit_bits *params)
+{
+	gp_pixmap *src, *dst, *ref;
+	gp_pixmap sub_src, sub_dst, sub_ref;
+	gp_coord sx, dx, x, y;
+	gp_size w;
+	int ret = TST_SUCCESS;
+
+	src = alloc_rand(W, H, params);
+	dst = alloc_rand(W, H, params);
+	ref = gp_pixmap_copy(dst, GP_COPY_WITH_PIXELS);
+
+	if (!src || !dst || !ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	for (sx = 0; sx < 9; sx++) {
+		for (dx = 0; dx < 9; dx++) {
+			for (w = 1; w < W - 9; w += 7) {
+				gp_sub_pixmap(src, &sub_src, sx, 1, w, 2);
+				gp_sub_pixmap(dst, &sub_dst, dx, 1, w, 2);
+				gp_sub_pixmap(ref, &sub_ref, dx, 1, w, 2);
+
+				gp_blit_xywh_raw(&sub_src, 0, 0, w, 2, &sub_dst, 0, 0);
+
+				for (y = 0; y < 2; y++) {
+					for (x = 0; x < (gp_coord)w; x++) {
+						gp_putpixel_raw(&sub_ref, x, y,
+							gp_getpixel_raw(&sub_src, x, y));
+					}
+				}
+
+				if (tst_pixmap_cmp(ref, dst)) {
+					tst_msg("sx=%i dx=%i w=%u", sx, dx, w);
+					ret = TST_FAILED;
+					goto end;
+				}
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+static int sub_pixmap_nested(struct blit_bits *params)
+{
+	gp_pixmap *p = alloc_rand(W, H, params);
+	gp_pixmap sub, sub2;
+	gp_coord x, y, x0, x1;
+	int ret = TST_SUCCESS;
+
+	if (!p) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	for (x0 = 0; x0 < 9; x0++) {
+		for (x1 = 0; x1 < 9; x1++) {
+			gp_sub_pixmap(p, &sub, x0, 1, W - x0, H - 1);
+			gp_sub_pixmap(&sub, &sub2, x1, 1, W - x0 - x1, H - 2);
+
+			for (y = 0; y < H - 2; y++) {
+				for (x = 0; x < W - x0 - x1; x++) {
+					gp_pixel p1 = gp_getpixel_raw(&sub2, x, y);
+					gp_pixel p2 = gp_getpixel_raw(p, x + x0 + x1, y + 2);
+
+					if (p1 != p2) {
+						tst_msg("Pixels differ at %ix%i x0=%i x1=%i",
+						        x, y, x0, x1);
+						ret = TST_FAILED;
+						goto end;
+					}
+				}
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(p);
+	return ret;
+}
+
+static struct blit_bits G1_LE = {GP_PIXEL_G1, GP_BIT_ENDIAN_LE};
+static struct blit_bits G2_LE = {GP_PIXEL_G2, GP_BIT_ENDIAN_LE};
+static struct blit_bits G4_LE = {GP_PIXEL_G4, GP_BIT_ENDIAN_LE};
+static struct blit_bits G1_BE = {GP_PIXEL_G1, GP_BIT_ENDIAN_BE};
+static struct blit_bits G2_BE = {GP_PIXEL_G2, GP_BIT_ENDIAN_BE};
+static struct blit_bits G4_BE = {GP_PIXEL_G4, GP_BIT_ENDIAN_BE};
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit bits testsuite",
+	.tests = {
+		{.name = "Blit G1 LE", .tst_fn = blit_bits, .data = &G1_LE},
+		{.name = "Blit G2 LE", .tst_fn = blit_bits, .data = &G2_LE},
+		{.name = "Blit G4 LE", .tst_fn = blit_bits, .data = &G4_LE},
+		{.name = "Blit G1 BE", .tst_fn = blit_bits, .data = &G1_BE},
+		{.name = "Blit G2 BE", .tst_fn = blit_bits, .data = &G2_BE},
+		{.name = "Blit G4 BE", .tst_fn = blit_bits, .data = &G4_BE},
+		{.name = "SubPixmap nested G1 LE", .tst_fn = sub_pixmap_nested,
+		 .data = &G1_LE},
+		{.name = "SubPixmap nested G2 LE", .tst_fn = sub_pixmap_nested,
+		 .data = &G2_LE},
+		{.name = "SubPixmap nested G4 LE", .tst_fn = sub_pixmap_nested,
+		 .data = &G4_LE},
+		{.name = "SubPixmap nested G1 BE", .tst_fn = sub_pixmap_nested,
+		 .data = &G1_BE},
+		{.name = "SubPixmap nested G2 BE", .tst_fn = sub_pixmap_nested,
+		 .data = &G2_BE},
+		{.name = "SubPixmap nested G4 BE", .tst_fn = sub_pixmap_nested,
+		 .data = &G4_BE},
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,17197 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * blit_conv.gen.c
+ *
+ * GENERATED on 2026 10 18 07:52:44 from blit_conv.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Blit conversions tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_convert.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_mix_pixels2.gen.h>
+
+#include "tst_test.h"
+
+static void fill_pixmap(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+
+	for (x = 0; x < (gp_coord)c->w; x++)
+		for (y = 0; y < (gp_coord)c->h; y++)
+			gp_putpixel(c, x, y, p);
+}
+
+static void mess_pixmap(gp_pixmap *c)
+{
+	gp_coord y;
+	unsigned int i;
+
+	for (y = 0; y < (gp_coord)c->h; y++) {
+		uint8_t *row = GP_PIXEL_ADDR(c, 0, y);
+		for (i = 0; i < c->bytes_per_row; i++) {
+			row[i] = y ^ i;
+		}
+	}
+}
+
+static int check_filled(gp_pixmap *c, gp_pixel p)
+{
+	gp_coord x, y;
+	gp_pixel pc;
+
+	for (x = 0; x < (gp_coord)c->w; x++) {
+		for (y = 0; y < (gp_coord)c->h; y++) {
+			pc = gp_getpixel(c, x, y);
+			if (p != pc) {
+				tst_msg("Pixels different %08x %08x", p, pc);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static gp_pixel rgb_to_pixel(int r, int g, int b, gp_pixmap *c)
+{
+	if (gp_pixel_has_flags(c->pixel_type, GP_PIXEL_HAS_ALPHA))
+		return gp_rgba_to_pixmap_pixel(r, g, b, 0xff, c);
+
+	return gp_rgb_to_pixmap_pixel(r, g, b, c);
+}
+
+static int blit_black_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_xRGB8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_BGR888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB555_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB565_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB666_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGB332_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_CMYK8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G1_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G2_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G4_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G8_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_GA88_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_G16_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_black_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_xRGB8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_BGR888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB555_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB565_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB666_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGB332_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_CMYK8888_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G1_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G2_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G4_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G8_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_GA88_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_G16_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_white_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0xff, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0xff, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+static int blit_equal_pixel_xRGB8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGBA8888_to_RGBA8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_BGR888_to_BGR888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_BGR888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB555_to_RGB555(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB555);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB565_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB666_to_RGB666(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB666);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGB332_to_RGB332(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB332);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_CMYK8888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G1_to_G1(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G1);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G2_to_G2(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G2);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G4_to_G4(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G4);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G8_to_G8(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G8);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_GA88_to_GA88(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_GA88);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_G16_to_G16(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_G16);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_equal_pixel_RGBA8888_PM_to_RGBA8888_PM(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGBA8888_PM);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x0f, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x0f, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+
+static int blit_red_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_green_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_blue_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_gray_RGB888_to_CMYK8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_red_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xff, 0x00, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xff, 0x00, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_green_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0xff, 0x00, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0xff, 0x00, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_blue_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0x00, 0x00, 0xff, src);
+	gp_pixel pix_dst = rgb_to_pixel(0x00, 0x00, 0xff, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int blit_gray_CMYK8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(100, 100, GP_PIXEL_CMYK8888);
+	gp_pixmap *dst = gp_pixmap_alloc(100, 100, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	/* Fill source with color, destination with pseudo random mess */
+	gp_pixel pix_src = rgb_to_pixel(0xef, 0xef, 0xef, src);
+	gp_pixel pix_dst = rgb_to_pixel(0xef, 0xef, 0xef, dst);
+
+        tst_msg("pixel_src=%08x pixel_dst=%08x", pix_src, pix_dst);
+
+	fill_pixmap(src, pix_src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 0, 0, src->w, src->h, dst, 0, 0);
+
+	if (check_filled(dst, pix_dst))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+
+/*
+ * Blits a part of a pixmap filled with pseudo random data and compares it
+ * against pixel by pixel conversion, covers the optimized row converters.
+ */
+
+static int blit_rand_RGB888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_convert_pixmap_pixel(ps, src, dst);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x converted to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+static int blit_rand_BGR888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_BGR888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_convert_pixmap_pixel(ps, src, dst);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x converted to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+static int blit_rand_xRGB8888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB565);
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_convert_pixmap_pixel(ps, src, dst);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x converted to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+static int blit_rand_RGB888_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB565);
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_convert_pixmap_pixel(ps, src, dst);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x converted to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+/*
+ * Blits a pixmap with alpha channel over pseudo random data, the source has
+ * transparent and opaque spans, and compares it against pixel by pixel mix.
+ */
+
+static int blit_alpha_RGBA8888_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= 0xff;
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+			if (GP_PIXEL_GET_A_RGBA8888(ps))
+				exp = gp_mix_pixels_RGBA8888_xRGB8888(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+static int blit_alpha_RGBA8888_PM_to_xRGB8888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_xRGB8888);
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= 0xff;
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+			if (ps)
+				exp = gp_mix_pixels_RGBA8888_PM_xRGB8888(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+static int blit_alpha_RGBA8888_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGBA8888);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= 0xff;
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+			if (GP_PIXEL_GET_A_RGBA8888(ps))
+				exp = gp_mix_pixels_RGBA8888_RGB888(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+static int blit_alpha_RGBA8888_PM_to_RGB888(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB888);
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= 0xff;
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+			if (ps)
+				exp = gp_mix_pixels_RGBA8888_PM_RGB888(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+static int blit_alpha_RGBA8888_PM_to_RGB565(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_RGBA8888_PM);
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB565);
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_RGB565);
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= 0xff;
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+			if (ps)
+				exp = gp_mix_pixels_RGBA8888_PM_RGB565(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Blit Conversions Testsuite",
+	.tests = {
+		{.name = "Blit black xRGB8888 to xRGB8888",
+		 .tst_fn = blit_black_xRGB8888_to_xRGB8888},
+		{.name = "Blit white xRGB8888 to xRGB8888",
+		 .tst_fn = blit_white_xRGB8888_to_xRGB8888},
+		{.name = "Blit black xRGB8888 to RGBA8888",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA8888},
+		{.name = "Blit white xRGB8888 to RGBA8888",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA8888},
+		{.name = "Blit black xRGB8888 to RGB888",
+		 .tst_fn = blit_black_xRGB8888_to_RGB888},
+		{.name = "Blit white xRGB8888 to RGB888",
+		 .tst_fn = blit_white_xRGB8888_to_RGB888},
+		{.name = "Blit black xRGB8888 to BGR888",
+		 .tst_fn = blit_black_xRGB8888_to_BGR888},
+		{.name = "Blit white xRGB8888 to BGR888",
+		 .tst_fn = blit_white_xRGB8888_to_BGR888},
+		{.name = "Blit black xRGB8888 to RGB555",
+		 .tst_fn = blit_black_xRGB8888_to_RGB555},
+		{.name = "Blit white xRGB8888 to RGB555",
+		 .tst_fn = blit_white_xRGB8888_to_RGB555},
+		{.name = "Blit black xRGB8888 to RGB565",
+		 .tst_fn = blit_black_xRGB8888_to_RGB565},
+		{.name = "Blit white xRGB8888 to RGB565",
+		 .tst_fn = blit_white_xRGB8888_to_RGB565},
+		{.name = "Blit black xRGB8888 to RGB666",
+		 .tst_fn = blit_black_xRGB8888_to_RGB666},
+		{.name = "Blit white xRGB8888 to RGB666",
+		 .tst_fn = blit_white_xRGB8888_to_RGB666},
+		{.name = "Blit black xRGB8888 to RGB332",
+		 .tst_fn = blit_black_xRGB8888_to_RGB332},
+		{.name = "Blit white xRGB8888 to RGB332",
+		 .tst_fn = blit_white_xRGB8888_to_RGB332},
+		{.name = "Blit black xRGB8888 to CMYK8888",
+		 .tst_fn = blit_black_xRGB8888_to_CMYK8888},
+		{.name = "Blit white xRGB8888 to CMYK8888",
+		 .tst_fn = blit_white_xRGB8888_to_CMYK8888},
+		{.name = "Blit black xRGB8888 to G1",
+		 .tst_fn = blit_black_xRGB8888_to_G1},
+		{.name = "Blit white xRGB8888 to G1",
+		 .tst_fn = blit_white_xRGB8888_to_G1},
+		{.name = "Blit black xRGB8888 to G2",
+		 .tst_fn = blit_black_xRGB8888_to_G2},
+		{.name = "Blit white xRGB8888 to G2",
+		 .tst_fn = blit_white_xRGB8888_to_G2},
+		{.name = "Blit black xRGB8888 to G4",
+		 .tst_fn = blit_black_xRGB8888_to_G4},
+		{.name = "Blit white xRGB8888 to G4",
+		 .tst_fn = blit_white_xRGB8888_to_G4},
+		{.name = "Blit black xRGB8888 to G8",
+		 .tst_fn = blit_black_xRGB8888_to_G8},
+		{.name = "Blit white xRGB8888 to G8",
+		 .tst_fn = blit_white_xRGB8888_to_G8},
+		{.name = "Blit black xRGB8888 to GA88",
+		 .tst_fn = blit_black_xRGB8888_to_GA88},
+		{.name = "Blit white xRGB8888 to GA88",
+		 .tst_fn = blit_white_xRGB8888_to_GA88},
+		{.name = "Blit black xRGB8888 to G16",
+		 .tst_fn = blit_black_xRGB8888_to_G16},
+		{.name = "Blit white xRGB8888 to G16",
+		 .tst_fn = blit_white_xRGB8888_to_G16},
+		{.name = "Blit black xRGB8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_xRGB8888_to_RGBA8888_PM},
+		{.name = "Blit white xRGB8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_xRGB8888_to_RGBA8888_PM},
+		{.name = "Blit black RGBA8888 to xRGB8888",
+		 .tst_fn = blit_black_RGBA8888_to_xRGB8888},
+		{.name = "Blit white RGBA8888 to xRGB8888",
+		 .tst_fn = blit_white_RGBA8888_to_xRGB8888},
+		{.name = "Blit black RGBA8888 to RGBA8888",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA8888},
+		{.name = "Blit white RGBA8888 to RGBA8888",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA8888},
+		{.name = "Blit black RGBA8888 to RGB888",
+		 .tst_fn = blit_black_RGBA8888_to_RGB888},
+		{.name = "Blit white RGBA8888 to RGB888",
+		 .tst_fn = blit_white_RGBA8888_to_RGB888},
+		{.name = "Blit black RGBA8888 to BGR888",
+		 .tst_fn = blit_black_RGBA8888_to_BGR888},
+		{.name = "Blit white RGBA8888 to BGR888",
+		 .tst_fn = blit_white_RGBA8888_to_BGR888},
+		{.name = "Blit black RGBA8888 to RGB555",
+		 .tst_fn = blit_black_RGBA8888_to_RGB555},
+		{.name = "Blit white RGBA8888 to RGB555",
+		 .tst_fn = blit_white_RGBA8888_to_RGB555},
+		{.name = "Blit black RGBA8888 to RGB565",
+		 .tst_fn = blit_black_RGBA8888_to_RGB565},
+		{.name = "Blit white RGBA8888 to RGB565",
+		 .tst_fn = blit_white_RGBA8888_to_RGB565},
+		{.name = "Blit black RGBA8888 to RGB666",
+		 .tst_fn = blit_black_RGBA8888_to_RGB666},
+		{.name = "Blit white RGBA8888 to RGB666",
+		 .tst_fn = blit_white_RGBA8888_to_RGB666},
+		{.name = "Blit black RGBA8888 to RGB332",
+		 .tst_fn = blit_black_RGBA8888_to_RGB332},
+		{.name = "Blit white RGBA8888 to RGB332",
+		 .tst_fn = blit_white_RGBA8888_to_RGB332},
+		{.name = "Blit black RGBA8888 to CMYK8888",
+		 .tst_fn = blit_black_RGBA8888_to_CMYK8888},
+		{.name = "Blit white RGBA8888 to CMYK8888",
+		 .tst_fn = blit_white_RGBA8888_to_CMYK8888},
+		{.name = "Blit black RGBA8888 to G1",
+		 .tst_fn = blit_black_RGBA8888_to_G1},
+		{.name = "Blit white RGBA8888 to G1",
+		 .tst_fn = blit_white_RGBA8888_to_G1},
+		{.name = "Blit black RGBA8888 to G2",
+		 .tst_fn = blit_black_RGBA8888_to_G2},
+		{.name = "Blit white RGBA8888 to G2",
+		 .tst_fn = blit_white_RGBA8888_to_G2},
+		{.name = "Blit black RGBA8888 to G4",
+		 .tst_fn = blit_black_RGBA8888_to_G4},
+		{.name = "Blit white RGBA8888 to G4",
+		 .tst_fn = blit_white_RGBA8888_to_G4},
+		{.name = "Blit black RGBA8888 to G8",
+		 .tst_fn = blit_black_RGBA8888_to_G8},
+		{.name = "Blit white RGBA8888 to G8",
+		 .tst_fn = blit_white_RGBA8888_to_G8},
+		{.name = "Blit black RGBA8888 to GA88",
+		 .tst_fn = blit_black_RGBA8888_to_GA88},
+		{.name = "Blit white RGBA8888 to GA88",
+		 .tst_fn = blit_white_RGBA8888_to_GA88},
+		{.name = "Blit black RGBA8888 to G16",
+		 .tst_fn = blit_black_RGBA8888_to_G16},
+		{.name = "Blit white RGBA8888 to G16",
+		 .tst_fn = blit_white_RGBA8888_to_G16},
+		{.name = "Blit black RGBA8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGBA8888_to_RGBA8888_PM},
+		{.name = "Blit white RGBA8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGBA8888_to_RGBA8888_PM},
+		{.name = "Blit black RGB888 to xRGB8888",
+		 .tst_fn = blit_black_RGB888_to_xRGB8888},
+		{.name = "Blit white RGB888 to xRGB8888",
+		 .tst_fn = blit_white_RGB888_to_xRGB8888},
+		{.name = "Blit black RGB888 to RGBA8888",
+		 .tst_fn = blit_black_RGB888_to_RGBA8888},
+		{.name = "Blit white RGB888 to RGBA8888",
+		 .tst_fn = blit_white_RGB888_to_RGBA8888},
+		{.name = "Blit black RGB888 to RGB888",
+		 .tst_fn = blit_black_RGB888_to_RGB888},
+		{.name = "Blit white RGB888 to RGB888",
+		 .tst_fn = blit_white_RGB888_to_RGB888},
+		{.name = "Blit black RGB888 to BGR888",
+		 .tst_fn = blit_black_RGB888_to_BGR888},
+		{.name = "Blit white RGB888 to BGR888",
+		 .tst_fn = blit_white_RGB888_to_BGR888},
+		{.name = "Blit black RGB888 to RGB555",
+		 .tst_fn = blit_black_RGB888_to_RGB555},
+		{.name = "Blit white RGB888 to RGB555",
+		 .tst_fn = blit_white_RGB888_to_RGB555},
+		{.name = "Blit black RGB888 to RGB565",
+		 .tst_fn = blit_black_RGB888_to_RGB565},
+		{.name = "Blit white RGB888 to RGB565",
+		 .tst_fn = blit_white_RGB888_to_RGB565},
+		{.name = "Blit black RGB888 to RGB666",
+		 .tst_fn = blit_black_RGB888_to_RGB666},
+		{.name = "Blit white RGB888 to RGB666",
+		 .tst_fn = blit_white_RGB888_to_RGB666},
+		{.name = "Blit black RGB888 to RGB332",
+		 .tst_fn = blit_black_RGB888_to_RGB332},
+		{.name = "Blit white RGB888 to RGB332",
+		 .tst_fn = blit_white_RGB888_to_RGB332},
+		{.name = "Blit black RGB888 to CMYK8888",
+		 .tst_fn = blit_black_RGB888_to_CMYK8888},
+		{.name = "Blit white RGB888 to CMYK8888",
+		 .tst_fn = blit_white_RGB888_to_CMYK8888},
+		{.name = "Blit black RGB888 to G1",
+		 .tst_fn = blit_black_RGB888_to_G1},
+		{.name = "Blit white RGB888 to G1",
+		 .tst_fn = blit_white_RGB888_to_G1},
+		{.name = "Blit black RGB888 to G2",
+		 .tst_fn = blit_black_RGB888_to_G2},
+		{.name = "Blit white RGB888 to G2",
+		 .tst_fn = blit_white_RGB888_to_G2},
+		{.name = "Blit black RGB888 to G4",
+		 .tst_fn = blit_black_RGB888_to_G4},
+		{.name = "Blit white RGB888 to G4",
+		 .tst_fn = blit_white_RGB888_to_G4},
+		{.name = "Blit black RGB888 to G8",
+		 .tst_fn = blit_black_RGB888_to_G8},
+		{.name = "Blit white RGB888 to G8",
+		 .tst_fn = blit_white_RGB888_to_G8},
+		{.name = "Blit black RGB888 to GA88",
+		 .tst_fn = blit_black_RGB888_to_GA88},
+		{.name = "Blit white RGB888 to GA88",
+		 .tst_fn = blit_white_RGB888_to_GA88},
+		{.name = "Blit black RGB888 to G16",
+		 .tst_fn = blit_black_RGB888_to_G16},
+		{.name = "Blit white RGB888 to G16",
+		 .tst_fn = blit_white_RGB888_to_G16},
+		{.name = "Blit black RGB888 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB888_to_RGBA8888_PM},
+		{.name = "Blit white RGB888 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB888_to_RGBA8888_PM},
+		{.name = "Blit black BGR888 to xRGB8888",
+		 .tst_fn = blit_black_BGR888_to_xRGB8888},
+		{.name = "Blit white BGR888 to xRGB8888",
+		 .tst_fn = blit_white_BGR888_to_xRGB8888},
+		{.name = "Blit black BGR888 to RGBA8888",
+		 .tst_fn = blit_black_BGR888_to_RGBA8888},
+		{.name = "Blit white BGR888 to RGBA8888",
+		 .tst_fn = blit_white_BGR888_to_RGBA8888},
+		{.name = "Blit black BGR888 to RGB888",
+		 .tst_fn = blit_black_BGR888_to_RGB888},
+		{.name = "Blit white BGR888 to RGB888",
+		 .tst_fn = blit_white_BGR888_to_RGB888},
+		{.name = "Blit black BGR888 to BGR888",
+		 .tst_fn = blit_black_BGR888_to_BGR888},
+		{.name = "Blit white BGR888 to BGR888",
+		 .tst_fn = blit_white_BGR888_to_BGR888},
+		{.name = "Blit black BGR888 to RGB555",
+		 .tst_fn = blit_black_BGR888_to_RGB555},
+		{.name = "Blit white BGR888 to RGB555",
+		 .tst_fn = blit_white_BGR888_to_RGB555},
+		{.name = "Blit black BGR888 to RGB565",
+		 .tst_fn = blit_black_BGR888_to_RGB565},
+		{.name = "Blit white BGR888 to RGB565",
+		 .tst_fn = blit_white_BGR888_to_RGB565},
+		{.name = "Blit black BGR888 to RGB666",
+		 .tst_fn = blit_black_BGR888_to_RGB666},
+		{.name = "Blit white BGR888 to RGB666",
+		 .tst_fn = blit_white_BGR888_to_RGB666},
+		{.name = "Blit black BGR888 to RGB332",
+		 .tst_fn = blit_black_BGR888_to_RGB332},
+		{.name = "Blit white BGR888 to RGB332",
+		 .tst_fn = blit_white_BGR888_to_RGB332},
+		{.name = "Blit black BGR888 to CMYK8888",
+		 .tst_fn = blit_black_BGR888_to_CMYK8888},
+		{.name = "Blit white BGR888 to CMYK8888",
+		 .tst_fn = blit_white_BGR888_to_CMYK8888},
+		{.name = "Blit black BGR888 to G1",
+		 .tst_fn = blit_black_BGR888_to_G1},
+		{.name = "Blit white BGR888 to G1",
+		 .tst_fn = blit_white_BGR888_to_G1},
+		{.name = "Blit black BGR888 to G2",
+		 .tst_fn = blit_black_BGR888_to_G2},
+		{.name = "Blit white BGR888 to G2",
+		 .tst_fn = blit_white_BGR888_to_G2},
+		{.name = "Blit black BGR888 to G4",
+		 .tst_fn = blit_black_BGR888_to_G4},
+		{.name = "Blit white BGR888 to G4",
+		 .tst_fn = blit_white_BGR888_to_G4},
+		{.name = "Blit black BGR888 to G8",
+		 .tst_fn = blit_black_BGR888_to_G8},
+		{.name = "Blit white BGR888 to G8",
+		 .tst_fn = blit_white_BGR888_to_G8},
+		{.name = "Blit black BGR888 to GA88",
+		 .tst_fn = blit_black_BGR888_to_GA88},
+		{.name = "Blit white BGR888 to GA88",
+		 .tst_fn = blit_white_BGR888_to_GA88},
+		{.name = "Blit black BGR888 to G16",
+		 .tst_fn = blit_black_BGR888_to_G16},
+		{.name = "Blit white BGR888 to G16",
+		 .tst_fn = blit_white_BGR888_to_G16},
+		{.name = "Blit black BGR888 to RGBA8888_PM",
+		 .tst_fn = blit_black_BGR888_to_RGBA8888_PM},
+		{.name = "Blit white BGR888 to RGBA8888_PM",
+		 .tst_fn = blit_white_BGR888_to_RGBA8888_PM},
+		{.name = "Blit black RGB555 to xRGB8888",
+		 .tst_fn = blit_black_RGB555_to_xRGB8888},
+		{.name = "Blit white RGB555 to xRGB8888",
+		 .tst_fn = blit_white_RGB555_to_xRGB8888},
+		{.name = "Blit black RGB555 to RGBA8888",
+		 .tst_fn = blit_black_RGB555_to_RGBA8888},
+		{.name = "Blit white RGB555 to RGBA8888",
+		 .tst_fn = blit_white_RGB555_to_RGBA8888},
+		{.name = "Blit black RGB555 to RGB888",
+		 .tst_fn = blit_black_RGB555_to_RGB888},
+		{.name = "Blit white RGB555 to RGB888",
+		 .tst_fn = blit_white_RGB555_to_RGB888},
+		{.name = "Blit black RGB555 to BGR888",
+		 .tst_fn = blit_black_RGB555_to_BGR888},
+		{.name = "Blit white RGB555 to BGR888",
+		 .tst_fn = blit_white_RGB555_to_BGR888},
+		{.name = "Blit black RGB555 to RGB555",
+		 .tst_fn = blit_black_RGB555_to_RGB555},
+		{.name = "Blit white RGB555 to RGB555",
+		 .tst_fn = blit_white_RGB555_to_RGB555},
+		{.name = "Blit black RGB555 to RGB565",
+		 .tst_fn = blit_black_RGB555_to_RGB565},
+		{.name = "Blit white RGB555 to RGB565",
+		 .tst_fn = blit_white_RGB555_to_RGB565},
+		{.name = "Blit black RGB555 to RGB666",
+		 .tst_fn = blit_black_RGB555_to_RGB666},
+		{.name = "Blit white RGB555 to RGB666",
+		 .tst_fn = blit_white_RGB555_to_RGB666},
+		{.name = "Blit black RGB555 to RGB332",
+		 .tst_fn = blit_black_RGB555_to_RGB332},
+		{.name = "Blit white RGB555 to RGB332",
+		 .tst_fn = blit_white_RGB555_to_RGB332},
+		{.name = "Blit black RGB555 to CMYK8888",
+		 .tst_fn = blit_black_RGB555_to_CMYK8888},
+		{.name = "Blit white RGB555 to CMYK8888",
+		 .tst_fn = blit_white_RGB555_to_CMYK8888},
+		{.name = "Blit black RGB555 to G1",
+		 .tst_fn = blit_black_RGB555_to_G1},
+		{.name = "Blit white RGB555 to G1",
+		 .tst_fn = blit_white_RGB555_to_G1},
+		{.name = "Blit black RGB555 to G2",
+		 .tst_fn = blit_black_RGB555_to_G2},
+		{.name = "Blit white RGB555 to G2",
+		 .tst_fn = blit_white_RGB555_to_G2},
+		{.name = "Blit black RGB555 to G4",
+		 .tst_fn = blit_black_RGB555_to_G4},
+		{.name = "Blit white RGB555 to G4",
+		 .tst_fn = blit_white_RGB555_to_G4},
+		{.name = "Blit black RGB555 to G8",
+		 .tst_fn = blit_black_RGB555_to_G8},
+		{.name = "Blit white RGB555 to G8",
+		 .tst_fn = blit_white_RGB555_to_G8},
+		{.name = "Blit black RGB555 to GA88",
+		 .tst_fn = blit_black_RGB555_to_GA88},
+		{.name = "Blit white RGB555 to GA88",
+		 .tst_fn = blit_white_RGB555_to_GA88},
+		{.name = "Blit black RGB555 to G16",
+		 .tst_fn = blit_black_RGB555_to_G16},
+		{.name = "Blit white RGB555 to G16",
+		 .tst_fn = blit_white_RGB555_to_G16},
+		{.name = "Blit black RGB555 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB555_to_RGBA8888_PM},
+		{.name = "Blit white RGB555 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB555_to_RGBA8888_PM},
+		{.name = "Blit black RGB565 to xRGB8888",
+		 .tst_fn = blit_black_RGB565_to_xRGB8888},
+		{.name = "Blit white RGB565 to xRGB8888",
+		 .tst_fn = blit_white_RGB565_to_xRGB8888},
+		{.name = "Blit black RGB565 to RGBA8888",
+		 .tst_fn = blit_black_RGB565_to_RGBA8888},
+		{.name = "Blit white RGB565 to RGBA8888",
+		 .tst_fn = blit_white_RGB565_to_RGBA8888},
+		{.name = "Blit black RGB565 to RGB888",
+		 .tst_fn = blit_black_RGB565_to_RGB888},
+		{.name = "Blit white RGB565 to RGB888",
+		 .tst_fn = blit_white_RGB565_to_RGB888},
+		{.name = "Blit black RGB565 to BGR888",
+		 .tst_fn = blit_black_RGB565_to_BGR888},
+		{.name = "Blit white RGB565 to BGR888",
+		 .tst_fn = blit_white_RGB565_to_BGR888},
+		{.name = "Blit black RGB565 to RGB555",
+		 .tst_fn = blit_black_RGB565_to_RGB555},
+		{.name = "Blit white RGB565 to RGB555",
+		 .tst_fn = blit_white_RGB565_to_RGB555},
+		{.name = "Blit black RGB565 to RGB565",
+		 .tst_fn = blit_black_RGB565_to_RGB565},
+		{.name = "Blit white RGB565 to RGB565",
+		 .tst_fn = blit_white_RGB565_to_RGB565},
+		{.name = "Blit black RGB565 to RGB666",
+		 .tst_fn = blit_black_RGB565_to_RGB666},
+		{.name = "Blit white RGB565 to RGB666",
+		 .tst_fn = blit_white_RGB565_to_RGB666},
+		{.name = "Blit black RGB565 to RGB332",
+		 .tst_fn = blit_black_RGB565_to_RGB332},
+		{.name = "Blit white RGB565 to RGB332",
+		 .tst_fn = blit_white_RGB565_to_RGB332},
+		{.name = "Blit black RGB565 to CMYK8888",
+		 .tst_fn = blit_black_RGB565_to_CMYK8888},
+		{.name = "Blit white RGB565 to CMYK8888",
+		 .tst_fn = blit_white_RGB565_to_CMYK8888},
+		{.name = "Blit black RGB565 to G1",
+		 .tst_fn = blit_black_RGB565_to_G1},
+		{.name = "Blit white RGB565 to G1",
+		 .tst_fn = blit_white_RGB565_to_G1},
+		{.name = "Blit black RGB565 to G2",
+		 .tst_fn = blit_black_RGB565_to_G2},
+		{.name = "Blit white RGB565 to G2",
+		 .tst_fn = blit_white_RGB565_to_G2},
+		{.name = "Blit black RGB565 to G4",
+		 .tst_fn = blit_black_RGB565_to_G4},
+		{.name = "Blit white RGB565 to G4",
+		 .tst_fn = blit_white_RGB565_to_G4},
+		{.name = "Blit black RGB565 to G8",
+		 .tst_fn = blit_black_RGB565_to_G8},
+		{.name = "Blit white RGB565 to G8",
+		 .tst_fn = blit_white_RGB565_to_G8},
+		{.name = "Blit black RGB565 to GA88",
+		 .tst_fn = blit_black_RGB565_to_GA88},
+		{.name = "Blit white RGB565 to GA88",
+		 .tst_fn = blit_white_RGB565_to_GA88},
+		{.name = "Blit black RGB565 to G16",
+		 .tst_fn = blit_black_RGB565_to_G16},
+		{.name = "Blit white RGB565 to G16",
+		 .tst_fn = blit_white_RGB565_to_G16},
+		{.name = "Blit black RGB565 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB565_to_RGBA8888_PM},
+		{.name = "Blit white RGB565 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB565_to_RGBA8888_PM},
+		{.name = "Blit black RGB666 to xRGB8888",
+		 .tst_fn = blit_black_RGB666_to_xRGB8888},
+		{.name = "Blit white RGB666 to xRGB8888",
+		 .tst_fn = blit_white_RGB666_to_xRGB8888},
+		{.name = "Blit black RGB666 to RGBA8888",
+		 .tst_fn = blit_black_RGB666_to_RGBA8888},
+		{.name = "Blit white RGB666 to RGBA8888",
+		 .tst_fn = blit_white_RGB666_to_RGBA8888},
+		{.name = "Blit black RGB666 to RGB888",
+		 .tst_fn = blit_black_RGB666_to_RGB888},
+		{.name = "Blit white RGB666 to RGB888",
+		 .tst_fn = blit_white_RGB666_to_RGB888},
+		{.name = "Blit black RGB666 to BGR888",
+		 .tst_fn = blit_black_RGB666_to_BGR888},
+		{.name = "Blit white RGB666 to BGR888",
+		 .tst_fn = blit_white_RGB666_to_BGR888},
+		{.name = "Blit black RGB666 to RGB555",
+		 .tst_fn = blit_black_RGB666_to_RGB555},
+		{.name = "Blit white RGB666 to RGB555",
+		 .tst_fn = blit_white_RGB666_to_RGB555},
+		{.name = "Blit black RGB666 to RGB565",
+		 .tst_fn = blit_black_RGB666_to_RGB565},
+		{.name = "Blit white RGB666 to RGB565",
+		 .tst_fn = blit_white_RGB666_to_RGB565},
+		{.name = "Blit black RGB666 to RGB666",
+		 .tst_fn = blit_black_RGB666_to_RGB666},
+		{.name = "Blit white RGB666 to RGB666",
+		 .tst_fn = blit_white_RGB666_to_RGB666},
+		{.name = "Blit black RGB666 to RGB332",
+		 .tst_fn = blit_black_RGB666_to_RGB332},
+		{.name = "Blit white RGB666 to RGB332",
+		 .tst_fn = blit_white_RGB666_to_RGB332},
+		{.name = "Blit black RGB666 to CMYK8888",
+		 .tst_fn = blit_black_RGB666_to_CMYK8888},
+		{.name = "Blit white RGB666 to CMYK8888",
+		 .tst_fn = blit_white_RGB666_to_CMYK8888},
+		{.name = "Blit black RGB666 to G1",
+		 .tst_fn = blit_black_RGB666_to_G1},
+		{.name = "Blit white RGB666 to G1",
+		 .tst_fn = blit_white_RGB666_to_G1},
+		{.name = "Blit black RGB666 to G2",
+		 .tst_fn = blit_black_RGB666_to_G2},
+		{.name = "Blit white RGB666 to G2",
+		 .tst_fn = blit_white_RGB666_to_G2},
+		{.name = "Blit black RGB666 to G4",
+		 .tst_fn = blit_black_RGB666_to_G4},
+		{.name = "Blit white RGB666 to G4",
+		 .tst_fn = blit_white_RGB666_to_G4},
+		{.name = "Blit black RGB666 to G8",
+		 .tst_fn = blit_black_RGB666_to_G8},
+		{.name = "Blit white RGB666 to G8",
+		 .tst_fn = blit_white_RGB666_to_G8},
+		{.name = "Blit black RGB666 to GA88",
+		 .tst_fn = blit_black_RGB666_to_GA88},
+		{.name = "Blit white RGB666 to GA88",
+		 .tst_fn = blit_white_RGB666_to_GA88},
+		{.name = "Blit black RGB666 to G16",
+		 .tst_fn = blit_black_RGB666_to_G16},
+		{.name = "Blit white RGB666 to G16",
+		 .tst_fn = blit_white_RGB666_to_G16},
+		{.name = "Blit black RGB666 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB666_to_RGBA8888_PM},
+		{.name = "Blit white RGB666 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB666_to_RGBA8888_PM},
+		{.name = "Blit black RGB332 to xRGB8888",
+		 .tst_fn = blit_black_RGB332_to_xRGB8888},
+		{.name = "Blit white RGB332 to xRGB8888",
+		 .tst_fn = blit_white_RGB332_to_xRGB8888},
+		{.name = "Blit black RGB332 to RGBA8888",
+		 .tst_fn = blit_black_RGB332_to_RGBA8888},
+		{.name = "Blit white RGB332 to RGBA8888",
+		 .tst_fn = blit_white_RGB332_to_RGBA8888},
+		{.name = "Blit black RGB332 to RGB888",
+		 .tst_fn = blit_black_RGB332_to_RGB888},
+		{.name = "Blit white RGB332 to RGB888",
+		 .tst_fn = blit_white_RGB332_to_RGB888},
+		{.name = "Blit black RGB332 to BGR888",
+		 .tst_fn = blit_black_RGB332_to_BGR888},
+		{.name = "Blit white RGB332 to BGR888",
+		 .tst_fn = blit_white_RGB332_to_BGR888},
+		{.name = "Blit black RGB332 to RGB555",
+		 .tst_fn = blit_black_RGB332_to_RGB555},
+		{.name = "Blit white RGB332 to RGB555",
+		 .tst_fn = blit_white_RGB332_to_RGB555},
+		{.name = "Blit black RGB332 to RGB565",
+		 .tst_fn = blit_black_RGB332_to_RGB565},
+		{.name = "Blit white RGB332 to RGB565",
+		 .tst_fn = blit_white_RGB332_to_RGB565},
+		{.name = "Blit black RGB332 to RGB666",
+		 .tst_fn = blit_black_RGB332_to_RGB666},
+		{.name = "Blit white RGB332 to RGB666",
+		 .tst_fn = blit_white_RGB332_to_RGB666},
+		{.name = "Blit black RGB332 to RGB332",
+		 .tst_fn = blit_black_RGB332_to_RGB332},
+		{.name = "Blit white RGB332 to RGB332",
+		 .tst_fn = blit_white_RGB332_to_RGB332},
+		{.name = "Blit black RGB332 to CMYK8888",
+		 .tst_fn = blit_black_RGB332_to_CMYK8888},
+		{.name = "Blit white RGB332 to CMYK8888",
+		 .tst_fn = blit_white_RGB332_to_CMYK8888},
+		{.name = "Blit black RGB332 to G1",
+		 .tst_fn = blit_black_RGB332_to_G1},
+		{.name = "Blit white RGB332 to G1",
+		 .tst_fn = blit_white_RGB332_to_G1},
+		{.name = "Blit black RGB332 to G2",
+		 .tst_fn = blit_black_RGB332_to_G2},
+		{.name = "Blit white RGB332 to G2",
+		 .tst_fn = blit_white_RGB332_to_G2},
+		{.name = "Blit black RGB332 to G4",
+		 .tst_fn = blit_black_RGB332_to_G4},
+		{.name = "Blit white RGB332 to G4",
+		 .tst_fn = blit_white_RGB332_to_G4},
+		{.name = "Blit black RGB332 to G8",
+		 .tst_fn = blit_black_RGB332_to_G8},
+		{.name = "Blit white RGB332 to G8",
+		 .tst_fn = blit_white_RGB332_to_G8},
+		{.name = "Blit black RGB332 to GA88",
+		 .tst_fn = blit_black_RGB332_to_GA88},
+		{.name = "Blit white RGB332 to GA88",
+		 .tst_fn = blit_white_RGB332_to_GA88},
+		{.name = "Blit black RGB332 to G16",
+		 .tst_fn = blit_black_RGB332_to_G16},
+		{.name = "Blit white RGB332 to G16",
+		 .tst_fn = blit_white_RGB332_to_G16},
+		{.name = "Blit black RGB332 to RGBA8888_PM",
+		 .tst_fn = blit_black_RGB332_to_RGBA8888_PM},
+		{.name = "Blit white RGB332 to RGBA8888_PM",
+		 .tst_fn = blit_white_RGB332_to_RGBA8888_PM},
+		{.name = "Blit black CMYK8888 to xRGB8888",
+		 .tst_fn = blit_black_CMYK8888_to_xRGB8888},
+		{.name = "Blit white CMYK8888 to xRGB8888",
+		 .tst_fn = blit_white_CMYK8888_to_xRGB8888},
+		{.name = "Blit black CMYK8888 to RGBA8888",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA8888},
+		{.name = "Blit white CMYK8888 to RGBA8888",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA8888},
+		{.name = "Blit black CMYK8888 to RGB888",
+		 .tst_fn = blit_black_CMYK8888_to_RGB888},
+		{.name = "Blit white CMYK8888 to RGB888",
+		 .tst_fn = blit_white_CMYK8888_to_RGB888},
+		{.name = "Blit black CMYK8888 to BGR888",
+		 .tst_fn = blit_black_CMYK8888_to_BGR888},
+		{.name = "Blit white CMYK8888 to BGR888",
+		 .tst_fn = blit_white_CMYK8888_to_BGR888},
+		{.name = "Blit black CMYK8888 to RGB555",
+		 .tst_fn = blit_black_CMYK8888_to_RGB555},
+		{.name = "Blit white CMYK8888 to RGB555",
+		 .tst_fn = blit_white_CMYK8888_to_RGB555},
+		{.name = "Blit black CMYK8888 to RGB565",
+		 .tst_fn = blit_black_CMYK8888_to_RGB565},
+		{.name = "Blit white CMYK8888 to RGB565",
+		 .tst_fn = blit_white_CMYK8888_to_RGB565},
+		{.name = "Blit black CMYK8888 to RGB666",
+		 .tst_fn = blit_black_CMYK8888_to_RGB666},
+		{.name = "Blit white CMYK8888 to RGB666",
+		 .tst_fn = blit_white_CMYK8888_to_RGB666},
+		{.name = "Blit black CMYK8888 to RGB332",
+		 .tst_fn = blit_black_CMYK8888_to_RGB332},
+		{.name = "Blit white CMYK8888 to RGB332",
+		 .tst_fn = blit_white_CMYK8888_to_RGB332},
+		{.name = "Blit black CMYK8888 to CMYK8888",
+		 .tst_fn = blit_black_CMYK8888_to_CMYK8888},
+		{.name = "Blit white CMYK8888 to CMYK8888",
+		 .tst_fn = blit_white_CMYK8888_to_CMYK8888},
+		{.name = "Blit black CMYK8888 to G1",
+		 .tst_fn = blit_black_CMYK8888_to_G1},
+		{.name = "Blit white CMYK8888 to G1",
+		 .tst_fn = blit_white_CMYK8888_to_G1},
+		{.name = "Blit black CMYK8888 to G2",
+		 .tst_fn = blit_black_CMYK8888_to_G2},
+		{.name = "Blit white CMYK8888 to G2",
+		 .tst_fn = blit_white_CMYK8888_to_G2},
+		{.name = "Blit black CMYK8888 to G4",
+		 .tst_fn = blit_black_CMYK8888_to_G4},
+		{.name = "Blit white CMYK8888 to G4",
+		 .tst_fn = blit_white_CMYK8888_to_G4},
+		{.name = "Blit black CMYK8888 to G8",
+		 .tst_fn = blit_black_CMYK8888_to_G8},
+		{.name = "Blit white CMYK8888 to G8",
+		 .tst_fn = blit_white_CMYK8888_to_G8},
+		{.name = "Blit black CMYK8888 to GA88",
+		 .tst_fn = blit_black_CMYK8888_to_GA88},
+		{.name = "Blit white CMYK8888 to GA88",
+		 .tst_fn = blit_white_CMYK8888_to_GA88},
+		{.name = "Blit black CMYK8888 to G16",
+		 .tst_fn = blit_black_CMYK8888_to_G16},
+		{.name = "Blit white CMYK8888 to G16",
+		 .tst_fn = blit_white_CMYK8888_to_G16},
+		{.name = "Blit black CMYK8888 to RGBA8888_PM",
+		 .tst_fn = blit_black_CMYK8888_to_RGBA8888_PM},
+		{.name = "Blit white CMYK8888 to RGBA8888_PM",
+		 .tst_fn = blit_white_CMYK8888_to_RGBA8888_PM},
+		{.name = "Blit black G1 to xRGB8888",
+		 .tst_fn = blit_black_G1_to_xRGB8888},
+		{.name = "Blit white G1 to xRGB8888",
+		 .tst_fn = blit_white_G1_to_xRGB8888},
+		{.name = "Blit black G1 to RGBA8888",
+		 .tst_fn = blit_black_G1_to_RGBA8888},
+		{.name = "Blit white G1 to RGBA8888",
+		 .tst_fn = blit_white_G1_to_RGBA8888},
+		{.name = "Blit black G1 to RGB888",
+		 .tst_fn = blit_black_G1_to_RGB888},
+		{.name = "Blit white G1 to RGB888",
+		 .tst_fn = blit_white_G1_to_RGB888},
+		{.name = "Blit black G1 to BGR888",
+		 .tst_fn = blit_black_G1_to_BGR888},
+		{.name = "Blit white G1 to BGR888",
+		 .tst_fn = blit_white_G1_to_BGR888},
+		{.name = "Blit black G1 to RGB555",
+		 .tst_fn = blit_black_G1_to_RGB555},
+		{.name = "Blit white G1 to RGB555",
+		 .tst_fn = blit_white_G1_to_RGB555},
+		{.name = "Blit black G1 to RGB565",
+		 .tst_fn = blit_black_G1_to_RGB565},
+		{.name = "Blit white G1 to RGB565",
+		 .tst_fn = blit_white_G1_to_RGB565},
+		{.name = "Blit black G1 to RGB666",
+		 .tst_fn = blit_black_G1_to_RGB666},
+		{.name = "Blit white G1 to RGB666",
+		 .tst_fn = blit_white_G1_to_RGB666},
+		{.name = "Blit black G1 to RGB332",
+		 .tst_fn = blit_black_G1_to_RGB332},
+		{.name = "Blit white G1 to RGB332",
+		 .tst_fn = blit_white_G1_to_RGB332},
+		{.name = "Blit black G1 to CMYK8888",
+		 .tst_fn = blit_black_G1_to_CMYK8888},
+		{.name = "Blit white G1 to CMYK8888",
+		 .tst_fn = blit_white_G1_to_CMYK8888},
+		{.name = "Blit black G1 to G1",
+		 .tst_fn = blit_black_G1_to_G1},
+		{.name = "Blit white G1 to G1",
+		 .tst_fn = blit_white_G1_to_G1},
+		{.name = "Blit black G1 to G2",
+		 .tst_fn = blit_black_G1_to_G2},
+		{.name = "Blit white G1 to G2",
+		 .tst_fn = blit_white_G1_to_G2},
+		{.name = "Blit black G1 to G4",
+		 .tst_fn = blit_black_G1_to_G4},
+		{.name = "Blit white G1 to G4",
+		 .tst_fn = blit_white_G1_to_G4},
+		{.name = "Blit black G1 to G8",
+		 .tst_fn = blit_black_G1_to_G8},
+		{.name = "Blit white G1 to G8",
+		 .tst_fn = blit_white_G1_to_G8},
+		{.name = "Blit black G1 to GA88",
+		 .tst_fn = blit_black_G1_to_GA88},
+		{.name = "Blit white G1 to GA88",
+		 .tst_fn = blit_white_G1_to_GA88},
+		{.name = "Blit black G1 to G16",
+		 .tst_fn = blit_black_G1_to_G16},
+		{.name = "Blit white G1 to G16",
+		 .tst_fn = blit_white_G1_to_G16},
+		{.name = "Blit black G1 to RGBA8888_PM",
+		 .tst_fn = blit_black_G1_to_RGBA8888_PM},
+		{.name = "Blit white G1 to RGBA8888_PM",
+		 .tst_fn = blit_white_G1_to_RGBA8888_PM},
+		{.name = "Blit black G2 to xRGB8888",
+		 .tst_fn = blit_black_G2_to_xRGB8888},
+		{.name = "Blit white G2 to xRGB8888",
+		 .tst_fn = blit_white_G2_to_xRGB8888},
+		{.name = "Blit black G2 to RGBA8888",
+		 .tst_fn = blit_black_G2_to_RGBA8888},
+		{.name = "Blit white G2 to RGBA8888",
+		 .tst_fn = blit_white_G2_to_RGBA8888},
+		{.name = "Blit black G2 to RGB888",
+		 .tst_fn = blit_black_G2_to_RGB888},
+		{.name = "Blit white G2 to RGB888",
+		 .tst_fn = blit_white_G2_to_RGB888},
+		{.name = "Blit black G2 to BGR888",
+		 .tst_fn = blit_black_G2_to_BGR888},
+		{.name = "Blit white G2 to BGR888",
+		 .tst_fn = blit_white_G2_to_BGR888},
+		{.name = "Blit black G2 to RGB555",
+		 .tst_fn = blit_black_G2_to_RGB555},
+		{.name = "Blit white G2 to RGB555",
+		 .tst_fn = blit_white_G2_to_RGB555},
+		{.name = "Blit black G2 to RGB565",
+		 .tst_fn = blit_black_G2_to_RGB565},
+		{.name = "Blit white G2 to RGB565",
+		 .tst_fn = blit_white_G2_to_RGB565},
+		{.name = "Blit black G2 to RGB666",
+		 .tst_fn = blit_black_G2_to_RGB666},
+		{.name = "Blit white G2 to RGB666",
+		 .tst_fn = blit_white_G2_to_RGB666},
+		{.name = "Blit black G2 to RGB332",
+		 .tst_fn = blit_black_G2_to_RGB332},
+		{.name = "Blit white G2 to RGB332",
+		 .tst_fn = blit_white_G2_to_RGB332},
+		{.name = "Blit black G2 to CMYK8888",
+		 .tst_fn = blit_black_G2_to_CMYK8888},
+		{.name = "Blit white G2 to CMYK8888",
+		 .tst_fn = blit_white_G2_to_CMYK8888},
+		{.name = "Blit black G2 to G1",
+		 .tst_fn = blit_black_G2_to_G1},
+		{.name = "Blit white G2 to G1",
+		 .tst_fn = blit_white_G2_to_G1},
+		{.name = "Blit black G2 to G2",
+		 .tst_fn = blit_black_G2_to_G2},
+		{.name = "Blit white G2 to G2",
+		 .tst_fn = blit_white_G2_to_G2},
+		{.name = "Blit black G2 to G4",
+		 .tst_fn = blit_black_G2_to_G4},
+		{.name = "Blit white G2 to G4",
+		 .tst_fn = blit_white_G2_to_G4},
+		{.name = "Blit black G2 to G8",
+		 .tst_fn = blit_black_G2_to_G8},
+		{.name = "Blit white G2 to G8",
+		 .tst_fn = blit_white_G2_to_G8},
+		{.name = "Blit black G2 to GA88",
+		 .tst_fn = blit_black_G2_to_GA88},
+		{.name = "Blit white G2 to GA88",
+		 .tst_fn = blit_white_G2_to_GA88},
+		{.name = "Blit black G2 to G16",
+		 .tst_fn = blit_black_G2_to_G16},
+		{.name = "Blit white G2 to G16",
+		 .tst_fn = blit_white_G2_to_G16},
+		{.name = "Blit black G2 to RGBA8888_PM",
+		 .tst_fn = blit_black_G2_to_RGBA8888_PM},
+		{.name = "Blit white G2 to RGBA8888_PM",
+		 .tst_fn = blit_white_G2_to_RGBA8888_PM},
+		{.name = "Blit black G4 to xRGB8888",
+		 .tst_fn = blit_black_G4_to_xRGB8888},
+		{.name = "Blit white G4 to xRGB8888",
+		 .tst_fn = blit_white_G4_to_xRGB8888},
+		{.name = "Blit black G4 to RGBA8888",
+		 .tst_fn = blit_black_G4_to_RGBA8888},
+		{.name = "Blit white G4 to RGBA8888",
+		 .tst_fn = blit_white_G4_to_RGBA8888},
+		{.name = "Blit black G4 to RGB888",
+		 .tst_fn = blit_black_G4_to_RGB888},
+		{.name = "Blit white G4 to RGB888",
+		 .tst_fn = blit_white_G4_to_RGB888},
+		{.name = "Blit black G4 to BGR888",
+		 .tst_fn = blit_black_G4_to_BGR888},
+		{.name = "Blit white G4 to BGR888",
+		 .tst_fn = blit_white_G4_to_BGR888},
+		{.name = "Blit black G4 to RGB555",
+		 .tst_fn = blit_black_G4_to_RGB555},
+		{.name = "Blit white G4 to RGB555",
+		 .tst_fn = blit_white_G4_to_RGB555},
+		{.name = "Blit black G4 to RGB565",
+		 .tst_fn = blit_black_G4_to_RGB565},
+		{.name = "Blit white G4 to RGB565",
+		 .tst_fn = blit_white_G4_to_RGB565},
+		{.name = "Blit black G4 to RGB666",
+		 .tst_fn = blit_black_G4_to_RGB666},
+		{.name = "Blit white G4 to RGB666",
+		 .tst_fn = blit_white_G4_to_RGB666},
+		{.name = "Blit black G4 to RGB332",
+		 .tst_fn = blit_black_G4_to_RGB332},
+		{.name = "Blit white G4 to RGB332",
+		 .tst_fn = blit_white_G4_to_RGB332},
+		{.name = "Blit black G4 to CMYK8888",
+		 .tst_fn = blit_black_G4_to_CMYK8888},
+		{.name = "Blit white G4 to CMYK8888",
+		 .tst_fn = blit_white_G4_to_CMYK8888},
+		{.name = "Blit black G4 to G1",
+		 .tst_fn = blit_black_G4_to_G1},
+		{.name = "Blit white G4 to G1",
+		 .tst_fn = blit_white_G4_to_G1},
+		{.name = "Blit black G4 to G2",
+		 .tst_fn = blit_black_G4_to_G2},
+		{.name = "Blit white G4 to G2",
+		 .tst_fn = blit_white_G4_to_G2},
+		{.name = "Blit black G4 to G4",
+		 .tst_fn = blit_black_G4_to_G4},
+		{.name = "Blit white G4 to G4",
+		 .tst_fn = blit_white_G4_to_G4},
+		{.name = "Blit black G4 to G8",
+		 .tst_fn = blit_black_G4_to_G8},
+		{.name = "Blit white G4 to G8",
+		 .tst_fn = blit_white_G4_to_G8},
+		{.name = "Blit black G4 to GA88",
+		 .tst_fn = blit_black_G4_to_GA88},
+		{.name = "Blit white G4 to GA88",
+		 .tst_fn = blit_white_G4_to_GA88},
+		{.name = "Blit black G4 to G16",
+		 .tst_fn = blit_black_G4_to_G16},
+		{.name = "Blit white G4 to G16",
+		 .tst_fn = blit_white_G4_to_G16},
+		{.name = "Blit black G4 to RGBA8888_PM",
+		 .tst_fn = blit_black_G4_to_RGBA8888_PM},
+		{.name = "Blit white G4 to RGBA8888_PM",
+		 .tst_fn = blit_white_G4_to_RGBA8888_PM},
+		{.name = "Blit black G8 to xRGB8888",
+		 .tst_fn = blit_black_G8_to_xRGB8888},
+		{.name = "Blit white G8 to xRGB8888",
+		 .tst_fn = blit_white_G8_to_xRGB8888},
+		{.name = "Blit black G8 to RGBA8888",
+		 .tst_fn = blit_black_G8_to_RGBA8888},
+		{.name = "Blit white G8 to RGBA8888",
+		 .tst_fn = blit_white_G8_to_RGBA8888},
+		{.name = "Blit black G8 to RGB888",
+		 .tst_fn = blit_black_G8_to_RGB888},
+		{.name = "Blit white G8 to RGB888",
+		 .tst_fn = blit_white_G8_to_RGB888},
+		{.name = "Blit black G8 to BGR888",
+		 .tst_fn = blit_black_G8_to_BGR888},
+		{.name = "Blit white G8 to BGR888",
+		 .tst_fn = blit_white_G8_to_BGR888},
+		{.name = "Blit black G8 to RGB555",
+		 .tst_fn = blit_black_G8_to_RGB555},
+		{.name = "Blit white G8 to RGB555",
+		 .tst_fn = blit_white_G8_to_RGB555},
+		{.name = "Blit black G8 to RGB565",
+		 .tst_fn = blit_black_G8_to_RGB565},
+		{.name = "Blit white G8 to RGB565",
+		 .tst_fn = blit_white_G8_to_RGB565},
+		{.name = "Blit black G8 to RGB666",
+		 .tst_fn = blit_black_G8_to_RGB666},
+		{.name = "Blit white G8 to RGB666",
+		 .tst_fn = blit_white_G8_to_RGB666},
+		{.name = "Blit black G8 to RGB332",
+		 .tst_fn = blit_black_G8_to_RGB332},
+		{.name = "Blit white G8 to RGB332",
+		 .tst_fn = blit_white_G8_to_RGB332},
+		{.name = "Blit black G8 to CMYK8888",
+		 .tst_fn = blit_black_G8_to_CMYK8888},
+		{.name = "Blit white G8 to CMYK8888",
+		 .tst_fn = blit_white_G8_to_CMYK8888},
+		{.name = "Blit black G8 to G1",
+		 .tst_fn = blit_black_G8_to_G1},
+		{.name = "Blit white G8 to G1",
+		 .tst_fn = blit_white_G8_to_G1},
+		{.name = "Blit black G8 to G2",
+		 .tst_fn = blit_black_G8_to_G2},
+		{.name = "Blit white G8 to G2",
+		 .tst_fn = blit_white_G8_to_G2},
+		{.name = "Blit black G8 to G4",
+		 .tst_fn = blit_black_G8_to_G4},
+		{.name = "Blit white G8 to G4",
+		 .tst_fn = blit_white_G8_to_G4},
+		{.name = "Blit black G8 to G8",
+		 .tst_fn = blit_black_G8_to_G8},
+		{.name = "Blit white G8 to G8",
+		 .tst_fn = blit_white_G8_to_G8},
+		{.name = "Blit black G8 to GA88",
+		 .tst_fn = blit_black_G8_to_GA88},
+		{.name = "Blit white G8 to GA88",
+		 .tst_fn = blit_white_G8_to_GA88},
+		{.name = "Blit black G8 to G16",
+		 .tst_fn = blit_black_G8_to_G16},
+		{.name = "Blit white G8 to G16",
+		 .tst_fn = blit_white_G8_to_G16},
+		{.name = "Blit black G8 to RGBA8888_PM",
+		 .tst_fn = blit_black_G8_to_RGBA8888_PM},
+		{.name = "Blit white G8 to RGBA8888_PM",
+		 .tst_fn = blit_white_G8_to_RGBA8888_PM},
+		{.name = "Blit black GA88 to xRGB8888",
+		 .tst_fn = blit_black_GA88_to_xRGB8888},
+		{.name = "Blit white GA88 to xRGB8888",
+		 .tst_fn = blit_white_GA88_to_xRGB8888},
+		{.name = "Blit black GA88 to RGBA8888",
+		 .tst_fn = blit_black_GA88_to_RGBA8888},
+		{.name = "Blit white GA88 to RGBA8888",
+		 .tst_fn = blit_white_GA88_to_RGBA8888},
+		{.name = "Blit black GA88 to RGB888",
+		 .tst_fn = blit_black_GA88_to_RGB888},
+		{.name = "Blit white GA88 to RGB888",
+		 .tst_fn = blit_white_GA88_to_RGB888},
+		{.name = "Blit black GA88 to BGR888",
+		 .tst_fn = blit_black_GA88_to_BGR888},
+		{.name = "Blit white GA88 to BGR888",
+		 .tst_fn = blit_white_GA88_to_BGR888},
+		{.name = "Blit black GA88 to RGB555",
+		 .tst_fn = blit_black_GA88_to_RGB555},
+		{.name = "Blit white GA88 to RGB555",
+		 .tst_fn = blit_white_GA88_to_RGB555},
+		{.name = "Blit black GA88 to RGB565",
+		 .tst_fn = blit_black_GA88_to_RGB565},
+		{.name = "Blit white GA88 to RGB565",
+		 .tst_fn = blit_white_GA88_to_RGB565},
+		{.name = "Blit black GA88 to RGB666",
+		 .tst_fn = blit_black_GA88_to_RGB666},
+		{.name = "Blit white GA88 to RGB666",
+		 .tst_fn = blit_white_GA88_to_RGB666},
+		{.name = "Blit black GA88 to RGB332",
+		 .tst_fn = blit_black_GA88_to_RGB332},
+		{.name = "Blit white GA88 to RGB332",
+		 .tst_fn = blit_white_GA88_to_RGB332},
+		{.name = "Blit black GA88 to CMYK8888",
+		 .tst_fn = blit_black_GA88_to_CMYK8888},
+		{.name = "Blit white GA88 to CMYK8888",
+		 .tst_fn = blit_white_GA88_to_CMYK8888},
+		{.name = "Blit black GA88 to G1",
+		 .tst_fn = blit_black_GA88_to_G1},
+		{.name = "Blit white GA88 to G1",
+		 .tst_fn = blit_white_GA88_to_G1},
+		{.name = "Blit black GA88 to G2",
+		 .tst_fn = blit_black_GA88_to_G2},
+		{.name = "Blit white GA88 to G2",
+		 .tst_fn = blit_white_GA88_to_G2},
+		{.name = "Blit black GA88 to G4",
+		 .tst_fn = blit_black_GA88_to_G4},
+		{.name = "Blit white GA88 to G4",
+		 .tst_fn = blit_white_GA88_to_G4},
+		{.name = "Blit black GA88 to G8",
+		 .tst_fn = blit_black_GA88_to_G8},
+		{.name = "Blit white GA88 to G8",
+		 .tst_fn = blit_white_GA88_to_G8},
+		{.name = "Blit black GA88 to GA88",
+		 .tst_fn = blit_black_GA88_to_GA88},
+		{.name = "Blit white GA88 to GA88",
+		 .tst_fn = blit_white_GA88_to_GA88},
+		{.name = "Blit black GA88 to G16",
+		 .tst_fn = blit_black_GA88_to_G16},
+		{.name = "Blit white GA88 to G16",
+		 .tst_fn = blit_white_GA88_to_G16},
+		{.name = "Blit black GA88 to RGBA8888_PM",
+		 .tst_fn = blit_black_GA88_to_RGBA8888_PM},
+		{.name = "Blit white GA88 to RGBA8888_PM",
+		 .tst_fn = blit_white_GA88_to_RGBA8888_PM},
+		{.name = "Blit black G16 to xRGB8888",
+		 .tst_fn = blit_black_G16_to_xRGB8888},
+		{.name = "Blit white G16 to xRGB8888",
+		 .tst_fn = blit_white_G16_to_xRGB8888},
+		{.name = "Blit black G16 to RGBA8888",
+		 .tst_fn = blit_black_G16_to_RGBA8888},
+		{.name = "Blit white G16 to RGBA8888",
+		 .tst_fn = blit_white_G16_to_RGBA8888},
+		{.name = "Blit black G16 to RGB888",
+		 .tst_fn = blit_black_G16_to_RGB888},
+		{.name = "Blit white G16 to RGB888",
+		 .tst_fn = blit_white_G16_to_RGB888},
+		{.name = "Blit black G16 to BGR888",
+		 .tst_fn = blit_black_G16_to_BGR888},
+		{.name = "Blit white G16 to BGR888",
+		 .tst_fn = blit_white_G16_to_BGR888},
+		{.name = "Blit black G16 to RGB555",
+		 .tst_fn = blit_black_G16_to_RGB555},
+		{.name = "Blit white G16 to RGB555",
+		 .tst_fn = blit_white_G16_to_RGB555},
+		{.name = "Blit black G16 to RGB565",
+		 .tst_fn = blit_black_G16_to_RGB565},
+		{.name = "Blit white G16 to RGB565",
+		 .tst_fn = blit_white_G16_to_RGB565},
+		{.name = "Blit black G16 to RGB666",
+		 .tst_fn = blit_black_G16_to_RGB666},
+		{.name = "Blit white G16 to RGB666",
+		 .tst_fn = blit_white_G16_to_RGB666},
+		{.name = "Blit black G16 to RGB332",
+		 .tst_fn = blit_black_G16_to_RGB332},
+		{.name = "Blit white G16 to RGB332",
+		 .tst_fn = blit_white_G16_to_RGB332},
+		{.name = "Blit black G16 to CMYK8888",
+		 .tst_fn = blit_black_G16_to_CMYK8888},
+		{.name = "Blit white G16 to CMYK8888",
+		 .tst_fn = blit_white_G16_to_CMYK8888},
+		{.name = "Blit black G16 to G1",
+		 .tst_fn = blit_black_G16_to_G1},
+		{.name = "Blit white G16 to G1",
+		 .tst_fn = blit_white_G16_to_G1},
+		{.name = "Blit black G16 to G2",
+		 .tst_fn = blit_black_G16_to_G2},
+		{.name = "Blit white G16 to G2",
+		 .tst_fn = blit_white_G16_to_G2},
+		{.name = "Blit black G16 to G4",
+		 .tst_fn = blit_black_G16_to_G4},
+		{.name = "Blit white G16 to G4",
+		 .tst_fn = blit_white_G16_to_G4},
+		{.name = "Blit black G16 to G8",
+		 .tst_fn = blit_black_G16_to_G8},
+		{.name = "Blit white G16 to G8",
+		 .tst_fn = blit_white_G16_to_G8},
+		{.name = "Blit black G16 to GA88",
+		 .tst_fn = blit_black_G16_to_GA88},
+		{.name = "Blit white G16 to GA88",
+		 .tst_fn = blit_white_G16_to_GA88},
+		{.name = "Blit black G16 to G16",
+		 .tst_fn = blit_black_G16_to_G16},
+		{.name = "Blit white G16 to G16",
+		 .tst_fn = blit_white_G16_to_G16},
+		{.name = "Blit black G16 to RGBA8888_PM",
+		 .tst_fn = blit_black_G16_to_RGBA8888_PM},
+		{.name = "Blit white G16 to RGBA8888_PM",
+		 .tst_fn = blit_white_G16_to_RGBA8888_PM},
+		{.name = "Blit black RGBA8888_PM to xRGB8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_xRGB8888},
+		{.name = "Blit white RGBA8888_PM to xRGB8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_xRGB8888},
+		{.name = "Blit black RGBA8888_PM to RGBA8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGBA8888},
+		{.name = "Blit white RGBA8888_PM to RGBA8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGBA8888},
+		{.name = "Blit black RGBA8888_PM to RGB888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB888},
+		{.name = "Blit white RGBA8888_PM to RGB888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB888},
+		{.name = "Blit black RGBA8888_PM to BGR888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_BGR888},
+		{.name = "Blit white RGBA8888_PM to BGR888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_BGR888},
+		{.name = "Blit black RGBA8888_PM to RGB555",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB555},
+		{.name = "Blit white RGBA8888_PM to RGB555",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB555},
+		{.name = "Blit black RGBA8888_PM to RGB565",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB565},
+		{.name = "Blit white RGBA8888_PM to RGB565",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB565},
+		{.name = "Blit black RGBA8888_PM to RGB666",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB666},
+		{.name = "Blit white RGBA8888_PM to RGB666",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB666},
+		{.name = "Blit black RGBA8888_PM to RGB332",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGB332},
+		{.name = "Blit white RGBA8888_PM to RGB332",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGB332},
+		{.name = "Blit black RGBA8888_PM to CMYK8888",
+		 .tst_fn = blit_black_RGBA8888_PM_to_CMYK8888},
+		{.name = "Blit white RGBA8888_PM to CMYK8888",
+		 .tst_fn = blit_white_RGBA8888_PM_to_CMYK8888},
+		{.name = "Blit black RGBA8888_PM to G1",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G1},
+		{.name = "Blit white RGBA8888_PM to G1",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G1},
+		{.name = "Blit black RGBA8888_PM to G2",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G2},
+		{.name = "Blit white RGBA8888_PM to G2",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G2},
+		{.name = "Blit black RGBA8888_PM to G4",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G4},
+		{.name = "Blit white RGBA8888_PM to G4",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G4},
+		{.name = "Blit black RGBA8888_PM to G8",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G8},
+		{.name = "Blit white RGBA8888_PM to G8",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G8},
+		{.name = "Blit black RGBA8888_PM to GA88",
+		 .tst_fn = blit_black_RGBA8888_PM_to_GA88},
+		{.name = "Blit white RGBA8888_PM to GA88",
+		 .tst_fn = blit_white_RGBA8888_PM_to_GA88},
+		{.name = "Blit black RGBA8888_PM to G16",
+		 .tst_fn = blit_black_RGBA8888_PM_to_G16},
+		{.name = "Blit white RGBA8888_PM to G16",
+		 .tst_fn = blit_white_RGBA8888_PM_to_G16},
+		{.name = "Blit black RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_black_RGBA8888_PM_to_RGBA8888_PM},
+		{.name = "Blit white RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_white_RGBA8888_PM_to_RGBA8888_PM},
+		{.name = "Blit xRGB8888 to xRGB8888",
+		 .tst_fn = blit_equal_pixel_xRGB8888_to_xRGB8888},
+		{.name = "Blit RGBA8888 to RGBA8888",
+		 .tst_fn = blit_equal_pixel_RGBA8888_to_RGBA8888},
+		{.name = "Blit RGB888 to RGB888",
+		 .tst_fn = blit_equal_pixel_RGB888_to_RGB888},
+		{.name = "Blit BGR888 to BGR888",
+		 .tst_fn = blit_equal_pixel_BGR888_to_BGR888},
+		{.name = "Blit RGB555 to RGB555",
+		 .tst_fn = blit_equal_pixel_RGB555_to_RGB555},
+		{.name = "Blit RGB565 to RGB565",
+		 .tst_fn = blit_equal_pixel_RGB565_to_RGB565},
+		{.name = "Blit RGB666 to RGB666",
+		 .tst_fn = blit_equal_pixel_RGB666_to_RGB666},
+		{.name = "Blit RGB332 to RGB332",
+		 .tst_fn = blit_equal_pixel_RGB332_to_RGB332},
+		{.name = "Blit CMYK8888 to CMYK8888",
+		 .tst_fn = blit_equal_pixel_CMYK8888_to_CMYK8888},
+		{.name = "Blit G1 to G1",
+		 .tst_fn = blit_equal_pixel_G1_to_G1},
+		{.name = "Blit G2 to G2",
+		 .tst_fn = blit_equal_pixel_G2_to_G2},
+		{.name = "Blit G4 to G4",
+		 .tst_fn = blit_equal_pixel_G4_to_G4},
+		{.name = "Blit G8 to G8",
+		 .tst_fn = blit_equal_pixel_G8_to_G8},
+		{.name = "Blit GA88 to GA88",
+		 .tst_fn = blit_equal_pixel_GA88_to_GA88},
+		{.name = "Blit G16 to G16",
+		 .tst_fn = blit_equal_pixel_G16_to_G16},
+		{.name = "Blit RGBA8888_PM to RGBA8888_PM",
+		 .tst_fn = blit_equal_pixel_RGBA8888_PM_to_RGBA8888_PM},
+
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_red_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_green_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_blue_RGB888_to_CMYK8888},
+		{.name = "Blit RGB888 to CMYK8888",
+		 .tst_fn = blit_gray_RGB888_to_CMYK8888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_red_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_green_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_blue_CMYK8888_to_RGB888},
+		{.name = "Blit CMYK8888 to RGB888",
+		 .tst_fn = blit_gray_CMYK8888_to_RGB888},
+		{.name = "Blit random RGB888 to xRGB8888",
+		 .tst_fn = blit_rand_RGB888_to_xRGB8888},
+		{.name = "Blit random BGR888 to xRGB8888",
+		 .tst_fn = blit_rand_BGR888_to_xRGB8888},
+		{.name = "Blit random xRGB8888 to RGB565",
+		 .tst_fn = blit_rand_xRGB8888_to_RGB565},
+		{.name = "Blit random RGB888 to RGB565",
+		 .tst_fn = blit_rand_RGB888_to_RGB565},
+		{.name = "Blit alpha RGBA8888 to xRGB8888",
+		 .tst_fn = blit_alpha_RGBA8888_to_xRGB8888},
+		{.name = "Blit alpha RGBA8888_PM to xRGB8888",
+		 .tst_fn = blit_alpha_RGBA8888_PM_to_xRGB8888},
+		{.name = "Blit alpha RGBA8888 to RGB888",
+		 .tst_fn = blit_alpha_RGBA8888_to_RGB888},
+		{.name = "Blit alpha RGBA8888_PM to RGB888",
+		 .tst_fn = blit_alpha_RGBA8888_PM_to_RGB888},
+		{.name = "Blit alpha RGBA8888_PM to RGB565",
+		 .tst_fn = blit_alpha_RGBA8888_PM_to_RGB565},
+
+		{.name = NULL}
+	}
+};
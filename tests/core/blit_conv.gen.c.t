@@ -11,6 +11,7 @@
 #include <core/gp_convert.h>
 #include <core/gp_get_put_pixel.h>
 #include <core/gp_blit.h>
+#include <core/gp_mix_pixels2.gen.h>
 
 #include "tst_test.h"
 
@@ -124,6 +125,135 @@ static int blit_{{ name }}_{{ pt1.name }}_to_{{ pt2.name }}(void)
 {@ gen_blit2('blue', '0x00', '0x00', '0xff', 'CMYK8888', 'RGB888') @}
 {@ gen_blit2('gray', '0xef', '0xef', '0xef', 'CMYK8888', 'RGB888') @}
 
+/*
+ * Blits a part of a pixmap filled with pseudo random data and compares it
+ * against pixel by pixel conversion, covers the optimized row converters.
+ */
+@ def gen_blit_rand(pt1, pt2):
+static int blit_rand_{{ pt1.name }}_to_{{ pt2.name }}(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_{{ pt1.name }});
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_{{ pt2.name }});
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src == NULL || dst == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_convert_pixmap_pixel(ps, src, dst);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x converted to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+@ end
+
+@ rand_pairs = [('RGB888', 'xRGB8888'), ('BGR888', 'xRGB8888'), ('xRGB8888', 'RGB565'), ('RGB888', 'RGB565')]
+@ for (p1, p2) in rand_pairs:
+{@ gen_blit_rand(pixeltypes_dict[p1], pixeltypes_dict[p2]) @}
+@ end
+
+/*
+ * Blits a pixmap with alpha channel over pseudo random data, the source has
+ * transparent and opaque spans, and compares it against pixel by pixel mix.
+ */
+@ def gen_blit_alpha(pt1, pt2):
+static int blit_alpha_{{ pt1.name }}_to_{{ pt2.name }}(void)
+{
+	gp_pixmap *src = gp_pixmap_alloc(77, 33, GP_PIXEL_{{ pt1.name }});
+	gp_pixmap *dst = gp_pixmap_alloc(77, 33, GP_PIXEL_{{ pt2.name }});
+	gp_pixmap *ref = NULL;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	if (src)
+		ref = gp_pixmap_alloc(77, 33, GP_PIXEL_{{ pt2.name }});
+
+	if (src == NULL || dst == NULL || ref == NULL) {
+		gp_pixmap_free(src);
+		gp_pixmap_free(dst);
+		gp_pixmap_free(ref);
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	mess_pixmap(src);
+	mess_pixmap(dst);
+	mess_pixmap(ref);
+
+	for (y = 0; y < 33; y++) {
+		for (x = 11 + y % 5; x < 50 - y % 7; x++) {
+			gp_pixel p = gp_getpixel_raw(src, x, y);
+
+			if (y % 2)
+				p = 0;
+			else
+				p |= {{ pt1.chans['A'].C_mask }};
+
+			gp_putpixel_raw(src, x, y, p);
+		}
+	}
+
+	gp_blit(src, 3, 1, 71, 31, dst, 5, 2);
+
+	for (y = 0; y < 31; y++) {
+		for (x = 0; x < 71; x++) {
+			gp_pixel ps = gp_getpixel(src, 3 + x, 1 + y);
+			gp_pixel pd = gp_getpixel(dst, 5 + x, 2 + y);
+			gp_pixel exp = gp_getpixel(ref, 5 + x, 2 + y);
+
+@     if pt1.is_premultiplied():
+			if (ps)
+@     else:
+			if (GP_PIXEL_GET_A_{{ pt1.name }}(ps))
+@     end
+				exp = gp_mix_pixels_{{ pt1.name }}_{{ pt2.name }}(ps, exp);
+
+			if (pd != exp) {
+				tst_msg("Pixel %ix%i %08x blended to %08x expected %08x",
+				        x, y, ps, pd, exp);
+				ret = TST_FAILED;
+				goto exit;
+			}
+		}
+	}
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+@ end
+
+@ alpha_pairs = [('RGBA8888', 'xRGB8888'), ('RGBA8888_PM', 'xRGB8888'), ('RGBA8888', 'RGB888'), ('RGBA8888_PM', 'RGB888'), ('RGBA8888_PM', 'RGB565')]
+@ for (p1, p2) in alpha_pairs:
+{@ gen_blit_alpha(pixeltypes_dict[p1], pixeltypes_dict[p2]) @}
+@ end
+
 @ def gen_suite_entry(name, p_from, p_to):
 		{.name = "Blit {{ p_from }} to {{ p_to }}",
 		 .tst_fn = blit_{{ name }}_{{ p_from }}_to_{{ p_to }}},
@@ -154,6 +284,14 @@ const struct tst_suite tst_suite = {
 {@ gen_suite_entry('green', 'CMYK8888', 'RGB888') @}
 {@ gen_suite_entry('blue', 'CMYK8888', 'RGB888') @}
 {@ gen_suite_entry('gray', 'CMYK8888', 'RGB888') @}
+@ for (p1, p2) in rand_pairs:
+		{.name = "Blit random {{ p1 }} to {{ p2 }}",
+		 .tst_fn = blit_rand_{{ p1 }}_to_{{ p2 }}},
+@ end
+@ for (p1, p2) in alpha_pairs:
+		{.name = "Blit alpha {{ p1 }} to {{ p2 }}",
+		 .tst_fn = blit_alpha_{{ p1 }}_to_{{ p2 }}},
+@ end
 
 		{.name = NULL}
 	}
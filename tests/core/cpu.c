@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <core/gp_cpu.h>
+#include "tst_test.h"
+
+static int simd_none(void)
+{
+	setenv("GP_SIMD", "none", 1);
+
+	if (gp_cpu_flags()) {
+		tst_msg("GP_SIMD=none flags = 0x%02x", gp_cpu_flags());
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int simd_list(void)
+{
+	unsigned int flags;
+
+	setenv("GP_SIMD", "sse2,neon,invalid", 1);
+
+	flags = gp_cpu_flags();
+
+	if (flags & ~(GP_CPU_SSE2 | GP_CPU_NEON)) {
+		tst_msg("GP_SIMD=sse2,neon flags = 0x%02x", flags);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int fn_generic, fn_avx2, fn_all;
+
+static const gp_cpu_impl impls[] = {
+	{GP_CPU_SSE2 | GP_CPU_SSE41 | GP_CPU_AVX2 | GP_CPU_NEON, &fn_all},
+	{GP_CPU_AVX2, &fn_avx2},
+	{0, &fn_generic},
+};
+
+static int select_impl(void)
+{
+	unsigned int flags = gp_cpu_flags();
+	void *fn = gp_cpu_select("test", impls);
+	void *exp = &fn_generic;
+
+	if (flags & GP_CPU_AVX2)
+		exp = &fn_avx2;
+
+	if (fn != exp) {
+		tst_msg("Wrong implementation selected for flags 0x%02x", flags);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int select_none(void)
+{
+	setenv("GP_SIMD", "0", 1);
+
+	if (gp_cpu_select("test", impls) != &fn_generic) {
+		tst_msg("GP_SIMD=0 selected SIMD implementation");
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int flag_names(void)
+{
+	if (strcmp(gp_cpu_flag_name(GP_CPU_AVX2), "avx2") ||
+	    strcmp(gp_cpu_flag_name(GP_CPU_SSE41), "sse4.1")) {
+		tst_msg("Wrong flag name");
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "cpu testsuite",
+	.tests = {
+		{.name = "GP_SIMD=none",
+		 .tst_fn = simd_none},
+
+		{.name = "GP_SIMD flags list",
+		 .tst_fn = simd_list},
+
+		{.name = "select implementation",
+		 .tst_fn = select_impl},
+
+		{.name = "select GP_SIMD=0",
+		 .tst_fn = select_none},
+
+		{.name = "flag names",
+		 .tst_fn = flag_names},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,31186 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * get_set_bits.gen.c
+ *
+ * GENERATED on 2026 10 18 07:52:42 from get_set_bits.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * GP_GET_BITS() and GP_SET_BITS() tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdlib.h>
+#include <stdint.h>
+#include "core/gp_common.h"
+#include <core/gp_get_set_bits.h>
+#include "tst_test.h"
+
+static const uint32_t patterns[] = {
+	0x00000000,
+	0xffffffff,
+	0x55555555,
+	0xaaaaaaaa,
+	0x43f8af32,
+};
+
+static int getbits_0_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 1, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 1, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 1, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 1, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 1, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 1, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 1, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 1, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 1, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 1, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 1, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 1, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 1, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 1, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 1, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 1, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 1, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 1, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 1, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 1, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 1, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 1, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 1, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 1, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 1, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 1, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 1, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_27_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(27, 1, patterns[i]);
+		p_exp = (patterns[i] >> 27) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_28_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(28, 1, patterns[i]);
+		p_exp = (patterns[i] >> 28) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_29_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(29, 1, patterns[i]);
+		p_exp = (patterns[i] >> 29) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_30_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(30, 1, patterns[i]);
+		p_exp = (patterns[i] >> 30) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_31_1(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(31, 1, patterns[i]);
+		p_exp = (patterns[i] >> 31) & 0x1;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 2, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 2, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 2, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 2, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 2, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 2, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 2, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 2, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 2, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 2, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 2, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 2, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 2, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 2, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 2, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 2, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 2, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 2, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 2, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 2, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 2, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 2, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 2, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 2, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 2, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 2, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 2, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_27_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(27, 2, patterns[i]);
+		p_exp = (patterns[i] >> 27) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_28_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(28, 2, patterns[i]);
+		p_exp = (patterns[i] >> 28) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_29_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(29, 2, patterns[i]);
+		p_exp = (patterns[i] >> 29) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_30_2(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(30, 2, patterns[i]);
+		p_exp = (patterns[i] >> 30) & 0x3;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 3, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 3, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 3, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 3, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 3, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 3, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 3, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 3, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 3, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 3, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 3, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 3, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 3, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 3, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 3, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 3, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 3, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 3, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 3, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 3, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 3, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 3, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 3, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 3, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 3, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 3, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 3, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_27_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(27, 3, patterns[i]);
+		p_exp = (patterns[i] >> 27) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_28_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(28, 3, patterns[i]);
+		p_exp = (patterns[i] >> 28) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_29_3(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(29, 3, patterns[i]);
+		p_exp = (patterns[i] >> 29) & 0x7;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 4, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 4, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 4, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 4, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 4, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 4, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 4, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 4, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 4, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 4, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 4, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 4, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 4, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 4, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 4, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 4, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 4, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 4, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 4, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 4, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 4, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 4, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 4, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 4, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 4, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 4, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 4, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_27_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(27, 4, patterns[i]);
+		p_exp = (patterns[i] >> 27) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_28_4(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(28, 4, patterns[i]);
+		p_exp = (patterns[i] >> 28) & 0xf;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 5, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 5, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 5, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 5, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 5, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 5, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 5, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 5, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 5, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 5, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 5, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 5, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 5, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 5, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 5, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 5, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 5, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 5, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 5, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 5, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 5, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 5, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 5, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 5, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 5, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 5, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 5, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_27_5(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(27, 5, patterns[i]);
+		p_exp = (patterns[i] >> 27) & 0x1f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 6, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 6, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 6, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 6, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 6, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 6, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 6, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 6, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 6, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 6, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 6, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 6, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 6, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 6, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 6, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 6, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 6, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 6, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 6, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 6, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 6, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 6, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 6, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 6, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 6, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 6, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_26_6(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(26, 6, patterns[i]);
+		p_exp = (patterns[i] >> 26) & 0x3f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 7, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 7, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 7, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 7, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 7, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 7, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 7, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 7, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 7, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 7, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 7, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 7, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 7, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 7, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 7, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 7, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 7, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 7, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 7, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 7, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 7, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 7, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 7, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 7, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 7, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_25_7(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(25, 7, patterns[i]);
+		p_exp = (patterns[i] >> 25) & 0x7f;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 8, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 8, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 8, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 8, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 8, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 8, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 8, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 8, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 8, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 8, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 8, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 8, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 8, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 8, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 8, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 8, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 8, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 8, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 8, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 8, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 8, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 8, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 8, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 8, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_24_8(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(24, 8, patterns[i]);
+		p_exp = (patterns[i] >> 24) & 0xff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 9, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 9, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 9, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 9, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 9, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 9, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 9, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 9, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 9, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 9, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 9, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 9, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 9, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 9, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 9, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 9, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 9, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 9, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 9, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 9, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 9, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 9, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 9, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_23_9(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(23, 9, patterns[i]);
+		p_exp = (patterns[i] >> 23) & 0x1ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 10, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 10, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 10, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 10, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 10, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 10, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 10, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 10, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 10, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 10, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 10, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 10, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 10, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 10, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 10, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 10, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 10, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 10, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 10, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 10, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 10, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 10, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_22_10(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(22, 10, patterns[i]);
+		p_exp = (patterns[i] >> 22) & 0x3ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 11, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 11, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 11, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 11, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 11, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 11, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 11, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 11, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 11, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 11, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 11, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 11, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 11, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 11, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 11, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 11, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 11, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 11, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 11, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 11, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 11, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_21_11(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(21, 11, patterns[i]);
+		p_exp = (patterns[i] >> 21) & 0x7ff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 12, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 12, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 12, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 12, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 12, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 12, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 12, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 12, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 12, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 12, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 12, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 12, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 12, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 12, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 12, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 12, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 12, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 12, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 12, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 12, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_20_12(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(20, 12, patterns[i]);
+		p_exp = (patterns[i] >> 20) & 0xfff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 13, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 13, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 13, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 13, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 13, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 13, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 13, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 13, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 13, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 13, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 13, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 13, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 13, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 13, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 13, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 13, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 13, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 13, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 13, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_19_13(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(19, 13, patterns[i]);
+		p_exp = (patterns[i] >> 19) & 0x1fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 14, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 14, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 14, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 14, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 14, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 14, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 14, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 14, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 14, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 14, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 14, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 14, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 14, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 14, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 14, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 14, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 14, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 14, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_18_14(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(18, 14, patterns[i]);
+		p_exp = (patterns[i] >> 18) & 0x3fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 15, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 15, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 15, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 15, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 15, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 15, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 15, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 15, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 15, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 15, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 15, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 15, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 15, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 15, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 15, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 15, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 15, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_17_15(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(17, 15, patterns[i]);
+		p_exp = (patterns[i] >> 17) & 0x7fff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 16, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 16, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 16, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 16, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 16, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 16, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 16, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 16, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 16, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 16, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 16, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 16, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 16, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 16, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 16, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 16, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_16_16(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(16, 16, patterns[i]);
+		p_exp = (patterns[i] >> 16) & 0xffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 17, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 17, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 17, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 17, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 17, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 17, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 17, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 17, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 17, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 17, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 17, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 17, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 17, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 17, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 17, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_15_17(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(15, 17, patterns[i]);
+		p_exp = (patterns[i] >> 15) & 0x1ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 18, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 18, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 18, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 18, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 18, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 18, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 18, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 18, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 18, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 18, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 18, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 18, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 18, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 18, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_14_18(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(14, 18, patterns[i]);
+		p_exp = (patterns[i] >> 14) & 0x3ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 19, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 19, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 19, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 19, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 19, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 19, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 19, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 19, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 19, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 19, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 19, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 19, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 19, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_13_19(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(13, 19, patterns[i]);
+		p_exp = (patterns[i] >> 13) & 0x7ffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 20, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 20, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 20, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 20, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 20, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 20, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 20, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 20, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 20, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 20, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 20, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 20, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_12_20(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(12, 20, patterns[i]);
+		p_exp = (patterns[i] >> 12) & 0xfffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 21, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 21, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 21, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 21, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 21, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 21, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 21, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 21, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 21, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 21, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 21, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_11_21(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(11, 21, patterns[i]);
+		p_exp = (patterns[i] >> 11) & 0x1fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 22, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 22, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 22, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 22, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 22, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 22, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 22, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 22, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 22, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 22, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_10_22(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(10, 22, patterns[i]);
+		p_exp = (patterns[i] >> 10) & 0x3fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 23, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 23, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 23, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 23, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 23, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 23, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 23, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 23, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 23, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_9_23(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(9, 23, patterns[i]);
+		p_exp = (patterns[i] >> 9) & 0x7fffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 24, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 24, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 24, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 24, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 24, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 24, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 24, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 24, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_8_24(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(8, 24, patterns[i]);
+		p_exp = (patterns[i] >> 8) & 0xffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 25, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 25, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 25, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 25, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 25, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 25, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 25, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_7_25(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(7, 25, patterns[i]);
+		p_exp = (patterns[i] >> 7) & 0x1ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 26, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 26, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 26, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 26, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 26, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 26, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_6_26(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(6, 26, patterns[i]);
+		p_exp = (patterns[i] >> 6) & 0x3ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 27, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 27, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 27, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 27, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 27, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_5_27(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(5, 27, patterns[i]);
+		p_exp = (patterns[i] >> 5) & 0x7ffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_28(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 28, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xfffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_28(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 28, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0xfffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_28(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 28, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0xfffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_28(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 28, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0xfffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_4_28(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(4, 28, patterns[i]);
+		p_exp = (patterns[i] >> 4) & 0xfffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_29(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 29, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x1fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_29(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 29, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x1fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_29(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 29, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x1fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_3_29(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(3, 29, patterns[i]);
+		p_exp = (patterns[i] >> 3) & 0x1fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_30(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 30, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x3fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_30(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 30, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x3fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_2_30(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(2, 30, patterns[i]);
+		p_exp = (patterns[i] >> 2) & 0x3fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_31(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 31, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0x7fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_1_31(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(1, 31, patterns[i]);
+		p_exp = (patterns[i] >> 1) & 0x7fffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int getbits_0_32(void)
+{
+	uint32_t p_exp, p_get;
+	unsigned int i, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		p_get = GP_GET_BITS(0, 32, patterns[i]);
+		p_exp = (patterns[i] >> 0) & 0xffffffff;
+
+		if (p_get != p_exp) {
+			tst_msg("Pattern 0x%08x differs get 0x%08x, expected 0x%08x",
+			        patterns[i], p_get, p_exp);
+			fail++;
+		} else {
+			tst_msg("Pattern 0x%08x have 0x%08x", patterns[i], p_get);
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x1;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x2;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x4;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x10;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x20;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x40;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x100;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x200;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x400;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x1000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x2000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x4000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x10000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x20000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x40000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x100000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x200000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x400000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x1000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x2000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x4000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_27_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(27, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x8000000;
+			p_exp |= val<<27;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_28_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(28, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x10000000;
+			p_exp |= val<<28;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_29_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(29, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x20000000;
+			p_exp |= val<<29;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_30_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(30, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x40000000;
+			p_exp |= val<<30;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_31_1(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(31, 1, p_get, val);
+
+			p_exp = patterns[i] & ~0x80000000;
+			p_exp |= val<<31;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x3;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x6;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x18;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x30;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x60;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x180;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x300;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x600;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x1800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x3000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x6000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x18000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x30000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x60000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x180000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x300000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x600000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x1800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x3000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x6000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_27_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(27, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x18000000;
+			p_exp |= val<<27;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_28_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(28, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x30000000;
+			p_exp |= val<<28;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_29_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(29, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0x60000000;
+			p_exp |= val<<29;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_30_2(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(30, 2, p_get, val);
+
+			p_exp = patterns[i] & ~0xc0000000;
+			p_exp |= val<<30;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x7;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x38;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x70;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x380;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x700;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x3800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x7000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x38000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x70000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x380000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x700000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x3800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x7000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x1c000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_27_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(27, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x38000000;
+			p_exp |= val<<27;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_28_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(28, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0x70000000;
+			p_exp |= val<<28;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_29_3(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(29, 3, p_get, val);
+
+			p_exp = patterns[i] & ~0xe0000000;
+			p_exp |= val<<29;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x78;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x780;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x7800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x78000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x780000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x7800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x1e000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x3c000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_27_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(27, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0x78000000;
+			p_exp |= val<<27;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_28_4(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xf;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(28, 4, p_get, val);
+
+			p_exp = patterns[i] & ~0xf0000000;
+			p_exp |= val<<28;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x3e000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0x7c000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_27_5(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(27, 5, p_get, val);
+
+			p_exp = patterns[i] & ~0xf8000000;
+			p_exp |= val<<27;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x1f800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0x7e000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_26_6(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(26, 6, p_get, val);
+
+			p_exp = patterns[i] & ~0xfc000000;
+			p_exp |= val<<26;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x3f800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_25_7(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7f;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(25, 7, p_get, val);
+
+			p_exp = patterns[i] & ~0xfe000000;
+			p_exp |= val<<25;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0x7f800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_24_8(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(24, 8, p_get, val);
+
+			p_exp = patterns[i] & ~0xff000000;
+			p_exp |= val<<24;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_23_9(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(23, 9, p_get, val);
+
+			p_exp = patterns[i] & ~0xff800000;
+			p_exp |= val<<23;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ff80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_22_10(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(22, 10, p_get, val);
+
+			p_exp = patterns[i] & ~0xffc00000;
+			p_exp |= val<<22;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ff80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_21_11(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(21, 11, p_get, val);
+
+			p_exp = patterns[i] & ~0xffe00000;
+			p_exp |= val<<21;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ff80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_20_12(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(20, 12, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff00000;
+			p_exp |= val<<20;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_19_13(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(19, 13, p_get, val);
+
+			p_exp = patterns[i] & ~0xfff80000;
+			p_exp |= val<<19;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_18_14(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(18, 14, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffc0000;
+			p_exp |= val<<18;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_17_15(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(17, 15, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffe0000;
+			p_exp |= val<<17;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_16_16(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(16, 16, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff0000;
+			p_exp |= val<<16;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_15_17(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(15, 17, p_get, val);
+
+			p_exp = patterns[i] & ~0xffff8000;
+			p_exp |= val<<15;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_14_18(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(14, 18, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffc000;
+			p_exp |= val<<14;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_13_19(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(13, 19, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffe000;
+			p_exp |= val<<13;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_12_20(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(12, 20, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff000;
+			p_exp |= val<<12;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_11_21(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(11, 21, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffff800;
+			p_exp |= val<<11;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_10_22(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(10, 22, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffc00;
+			p_exp |= val<<10;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_9_23(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(9, 23, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffe00;
+			p_exp |= val<<9;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_8_24(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(8, 24, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffff00;
+			p_exp |= val<<8;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_7_25(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(7, 25, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffff80;
+			p_exp |= val<<7;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_6_26(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(6, 26, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffffc0;
+			p_exp |= val<<6;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_5_27(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7ffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(5, 27, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffffe0;
+			p_exp |= val<<5;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_28(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 28, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_28(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 28, p_get, val);
+
+			p_exp = patterns[i] & ~0x1ffffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_28(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 28, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_28(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 28, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_4_28(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xfffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(4, 28, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffff0;
+			p_exp |= val<<4;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_29(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 29, p_get, val);
+
+			p_exp = patterns[i] & ~0x1fffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_29(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 29, p_get, val);
+
+			p_exp = patterns[i] & ~0x3ffffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_29(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 29, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_3_29(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x1fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(3, 29, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffff8;
+			p_exp |= val<<3;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_30(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 30, p_get, val);
+
+			p_exp = patterns[i] & ~0x3fffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_30(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 30, p_get, val);
+
+			p_exp = patterns[i] & ~0x7ffffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_2_30(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x3fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(2, 30, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffffc;
+			p_exp |= val<<2;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_31(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 31, p_get, val);
+
+			p_exp = patterns[i] & ~0x7fffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_1_31(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0x7fffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(1, 31, p_get, val);
+
+			p_exp = patterns[i] & ~0xfffffffe;
+			p_exp |= val<<1;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int setbits_0_32(void)
+{
+	uint32_t p_exp, canary1, p_get, canary2, val;
+	unsigned int i, j, fail = 0;
+
+	for (i = 0; i < GP_ARRAY_SIZE(patterns); i++) {
+		for (j = 0; j < GP_ARRAY_SIZE(patterns); j++) {
+			val = patterns[j] & 0xffffffff;
+
+			canary1 = 0;
+			canary2 = 0;
+			p_get = patterns[i];
+			GP_SET_BITS(0, 32, p_get, val);
+
+			p_exp = patterns[i] & ~0xffffffff;
+			p_exp |= val<<0;
+
+			if (p_get != p_exp || canary1 != 0 || canary2 != 0) {
+				tst_msg("BG 0x%08x FG 0x%08x differs get 0x%08x, expected 0x%08x",
+				        patterns[i], val, p_get, p_exp);
+				fail++;
+			}
+		}
+	}
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "GetSetBits testsuite",
+	.tests = {
+		{.name = "GP_GET_BITS off=0 len=1",
+		 .tst_fn = getbits_0_1},
+		{.name = "GP_GET_BITS off=1 len=1",
+		 .tst_fn = getbits_1_1},
+		{.name = "GP_GET_BITS off=2 len=1",
+		 .tst_fn = getbits_2_1},
+		{.name = "GP_GET_BITS off=3 len=1",
+		 .tst_fn = getbits_3_1},
+		{.name = "GP_GET_BITS off=4 len=1",
+		 .tst_fn = getbits_4_1},
+		{.name = "GP_GET_BITS off=5 len=1",
+		 .tst_fn = getbits_5_1},
+		{.name = "GP_GET_BITS off=6 len=1",
+		 .tst_fn = getbits_6_1},
+		{.name = "GP_GET_BITS off=7 len=1",
+		 .tst_fn = getbits_7_1},
+		{.name = "GP_GET_BITS off=8 len=1",
+		 .tst_fn = getbits_8_1},
+		{.name = "GP_GET_BITS off=9 len=1",
+		 .tst_fn = getbits_9_1},
+		{.name = "GP_GET_BITS off=10 len=1",
+		 .tst_fn = getbits_10_1},
+		{.name = "GP_GET_BITS off=11 len=1",
+		 .tst_fn = getbits_11_1},
+		{.name = "GP_GET_BITS off=12 len=1",
+		 .tst_fn = getbits_12_1},
+		{.name = "GP_GET_BITS off=13 len=1",
+		 .tst_fn = getbits_13_1},
+		{.name = "GP_GET_BITS off=14 len=1",
+		 .tst_fn = getbits_14_1},
+		{.name = "GP_GET_BITS off=15 len=1",
+		 .tst_fn = getbits_15_1},
+		{.name = "GP_GET_BITS off=16 len=1",
+		 .tst_fn = getbits_16_1},
+		{.name = "GP_GET_BITS off=17 len=1",
+		 .tst_fn = getbits_17_1},
+		{.name = "GP_GET_BITS off=18 len=1",
+		 .tst_fn = getbits_18_1},
+		{.name = "GP_GET_BITS off=19 len=1",
+		 .tst_fn = getbits_19_1},
+		{.name = "GP_GET_BITS off=20 len=1",
+		 .tst_fn = getbits_20_1},
+		{.name = "GP_GET_BITS off=21 len=1",
+		 .tst_fn = getbits_21_1},
+		{.name = "GP_GET_BITS off=22 len=1",
+		 .tst_fn = getbits_22_1},
+		{.name = "GP_GET_BITS off=23 len=1",
+		 .tst_fn = getbits_23_1},
+		{.name = "GP_GET_BITS off=24 len=1",
+		 .tst_fn = getbits_24_1},
+		{.name = "GP_GET_BITS off=25 len=1",
+		 .tst_fn = getbits_25_1},
+		{.name = "GP_GET_BITS off=26 len=1",
+		 .tst_fn = getbits_26_1},
+		{.name = "GP_GET_BITS off=27 len=1",
+		 .tst_fn = getbits_27_1},
+		{.name = "GP_GET_BITS off=28 len=1",
+		 .tst_fn = getbits_28_1},
+		{.name = "GP_GET_BITS off=29 len=1",
+		 .tst_fn = getbits_29_1},
+		{.name = "GP_GET_BITS off=30 len=1",
+		 .tst_fn = getbits_30_1},
+		{.name = "GP_GET_BITS off=31 len=1",
+		 .tst_fn = getbits_31_1},
+		{.name = "GP_GET_BITS off=0 len=2",
+		 .tst_fn = getbits_0_2},
+		{.name = "GP_GET_BITS off=1 len=2",
+		 .tst_fn = getbits_1_2},
+		{.name = "GP_GET_BITS off=2 len=2",
+		 .tst_fn = getbits_2_2},
+		{.name = "GP_GET_BITS off=3 len=2",
+		 .tst_fn = getbits_3_2},
+		{.name = "GP_GET_BITS off=4 len=2",
+		 .tst_fn = getbits_4_2},
+		{.name = "GP_GET_BITS off=5 len=2",
+		 .tst_fn = getbits_5_2},
+		{.name = "GP_GET_BITS off=6 len=2",
+		 .tst_fn = getbits_6_2},
+		{.name = "GP_GET_BITS off=7 len=2",
+		 .tst_fn = getbits_7_2},
+		{.name = "GP_GET_BITS off=8 len=2",
+		 .tst_fn = getbits_8_2},
+		{.name = "GP_GET_BITS off=9 len=2",
+		 .tst_fn = getbits_9_2},
+		{.name = "GP_GET_BITS off=10 len=2",
+		 .tst_fn = getbits_10_2},
+		{.name = "GP_GET_BITS off=11 len=2",
+		 .tst_fn = getbits_11_2},
+		{.name = "GP_GET_BITS off=12 len=2",
+		 .tst_fn = getbits_12_2},
+		{.name = "GP_GET_BITS off=13 len=2",
+		 .tst_fn = getbits_13_2},
+		{.name = "GP_GET_BITS off=14 len=2",
+		 .tst_fn = getbits_14_2},
+		{.name = "GP_GET_BITS off=15 len=2",
+		 .tst_fn = getbits_15_2},
+		{.name = "GP_GET_BITS off=16 len=2",
+		 .tst_fn = getbits_16_2},
+		{.name = "GP_GET_BITS off=17 len=2",
+		 .tst_fn = getbits_17_2},
+		{.name = "GP_GET_BITS off=18 len=2",
+		 .tst_fn = getbits_18_2},
+		{.name = "GP_GET_BITS off=19 len=2",
+		 .tst_fn = getbits_19_2},
+		{.name = "GP_GET_BITS off=20 len=2",
+		 .tst_fn = getbits_20_2},
+		{.name = "GP_GET_BITS off=21 len=2",
+		 .tst_fn = getbits_21_2},
+		{.name = "GP_GET_BITS off=22 len=2",
+		 .tst_fn = getbits_22_2},
+		{.name = "GP_GET_BITS off=23 len=2",
+		 .tst_fn = getbits_23_2},
+		{.name = "GP_GET_BITS off=24 len=2",
+		 .tst_fn = getbits_24_2},
+		{.name = "GP_GET_BITS off=25 len=2",
+		 .tst_fn = getbits_25_2},
+		{.name = "GP_GET_BITS off=26 len=2",
+		 .tst_fn = getbits_26_2},
+		{.name = "GP_GET_BITS off=27 len=2",
+		 .tst_fn = getbits_27_2},
+		{.name = "GP_GET_BITS off=28 len=2",
+		 .tst_fn = getbits_28_2},
+		{.name = "GP_GET_BITS off=29 len=2",
+		 .tst_fn = getbits_29_2},
+		{.name = "GP_GET_BITS off=30 len=2",
+		 .tst_fn = getbits_30_2},
+		{.name = "GP_GET_BITS off=0 len=3",
+		 .tst_fn = getbits_0_3},
+		{.name = "GP_GET_BITS off=1 len=3",
+		 .tst_fn = getbits_1_3},
+		{.name = "GP_GET_BITS off=2 len=3",
+		 .tst_fn = getbits_2_3},
+		{.name = "GP_GET_BITS off=3 len=3",
+		 .tst_fn = getbits_3_3},
+		{.name = "GP_GET_BITS off=4 len=3",
+		 .tst_fn = getbits_4_3},
+		{.name = "GP_GET_BITS off=5 len=3",
+		 .tst_fn = getbits_5_3},
+		{.name = "GP_GET_BITS off=6 len=3",
+		 .tst_fn = getbits_6_3},
+		{.name = "GP_GET_BITS off=7 len=3",
+		 .tst_fn = getbits_7_3},
+		{.name = "GP_GET_BITS off=8 len=3",
+		 .tst_fn = getbits_8_3},
+		{.name = "GP_GET_BITS off=9 len=3",
+		 .tst_fn = getbits_9_3},
+		{.name = "GP_GET_BITS off=10 len=3",
+		 .tst_fn = getbits_10_3},
+		{.name = "GP_GET_BITS off=11 len=3",
+		 .tst_fn = getbits_11_3},
+		{.name = "GP_GET_BITS off=12 len=3",
+		 .tst_fn = getbits_12_3},
+		{.name = "GP_GET_BITS off=13 len=3",
+		 .tst_fn = getbits_13_3},
+		{.name = "GP_GET_BITS off=14 len=3",
+		 .tst_fn = getbits_14_3},
+		{.name = "GP_GET_BITS off=15 len=3",
+		 .tst_fn = getbits_15_3},
+		{.name = "GP_GET_BITS off=16 len=3",
+		 .tst_fn = getbits_16_3},
+		{.name = "GP_GET_BITS off=17 len=3",
+		 .tst_fn = getbits_17_3},
+		{.name = "GP_GET_BITS off=18 len=3",
+		 .tst_fn = getbits_18_3},
+		{.name = "GP_GET_BITS off=19 len=3",
+		 .tst_fn = getbits_19_3},
+		{.name = "GP_GET_BITS off=20 len=3",
+		 .tst_fn = getbits_20_3},
+		{.name = "GP_GET_BITS off=21 len=3",
+		 .tst_fn = getbits_21_3},
+		{.name = "GP_GET_BITS off=22 len=3",
+		 .tst_fn = getbits_22_3},
+		{.name = "GP_GET_BITS off=23 len=3",
+		 .tst_fn = getbits_23_3},
+		{.name = "GP_GET_BITS off=24 len=3",
+		 .tst_fn = getbits_24_3},
+		{.name = "GP_GET_BITS off=25 len=3",
+		 .tst_fn = getbits_25_3},
+		{.name = "GP_GET_BITS off=26 len=3",
+		 .tst_fn = getbits_26_3},
+		{.name = "GP_GET_BITS off=27 len=3",
+		 .tst_fn = getbits_27_3},
+		{.name = "GP_GET_BITS off=28 len=3",
+		 .tst_fn = getbits_28_3},
+		{.name = "GP_GET_BITS off=29 len=3",
+		 .tst_fn = getbits_29_3},
+		{.name = "GP_GET_BITS off=0 len=4",
+		 .tst_fn = getbits_0_4},
+		{.name = "GP_GET_BITS off=1 len=4",
+		 .tst_fn = getbits_1_4},
+		{.name = "GP_GET_BITS off=2 len=4",
+		 .tst_fn = getbits_2_4},
+		{.name = "GP_GET_BITS off=3 len=4",
+		 .tst_fn = getbits_3_4},
+		{.name = "GP_GET_BITS off=4 len=4",
+		 .tst_fn = getbits_4_4},
+		{.name = "GP_GET_BITS off=5 len=4",
+		 .tst_fn = getbits_5_4},
+		{.name = "GP_GET_BITS off=6 len=4",
+		 .tst_fn = getbits_6_4},
+		{.name = "GP_GET_BITS off=7 len=4",
+		 .tst_fn = getbits_7_4},
+		{.name = "GP_GET_BITS off=8 len=4",
+		 .tst_fn = getbits_8_4},
+		{.name = "GP_GET_BITS off=9 len=4",
+		 .tst_fn = getbits_9_4},
+		{.name = "GP_GET_BITS off=10 len=4",
+		 .tst_fn = getbits_10_4},
+		{.name = "GP_GET_BITS off=11 len=4",
+		 .tst_fn = getbits_11_4},
+		{.name = "GP_GET_BITS off=12 len=4",
+		 .tst_fn = getbits_12_4},
+		{.name = "GP_GET_BITS off=13 len=4",
+		 .tst_fn = getbits_13_4},
+		{.name = "GP_GET_BITS off=14 len=4",
+		 .tst_fn = getbits_14_4},
+		{.name = "GP_GET_BITS off=15 len=4",
+		 .tst_fn = getbits_15_4},
+		{.name = "GP_GET_BITS off=16 len=4",
+		 .tst_fn = getbits_16_4},
+		{.name = "GP_GET_BITS off=17 len=4",
+		 .tst_fn = getbits_17_4},
+		{.name = "GP_GET_BITS off=18 len=4",
+		 .tst_fn = getbits_18_4},
+		{.name = "GP_GET_BITS off=19 len=4",
+		 .tst_fn = getbits_19_4},
+		{.name = "GP_GET_BITS off=20 len=4",
+		 .tst_fn = getbits_20_4},
+		{.name = "GP_GET_BITS off=21 len=4",
+		 .tst_fn = getbits_21_4},
+		{.name = "GP_GET_BITS off=22 len=4",
+		 .tst_fn = getbits_22_4},
+		{.name = "GP_GET_BITS off=23 len=4",
+		 .tst_fn = getbits_23_4},
+		{.name = "GP_GET_BITS off=24 len=4",
+		 .tst_fn = getbits_24_4},
+		{.name = "GP_GET_BITS off=25 len=4",
+		 .tst_fn = getbits_25_4},
+		{.name = "GP_GET_BITS off=26 len=4",
+		 .tst_fn = getbits_26_4},
+		{.name = "GP_GET_BITS off=27 len=4",
+		 .tst_fn = getbits_27_4},
+		{.name = "GP_GET_BITS off=28 len=4",
+		 .tst_fn = getbits_28_4},
+		{.name = "GP_GET_BITS off=0 len=5",
+		 .tst_fn = getbits_0_5},
+		{.name = "GP_GET_BITS off=1 len=5",
+		 .tst_fn = getbits_1_5},
+		{.name = "GP_GET_BITS off=2 len=5",
+		 .tst_fn = getbits_2_5},
+		{.name = "GP_GET_BITS off=3 len=5",
+		 .tst_fn = getbits_3_5},
+		{.name = "GP_GET_BITS off=4 len=5",
+		 .tst_fn = getbits_4_5},
+		{.name = "GP_GET_BITS off=5 len=5",
+		 .tst_fn = getbits_5_5},
+		{.name = "GP_GET_BITS off=6 len=5",
+		 .tst_fn = getbits_6_5},
+		{.name = "GP_GET_BITS off=7 len=5",
+		 .tst_fn = getbits_7_5},
+		{.name = "GP_GET_BITS off=8 len=5",
+		 .tst_fn = getbits_8_5},
+		{.name = "GP_GET_BITS off=9 len=5",
+		 .tst_fn = getbits_9_5},
+		{.name = "GP_GET_BITS off=10 len=5",
+		 .tst_fn = getbits_10_5},
+		{.name = "GP_GET_BITS off=11 len=5",
+		 .tst_fn = getbits_11_5},
+		{.name = "GP_GET_BITS off=12 len=5",
+		 .tst_fn = getbits_12_5},
+		{.name = "GP_GET_BITS off=13 len=5",
+		 .tst_fn = getbits_13_5},
+		{.name = "GP_GET_BITS off=14 len=5",
+		 .tst_fn = getbits_14_5},
+		{.name = "GP_GET_BITS off=15 len=5",
+		 .tst_fn = getbits_15_5},
+		{.name = "GP_GET_BITS off=16 len=5",
+		 .tst_fn = getbits_16_5},
+		{.name = "GP_GET_BITS off=17 len=5",
+		 .tst_fn = getbits_17_5},
+		{.name = "GP_GET_BITS off=18 len=5",
+		 .tst_fn = getbits_18_5},
+		{.name = "GP_GET_BITS off=19 len=5",
+		 .tst_fn = getbits_19_5},
+		{.name = "GP_GET_BITS off=20 len=5",
+		 .tst_fn = getbits_20_5},
+		{.name = "GP_GET_BITS off=21 len=5",
+		 .tst_fn = getbits_21_5},
+		{.name = "GP_GET_BITS off=22 len=5",
+		 .tst_fn = getbits_22_5},
+		{.name = "GP_GET_BITS off=23 len=5",
+		 .tst_fn = getbits_23_5},
+		{.name = "GP_GET_BITS off=24 len=5",
+		 .tst_fn = getbits_24_5},
+		{.name = "GP_GET_BITS off=25 len=5",
+		 .tst_fn = getbits_25_5},
+		{.name = "GP_GET_BITS off=26 len=5",
+		 .tst_fn = getbits_26_5},
+		{.name = "GP_GET_BITS off=27 len=5",
+		 .tst_fn = getbits_27_5},
+		{.name = "GP_GET_BITS off=0 len=6",
+		 .tst_fn = getbits_0_6},
+		{.name = "GP_GET_BITS off=1 len=6",
+		 .tst_fn = getbits_1_6},
+		{.name = "GP_GET_BITS off=2 len=6",
+		 .tst_fn = getbits_2_6},
+		{.name = "GP_GET_BITS off=3 len=6",
+		 .tst_fn = getbits_3_6},
+		{.name = "GP_GET_BITS off=4 len=6",
+		 .tst_fn = getbits_4_6},
+		{.name = "GP_GET_BITS off=5 len=6",
+		 .tst_fn = getbits_5_6},
+		{.name = "GP_GET_BITS off=6 len=6",
+		 .tst_fn = getbits_6_6},
+		{.name = "GP_GET_BITS off=7 len=6",
+		 .tst_fn = getbits_7_6},
+		{.name = "GP_GET_BITS off=8 len=6",
+		 .tst_fn = getbits_8_6},
+		{.name = "GP_GET_BITS off=9 len=6",
+		 .tst_fn = getbits_9_6},
+		{.name = "GP_GET_BITS off=10 len=6",
+		 .tst_fn = getbits_10_6},
+		{.name = "GP_GET_BITS off=11 len=6",
+		 .tst_fn = getbits_11_6},
+		{.name = "GP_GET_BITS off=12 len=6",
+		 .tst_fn = getbits_12_6},
+		{.name = "GP_GET_BITS off=13 len=6",
+		 .tst_fn = getbits_13_6},
+		{.name = "GP_GET_BITS off=14 len=6",
+		 .tst_fn = getbits_14_6},
+		{.name = "GP_GET_BITS off=15 len=6",
+		 .tst_fn = getbits_15_6},
+		{.name = "GP_GET_BITS off=16 len=6",
+		 .tst_fn = getbits_16_6},
+		{.name = "GP_GET_BITS off=17 len=6",
+		 .tst_fn = getbits_17_6},
+		{.name = "GP_GET_BITS off=18 len=6",
+		 .tst_fn = getbits_18_6},
+		{.name = "GP_GET_BITS off=19 len=6",
+		 .tst_fn = getbits_19_6},
+		{.name = "GP_GET_BITS off=20 len=6",
+		 .tst_fn = getbits_20_6},
+		{.name = "GP_GET_BITS off=21 len=6",
+		 .tst_fn = getbits_21_6},
+		{.name = "GP_GET_BITS off=22 len=6",
+		 .tst_fn = getbits_22_6},
+		{.name = "GP_GET_BITS off=23 len=6",
+		 .tst_fn = getbits_23_6},
+		{.name = "GP_GET_BITS off=24 len=6",
+		 .tst_fn = getbits_24_6},
+		{.name = "GP_GET_BITS off=25 len=6",
+		 .tst_fn = getbits_25_6},
+		{.name = "GP_GET_BITS off=26 len=6",
+		 .tst_fn = getbits_26_6},
+		{.name = "GP_GET_BITS off=0 len=7",
+		 .tst_fn = getbits_0_7},
+		{.name = "GP_GET_BITS off=1 len=7",
+		 .tst_fn = getbits_1_7},
+		{.name = "GP_GET_BITS off=2 len=7",
+		 .tst_fn = getbits_2_7},
+		{.name = "GP_GET_BITS off=3 len=7",
+		 .tst_fn = getbits_3_7},
+		{.name = "GP_GET_BITS off=4 len=7",
+		 .tst_fn = getbits_4_7},
+		{.name = "GP_GET_BITS off=5 len=7",
+		 .tst_fn = getbits_5_7},
+		{.name = "GP_GET_BITS off=6 len=7",
+		 .tst_fn = getbits_6_7},
+		{.name = "GP_GET_BITS off=7 len=7",
+		 .tst_fn = getbits_7_7},
+		{.name = "GP_GET_BITS off=8 len=7",
+		 .tst_fn = getbits_8_7},
+		{.name = "GP_GET_BITS off=9 len=7",
+		 .tst_fn = getbits_9_7},
+		{.name = "GP_GET_BITS off=10 len=7",
+		 .tst_fn = getbits_10_7},
+		{.name = "GP_GET_BITS off=11 len=7",
+		 .tst_fn = getbits_11_7},
+		{.name = "GP_GET_BITS off=12 len=7",
+		 .tst_fn = getbits_12_7},
+		{.name = "GP_GET_BITS off=13 len=7",
+		 .tst_fn = getbits_13_7},
+		{.name = "GP_GET_BITS off=14 len=7",
+		 .tst_fn = getbits_14_7},
+		{.name = "GP_GET_BITS off=15 len=7",
+		 .tst_fn = getbits_15_7},
+		{.name = "GP_GET_BITS off=16 len=7",
+		 .tst_fn = getbits_16_7},
+		{.name = "GP_GET_BITS off=17 len=7",
+		 .tst_fn = getbits_17_7},
+		{.name = "GP_GET_BITS off=18 len=7",
+		 .tst_fn = getbits_18_7},
+		{.name = "GP_GET_BITS off=19 len=7",
+		 .tst_fn = getbits_19_7},
+		{.name = "GP_GET_BITS off=20 len=7",
+		 .tst_fn = getbits_20_7},
+		{.name = "GP_GET_BITS off=21 len=7",
+		 .tst_fn = getbits_21_7},
+		{.name = "GP_GET_BITS off=22 len=7",
+		 .tst_fn = getbits_22_7},
+		{.name = "GP_GET_BITS off=23 len=7",
+		 .tst_fn = getbits_23_7},
+		{.name = "GP_GET_BITS off=24 len=7",
+		 .tst_fn = getbits_24_7},
+		{.name = "GP_GET_BITS off=25 len=7",
+		 .tst_fn = getbits_25_7},
+		{.name = "GP_GET_BITS off=0 len=8",
+		 .tst_fn = getbits_0_8},
+		{.name = "GP_GET_BITS off=1 len=8",
+		 .tst_fn = getbits_1_8},
+		{.name = "GP_GET_BITS off=2 len=8",
+		 .tst_fn = getbits_2_8},
+		{.name = "GP_GET_BITS off=3 len=8",
+		 .tst_fn = getbits_3_8},
+		{.name = "GP_GET_BITS off=4 len=8",
+		 .tst_fn = getbits_4_8},
+		{.name = "GP_GET_BITS off=5 len=8",
+		 .tst_fn = getbits_5_8},
+		{.name = "GP_GET_BITS off=6 len=8",
+		 .tst_fn = getbits_6_8},
+		{.name = "GP_GET_BITS off=7 len=8",
+		 .tst_fn = getbits_7_8},
+		{.name = "GP_GET_BITS off=8 len=8",
+		 .tst_fn = getbits_8_8},
+		{.name = "GP_GET_BITS off=9 len=8",
+		 .tst_fn = getbits_9_8},
+		{.name = "GP_GET_BITS off=10 len=8",
+		 .tst_fn = getbits_10_8},
+		{.name = "GP_GET_BITS off=11 len=8",
+		 .tst_fn = getbits_11_8},
+		{.name = "GP_GET_BITS off=12 len=8",
+		 .tst_fn = getbits_12_8},
+		{.name = "GP_GET_BITS off=13 len=8",
+		 .tst_fn = getbits_13_8},
+		{.name = "GP_GET_BITS off=14 len=8",
+		 .tst_fn = getbits_14_8},
+		{.name = "GP_GET_BITS off=15 len=8",
+		 .tst_fn = getbits_15_8},
+		{.name = "GP_GET_BITS off=16 len=8",
+		 .tst_fn = getbits_16_8},
+		{.name = "GP_GET_BITS off=17 len=8",
+		 .tst_fn = getbits_17_8},
+		{.name = "GP_GET_BITS off=18 len=8",
+		 .tst_fn = getbits_18_8},
+		{.name = "GP_GET_BITS off=19 len=8",
+		 .tst_fn = getbits_19_8},
+		{.name = "GP_GET_BITS off=20 len=8",
+		 .tst_fn = getbits_20_8},
+		{.name = "GP_GET_BITS off=21 len=8",
+		 .tst_fn = getbits_21_8},
+		{.name = "GP_GET_BITS off=22 len=8",
+		 .tst_fn = getbits_22_8},
+		{.name = "GP_GET_BITS off=23 len=8",
+		 .tst_fn = getbits_23_8},
+		{.name = "GP_GET_BITS off=24 len=8",
+		 .tst_fn = getbits_24_8},
+		{.name = "GP_GET_BITS off=0 len=9",
+		 .tst_fn = getbits_0_9},
+		{.name = "GP_GET_BITS off=1 len=9",
+		 .tst_fn = getbits_1_9},
+		{.name = "GP_GET_BITS off=2 len=9",
+		 .tst_fn = getbits_2_9},
+		{.name = "GP_GET_BITS off=3 len=9",
+		 .tst_fn = getbits_3_9},
+		{.name = "GP_GET_BITS off=4 len=9",
+		 .tst_fn = getbits_4_9},
+		{.name = "GP_GET_BITS off=5 len=9",
+		 .tst_fn = getbits_5_9},
+		{.name = "GP_GET_BITS off=6 len=9",
+		 .tst_fn = getbits_6_9},
+		{.name = "GP_GET_BITS off=7 len=9",
+		 .tst_fn = getbits_7_9},
+		{.name = "GP_GET_BITS off=8 len=9",
+		 .tst_fn = getbits_8_9},
+		{.name = "GP_GET_BITS off=9 len=9",
+		 .tst_fn = getbits_9_9},
+		{.name = "GP_GET_BITS off=10 len=9",
+		 .tst_fn = getbits_10_9},
+		{.name = "GP_GET_BITS off=11 len=9",
+		 .tst_fn = getbits_11_9},
+		{.name = "GP_GET_BITS off=12 len=9",
+		 .tst_fn = getbits_12_9},
+		{.name = "GP_GET_BITS off=13 len=9",
+		 .tst_fn = getbits_13_9},
+		{.name = "GP_GET_BITS off=14 len=9",
+		 .tst_fn = getbits_14_9},
+		{.name = "GP_GET_BITS off=15 len=9",
+		 .tst_fn = getbits_15_9},
+		{.name = "GP_GET_BITS off=16 len=9",
+		 .tst_fn = getbits_16_9},
+		{.name = "GP_GET_BITS off=17 len=9",
+		 .tst_fn = getbits_17_9},
+		{.name = "GP_GET_BITS off=18 len=9",
+		 .tst_fn = getbits_18_9},
+		{.name = "GP_GET_BITS off=19 len=9",
+		 .tst_fn = getbits_19_9},
+		{.name = "GP_GET_BITS off=20 len=9",
+		 .tst_fn = getbits_20_9},
+		{.name = "GP_GET_BITS off=21 len=9",
+		 .tst_fn = getbits_21_9},
+		{.name = "GP_GET_BITS off=22 len=9",
+		 .tst_fn = getbits_22_9},
+		{.name = "GP_GET_BITS off=23 len=9",
+		 .tst_fn = getbits_23_9},
+		{.name = "GP_GET_BITS off=0 len=10",
+		 .tst_fn = getbits_0_10},
+		{.name = "GP_GET_BITS off=1 len=10",
+		 .tst_fn = getbits_1_10},
+		{.name = "GP_GET_BITS off=2 len=10",
+		 .tst_fn = getbits_2_10},
+		{.name = "GP_GET_BITS off=3 len=10",
+		 .tst_fn = getbits_3_10},
+		{.name = "GP_GET_BITS off=4 len=10",
+		 .tst_fn = getbits_4_10},
+		{.name = "GP_GET_BITS off=5 len=10",
+		 .tst_fn = getbits_5_10},
+		{.name = "GP_GET_BITS off=6 len=10",
+		 .tst_fn = getbits_6_10},
+		{.name = "GP_GET_BITS off=7 len=10",
+		 .tst_fn = getbits_7_10},
+		{.name = "GP_GET_BITS off=8 len=10",
+		 .tst_fn = getbits_8_10},
+		{.name = "GP_GET_BITS off=9 len=10",
+		 .tst_fn = getbits_9_10},
+		{.name = "GP_GET_BITS off=10 len=10",
+		 .tst_fn = getbits_10_10},
+		{.name = "GP_GET_BITS off=11 len=10",
+		 .tst_fn = getbits_11_10},
+		{.name = "GP_GET_BITS off=12 len=10",
+		 .tst_fn = getbits_12_10},
+		{.name = "GP_GET_BITS off=13 len=10",
+		 .tst_fn = getbits_13_10},
+		{.name = "GP_GET_BITS off=14 len=10",
+		 .tst_fn = getbits_14_10},
+		{.name = "GP_GET_BITS off=15 len=10",
+		 .tst_fn = getbits_15_10},
+		{.name = "GP_GET_BITS off=16 len=10",
+		 .tst_fn = getbits_16_10},
+		{.name = "GP_GET_BITS off=17 len=10",
+		 .tst_fn = getbits_17_10},
+		{.name = "GP_GET_BITS off=18 len=10",
+		 .tst_fn = getbits_18_10},
+		{.name = "GP_GET_BITS off=19 len=10",
+		 .tst_fn = getbits_19_10},
+		{.name = "GP_GET_BITS off=20 len=10",
+		 .tst_fn = getbits_20_10},
+		{.name = "GP_GET_BITS off=21 len=10",
+		 .tst_fn = getbits_21_10},
+		{.name = "GP_GET_BITS off=22 len=10",
+		 .tst_fn = getbits_22_10},
+		{.name = "GP_GET_BITS off=0 len=11",
+		 .tst_fn = getbits_0_11},
+		{.name = "GP_GET_BITS off=1 len=11",
+		 .tst_fn = getbits_1_11},
+		{.name = "GP_GET_BITS off=2 len=11",
+		 .tst_fn = getbits_2_11},
+		{.name = "GP_GET_BITS off=3 len=11",
+		 .tst_fn = getbits_3_11},
+		{.name = "GP_GET_BITS off=4 len=11",
+		 .tst_fn = getbits_4_11},
+		{.name = "GP_GET_BITS off=5 len=11",
+		 .tst_fn = getbits_5_11},
+		{.name = "GP_GET_BITS off=6 len=11",
+		 .tst_fn = getbits_6_11},
+		{.name = "GP_GET_BITS off=7 len=11",
+		 .tst_fn = getbits_7_11},
+		{.name = "GP_GET_BITS off=8 len=11",
+		 .tst_fn = getbits_8_11},
+		{.name = "GP_GET_BITS off=9 len=11",
+		 .tst_fn = getbits_9_11},
+		{.name = "GP_GET_BITS off=10 len=11",
+		 .tst_fn = getbits_10_11},
+		{.name = "GP_GET_BITS off=11 len=11",
+		 .tst_fn = getbits_11_11},
+		{.name = "GP_GET_BITS off=12 len=11",
+		 .tst_fn = getbits_12_11},
+		{.name = "GP_GET_BITS off=13 len=11",
+		 .tst_fn = getbits_13_11},
+		{.name = "GP_GET_BITS off=14 len=11",
+		 .tst_fn = getbits_14_11},
+		{.name = "GP_GET_BITS off=15 len=11",
+		 .tst_fn = getbits_15_11},
+		{.name = "GP_GET_BITS off=16 len=11",
+		 .tst_fn = getbits_16_11},
+		{.name = "GP_GET_BITS off=17 len=11",
+		 .tst_fn = getbits_17_11},
+		{.name = "GP_GET_BITS off=18 len=11",
+		 .tst_fn = getbits_18_11},
+		{.name = "GP_GET_BITS off=19 len=11",
+		 .tst_fn = getbits_19_11},
+		{.name = "GP_GET_BITS off=20 len=11",
+		 .tst_fn = getbits_20_11},
+		{.name = "GP_GET_BITS off=21 len=11",
+		 .tst_fn = getbits_21_11},
+		{.name = "GP_GET_BITS off=0 len=12",
+		 .tst_fn = getbits_0_12},
+		{.name = "GP_GET_BITS off=1 len=12",
+		 .tst_fn = getbits_1_12},
+		{.name = "GP_GET_BITS off=2 len=12",
+		 .tst_fn = getbits_2_12},
+		{.name = "GP_GET_BITS off=3 len=12",
+		 .tst_fn = getbits_3_12},
+		{.name = "GP_GET_BITS off=4 len=12",
+		 .tst_fn = getbits_4_12},
+		{.name = "GP_GET_BITS off=5 len=12",
+		 .tst_fn = getbits_5_12},
+		{.name = "GP_GET_BITS off=6 len=12",
+		 .tst_fn = getbits_6_12},
+		{.name = "GP_GET_BITS off=7 len=12",
+		 .tst_fn = getbits_7_12},
+		{.name = "GP_GET_BITS off=8 len=12",
+		 .tst_fn = getbits_8_12},
+		{.name = "GP_GET_BITS off=9 len=12",
+		 .tst_fn = getbits_9_12},
+		{.name = "GP_GET_BITS off=10 len=12",
+		 .tst_fn = getbits_10_12},
+		{.name = "GP_GET_BITS off=11 len=12",
+		 .tst_fn = getbits_11_12},
+		{.name = "GP_GET_BITS off=12 len=12",
+		 .tst_fn = getbits_12_12},
+		{.name = "GP_GET_BITS off=13 len=12",
+		 .tst_fn = getbits_13_12},
+		{.name = "GP_GET_BITS off=14 len=12",
+		 .tst_fn = getbits_14_12},
+		{.name = "GP_GET_BITS off=15 len=12",
+		 .tst_fn = getbits_15_12},
+		{.name = "GP_GET_BITS off=16 len=12",
+		 .tst_fn = getbits_16_12},
+		{.name = "GP_GET_BITS off=17 len=12",
+		 .tst_fn = getbits_17_12},
+		{.name = "GP_GET_BITS off=18 len=12",
+		 .tst_fn = getbits_18_12},
+		{.name = "GP_GET_BITS off=19 len=12",
+		 .tst_fn = getbits_19_12},
+		{.name = "GP_GET_BITS off=20 len=12",
+		 .tst_fn = getbits_20_12},
+		{.name = "GP_GET_BITS off=0 len=13",
+		 .tst_fn = getbits_0_13},
+		{.name = "GP_GET_BITS off=1 len=13",
+		 .tst_fn = getbits_1_13},
+		{.name = "GP_GET_BITS off=2 len=13",
+		 .tst_fn = getbits_2_13},
+		{.name = "GP_GET_BITS off=3 len=13",
+		 .tst_fn = getbits_3_13},
+		{.name = "GP_GET_BITS off=4 len=13",
+		 .tst_fn = getbits_4_13},
+		{.name = "GP_GET_BITS off=5 len=13",
+		 .tst_fn = getbits_5_13},
+		{.name = "GP_GET_BITS off=6 len=13",
+		 .tst_fn = getbits_6_13},
+		{.name = "GP_GET_BITS off=7 len=13",
+		 .tst_fn = getbits_7_13},
+		{.name = "GP_GET_BITS off=8 len=13",
+		 .tst_fn = getbits_8_13},
+		{.name = "GP_GET_BITS off=9 len=13",
+		 .tst_fn = getbits_9_13},
+		{.name = "GP_GET_BITS off=10 len=13",
+		 .tst_fn = getbits_10_13},
+		{.name = "GP_GET_BITS off=11 len=13",
+		 .tst_fn = getbits_11_13},
+		{.name = "GP_GET_BITS off=12 len=13",
+		 .tst_fn = getbits_12_13},
+		{.name = "GP_GET_BITS off=13 len=13",
+		 .tst_fn = getbits_13_13},
+		{.name = "GP_GET_BITS off=14 len=13",
+		 .tst_fn = getbits_14_13},
+		{.name = "GP_GET_BITS off=15 len=13",
+		 .tst_fn = getbits_15_13},
+		{.name = "GP_GET_BITS off=16 len=13",
+		 .tst_fn = getbits_16_13},
+		{.name = "GP_GET_BITS off=17 len=13",
+		 .tst_fn = getbits_17_13},
+		{.name = "GP_GET_BITS off=18 len=13",
+		 .tst_fn = getbits_18_13},
+		{.name = "GP_GET_BITS off=19 len=13",
+		 .tst_fn = getbits_19_13},
+		{.name = "GP_GET_BITS off=0 len=14",
+		 .tst_fn = getbits_0_14},
+		{.name = "GP_GET_BITS off=1 len=14",
+		 .tst_fn = getbits_1_14},
+		{.name = "GP_GET_BITS off=2 len=14",
+		 .tst_fn = getbits_2_14},
+		{.name = "GP_GET_BITS off=3 len=14",
+		 .tst_fn = getbits_3_14},
+		{.name = "GP_GET_BITS off=4 len=14",
+		 .tst_fn = getbits_4_14},
+		{.name = "GP_GET_BITS off=5 len=14",
+		 .tst_fn = getbits_5_14},
+		{.name = "GP_GET_BITS off=6 len=14",
+		 .tst_fn = getbits_6_14},
+		{.name = "GP_GET_BITS off=7 len=14",
+		 .tst_fn = getbits_7_14},
+		{.name = "GP_GET_BITS off=8 len=14",
+		 .tst_fn = getbits_8_14},
+		{.name = "GP_GET_BITS off=9 len=14",
+		 .tst_fn = getbits_9_14},
+		{.name = "GP_GET_BITS off=10 len=14",
+		 .tst_fn = getbits_10_14},
+		{.name = "GP_GET_BITS off=11 len=14",
+		 .tst_fn = getbits_11_14},
+		{.name = "GP_GET_BITS off=12 len=14",
+		 .tst_fn = getbits_12_14},
+		{.name = "GP_GET_BITS off=13 len=14",
+		 .tst_fn = getbits_13_14},
+		{.name = "GP_GET_BITS off=14 len=14",
+		 .tst_fn = getbits_14_14},
+		{.name = "GP_GET_BITS off=15 len=14",
+		 .tst_fn = getbits_15_14},
+		{.name = "GP_GET_BITS off=16 len=14",
+		 .tst_fn = getbits_16_14},
+		{.name = "GP_GET_BITS off=17 len=14",
+		 .tst_fn = getbits_17_14},
+		{.name = "GP_GET_BITS off=18 len=14",
+		 .tst_fn = getbits_18_14},
+		{.name = "GP_GET_BITS off=0 len=15",
+		 .tst_fn = getbits_0_15},
+		{.name = "GP_GET_BITS off=1 len=15",
+		 .tst_fn = getbits_1_15},
+		{.name = "GP_GET_BITS off=2 len=15",
+		 .tst_fn = getbits_2_15},
+		{.name = "GP_GET_BITS off=3 len=15",
+		 .tst_fn = getbits_3_15},
+		{.name = "GP_GET_BITS off=4 len=15",
+		 .tst_fn = getbits_4_15},
+		{.name = "GP_GET_BITS off=5 len=15",
+		 .tst_fn = getbits_5_15},
+		{.name = "GP_GET_BITS off=6 len=15",
+		 .tst_fn = getbits_6_15},
+		{.name = "GP_GET_BITS off=7 len=15",
+		 .tst_fn = getbits_7_15},
+		{.name = "GP_GET_BITS off=8 len=15",
+		 .tst_fn = getbits_8_15},
+		{.name = "GP_GET_BITS off=9 len=15",
+		 .tst_fn = getbits_9_15},
+		{.name = "GP_GET_BITS off=10 len=15",
+		 .tst_fn = getbits_10_15},
+		{.name = "GP_GET_BITS off=11 len=15",
+		 .tst_fn = getbits_11_15},
+		{.name = "GP_GET_BITS off=12 len=15",
+		 .tst_fn = getbits_12_15},
+		{.name = "GP_GET_BITS off=13 len=15",
+		 .tst_fn = getbits_13_15},
+		{.name = "GP_GET_BITS off=14 len=15",
+		 .tst_fn = getbits_14_15},
+		{.name = "GP_GET_BITS off=15 len=15",
+		 .tst_fn = getbits_15_15},
+		{.name = "GP_GET_BITS off=16 len=15",
+		 .tst_fn = getbits_16_15},
+		{.name = "GP_GET_BITS off=17 len=15",
+		 .tst_fn = getbits_17_15},
+		{.name = "GP_GET_BITS off=0 len=16",
+		 .tst_fn = getbits_0_16},
+		{.name = "GP_GET_BITS off=1 len=16",
+		 .tst_fn = getbits_1_16},
+		{.name = "GP_GET_BITS off=2 len=16",
+		 .tst_fn = getbits_2_16},
+		{.name = "GP_GET_BITS off=3 len=16",
+		 .tst_fn = getbits_3_16},
+		{.name = "GP_GET_BITS off=4 len=16",
+		 .tst_fn = getbits_4_16},
+		{.name = "GP_GET_BITS off=5 len=16",
+		 .tst_fn = getbits_5_16},
+		{.name = "GP_GET_BITS off=6 len=16",
+		 .tst_fn = getbits_6_16},
+		{.name = "GP_GET_BITS off=7 len=16",
+		 .tst_fn = getbits_7_16},
+		{.name = "GP_GET_BITS off=8 len=16",
+		 .tst_fn = getbits_8_16},
+		{.name = "GP_GET_BITS off=9 len=16",
+		 .tst_fn = getbits_9_16},
+		{.name = "GP_GET_BITS off=10 len=16",
+		 .tst_fn = getbits_10_16},
+		{.name = "GP_GET_BITS off=11 len=16",
+		 .tst_fn = getbits_11_16},
+		{.name = "GP_GET_BITS off=12 len=16",
+		 .tst_fn = getbits_12_16},
+		{.name = "GP_GET_BITS off=13 len=16",
+		 .tst_fn = getbits_13_16},
+		{.name = "GP_GET_BITS off=14 len=16",
+		 .tst_fn = getbits_14_16},
+		{.name = "GP_GET_BITS off=15 len=16",
+		 .tst_fn = getbits_15_16},
+		{.name = "GP_GET_BITS off=16 len=16",
+		 .tst_fn = getbits_16_16},
+		{.name = "GP_GET_BITS off=0 len=17",
+		 .tst_fn = getbits_0_17},
+		{.name = "GP_GET_BITS off=1 len=17",
+		 .tst_fn = getbits_1_17},
+		{.name = "GP_GET_BITS off=2 len=17",
+		 .tst_fn = getbits_2_17},
+		{.name = "GP_GET_BITS off=3 len=17",
+		 .tst_fn = getbits_3_17},
+		{.name = "GP_GET_BITS off=4 len=17",
+		 .tst_fn = getbits_4_17},
+		{.name = "GP_GET_BITS off=5 len=17",
+		 .tst_fn = getbits_5_17},
+		{.name = "GP_GET_BITS off=6 len=17",
+		 .tst_fn = getbits_6_17},
+		{.name = "GP_GET_BITS off=7 len=17",
+		 .tst_fn = getbits_7_17},
+		{.name = "GP_GET_BITS off=8 len=17",
+		 .tst_fn = getbits_8_17},
+		{.name = "GP_GET_BITS off=9 len=17",
+		 .tst_fn = getbits_9_17},
+		{.name = "GP_GET_BITS off=10 len=17",
+		 .tst_fn = getbits_10_17},
+		{.name = "GP_GET_BITS off=11 len=17",
+		 .tst_fn = getbits_11_17},
+		{.name = "GP_GET_BITS off=12 len=17",
+		 .tst_fn = getbits_12_17},
+		{.name = "GP_GET_BITS off=13 len=17",
+		 .tst_fn = getbits_13_17},
+		{.name = "GP_GET_BITS off=14 len=17",
+		 .tst_fn = getbits_14_17},
+		{.name = "GP_GET_BITS off=15 len=17",
+		 .tst_fn = getbits_15_17},
+		{.name = "GP_GET_BITS off=0 len=18",
+		 .tst_fn = getbits_0_18},
+		{.name = "GP_GET_BITS off=1 len=18",
+		 .tst_fn = getbits_1_18},
+		{.name = "GP_GET_BITS off=2 len=18",
+		 .tst_fn = getbits_2_18},
+		{.name = "GP_GET_BITS off=3 len=18",
+		 .tst_fn = getbits_3_18},
+		{.name = "GP_GET_BITS off=4 len=18",
+		 .tst_fn = getbits_4_18},
+		{.name = "GP_GET_BITS off=5 len=18",
+		 .tst_fn = getbits_5_18},
+		{.name = "GP_GET_BITS off=6 len=18",
+		 .tst_fn = getbits_6_18},
+		{.name = "GP_GET_BITS off=7 len=18",
+		 .tst_fn = getbits_7_18},
+		{.name = "GP_GET_BITS off=8 len=18",
+		 .tst_fn = getbits_8_18},
+		{.name = "GP_GET_BITS off=9 len=18",
+		 .tst_fn = getbits_9_18},
+		{.name = "GP_GET_BITS off=10 len=18",
+		 .tst_fn = getbits_10_18},
+		{.name = "GP_GET_BITS off=11 len=18",
+		 .tst_fn = getbits_11_18},
+		{.name = "GP_GET_BITS off=12 len=18",
+		 .tst_fn = getbits_12_18},
+		{.name = "GP_GET_BITS off=13 len=18",
+		 .tst_fn = getbits_13_18},
+		{.name = "GP_GET_BITS off=14 len=18",
+		 .tst_fn = getbits_14_18},
+		{.name = "GP_GET_BITS off=0 len=19",
+		 .tst_fn = getbits_0_19},
+		{.name = "GP_GET_BITS off=1 len=19",
+		 .tst_fn = getbits_1_19},
+		{.name = "GP_GET_BITS off=2 len=19",
+		 .tst_fn = getbits_2_19},
+		{.name = "GP_GET_BITS off=3 len=19",
+		 .tst_fn = getbits_3_19},
+		{.name = "GP_GET_BITS off=4 len=19",
+		 .tst_fn = getbits_4_19},
+		{.name = "GP_GET_BITS off=5 len=19",
+		 .tst_fn = getbits_5_19},
+		{.name = "GP_GET_BITS off=6 len=19",
+		 .tst_fn = getbits_6_19},
+		{.name = "GP_GET_BITS off=7 len=19",
+		 .tst_fn = getbits_7_19},
+		{.name = "GP_GET_BITS off=8 len=19",
+		 .tst_fn = getbits_8_19},
+		{.name = "GP_GET_BITS off=9 len=19",
+		 .tst_fn = getbits_9_19},
+		{.name = "GP_GET_BITS off=10 len=19",
+		 .tst_fn = getbits_10_19},
+		{.name = "GP_GET_BITS off=11 len=19",
+		 .tst_fn = getbits_11_19},
+		{.name = "GP_GET_BITS off=12 len=19",
+		 .tst_fn = getbits_12_19},
+		{.name = "GP_GET_BITS off=13 len=19",
+		 .tst_fn = getbits_13_19},
+		{.name = "GP_GET_BITS off=0 len=20",
+		 .tst_fn = getbits_0_20},
+		{.name = "GP_GET_BITS off=1 len=20",
+		 .tst_fn = getbits_1_20},
+		{.name = "GP_GET_BITS off=2 len=20",
+		 .tst_fn = getbits_2_20},
+		{.name = "GP_GET_BITS off=3 len=20",
+		 .tst_fn = getbits_3_20},
+		{.name = "GP_GET_BITS off=4 len=20",
+		 .tst_fn = getbits_4_20},
+		{.name = "GP_GET_BITS off=5 len=20",
+		 .tst_fn = getbits_5_20},
+		{.name = "GP_GET_BITS off=6 len=20",
+		 .tst_fn = getbits_6_20},
+		{.name = "GP_GET_BITS off=7 len=20",
+		 .tst_fn = getbits_7_20},
+		{.name = "GP_GET_BITS off=8 len=20",
+		 .tst_fn = getbits_8_20},
+		{.name = "GP_GET_BITS off=9 len=20",
+		 .tst_fn = getbits_9_20},
+		{.name = "GP_GET_BITS off=10 len=20",
+		 .tst_fn = getbits_10_20},
+		{.name = "GP_GET_BITS off=11 len=20",
+		 .tst_fn = getbits_11_20},
+		{.name = "GP_GET_BITS off=12 len=20",
+		 .tst_fn = getbits_12_20},
+		{.name = "GP_GET_BITS off=0 len=21",
+		 .tst_fn = getbits_0_21},
+		{.name = "GP_GET_BITS off=1 len=21",
+		 .tst_fn = getbits_1_21},
+		{.name = "GP_GET_BITS off=2 len=21",
+		 .tst_fn = getbits_2_21},
+		{.name = "GP_GET_BITS off=3 len=21",
+		 .tst_fn = getbits_3_21},
+		{.name = "GP_GET_BITS off=4 len=21",
+		 .tst_fn = getbits_4_21},
+		{.name = "GP_GET_BITS off=5 len=21",
+		 .tst_fn = getbits_5_21},
+		{.name = "GP_GET_BITS off=6 len=21",
+		 .tst_fn = getbits_6_21},
+		{.name = "GP_GET_BITS off=7 len=21",
+		 .tst_fn = getbits_7_21},
+		{.name = "GP_GET_BITS off=8 len=21",
+		 .tst_fn = getbits_8_21},
+		{.name = "GP_GET_BITS off=9 len=21",
+		 .tst_fn = getbits_9_21},
+		{.name = "GP_GET_BITS off=10 len=21",
+		 .tst_fn = getbits_10_21},
+		{.name = "GP_GET_BITS off=11 len=21",
+		 .tst_fn = getbits_11_21},
+		{.name = "GP_GET_BITS off=0 len=22",
+		 .tst_fn = getbits_0_22},
+		{.name = "GP_GET_BITS off=1 len=22",
+		 .tst_fn = getbits_1_22},
+		{.name = "GP_GET_BITS off=2 len=22",
+		 .tst_fn = getbits_2_22},
+		{.name = "GP_GET_BITS off=3 len=22",
+		 .tst_fn = getbits_3_22},
+		{.name = "GP_GET_BITS off=4 len=22",
+		 .tst_fn = getbits_4_22},
+		{.name = "GP_GET_BITS off=5 len=22",
+		 .tst_fn = getbits_5_22},
+		{.name = "GP_GET_BITS off=6 len=22",
+		 .tst_fn = getbits_6_22},
+		{.name = "GP_GET_BITS off=7 len=22",
+		 .tst_fn = getbits_7_22},
+		{.name = "GP_GET_BITS off=8 len=22",
+		 .tst_fn = getbits_8_22},
+		{.name = "GP_GET_BITS off=9 len=22",
+		 .tst_fn = getbits_9_22},
+		{.name = "GP_GET_BITS off=10 len=22",
+		 .tst_fn = getbits_10_22},
+		{.name = "GP_GET_BITS off=0 len=23",
+		 .tst_fn = getbits_0_23},
+		{.name = "GP_GET_BITS off=1 len=23",
+		 .tst_fn = getbits_1_23},
+		{.name = "GP_GET_BITS off=2 len=23",
+		 .tst_fn = getbits_2_23},
+		{.name = "GP_GET_BITS off=3 len=23",
+		 .tst_fn = getbits_3_23},
+		{.name = "GP_GET_BITS off=4 len=23",
+		 .tst_fn = getbits_4_23},
+		{.name = "GP_GET_BITS off=5 len=23",
+		 .tst_fn = getbits_5_23},
+		{.name = "GP_GET_BITS off=6 len=23",
+		 .tst_fn = getbits_6_23},
+		{.name = "GP_GET_BITS off=7 len=23",
+		 .tst_fn = getbits_7_23},
+		{.name = "GP_GET_BITS off=8 len=23",
+		 .tst_fn = getbits_8_23},
+		{.name = "GP_GET_BITS off=9 len=23",
+		 .tst_fn = getbits_9_23},
+		{.name = "GP_GET_BITS off=0 len=24",
+		 .tst_fn = getbits_0_24},
+		{.name = "GP_GET_BITS off=1 len=24",
+		 .tst_fn = getbits_1_24},
+		{.name = "GP_GET_BITS off=2 len=24",
+		 .tst_fn = getbits_2_24},
+		{.name = "GP_GET_BITS off=3 len=24",
+		 .tst_fn = getbits_3_24},
+		{.name = "GP_GET_BITS off=4 len=24",
+		 .tst_fn = getbits_4_24},
+		{.name = "GP_GET_BITS off=5 len=24",
+		 .tst_fn = getbits_5_24},
+		{.name = "GP_GET_BITS off=6 len=24",
+		 .tst_fn = getbits_6_24},
+		{.name = "GP_GET_BITS off=7 len=24",
+		 .tst_fn = getbits_7_24},
+		{.name = "GP_GET_BITS off=8 len=24",
+		 .tst_fn = getbits_8_24},
+		{.name = "GP_GET_BITS off=0 len=25",
+		 .tst_fn = getbits_0_25},
+		{.name = "GP_GET_BITS off=1 len=25",
+		 .tst_fn = getbits_1_25},
+		{.name = "GP_GET_BITS off=2 len=25",
+		 .tst_fn = getbits_2_25},
+		{.name = "GP_GET_BITS off=3 len=25",
+		 .tst_fn = getbits_3_25},
+		{.name = "GP_GET_BITS off=4 len=25",
+		 .tst_fn = getbits_4_25},
+		{.name = "GP_GET_BITS off=5 len=25",
+		 .tst_fn = getbits_5_25},
+		{.name = "GP_GET_BITS off=6 len=25",
+		 .tst_fn = getbits_6_25},
+		{.name = "GP_GET_BITS off=7 len=25",
+		 .tst_fn = getbits_7_25},
+		{.name = "GP_GET_BITS off=0 len=26",
+		 .tst_fn = getbits_0_26},
+		{.name = "GP_GET_BITS off=1 len=26",
+		 .tst_fn = getbits_1_26},
+		{.name = "GP_GET_BITS off=2 len=26",
+		 .tst_fn = getbits_2_26},
+		{.name = "GP_GET_BITS off=3 len=26",
+		 .tst_fn = getbits_3_26},
+		{.name = "GP_GET_BITS off=4 len=26",
+		 .tst_fn = getbits_4_26},
+		{.name = "GP_GET_BITS off=5 len=26",
+		 .tst_fn = getbits_5_26},
+		{.name = "GP_GET_BITS off=6 len=26",
+		 .tst_fn = getbits_6_26},
+		{.name = "GP_GET_BITS off=0 len=27",
+		 .tst_fn = getbits_0_27},
+		{.name = "GP_GET_BITS off=1 len=27",
+		 .tst_fn = getbits_1_27},
+		{.name = "GP_GET_BITS off=2 len=27",
+		 .tst_fn = getbits_2_27},
+		{.name = "GP_GET_BITS off=3 len=27",
+		 .tst_fn = getbits_3_27},
+		{.name = "GP_GET_BITS off=4 len=27",
+		 .tst_fn = getbits_4_27},
+		{.name = "GP_GET_BITS off=5 len=27",
+		 .tst_fn = getbits_5_27},
+		{.name = "GP_GET_BITS off=0 len=28",
+		 .tst_fn = getbits_0_28},
+		{.name = "GP_GET_BITS off=1 len=28",
+		 .tst_fn = getbits_1_28},
+		{.name = "GP_GET_BITS off=2 len=28",
+		 .tst_fn = getbits_2_28},
+		{.name = "GP_GET_BITS off=3 len=28",
+		 .tst_fn = getbits_3_28},
+		{.name = "GP_GET_BITS off=4 len=28",
+		 .tst_fn = getbits_4_28},
+		{.name = "GP_GET_BITS off=0 len=29",
+		 .tst_fn = getbits_0_29},
+		{.name = "GP_GET_BITS off=1 len=29",
+		 .tst_fn = getbits_1_29},
+		{.name = "GP_GET_BITS off=2 len=29",
+		 .tst_fn = getbits_2_29},
+		{.name = "GP_GET_BITS off=3 len=29",
+		 .tst_fn = getbits_3_29},
+		{.name = "GP_GET_BITS off=0 len=30",
+		 .tst_fn = getbits_0_30},
+		{.name = "GP_GET_BITS off=1 len=30",
+		 .tst_fn = getbits_1_30},
+		{.name = "GP_GET_BITS off=2 len=30",
+		 .tst_fn = getbits_2_30},
+		{.name = "GP_GET_BITS off=0 len=31",
+		 .tst_fn = getbits_0_31},
+		{.name = "GP_GET_BITS off=1 len=31",
+		 .tst_fn = getbits_1_31},
+		{.name = "GP_GET_BITS off=0 len=32",
+		 .tst_fn = getbits_0_32},
+		{.name = "GP_SET_BITS off=0 len=1",
+		 .tst_fn = setbits_0_1},
+		{.name = "GP_SET_BITS off=1 len=1",
+		 .tst_fn = setbits_1_1},
+		{.name = "GP_SET_BITS off=2 len=1",
+		 .tst_fn = setbits_2_1},
+		{.name = "GP_SET_BITS off=3 len=1",
+		 .tst_fn = setbits_3_1},
+		{.name = "GP_SET_BITS off=4 len=1",
+		 .tst_fn = setbits_4_1},
+		{.name = "GP_SET_BITS off=5 len=1",
+		 .tst_fn = setbits_5_1},
+		{.name = "GP_SET_BITS off=6 len=1",
+		 .tst_fn = setbits_6_1},
+		{.name = "GP_SET_BITS off=7 len=1",
+		 .tst_fn = setbits_7_1},
+		{.name = "GP_SET_BITS off=8 len=1",
+		 .tst_fn = setbits_8_1},
+		{.name = "GP_SET_BITS off=9 len=1",
+		 .tst_fn = setbits_9_1},
+		{.name = "GP_SET_BITS off=10 len=1",
+		 .tst_fn = setbits_10_1},
+		{.name = "GP_SET_BITS off=11 len=1",
+		 .tst_fn = setbits_11_1},
+		{.name = "GP_SET_BITS off=12 len=1",
+		 .tst_fn = setbits_12_1},
+		{.name = "GP_SET_BITS off=13 len=1",
+		 .tst_fn = setbits_13_1},
+		{.name = "GP_SET_BITS off=14 len=1",
+		 .tst_fn = setbits_14_1},
+		{.name = "GP_SET_BITS off=15 len=1",
+		 .tst_fn = setbits_15_1},
+		{.name = "GP_SET_BITS off=16 len=1",
+		 .tst_fn = setbits_16_1},
+		{.name = "GP_SET_BITS off=17 len=1",
+		 .tst_fn = setbits_17_1},
+		{.name = "GP_SET_BITS off=18 len=1",
+		 .tst_fn = setbits_18_1},
+		{.name = "GP_SET_BITS off=19 len=1",
+		 .tst_fn = setbits_19_1},
+		{.name = "GP_SET_BITS off=20 len=1",
+		 .tst_fn = setbits_20_1},
+		{.name = "GP_SET_BITS off=21 len=1",
+		 .tst_fn = setbits_21_1},
+		{.name = "GP_SET_BITS off=22 len=1",
+		 .tst_fn = setbits_22_1},
+		{.name = "GP_SET_BITS off=23 len=1",
+		 .tst_fn = setbits_23_1},
+		{.name = "GP_SET_BITS off=24 len=1",
+		 .tst_fn = setbits_24_1},
+		{.name = "GP_SET_BITS off=25 len=1",
+		 .tst_fn = setbits_25_1},
+		{.name = "GP_SET_BITS off=26 len=1",
+		 .tst_fn = setbits_26_1},
+		{.name = "GP_SET_BITS off=27 len=1",
+		 .tst_fn = setbits_27_1},
+		{.name = "GP_SET_BITS off=28 len=1",
+		 .tst_fn = setbits_28_1},
+		{.name = "GP_SET_BITS off=29 len=1",
+		 .tst_fn = setbits_29_1},
+		{.name = "GP_SET_BITS off=30 len=1",
+		 .tst_fn = setbits_30_1},
+		{.name = "GP_SET_BITS off=31 len=1",
+		 .tst_fn = setbits_31_1},
+		{.name = "GP_SET_BITS off=0 len=2",
+		 .tst_fn = setbits_0_2},
+		{.name = "GP_SET_BITS off=1 len=2",
+		 .tst_fn = setbits_1_2},
+		{.name = "GP_SET_BITS off=2 len=2",
+		 .tst_fn = setbits_2_2},
+		{.name = "GP_SET_BITS off=3 len=2",
+		 .tst_fn = setbits_3_2},
+		{.name = "GP_SET_BITS off=4 len=2",
+		 .tst_fn = setbits_4_2},
+		{.name = "GP_SET_BITS off=5 len=2",
+		 .tst_fn = setbits_5_2},
+		{.name = "GP_SET_BITS off=6 len=2",
+		 .tst_fn = setbits_6_2},
+		{.name = "GP_SET_BITS off=7 len=2",
+		 .tst_fn = setbits_7_2},
+		{.name = "GP_SET_BITS off=8 len=2",
+		 .tst_fn = setbits_8_2},
+		{.name = "GP_SET_BITS off=9 len=2",
+		 .tst_fn = setbits_9_2},
+		{.name = "GP_SET_BITS off=10 len=2",
+		 .tst_fn = setbits_10_2},
+		{.name = "GP_SET_BITS off=11 len=2",
+		 .tst_fn = setbits_11_2},
+		{.name = "GP_SET_BITS off=12 len=2",
+		 .tst_fn = setbits_12_2},
+		{.name = "GP_SET_BITS off=13 len=2",
+		 .tst_fn = setbits_13_2},
+		{.name = "GP_SET_BITS off=14 len=2",
+		 .tst_fn = setbits_14_2},
+		{.name = "GP_SET_BITS off=15 len=2",
+		 .tst_fn = setbits_15_2},
+		{.name = "GP_SET_BITS off=16 len=2",
+		 .tst_fn = setbits_16_2},
+		{.name = "GP_SET_BITS off=17 len=2",
+		 .tst_fn = setbits_17_2},
+		{.name = "GP_SET_BITS off=18 len=2",
+		 .tst_fn = setbits_18_2},
+		{.name = "GP_SET_BITS off=19 len=2",
+		 .tst_fn = setbits_19_2},
+		{.name = "GP_SET_BITS off=20 len=2",
+		 .tst_fn = setbits_20_2},
+		{.name = "GP_SET_BITS off=21 len=2",
+		 .tst_fn = setbits_21_2},
+		{.name = "GP_SET_BITS off=22 len=2",
+		 .tst_fn = setbits_22_2},
+		{.name = "GP_SET_BITS off=23 len=2",
+		 .tst_fn = setbits_23_2},
+		{.name = "GP_SET_BITS off=24 len=2",
+		 .tst_fn = setbits_24_2},
+		{.name = "GP_SET_BITS off=25 len=2",
+		 .tst_fn = setbits_25_2},
+		{.name = "GP_SET_BITS off=26 len=2",
+		 .tst_fn = setbits_26_2},
+		{.name = "GP_SET_BITS off=27 len=2",
+		 .tst_fn = setbits_27_2},
+		{.name = "GP_SET_BITS off=28 len=2",
+		 .tst_fn = setbits_28_2},
+		{.name = "GP_SET_BITS off=29 len=2",
+		 .tst_fn = setbits_29_2},
+		{.name = "GP_SET_BITS off=30 len=2",
+		 .tst_fn = setbits_30_2},
+		{.name = "GP_SET_BITS off=0 len=3",
+		 .tst_fn = setbits_0_3},
+		{.name = "GP_SET_BITS off=1 len=3",
+		 .tst_fn = setbits_1_3},
+		{.name = "GP_SET_BITS off=2 len=3",
+		 .tst_fn = setbits_2_3},
+		{.name = "GP_SET_BITS off=3 len=3",
+		 .tst_fn = setbits_3_3},
+		{.name = "GP_SET_BITS off=4 len=3",
+		 .tst_fn = setbits_4_3},
+		{.name = "GP_SET_BITS off=5 len=3",
+		 .tst_fn = setbits_5_3},
+		{.name = "GP_SET_BITS off=6 len=3",
+		 .tst_fn = setbits_6_3},
+		{.name = "GP_SET_BITS off=7 len=3",
+		 .tst_fn = setbits_7_3},
+		{.name = "GP_SET_BITS off=8 len=3",
+		 .tst_fn = setbits_8_3},
+		{.name = "GP_SET_BITS off=9 len=3",
+		 .tst_fn = setbits_9_3},
+		{.name = "GP_SET_BITS off=10 len=3",
+		 .tst_fn = setbits_10_3},
+		{.name = "GP_SET_BITS off=11 len=3",
+		 .tst_fn = setbits_11_3},
+		{.name = "GP_SET_BITS off=12 len=3",
+		 .tst_fn = setbits_12_3},
+		{.name = "GP_SET_BITS off=13 len=3",
+		 .tst_fn = setbits_13_3},
+		{.name = "GP_SET_BITS off=14 len=3",
+		 .tst_fn = setbits_14_3},
+		{.name = "GP_SET_BITS off=15 len=3",
+		 .tst_fn = setbits_15_3},
+		{.name = "GP_SET_BITS off=16 len=3",
+		 .tst_fn = setbits_16_3},
+		{.name = "GP_SET_BITS off=17 len=3",
+		 .tst_fn = setbits_17_3},
+		{.name = "GP_SET_BITS off=18 len=3",
+		 .tst_fn = setbits_18_3},
+		{.name = "GP_SET_BITS off=19 len=3",
+		 .tst_fn = setbits_19_3},
+		{.name = "GP_SET_BITS off=20 len=3",
+		 .tst_fn = setbits_20_3},
+		{.name = "GP_SET_BITS off=21 len=3",
+		 .tst_fn = setbits_21_3},
+		{.name = "GP_SET_BITS off=22 len=3",
+		 .tst_fn = setbits_22_3},
+		{.name = "GP_SET_BITS off=23 len=3",
+		 .tst_fn = setbits_23_3},
+		{.name = "GP_SET_BITS off=24 len=3",
+		 .tst_fn = setbits_24_3},
+		{.name = "GP_SET_BITS off=25 len=3",
+		 .tst_fn = setbits_25_3},
+		{.name = "GP_SET_BITS off=26 len=3",
+		 .tst_fn = setbits_26_3},
+		{.name = "GP_SET_BITS off=27 len=3",
+		 .tst_fn = setbits_27_3},
+		{.name = "GP_SET_BITS off=28 len=3",
+		 .tst_fn = setbits_28_3},
+		{.name = "GP_SET_BITS off=29 len=3",
+		 .tst_fn = setbits_29_3},
+		{.name = "GP_SET_BITS off=0 len=4",
+		 .tst_fn = setbits_0_4},
+		{.name = "GP_SET_BITS off=1 len=4",
+		 .tst_fn = setbits_1_4},
+		{.name = "GP_SET_BITS off=2 len=4",
+		 .tst_fn = setbits_2_4},
+		{.name = "GP_SET_BITS off=3 len=4",
+		 .tst_fn = setbits_3_4},
+		{.name = "GP_SET_BITS off=4 len=4",
+		 .tst_fn = setbits_4_4},
+		{.name = "GP_SET_BITS off=5 len=4",
+		 .tst_fn = setbits_5_4},
+		{.name = "GP_SET_BITS off=6 len=4",
+		 .tst_fn = setbits_6_4},
+		{.name = "GP_SET_BITS off=7 len=4",
+		 .tst_fn = setbits_7_4},
+		{.name = "GP_SET_BITS off=8 len=4",
+		 .tst_fn = setbits_8_4},
+		{.name = "GP_SET_BITS off=9 len=4",
+		 .tst_fn = setbits_9_4},
+		{.name = "GP_SET_BITS off=10 len=4",
+		 .tst_fn = setbits_10_4},
+		{.name = "GP_SET_BITS off=11 len=4",
+		 .tst_fn = setbits_11_4},
+		{.name = "GP_SET_BITS off=12 len=4",
+		 .tst_fn = setbits_12_4},
+		{.name = "GP_SET_BITS off=13 len=4",
+		 .tst_fn = setbits_13_4},
+		{.name = "GP_SET_BITS off=14 len=4",
+		 .tst_fn = setbits_14_4},
+		{.name = "GP_SET_BITS off=15 len=4",
+		 .tst_fn = setbits_15_4},
+		{.name = "GP_SET_BITS off=16 len=4",
+		 .tst_fn = setbits_16_4},
+		{.name = "GP_SET_BITS off=17 len=4",
+		 .tst_fn = setbits_17_4},
+		{.name = "GP_SET_BITS off=18 len=4",
+		 .tst_fn = setbits_18_4},
+		{.name = "GP_SET_BITS off=19 len=4",
+		 .tst_fn = setbits_19_4},
+		{.name = "GP_SET_BITS off=20 len=4",
+		 .tst_fn = setbits_20_4},
+		{.name = "GP_SET_BITS off=21 len=4",
+		 .tst_fn = setbits_21_4},
+		{.name = "GP_SET_BITS off=22 len=4",
+		 .tst_fn = setbits_22_4},
+		{.name = "GP_SET_BITS off=23 len=4",
+		 .tst_fn = setbits_23_4},
+		{.name = "GP_SET_BITS off=24 len=4",
+		 .tst_fn = setbits_24_4},
+		{.name = "GP_SET_BITS off=25 len=4",
+		 .tst_fn = setbits_25_4},
+		{.name = "GP_SET_BITS off=26 len=4",
+		 .tst_fn = setbits_26_4},
+		{.name = "GP_SET_BITS off=27 len=4",
+		 .tst_fn = setbits_27_4},
+		{.name = "GP_SET_BITS off=28 len=4",
+		 .tst_fn = setbits_28_4},
+		{.name = "GP_SET_BITS off=0 len=5",
+		 .tst_fn = setbits_0_5},
+		{.name = "GP_SET_BITS off=1 len=5",
+		 .tst_fn = setbits_1_5},
+		{.name = "GP_SET_BITS off=2 len=5",
+		 .tst_fn = setbits_2_5},
+		{.name = "GP_SET_BITS off=3 len=5",
+		 .tst_fn = setbits_3_5},
+		{.name = "GP_SET_BITS off=4 len=5",
+		 .tst_fn = setbits_4_5},
+		{.name = "GP_SET_BITS off=5 len=5",
+		 .tst_fn = setbits_5_5},
+		{.name = "GP_SET_BITS off=6 len=5",
+		 .tst_fn = setbits_6_5},
+		{.name = "GP_SET_BITS off=7 len=5",
+		 .tst_fn = setbits_7_5},
+		{.name = "GP_SET_BITS off=8 len=5",
+		 .tst_fn = setbits_8_5},
+		{.name = "GP_SET_BITS off=9 len=5",
+		 .tst_fn = setbits_9_5},
+		{.name = "GP_SET_BITS off=10 len=5",
+		 .tst_fn = setbits_10_5},
+		{.name = "GP_SET_BITS off=11 len=5",
+		 .tst_fn = setbits_11_5},
+		{.name = "GP_SET_BITS off=12 len=5",
+		 .tst_fn = setbits_12_5},
+		{.name = "GP_SET_BITS off=13 len=5",
+		 .tst_fn = setbits_13_5},
+		{.name = "GP_SET_BITS off=14 len=5",
+		 .tst_fn = setbits_14_5},
+		{.name = "GP_SET_BITS off=15 len=5",
+		 .tst_fn = setbits_15_5},
+		{.name = "GP_SET_BITS off=16 len=5",
+		 .tst_fn = setbits_16_5},
+		{.name = "GP_SET_BITS off=17 len=5",
+		 .tst_fn = setbits_17_5},
+		{.name = "GP_SET_BITS off=18 len=5",
+		 .tst_fn = setbits_18_5},
+		{.name = "GP_SET_BITS off=19 len=5",
+		 .tst_fn = setbits_19_5},
+		{.name = "GP_SET_BITS off=20 len=5",
+		 .tst_fn = setbits_20_5},
+		{.name = "GP_SET_BITS off=21 len=5",
+		 .tst_fn = setbits_21_5},
+		{.name = "GP_SET_BITS off=22 len=5",
+		 .tst_fn = setbits_22_5},
+		{.name = "GP_SET_BITS off=23 len=5",
+		 .tst_fn = setbits_23_5},
+		{.name = "GP_SET_BITS off=24 len=5",
+		 .tst_fn = setbits_24_5},
+		{.name = "GP_SET_BITS off=25 len=5",
+		 .tst_fn = setbits_25_5},
+		{.name = "GP_SET_BITS off=26 len=5",
+		 .tst_fn = setbits_26_5},
+		{.name = "GP_SET_BITS off=27 len=5",
+		 .tst_fn = setbits_27_5},
+		{.name = "GP_SET_BITS off=0 len=6",
+		 .tst_fn = setbits_0_6},
+		{.name = "GP_SET_BITS off=1 len=6",
+		 .tst_fn = setbits_1_6},
+		{.name = "GP_SET_BITS off=2 len=6",
+		 .tst_fn = setbits_2_6},
+		{.name = "GP_SET_BITS off=3 len=6",
+		 .tst_fn = setbits_3_6},
+		{.name = "GP_SET_BITS off=4 len=6",
+		 .tst_fn = setbits_4_6},
+		{.name = "GP_SET_BITS off=5 len=6",
+		 .tst_fn = setbits_5_6},
+		{.name = "GP_SET_BITS off=6 len=6",
+		 .tst_fn = setbits_6_6},
+		{.name = "GP_SET_BITS off=7 len=6",
+		 .tst_fn = setbits_7_6},
+		{.name = "GP_SET_BITS off=8 len=6",
+		 .tst_fn = setbits_8_6},
+		{.name = "GP_SET_BITS off=9 len=6",
+		 .tst_fn = setbits_9_6},
+		{.name = "GP_SET_BITS off=10 len=6",
+		 .tst_fn = setbits_10_6},
+		{.name = "GP_SET_BITS off=11 len=6",
+		 .tst_fn = setbits_11_6},
+		{.name = "GP_SET_BITS off=12 len=6",
+		 .tst_fn = setbits_12_6},
+		{.name = "GP_SET_BITS off=13 len=6",
+		 .tst_fn = setbits_13_6},
+		{.name = "GP_SET_BITS off=14 len=6",
+		 .tst_fn = setbits_14_6},
+		{.name = "GP_SET_BITS off=15 len=6",
+		 .tst_fn = setbits_15_6},
+		{.name = "GP_SET_BITS off=16 len=6",
+		 .tst_fn = setbits_16_6},
+		{.name = "GP_SET_BITS off=17 len=6",
+		 .tst_fn = setbits_17_6},
+		{.name = "GP_SET_BITS off=18 len=6",
+		 .tst_fn = setbits_18_6},
+		{.name = "GP_SET_BITS off=19 len=6",
+		 .tst_fn = setbits_19_6},
+		{.name = "GP_SET_BITS off=20 len=6",
+		 .tst_fn = setbits_20_6},
+		{.name = "GP_SET_BITS off=21 len=6",
+		 .tst_fn = setbits_21_6},
+		{.name = "GP_SET_BITS off=22 len=6",
+		 .tst_fn = setbits_22_6},
+		{.name = "GP_SET_BITS off=23 len=6",
+		 .tst_fn = setbits_23_6},
+		{.name = "GP_SET_BITS off=24 len=6",
+		 .tst_fn = setbits_24_6},
+		{.name = "GP_SET_BITS off=25 len=6",
+		 .tst_fn = setbits_25_6},
+		{.name = "GP_SET_BITS off=26 len=6",
+		 .tst_fn = setbits_26_6},
+		{.name = "GP_SET_BITS off=0 len=7",
+		 .tst_fn = setbits_0_7},
+		{.name = "GP_SET_BITS off=1 len=7",
+		 .tst_fn = setbits_1_7},
+		{.name = "GP_SET_BITS off=2 len=7",
+		 .tst_fn = setbits_2_7},
+		{.name = "GP_SET_BITS off=3 len=7",
+		 .tst_fn = setbits_3_7},
+		{.name = "GP_SET_BITS off=4 len=7",
+		 .tst_fn = setbits_4_7},
+		{.name = "GP_SET_BITS off=5 len=7",
+		 .tst_fn = setbits_5_7},
+		{.name = "GP_SET_BITS off=6 len=7",
+		 .tst_fn = setbits_6_7},
+		{.name = "GP_SET_BITS off=7 len=7",
+		 .tst_fn = setbits_7_7},
+		{.name = "GP_SET_BITS off=8 len=7",
+		 .tst_fn = setbits_8_7},
+		{.name = "GP_SET_BITS off=9 len=7",
+		 .tst_fn = setbits_9_7},
+		{.name = "GP_SET_BITS off=10 len=7",
+		 .tst_fn = setbits_10_7},
+		{.name = "GP_SET_BITS off=11 len=7",
+		 .tst_fn = setbits_11_7},
+		{.name = "GP_SET_BITS off=12 len=7",
+		 .tst_fn = setbits_12_7},
+		{.name = "GP_SET_BITS off=13 len=7",
+		 .tst_fn = setbits_13_7},
+		{.name = "GP_SET_BITS off=14 len=7",
+		 .tst_fn = setbits_14_7},
+		{.name = "GP_SET_BITS off=15 len=7",
+		 .tst_fn = setbits_15_7},
+		{.name = "GP_SET_BITS off=16 len=7",
+		 .tst_fn = setbits_16_7},
+		{.name = "GP_SET_BITS off=17 len=7",
+		 .tst_fn = setbits_17_7},
+		{.name = "GP_SET_BITS off=18 len=7",
+		 .tst_fn = setbits_18_7},
+		{.name = "GP_SET_BITS off=19 len=7",
+		 .tst_fn = setbits_19_7},
+		{.name = "GP_SET_BITS off=20 len=7",
+		 .tst_fn = setbits_20_7},
+		{.name = "GP_SET_BITS off=21 len=7",
+		 .tst_fn = setbits_21_7},
+		{.name = "GP_SET_BITS off=22 len=7",
+		 .tst_fn = setbits_22_7},
+		{.name = "GP_SET_BITS off=23 len=7",
+		 .tst_fn = setbits_23_7},
+		{.name = "GP_SET_BITS off=24 len=7",
+		 .tst_fn = setbits_24_7},
+		{.name = "GP_SET_BITS off=25 len=7",
+		 .tst_fn = setbits_25_7},
+		{.name = "GP_SET_BITS off=0 len=8",
+		 .tst_fn = setbits_0_8},
+		{.name = "GP_SET_BITS off=1 len=8",
+		 .tst_fn = setbits_1_8},
+		{.name = "GP_SET_BITS off=2 len=8",
+		 .tst_fn = setbits_2_8},
+		{.name = "GP_SET_BITS off=3 len=8",
+		 .tst_fn = setbits_3_8},
+		{.name = "GP_SET_BITS off=4 len=8",
+		 .tst_fn = setbits_4_8},
+		{.name = "GP_SET_BITS off=5 len=8",
+		 .tst_fn = setbits_5_8},
+		{.name = "GP_SET_BITS off=6 len=8",
+		 .tst_fn = setbits_6_8},
+		{.name = "GP_SET_BITS off=7 len=8",
+		 .tst_fn = setbits_7_8},
+		{.name = "GP_SET_BITS off=8 len=8",
+		 .tst_fn = setbits_8_8},
+		{.name = "GP_SET_BITS off=9 len=8",
+		 .tst_fn = setbits_9_8},
+		{.name = "GP_SET_BITS off=10 len=8",
+		 .tst_fn = setbits_10_8},
+		{.name = "GP_SET_BITS off=11 len=8",
+		 .tst_fn = setbits_11_8},
+		{.name = "GP_SET_BITS off=12 len=8",
+		 .tst_fn = setbits_12_8},
+		{.name = "GP_SET_BITS off=13 len=8",
+		 .tst_fn = setbits_13_8},
+		{.name = "GP_SET_BITS off=14 len=8",
+		 .tst_fn = setbits_14_8},
+		{.name = "GP_SET_BITS off=15 len=8",
+		 .tst_fn = setbits_15_8},
+		{.name = "GP_SET_BITS off=16 len=8",
+		 .tst_fn = setbits_16_8},
+		{.name = "GP_SET_BITS off=17 len=8",
+		 .tst_fn = setbits_17_8},
+		{.name = "GP_SET_BITS off=18 len=8",
+		 .tst_fn = setbits_18_8},
+		{.name = "GP_SET_BITS off=19 len=8",
+		 .tst_fn = setbits_19_8},
+		{.name = "GP_SET_BITS off=20 len=8",
+		 .tst_fn = setbits_20_8},
+		{.name = "GP_SET_BITS off=21 len=8",
+		 .tst_fn = setbits_21_8},
+		{.name = "GP_SET_BITS off=22 len=8",
+		 .tst_fn = setbits_22_8},
+		{.name = "GP_SET_BITS off=23 len=8",
+		 .tst_fn = setbits_23_8},
+		{.name = "GP_SET_BITS off=24 len=8",
+		 .tst_fn = setbits_24_8},
+		{.name = "GP_SET_BITS off=0 len=9",
+		 .tst_fn = setbits_0_9},
+		{.name = "GP_SET_BITS off=1 len=9",
+		 .tst_fn = setbits_1_9},
+		{.name = "GP_SET_BITS off=2 len=9",
+		 .tst_fn = setbits_2_9},
+		{.name = "GP_SET_BITS off=3 len=9",
+		 .tst_fn = setbits_3_9},
+		{.name = "GP_SET_BITS off=4 len=9",
+		 .tst_fn = setbits_4_9},
+		{.name = "GP_SET_BITS off=5 len=9",
+		 .tst_fn = setbits_5_9},
+		{.name = "GP_SET_BITS off=6 len=9",
+		 .tst_fn = setbits_6_9},
+		{.name = "GP_SET_BITS off=7 len=9",
+		 .tst_fn = setbits_7_9},
+		{.name = "GP_SET_BITS off=8 len=9",
+		 .tst_fn = setbits_8_9},
+		{.name = "GP_SET_BITS off=9 len=9",
+		 .tst_fn = setbits_9_9},
+		{.name = "GP_SET_BITS off=10 len=9",
+		 .tst_fn = setbits_10_9},
+		{.name = "GP_SET_BITS off=11 len=9",
+		 .tst_fn = setbits_11_9},
+		{.name = "GP_SET_BITS off=12 len=9",
+		 .tst_fn = setbits_12_9},
+		{.name = "GP_SET_BITS off=13 len=9",
+		 .tst_fn = setbits_13_9},
+		{.name = "GP_SET_BITS off=14 len=9",
+		 .tst_fn = setbits_14_9},
+		{.name = "GP_SET_BITS off=15 len=9",
+		 .tst_fn = setbits_15_9},
+		{.name = "GP_SET_BITS off=16 len=9",
+		 .tst_fn = setbits_16_9},
+		{.name = "GP_SET_BITS off=17 len=9",
+		 .tst_fn = setbits_17_9},
+		{.name = "GP_SET_BITS off=18 len=9",
+		 .tst_fn = setbits_18_9},
+		{.name = "GP_SET_BITS off=19 len=9",
+		 .tst_fn = setbits_19_9},
+		{.name = "GP_SET_BITS off=20 len=9",
+		 .tst_fn = setbits_20_9},
+		{.name = "GP_SET_BITS off=21 len=9",
+		 .tst_fn = setbits_21_9},
+		{.name = "GP_SET_BITS off=22 len=9",
+		 .tst_fn = setbits_22_9},
+		{.name = "GP_SET_BITS off=23 len=9",
+		 .tst_fn = setbits_23_9},
+		{.name = "GP_SET_BITS off=0 len=10",
+		 .tst_fn = setbits_0_10},
+		{.name = "GP_SET_BITS off=1 len=10",
+		 .tst_fn = setbits_1_10},
+		{.name = "GP_SET_BITS off=2 len=10",
+		 .tst_fn = setbits_2_10},
+		{.name = "GP_SET_BITS off=3 len=10",
+		 .tst_fn = setbits_3_10},
+		{.name = "GP_SET_BITS off=4 len=10",
+		 .tst_fn = setbits_4_10},
+		{.name = "GP_SET_BITS off=5 len=10",
+		 .tst_fn = setbits_5_10},
+		{.name = "GP_SET_BITS off=6 len=10",
+		 .tst_fn = setbits_6_10},
+		{.name = "GP_SET_BITS off=7 len=10",
+		 .tst_fn = setbits_7_10},
+		{.name = "GP_SET_BITS off=8 len=10",
+		 .tst_fn = setbits_8_10},
+		{.name = "GP_SET_BITS off=9 len=10",
+		 .tst_fn = setbits_9_10},
+		{.name = "GP_SET_BITS off=10 len=10",
+		 .tst_fn = setbits_10_10},
+		{.name = "GP_SET_BITS off=11 len=10",
+		 .tst_fn = setbits_11_10},
+		{.name = "GP_SET_BITS off=12 len=10",
+		 .tst_fn = setbits_12_10},
+		{.name = "GP_SET_BITS off=13 len=10",
+		 .tst_fn = setbits_13_10},
+		{.name = "GP_SET_BITS off=14 len=10",
+		 .tst_fn = setbits_14_10},
+		{.name = "GP_SET_BITS off=15 len=10",
+		 .tst_fn = setbits_15_10},
+		{.name = "GP_SET_BITS off=16 len=10",
+		 .tst_fn = setbits_16_10},
+		{.name = "GP_SET_BITS off=17 len=10",
+		 .tst_fn = setbits_17_10},
+		{.name = "GP_SET_BITS off=18 len=10",
+		 .tst_fn = setbits_18_10},
+		{.name = "GP_SET_BITS off=19 len=10",
+		 .tst_fn = setbits_19_10},
+		{.name = "GP_SET_BITS off=20 len=10",
+		 .tst_fn = setbits_20_10},
+		{.name = "GP_SET_BITS off=21 len=10",
+		 .tst_fn = setbits_21_10},
+		{.name = "GP_SET_BITS off=22 len=10",
+		 .tst_fn = setbits_22_10},
+		{.name = "GP_SET_BITS off=0 len=11",
+		 .tst_fn = setbits_0_11},
+		{.name = "GP_SET_BITS off=1 len=11",
+		 .tst_fn = setbits_1_11},
+		{.name = "GP_SET_BITS off=2 len=11",
+		 .tst_fn = setbits_2_11},
+		{.name = "GP_SET_BITS off=3 len=11",
+		 .tst_fn = setbits_3_11},
+		{.name = "GP_SET_BITS off=4 len=11",
+		 .tst_fn = setbits_4_11},
+		{.name = "GP_SET_BITS off=5 len=11",
+		 .tst_fn = setbits_5_11},
+		{.name = "GP_SET_BITS off=6 len=11",
+		 .tst_fn = setbits_6_11},
+		{.name = "GP_SET_BITS off=7 len=11",
+		 .tst_fn = setbits_7_11},
+		{.name = "GP_SET_BITS off=8 len=11",
+		 .tst_fn = setbits_8_11},
+		{.name = "GP_SET_BITS off=9 len=11",
+		 .tst_fn = setbits_9_11},
+		{.name = "GP_SET_BITS off=10 len=11",
+		 .tst_fn = setbits_10_11},
+		{.name = "GP_SET_BITS off=11 len=11",
+		 .tst_fn = setbits_11_11},
+		{.name = "GP_SET_BITS off=12 len=11",
+		 .tst_fn = setbits_12_11},
+		{.name = "GP_SET_BITS off=13 len=11",
+		 .tst_fn = setbits_13_11},
+		{.name = "GP_SET_BITS off=14 len=11",
+		 .tst_fn = setbits_14_11},
+		{.name = "GP_SET_BITS off=15 len=11",
+		 .tst_fn = setbits_15_11},
+		{.name = "GP_SET_BITS off=16 len=11",
+		 .tst_fn = setbits_16_11},
+		{.name = "GP_SET_BITS off=17 len=11",
+		 .tst_fn = setbits_17_11},
+		{.name = "GP_SET_BITS off=18 len=11",
+		 .tst_fn = setbits_18_11},
+		{.name = "GP_SET_BITS off=19 len=11",
+		 .tst_fn = setbits_19_11},
+		{.name = "GP_SET_BITS off=20 len=11",
+		 .tst_fn = setbits_20_11},
+		{.name = "GP_SET_BITS off=21 len=11",
+		 .tst_fn = setbits_21_11},
+		{.name = "GP_SET_BITS off=0 len=12",
+		 .tst_fn = setbits_0_12},
+		{.name = "GP_SET_BITS off=1 len=12",
+		 .tst_fn = setbits_1_12},
+		{.name = "GP_SET_BITS off=2 len=12",
+		 .tst_fn = setbits_2_12},
+		{.name = "GP_SET_BITS off=3 len=12",
+		 .tst_fn = setbits_3_12},
+		{.name = "GP_SET_BITS off=4 len=12",
+		 .tst_fn = setbits_4_12},
+		{.name = "GP_SET_BITS off=5 len=12",
+		 .tst_fn = setbits_5_12},
+		{.name = "GP_SET_BITS off=6 len=12",
+		 .tst_fn = setbits_6_12},
+		{.name = "GP_SET_BITS off=7 len=12",
+		 .tst_fn = setbits_7_12},
+		{.name = "GP_SET_BITS off=8 len=12",
+		 .tst_fn = setbits_8_12},
+		{.name = "GP_SET_BITS off=9 len=12",
+		 .tst_fn = setbits_9_12},
+		{.name = "GP_SET_BITS off=10 len=12",
+		 .tst_fn = setbits_10_12},
+		{.name = "GP_SET_BITS off=11 len=12",
+		 .tst_fn = setbits_11_12},
+		{.name = "GP_SET_BITS off=12 len=12",
+		 .tst_fn = setbits_12_12},
+		{.name = "GP_SET_BITS off=13 len=12",
+		 .tst_fn = setbits_13_12},
+		{.name = "GP_SET_BITS off=14 len=12",
+		 .tst_fn = setbits_14_12},
+		{.name = "GP_SET_BITS off=15 len=12",
+		 .tst_fn = setbits_15_12},
+		{.name = "GP_SET_BITS off=16 len=12",
+		 .tst_fn = setbits_16_12},
+		{.name = "GP_SET_BITS off=17 len=12",
+		 .tst_fn = setbits_17_12},
+		{.name = "GP_SET_BITS off=18 len=12",
+		 .tst_fn = setbits_18_12},
+		{.name = "GP_SET_BITS off=19 len=12",
+		 .tst_fn = setbits_19_12},
+		{.name = "GP_SET_BITS off=20 len=12",
+		 .tst_fn = setbits_20_12},
+		{.name = "GP_SET_BITS off=0 len=13",
+		 .tst_fn = setbits_0_13},
+		{.name = "GP_SET_BITS off=1 len=13",
+		 .tst_fn = setbits_1_13},
+		{.name = "GP_SET_BITS off=2 len=13",
+		 .tst_fn = setbits_2_13},
+		{.name = "GP_SET_BITS off=3 len=13",
+		 .tst_fn = setbits_3_13},
+		{.name = "GP_SET_BITS off=4 len=13",
+		 .tst_fn = setbits_4_13},
+		{.name = "GP_SET_BITS off=5 len=13",
+		 .tst_fn = setbits_5_13},
+		{.name = "GP_SET_BITS off=6 len=13",
+		 .tst_fn = setbits_6_13},
+		{.name = "GP_SET_BITS off=7 len=13",
+		 .tst_fn = setbits_7_13},
+		{.name = "GP_SET_BITS off=8 len=13",
+		 .tst_fn = setbits_8_13},
+		{.name = "GP_SET_BITS off=9 len=13",
+		 .tst_fn = setbits_9_13},
+		{.name = "GP_SET_BITS off=10 len=13",
+		 .tst_fn = setbits_10_13},
+		{.name = "GP_SET_BITS off=11 len=13",
+		 .tst_fn = setbits_11_13},
+		{.name = "GP_SET_BITS off=12 len=13",
+		 .tst_fn = setbits_12_13},
+		{.name = "GP_SET_BITS off=13 len=13",
+		 .tst_fn = setbits_13_13},
+		{.name = "GP_SET_BITS off=14 len=13",
+		 .tst_fn = setbits_14_13},
+		{.name = "GP_SET_BITS off=15 len=13",
+		 .tst_fn = setbits_15_13},
+		{.name = "GP_SET_BITS off=16 len=13",
+		 .tst_fn = setbits_16_13},
+		{.name = "GP_SET_BITS off=17 len=13",
+		 .tst_fn = setbits_17_13},
+		{.name = "GP_SET_BITS off=18 len=13",
+		 .tst_fn = setbits_18_13},
+		{.name = "GP_SET_BITS off=19 len=13",
+		 .tst_fn = setbits_19_13},
+		{.name = "GP_SET_BITS off=0 len=14",
+		 .tst_fn = setbits_0_14},
+		{.name = "GP_SET_BITS off=1 len=14",
+		 .tst_fn = setbits_1_14},
+		{.name = "GP_SET_BITS off=2 len=14",
+		 .tst_fn = setbits_2_14},
+		{.name = "GP_SET_BITS off=3 len=14",
+		 .tst_fn = setbits_3_14},
+		{.name = "GP_SET_BITS off=4 len=14",
+		 .tst_fn = setbits_4_14},
+		{.name = "GP_SET_BITS off=5 len=14",
+		 .tst_fn = setbits_5_14},
+		{.name = "GP_SET_BITS off=6 len=14",
+		 .tst_fn = setbits_6_14},
+		{.name = "GP_SET_BITS off=7 len=14",
+		 .tst_fn = setbits_7_14},
+		{.name = "GP_SET_BITS off=8 len=14",
+		 .tst_fn = setbits_8_14},
+		{.name = "GP_SET_BITS off=9 len=14",
+		 .tst_fn = setbits_9_14},
+		{.name = "GP_SET_BITS off=10 len=14",
+		 .tst_fn = setbits_10_14},
+		{.name = "GP_SET_BITS off=11 len=14",
+		 .tst_fn = setbits_11_14},
+		{.name = "GP_SET_BITS off=12 len=14",
+		 .tst_fn = setbits_12_14},
+		{.name = "GP_SET_BITS off=13 len=14",
+		 .tst_fn = setbits_13_14},
+		{.name = "GP_SET_BITS off=14 len=14",
+		 .tst_fn = setbits_14_14},
+		{.name = "GP_SET_BITS off=15 len=14",
+		 .tst_fn = setbits_15_14},
+		{.name = "GP_SET_BITS off=16 len=14",
+		 .tst_fn = setbits_16_14},
+		{.name = "GP_SET_BITS off=17 len=14",
+		 .tst_fn = setbits_17_14},
+		{.name = "GP_SET_BITS off=18 len=14",
+		 .tst_fn = setbits_18_14},
+		{.name = "GP_SET_BITS off=0 len=15",
+		 .tst_fn = setbits_0_15},
+		{.name = "GP_SET_BITS off=1 len=15",
+		 .tst_fn = setbits_1_15},
+		{.name = "GP_SET_BITS off=2 len=15",
+		 .tst_fn = setbits_2_15},
+		{.name = "GP_SET_BITS off=3 len=15",
+		 .tst_fn = setbits_3_15},
+		{.name = "GP_SET_BITS off=4 len=15",
+		 .tst_fn = setbits_4_15},
+		{.name = "GP_SET_BITS off=5 len=15",
+		 .tst_fn = setbits_5_15},
+		{.name = "GP_SET_BITS off=6 len=15",
+		 .tst_fn = setbits_6_15},
+		{.name = "GP_SET_BITS off=7 len=15",
+		 .tst_fn = setbits_7_15},
+		{.name = "GP_SET_BITS off=8 len=15",
+		 .tst_fn = setbits_8_15},
+		{.name = "GP_SET_BITS off=9 len=15",
+		 .tst_fn = setbits_9_15},
+		{.name = "GP_SET_BITS off=10 len=15",
+		 .tst_fn = setbits_10_15},
+		{.name = "GP_SET_BITS off=11 len=15",
+		 .tst_fn = setbits_11_15},
+		{.name = "GP_SET_BITS off=12 len=15",
+		 .tst_fn = setbits_12_15},
+		{.name = "GP_SET_BITS off=13 len=15",
+		 .tst_fn = setbits_13_15},
+		{.name = "GP_SET_BITS off=14 len=15",
+		 .tst_fn = setbits_14_15},
+		{.name = "GP_SET_BITS off=15 len=15",
+		 .tst_fn = setbits_15_15},
+		{.name = "GP_SET_BITS off=16 len=15",
+		 .tst_fn = setbits_16_15},
+		{.name = "GP_SET_BITS off=17 len=15",
+		 .tst_fn = setbits_17_15},
+		{.name = "GP_SET_BITS off=0 len=16",
+		 .tst_fn = setbits_0_16},
+		{.name = "GP_SET_BITS off=1 len=16",
+		 .tst_fn = setbits_1_16},
+		{.name = "GP_SET_BITS off=2 len=16",
+		 .tst_fn = setbits_2_16},
+		{.name = "GP_SET_BITS off=3 len=16",
+		 .tst_fn = setbits_3_16},
+		{.name = "GP_SET_BITS off=4 len=16",
+		 .tst_fn = setbits_4_16},
+		{.name = "GP_SET_BITS off=5 len=16",
+		 .tst_fn = setbits_5_16},
+		{.name = "GP_SET_BITS off=6 len=16",
+		 .tst_fn = setbits_6_16},
+		{.name = "GP_SET_BITS off=7 len=16",
+		 .tst_fn = setbits_7_16},
+		{.name = "GP_SET_BITS off=8 len=16",
+		 .tst_fn = setbits_8_16},
+		{.name = "GP_SET_BITS off=9 len=16",
+		 .tst_fn = setbits_9_16},
+		{.name = "GP_SET_BITS off=10 len=16",
+		 .tst_fn = setbits_10_16},
+		{.name = "GP_SET_BITS off=11 len=16",
+		 .tst_fn = setbits_11_16},
+		{.name = "GP_SET_BITS off=12 len=16",
+		 .tst_fn = setbits_12_16},
+		{.name = "GP_SET_BITS off=13 len=16",
+		 .tst_fn = setbits_13_16},
+		{.name = "GP_SET_BITS off=14 len=16",
+		 .tst_fn = setbits_14_16},
+		{.name = "GP_SET_BITS off=15 len=16",
+		 .tst_fn = setbits_15_16},
+		{.name = "GP_SET_BITS off=16 len=16",
+		 .tst_fn = setbits_16_16},
+		{.name = "GP_SET_BITS off=0 len=17",
+		 .tst_fn = setbits_0_17},
+		{.name = "GP_SET_BITS off=1 len=17",
+		 .tst_fn = setbits_1_17},
+		{.name = "GP_SET_BITS off=2 len=17",
+		 .tst_fn = setbits_2_17},
+		{.name = "GP_SET_BITS off=3 len=17",
+		 .tst_fn = setbits_3_17},
+		{.name = "GP_SET_BITS off=4 len=17",
+		 .tst_fn = setbits_4_17},
+		{.name = "GP_SET_BITS off=5 len=17",
+		 .tst_fn = setbits_5_17},
+		{.name = "GP_SET_BITS off=6 len=17",
+		 .tst_fn = setbits_6_17},
+		{.name = "GP_SET_BITS off=7 len=17",
+		 .tst_fn = setbits_7_17},
+		{.name = "GP_SET_BITS off=8 len=17",
+		 .tst_fn = setbits_8_17},
+		{.name = "GP_SET_BITS off=9 len=17",
+		 .tst_fn = setbits_9_17},
+		{.name = "GP_SET_BITS off=10 len=17",
+		 .tst_fn = setbits_10_17},
+		{.name = "GP_SET_BITS off=11 len=17",
+		 .tst_fn = setbits_11_17},
+		{.name = "GP_SET_BITS off=12 len=17",
+		 .tst_fn = setbits_12_17},
+		{.name = "GP_SET_BITS off=13 len=17",
+		 .tst_fn = setbits_13_17},
+		{.name = "GP_SET_BITS off=14 len=17",
+		 .tst_fn = setbits_14_17},
+		{.name = "GP_SET_BITS off=15 len=17",
+		 .tst_fn = setbits_15_17},
+		{.name = "GP_SET_BITS off=0 len=18",
+		 .tst_fn = setbits_0_18},
+		{.name = "GP_SET_BITS off=1 len=18",
+		 .tst_fn = setbits_1_18},
+		{.name = "GP_SET_BITS off=2 len=18",
+		 .tst_fn = setbits_2_18},
+		{.name = "GP_SET_BITS off=3 len=18",
+		 .tst_fn = setbits_3_18},
+		{.name = "GP_SET_BITS off=4 len=18",
+		 .tst_fn = setbits_4_18},
+		{.name = "GP_SET_BITS off=5 len=18",
+		 .tst_fn = setbits_5_18},
+		{.name = "GP_SET_BITS off=6 len=18",
+		 .tst_fn = setbits_6_18},
+		{.name = "GP_SET_BITS off=7 len=18",
+		 .tst_fn = setbits_7_18},
+		{.name = "GP_SET_BITS off=8 len=18",
+		 .tst_fn = setbits_8_18},
+		{.name = "GP_SET_BITS off=9 len=18",
+		 .tst_fn = setbits_9_18},
+		{.name = "GP_SET_BITS off=10 len=18",
+		 .tst_fn = setbits_10_18},
+		{.name = "GP_SET_BITS off=11 len=18",
+		 .tst_fn = setbits_11_18},
+		{.name = "GP_SET_BITS off=12 len=18",
+		 .tst_fn = setbits_12_18},
+		{.name = "GP_SET_BITS off=13 len=18",
+		 .tst_fn = setbits_13_18},
+		{.name = "GP_SET_BITS off=14 len=18",
+		 .tst_fn = setbits_14_18},
+		{.name = "GP_SET_BITS off=0 len=19",
+		 .tst_fn = setbits_0_19},
+		{.name = "GP_SET_BITS off=1 len=19",
+		 .tst_fn = setbits_1_19},
+		{.name = "GP_SET_BITS off=2 len=19",
+		 .tst_fn = setbits_2_19},
+		{.name = "GP_SET_BITS off=3 len=19",
+		 .tst_fn = setbits_3_19},
+		{.name = "GP_SET_BITS off=4 len=19",
+		 .tst_fn = setbits_4_19},
+		{.name = "GP_SET_BITS off=5 len=19",
+		 .tst_fn = setbits_5_19},
+		{.name = "GP_SET_BITS off=6 len=19",
+		 .tst_fn = setbits_6_19},
+		{.name = "GP_SET_BITS off=7 len=19",
+		 .tst_fn = setbits_7_19},
+		{.name = "GP_SET_BITS off=8 len=19",
+		 .tst_fn = setbits_8_19},
+		{.name = "GP_SET_BITS off=9 len=19",
+		 .tst_fn = setbits_9_19},
+		{.name = "GP_SET_BITS off=10 len=19",
+		 .tst_fn = setbits_10_19},
+		{.name = "GP_SET_BITS off=11 len=19",
+		 .tst_fn = setbits_11_19},
+		{.name = "GP_SET_BITS off=12 len=19",
+		 .tst_fn = setbits_12_19},
+		{.name = "GP_SET_BITS off=13 len=19",
+		 .tst_fn = setbits_13_19},
+		{.name = "GP_SET_BITS off=0 len=20",
+		 .tst_fn = setbits_0_20},
+		{.name = "GP_SET_BITS off=1 len=20",
+		 .tst_fn = setbits_1_20},
+		{.name = "GP_SET_BITS off=2 len=20",
+		 .tst_fn = setbits_2_20},
+		{.name = "GP_SET_BITS off=3 len=20",
+		 .tst_fn = setbits_3_20},
+		{.name = "GP_SET_BITS off=4 len=20",
+		 .tst_fn = setbits_4_20},
+		{.name = "GP_SET_BITS off=5 len=20",
+		 .tst_fn = setbits_5_20},
+		{.name = "GP_SET_BITS off=6 len=20",
+		 .tst_fn = setbits_6_20},
+		{.name = "GP_SET_BITS off=7 len=20",
+		 .tst_fn = setbits_7_20},
+		{.name = "GP_SET_BITS off=8 len=20",
+		 .tst_fn = setbits_8_20},
+		{.name = "GP_SET_BITS off=9 len=20",
+		 .tst_fn = setbits_9_20},
+		{.name = "GP_SET_BITS off=10 len=20",
+		 .tst_fn = setbits_10_20},
+		{.name = "GP_SET_BITS off=11 len=20",
+		 .tst_fn = setbits_11_20},
+		{.name = "GP_SET_BITS off=12 len=20",
+		 .tst_fn = setbits_12_20},
+		{.name = "GP_SET_BITS off=0 len=21",
+		 .tst_fn = setbits_0_21},
+		{.name = "GP_SET_BITS off=1 len=21",
+		 .tst_fn = setbits_1_21},
+		{.name = "GP_SET_BITS off=2 len=21",
+		 .tst_fn = setbits_2_21},
+		{.name = "GP_SET_BITS off=3 len=21",
+		 .tst_fn = setbits_3_21},
+		{.name = "GP_SET_BITS off=4 len=21",
+		 .tst_fn = setbits_4_21},
+		{.name = "GP_SET_BITS off=5 len=21",
+		 .tst_fn = setbits_5_21},
+		{.name = "GP_SET_BITS off=6 len=21",
+		 .tst_fn = setbits_6_21},
+		{.name = "GP_SET_BITS off=7 len=21",
+		 .tst_fn = setbits_7_21},
+		{.name = "GP_SET_BITS off=8 len=21",
+		 .tst_fn = setbits_8_21},
+		{.name = "GP_SET_BITS off=9 len=21",
+		 .tst_fn = setbits_9_21},
+		{.name = "GP_SET_BITS off=10 len=21",
+		 .tst_fn = setbits_10_21},
+		{.name = "GP_SET_BITS off=11 len=21",
+		 .tst_fn = setbits_11_21},
+		{.name = "GP_SET_BITS off=0 len=22",
+		 .tst_fn = setbits_0_22},
+		{.name = "GP_SET_BITS off=1 len=22",
+		 .tst_fn = setbits_1_22},
+		{.name = "GP_SET_BITS off=2 len=22",
+		 .tst_fn = setbits_2_22},
+		{.name = "GP_SET_BITS off=3 len=22",
+		 .tst_fn = setbits_3_22},
+		{.name = "GP_SET_BITS off=4 len=22",
+		 .tst_fn = setbits_4_22},
+		{.name = "GP_SET_BITS off=5 len=22",
+		 .tst_fn = setbits_5_22},
+		{.name = "GP_SET_BITS off=6 len=22",
+		 .tst_fn = setbits_6_22},
+		{.name = "GP_SET_BITS off=7 len=22",
+		 .tst_fn = setbits_7_22},
+		{.name = "GP_SET_BITS off=8 len=22",
+		 .tst_fn = setbits_8_22},
+		{.name = "GP_SET_BITS off=9 len=22",
+		 .tst_fn = setbits_9_22},
+		{.name = "GP_SET_BITS off=10 len=22",
+		 .tst_fn = setbits_10_22},
+		{.name = "GP_SET_BITS off=0 len=23",
+		 .tst_fn = setbits_0_23},
+		{.name = "GP_SET_BITS off=1 len=23",
+		 .tst_fn = setbits_1_23},
+		{.name = "GP_SET_BITS off=2 len=23",
+		 .tst_fn = setbits_2_23},
+		{.name = "GP_SET_BITS off=3 len=23",
+		 .tst_fn = setbits_3_23},
+		{.name = "GP_SET_BITS off=4 len=23",
+		 .tst_fn = setbits_4_23},
+		{.name = "GP_SET_BITS off=5 len=23",
+		 .tst_fn = setbits_5_23},
+		{.name = "GP_SET_BITS off=6 len=23",
+		 .tst_fn = setbits_6_23},
+		{.name = "GP_SET_BITS off=7 len=23",
+		 .tst_fn = setbits_7_23},
+		{.name = "GP_SET_BITS off=8 len=23",
+		 .tst_fn = setbits_8_23},
+		{.name = "GP_SET_BITS off=9 len=23",
+		 .tst_fn = setbits_9_23},
+		{.name = "GP_SET_BITS off=0 len=24",
+		 .tst_fn = setbits_0_24},
+		{.name = "GP_SET_BITS off=1 len=24",
+		 .tst_fn = setbits_1_24},
+		{.name = "GP_SET_BITS off=2 len=24",
+		 .tst_fn = setbits_2_24},
+		{.name = "GP_SET_BITS off=3 len=24",
+		 .tst_fn = setbits_3_24},
+		{.name = "GP_SET_BITS off=4 len=24",
+		 .tst_fn = setbits_4_24},
+		{.name = "GP_SET_BITS off=5 len=24",
+		 .tst_fn = setbits_5_24},
+		{.name = "GP_SET_BITS off=6 len=24",
+		 .tst_fn = setbits_6_24},
+		{.name = "GP_SET_BITS off=7 len=24",
+		 .tst_fn = setbits_7_24},
+		{.name = "GP_SET_BITS off=8 len=24",
+		 .tst_fn = setbits_8_24},
+		{.name = "GP_SET_BITS off=0 len=25",
+		 .tst_fn = setbits_0_25},
+		{.name = "GP_SET_BITS off=1 len=25",
+		 .tst_fn = setbits_1_25},
+		{.name = "GP_SET_BITS off=2 len=25",
+		 .tst_fn = setbits_2_25},
+		{.name = "GP_SET_BITS off=3 len=25",
+		 .tst_fn = setbits_3_25},
+		{.name = "GP_SET_BITS off=4 len=25",
+		 .tst_fn = setbits_4_25},
+		{.name = "GP_SET_BITS off=5 len=25",
+		 .tst_fn = setbits_5_25},
+		{.name = "GP_SET_BITS off=6 len=25",
+		 .tst_fn = setbits_6_25},
+		{.name = "GP_SET_BITS off=7 len=25",
+		 .tst_fn = setbits_7_25},
+		{.name = "GP_SET_BITS off=0 len=26",
+		 .tst_fn = setbits_0_26},
+		{.name = "GP_SET_BITS off=1 len=26",
+		 .tst_fn = setbits_1_26},
+		{.name = "GP_SET_BITS off=2 len=26",
+		 .tst_fn = setbits_2_26},
+		{.name = "GP_SET_BITS off=3 len=26",
+		 .tst_fn = setbits_3_26},
+		{.name = "GP_SET_BITS off=4 len=26",
+		 .tst_fn = setbits_4_26},
+		{.name = "GP_SET_BITS off=5 len=26",
+		 .tst_fn = setbits_5_26},
+		{.name = "GP_SET_BITS off=6 len=26",
+		 .tst_fn = setbits_6_26},
+		{.name = "GP_SET_BITS off=0 len=27",
+		 .tst_fn = setbits_0_27},
+		{.name = "GP_SET_BITS off=1 len=27",
+		 .tst_fn = setbits_1_27},
+		{.name = "GP_SET_BITS off=2 len=27",
+		 .tst_fn = setbits_2_27},
+		{.name = "GP_SET_BITS off=3 len=27",
+		 .tst_fn = setbits_3_27},
+		{.name = "GP_SET_BITS off=4 len=27",
+		 .tst_fn = setbits_4_27},
+		{.name = "GP_SET_BITS off=5 len=27",
+		 .tst_fn = setbits_5_27},
+		{.name = "GP_SET_BITS off=0 len=28",
+		 .tst_fn = setbits_0_28},
+		{.name = "GP_SET_BITS off=1 len=28",
+		 .tst_fn = setbits_1_28},
+		{.name = "GP_SET_BITS off=2 len=28",
+		 .tst_fn = setbits_2_28},
+		{.name = "GP_SET_BITS off=3 len=28",
+		 .tst_fn = setbits_3_28},
+		{.name = "GP_SET_BITS off=4 len=28",
+		 .tst_fn = setbits_4_28},
+		{.name = "GP_SET_BITS off=0 len=29",
+		 .tst_fn = setbits_0_29},
+		{.name = "GP_SET_BITS off=1 len=29",
+		 .tst_fn = setbits_1_29},
+		{.name = "GP_SET_BITS off=2 len=29",
+		 .tst_fn = setbits_2_29},
+		{.name = "GP_SET_BITS off=3 len=29",
+		 .tst_fn = setbits_3_29},
+		{.name = "GP_SET_BITS off=0 len=30",
+		 .tst_fn = setbits_0_30},
+		{.name = "GP_SET_BITS off=1 len=30",
+		 .tst_fn = setbits_1_30},
+		{.name = "GP_SET_BITS off=2 len=30",
+		 .tst_fn = setbits_2_30},
+		{.name = "GP_SET_BITS off=0 len=31",
+		 .tst_fn = setbits_0_31},
+		{.name = "GP_SET_BITS off=1 len=31",
+		 .tst_fn = setbits_1_31},
+		{.name = "GP_SET_BITS off=0 len=32",
+		 .tst_fn = setbits_0_32},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,312 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2012 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <errno.h>
+#include <string.h>
+#include <core/gp_threads.h>
+#include "tst_test.h"
+
+#define ROWS 1000
+
+static unsigned int threads_1 = 1;
+static unsigned int threads_4 = 4;
+static unsigned int threads_16 = 16;
+
+struct rows_cnt {
+	unsigned int cnt[ROWS];
+	int fail_at;
+};
+
+static int count_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct rows_cnt *rows = priv;
+	gp_size i;
+
+	for (i = 0; i < h; i++) {
+		if ((int)(y + i) == rows->fail_at) {
+			errno = ENOMEM;
+			return 1;
+		}
+
+		__sync_fetch_and_add(&rows->cnt[y + i], 1);
+	}
+
+	return 0;
+}
+
+static int check_rows(struct rows_cnt *rows)
+{
+	unsigned int i;
+
+	for (i = 0; i < ROWS; i++) {
+		if (rows->cnt[i] != 1) {
+			tst_msg("Row %u processed %u times", i, rows->cnt[i]);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int rows_threads(unsigned int *threads)
+{
+	struct rows_cnt rows = {.fail_at = -1};
+
+	if (gp_threads_rows(ROWS, *threads, count_rows, &rows, NULL)) {
+		tst_msg("gp_threads_rows() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (check_rows(&rows))
+		return TST_FAILED;
+
+	/* Second run reuses the pool */
+	memset(&rows, 0, sizeof(rows));
+	rows.fail_at = -1;
+
+	if (gp_threads_rows(ROWS, *threads, count_rows, &rows, NULL)) {
+		tst_msg("gp_threads_rows() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (check_rows(&rows))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int rows_bands(void)
+{
+	struct rows_cnt rows = {.fail_at = -1};
+	gp_size band_h;
+
+	/* Single row bands, lots of stealing */
+	if (gp_threads_rows_ex(ROWS, 8, 1, count_rows, &rows, NULL)) {
+		tst_msg("gp_threads_rows_ex() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (check_rows(&rows))
+		return TST_FAILED;
+
+	band_h = gp_threads_band_rows(ROWS, 4, 3 * 1000, 31 * 31, 31);
+
+	if (band_h < 31 || band_h > ROWS) {
+		tst_msg("Wrong band height %u", band_h);
+		return TST_FAILED;
+	}
+
+	/* Large kernel must not prevent splitting image of medium height */
+	if (gp_threads_band_rows(600, 4, 3 * 1000, 15 * 15, 15) > 600 / 4) {
+		tst_msg("Band height %u too large for 15x15 kernel",
+		        gp_threads_band_rows(600, 4, 3 * 1000, 15 * 15, 15));
+		return TST_FAILED;
+	}
+
+	memset(&rows, 0, sizeof(rows));
+	rows.fail_at = -1;
+
+	if (gp_threads_rows_ex(ROWS, 4, band_h, count_rows, &rows, NULL)) {
+		tst_msg("gp_threads_rows_ex() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (check_rows(&rows))
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int rows_error(void)
+{
+	struct rows_cnt rows = {.fail_at = ROWS/2};
+
+	errno = 0;
+
+	if (!gp_threads_rows(ROWS, 4, count_rows, &rows, NULL)) {
+		tst_msg("gp_threads_rows() succeeded");
+		return TST_FAILED;
+	}
+
+	if (errno != ENOMEM) {
+		tst_msg("Wrong errno %s (%i) expected ENOMEM",
+		        strerror(errno), errno);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int abort_callback(gp_progress_cb *self)
+{
+	(void)self;
+	return 1;
+}
+
+static int rows_abort(void)
+{
+	struct rows_cnt rows = {.fail_at = -1};
+	gp_progress_cb callback = {.callback = abort_callback};
+
+	errno = 0;
+
+	if (!gp_threads_rows(ROWS, 4, count_rows, &rows, &callback)) {
+		tst_msg("gp_threads_rows() succeeded");
+		return TST_FAILED;
+	}
+
+	if (errno != ECANCELED) {
+		tst_msg("Wrong errno %s (%i) expected ECANCELED",
+		        strerror(errno), errno);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int nested_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct rows_cnt *rows = priv;
+	gp_size i;
+
+	for (i = 0; i < h; i++) {
+		if (gp_threads_rows(ROWS, 4, count_rows, &rows[y + i], NULL))
+			return 1;
+	}
+
+	return 0;
+}
+
+static int rows_nested(void)
+{
+	struct rows_cnt rows[4];
+	int i;
+
+	memset(rows, 0, sizeof(rows));
+
+	for (i = 0; i < 4; i++)
+		rows[i].fail_at = -1;
+
+	if (gp_threads_rows(4, 4, nested_rows, rows, NULL)) {
+		tst_msg("gp_threads_rows() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < 4; i++) {
+		if (check_rows(&rows[i]))
+			return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+struct slots_job {
+	gp_threads_slots slots;
+	struct rows_cnt rows;
+};
+
+static int slots_rows(void *priv, gp_coord y, gp_size h)
+{
+	struct slots_job *job = priv;
+	unsigned int slot, *in_use;
+	int ret;
+
+	in_use = gp_threads_slot_get(&job->slots, &slot);
+	if (!in_use)
+		return 1;
+
+	/* The slot must not be used by a different band at the same time */
+	if (__sync_fetch_and_add(in_use, 1)) {
+		errno = EBUSY;
+		return 1;
+	}
+
+	ret = count_rows(&job->rows, y, h);
+
+	__sync_fetch_and_sub(in_use, 1);
+
+	gp_threads_slot_put(&job->slots, slot);
+
+	return ret;
+}
+
+static int rows_slots(void)
+{
+	struct slots_job job = {.rows = {.fail_at = -1}};
+	unsigned int i, slot;
+	int ret = TST_FAILED;
+
+	if (gp_threads_slots_alloc(&job.slots, 8, sizeof(unsigned int))) {
+		tst_msg("gp_threads_slots_alloc() failed: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_threads_rows_ex(ROWS, 8, 1, slots_rows, &job, NULL)) {
+		tst_msg("gp_threads_rows_ex() failed: %s", strerror(errno));
+		goto end;
+	}
+
+	if (check_rows(&job.rows))
+		goto end;
+
+	/* Less slots than threads */
+	for (i = 0; i < job.slots.nr; i++) {
+		if (!gp_threads_slot_get(&job.slots, &slot)) {
+			tst_msg("gp_threads_slot_get() failed: %s",
+			        strerror(errno));
+			goto end;
+		}
+	}
+
+	if (gp_threads_slot_get(&job.slots, &slot)) {
+		tst_msg("Got slot while all are taken");
+		goto end;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s (%i) expected EINVAL",
+		        strerror(errno), errno);
+		goto end;
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_threads_slots_free(&job.slots);
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "threads testsuite",
+	.tests = {
+		{.name = "rows 1 thread",
+		 .tst_fn = rows_threads,
+		 .data = &threads_1},
+
+		{.name = "rows 4 threads",
+		 .tst_fn = rows_threads,
+		 .data = &threads_4},
+
+		{.name = "rows 16 threads",
+		 .tst_fn = rows_threads,
+		 .data = &threads_16},
+
+		{.name = "rows bands",
+		 .tst_fn = rows_bands},
+
+		{.name = "rows error",
+		 .tst_fn = rows_error},
+
+		{.name = "rows abort",
+		 .tst_fn = rows_abort},
+
+		{.name = "rows nested",
+		 .tst_fn = rows_nested},
+
+		{.name = "rows slots",
+		 .tst_fn = rows_slots},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,19932 @@
+/*
+ * WritePixel tests.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+#include <core/gp_write_pixel.h>
+
+#include "tst_test.h"
+
+static void dump_buffer(const char *name, char *buf, unsigned int buf_len)
+{
+	unsigned int i;
+
+	printf("%s:\n{", name);
+
+	for (i = 0; i < buf_len; i++) {
+		printf("%i", !!buf[i]);
+
+		if (i != buf_len - 1)
+			printf(", ");
+
+		if (i % 26 == 25)
+			printf("\n ");
+	}
+
+	printf("}\n");
+}
+
+/*
+ * Compares two statically defined buffers
+ */
+#define COMPARE_BUFFERS(id, buf1, buf2) do {                  \
+	unsigned int buf_len = sizeof(buf2)/sizeof(*buf2);    \
+	unsigned int i;                                       \
+                                                              \
+	                                                      \
+	for (i = 0; i < buf_len; i++)                         \
+		if(buf1[i] != buf2[i]) {	              \
+			printf("%s\n", id);                   \
+			dump_buffer("wrote", buf1, buf_len);  \
+			dump_buffer("gen", buf2, buf_len);    \
+			tst_msg("Buffers are different");     \
+			return TST_FAILED;                    \
+		}                                             \
+	                                                      \
+	return TST_SUCCESS;                                   \
+} while (0)
+
+static int WritePixel_8_0_0_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 0, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_0_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_0_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 4, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_0_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_1_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_1_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_1_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_1_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_2_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_2_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_2_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_2_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_3_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_3_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_3_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_3_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_4_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_4_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_4_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_4_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_5_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_5_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_5_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_5_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_15_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_15_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_15_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_15_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_16_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_16_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_16_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_16_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_17_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_17_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_17_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_17_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_0_33_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 0, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_33_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 0, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_0_33_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 4, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_0_33_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 4, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=0 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_0_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 1, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_0_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_0_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 5, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_0_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_1_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_1_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_1_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_1_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_2_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_2_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_2_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_2_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_3_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_3_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_3_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_3_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_4_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_4_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_4_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_4_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_5_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_5_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_5_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_5_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_15_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_15_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_15_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_15_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_16_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_16_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_16_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_16_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_17_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_17_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_17_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_17_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_1_33_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 1, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_33_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 1, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_1_33_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 5, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_1_33_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 5, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=1 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_0_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 2, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_0_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_0_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 6, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_0_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_1_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_1_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_1_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_1_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_2_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_2_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_2_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_2_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_3_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_3_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_3_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_3_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_4_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_4_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_4_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_4_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_5_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_5_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_5_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_5_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_15_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_15_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_15_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_15_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_16_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_16_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_16_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_16_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_17_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_17_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_17_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_17_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_2_33_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 2, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_33_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 2, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_2_33_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 6, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_2_33_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 6, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=2 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_0_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 3, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_0_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_0_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_8BPP(write_buf + 7, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_0_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 0, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_1_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_1_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_1_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_1_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 1, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_2_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_2_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_2_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_2_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 2, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_3_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_3_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_3_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_3_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 3, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_4_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_4_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_4_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_4_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 4, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_5_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_5_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_5_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_5_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 5, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_15_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_15_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_15_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_15_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 15, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_16_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_16_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_16_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_16_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 16, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_17_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_17_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_17_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_17_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 17, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_8_3_33_0(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 3, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_33_0_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 3, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_8_3_33_4(void)
+{
+	char write_buf[40] = {};
+	char gen_buf[40] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+
+	gp_write_pixels_8BPP(write_buf + 7, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_8_3_33_4_alloc(void)
+{
+	char gen_buf[40] = {};
+	char *write_buf = malloc(40);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 40);
+
+	gp_write_pixels_8BPP(write_buf + 7, 33, 0xffffffff>>24);
+
+	COMPARE_BUFFERS("p=8 o=3 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_16_0_0_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 0, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_0_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_1_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_1_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_2_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_2_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_3_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_3_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_4_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_4_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_5_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_5_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_15_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_15_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_16_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_16_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_17_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_17_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_0_33_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 0, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_0_33_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 0, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=0 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_0_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 2, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_0_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_1_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_1_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_2_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_2_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_3_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_3_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_4_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_4_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_5_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_5_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_15_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_15_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_16_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_16_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_17_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_17_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_1_33_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 2, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_1_33_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 2, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=1 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_0_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 4, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_0_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_1_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_1_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_2_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_2_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_3_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_3_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_4_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_4_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_5_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_5_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_15_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_15_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_16_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_16_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_17_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_17_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_2_33_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 4, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_2_33_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 4, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=2 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_0_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_16BPP(write_buf + 6, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_0_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 0, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_1_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_1_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 1, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_2_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_2_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 2, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_3_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_3_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 3, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_4_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_4_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 4, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_5_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_5_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 5, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_15_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_15_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 15, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_16_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_16_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 16, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_17_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_17_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 17, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_16_3_33_0(void)
+{
+	char write_buf[80] = {};
+	char gen_buf[80] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	gp_write_pixels_16BPP(write_buf + 6, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_16_3_33_0_alloc(void)
+{
+	char gen_buf[80] = {};
+	char *write_buf = malloc(80);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 80);
+
+	gp_write_pixels_16BPP(write_buf + 6, 33, 0xffffffff>>16);
+
+	COMPARE_BUFFERS("p=16 o=3 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_0_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 0, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_0_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_0_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 4, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_0_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_1_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_1_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_1_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_1_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_2_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_2_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_2_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_2_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_3_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_3_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_3_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_3_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_4_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_4_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_4_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_4_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_5_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_5_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_5_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_5_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_15_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_15_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_15_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_15_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_16_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_16_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_16_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_16_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_17_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_17_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_17_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_17_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_0_33_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 0, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_33_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 0, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_0_33_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 4, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_0_33_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 4, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=0 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_0_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 3, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_0_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_0_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 7, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_0_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_1_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_1_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_1_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_1_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_2_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_2_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_2_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_2_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_3_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_3_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_3_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_3_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_4_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_4_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_4_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_4_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_5_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_5_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_5_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_5_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_15_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_15_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_15_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_15_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_16_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_16_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_16_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_16_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_17_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_17_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_17_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_17_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_1_33_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 3, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_33_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 3, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_1_33_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 7, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_1_33_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 7, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=1 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_0_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 6, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_0_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_0_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 10, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_0_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_1_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_1_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_1_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_1_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_2_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_2_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_2_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_2_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_3_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_3_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_3_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_3_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_4_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_4_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_4_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_4_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_5_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_5_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_5_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_5_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_15_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_15_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_15_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_15_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_16_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_16_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_16_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_16_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_17_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_17_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_17_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_17_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_2_33_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 6, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_33_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 6, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_2_33_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 10, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_2_33_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 10, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=2 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_0_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 9, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_0_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_0_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_24BPP(write_buf + 13, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_0_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 0, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=0 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_1_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_1_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_1_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_1_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 1, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=1 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_2_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_2_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_2_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_2_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 2, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=2 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_3_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_3_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_3_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_3_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 3, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=3 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_4_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_4_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_4_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_4_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 4, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=4 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_5_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_5_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_5_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_5_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 5, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=5 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_15_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_15_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_15_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=15 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_15_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 15, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=15 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_16_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_16_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_16_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=16 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_16_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 16, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=16 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_17_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_17_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_17_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=17 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_17_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 17, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=17 a=4", write_buf, gen_buf);
+}
+static int WritePixel_24_3_33_0(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 9, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_33_0_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 9, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_24_3_33_4(void)
+{
+	char write_buf[120] = {};
+	char gen_buf[120] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+
+	gp_write_pixels_24BPP(write_buf + 13, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=33 a=4", write_buf, gen_buf);
+}
+
+static int WritePixel_24_3_33_4_alloc(void)
+{
+	char gen_buf[120] = {};
+	char *write_buf = malloc(120);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 120);
+
+	gp_write_pixels_24BPP(write_buf + 13, 33, 0xffffffff>>8);
+
+	COMPARE_BUFFERS("p=24 o=3 l=33 a=4", write_buf, gen_buf);
+}
+static int WritePixel_32_0_0_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 0, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_0_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_1_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_1_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_2_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_2_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_3_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_3_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_4_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_4_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_5_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_5_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_15_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_15_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_16_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_16_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_17_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_17_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_0_33_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 0, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_0_33_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[0] = 0xff;
+	gen_buf[1] = 0xff;
+	gen_buf[2] = 0xff;
+	gen_buf[3] = 0xff;
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 0, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=0 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_0_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 4, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_0_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_1_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_1_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_2_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_2_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_3_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_3_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_4_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_4_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_5_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_5_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_15_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_15_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_16_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_16_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_17_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_17_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_1_33_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 4, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_1_33_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[4] = 0xff;
+	gen_buf[5] = 0xff;
+	gen_buf[6] = 0xff;
+	gen_buf[7] = 0xff;
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 4, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=1 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_0_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 8, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_0_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_1_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_1_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_2_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_2_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_3_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_3_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_4_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_4_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_5_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_5_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_15_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_15_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_16_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_16_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_17_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_17_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_2_33_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+	gen_buf[136] = 0xff;
+	gen_buf[137] = 0xff;
+	gen_buf[138] = 0xff;
+	gen_buf[139] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 8, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_2_33_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[8] = 0xff;
+	gen_buf[9] = 0xff;
+	gen_buf[10] = 0xff;
+	gen_buf[11] = 0xff;
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+	gen_buf[136] = 0xff;
+	gen_buf[137] = 0xff;
+	gen_buf[138] = 0xff;
+	gen_buf[139] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 8, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=2 l=33 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_0_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	gp_write_pixels_32BPP(write_buf + 12, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=0 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_0_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 0, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=0 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_1_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=1 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_1_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 1, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=1 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_2_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=2 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_2_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 2, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=2 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_3_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=3 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_3_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 3, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=3 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_4_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=4 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_4_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 4, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=4 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_5_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=5 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_5_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 5, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=5 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_15_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=15 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_15_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 15, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=15 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_16_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=16 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_16_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 16, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=16 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_17_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=17 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_17_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 17, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=17 a=0", write_buf, gen_buf);
+}
+static int WritePixel_32_3_33_0(void)
+{
+	char write_buf[160] = {};
+	char gen_buf[160] = {};
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+	gen_buf[136] = 0xff;
+	gen_buf[137] = 0xff;
+	gen_buf[138] = 0xff;
+	gen_buf[139] = 0xff;
+	gen_buf[140] = 0xff;
+	gen_buf[141] = 0xff;
+	gen_buf[142] = 0xff;
+	gen_buf[143] = 0xff;
+
+	gp_write_pixels_32BPP(write_buf + 12, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=33 a=0", write_buf, gen_buf);
+}
+
+static int WritePixel_32_3_33_0_alloc(void)
+{
+	char gen_buf[160] = {};
+	char *write_buf = malloc(160);
+
+	/*
+	 * Fill the compare buffer
+	 */
+	gen_buf[12] = 0xff;
+	gen_buf[13] = 0xff;
+	gen_buf[14] = 0xff;
+	gen_buf[15] = 0xff;
+	gen_buf[16] = 0xff;
+	gen_buf[17] = 0xff;
+	gen_buf[18] = 0xff;
+	gen_buf[19] = 0xff;
+	gen_buf[20] = 0xff;
+	gen_buf[21] = 0xff;
+	gen_buf[22] = 0xff;
+	gen_buf[23] = 0xff;
+	gen_buf[24] = 0xff;
+	gen_buf[25] = 0xff;
+	gen_buf[26] = 0xff;
+	gen_buf[27] = 0xff;
+	gen_buf[28] = 0xff;
+	gen_buf[29] = 0xff;
+	gen_buf[30] = 0xff;
+	gen_buf[31] = 0xff;
+	gen_buf[32] = 0xff;
+	gen_buf[33] = 0xff;
+	gen_buf[34] = 0xff;
+	gen_buf[35] = 0xff;
+	gen_buf[36] = 0xff;
+	gen_buf[37] = 0xff;
+	gen_buf[38] = 0xff;
+	gen_buf[39] = 0xff;
+	gen_buf[40] = 0xff;
+	gen_buf[41] = 0xff;
+	gen_buf[42] = 0xff;
+	gen_buf[43] = 0xff;
+	gen_buf[44] = 0xff;
+	gen_buf[45] = 0xff;
+	gen_buf[46] = 0xff;
+	gen_buf[47] = 0xff;
+	gen_buf[48] = 0xff;
+	gen_buf[49] = 0xff;
+	gen_buf[50] = 0xff;
+	gen_buf[51] = 0xff;
+	gen_buf[52] = 0xff;
+	gen_buf[53] = 0xff;
+	gen_buf[54] = 0xff;
+	gen_buf[55] = 0xff;
+	gen_buf[56] = 0xff;
+	gen_buf[57] = 0xff;
+	gen_buf[58] = 0xff;
+	gen_buf[59] = 0xff;
+	gen_buf[60] = 0xff;
+	gen_buf[61] = 0xff;
+	gen_buf[62] = 0xff;
+	gen_buf[63] = 0xff;
+	gen_buf[64] = 0xff;
+	gen_buf[65] = 0xff;
+	gen_buf[66] = 0xff;
+	gen_buf[67] = 0xff;
+	gen_buf[68] = 0xff;
+	gen_buf[69] = 0xff;
+	gen_buf[70] = 0xff;
+	gen_buf[71] = 0xff;
+	gen_buf[72] = 0xff;
+	gen_buf[73] = 0xff;
+	gen_buf[74] = 0xff;
+	gen_buf[75] = 0xff;
+	gen_buf[76] = 0xff;
+	gen_buf[77] = 0xff;
+	gen_buf[78] = 0xff;
+	gen_buf[79] = 0xff;
+	gen_buf[80] = 0xff;
+	gen_buf[81] = 0xff;
+	gen_buf[82] = 0xff;
+	gen_buf[83] = 0xff;
+	gen_buf[84] = 0xff;
+	gen_buf[85] = 0xff;
+	gen_buf[86] = 0xff;
+	gen_buf[87] = 0xff;
+	gen_buf[88] = 0xff;
+	gen_buf[89] = 0xff;
+	gen_buf[90] = 0xff;
+	gen_buf[91] = 0xff;
+	gen_buf[92] = 0xff;
+	gen_buf[93] = 0xff;
+	gen_buf[94] = 0xff;
+	gen_buf[95] = 0xff;
+	gen_buf[96] = 0xff;
+	gen_buf[97] = 0xff;
+	gen_buf[98] = 0xff;
+	gen_buf[99] = 0xff;
+	gen_buf[100] = 0xff;
+	gen_buf[101] = 0xff;
+	gen_buf[102] = 0xff;
+	gen_buf[103] = 0xff;
+	gen_buf[104] = 0xff;
+	gen_buf[105] = 0xff;
+	gen_buf[106] = 0xff;
+	gen_buf[107] = 0xff;
+	gen_buf[108] = 0xff;
+	gen_buf[109] = 0xff;
+	gen_buf[110] = 0xff;
+	gen_buf[111] = 0xff;
+	gen_buf[112] = 0xff;
+	gen_buf[113] = 0xff;
+	gen_buf[114] = 0xff;
+	gen_buf[115] = 0xff;
+	gen_buf[116] = 0xff;
+	gen_buf[117] = 0xff;
+	gen_buf[118] = 0xff;
+	gen_buf[119] = 0xff;
+	gen_buf[120] = 0xff;
+	gen_buf[121] = 0xff;
+	gen_buf[122] = 0xff;
+	gen_buf[123] = 0xff;
+	gen_buf[124] = 0xff;
+	gen_buf[125] = 0xff;
+	gen_buf[126] = 0xff;
+	gen_buf[127] = 0xff;
+	gen_buf[128] = 0xff;
+	gen_buf[129] = 0xff;
+	gen_buf[130] = 0xff;
+	gen_buf[131] = 0xff;
+	gen_buf[132] = 0xff;
+	gen_buf[133] = 0xff;
+	gen_buf[134] = 0xff;
+	gen_buf[135] = 0xff;
+	gen_buf[136] = 0xff;
+	gen_buf[137] = 0xff;
+	gen_buf[138] = 0xff;
+	gen_buf[139] = 0xff;
+	gen_buf[140] = 0xff;
+	gen_buf[141] = 0xff;
+	gen_buf[142] = 0xff;
+	gen_buf[143] = 0xff;
+
+	if (gen_buf == NULL) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	memset(write_buf, 0, 160);
+
+	gp_write_pixels_32BPP(write_buf + 12, 33, 0xffffffff>>0);
+
+	COMPARE_BUFFERS("p=32 o=3 l=33 a=0", write_buf, gen_buf);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "WritePixel Testsuite",
+	.tests = {
+		{.name = "WritePixel 8 0 0 0 stack",
+		 .tst_fn = WritePixel_8_0_0_0},
+		{.name = "WritePixel 8 0 0 0 alloc",
+		 .tst_fn = WritePixel_8_0_0_0_alloc},
+		{.name = "WritePixel 8 0 0 4 stack",
+		 .tst_fn = WritePixel_8_0_0_4},
+		{.name = "WritePixel 8 0 0 4 alloc",
+		 .tst_fn = WritePixel_8_0_0_4_alloc},
+		{.name = "WritePixel 8 0 1 0 stack",
+		 .tst_fn = WritePixel_8_0_1_0},
+		{.name = "WritePixel 8 0 1 0 alloc",
+		 .tst_fn = WritePixel_8_0_1_0_alloc},
+		{.name = "WritePixel 8 0 1 4 stack",
+		 .tst_fn = WritePixel_8_0_1_4},
+		{.name = "WritePixel 8 0 1 4 alloc",
+		 .tst_fn = WritePixel_8_0_1_4_alloc},
+		{.name = "WritePixel 8 0 2 0 stack",
+		 .tst_fn = WritePixel_8_0_2_0},
+		{.name = "WritePixel 8 0 2 0 alloc",
+		 .tst_fn = WritePixel_8_0_2_0_alloc},
+		{.name = "WritePixel 8 0 2 4 stack",
+		 .tst_fn = WritePixel_8_0_2_4},
+		{.name = "WritePixel 8 0 2 4 alloc",
+		 .tst_fn = WritePixel_8_0_2_4_alloc},
+		{.name = "WritePixel 8 0 3 0 stack",
+		 .tst_fn = WritePixel_8_0_3_0},
+		{.name = "WritePixel 8 0 3 0 alloc",
+		 .tst_fn = WritePixel_8_0_3_0_alloc},
+		{.name = "WritePixel 8 0 3 4 stack",
+		 .tst_fn = WritePixel_8_0_3_4},
+		{.name = "WritePixel 8 0 3 4 alloc",
+		 .tst_fn = WritePixel_8_0_3_4_alloc},
+		{.name = "WritePixel 8 0 4 0 stack",
+		 .tst_fn = WritePixel_8_0_4_0},
+		{.name = "WritePixel 8 0 4 0 alloc",
+		 .tst_fn = WritePixel_8_0_4_0_alloc},
+		{.name = "WritePixel 8 0 4 4 stack",
+		 .tst_fn = WritePixel_8_0_4_4},
+		{.name = "WritePixel 8 0 4 4 alloc",
+		 .tst_fn = WritePixel_8_0_4_4_alloc},
+		{.name = "WritePixel 8 0 5 0 stack",
+		 .tst_fn = WritePixel_8_0_5_0},
+		{.name = "WritePixel 8 0 5 0 alloc",
+		 .tst_fn = WritePixel_8_0_5_0_alloc},
+		{.name = "WritePixel 8 0 5 4 stack",
+		 .tst_fn = WritePixel_8_0_5_4},
+		{.name = "WritePixel 8 0 5 4 alloc",
+		 .tst_fn = WritePixel_8_0_5_4_alloc},
+		{.name = "WritePixel 8 0 15 0 stack",
+		 .tst_fn = WritePixel_8_0_15_0},
+		{.name = "WritePixel 8 0 15 0 alloc",
+		 .tst_fn = WritePixel_8_0_15_0_alloc},
+		{.name = "WritePixel 8 0 15 4 stack",
+		 .tst_fn = WritePixel_8_0_15_4},
+		{.name = "WritePixel 8 0 15 4 alloc",
+		 .tst_fn = WritePixel_8_0_15_4_alloc},
+		{.name = "WritePixel 8 0 16 0 stack",
+		 .tst_fn = WritePixel_8_0_16_0},
+		{.name = "WritePixel 8 0 16 0 alloc",
+		 .tst_fn = WritePixel_8_0_16_0_alloc},
+		{.name = "WritePixel 8 0 16 4 stack",
+		 .tst_fn = WritePixel_8_0_16_4},
+		{.name = "WritePixel 8 0 16 4 alloc",
+		 .tst_fn = WritePixel_8_0_16_4_alloc},
+		{.name = "WritePixel 8 0 17 0 stack",
+		 .tst_fn = WritePixel_8_0_17_0},
+		{.name = "WritePixel 8 0 17 0 alloc",
+		 .tst_fn = WritePixel_8_0_17_0_alloc},
+		{.name = "WritePixel 8 0 17 4 stack",
+		 .tst_fn = WritePixel_8_0_17_4},
+		{.name = "WritePixel 8 0 17 4 alloc",
+		 .tst_fn = WritePixel_8_0_17_4_alloc},
+		{.name = "WritePixel 8 0 33 0 stack",
+		 .tst_fn = WritePixel_8_0_33_0},
+		{.name = "WritePixel 8 0 33 0 alloc",
+		 .tst_fn = WritePixel_8_0_33_0_alloc},
+		{.name = "WritePixel 8 0 33 4 stack",
+		 .tst_fn = WritePixel_8_0_33_4},
+		{.name = "WritePixel 8 0 33 4 alloc",
+		 .tst_fn = WritePixel_8_0_33_4_alloc},
+		{.name = "WritePixel 8 1 0 0 stack",
+		 .tst_fn = WritePixel_8_1_0_0},
+		{.name = "WritePixel 8 1 0 0 alloc",
+		 .tst_fn = WritePixel_8_1_0_0_alloc},
+		{.name = "WritePixel 8 1 0 4 stack",
+		 .tst_fn = WritePixel_8_1_0_4},
+		{.name = "WritePixel 8 1 0 4 alloc",
+		 .tst_fn = WritePixel_8_1_0_4_alloc},
+		{.name = "WritePixel 8 1 1 0 stack",
+		 .tst_fn = WritePixel_8_1_1_0},
+		{.name = "WritePixel 8 1 1 0 alloc",
+		 .tst_fn = WritePixel_8_1_1_0_alloc},
+		{.name = "WritePixel 8 1 1 4 stack",
+		 .tst_fn = WritePixel_8_1_1_4},
+		{.name = "WritePixel 8 1 1 4 alloc",
+		 .tst_fn = WritePixel_8_1_1_4_alloc},
+		{.name = "WritePixel 8 1 2 0 stack",
+		 .tst_fn = WritePixel_8_1_2_0},
+		{.name = "WritePixel 8 1 2 0 alloc",
+		 .tst_fn = WritePixel_8_1_2_0_alloc},
+		{.name = "WritePixel 8 1 2 4 stack",
+		 .tst_fn = WritePixel_8_1_2_4},
+		{.name = "WritePixel 8 1 2 4 alloc",
+		 .tst_fn = WritePixel_8_1_2_4_alloc},
+		{.name = "WritePixel 8 1 3 0 stack",
+		 .tst_fn = WritePixel_8_1_3_0},
+		{.name = "WritePixel 8 1 3 0 alloc",
+		 .tst_fn = WritePixel_8_1_3_0_alloc},
+		{.name = "WritePixel 8 1 3 4 stack",
+		 .tst_fn = WritePixel_8_1_3_4},
+		{.name = "WritePixel 8 1 3 4 alloc",
+		 .tst_fn = WritePixel_8_1_3_4_alloc},
+		{.name = "WritePixel 8 1 4 0 stack",
+		 .tst_fn = WritePixel_8_1_4_0},
+		{.name = "WritePixel 8 1 4 0 alloc",
+		 .tst_fn = WritePixel_8_1_4_0_alloc},
+		{.name = "WritePixel 8 1 4 4 stack",
+		 .tst_fn = WritePixel_8_1_4_4},
+		{.name = "WritePixel 8 1 4 4 alloc",
+		 .tst_fn = WritePixel_8_1_4_4_alloc},
+		{.name = "WritePixel 8 1 5 0 stack",
+		 .tst_fn = WritePixel_8_1_5_0},
+		{.name = "WritePixel 8 1 5 0 alloc",
+		 .tst_fn = WritePixel_8_1_5_0_alloc},
+		{.name = "WritePixel 8 1 5 4 stack",
+		 .tst_fn = WritePixel_8_1_5_4},
+		{.name = "WritePixel 8 1 5 4 alloc",
+		 .tst_fn = WritePixel_8_1_5_4_alloc},
+		{.name = "WritePixel 8 1 15 0 stack",
+		 .tst_fn = WritePixel_8_1_15_0},
+		{.name = "WritePixel 8 1 15 0 alloc",
+		 .tst_fn = WritePixel_8_1_15_0_alloc},
+		{.name = "WritePixel 8 1 15 4 stack",
+		 .tst_fn = WritePixel_8_1_15_4},
+		{.name = "WritePixel 8 1 15 4 alloc",
+		 .tst_fn = WritePixel_8_1_15_4_alloc},
+		{.name = "WritePixel 8 1 16 0 stack",
+		 .tst_fn = WritePixel_8_1_16_0},
+		{.name = "WritePixel 8 1 16 0 alloc",
+		 .tst_fn = WritePixel_8_1_16_0_alloc},
+		{.name = "WritePixel 8 1 16 4 stack",
+		 .tst_fn = WritePixel_8_1_16_4},
+		{.name = "WritePixel 8 1 16 4 alloc",
+		 .tst_fn = WritePixel_8_1_16_4_alloc},
+		{.name = "WritePixel 8 1 17 0 stack",
+		 .tst_fn = WritePixel_8_1_17_0},
+		{.name = "WritePixel 8 1 17 0 alloc",
+		 .tst_fn = WritePixel_8_1_17_0_alloc},
+		{.name = "WritePixel 8 1 17 4 stack",
+		 .tst_fn = WritePixel_8_1_17_4},
+		{.name = "WritePixel 8 1 17 4 alloc",
+		 .tst_fn = WritePixel_8_1_17_4_alloc},
+		{.name = "WritePixel 8 1 33 0 stack",
+		 .tst_fn = WritePixel_8_1_33_0},
+		{.name = "WritePixel 8 1 33 0 alloc",
+		 .tst_fn = WritePixel_8_1_33_0_alloc},
+		{.name = "WritePixel 8 1 33 4 stack",
+		 .tst_fn = WritePixel_8_1_33_4},
+		{.name = "WritePixel 8 1 33 4 alloc",
+		 .tst_fn = WritePixel_8_1_33_4_alloc},
+		{.name = "WritePixel 8 2 0 0 stack",
+		 .tst_fn = WritePixel_8_2_0_0},
+		{.name = "WritePixel 8 2 0 0 alloc",
+		 .tst_fn = WritePixel_8_2_0_0_alloc},
+		{.name = "WritePixel 8 2 0 4 stack",
+		 .tst_fn = WritePixel_8_2_0_4},
+		{.name = "WritePixel 8 2 0 4 alloc",
+		 .tst_fn = WritePixel_8_2_0_4_alloc},
+		{.name = "WritePixel 8 2 1 0 stack",
+		 .tst_fn = WritePixel_8_2_1_0},
+		{.name = "WritePixel 8 2 1 0 alloc",
+		 .tst_fn = WritePixel_8_2_1_0_alloc},
+		{.name = "WritePixel 8 2 1 4 stack",
+		 .tst_fn = WritePixel_8_2_1_4},
+		{.name = "WritePixel 8 2 1 4 alloc",
+		 .tst_fn = WritePixel_8_2_1_4_alloc},
+		{.name = "WritePixel 8 2 2 0 stack",
+		 .tst_fn = WritePixel_8_2_2_0},
+		{.name = "WritePixel 8 2 2 0 alloc",
+		 .tst_fn = WritePixel_8_2_2_0_alloc},
+		{.name = "WritePixel 8 2 2 4 stack",
+		 .tst_fn = WritePixel_8_2_2_4},
+		{.name = "WritePixel 8 2 2 4 alloc",
+		 .tst_fn = WritePixel_8_2_2_4_alloc},
+		{.name = "WritePixel 8 2 3 0 stack",
+		 .tst_fn = WritePixel_8_2_3_0},
+		{.name = "WritePixel 8 2 3 0 alloc",
+		 .tst_fn = WritePixel_8_2_3_0_alloc},
+		{.name = "WritePixel 8 2 3 4 stack",
+		 .tst_fn = WritePixel_8_2_3_4},
+		{.name = "WritePixel 8 2 3 4 alloc",
+		 .tst_fn = WritePixel_8_2_3_4_alloc},
+		{.name = "WritePixel 8 2 4 0 stack",
+		 .tst_fn = WritePixel_8_2_4_0},
+		{.name = "WritePixel 8 2 4 0 alloc",
+		 .tst_fn = WritePixel_8_2_4_0_alloc},
+		{.name = "WritePixel 8 2 4 4 stack",
+		 .tst_fn = WritePixel_8_2_4_4},
+		{.name = "WritePixel 8 2 4 4 alloc",
+		 .tst_fn = WritePixel_8_2_4_4_alloc},
+		{.name = "WritePixel 8 2 5 0 stack",
+		 .tst_fn = WritePixel_8_2_5_0},
+		{.name = "WritePixel 8 2 5 0 alloc",
+		 .tst_fn = WritePixel_8_2_5_0_alloc},
+		{.name = "WritePixel 8 2 5 4 stack",
+		 .tst_fn = WritePixel_8_2_5_4},
+		{.name = "WritePixel 8 2 5 4 alloc",
+		 .tst_fn = WritePixel_8_2_5_4_alloc},
+		{.name = "WritePixel 8 2 15 0 stack",
+		 .tst_fn = WritePixel_8_2_15_0},
+		{.name = "WritePixel 8 2 15 0 alloc",
+		 .tst_fn = WritePixel_8_2_15_0_alloc},
+		{.name = "WritePixel 8 2 15 4 stack",
+		 .tst_fn = WritePixel_8_2_15_4},
+		{.name = "WritePixel 8 2 15 4 alloc",
+		 .tst_fn = WritePixel_8_2_15_4_alloc},
+		{.name = "WritePixel 8 2 16 0 stack",
+		 .tst_fn = WritePixel_8_2_16_0},
+		{.name = "WritePixel 8 2 16 0 alloc",
+		 .tst_fn = WritePixel_8_2_16_0_alloc},
+		{.name = "WritePixel 8 2 16 4 stack",
+		 .tst_fn = WritePixel_8_2_16_4},
+		{.name = "WritePixel 8 2 16 4 alloc",
+		 .tst_fn = WritePixel_8_2_16_4_alloc},
+		{.name = "WritePixel 8 2 17 0 stack",
+		 .tst_fn = WritePixel_8_2_17_0},
+		{.name = "WritePixel 8 2 17 0 alloc",
+		 .tst_fn = WritePixel_8_2_17_0_alloc},
+		{.name = "WritePixel 8 2 17 4 stack",
+		 .tst_fn = WritePixel_8_2_17_4},
+		{.name = "WritePixel 8 2 17 4 alloc",
+		 .tst_fn = WritePixel_8_2_17_4_alloc},
+		{.name = "WritePixel 8 2 33 0 stack",
+		 .tst_fn = WritePixel_8_2_33_0},
+		{.name = "WritePixel 8 2 33 0 alloc",
+		 .tst_fn = WritePixel_8_2_33_0_alloc},
+		{.name = "WritePixel 8 2 33 4 stack",
+		 .tst_fn = WritePixel_8_2_33_4},
+		{.name = "WritePixel 8 2 33 4 alloc",
+		 .tst_fn = WritePixel_8_2_33_4_alloc},
+		{.name = "WritePixel 8 3 0 0 stack",
+		 .tst_fn = WritePixel_8_3_0_0},
+		{.name = "WritePixel 8 3 0 0 alloc",
+		 .tst_fn = WritePixel_8_3_0_0_alloc},
+		{.name = "WritePixel 8 3 0 4 stack",
+		 .tst_fn = WritePixel_8_3_0_4},
+		{.name = "WritePixel 8 3 0 4 alloc",
+		 .tst_fn = WritePixel_8_3_0_4_alloc},
+		{.name = "WritePixel 8 3 1 0 stack",
+		 .tst_fn = WritePixel_8_3_1_0},
+		{.name = "WritePixel 8 3 1 0 alloc",
+		 .tst_fn = WritePixel_8_3_1_0_alloc},
+		{.name = "WritePixel 8 3 1 4 stack",
+		 .tst_fn = WritePixel_8_3_1_4},
+		{.name = "WritePixel 8 3 1 4 alloc",
+		 .tst_fn = WritePixel_8_3_1_4_alloc},
+		{.name = "WritePixel 8 3 2 0 stack",
+		 .tst_fn = WritePixel_8_3_2_0},
+		{.name = "WritePixel 8 3 2 0 alloc",
+		 .tst_fn = WritePixel_8_3_2_0_alloc},
+		{.name = "WritePixel 8 3 2 4 stack",
+		 .tst_fn = WritePixel_8_3_2_4},
+		{.name = "WritePixel 8 3 2 4 alloc",
+		 .tst_fn = WritePixel_8_3_2_4_alloc},
+		{.name = "WritePixel 8 3 3 0 stack",
+		 .tst_fn = WritePixel_8_3_3_0},
+		{.name = "WritePixel 8 3 3 0 alloc",
+		 .tst_fn = WritePixel_8_3_3_0_alloc},
+		{.name = "WritePixel 8 3 3 4 stack",
+		 .tst_fn = WritePixel_8_3_3_4},
+		{.name = "WritePixel 8 3 3 4 alloc",
+		 .tst_fn = WritePixel_8_3_3_4_alloc},
+		{.name = "WritePixel 8 3 4 0 stack",
+		 .tst_fn = WritePixel_8_3_4_0},
+		{.name = "WritePixel 8 3 4 0 alloc",
+		 .tst_fn = WritePixel_8_3_4_0_alloc},
+		{.name = "WritePixel 8 3 4 4 stack",
+		 .tst_fn = WritePixel_8_3_4_4},
+		{.name = "WritePixel 8 3 4 4 alloc",
+		 .tst_fn = WritePixel_8_3_4_4_alloc},
+		{.name = "WritePixel 8 3 5 0 stack",
+		 .tst_fn = WritePixel_8_3_5_0},
+		{.name = "WritePixel 8 3 5 0 alloc",
+		 .tst_fn = WritePixel_8_3_5_0_alloc},
+		{.name = "WritePixel 8 3 5 4 stack",
+		 .tst_fn = WritePixel_8_3_5_4},
+		{.name = "WritePixel 8 3 5 4 alloc",
+		 .tst_fn = WritePixel_8_3_5_4_alloc},
+		{.name = "WritePixel 8 3 15 0 stack",
+		 .tst_fn = WritePixel_8_3_15_0},
+		{.name = "WritePixel 8 3 15 0 alloc",
+		 .tst_fn = WritePixel_8_3_15_0_alloc},
+		{.name = "WritePixel 8 3 15 4 stack",
+		 .tst_fn = WritePixel_8_3_15_4},
+		{.name = "WritePixel 8 3 15 4 alloc",
+		 .tst_fn = WritePixel_8_3_15_4_alloc},
+		{.name = "WritePixel 8 3 16 0 stack",
+		 .tst_fn = WritePixel_8_3_16_0},
+		{.name = "WritePixel 8 3 16 0 alloc",
+		 .tst_fn = WritePixel_8_3_16_0_alloc},
+		{.name = "WritePixel 8 3 16 4 stack",
+		 .tst_fn = WritePixel_8_3_16_4},
+		{.name = "WritePixel 8 3 16 4 alloc",
+		 .tst_fn = WritePixel_8_3_16_4_alloc},
+		{.name = "WritePixel 8 3 17 0 stack",
+		 .tst_fn = WritePixel_8_3_17_0},
+		{.name = "WritePixel 8 3 17 0 alloc",
+		 .tst_fn = WritePixel_8_3_17_0_alloc},
+		{.name = "WritePixel 8 3 17 4 stack",
+		 .tst_fn = WritePixel_8_3_17_4},
+		{.name = "WritePixel 8 3 17 4 alloc",
+		 .tst_fn = WritePixel_8_3_17_4_alloc},
+		{.name = "WritePixel 8 3 33 0 stack",
+		 .tst_fn = WritePixel_8_3_33_0},
+		{.name = "WritePixel 8 3 33 0 alloc",
+		 .tst_fn = WritePixel_8_3_33_0_alloc},
+		{.name = "WritePixel 8 3 33 4 stack",
+		 .tst_fn = WritePixel_8_3_33_4},
+		{.name = "WritePixel 8 3 33 4 alloc",
+		 .tst_fn = WritePixel_8_3_33_4_alloc},
+		{.name = "WritePixel 16 0 0 0 stack",
+		 .tst_fn = WritePixel_16_0_0_0},
+		{.name = "WritePixel 16 0 0 0 alloc",
+		 .tst_fn = WritePixel_16_0_0_0_alloc},
+		{.name = "WritePixel 16 0 1 0 stack",
+		 .tst_fn = WritePixel_16_0_1_0},
+		{.name = "WritePixel 16 0 1 0 alloc",
+		 .tst_fn = WritePixel_16_0_1_0_alloc},
+		{.name = "WritePixel 16 0 2 0 stack",
+		 .tst_fn = WritePixel_16_0_2_0},
+		{.name = "WritePixel 16 0 2 0 alloc",
+		 .tst_fn = WritePixel_16_0_2_0_alloc},
+		{.name = "WritePixel 16 0 3 0 stack",
+		 .tst_fn = WritePixel_16_0_3_0},
+		{.name = "WritePixel 16 0 3 0 alloc",
+		 .tst_fn = WritePixel_16_0_3_0_alloc},
+		{.name = "WritePixel 16 0 4 0 stack",
+		 .tst_fn = WritePixel_16_0_4_0},
+		{.name = "WritePixel 16 0 4 0 alloc",
+		 .tst_fn = WritePixel_16_0_4_0_alloc},
+		{.name = "WritePixel 16 0 5 0 stack",
+		 .tst_fn = WritePixel_16_0_5_0},
+		{.name = "WritePixel 16 0 5 0 alloc",
+		 .tst_fn = WritePixel_16_0_5_0_alloc},
+		{.name = "WritePixel 16 0 15 0 stack",
+		 .tst_fn = WritePixel_16_0_15_0},
+		{.name = "WritePixel 16 0 15 0 alloc",
+		 .tst_fn = WritePixel_16_0_15_0_alloc},
+		{.name = "WritePixel 16 0 16 0 stack",
+		 .tst_fn = WritePixel_16_0_16_0},
+		{.name = "WritePixel 16 0 16 0 alloc",
+		 .tst_fn = WritePixel_16_0_16_0_alloc},
+		{.name = "WritePixel 16 0 17 0 stack",
+		 .tst_fn = WritePixel_16_0_17_0},
+		{.name = "WritePixel 16 0 17 0 alloc",
+		 .tst_fn = WritePixel_16_0_17_0_alloc},
+		{.name = "WritePixel 16 0 33 0 stack",
+		 .tst_fn = WritePixel_16_0_33_0},
+		{.name = "WritePixel 16 0 33 0 alloc",
+		 .tst_fn = WritePixel_16_0_33_0_alloc},
+		{.name = "WritePixel 16 1 0 0 stack",
+		 .tst_fn = WritePixel_16_1_0_0},
+		{.name = "WritePixel 16 1 0 0 alloc",
+		 .tst_fn = WritePixel_16_1_0_0_alloc},
+		{.name = "WritePixel 16 1 1 0 stack",
+		 .tst_fn = WritePixel_16_1_1_0},
+		{.name = "WritePixel 16 1 1 0 alloc",
+		 .tst_fn = WritePixel_16_1_1_0_alloc},
+		{.name = "WritePixel 16 1 2 0 stack",
+		 .tst_fn = WritePixel_16_1_2_0},
+		{.name = "WritePixel 16 1 2 0 alloc",
+		 .tst_fn = WritePixel_16_1_2_0_alloc},
+		{.name = "WritePixel 16 1 3 0 stack",
+		 .tst_fn = WritePixel_16_1_3_0},
+		{.name = "WritePixel 16 1 3 0 alloc",
+		 .tst_fn = WritePixel_16_1_3_0_alloc},
+		{.name = "WritePixel 16 1 4 0 stack",
+		 .tst_fn = WritePixel_16_1_4_0},
+		{.name = "WritePixel 16 1 4 0 alloc",
+		 .tst_fn = WritePixel_16_1_4_0_alloc},
+		{.name = "WritePixel 16 1 5 0 stack",
+		 .tst_fn = WritePixel_16_1_5_0},
+		{.name = "WritePixel 16 1 5 0 alloc",
+		 .tst_fn = WritePixel_16_1_5_0_alloc},
+		{.name = "WritePixel 16 1 15 0 stack",
+		 .tst_fn = WritePixel_16_1_15_0},
+		{.name = "WritePixel 16 1 15 0 alloc",
+		 .tst_fn = WritePixel_16_1_15_0_alloc},
+		{.name = "WritePixel 16 1 16 0 stack",
+		 .tst_fn = WritePixel_16_1_16_0},
+		{.name = "WritePixel 16 1 16 0 alloc",
+		 .tst_fn = WritePixel_16_1_16_0_alloc},
+		{.name = "WritePixel 16 1 17 0 stack",
+		 .tst_fn = WritePixel_16_1_17_0},
+		{.name = "WritePixel 16 1 17 0 alloc",
+		 .tst_fn = WritePixel_16_1_17_0_alloc},
+		{.name = "WritePixel 16 1 33 0 stack",
+		 .tst_fn = WritePixel_16_1_33_0},
+		{.name = "WritePixel 16 1 33 0 alloc",
+		 .tst_fn = WritePixel_16_1_33_0_alloc},
+		{.name = "WritePixel 16 2 0 0 stack",
+		 .tst_fn = WritePixel_16_2_0_0},
+		{.name = "WritePixel 16 2 0 0 alloc",
+		 .tst_fn = WritePixel_16_2_0_0_alloc},
+		{.name = "WritePixel 16 2 1 0 stack",
+		 .tst_fn = WritePixel_16_2_1_0},
+		{.name = "WritePixel 16 2 1 0 alloc",
+		 .tst_fn = WritePixel_16_2_1_0_alloc},
+		{.name = "WritePixel 16 2 2 0 stack",
+		 .tst_fn = WritePixel_16_2_2_0},
+		{.name = "WritePixel 16 2 2 0 alloc",
+		 .tst_fn = WritePixel_16_2_2_0_alloc},
+		{.name = "WritePixel 16 2 3 0 stack",
+		 .tst_fn = WritePixel_16_2_3_0},
+		{.name = "WritePixel 16 2 3 0 alloc",
+		 .tst_fn = WritePixel_16_2_3_0_alloc},
+		{.name = "WritePixel 16 2 4 0 stack",
+		 .tst_fn = WritePixel_16_2_4_0},
+		{.name = "WritePixel 16 2 4 0 alloc",
+		 .tst_fn = WritePixel_16_2_4_0_alloc},
+		{.name = "WritePixel 16 2 5 0 stack",
+		 .tst_fn = WritePixel_16_2_5_0},
+		{.name = "WritePixel 16 2 5 0 alloc",
+		 .tst_fn = WritePixel_16_2_5_0_alloc},
+		{.name = "WritePixel 16 2 15 0 stack",
+		 .tst_fn = WritePixel_16_2_15_0},
+		{.name = "WritePixel 16 2 15 0 alloc",
+		 .tst_fn = WritePixel_16_2_15_0_alloc},
+		{.name = "WritePixel 16 2 16 0 stack",
+		 .tst_fn = WritePixel_16_2_16_0},
+		{.name = "WritePixel 16 2 16 0 alloc",
+		 .tst_fn = WritePixel_16_2_16_0_alloc},
+		{.name = "WritePixel 16 2 17 0 stack",
+		 .tst_fn = WritePixel_16_2_17_0},
+		{.name = "WritePixel 16 2 17 0 alloc",
+		 .tst_fn = WritePixel_16_2_17_0_alloc},
+		{.name = "WritePixel 16 2 33 0 stack",
+		 .tst_fn = WritePixel_16_2_33_0},
+		{.name = "WritePixel 16 2 33 0 alloc",
+		 .tst_fn = WritePixel_16_2_33_0_alloc},
+		{.name = "WritePixel 16 3 0 0 stack",
+		 .tst_fn = WritePixel_16_3_0_0},
+		{.name = "WritePixel 16 3 0 0 alloc",
+		 .tst_fn = WritePixel_16_3_0_0_alloc},
+		{.name = "WritePixel 16 3 1 0 stack",
+		 .tst_fn = WritePixel_16_3_1_0},
+		{.name = "WritePixel 16 3 1 0 alloc",
+		 .tst_fn = WritePixel_16_3_1_0_alloc},
+		{.name = "WritePixel 16 3 2 0 stack",
+		 .tst_fn = WritePixel_16_3_2_0},
+		{.name = "WritePixel 16 3 2 0 alloc",
+		 .tst_fn = WritePixel_16_3_2_0_alloc},
+		{.name = "WritePixel 16 3 3 0 stack",
+		 .tst_fn = WritePixel_16_3_3_0},
+		{.name = "WritePixel 16 3 3 0 alloc",
+		 .tst_fn = WritePixel_16_3_3_0_alloc},
+		{.name = "WritePixel 16 3 4 0 stack",
+		 .tst_fn = WritePixel_16_3_4_0},
+		{.name = "WritePixel 16 3 4 0 alloc",
+		 .tst_fn = WritePixel_16_3_4_0_alloc},
+		{.name = "WritePixel 16 3 5 0 stack",
+		 .tst_fn = WritePixel_16_3_5_0},
+		{.name = "WritePixel 16 3 5 0 alloc",
+		 .tst_fn = WritePixel_16_3_5_0_alloc},
+		{.name = "WritePixel 16 3 15 0 stack",
+		 .tst_fn = WritePixel_16_3_15_0},
+		{.name = "WritePixel 16 3 15 0 alloc",
+		 .tst_fn = WritePixel_16_3_15_0_alloc},
+		{.name = "WritePixel 16 3 16 0 stack",
+		 .tst_fn = WritePixel_16_3_16_0},
+		{.name = "WritePixel 16 3 16 0 alloc",
+		 .tst_fn = WritePixel_16_3_16_0_alloc},
+		{.name = "WritePixel 16 3 17 0 stack",
+		 .tst_fn = WritePixel_16_3_17_0},
+		{.name = "WritePixel 16 3 17 0 alloc",
+		 .tst_fn = WritePixel_16_3_17_0_alloc},
+		{.name = "WritePixel 16 3 33 0 stack",
+		 .tst_fn = WritePixel_16_3_33_0},
+		{.name = "WritePixel 16 3 33 0 alloc",
+		 .tst_fn = WritePixel_16_3_33_0_alloc},
+		{.name = "WritePixel 24 0 0 0 stack",
+		 .tst_fn = WritePixel_24_0_0_0},
+		{.name = "WritePixel 24 0 0 0 alloc",
+		 .tst_fn = WritePixel_24_0_0_0_alloc},
+		{.name = "WritePixel 24 0 0 4 stack",
+		 .tst_fn = WritePixel_24_0_0_4},
+		{.name = "WritePixel 24 0 0 4 alloc",
+		 .tst_fn = WritePixel_24_0_0_4_alloc},
+		{.name = "WritePixel 24 0 1 0 stack",
+		 .tst_fn = WritePixel_24_0_1_0},
+		{.name = "WritePixel 24 0 1 0 alloc",
+		 .tst_fn = WritePixel_24_0_1_0_alloc},
+		{.name = "WritePixel 24 0 1 4 stack",
+		 .tst_fn = WritePixel_24_0_1_4},
+		{.name = "WritePixel 24 0 1 4 alloc",
+		 .tst_fn = WritePixel_24_0_1_4_alloc},
+		{.name = "WritePixel 24 0 2 0 stack",
+		 .tst_fn = WritePixel_24_0_2_0},
+		{.name = "WritePixel 24 0 2 0 alloc",
+		 .tst_fn = WritePixel_24_0_2_0_alloc},
+		{.name = "WritePixel 24 0 2 4 stack",
+		 .tst_fn = WritePixel_24_0_2_4},
+		{.name = "WritePixel 24 0 2 4 alloc",
+		 .tst_fn = WritePixel_24_0_2_4_alloc},
+		{.name = "WritePixel 24 0 3 0 stack",
+		 .tst_fn = WritePixel_24_0_3_0},
+		{.name = "WritePixel 24 0 3 0 alloc",
+		 .tst_fn = WritePixel_24_0_3_0_alloc},
+		{.name = "WritePixel 24 0 3 4 stack",
+		 .tst_fn = WritePixel_24_0_3_4},
+		{.name = "WritePixel 24 0 3 4 alloc",
+		 .tst_fn = WritePixel_24_0_3_4_alloc},
+		{.name = "WritePixel 24 0 4 0 stack",
+		 .tst_fn = WritePixel_24_0_4_0},
+		{.name = "WritePixel 24 0 4 0 alloc",
+		 .tst_fn = WritePixel_24_0_4_0_alloc},
+		{.name = "WritePixel 24 0 4 4 stack",
+		 .tst_fn = WritePixel_24_0_4_4},
+		{.name = "WritePixel 24 0 4 4 alloc",
+		 .tst_fn = WritePixel_24_0_4_4_alloc},
+		{.name = "WritePixel 24 0 5 0 stack",
+		 .tst_fn = WritePixel_24_0_5_0},
+		{.name = "WritePixel 24 0 5 0 alloc",
+		 .tst_fn = WritePixel_24_0_5_0_alloc},
+		{.name = "WritePixel 24 0 5 4 stack",
+		 .tst_fn = WritePixel_24_0_5_4},
+		{.name = "WritePixel 24 0 5 4 alloc",
+		 .tst_fn = WritePixel_24_0_5_4_alloc},
+		{.name = "WritePixel 24 0 15 0 stack",
+		 .tst_fn = WritePixel_24_0_15_0},
+		{.name = "WritePixel 24 0 15 0 alloc",
+		 .tst_fn = WritePixel_24_0_15_0_alloc},
+		{.name = "WritePixel 24 0 15 4 stack",
+		 .tst_fn = WritePixel_24_0_15_4},
+		{.name = "WritePixel 24 0 15 4 alloc",
+		 .tst_fn = WritePixel_24_0_15_4_alloc},
+		{.name = "WritePixel 24 0 16 0 stack",
+		 .tst_fn = WritePixel_24_0_16_0},
+		{.name = "WritePixel 24 0 16 0 alloc",
+		 .tst_fn = WritePixel_24_0_16_0_alloc},
+		{.name = "WritePixel 24 0 16 4 stack",
+		 .tst_fn = WritePixel_24_0_16_4},
+		{.name = "WritePixel 24 0 16 4 alloc",
+		 .tst_fn = WritePixel_24_0_16_4_alloc},
+		{.name = "WritePixel 24 0 17 0 stack",
+		 .tst_fn = WritePixel_24_0_17_0},
+		{.name = "WritePixel 24 0 17 0 alloc",
+		 .tst_fn = WritePixel_24_0_17_0_alloc},
+		{.name = "WritePixel 24 0 17 4 stack",
+		 .tst_fn = WritePixel_24_0_17_4},
+		{.name = "WritePixel 24 0 17 4 alloc",
+		 .tst_fn = WritePixel_24_0_17_4_alloc},
+		{.name = "WritePixel 24 0 33 0 stack",
+		 .tst_fn = WritePixel_24_0_33_0},
+		{.name = "WritePixel 24 0 33 0 alloc",
+		 .tst_fn = WritePixel_24_0_33_0_alloc},
+		{.name = "WritePixel 24 0 33 4 stack",
+		 .tst_fn = WritePixel_24_0_33_4},
+		{.name = "WritePixel 24 0 33 4 alloc",
+		 .tst_fn = WritePixel_24_0_33_4_alloc},
+		{.name = "WritePixel 24 1 0 0 stack",
+		 .tst_fn = WritePixel_24_1_0_0},
+		{.name = "WritePixel 24 1 0 0 alloc",
+		 .tst_fn = WritePixel_24_1_0_0_alloc},
+		{.name = "WritePixel 24 1 0 4 stack",
+		 .tst_fn = WritePixel_24_1_0_4},
+		{.name = "WritePixel 24 1 0 4 alloc",
+		 .tst_fn = WritePixel_24_1_0_4_alloc},
+		{.name = "WritePixel 24 1 1 0 stack",
+		 .tst_fn = WritePixel_24_1_1_0},
+		{.name = "WritePixel 24 1 1 0 alloc",
+		 .tst_fn = WritePixel_24_1_1_0_alloc},
+		{.name = "WritePixel 24 1 1 4 stack",
+		 .tst_fn = WritePixel_24_1_1_4},
+		{.name = "WritePixel 24 1 1 4 alloc",
+		 .tst_fn = WritePixel_24_1_1_4_alloc},
+		{.name = "WritePixel 24 1 2 0 stack",
+		 .tst_fn = WritePixel_24_1_2_0},
+		{.name = "WritePixel 24 1 2 0 alloc",
+		 .tst_fn = WritePixel_24_1_2_0_alloc},
+		{.name = "WritePixel 24 1 2 4 stack",
+		 .tst_fn = WritePixel_24_1_2_4},
+		{.name = "WritePixel 24 1 2 4 alloc",
+		 .tst_fn = WritePixel_24_1_2_4_alloc},
+		{.name = "WritePixel 24 1 3 0 stack",
+		 .tst_fn = WritePixel_24_1_3_0},
+		{.name = "WritePixel 24 1 3 0 alloc",
+		 .tst_fn = WritePixel_24_1_3_0_alloc},
+		{.name = "WritePixel 24 1 3 4 stack",
+		 .tst_fn = WritePixel_24_1_3_4},
+		{.name = "WritePixel 24 1 3 4 alloc",
+		 .tst_fn = WritePixel_24_1_3_4_alloc},
+		{.name = "WritePixel 24 1 4 0 stack",
+		 .tst_fn = WritePixel_24_1_4_0},
+		{.name = "WritePixel 24 1 4 0 alloc",
+		 .tst_fn = WritePixel_24_1_4_0_alloc},
+		{.name = "WritePixel 24 1 4 4 stack",
+		 .tst_fn = WritePixel_24_1_4_4},
+		{.name = "WritePixel 24 1 4 4 alloc",
+		 .tst_fn = WritePixel_24_1_4_4_alloc},
+		{.name = "WritePixel 24 1 5 0 stack",
+		 .tst_fn = WritePixel_24_1_5_0},
+		{.name = "WritePixel 24 1 5 0 alloc",
+		 .tst_fn = WritePixel_24_1_5_0_alloc},
+		{.name = "WritePixel 24 1 5 4 stack",
+		 .tst_fn = WritePixel_24_1_5_4},
+		{.name = "WritePixel 24 1 5 4 alloc",
+		 .tst_fn = WritePixel_24_1_5_4_alloc},
+		{.name = "WritePixel 24 1 15 0 stack",
+		 .tst_fn = WritePixel_24_1_15_0},
+		{.name = "WritePixel 24 1 15 0 alloc",
+		 .tst_fn = WritePixel_24_1_15_0_alloc},
+		{.name = "WritePixel 24 1 15 4 stack",
+		 .tst_fn = WritePixel_24_1_15_4},
+		{.name = "WritePixel 24 1 15 4 alloc",
+		 .tst_fn = WritePixel_24_1_15_4_alloc},
+		{.name = "WritePixel 24 1 16 0 stack",
+		 .tst_fn = WritePixel_24_1_16_0},
+		{.name = "WritePixel 24 1 16 0 alloc",
+		 .tst_fn = WritePixel_24_1_16_0_alloc},
+		{.name = "WritePixel 24 1 16 4 stack",
+		 .tst_fn = WritePixel_24_1_16_4},
+		{.name = "WritePixel 24 1 16 4 alloc",
+		 .tst_fn = WritePixel_24_1_16_4_alloc},
+		{.name = "WritePixel 24 1 17 0 stack",
+		 .tst_fn = WritePixel_24_1_17_0},
+		{.name = "WritePixel 24 1 17 0 alloc",
+		 .tst_fn = WritePixel_24_1_17_0_alloc},
+		{.name = "WritePixel 24 1 17 4 stack",
+		 .tst_fn = WritePixel_24_1_17_4},
+		{.name = "WritePixel 24 1 17 4 alloc",
+		 .tst_fn = WritePixel_24_1_17_4_alloc},
+		{.name = "WritePixel 24 1 33 0 stack",
+		 .tst_fn = WritePixel_24_1_33_0},
+		{.name = "WritePixel 24 1 33 0 alloc",
+		 .tst_fn = WritePixel_24_1_33_0_alloc},
+		{.name = "WritePixel 24 1 33 4 stack",
+		 .tst_fn = WritePixel_24_1_33_4},
+		{.name = "WritePixel 24 1 33 4 alloc",
+		 .tst_fn = WritePixel_24_1_33_4_alloc},
+		{.name = "WritePixel 24 2 0 0 stack",
+		 .tst_fn = WritePixel_24_2_0_0},
+		{.name = "WritePixel 24 2 0 0 alloc",
+		 .tst_fn = WritePixel_24_2_0_0_alloc},
+		{.name = "WritePixel 24 2 0 4 stack",
+		 .tst_fn = WritePixel_24_2_0_4},
+		{.name = "WritePixel 24 2 0 4 alloc",
+		 .tst_fn = WritePixel_24_2_0_4_alloc},
+		{.name = "WritePixel 24 2 1 0 stack",
+		 .tst_fn = WritePixel_24_2_1_0},
+		{.name = "WritePixel 24 2 1 0 alloc",
+		 .tst_fn = WritePixel_24_2_1_0_alloc},
+		{.name = "WritePixel 24 2 1 4 stack",
+		 .tst_fn = WritePixel_24_2_1_4},
+		{.name = "WritePixel 24 2 1 4 alloc",
+		 .tst_fn = WritePixel_24_2_1_4_alloc},
+		{.name = "WritePixel 24 2 2 0 stack",
+		 .tst_fn = WritePixel_24_2_2_0},
+		{.name = "WritePixel 24 2 2 0 alloc",
+		 .tst_fn = WritePixel_24_2_2_0_alloc},
+		{.name = "WritePixel 24 2 2 4 stack",
+		 .tst_fn = WritePixel_24_2_2_4},
+		{.name = "WritePixel 24 2 2 4 alloc",
+		 .tst_fn = WritePixel_24_2_2_4_alloc},
+		{.name = "WritePixel 24 2 3 0 stack",
+		 .tst_fn = WritePixel_24_2_3_0},
+		{.name = "WritePixel 24 2 3 0 alloc",
+		 .tst_fn = WritePixel_24_2_3_0_alloc},
+		{.name = "WritePixel 24 2 3 4 stack",
+		 .tst_fn = WritePixel_24_2_3_4},
+		{.name = "WritePixel 24 2 3 4 alloc",
+		 .tst_fn = WritePixel_24_2_3_4_alloc},
+		{.name = "WritePixel 24 2 4 0 stack",
+		 .tst_fn = WritePixel_24_2_4_0},
+		{.name = "WritePixel 24 2 4 0 alloc",
+		 .tst_fn = WritePixel_24_2_4_0_alloc},
+		{.name = "WritePixel 24 2 4 4 stack",
+		 .tst_fn = WritePixel_24_2_4_4},
+		{.name = "WritePixel 24 2 4 4 alloc",
+		 .tst_fn = WritePixel_24_2_4_4_alloc},
+		{.name = "WritePixel 24 2 5 0 stack",
+		 .tst_fn = WritePixel_24_2_5_0},
+		{.name = "WritePixel 24 2 5 0 alloc",
+		 .tst_fn = WritePixel_24_2_5_0_alloc},
+		{.name = "WritePixel 24 2 5 4 stack",
+		 .tst_fn = WritePixel_24_2_5_4},
+		{.name = "WritePixel 24 2 5 4 alloc",
+		 .tst_fn = WritePixel_24_2_5_4_alloc},
+		{.name = "WritePixel 24 2 15 0 stack",
+		 .tst_fn = WritePixel_24_2_15_0},
+		{.name = "WritePixel 24 2 15 0 alloc",
+		 .tst_fn = WritePixel_24_2_15_0_alloc},
+		{.name = "WritePixel 24 2 15 4 stack",
+		 .tst_fn = WritePixel_24_2_15_4},
+		{.name = "WritePixel 24 2 15 4 alloc",
+		 .tst_fn = WritePixel_24_2_15_4_alloc},
+		{.name = "WritePixel 24 2 16 0 stack",
+		 .tst_fn = WritePixel_24_2_16_0},
+		{.name = "WritePixel 24 2 16 0 alloc",
+		 .tst_fn = WritePixel_24_2_16_0_alloc},
+		{.name = "WritePixel 24 2 16 4 stack",
+		 .tst_fn = WritePixel_24_2_16_4},
+		{.name = "WritePixel 24 2 16 4 alloc",
+		 .tst_fn = WritePixel_24_2_16_4_alloc},
+		{.name = "WritePixel 24 2 17 0 stack",
+		 .tst_fn = WritePixel_24_2_17_0},
+		{.name = "WritePixel 24 2 17 0 alloc",
+		 .tst_fn = WritePixel_24_2_17_0_alloc},
+		{.name = "WritePixel 24 2 17 4 stack",
+		 .tst_fn = WritePixel_24_2_17_4},
+		{.name = "WritePixel 24 2 17 4 alloc",
+		 .tst_fn = WritePixel_24_2_17_4_alloc},
+		{.name = "WritePixel 24 2 33 0 stack",
+		 .tst_fn = WritePixel_24_2_33_0},
+		{.name = "WritePixel 24 2 33 0 alloc",
+		 .tst_fn = WritePixel_24_2_33_0_alloc},
+		{.name = "WritePixel 24 2 33 4 stack",
+		 .tst_fn = WritePixel_24_2_33_4},
+		{.name = "WritePixel 24 2 33 4 alloc",
+		 .tst_fn = WritePixel_24_2_33_4_alloc},
+		{.name = "WritePixel 24 3 0 0 stack",
+		 .tst_fn = WritePixel_24_3_0_0},
+		{.name = "WritePixel 24 3 0 0 alloc",
+		 .tst_fn = WritePixel_24_3_0_0_alloc},
+		{.name = "WritePixel 24 3 0 4 stack",
+		 .tst_fn = WritePixel_24_3_0_4},
+		{.name = "WritePixel 24 3 0 4 alloc",
+		 .tst_fn = WritePixel_24_3_0_4_alloc},
+		{.name = "WritePixel 24 3 1 0 stack",
+		 .tst_fn = WritePixel_24_3_1_0},
+		{.name = "WritePixel 24 3 1 0 alloc",
+		 .tst_fn = WritePixel_24_3_1_0_alloc},
+		{.name = "WritePixel 24 3 1 4 stack",
+		 .tst_fn = WritePixel_24_3_1_4},
+		{.name = "WritePixel 24 3 1 4 alloc",
+		 .tst_fn = WritePixel_24_3_1_4_alloc},
+		{.name = "WritePixel 24 3 2 0 stack",
+		 .tst_fn = WritePixel_24_3_2_0},
+		{.name = "WritePixel 24 3 2 0 alloc",
+		 .tst_fn = WritePixel_24_3_2_0_alloc},
+		{.name = "WritePixel 24 3 2 4 stack",
+		 .tst_fn = WritePixel_24_3_2_4},
+		{.name = "WritePixel 24 3 2 4 alloc",
+		 .tst_fn = WritePixel_24_3_2_4_alloc},
+		{.name = "WritePixel 24 3 3 0 stack",
+		 .tst_fn = WritePixel_24_3_3_0},
+		{.name = "WritePixel 24 3 3 0 alloc",
+		 .tst_fn = WritePixel_24_3_3_0_alloc},
+		{.name = "WritePixel 24 3 3 4 stack",
+		 .tst_fn = WritePixel_24_3_3_4},
+		{.name = "WritePixel 24 3 3 4 alloc",
+		 .tst_fn = WritePixel_24_3_3_4_alloc},
+		{.name = "WritePixel 24 3 4 0 stack",
+		 .tst_fn = WritePixel_24_3_4_0},
+		{.name = "WritePixel 24 3 4 0 alloc",
+		 .tst_fn = WritePixel_24_3_4_0_alloc},
+		{.name = "WritePixel 24 3 4 4 stack",
+		 .tst_fn = WritePixel_24_3_4_4},
+		{.name = "WritePixel 24 3 4 4 alloc",
+		 .tst_fn = WritePixel_24_3_4_4_alloc},
+		{.name = "WritePixel 24 3 5 0 stack",
+		 .tst_fn = WritePixel_24_3_5_0},
+		{.name = "WritePixel 24 3 5 0 alloc",
+		 .tst_fn = WritePixel_24_3_5_0_alloc},
+		{.name = "WritePixel 24 3 5 4 stack",
+		 .tst_fn = WritePixel_24_3_5_4},
+		{.name = "WritePixel 24 3 5 4 alloc",
+		 .tst_fn = WritePixel_24_3_5_4_alloc},
+		{.name = "WritePixel 24 3 15 0 stack",
+		 .tst_fn = WritePixel_24_3_15_0},
+		{.name = "WritePixel 24 3 15 0 alloc",
+		 .tst_fn = WritePixel_24_3_15_0_alloc},
+		{.name = "WritePixel 24 3 15 4 stack",
+		 .tst_fn = WritePixel_24_3_15_4},
+		{.name = "WritePixel 24 3 15 4 alloc",
+		 .tst_fn = WritePixel_24_3_15_4_alloc},
+		{.name = "WritePixel 24 3 16 0 stack",
+		 .tst_fn = WritePixel_24_3_16_0},
+		{.name = "WritePixel 24 3 16 0 alloc",
+		 .tst_fn = WritePixel_24_3_16_0_alloc},
+		{.name = "WritePixel 24 3 16 4 stack",
+		 .tst_fn = WritePixel_24_3_16_4},
+		{.name = "WritePixel 24 3 16 4 alloc",
+		 .tst_fn = WritePixel_24_3_16_4_alloc},
+		{.name = "WritePixel 24 3 17 0 stack",
+		 .tst_fn = WritePixel_24_3_17_0},
+		{.name = "WritePixel 24 3 17 0 alloc",
+		 .tst_fn = WritePixel_24_3_17_0_alloc},
+		{.name = "WritePixel 24 3 17 4 stack",
+		 .tst_fn = WritePixel_24_3_17_4},
+		{.name = "WritePixel 24 3 17 4 alloc",
+		 .tst_fn = WritePixel_24_3_17_4_alloc},
+		{.name = "WritePixel 24 3 33 0 stack",
+		 .tst_fn = WritePixel_24_3_33_0},
+		{.name = "WritePixel 24 3 33 0 alloc",
+		 .tst_fn = WritePixel_24_3_33_0_alloc},
+		{.name = "WritePixel 24 3 33 4 stack",
+		 .tst_fn = WritePixel_24_3_33_4},
+		{.name = "WritePixel 24 3 33 4 alloc",
+		 .tst_fn = WritePixel_24_3_33_4_alloc},
+		{.name = "WritePixel 32 0 0 0 stack",
+		 .tst_fn = WritePixel_32_0_0_0},
+		{.name = "WritePixel 32 0 0 0 alloc",
+		 .tst_fn = WritePixel_32_0_0_0_alloc},
+		{.name = "WritePixel 32 0 1 0 stack",
+		 .tst_fn = WritePixel_32_0_1_0},
+		{.name = "WritePixel 32 0 1 0 alloc",
+		 .tst_fn = WritePixel_32_0_1_0_alloc},
+		{.name = "WritePixel 32 0 2 0 stack",
+		 .tst_fn = WritePixel_32_0_2_0},
+		{.name = "WritePixel 32 0 2 0 alloc",
+		 .tst_fn = WritePixel_32_0_2_0_alloc},
+		{.name = "WritePixel 32 0 3 0 stack",
+		 .tst_fn = WritePixel_32_0_3_0},
+		{.name = "WritePixel 32 0 3 0 alloc",
+		 .tst_fn = WritePixel_32_0_3_0_alloc},
+		{.name = "WritePixel 32 0 4 0 stack",
+		 .tst_fn = WritePixel_32_0_4_0},
+		{.name = "WritePixel 32 0 4 0 alloc",
+		 .tst_fn = WritePixel_32_0_4_0_alloc},
+		{.name = "WritePixel 32 0 5 0 stack",
+		 .tst_fn = WritePixel_32_0_5_0},
+		{.name = "WritePixel 32 0 5 0 alloc",
+		 .tst_fn = WritePixel_32_0_5_0_alloc},
+		{.name = "WritePixel 32 0 15 0 stack",
+		 .tst_fn = WritePixel_32_0_15_0},
+		{.name = "WritePixel 32 0 15 0 alloc",
+		 .tst_fn = WritePixel_32_0_15_0_alloc},
+		{.name = "WritePixel 32 0 16 0 stack",
+		 .tst_fn = WritePixel_32_0_16_0},
+		{.name = "WritePixel 32 0 16 0 alloc",
+		 .tst_fn = WritePixel_32_0_16_0_alloc},
+		{.name = "WritePixel 32 0 17 0 stack",
+		 .tst_fn = WritePixel_32_0_17_0},
+		{.name = "WritePixel 32 0 17 0 alloc",
+		 .tst_fn = WritePixel_32_0_17_0_alloc},
+		{.name = "WritePixel 32 0 33 0 stack",
+		 .tst_fn = WritePixel_32_0_33_0},
+		{.name = "WritePixel 32 0 33 0 alloc",
+		 .tst_fn = WritePixel_32_0_33_0_alloc},
+		{.name = "WritePixel 32 1 0 0 stack",
+		 .tst_fn = WritePixel_32_1_0_0},
+		{.name = "WritePixel 32 1 0 0 alloc",
+		 .tst_fn = WritePixel_32_1_0_0_alloc},
+		{.name = "WritePixel 32 1 1 0 stack",
+		 .tst_fn = WritePixel_32_1_1_0},
+		{.name = "WritePixel 32 1 1 0 alloc",
+		 .tst_fn = WritePixel_32_1_1_0_alloc},
+		{.name = "WritePixel 32 1 2 0 stack",
+		 .tst_fn = WritePixel_32_1_2_0},
+		{.name = "WritePixel 32 1 2 0 alloc",
+		 .tst_fn = WritePixel_32_1_2_0_alloc},
+		{.name = "WritePixel 32 1 3 0 stack",
+		 .tst_fn = WritePixel_32_1_3_0},
+		{.name = "WritePixel 32 1 3 0 alloc",
+		 .tst_fn = WritePixel_32_1_3_0_alloc},
+		{.name = "WritePixel 32 1 4 0 stack",
+		 .tst_fn = WritePixel_32_1_4_0},
+		{.name = "WritePixel 32 1 4 0 alloc",
+		 .tst_fn = WritePixel_32_1_4_0_alloc},
+		{.name = "WritePixel 32 1 5 0 stack",
+		 .tst_fn = WritePixel_32_1_5_0},
+		{.name = "WritePixel 32 1 5 0 alloc",
+		 .tst_fn = WritePixel_32_1_5_0_alloc},
+		{.name = "WritePixel 32 1 15 0 stack",
+		 .tst_fn = WritePixel_32_1_15_0},
+		{.name = "WritePixel 32 1 15 0 alloc",
+		 .tst_fn = WritePixel_32_1_15_0_alloc},
+		{.name = "WritePixel 32 1 16 0 stack",
+		 .tst_fn = WritePixel_32_1_16_0},
+		{.name = "WritePixel 32 1 16 0 alloc",
+		 .tst_fn = WritePixel_32_1_16_0_alloc},
+		{.name = "WritePixel 32 1 17 0 stack",
+		 .tst_fn = WritePixel_32_1_17_0},
+		{.name = "WritePixel 32 1 17 0 alloc",
+		 .tst_fn = WritePixel_32_1_17_0_alloc},
+		{.name = "WritePixel 32 1 33 0 stack",
+		 .tst_fn = WritePixel_32_1_33_0},
+		{.name = "WritePixel 32 1 33 0 alloc",
+		 .tst_fn = WritePixel_32_1_33_0_alloc},
+		{.name = "WritePixel 32 2 0 0 stack",
+		 .tst_fn = WritePixel_32_2_0_0},
+		{.name = "WritePixel 32 2 0 0 alloc",
+		 .tst_fn = WritePixel_32_2_0_0_alloc},
+		{.name = "WritePixel 32 2 1 0 stack",
+		 .tst_fn = WritePixel_32_2_1_0},
+		{.name = "WritePixel 32 2 1 0 alloc",
+		 .tst_fn = WritePixel_32_2_1_0_alloc},
+		{.name = "WritePixel 32 2 2 0 stack",
+		 .tst_fn = WritePixel_32_2_2_0},
+		{.name = "WritePixel 32 2 2 0 alloc",
+		 .tst_fn = WritePixel_32_2_2_0_alloc},
+		{.name = "WritePixel 32 2 3 0 stack",
+		 .tst_fn = WritePixel_32_2_3_0},
+		{.name = "WritePixel 32 2 3 0 alloc",
+		 .tst_fn = WritePixel_32_2_3_0_alloc},
+		{.name = "WritePixel 32 2 4 0 stack",
+		 .tst_fn = WritePixel_32_2_4_0},
+		{.name = "WritePixel 32 2 4 0 alloc",
+		 .tst_fn = WritePixel_32_2_4_0_alloc},
+		{.name = "WritePixel 32 2 5 0 stack",
+		 .tst_fn = WritePixel_32_2_5_0},
+		{.name = "WritePixel 32 2 5 0 alloc",
+		 .tst_fn = WritePixel_32_2_5_0_alloc},
+		{.name = "WritePixel 32 2 15 0 stack",
+		 .tst_fn = WritePixel_32_2_15_0},
+		{.name = "WritePixel 32 2 15 0 alloc",
+		 .tst_fn = WritePixel_32_2_15_0_alloc},
+		{.name = "WritePixel 32 2 16 0 stack",
+		 .tst_fn = WritePixel_32_2_16_0},
+		{.name = "WritePixel 32 2 16 0 alloc",
+		 .tst_fn = WritePixel_32_2_16_0_alloc},
+		{.name = "WritePixel 32 2 17 0 stack",
+		 .tst_fn = WritePixel_32_2_17_0},
+		{.name = "WritePixel 32 2 17 0 alloc",
+		 .tst_fn = WritePixel_32_2_17_0_alloc},
+		{.name = "WritePixel 32 2 33 0 stack",
+		 .tst_fn = WritePixel_32_2_33_0},
+		{.name = "WritePixel 32 2 33 0 alloc",
+		 .tst_fn = WritePixel_32_2_33_0_alloc},
+		{.name = "WritePixel 32 3 0 0 stack",
+		 .tst_fn = WritePixel_32_3_0_0},
+		{.name = "WritePixel 32 3 0 0 alloc",
+		 .tst_fn = WritePixel_32_3_0_0_alloc},
+		{.name = "WritePixel 32 3 1 0 stack",
+		 .tst_fn = WritePixel_32_3_1_0},
+		{.name = "WritePixel 32 3 1 0 alloc",
+		 .tst_fn = WritePixel_32_3_1_0_alloc},
+		{.name = "WritePixel 32 3 2 0 stack",
+		 .tst_fn = WritePixel_32_3_2_0},
+		{.name = "WritePixel 32 3 2 0 alloc",
+		 .tst_fn = WritePixel_32_3_2_0_alloc},
+		{.name = "WritePixel 32 3 3 0 stack",
+		 .tst_fn = WritePixel_32_3_3_0},
+		{.name = "WritePixel 32 3 3 0 alloc",
+		 .tst_fn = WritePixel_32_3_3_0_alloc},
+		{.name = "WritePixel 32 3 4 0 stack",
+		 .tst_fn = WritePixel_32_3_4_0},
+		{.name = "WritePixel 32 3 4 0 alloc",
+		 .tst_fn = WritePixel_32_3_4_0_alloc},
+		{.name = "WritePixel 32 3 5 0 stack",
+		 .tst_fn = WritePixel_32_3_5_0},
+		{.name = "WritePixel 32 3 5 0 alloc",
+		 .tst_fn = WritePixel_32_3_5_0_alloc},
+		{.name = "WritePixel 32 3 15 0 stack",
+		 .tst_fn = WritePixel_32_3_15_0},
+		{.name = "WritePixel 32 3 15 0 alloc",
+		 .tst_fn = WritePixel_32_3_15_0_alloc},
+		{.name = "WritePixel 32 3 16 0 stack",
+		 .tst_fn = WritePixel_32_3_16_0},
+		{.name = "WritePixel 32 3 16 0 alloc",
+		 .tst_fn = WritePixel_32_3_16_0_alloc},
+		{.name = "WritePixel 32 3 17 0 stack",
+		 .tst_fn = WritePixel_32_3_17_0},
+		{.name = "WritePixel 32 3 17 0 alloc",
+		 .tst_fn = WritePixel_32_3_17_0_alloc},
+		{.name = "WritePixel 32 3 33 0 stack",
+		 .tst_fn = WritePixel_32_3_33_0},
+		{.name = "WritePixel 32 3 33 0 alloc",
+		 .tst_fn = WritePixel_32_3_33_0_alloc},
+		{.name = NULL}
+	}
+};
@@ -53,13 +53,13 @@ static void dump_buffer(const char *name, char *buf, unsigned int buf_len)
 
 @ for pixelsize in [8, 16, 24, 32]:
 @     for offset in range(0, 4):
-@         for len in range(0, 6):
+@         for len in list(range(0, 6)) + [15, 16, 17, 33]:
 @             for aligment in [0, 4]:
 @                 if (pixelsize != 16 and pixelsize != 32) or aligment == 0:
 static int WritePixel{{ "_%i_%i_%i_%i" % (pixelsize, offset, len, aligment) }}(void)
 {
-	char write_buf[{{ 25 * pixelsize//8 }}] = {};
-	char gen_buf[{{ 25 * pixelsize//8 }}] = {};
+	char write_buf[{{ 40 * pixelsize//8 }}] = {};
+	char gen_buf[{{ 40 * pixelsize//8 }}] = {};
 
 	/*
 	 * Fill the compare buffer
@@ -76,8 +76,8 @@ static int WritePixel{{ "_%i_%i_%i_%i" % (pixelsize, offset, len, aligment) }}(v
 
 static int WritePixel{{ "_%i_%i_%i_%i_alloc" % (pixelsize, offset, len, aligment) }}(void)
 {
-	char gen_buf[{{ 25 * pixelsize//8 }}] = {};
-	char *write_buf = malloc({{ 25 * pixelsize//8 }});
+	char gen_buf[{{ 40 * pixelsize//8 }}] = {};
+	char *write_buf = malloc({{ 40 * pixelsize//8 }});
 
 	/*
 	 * Fill the compare buffer
@@ -92,7 +92,7 @@ static int WritePixel{{ "_%i_%i_%i_%i_alloc" % (pixelsize, offset, len, aligment
 		return TST_UNTESTED;
 	}
 
-	memset(write_buf, 0, {{ 25 * pixelsize//8 }});
+	memset(write_buf, 0, {{ 40 * pixelsize//8 }});
 
 	gp_write_pixels_{{ pixelsize }}BPP(write_buf + {{aligment + offset * pixelsize//8}}, {{ len }}, 0xffffffff>>{{32 - pixelsize}});
 
@@ -105,7 +105,7 @@ const struct tst_suite tst_suite = {
 	.tests = {
 @ for pixelsize in [8, 16, 24, 32]:
 @     for offset in range(0, 4):
-@         for len in range(0, 6):
+@         for len in list(range(0, 6)) + [15, 16, 17, 33]:
 @             for aligment in [0, 4]:
 @                 if (pixelsize != 16 and pixelsize != 32) or aligment == 0:
 		{.name = "WritePixel {{ pixelsize }} {{ offset }} {{ len }} {{ aligment }} stack",
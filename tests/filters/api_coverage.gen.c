@@ -0,0 +1,6257 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * api_coverage.gen.c
+ *
+ * GENERATED on 2026 10 18 07:52:43 from api_coverage.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+/*
+ * Filters API coverage tests.
+ *
+ * The purpose of this test is to exercise as much codepaths as possible
+ * without checking for result corectness.
+ *
+ * We check for correct return value correcness though.
+ *
+ * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <filters/gp_filters.h>
+
+#include "tst_test.h"
+
+static int filter_brightness_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	float p = 1;
+	int res;
+
+	res = gp_filter_brightness(in, out, p, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_brightness_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	float p = 1;
+	gp_pixmap *res;
+
+	res = gp_filter_brightness_alloc(in, p, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_contrast_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	float p = 1;
+	int res;
+
+	res = gp_filter_contrast(in, out, p, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_contrast_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	float p = 1;
+	gp_pixmap *res;
+
+	res = gp_filter_contrast_alloc(in, p, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_invert_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_invert(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_invert_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_invert_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_mirror_h_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_mirror_h(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_mirror_h_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_mirror_h_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_mirror_v_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_mirror_v(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_mirror_v_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_mirror_v_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_90_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_rotate_90(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_90_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_rotate_90_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_180_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_rotate_180(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_180_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_rotate_180_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_270_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_rotate_270(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_rotate_270_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_rotate_270_alloc(in, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_H(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_symmetry(in, out, GP_MIRROR_H, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_alloc_H(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_symmetry_alloc(in, GP_MIRROR_H, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_V(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_symmetry(in, out, GP_MIRROR_V, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_alloc_V(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_symmetry_alloc(in, GP_MIRROR_V, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_90(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_symmetry(in, out, GP_ROTATE_90, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_alloc_90(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_symmetry_alloc(in, GP_ROTATE_90, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_180(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_symmetry(in, out, GP_ROTATE_180, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_alloc_180(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_symmetry_alloc(in, GP_ROTATE_180, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_270(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_symmetry(in, out, GP_ROTATE_270, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_symmetry_alloc_270(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *res;
+
+	res = gp_filter_symmetry_alloc(in, GP_ROTATE_270, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_convolution_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	float kernel_kern[] = {
+		1, 1, 1,
+		1, 1, 1,
+		1, 1, 1,
+	};
+
+	gp_filter_kernel_2d kernel_s = {
+		.w = 3,
+		.h = 3,
+		.div = 9,
+		.kernel = kernel_kern,
+	};
+
+	gp_filter_kernel_2d *kernel = &kernel_s;
+	int res;
+
+	res = gp_filter_convolution(in, out, kernel, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_convolution_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	float kernel_kern[] = {
+		1, 1, 1,
+		1, 1, 1,
+		1, 1, 1,
+	};
+
+	gp_filter_kernel_2d kernel_s = {
+		.w = 3,
+		.h = 3,
+		.div = 9,
+		.kernel = kernel_kern,
+	};
+
+	gp_filter_kernel_2d *kernel = &kernel_s;
+	gp_pixmap *res;
+
+	res = gp_filter_convolution_alloc(in, kernel, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_gaussian_blur_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	float sigma_x = 1;
+	float sigma_y = 1;
+	int res;
+
+	res = gp_filter_gaussian_blur(in, out, sigma_x, sigma_y, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_gaussian_blur_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	float sigma_x = 1;
+	float sigma_y = 1;
+	gp_pixmap *res;
+
+	res = gp_filter_gaussian_blur_alloc(in, sigma_x, sigma_y, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_gaussian_noise_add_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	float sigma = 1;
+	float mu = 1;
+	int res;
+
+	res = gp_filter_gaussian_noise_add(in, out, sigma, mu, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_gaussian_noise_add_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	float sigma = 1;
+	float mu = 1;
+	gp_pixmap *res;
+
+	res = gp_filter_gaussian_noise_add_alloc(in, sigma, mu, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_median_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int xmed = 2;
+	int ymed = 2;
+	int res;
+
+	res = gp_filter_median(in, out, xmed, ymed, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_median_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	int xmed = 2;
+	int ymed = 2;
+	gp_pixmap *res;
+
+	res = gp_filter_median_alloc(in, xmed, ymed, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_weighted_median_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+
+	unsigned int weights_w[] = {
+		1, 2, 1,
+		2, 4, 2,
+		1, 2, 1,
+	};
+
+	gp_median_weights weights_s = {
+		.w = 3,
+		.h = 3,
+		.weights = weights_w,
+	};
+
+	gp_median_weights *weights = &weights_s;
+	int res;
+
+	res = gp_filter_weighted_median(in, out, weights, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_weighted_median_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+
+	unsigned int weights_w[] = {
+		1, 2, 1,
+		2, 4, 2,
+		1, 2, 1,
+	};
+
+	gp_median_weights weights_s = {
+		.w = 3,
+		.h = 3,
+		.weights = weights_w,
+	};
+
+	gp_median_weights *weights = &weights_s;
+	gp_pixmap *res;
+
+	res = gp_filter_weighted_median_alloc(in, weights, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_sigma_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int xrad = 2;
+	int yrad = 2;
+	int min = 2;
+	float sigma = 1;
+	int res;
+
+	res = gp_filter_sigma(in, out, xrad, yrad, min, sigma, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_sigma_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	int xrad = 2;
+	int yrad = 2;
+	int min = 2;
+	float sigma = 1;
+	gp_pixmap *res;
+
+	res = gp_filter_sigma_alloc(in, xrad, yrad, min, sigma, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_resize_nn_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_resize_nn(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_resize_nn_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	int w = 2;
+	int h = 2;
+	gp_pixmap *res;
+
+	res = gp_filter_resize_nn_alloc(in, w, h, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_floyd_steinberg_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_floyd_steinberg(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_floyd_steinberg_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixel_type G8 = GP_PIXEL_G8;
+	gp_pixmap *res;
+
+	res = gp_filter_floyd_steinberg_alloc(in, G8, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_hilbert_peano_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixmap *out = gp_pixmap_alloc(331, 331, pt);
+	int res;
+
+	res = gp_filter_hilbert_peano(in, out, NULL);
+
+	if (res) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_hilbert_peano_alloc_(gp_pixel_type pt)
+{
+	gp_pixmap *in = gp_pixmap_alloc(331, 331, pt);
+	gp_pixel_type G8 = GP_PIXEL_G8;
+	gp_pixmap *res;
+
+	res = gp_filter_hilbert_peano_alloc(in, G8, NULL);
+
+	if (res == NULL) {
+		switch (errno) {
+		case ENOSYS:
+			tst_msg("Not Implemented");
+			return TST_SUCCESS;
+		break;
+		case EINVAL:
+			tst_msg("Not suitable pixel type");
+			return TST_SUCCESS;
+		break;
+		default:
+			tst_msg("Unexpected errno %s", strerror(errno));
+			return TST_FAILED;
+		}
+	}
+
+	return TST_SUCCESS;
+}
+static int filter_brightness__xRGB8888(void)
+{
+	return filter_brightness_(GP_PIXEL_xRGB8888);
+}
+static int filter_brightness__RGBA8888(void)
+{
+	return filter_brightness_(GP_PIXEL_RGBA8888);
+}
+static int filter_brightness__RGB888(void)
+{
+	return filter_brightness_(GP_PIXEL_RGB888);
+}
+static int filter_brightness__BGR888(void)
+{
+	return filter_brightness_(GP_PIXEL_BGR888);
+}
+static int filter_brightness__RGB555(void)
+{
+	return filter_brightness_(GP_PIXEL_RGB555);
+}
+static int filter_brightness__RGB565(void)
+{
+	return filter_brightness_(GP_PIXEL_RGB565);
+}
+static int filter_brightness__RGB666(void)
+{
+	return filter_brightness_(GP_PIXEL_RGB666);
+}
+static int filter_brightness__RGB332(void)
+{
+	return filter_brightness_(GP_PIXEL_RGB332);
+}
+static int filter_brightness__CMYK8888(void)
+{
+	return filter_brightness_(GP_PIXEL_CMYK8888);
+}
+static int filter_brightness__P2(void)
+{
+	return filter_brightness_(GP_PIXEL_P2);
+}
+static int filter_brightness__P4(void)
+{
+	return filter_brightness_(GP_PIXEL_P4);
+}
+static int filter_brightness__P8(void)
+{
+	return filter_brightness_(GP_PIXEL_P8);
+}
+static int filter_brightness__G1(void)
+{
+	return filter_brightness_(GP_PIXEL_G1);
+}
+static int filter_brightness__G2(void)
+{
+	return filter_brightness_(GP_PIXEL_G2);
+}
+static int filter_brightness__G4(void)
+{
+	return filter_brightness_(GP_PIXEL_G4);
+}
+static int filter_brightness__G8(void)
+{
+	return filter_brightness_(GP_PIXEL_G8);
+}
+static int filter_brightness__GA88(void)
+{
+	return filter_brightness_(GP_PIXEL_GA88);
+}
+static int filter_brightness__G16(void)
+{
+	return filter_brightness_(GP_PIXEL_G16);
+}
+static int filter_brightness__RGBA8888_PM(void)
+{
+	return filter_brightness_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_brightness_alloc__xRGB8888(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_brightness_alloc__RGBA8888(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_brightness_alloc__RGB888(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_brightness_alloc__BGR888(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_brightness_alloc__RGB555(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_brightness_alloc__RGB565(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_brightness_alloc__RGB666(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_brightness_alloc__RGB332(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_brightness_alloc__CMYK8888(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_brightness_alloc__P2(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_P2);
+}
+static int filter_brightness_alloc__P4(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_P4);
+}
+static int filter_brightness_alloc__P8(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_P8);
+}
+static int filter_brightness_alloc__G1(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_G1);
+}
+static int filter_brightness_alloc__G2(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_G2);
+}
+static int filter_brightness_alloc__G4(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_G4);
+}
+static int filter_brightness_alloc__G8(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_G8);
+}
+static int filter_brightness_alloc__GA88(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_GA88);
+}
+static int filter_brightness_alloc__G16(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_G16);
+}
+static int filter_brightness_alloc__RGBA8888_PM(void)
+{
+	return filter_brightness_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_contrast__xRGB8888(void)
+{
+	return filter_contrast_(GP_PIXEL_xRGB8888);
+}
+static int filter_contrast__RGBA8888(void)
+{
+	return filter_contrast_(GP_PIXEL_RGBA8888);
+}
+static int filter_contrast__RGB888(void)
+{
+	return filter_contrast_(GP_PIXEL_RGB888);
+}
+static int filter_contrast__BGR888(void)
+{
+	return filter_contrast_(GP_PIXEL_BGR888);
+}
+static int filter_contrast__RGB555(void)
+{
+	return filter_contrast_(GP_PIXEL_RGB555);
+}
+static int filter_contrast__RGB565(void)
+{
+	return filter_contrast_(GP_PIXEL_RGB565);
+}
+static int filter_contrast__RGB666(void)
+{
+	return filter_contrast_(GP_PIXEL_RGB666);
+}
+static int filter_contrast__RGB332(void)
+{
+	return filter_contrast_(GP_PIXEL_RGB332);
+}
+static int filter_contrast__CMYK8888(void)
+{
+	return filter_contrast_(GP_PIXEL_CMYK8888);
+}
+static int filter_contrast__P2(void)
+{
+	return filter_contrast_(GP_PIXEL_P2);
+}
+static int filter_contrast__P4(void)
+{
+	return filter_contrast_(GP_PIXEL_P4);
+}
+static int filter_contrast__P8(void)
+{
+	return filter_contrast_(GP_PIXEL_P8);
+}
+static int filter_contrast__G1(void)
+{
+	return filter_contrast_(GP_PIXEL_G1);
+}
+static int filter_contrast__G2(void)
+{
+	return filter_contrast_(GP_PIXEL_G2);
+}
+static int filter_contrast__G4(void)
+{
+	return filter_contrast_(GP_PIXEL_G4);
+}
+static int filter_contrast__G8(void)
+{
+	return filter_contrast_(GP_PIXEL_G8);
+}
+static int filter_contrast__GA88(void)
+{
+	return filter_contrast_(GP_PIXEL_GA88);
+}
+static int filter_contrast__G16(void)
+{
+	return filter_contrast_(GP_PIXEL_G16);
+}
+static int filter_contrast__RGBA8888_PM(void)
+{
+	return filter_contrast_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_contrast_alloc__xRGB8888(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_contrast_alloc__RGBA8888(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_contrast_alloc__RGB888(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_contrast_alloc__BGR888(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_contrast_alloc__RGB555(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_contrast_alloc__RGB565(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_contrast_alloc__RGB666(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_contrast_alloc__RGB332(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_contrast_alloc__CMYK8888(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_contrast_alloc__P2(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_P2);
+}
+static int filter_contrast_alloc__P4(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_P4);
+}
+static int filter_contrast_alloc__P8(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_P8);
+}
+static int filter_contrast_alloc__G1(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_G1);
+}
+static int filter_contrast_alloc__G2(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_G2);
+}
+static int filter_contrast_alloc__G4(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_G4);
+}
+static int filter_contrast_alloc__G8(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_G8);
+}
+static int filter_contrast_alloc__GA88(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_GA88);
+}
+static int filter_contrast_alloc__G16(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_G16);
+}
+static int filter_contrast_alloc__RGBA8888_PM(void)
+{
+	return filter_contrast_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_invert__xRGB8888(void)
+{
+	return filter_invert_(GP_PIXEL_xRGB8888);
+}
+static int filter_invert__RGBA8888(void)
+{
+	return filter_invert_(GP_PIXEL_RGBA8888);
+}
+static int filter_invert__RGB888(void)
+{
+	return filter_invert_(GP_PIXEL_RGB888);
+}
+static int filter_invert__BGR888(void)
+{
+	return filter_invert_(GP_PIXEL_BGR888);
+}
+static int filter_invert__RGB555(void)
+{
+	return filter_invert_(GP_PIXEL_RGB555);
+}
+static int filter_invert__RGB565(void)
+{
+	return filter_invert_(GP_PIXEL_RGB565);
+}
+static int filter_invert__RGB666(void)
+{
+	return filter_invert_(GP_PIXEL_RGB666);
+}
+static int filter_invert__RGB332(void)
+{
+	return filter_invert_(GP_PIXEL_RGB332);
+}
+static int filter_invert__CMYK8888(void)
+{
+	return filter_invert_(GP_PIXEL_CMYK8888);
+}
+static int filter_invert__P2(void)
+{
+	return filter_invert_(GP_PIXEL_P2);
+}
+static int filter_invert__P4(void)
+{
+	return filter_invert_(GP_PIXEL_P4);
+}
+static int filter_invert__P8(void)
+{
+	return filter_invert_(GP_PIXEL_P8);
+}
+static int filter_invert__G1(void)
+{
+	return filter_invert_(GP_PIXEL_G1);
+}
+static int filter_invert__G2(void)
+{
+	return filter_invert_(GP_PIXEL_G2);
+}
+static int filter_invert__G4(void)
+{
+	return filter_invert_(GP_PIXEL_G4);
+}
+static int filter_invert__G8(void)
+{
+	return filter_invert_(GP_PIXEL_G8);
+}
+static int filter_invert__GA88(void)
+{
+	return filter_invert_(GP_PIXEL_GA88);
+}
+static int filter_invert__G16(void)
+{
+	return filter_invert_(GP_PIXEL_G16);
+}
+static int filter_invert__RGBA8888_PM(void)
+{
+	return filter_invert_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_invert_alloc__xRGB8888(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_invert_alloc__RGBA8888(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_invert_alloc__RGB888(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_invert_alloc__BGR888(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_invert_alloc__RGB555(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_invert_alloc__RGB565(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_invert_alloc__RGB666(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_invert_alloc__RGB332(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_invert_alloc__CMYK8888(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_invert_alloc__P2(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_P2);
+}
+static int filter_invert_alloc__P4(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_P4);
+}
+static int filter_invert_alloc__P8(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_P8);
+}
+static int filter_invert_alloc__G1(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_G1);
+}
+static int filter_invert_alloc__G2(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_G2);
+}
+static int filter_invert_alloc__G4(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_G4);
+}
+static int filter_invert_alloc__G8(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_G8);
+}
+static int filter_invert_alloc__GA88(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_GA88);
+}
+static int filter_invert_alloc__G16(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_G16);
+}
+static int filter_invert_alloc__RGBA8888_PM(void)
+{
+	return filter_invert_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_mirror_h__xRGB8888(void)
+{
+	return filter_mirror_h_(GP_PIXEL_xRGB8888);
+}
+static int filter_mirror_h__RGBA8888(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGBA8888);
+}
+static int filter_mirror_h__RGB888(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGB888);
+}
+static int filter_mirror_h__BGR888(void)
+{
+	return filter_mirror_h_(GP_PIXEL_BGR888);
+}
+static int filter_mirror_h__RGB555(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGB555);
+}
+static int filter_mirror_h__RGB565(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGB565);
+}
+static int filter_mirror_h__RGB666(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGB666);
+}
+static int filter_mirror_h__RGB332(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGB332);
+}
+static int filter_mirror_h__CMYK8888(void)
+{
+	return filter_mirror_h_(GP_PIXEL_CMYK8888);
+}
+static int filter_mirror_h__P2(void)
+{
+	return filter_mirror_h_(GP_PIXEL_P2);
+}
+static int filter_mirror_h__P4(void)
+{
+	return filter_mirror_h_(GP_PIXEL_P4);
+}
+static int filter_mirror_h__P8(void)
+{
+	return filter_mirror_h_(GP_PIXEL_P8);
+}
+static int filter_mirror_h__G1(void)
+{
+	return filter_mirror_h_(GP_PIXEL_G1);
+}
+static int filter_mirror_h__G2(void)
+{
+	return filter_mirror_h_(GP_PIXEL_G2);
+}
+static int filter_mirror_h__G4(void)
+{
+	return filter_mirror_h_(GP_PIXEL_G4);
+}
+static int filter_mirror_h__G8(void)
+{
+	return filter_mirror_h_(GP_PIXEL_G8);
+}
+static int filter_mirror_h__GA88(void)
+{
+	return filter_mirror_h_(GP_PIXEL_GA88);
+}
+static int filter_mirror_h__G16(void)
+{
+	return filter_mirror_h_(GP_PIXEL_G16);
+}
+static int filter_mirror_h__RGBA8888_PM(void)
+{
+	return filter_mirror_h_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_mirror_h_alloc__xRGB8888(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_mirror_h_alloc__RGBA8888(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_mirror_h_alloc__RGB888(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_mirror_h_alloc__BGR888(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_mirror_h_alloc__RGB555(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_mirror_h_alloc__RGB565(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_mirror_h_alloc__RGB666(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_mirror_h_alloc__RGB332(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_mirror_h_alloc__CMYK8888(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_mirror_h_alloc__P2(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_P2);
+}
+static int filter_mirror_h_alloc__P4(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_P4);
+}
+static int filter_mirror_h_alloc__P8(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_P8);
+}
+static int filter_mirror_h_alloc__G1(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_G1);
+}
+static int filter_mirror_h_alloc__G2(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_G2);
+}
+static int filter_mirror_h_alloc__G4(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_G4);
+}
+static int filter_mirror_h_alloc__G8(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_G8);
+}
+static int filter_mirror_h_alloc__GA88(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_GA88);
+}
+static int filter_mirror_h_alloc__G16(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_G16);
+}
+static int filter_mirror_h_alloc__RGBA8888_PM(void)
+{
+	return filter_mirror_h_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_mirror_v__xRGB8888(void)
+{
+	return filter_mirror_v_(GP_PIXEL_xRGB8888);
+}
+static int filter_mirror_v__RGBA8888(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGBA8888);
+}
+static int filter_mirror_v__RGB888(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGB888);
+}
+static int filter_mirror_v__BGR888(void)
+{
+	return filter_mirror_v_(GP_PIXEL_BGR888);
+}
+static int filter_mirror_v__RGB555(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGB555);
+}
+static int filter_mirror_v__RGB565(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGB565);
+}
+static int filter_mirror_v__RGB666(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGB666);
+}
+static int filter_mirror_v__RGB332(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGB332);
+}
+static int filter_mirror_v__CMYK8888(void)
+{
+	return filter_mirror_v_(GP_PIXEL_CMYK8888);
+}
+static int filter_mirror_v__P2(void)
+{
+	return filter_mirror_v_(GP_PIXEL_P2);
+}
+static int filter_mirror_v__P4(void)
+{
+	return filter_mirror_v_(GP_PIXEL_P4);
+}
+static int filter_mirror_v__P8(void)
+{
+	return filter_mirror_v_(GP_PIXEL_P8);
+}
+static int filter_mirror_v__G1(void)
+{
+	return filter_mirror_v_(GP_PIXEL_G1);
+}
+static int filter_mirror_v__G2(void)
+{
+	return filter_mirror_v_(GP_PIXEL_G2);
+}
+static int filter_mirror_v__G4(void)
+{
+	return filter_mirror_v_(GP_PIXEL_G4);
+}
+static int filter_mirror_v__G8(void)
+{
+	return filter_mirror_v_(GP_PIXEL_G8);
+}
+static int filter_mirror_v__GA88(void)
+{
+	return filter_mirror_v_(GP_PIXEL_GA88);
+}
+static int filter_mirror_v__G16(void)
+{
+	return filter_mirror_v_(GP_PIXEL_G16);
+}
+static int filter_mirror_v__RGBA8888_PM(void)
+{
+	return filter_mirror_v_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_mirror_v_alloc__xRGB8888(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_mirror_v_alloc__RGBA8888(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_mirror_v_alloc__RGB888(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_mirror_v_alloc__BGR888(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_mirror_v_alloc__RGB555(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_mirror_v_alloc__RGB565(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_mirror_v_alloc__RGB666(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_mirror_v_alloc__RGB332(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_mirror_v_alloc__CMYK8888(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_mirror_v_alloc__P2(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_P2);
+}
+static int filter_mirror_v_alloc__P4(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_P4);
+}
+static int filter_mirror_v_alloc__P8(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_P8);
+}
+static int filter_mirror_v_alloc__G1(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_G1);
+}
+static int filter_mirror_v_alloc__G2(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_G2);
+}
+static int filter_mirror_v_alloc__G4(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_G4);
+}
+static int filter_mirror_v_alloc__G8(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_G8);
+}
+static int filter_mirror_v_alloc__GA88(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_GA88);
+}
+static int filter_mirror_v_alloc__G16(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_G16);
+}
+static int filter_mirror_v_alloc__RGBA8888_PM(void)
+{
+	return filter_mirror_v_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_90__xRGB8888(void)
+{
+	return filter_rotate_90_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_90__RGBA8888(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_90__RGB888(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_90__BGR888(void)
+{
+	return filter_rotate_90_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_90__RGB555(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_90__RGB565(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_90__RGB666(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_90__RGB332(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_90__CMYK8888(void)
+{
+	return filter_rotate_90_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_90__P2(void)
+{
+	return filter_rotate_90_(GP_PIXEL_P2);
+}
+static int filter_rotate_90__P4(void)
+{
+	return filter_rotate_90_(GP_PIXEL_P4);
+}
+static int filter_rotate_90__P8(void)
+{
+	return filter_rotate_90_(GP_PIXEL_P8);
+}
+static int filter_rotate_90__G1(void)
+{
+	return filter_rotate_90_(GP_PIXEL_G1);
+}
+static int filter_rotate_90__G2(void)
+{
+	return filter_rotate_90_(GP_PIXEL_G2);
+}
+static int filter_rotate_90__G4(void)
+{
+	return filter_rotate_90_(GP_PIXEL_G4);
+}
+static int filter_rotate_90__G8(void)
+{
+	return filter_rotate_90_(GP_PIXEL_G8);
+}
+static int filter_rotate_90__GA88(void)
+{
+	return filter_rotate_90_(GP_PIXEL_GA88);
+}
+static int filter_rotate_90__G16(void)
+{
+	return filter_rotate_90_(GP_PIXEL_G16);
+}
+static int filter_rotate_90__RGBA8888_PM(void)
+{
+	return filter_rotate_90_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_90_alloc__xRGB8888(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_90_alloc__RGBA8888(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_90_alloc__RGB888(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_90_alloc__BGR888(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_90_alloc__RGB555(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_90_alloc__RGB565(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_90_alloc__RGB666(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_90_alloc__RGB332(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_90_alloc__CMYK8888(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_90_alloc__P2(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_P2);
+}
+static int filter_rotate_90_alloc__P4(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_P4);
+}
+static int filter_rotate_90_alloc__P8(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_P8);
+}
+static int filter_rotate_90_alloc__G1(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_G1);
+}
+static int filter_rotate_90_alloc__G2(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_G2);
+}
+static int filter_rotate_90_alloc__G4(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_G4);
+}
+static int filter_rotate_90_alloc__G8(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_G8);
+}
+static int filter_rotate_90_alloc__GA88(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_GA88);
+}
+static int filter_rotate_90_alloc__G16(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_G16);
+}
+static int filter_rotate_90_alloc__RGBA8888_PM(void)
+{
+	return filter_rotate_90_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_180__xRGB8888(void)
+{
+	return filter_rotate_180_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_180__RGBA8888(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_180__RGB888(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_180__BGR888(void)
+{
+	return filter_rotate_180_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_180__RGB555(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_180__RGB565(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_180__RGB666(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_180__RGB332(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_180__CMYK8888(void)
+{
+	return filter_rotate_180_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_180__P2(void)
+{
+	return filter_rotate_180_(GP_PIXEL_P2);
+}
+static int filter_rotate_180__P4(void)
+{
+	return filter_rotate_180_(GP_PIXEL_P4);
+}
+static int filter_rotate_180__P8(void)
+{
+	return filter_rotate_180_(GP_PIXEL_P8);
+}
+static int filter_rotate_180__G1(void)
+{
+	return filter_rotate_180_(GP_PIXEL_G1);
+}
+static int filter_rotate_180__G2(void)
+{
+	return filter_rotate_180_(GP_PIXEL_G2);
+}
+static int filter_rotate_180__G4(void)
+{
+	return filter_rotate_180_(GP_PIXEL_G4);
+}
+static int filter_rotate_180__G8(void)
+{
+	return filter_rotate_180_(GP_PIXEL_G8);
+}
+static int filter_rotate_180__GA88(void)
+{
+	return filter_rotate_180_(GP_PIXEL_GA88);
+}
+static int filter_rotate_180__G16(void)
+{
+	return filter_rotate_180_(GP_PIXEL_G16);
+}
+static int filter_rotate_180__RGBA8888_PM(void)
+{
+	return filter_rotate_180_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_180_alloc__xRGB8888(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_180_alloc__RGBA8888(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_180_alloc__RGB888(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_180_alloc__BGR888(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_180_alloc__RGB555(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_180_alloc__RGB565(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_180_alloc__RGB666(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_180_alloc__RGB332(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_180_alloc__CMYK8888(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_180_alloc__P2(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_P2);
+}
+static int filter_rotate_180_alloc__P4(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_P4);
+}
+static int filter_rotate_180_alloc__P8(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_P8);
+}
+static int filter_rotate_180_alloc__G1(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_G1);
+}
+static int filter_rotate_180_alloc__G2(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_G2);
+}
+static int filter_rotate_180_alloc__G4(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_G4);
+}
+static int filter_rotate_180_alloc__G8(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_G8);
+}
+static int filter_rotate_180_alloc__GA88(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_GA88);
+}
+static int filter_rotate_180_alloc__G16(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_G16);
+}
+static int filter_rotate_180_alloc__RGBA8888_PM(void)
+{
+	return filter_rotate_180_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_270__xRGB8888(void)
+{
+	return filter_rotate_270_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_270__RGBA8888(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_270__RGB888(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_270__BGR888(void)
+{
+	return filter_rotate_270_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_270__RGB555(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_270__RGB565(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_270__RGB666(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_270__RGB332(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_270__CMYK8888(void)
+{
+	return filter_rotate_270_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_270__P2(void)
+{
+	return filter_rotate_270_(GP_PIXEL_P2);
+}
+static int filter_rotate_270__P4(void)
+{
+	return filter_rotate_270_(GP_PIXEL_P4);
+}
+static int filter_rotate_270__P8(void)
+{
+	return filter_rotate_270_(GP_PIXEL_P8);
+}
+static int filter_rotate_270__G1(void)
+{
+	return filter_rotate_270_(GP_PIXEL_G1);
+}
+static int filter_rotate_270__G2(void)
+{
+	return filter_rotate_270_(GP_PIXEL_G2);
+}
+static int filter_rotate_270__G4(void)
+{
+	return filter_rotate_270_(GP_PIXEL_G4);
+}
+static int filter_rotate_270__G8(void)
+{
+	return filter_rotate_270_(GP_PIXEL_G8);
+}
+static int filter_rotate_270__GA88(void)
+{
+	return filter_rotate_270_(GP_PIXEL_GA88);
+}
+static int filter_rotate_270__G16(void)
+{
+	return filter_rotate_270_(GP_PIXEL_G16);
+}
+static int filter_rotate_270__RGBA8888_PM(void)
+{
+	return filter_rotate_270_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_rotate_270_alloc__xRGB8888(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_rotate_270_alloc__RGBA8888(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_rotate_270_alloc__RGB888(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_rotate_270_alloc__BGR888(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_rotate_270_alloc__RGB555(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_rotate_270_alloc__RGB565(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_rotate_270_alloc__RGB666(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_rotate_270_alloc__RGB332(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_rotate_270_alloc__CMYK8888(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_rotate_270_alloc__P2(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_P2);
+}
+static int filter_rotate_270_alloc__P4(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_P4);
+}
+static int filter_rotate_270_alloc__P8(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_P8);
+}
+static int filter_rotate_270_alloc__G1(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_G1);
+}
+static int filter_rotate_270_alloc__G2(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_G2);
+}
+static int filter_rotate_270_alloc__G4(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_G4);
+}
+static int filter_rotate_270_alloc__G8(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_G8);
+}
+static int filter_rotate_270_alloc__GA88(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_GA88);
+}
+static int filter_rotate_270_alloc__G16(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_G16);
+}
+static int filter_rotate_270_alloc__RGBA8888_PM(void)
+{
+	return filter_rotate_270_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_H_xRGB8888(void)
+{
+	return filter_symmetry_H(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_H_RGBA8888(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_H_RGB888(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_H_BGR888(void)
+{
+	return filter_symmetry_H(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_H_RGB555(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_H_RGB565(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_H_RGB666(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_H_RGB332(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_H_CMYK8888(void)
+{
+	return filter_symmetry_H(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_H_P2(void)
+{
+	return filter_symmetry_H(GP_PIXEL_P2);
+}
+static int filter_symmetry_H_P4(void)
+{
+	return filter_symmetry_H(GP_PIXEL_P4);
+}
+static int filter_symmetry_H_P8(void)
+{
+	return filter_symmetry_H(GP_PIXEL_P8);
+}
+static int filter_symmetry_H_G1(void)
+{
+	return filter_symmetry_H(GP_PIXEL_G1);
+}
+static int filter_symmetry_H_G2(void)
+{
+	return filter_symmetry_H(GP_PIXEL_G2);
+}
+static int filter_symmetry_H_G4(void)
+{
+	return filter_symmetry_H(GP_PIXEL_G4);
+}
+static int filter_symmetry_H_G8(void)
+{
+	return filter_symmetry_H(GP_PIXEL_G8);
+}
+static int filter_symmetry_H_GA88(void)
+{
+	return filter_symmetry_H(GP_PIXEL_GA88);
+}
+static int filter_symmetry_H_G16(void)
+{
+	return filter_symmetry_H(GP_PIXEL_G16);
+}
+static int filter_symmetry_H_RGBA8888_PM(void)
+{
+	return filter_symmetry_H(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_alloc_H_xRGB8888(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_alloc_H_RGBA8888(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_alloc_H_RGB888(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_alloc_H_BGR888(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_alloc_H_RGB555(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_alloc_H_RGB565(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_alloc_H_RGB666(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_alloc_H_RGB332(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_alloc_H_CMYK8888(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_alloc_H_P2(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_P2);
+}
+static int filter_symmetry_alloc_H_P4(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_P4);
+}
+static int filter_symmetry_alloc_H_P8(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_P8);
+}
+static int filter_symmetry_alloc_H_G1(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_G1);
+}
+static int filter_symmetry_alloc_H_G2(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_G2);
+}
+static int filter_symmetry_alloc_H_G4(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_G4);
+}
+static int filter_symmetry_alloc_H_G8(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_G8);
+}
+static int filter_symmetry_alloc_H_GA88(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_GA88);
+}
+static int filter_symmetry_alloc_H_G16(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_G16);
+}
+static int filter_symmetry_alloc_H_RGBA8888_PM(void)
+{
+	return filter_symmetry_alloc_H(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_V_xRGB8888(void)
+{
+	return filter_symmetry_V(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_V_RGBA8888(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_V_RGB888(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_V_BGR888(void)
+{
+	return filter_symmetry_V(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_V_RGB555(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_V_RGB565(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_V_RGB666(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_V_RGB332(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_V_CMYK8888(void)
+{
+	return filter_symmetry_V(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_V_P2(void)
+{
+	return filter_symmetry_V(GP_PIXEL_P2);
+}
+static int filter_symmetry_V_P4(void)
+{
+	return filter_symmetry_V(GP_PIXEL_P4);
+}
+static int filter_symmetry_V_P8(void)
+{
+	return filter_symmetry_V(GP_PIXEL_P8);
+}
+static int filter_symmetry_V_G1(void)
+{
+	return filter_symmetry_V(GP_PIXEL_G1);
+}
+static int filter_symmetry_V_G2(void)
+{
+	return filter_symmetry_V(GP_PIXEL_G2);
+}
+static int filter_symmetry_V_G4(void)
+{
+	return filter_symmetry_V(GP_PIXEL_G4);
+}
+static int filter_symmetry_V_G8(void)
+{
+	return filter_symmetry_V(GP_PIXEL_G8);
+}
+static int filter_symmetry_V_GA88(void)
+{
+	return filter_symmetry_V(GP_PIXEL_GA88);
+}
+static int filter_symmetry_V_G16(void)
+{
+	return filter_symmetry_V(GP_PIXEL_G16);
+}
+static int filter_symmetry_V_RGBA8888_PM(void)
+{
+	return filter_symmetry_V(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_alloc_V_xRGB8888(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_alloc_V_RGBA8888(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_alloc_V_RGB888(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_alloc_V_BGR888(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_alloc_V_RGB555(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_alloc_V_RGB565(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_alloc_V_RGB666(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_alloc_V_RGB332(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_alloc_V_CMYK8888(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_alloc_V_P2(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_P2);
+}
+static int filter_symmetry_alloc_V_P4(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_P4);
+}
+static int filter_symmetry_alloc_V_P8(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_P8);
+}
+static int filter_symmetry_alloc_V_G1(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_G1);
+}
+static int filter_symmetry_alloc_V_G2(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_G2);
+}
+static int filter_symmetry_alloc_V_G4(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_G4);
+}
+static int filter_symmetry_alloc_V_G8(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_G8);
+}
+static int filter_symmetry_alloc_V_GA88(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_GA88);
+}
+static int filter_symmetry_alloc_V_G16(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_G16);
+}
+static int filter_symmetry_alloc_V_RGBA8888_PM(void)
+{
+	return filter_symmetry_alloc_V(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_90_xRGB8888(void)
+{
+	return filter_symmetry_90(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_90_RGBA8888(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_90_RGB888(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_90_BGR888(void)
+{
+	return filter_symmetry_90(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_90_RGB555(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_90_RGB565(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_90_RGB666(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_90_RGB332(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_90_CMYK8888(void)
+{
+	return filter_symmetry_90(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_90_P2(void)
+{
+	return filter_symmetry_90(GP_PIXEL_P2);
+}
+static int filter_symmetry_90_P4(void)
+{
+	return filter_symmetry_90(GP_PIXEL_P4);
+}
+static int filter_symmetry_90_P8(void)
+{
+	return filter_symmetry_90(GP_PIXEL_P8);
+}
+static int filter_symmetry_90_G1(void)
+{
+	return filter_symmetry_90(GP_PIXEL_G1);
+}
+static int filter_symmetry_90_G2(void)
+{
+	return filter_symmetry_90(GP_PIXEL_G2);
+}
+static int filter_symmetry_90_G4(void)
+{
+	return filter_symmetry_90(GP_PIXEL_G4);
+}
+static int filter_symmetry_90_G8(void)
+{
+	return filter_symmetry_90(GP_PIXEL_G8);
+}
+static int filter_symmetry_90_GA88(void)
+{
+	return filter_symmetry_90(GP_PIXEL_GA88);
+}
+static int filter_symmetry_90_G16(void)
+{
+	return filter_symmetry_90(GP_PIXEL_G16);
+}
+static int filter_symmetry_90_RGBA8888_PM(void)
+{
+	return filter_symmetry_90(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_alloc_90_xRGB8888(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_alloc_90_RGBA8888(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_alloc_90_RGB888(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_alloc_90_BGR888(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_alloc_90_RGB555(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_alloc_90_RGB565(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_alloc_90_RGB666(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_alloc_90_RGB332(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_alloc_90_CMYK8888(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_alloc_90_P2(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_P2);
+}
+static int filter_symmetry_alloc_90_P4(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_P4);
+}
+static int filter_symmetry_alloc_90_P8(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_P8);
+}
+static int filter_symmetry_alloc_90_G1(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_G1);
+}
+static int filter_symmetry_alloc_90_G2(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_G2);
+}
+static int filter_symmetry_alloc_90_G4(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_G4);
+}
+static int filter_symmetry_alloc_90_G8(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_G8);
+}
+static int filter_symmetry_alloc_90_GA88(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_GA88);
+}
+static int filter_symmetry_alloc_90_G16(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_G16);
+}
+static int filter_symmetry_alloc_90_RGBA8888_PM(void)
+{
+	return filter_symmetry_alloc_90(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_180_xRGB8888(void)
+{
+	return filter_symmetry_180(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_180_RGBA8888(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_180_RGB888(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_180_BGR888(void)
+{
+	return filter_symmetry_180(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_180_RGB555(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_180_RGB565(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_180_RGB666(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_180_RGB332(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_180_CMYK8888(void)
+{
+	return filter_symmetry_180(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_180_P2(void)
+{
+	return filter_symmetry_180(GP_PIXEL_P2);
+}
+static int filter_symmetry_180_P4(void)
+{
+	return filter_symmetry_180(GP_PIXEL_P4);
+}
+static int filter_symmetry_180_P8(void)
+{
+	return filter_symmetry_180(GP_PIXEL_P8);
+}
+static int filter_symmetry_180_G1(void)
+{
+	return filter_symmetry_180(GP_PIXEL_G1);
+}
+static int filter_symmetry_180_G2(void)
+{
+	return filter_symmetry_180(GP_PIXEL_G2);
+}
+static int filter_symmetry_180_G4(void)
+{
+	return filter_symmetry_180(GP_PIXEL_G4);
+}
+static int filter_symmetry_180_G8(void)
+{
+	return filter_symmetry_180(GP_PIXEL_G8);
+}
+static int filter_symmetry_180_GA88(void)
+{
+	return filter_symmetry_180(GP_PIXEL_GA88);
+}
+static int filter_symmetry_180_G16(void)
+{
+	return filter_symmetry_180(GP_PIXEL_G16);
+}
+static int filter_symmetry_180_RGBA8888_PM(void)
+{
+	return filter_symmetry_180(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_alloc_180_xRGB8888(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_alloc_180_RGBA8888(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_alloc_180_RGB888(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_alloc_180_BGR888(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_alloc_180_RGB555(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_alloc_180_RGB565(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_alloc_180_RGB666(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_alloc_180_RGB332(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_alloc_180_CMYK8888(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_alloc_180_P2(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_P2);
+}
+static int filter_symmetry_alloc_180_P4(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_P4);
+}
+static int filter_symmetry_alloc_180_P8(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_P8);
+}
+static int filter_symmetry_alloc_180_G1(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_G1);
+}
+static int filter_symmetry_alloc_180_G2(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_G2);
+}
+static int filter_symmetry_alloc_180_G4(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_G4);
+}
+static int filter_symmetry_alloc_180_G8(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_G8);
+}
+static int filter_symmetry_alloc_180_GA88(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_GA88);
+}
+static int filter_symmetry_alloc_180_G16(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_G16);
+}
+static int filter_symmetry_alloc_180_RGBA8888_PM(void)
+{
+	return filter_symmetry_alloc_180(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_270_xRGB8888(void)
+{
+	return filter_symmetry_270(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_270_RGBA8888(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_270_RGB888(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_270_BGR888(void)
+{
+	return filter_symmetry_270(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_270_RGB555(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_270_RGB565(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_270_RGB666(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_270_RGB332(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_270_CMYK8888(void)
+{
+	return filter_symmetry_270(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_270_P2(void)
+{
+	return filter_symmetry_270(GP_PIXEL_P2);
+}
+static int filter_symmetry_270_P4(void)
+{
+	return filter_symmetry_270(GP_PIXEL_P4);
+}
+static int filter_symmetry_270_P8(void)
+{
+	return filter_symmetry_270(GP_PIXEL_P8);
+}
+static int filter_symmetry_270_G1(void)
+{
+	return filter_symmetry_270(GP_PIXEL_G1);
+}
+static int filter_symmetry_270_G2(void)
+{
+	return filter_symmetry_270(GP_PIXEL_G2);
+}
+static int filter_symmetry_270_G4(void)
+{
+	return filter_symmetry_270(GP_PIXEL_G4);
+}
+static int filter_symmetry_270_G8(void)
+{
+	return filter_symmetry_270(GP_PIXEL_G8);
+}
+static int filter_symmetry_270_GA88(void)
+{
+	return filter_symmetry_270(GP_PIXEL_GA88);
+}
+static int filter_symmetry_270_G16(void)
+{
+	return filter_symmetry_270(GP_PIXEL_G16);
+}
+static int filter_symmetry_270_RGBA8888_PM(void)
+{
+	return filter_symmetry_270(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_symmetry_alloc_270_xRGB8888(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_xRGB8888);
+}
+static int filter_symmetry_alloc_270_RGBA8888(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGBA8888);
+}
+static int filter_symmetry_alloc_270_RGB888(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGB888);
+}
+static int filter_symmetry_alloc_270_BGR888(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_BGR888);
+}
+static int filter_symmetry_alloc_270_RGB555(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGB555);
+}
+static int filter_symmetry_alloc_270_RGB565(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGB565);
+}
+static int filter_symmetry_alloc_270_RGB666(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGB666);
+}
+static int filter_symmetry_alloc_270_RGB332(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGB332);
+}
+static int filter_symmetry_alloc_270_CMYK8888(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_CMYK8888);
+}
+static int filter_symmetry_alloc_270_P2(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_P2);
+}
+static int filter_symmetry_alloc_270_P4(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_P4);
+}
+static int filter_symmetry_alloc_270_P8(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_P8);
+}
+static int filter_symmetry_alloc_270_G1(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_G1);
+}
+static int filter_symmetry_alloc_270_G2(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_G2);
+}
+static int filter_symmetry_alloc_270_G4(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_G4);
+}
+static int filter_symmetry_alloc_270_G8(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_G8);
+}
+static int filter_symmetry_alloc_270_GA88(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_GA88);
+}
+static int filter_symmetry_alloc_270_G16(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_G16);
+}
+static int filter_symmetry_alloc_270_RGBA8888_PM(void)
+{
+	return filter_symmetry_alloc_270(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_convolution__xRGB8888(void)
+{
+	return filter_convolution_(GP_PIXEL_xRGB8888);
+}
+static int filter_convolution__RGBA8888(void)
+{
+	return filter_convolution_(GP_PIXEL_RGBA8888);
+}
+static int filter_convolution__RGB888(void)
+{
+	return filter_convolution_(GP_PIXEL_RGB888);
+}
+static int filter_convolution__BGR888(void)
+{
+	return filter_convolution_(GP_PIXEL_BGR888);
+}
+static int filter_convolution__RGB555(void)
+{
+	return filter_convolution_(GP_PIXEL_RGB555);
+}
+static int filter_convolution__RGB565(void)
+{
+	return filter_convolution_(GP_PIXEL_RGB565);
+}
+static int filter_convolution__RGB666(void)
+{
+	return filter_convolution_(GP_PIXEL_RGB666);
+}
+static int filter_convolution__RGB332(void)
+{
+	return filter_convolution_(GP_PIXEL_RGB332);
+}
+static int filter_convolution__CMYK8888(void)
+{
+	return filter_convolution_(GP_PIXEL_CMYK8888);
+}
+static int filter_convolution__P2(void)
+{
+	return filter_convolution_(GP_PIXEL_P2);
+}
+static int filter_convolution__P4(void)
+{
+	return filter_convolution_(GP_PIXEL_P4);
+}
+static int filter_convolution__P8(void)
+{
+	return filter_convolution_(GP_PIXEL_P8);
+}
+static int filter_convolution__G1(void)
+{
+	return filter_convolution_(GP_PIXEL_G1);
+}
+static int filter_convolution__G2(void)
+{
+	return filter_convolution_(GP_PIXEL_G2);
+}
+static int filter_convolution__G4(void)
+{
+	return filter_convolution_(GP_PIXEL_G4);
+}
+static int filter_convolution__G8(void)
+{
+	return filter_convolution_(GP_PIXEL_G8);
+}
+static int filter_convolution__GA88(void)
+{
+	return filter_convolution_(GP_PIXEL_GA88);
+}
+static int filter_convolution__G16(void)
+{
+	return filter_convolution_(GP_PIXEL_G16);
+}
+static int filter_convolution__RGBA8888_PM(void)
+{
+	return filter_convolution_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_convolution_alloc__xRGB8888(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_convolution_alloc__RGBA8888(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_convolution_alloc__RGB888(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_convolution_alloc__BGR888(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_convolution_alloc__RGB555(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_convolution_alloc__RGB565(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_convolution_alloc__RGB666(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_convolution_alloc__RGB332(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_convolution_alloc__CMYK8888(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_convolution_alloc__P2(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_P2);
+}
+static int filter_convolution_alloc__P4(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_P4);
+}
+static int filter_convolution_alloc__P8(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_P8);
+}
+static int filter_convolution_alloc__G1(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_G1);
+}
+static int filter_convolution_alloc__G2(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_G2);
+}
+static int filter_convolution_alloc__G4(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_G4);
+}
+static int filter_convolution_alloc__G8(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_G8);
+}
+static int filter_convolution_alloc__GA88(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_GA88);
+}
+static int filter_convolution_alloc__G16(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_G16);
+}
+static int filter_convolution_alloc__RGBA8888_PM(void)
+{
+	return filter_convolution_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_gaussian_blur__xRGB8888(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_xRGB8888);
+}
+static int filter_gaussian_blur__RGBA8888(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGBA8888);
+}
+static int filter_gaussian_blur__RGB888(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGB888);
+}
+static int filter_gaussian_blur__BGR888(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_BGR888);
+}
+static int filter_gaussian_blur__RGB555(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGB555);
+}
+static int filter_gaussian_blur__RGB565(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGB565);
+}
+static int filter_gaussian_blur__RGB666(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGB666);
+}
+static int filter_gaussian_blur__RGB332(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGB332);
+}
+static int filter_gaussian_blur__CMYK8888(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_CMYK8888);
+}
+static int filter_gaussian_blur__P2(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_P2);
+}
+static int filter_gaussian_blur__P4(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_P4);
+}
+static int filter_gaussian_blur__P8(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_P8);
+}
+static int filter_gaussian_blur__G1(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_G1);
+}
+static int filter_gaussian_blur__G2(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_G2);
+}
+static int filter_gaussian_blur__G4(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_G4);
+}
+static int filter_gaussian_blur__G8(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_G8);
+}
+static int filter_gaussian_blur__GA88(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_GA88);
+}
+static int filter_gaussian_blur__G16(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_G16);
+}
+static int filter_gaussian_blur__RGBA8888_PM(void)
+{
+	return filter_gaussian_blur_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_gaussian_blur_alloc__xRGB8888(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_gaussian_blur_alloc__RGBA8888(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_gaussian_blur_alloc__RGB888(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_gaussian_blur_alloc__BGR888(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_gaussian_blur_alloc__RGB555(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_gaussian_blur_alloc__RGB565(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_gaussian_blur_alloc__RGB666(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_gaussian_blur_alloc__RGB332(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_gaussian_blur_alloc__CMYK8888(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_gaussian_blur_alloc__P2(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_P2);
+}
+static int filter_gaussian_blur_alloc__P4(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_P4);
+}
+static int filter_gaussian_blur_alloc__P8(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_P8);
+}
+static int filter_gaussian_blur_alloc__G1(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_G1);
+}
+static int filter_gaussian_blur_alloc__G2(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_G2);
+}
+static int filter_gaussian_blur_alloc__G4(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_G4);
+}
+static int filter_gaussian_blur_alloc__G8(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_G8);
+}
+static int filter_gaussian_blur_alloc__GA88(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_GA88);
+}
+static int filter_gaussian_blur_alloc__G16(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_G16);
+}
+static int filter_gaussian_blur_alloc__RGBA8888_PM(void)
+{
+	return filter_gaussian_blur_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_gaussian_noise_add__xRGB8888(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_xRGB8888);
+}
+static int filter_gaussian_noise_add__RGBA8888(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGBA8888);
+}
+static int filter_gaussian_noise_add__RGB888(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGB888);
+}
+static int filter_gaussian_noise_add__BGR888(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_BGR888);
+}
+static int filter_gaussian_noise_add__RGB555(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGB555);
+}
+static int filter_gaussian_noise_add__RGB565(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGB565);
+}
+static int filter_gaussian_noise_add__RGB666(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGB666);
+}
+static int filter_gaussian_noise_add__RGB332(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGB332);
+}
+static int filter_gaussian_noise_add__CMYK8888(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_CMYK8888);
+}
+static int filter_gaussian_noise_add__P2(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_P2);
+}
+static int filter_gaussian_noise_add__P4(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_P4);
+}
+static int filter_gaussian_noise_add__P8(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_P8);
+}
+static int filter_gaussian_noise_add__G1(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_G1);
+}
+static int filter_gaussian_noise_add__G2(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_G2);
+}
+static int filter_gaussian_noise_add__G4(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_G4);
+}
+static int filter_gaussian_noise_add__G8(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_G8);
+}
+static int filter_gaussian_noise_add__GA88(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_GA88);
+}
+static int filter_gaussian_noise_add__G16(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_G16);
+}
+static int filter_gaussian_noise_add__RGBA8888_PM(void)
+{
+	return filter_gaussian_noise_add_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_gaussian_noise_add_alloc__xRGB8888(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_gaussian_noise_add_alloc__RGBA8888(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_gaussian_noise_add_alloc__RGB888(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_gaussian_noise_add_alloc__BGR888(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_gaussian_noise_add_alloc__RGB555(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_gaussian_noise_add_alloc__RGB565(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_gaussian_noise_add_alloc__RGB666(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_gaussian_noise_add_alloc__RGB332(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_gaussian_noise_add_alloc__CMYK8888(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_gaussian_noise_add_alloc__P2(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_P2);
+}
+static int filter_gaussian_noise_add_alloc__P4(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_P4);
+}
+static int filter_gaussian_noise_add_alloc__P8(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_P8);
+}
+static int filter_gaussian_noise_add_alloc__G1(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_G1);
+}
+static int filter_gaussian_noise_add_alloc__G2(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_G2);
+}
+static int filter_gaussian_noise_add_alloc__G4(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_G4);
+}
+static int filter_gaussian_noise_add_alloc__G8(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_G8);
+}
+static int filter_gaussian_noise_add_alloc__GA88(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_GA88);
+}
+static int filter_gaussian_noise_add_alloc__G16(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_G16);
+}
+static int filter_gaussian_noise_add_alloc__RGBA8888_PM(void)
+{
+	return filter_gaussian_noise_add_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_median__xRGB8888(void)
+{
+	return filter_median_(GP_PIXEL_xRGB8888);
+}
+static int filter_median__RGBA8888(void)
+{
+	return filter_median_(GP_PIXEL_RGBA8888);
+}
+static int filter_median__RGB888(void)
+{
+	return filter_median_(GP_PIXEL_RGB888);
+}
+static int filter_median__BGR888(void)
+{
+	return filter_median_(GP_PIXEL_BGR888);
+}
+static int filter_median__RGB555(void)
+{
+	return filter_median_(GP_PIXEL_RGB555);
+}
+static int filter_median__RGB565(void)
+{
+	return filter_median_(GP_PIXEL_RGB565);
+}
+static int filter_median__RGB666(void)
+{
+	return filter_median_(GP_PIXEL_RGB666);
+}
+static int filter_median__RGB332(void)
+{
+	return filter_median_(GP_PIXEL_RGB332);
+}
+static int filter_median__CMYK8888(void)
+{
+	return filter_median_(GP_PIXEL_CMYK8888);
+}
+static int filter_median__P2(void)
+{
+	return filter_median_(GP_PIXEL_P2);
+}
+static int filter_median__P4(void)
+{
+	return filter_median_(GP_PIXEL_P4);
+}
+static int filter_median__P8(void)
+{
+	return filter_median_(GP_PIXEL_P8);
+}
+static int filter_median__G1(void)
+{
+	return filter_median_(GP_PIXEL_G1);
+}
+static int filter_median__G2(void)
+{
+	return filter_median_(GP_PIXEL_G2);
+}
+static int filter_median__G4(void)
+{
+	return filter_median_(GP_PIXEL_G4);
+}
+static int filter_median__G8(void)
+{
+	return filter_median_(GP_PIXEL_G8);
+}
+static int filter_median__GA88(void)
+{
+	return filter_median_(GP_PIXEL_GA88);
+}
+static int filter_median__G16(void)
+{
+	return filter_median_(GP_PIXEL_G16);
+}
+static int filter_median__RGBA8888_PM(void)
+{
+	return filter_median_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_median_alloc__xRGB8888(void)
+{
+	return filter_median_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_median_alloc__RGBA8888(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_median_alloc__RGB888(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_median_alloc__BGR888(void)
+{
+	return filter_median_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_median_alloc__RGB555(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_median_alloc__RGB565(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_median_alloc__RGB666(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_median_alloc__RGB332(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_median_alloc__CMYK8888(void)
+{
+	return filter_median_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_median_alloc__P2(void)
+{
+	return filter_median_alloc_(GP_PIXEL_P2);
+}
+static int filter_median_alloc__P4(void)
+{
+	return filter_median_alloc_(GP_PIXEL_P4);
+}
+static int filter_median_alloc__P8(void)
+{
+	return filter_median_alloc_(GP_PIXEL_P8);
+}
+static int filter_median_alloc__G1(void)
+{
+	return filter_median_alloc_(GP_PIXEL_G1);
+}
+static int filter_median_alloc__G2(void)
+{
+	return filter_median_alloc_(GP_PIXEL_G2);
+}
+static int filter_median_alloc__G4(void)
+{
+	return filter_median_alloc_(GP_PIXEL_G4);
+}
+static int filter_median_alloc__G8(void)
+{
+	return filter_median_alloc_(GP_PIXEL_G8);
+}
+static int filter_median_alloc__GA88(void)
+{
+	return filter_median_alloc_(GP_PIXEL_GA88);
+}
+static int filter_median_alloc__G16(void)
+{
+	return filter_median_alloc_(GP_PIXEL_G16);
+}
+static int filter_median_alloc__RGBA8888_PM(void)
+{
+	return filter_median_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_weighted_median__xRGB8888(void)
+{
+	return filter_weighted_median_(GP_PIXEL_xRGB8888);
+}
+static int filter_weighted_median__RGBA8888(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGBA8888);
+}
+static int filter_weighted_median__RGB888(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGB888);
+}
+static int filter_weighted_median__BGR888(void)
+{
+	return filter_weighted_median_(GP_PIXEL_BGR888);
+}
+static int filter_weighted_median__RGB555(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGB555);
+}
+static int filter_weighted_median__RGB565(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGB565);
+}
+static int filter_weighted_median__RGB666(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGB666);
+}
+static int filter_weighted_median__RGB332(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGB332);
+}
+static int filter_weighted_median__CMYK8888(void)
+{
+	return filter_weighted_median_(GP_PIXEL_CMYK8888);
+}
+static int filter_weighted_median__P2(void)
+{
+	return filter_weighted_median_(GP_PIXEL_P2);
+}
+static int filter_weighted_median__P4(void)
+{
+	return filter_weighted_median_(GP_PIXEL_P4);
+}
+static int filter_weighted_median__P8(void)
+{
+	return filter_weighted_median_(GP_PIXEL_P8);
+}
+static int filter_weighted_median__G1(void)
+{
+	return filter_weighted_median_(GP_PIXEL_G1);
+}
+static int filter_weighted_median__G2(void)
+{
+	return filter_weighted_median_(GP_PIXEL_G2);
+}
+static int filter_weighted_median__G4(void)
+{
+	return filter_weighted_median_(GP_PIXEL_G4);
+}
+static int filter_weighted_median__G8(void)
+{
+	return filter_weighted_median_(GP_PIXEL_G8);
+}
+static int filter_weighted_median__GA88(void)
+{
+	return filter_weighted_median_(GP_PIXEL_GA88);
+}
+static int filter_weighted_median__G16(void)
+{
+	return filter_weighted_median_(GP_PIXEL_G16);
+}
+static int filter_weighted_median__RGBA8888_PM(void)
+{
+	return filter_weighted_median_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_weighted_median_alloc__xRGB8888(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_weighted_median_alloc__RGBA8888(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_weighted_median_alloc__RGB888(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_weighted_median_alloc__BGR888(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_weighted_median_alloc__RGB555(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_weighted_median_alloc__RGB565(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_weighted_median_alloc__RGB666(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_weighted_median_alloc__RGB332(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_weighted_median_alloc__CMYK8888(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_weighted_median_alloc__P2(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_P2);
+}
+static int filter_weighted_median_alloc__P4(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_P4);
+}
+static int filter_weighted_median_alloc__P8(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_P8);
+}
+static int filter_weighted_median_alloc__G1(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_G1);
+}
+static int filter_weighted_median_alloc__G2(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_G2);
+}
+static int filter_weighted_median_alloc__G4(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_G4);
+}
+static int filter_weighted_median_alloc__G8(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_G8);
+}
+static int filter_weighted_median_alloc__GA88(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_GA88);
+}
+static int filter_weighted_median_alloc__G16(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_G16);
+}
+static int filter_weighted_median_alloc__RGBA8888_PM(void)
+{
+	return filter_weighted_median_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_sigma__xRGB8888(void)
+{
+	return filter_sigma_(GP_PIXEL_xRGB8888);
+}
+static int filter_sigma__RGBA8888(void)
+{
+	return filter_sigma_(GP_PIXEL_RGBA8888);
+}
+static int filter_sigma__RGB888(void)
+{
+	return filter_sigma_(GP_PIXEL_RGB888);
+}
+static int filter_sigma__BGR888(void)
+{
+	return filter_sigma_(GP_PIXEL_BGR888);
+}
+static int filter_sigma__RGB555(void)
+{
+	return filter_sigma_(GP_PIXEL_RGB555);
+}
+static int filter_sigma__RGB565(void)
+{
+	return filter_sigma_(GP_PIXEL_RGB565);
+}
+static int filter_sigma__RGB666(void)
+{
+	return filter_sigma_(GP_PIXEL_RGB666);
+}
+static int filter_sigma__RGB332(void)
+{
+	return filter_sigma_(GP_PIXEL_RGB332);
+}
+static int filter_sigma__CMYK8888(void)
+{
+	return filter_sigma_(GP_PIXEL_CMYK8888);
+}
+static int filter_sigma__P2(void)
+{
+	return filter_sigma_(GP_PIXEL_P2);
+}
+static int filter_sigma__P4(void)
+{
+	return filter_sigma_(GP_PIXEL_P4);
+}
+static int filter_sigma__P8(void)
+{
+	return filter_sigma_(GP_PIXEL_P8);
+}
+static int filter_sigma__G1(void)
+{
+	return filter_sigma_(GP_PIXEL_G1);
+}
+static int filter_sigma__G2(void)
+{
+	return filter_sigma_(GP_PIXEL_G2);
+}
+static int filter_sigma__G4(void)
+{
+	return filter_sigma_(GP_PIXEL_G4);
+}
+static int filter_sigma__G8(void)
+{
+	return filter_sigma_(GP_PIXEL_G8);
+}
+static int filter_sigma__GA88(void)
+{
+	return filter_sigma_(GP_PIXEL_GA88);
+}
+static int filter_sigma__G16(void)
+{
+	return filter_sigma_(GP_PIXEL_G16);
+}
+static int filter_sigma__RGBA8888_PM(void)
+{
+	return filter_sigma_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_sigma_alloc__xRGB8888(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_sigma_alloc__RGBA8888(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_sigma_alloc__RGB888(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_sigma_alloc__BGR888(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_sigma_alloc__RGB555(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_sigma_alloc__RGB565(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_sigma_alloc__RGB666(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_sigma_alloc__RGB332(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_sigma_alloc__CMYK8888(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_sigma_alloc__P2(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_P2);
+}
+static int filter_sigma_alloc__P4(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_P4);
+}
+static int filter_sigma_alloc__P8(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_P8);
+}
+static int filter_sigma_alloc__G1(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_G1);
+}
+static int filter_sigma_alloc__G2(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_G2);
+}
+static int filter_sigma_alloc__G4(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_G4);
+}
+static int filter_sigma_alloc__G8(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_G8);
+}
+static int filter_sigma_alloc__GA88(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_GA88);
+}
+static int filter_sigma_alloc__G16(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_G16);
+}
+static int filter_sigma_alloc__RGBA8888_PM(void)
+{
+	return filter_sigma_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_resize_nn__xRGB8888(void)
+{
+	return filter_resize_nn_(GP_PIXEL_xRGB8888);
+}
+static int filter_resize_nn__RGBA8888(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGBA8888);
+}
+static int filter_resize_nn__RGB888(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGB888);
+}
+static int filter_resize_nn__BGR888(void)
+{
+	return filter_resize_nn_(GP_PIXEL_BGR888);
+}
+static int filter_resize_nn__RGB555(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGB555);
+}
+static int filter_resize_nn__RGB565(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGB565);
+}
+static int filter_resize_nn__RGB666(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGB666);
+}
+static int filter_resize_nn__RGB332(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGB332);
+}
+static int filter_resize_nn__CMYK8888(void)
+{
+	return filter_resize_nn_(GP_PIXEL_CMYK8888);
+}
+static int filter_resize_nn__P2(void)
+{
+	return filter_resize_nn_(GP_PIXEL_P2);
+}
+static int filter_resize_nn__P4(void)
+{
+	return filter_resize_nn_(GP_PIXEL_P4);
+}
+static int filter_resize_nn__P8(void)
+{
+	return filter_resize_nn_(GP_PIXEL_P8);
+}
+static int filter_resize_nn__G1(void)
+{
+	return filter_resize_nn_(GP_PIXEL_G1);
+}
+static int filter_resize_nn__G2(void)
+{
+	return filter_resize_nn_(GP_PIXEL_G2);
+}
+static int filter_resize_nn__G4(void)
+{
+	return filter_resize_nn_(GP_PIXEL_G4);
+}
+static int filter_resize_nn__G8(void)
+{
+	return filter_resize_nn_(GP_PIXEL_G8);
+}
+static int filter_resize_nn__GA88(void)
+{
+	return filter_resize_nn_(GP_PIXEL_GA88);
+}
+static int filter_resize_nn__G16(void)
+{
+	return filter_resize_nn_(GP_PIXEL_G16);
+}
+static int filter_resize_nn__RGBA8888_PM(void)
+{
+	return filter_resize_nn_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_resize_nn_alloc__xRGB8888(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_resize_nn_alloc__RGBA8888(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_resize_nn_alloc__RGB888(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_resize_nn_alloc__BGR888(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_resize_nn_alloc__RGB555(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_resize_nn_alloc__RGB565(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_resize_nn_alloc__RGB666(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_resize_nn_alloc__RGB332(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_resize_nn_alloc__CMYK8888(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_resize_nn_alloc__P2(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_P2);
+}
+static int filter_resize_nn_alloc__P4(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_P4);
+}
+static int filter_resize_nn_alloc__P8(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_P8);
+}
+static int filter_resize_nn_alloc__G1(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_G1);
+}
+static int filter_resize_nn_alloc__G2(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_G2);
+}
+static int filter_resize_nn_alloc__G4(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_G4);
+}
+static int filter_resize_nn_alloc__G8(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_G8);
+}
+static int filter_resize_nn_alloc__GA88(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_GA88);
+}
+static int filter_resize_nn_alloc__G16(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_G16);
+}
+static int filter_resize_nn_alloc__RGBA8888_PM(void)
+{
+	return filter_resize_nn_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_floyd_steinberg__xRGB8888(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_xRGB8888);
+}
+static int filter_floyd_steinberg__RGBA8888(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGBA8888);
+}
+static int filter_floyd_steinberg__RGB888(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGB888);
+}
+static int filter_floyd_steinberg__BGR888(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_BGR888);
+}
+static int filter_floyd_steinberg__RGB555(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGB555);
+}
+static int filter_floyd_steinberg__RGB565(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGB565);
+}
+static int filter_floyd_steinberg__RGB666(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGB666);
+}
+static int filter_floyd_steinberg__RGB332(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGB332);
+}
+static int filter_floyd_steinberg__CMYK8888(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_CMYK8888);
+}
+static int filter_floyd_steinberg__P2(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_P2);
+}
+static int filter_floyd_steinberg__P4(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_P4);
+}
+static int filter_floyd_steinberg__P8(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_P8);
+}
+static int filter_floyd_steinberg__G1(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_G1);
+}
+static int filter_floyd_steinberg__G2(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_G2);
+}
+static int filter_floyd_steinberg__G4(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_G4);
+}
+static int filter_floyd_steinberg__G8(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_G8);
+}
+static int filter_floyd_steinberg__GA88(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_GA88);
+}
+static int filter_floyd_steinberg__G16(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_G16);
+}
+static int filter_floyd_steinberg__RGBA8888_PM(void)
+{
+	return filter_floyd_steinberg_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_floyd_steinberg_alloc__xRGB8888(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_floyd_steinberg_alloc__RGBA8888(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_floyd_steinberg_alloc__RGB888(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_floyd_steinberg_alloc__BGR888(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_floyd_steinberg_alloc__RGB555(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_floyd_steinberg_alloc__RGB565(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_floyd_steinberg_alloc__RGB666(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_floyd_steinberg_alloc__RGB332(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_floyd_steinberg_alloc__CMYK8888(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_floyd_steinberg_alloc__P2(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_P2);
+}
+static int filter_floyd_steinberg_alloc__P4(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_P4);
+}
+static int filter_floyd_steinberg_alloc__P8(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_P8);
+}
+static int filter_floyd_steinberg_alloc__G1(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_G1);
+}
+static int filter_floyd_steinberg_alloc__G2(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_G2);
+}
+static int filter_floyd_steinberg_alloc__G4(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_G4);
+}
+static int filter_floyd_steinberg_alloc__G8(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_G8);
+}
+static int filter_floyd_steinberg_alloc__GA88(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_GA88);
+}
+static int filter_floyd_steinberg_alloc__G16(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_G16);
+}
+static int filter_floyd_steinberg_alloc__RGBA8888_PM(void)
+{
+	return filter_floyd_steinberg_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_hilbert_peano__xRGB8888(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_xRGB8888);
+}
+static int filter_hilbert_peano__RGBA8888(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGBA8888);
+}
+static int filter_hilbert_peano__RGB888(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGB888);
+}
+static int filter_hilbert_peano__BGR888(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_BGR888);
+}
+static int filter_hilbert_peano__RGB555(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGB555);
+}
+static int filter_hilbert_peano__RGB565(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGB565);
+}
+static int filter_hilbert_peano__RGB666(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGB666);
+}
+static int filter_hilbert_peano__RGB332(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGB332);
+}
+static int filter_hilbert_peano__CMYK8888(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_CMYK8888);
+}
+static int filter_hilbert_peano__P2(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_P2);
+}
+static int filter_hilbert_peano__P4(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_P4);
+}
+static int filter_hilbert_peano__P8(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_P8);
+}
+static int filter_hilbert_peano__G1(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_G1);
+}
+static int filter_hilbert_peano__G2(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_G2);
+}
+static int filter_hilbert_peano__G4(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_G4);
+}
+static int filter_hilbert_peano__G8(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_G8);
+}
+static int filter_hilbert_peano__GA88(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_GA88);
+}
+static int filter_hilbert_peano__G16(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_G16);
+}
+static int filter_hilbert_peano__RGBA8888_PM(void)
+{
+	return filter_hilbert_peano_(GP_PIXEL_RGBA8888_PM);
+}
+static int filter_hilbert_peano_alloc__xRGB8888(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_xRGB8888);
+}
+static int filter_hilbert_peano_alloc__RGBA8888(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGBA8888);
+}
+static int filter_hilbert_peano_alloc__RGB888(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGB888);
+}
+static int filter_hilbert_peano_alloc__BGR888(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_BGR888);
+}
+static int filter_hilbert_peano_alloc__RGB555(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGB555);
+}
+static int filter_hilbert_peano_alloc__RGB565(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGB565);
+}
+static int filter_hilbert_peano_alloc__RGB666(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGB666);
+}
+static int filter_hilbert_peano_alloc__RGB332(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGB332);
+}
+static int filter_hilbert_peano_alloc__CMYK8888(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_CMYK8888);
+}
+static int filter_hilbert_peano_alloc__P2(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_P2);
+}
+static int filter_hilbert_peano_alloc__P4(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_P4);
+}
+static int filter_hilbert_peano_alloc__P8(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_P8);
+}
+static int filter_hilbert_peano_alloc__G1(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_G1);
+}
+static int filter_hilbert_peano_alloc__G2(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_G2);
+}
+static int filter_hilbert_peano_alloc__G4(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_G4);
+}
+static int filter_hilbert_peano_alloc__G8(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_G8);
+}
+static int filter_hilbert_peano_alloc__GA88(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_GA88);
+}
+static int filter_hilbert_peano_alloc__G16(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_G16);
+}
+static int filter_hilbert_peano_alloc__RGBA8888_PM(void)
+{
+	return filter_hilbert_peano_alloc_(GP_PIXEL_RGBA8888_PM);
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Filters API Coverage",
+	.tests = {
+		{.name = "Filter brightness  xRGB8888",
+		 .tst_fn = filter_brightness__xRGB8888},
+		{.name = "Filter brightness  RGBA8888",
+		 .tst_fn = filter_brightness__RGBA8888},
+		{.name = "Filter brightness  RGB888",
+		 .tst_fn = filter_brightness__RGB888},
+		{.name = "Filter brightness  BGR888",
+		 .tst_fn = filter_brightness__BGR888},
+		{.name = "Filter brightness  RGB555",
+		 .tst_fn = filter_brightness__RGB555},
+		{.name = "Filter brightness  RGB565",
+		 .tst_fn = filter_brightness__RGB565},
+		{.name = "Filter brightness  RGB666",
+		 .tst_fn = filter_brightness__RGB666},
+		{.name = "Filter brightness  RGB332",
+		 .tst_fn = filter_brightness__RGB332},
+		{.name = "Filter brightness  CMYK8888",
+		 .tst_fn = filter_brightness__CMYK8888},
+		{.name = "Filter brightness  P2",
+		 .tst_fn = filter_brightness__P2},
+		{.name = "Filter brightness  P4",
+		 .tst_fn = filter_brightness__P4},
+		{.name = "Filter brightness  P8",
+		 .tst_fn = filter_brightness__P8},
+		{.name = "Filter brightness  G1",
+		 .tst_fn = filter_brightness__G1},
+		{.name = "Filter brightness  G2",
+		 .tst_fn = filter_brightness__G2},
+		{.name = "Filter brightness  G4",
+		 .tst_fn = filter_brightness__G4},
+		{.name = "Filter brightness  G8",
+		 .tst_fn = filter_brightness__G8},
+		{.name = "Filter brightness  GA88",
+		 .tst_fn = filter_brightness__GA88},
+		{.name = "Filter brightness  G16",
+		 .tst_fn = filter_brightness__G16},
+		{.name = "Filter brightness  RGBA8888_PM",
+		 .tst_fn = filter_brightness__RGBA8888_PM},
+		{.name = "Filter brightness_alloc  xRGB8888",
+		 .tst_fn = filter_brightness_alloc__xRGB8888},
+		{.name = "Filter brightness_alloc  RGBA8888",
+		 .tst_fn = filter_brightness_alloc__RGBA8888},
+		{.name = "Filter brightness_alloc  RGB888",
+		 .tst_fn = filter_brightness_alloc__RGB888},
+		{.name = "Filter brightness_alloc  BGR888",
+		 .tst_fn = filter_brightness_alloc__BGR888},
+		{.name = "Filter brightness_alloc  RGB555",
+		 .tst_fn = filter_brightness_alloc__RGB555},
+		{.name = "Filter brightness_alloc  RGB565",
+		 .tst_fn = filter_brightness_alloc__RGB565},
+		{.name = "Filter brightness_alloc  RGB666",
+		 .tst_fn = filter_brightness_alloc__RGB666},
+		{.name = "Filter brightness_alloc  RGB332",
+		 .tst_fn = filter_brightness_alloc__RGB332},
+		{.name = "Filter brightness_alloc  CMYK8888",
+		 .tst_fn = filter_brightness_alloc__CMYK8888},
+		{.name = "Filter brightness_alloc  P2",
+		 .tst_fn = filter_brightness_alloc__P2},
+		{.name = "Filter brightness_alloc  P4",
+		 .tst_fn = filter_brightness_alloc__P4},
+		{.name = "Filter brightness_alloc  P8",
+		 .tst_fn = filter_brightness_alloc__P8},
+		{.name = "Filter brightness_alloc  G1",
+		 .tst_fn = filter_brightness_alloc__G1},
+		{.name = "Filter brightness_alloc  G2",
+		 .tst_fn = filter_brightness_alloc__G2},
+		{.name = "Filter brightness_alloc  G4",
+		 .tst_fn = filter_brightness_alloc__G4},
+		{.name = "Filter brightness_alloc  G8",
+		 .tst_fn = filter_brightness_alloc__G8},
+		{.name = "Filter brightness_alloc  GA88",
+		 .tst_fn = filter_brightness_alloc__GA88},
+		{.name = "Filter brightness_alloc  G16",
+		 .tst_fn = filter_brightness_alloc__G16},
+		{.name = "Filter brightness_alloc  RGBA8888_PM",
+		 .tst_fn = filter_brightness_alloc__RGBA8888_PM},
+		{.name = "Filter contrast  xRGB8888",
+		 .tst_fn = filter_contrast__xRGB8888},
+		{.name = "Filter contrast  RGBA8888",
+		 .tst_fn = filter_contrast__RGBA8888},
+		{.name = "Filter contrast  RGB888",
+		 .tst_fn = filter_contrast__RGB888},
+		{.name = "Filter contrast  BGR888",
+		 .tst_fn = filter_contrast__BGR888},
+		{.name = "Filter contrast  RGB555",
+		 .tst_fn = filter_contrast__RGB555},
+		{.name = "Filter contrast  RGB565",
+		 .tst_fn = filter_contrast__RGB565},
+		{.name = "Filter contrast  RGB666",
+		 .tst_fn = filter_contrast__RGB666},
+		{.name = "Filter contrast  RGB332",
+		 .tst_fn = filter_contrast__RGB332},
+		{.name = "Filter contrast  CMYK8888",
+		 .tst_fn = filter_contrast__CMYK8888},
+		{.name = "Filter contrast  P2",
+		 .tst_fn = filter_contrast__P2},
+		{.name = "Filter contrast  P4",
+		 .tst_fn = filter_contrast__P4},
+		{.name = "Filter contrast  P8",
+		 .tst_fn = filter_contrast__P8},
+		{.name = "Filter contrast  G1",
+		 .tst_fn = filter_contrast__G1},
+		{.name = "Filter contrast  G2",
+		 .tst_fn = filter_contrast__G2},
+		{.name = "Filter contrast  G4",
+		 .tst_fn = filter_contrast__G4},
+		{.name = "Filter contrast  G8",
+		 .tst_fn = filter_contrast__G8},
+		{.name = "Filter contrast  GA88",
+		 .tst_fn = filter_contrast__GA88},
+		{.name = "Filter contrast  G16",
+		 .tst_fn = filter_contrast__G16},
+		{.name = "Filter contrast  RGBA8888_PM",
+		 .tst_fn = filter_contrast__RGBA8888_PM},
+		{.name = "Filter contrast_alloc  xRGB8888",
+		 .tst_fn = filter_contrast_alloc__xRGB8888},
+		{.name = "Filter contrast_alloc  RGBA8888",
+		 .tst_fn = filter_contrast_alloc__RGBA8888},
+		{.name = "Filter contrast_alloc  RGB888",
+		 .tst_fn = filter_contrast_alloc__RGB888},
+		{.name = "Filter contrast_alloc  BGR888",
+		 .tst_fn = filter_contrast_alloc__BGR888},
+		{.name = "Filter contrast_alloc  RGB555",
+		 .tst_fn = filter_contrast_alloc__RGB555},
+		{.name = "Filter contrast_alloc  RGB565",
+		 .tst_fn = filter_contrast_alloc__RGB565},
+		{.name = "Filter contrast_alloc  RGB666",
+		 .tst_fn = filter_contrast_alloc__RGB666},
+		{.name = "Filter contrast_alloc  RGB332",
+		 .tst_fn = filter_contrast_alloc__RGB332},
+		{.name = "Filter contrast_alloc  CMYK8888",
+		 .tst_fn = filter_contrast_alloc__CMYK8888},
+		{.name = "Filter contrast_alloc  P2",
+		 .tst_fn = filter_contrast_alloc__P2},
+		{.name = "Filter contrast_alloc  P4",
+		 .tst_fn = filter_contrast_alloc__P4},
+		{.name = "Filter contrast_alloc  P8",
+		 .tst_fn = filter_contrast_alloc__P8},
+		{.name = "Filter contrast_alloc  G1",
+		 .tst_fn = filter_contrast_alloc__G1},
+		{.name = "Filter contrast_alloc  G2",
+		 .tst_fn = filter_contrast_alloc__G2},
+		{.name = "Filter contrast_alloc  G4",
+		 .tst_fn = filter_contrast_alloc__G4},
+		{.name = "Filter contrast_alloc  G8",
+		 .tst_fn = filter_contrast_alloc__G8},
+		{.name = "Filter contrast_alloc  GA88",
+		 .tst_fn = filter_contrast_alloc__GA88},
+		{.name = "Filter contrast_alloc  G16",
+		 .tst_fn = filter_contrast_alloc__G16},
+		{.name = "Filter contrast_alloc  RGBA8888_PM",
+		 .tst_fn = filter_contrast_alloc__RGBA8888_PM},
+		{.name = "Filter invert  xRGB8888",
+		 .tst_fn = filter_invert__xRGB8888},
+		{.name = "Filter invert  RGBA8888",
+		 .tst_fn = filter_invert__RGBA8888},
+		{.name = "Filter invert  RGB888",
+		 .tst_fn = filter_invert__RGB888},
+		{.name = "Filter invert  BGR888",
+		 .tst_fn = filter_invert__BGR888},
+		{.name = "Filter invert  RGB555",
+		 .tst_fn = filter_invert__RGB555},
+		{.name = "Filter invert  RGB565",
+		 .tst_fn = filter_invert__RGB565},
+		{.name = "Filter invert  RGB666",
+		 .tst_fn = filter_invert__RGB666},
+		{.name = "Filter invert  RGB332",
+		 .tst_fn = filter_invert__RGB332},
+		{.name = "Filter invert  CMYK8888",
+		 .tst_fn = filter_invert__CMYK8888},
+		{.name = "Filter invert  P2",
+		 .tst_fn = filter_invert__P2},
+		{.name = "Filter invert  P4",
+		 .tst_fn = filter_invert__P4},
+		{.name = "Filter invert  P8",
+		 .tst_fn = filter_invert__P8},
+		{.name = "Filter invert  G1",
+		 .tst_fn = filter_invert__G1},
+		{.name = "Filter invert  G2",
+		 .tst_fn = filter_invert__G2},
+		{.name = "Filter invert  G4",
+		 .tst_fn = filter_invert__G4},
+		{.name = "Filter invert  G8",
+		 .tst_fn = filter_invert__G8},
+		{.name = "Filter invert  GA88",
+		 .tst_fn = filter_invert__GA88},
+		{.name = "Filter invert  G16",
+		 .tst_fn = filter_invert__G16},
+		{.name = "Filter invert  RGBA8888_PM",
+		 .tst_fn = filter_invert__RGBA8888_PM},
+		{.name = "Filter invert_alloc  xRGB8888",
+		 .tst_fn = filter_invert_alloc__xRGB8888},
+		{.name = "Filter invert_alloc  RGBA8888",
+		 .tst_fn = filter_invert_alloc__RGBA8888},
+		{.name = "Filter invert_alloc  RGB888",
+		 .tst_fn = filter_invert_alloc__RGB888},
+		{.name = "Filter invert_alloc  BGR888",
+		 .tst_fn = filter_invert_alloc__BGR888},
+		{.name = "Filter invert_alloc  RGB555",
+		 .tst_fn = filter_invert_alloc__RGB555},
+		{.name = "Filter invert_alloc  RGB565",
+		 .tst_fn = filter_invert_alloc__RGB565},
+		{.name = "Filter invert_alloc  RGB666",
+		 .tst_fn = filter_invert_alloc__RGB666},
+		{.name = "Filter invert_alloc  RGB332",
+		 .tst_fn = filter_invert_alloc__RGB332},
+		{.name = "Filter invert_alloc  CMYK8888",
+		 .tst_fn = filter_invert_alloc__CMYK8888},
+		{.name = "Filter invert_alloc  P2",
+		 .tst_fn = filter_invert_alloc__P2},
+		{.name = "Filter invert_alloc  P4",
+		 .tst_fn = filter_invert_alloc__P4},
+		{.name = "Filter invert_alloc  P8",
+		 .tst_fn = filter_invert_alloc__P8},
+		{.name = "Filter invert_alloc  G1",
+		 .tst_fn = filter_invert_alloc__G1},
+		{.name = "Filter invert_alloc  G2",
+		 .tst_fn = filter_invert_alloc__G2},
+		{.name = "Filter invert_alloc  G4",
+		 .tst_fn = filter_invert_alloc__G4},
+		{.name = "Filter invert_alloc  G8",
+		 .tst_fn = filter_invert_alloc__G8},
+		{.name = "Filter invert_alloc  GA88",
+		 .tst_fn = filter_invert_alloc__GA88},
+		{.name = "Filter invert_alloc  G16",
+		 .tst_fn = filter_invert_alloc__G16},
+		{.name = "Filter invert_alloc  RGBA8888_PM",
+		 .tst_fn = filter_invert_alloc__RGBA8888_PM},
+		{.name = "Filter mirror_h  xRGB8888",
+		 .tst_fn = filter_mirror_h__xRGB8888},
+		{.name = "Filter mirror_h  RGBA8888",
+		 .tst_fn = filter_mirror_h__RGBA8888},
+		{.name = "Filter mirror_h  RGB888",
+		 .tst_fn = filter_mirror_h__RGB888},
+		{.name = "Filter mirror_h  BGR888",
+		 .tst_fn = filter_mirror_h__BGR888},
+		{.name = "Filter mirror_h  RGB555",
+		 .tst_fn = filter_mirror_h__RGB555},
+		{.name = "Filter mirror_h  RGB565",
+		 .tst_fn = filter_mirror_h__RGB565},
+		{.name = "Filter mirror_h  RGB666",
+		 .tst_fn = filter_mirror_h__RGB666},
+		{.name = "Filter mirror_h  RGB332",
+		 .tst_fn = filter_mirror_h__RGB332},
+		{.name = "Filter mirror_h  CMYK8888",
+		 .tst_fn = filter_mirror_h__CMYK8888},
+		{.name = "Filter mirror_h  P2",
+		 .tst_fn = filter_mirror_h__P2},
+		{.name = "Filter mirror_h  P4",
+		 .tst_fn = filter_mirror_h__P4},
+		{.name = "Filter mirror_h  P8",
+		 .tst_fn = filter_mirror_h__P8},
+		{.name = "Filter mirror_h  G1",
+		 .tst_fn = filter_mirror_h__G1},
+		{.name = "Filter mirror_h  G2",
+		 .tst_fn = filter_mirror_h__G2},
+		{.name = "Filter mirror_h  G4",
+		 .tst_fn = filter_mirror_h__G4},
+		{.name = "Filter mirror_h  G8",
+		 .tst_fn = filter_mirror_h__G8},
+		{.name = "Filter mirror_h  GA88",
+		 .tst_fn = filter_mirror_h__GA88},
+		{.name = "Filter mirror_h  G16",
+		 .tst_fn = filter_mirror_h__G16},
+		{.name = "Filter mirror_h  RGBA8888_PM",
+		 .tst_fn = filter_mirror_h__RGBA8888_PM},
+		{.name = "Filter mirror_h_alloc  xRGB8888",
+		 .tst_fn = filter_mirror_h_alloc__xRGB8888},
+		{.name = "Filter mirror_h_alloc  RGBA8888",
+		 .tst_fn = filter_mirror_h_alloc__RGBA8888},
+		{.name = "Filter mirror_h_alloc  RGB888",
+		 .tst_fn = filter_mirror_h_alloc__RGB888},
+		{.name = "Filter mirror_h_alloc  BGR888",
+		 .tst_fn = filter_mirror_h_alloc__BGR888},
+		{.name = "Filter mirror_h_alloc  RGB555",
+		 .tst_fn = filter_mirror_h_alloc__RGB555},
+		{.name = "Filter mirror_h_alloc  RGB565",
+		 .tst_fn = filter_mirror_h_alloc__RGB565},
+		{.name = "Filter mirror_h_alloc  RGB666",
+		 .tst_fn = filter_mirror_h_alloc__RGB666},
+		{.name = "Filter mirror_h_alloc  RGB332",
+		 .tst_fn = filter_mirror_h_alloc__RGB332},
+		{.name = "Filter mirror_h_alloc  CMYK8888",
+		 .tst_fn = filter_mirror_h_alloc__CMYK8888},
+		{.name = "Filter mirror_h_alloc  P2",
+		 .tst_fn = filter_mirror_h_alloc__P2},
+		{.name = "Filter mirror_h_alloc  P4",
+		 .tst_fn = filter_mirror_h_alloc__P4},
+		{.name = "Filter mirror_h_alloc  P8",
+		 .tst_fn = filter_mirror_h_alloc__P8},
+		{.name = "Filter mirror_h_alloc  G1",
+		 .tst_fn = filter_mirror_h_alloc__G1},
+		{.name = "Filter mirror_h_alloc  G2",
+		 .tst_fn = filter_mirror_h_alloc__G2},
+		{.name = "Filter mirror_h_alloc  G4",
+		 .tst_fn = filter_mirror_h_alloc__G4},
+		{.name = "Filter mirror_h_alloc  G8",
+		 .tst_fn = filter_mirror_h_alloc__G8},
+		{.name = "Filter mirror_h_alloc  GA88",
+		 .tst_fn = filter_mirror_h_alloc__GA88},
+		{.name = "Filter mirror_h_alloc  G16",
+		 .tst_fn = filter_mirror_h_alloc__G16},
+		{.name = "Filter mirror_h_alloc  RGBA8888_PM",
+		 .tst_fn = filter_mirror_h_alloc__RGBA8888_PM},
+		{.name = "Filter mirror_v  xRGB8888",
+		 .tst_fn = filter_mirror_v__xRGB8888},
+		{.name = "Filter mirror_v  RGBA8888",
+		 .tst_fn = filter_mirror_v__RGBA8888},
+		{.name = "Filter mirror_v  RGB888",
+		 .tst_fn = filter_mirror_v__RGB888},
+		{.name = "Filter mirror_v  BGR888",
+		 .tst_fn = filter_mirror_v__BGR888},
+		{.name = "Filter mirror_v  RGB555",
+		 .tst_fn = filter_mirror_v__RGB555},
+		{.name = "Filter mirror_v  RGB565",
+		 .tst_fn = filter_mirror_v__RGB565},
+		{.name = "Filter mirror_v  RGB666",
+		 .tst_fn = filter_mirror_v__RGB666},
+		{.name = "Filter mirror_v  RGB332",
+		 .tst_fn = filter_mirror_v__RGB332},
+		{.name = "Filter mirror_v  CMYK8888",
+		 .tst_fn = filter_mirror_v__CMYK8888},
+		{.name = "Filter mirror_v  P2",
+		 .tst_fn = filter_mirror_v__P2},
+		{.name = "Filter mirror_v  P4",
+		 .tst_fn = filter_mirror_v__P4},
+		{.name = "Filter mirror_v  P8",
+		 .tst_fn = filter_mirror_v__P8},
+		{.name = "Filter mirror_v  G1",
+		 .tst_fn = filter_mirror_v__G1},
+		{.name = "Filter mirror_v  G2",
+		 .tst_fn = filter_mirror_v__G2},
+		{.name = "Filter mirror_v  G4",
+		 .tst_fn = filter_mirror_v__G4},
+		{.name = "Filter mirror_v  G8",
+		 .tst_fn = filter_mirror_v__G8},
+		{.name = "Filter mirror_v  GA88",
+		 .tst_fn = filter_mirror_v__GA88},
+		{.name = "Filter mirror_v  G16",
+		 .tst_fn = filter_mirror_v__G16},
+		{.name = "Filter mirror_v  RGBA8888_PM",
+		 .tst_fn = filter_mirror_v__RGBA8888_PM},
+		{.name = "Filter mirror_v_alloc  xRGB8888",
+		 .tst_fn = filter_mirror_v_alloc__xRGB8888},
+		{.name = "Filter mirror_v_alloc  RGBA8888",
+		 .tst_fn = filter_mirror_v_alloc__RGBA8888},
+		{.name = "Filter mirror_v_alloc  RGB888",
+		 .tst_fn = filter_mirror_v_alloc__RGB888},
+		{.name = "Filter mirror_v_alloc  BGR888",
+		 .tst_fn = filter_mirror_v_alloc__BGR888},
+		{.name = "Filter mirror_v_alloc  RGB555",
+		 .tst_fn = filter_mirror_v_alloc__RGB555},
+		{.name = "Filter mirror_v_alloc  RGB565",
+		 .tst_fn = filter_mirror_v_alloc__RGB565},
+		{.name = "Filter mirror_v_alloc  RGB666",
+		 .tst_fn = filter_mirror_v_alloc__RGB666},
+		{.name = "Filter mirror_v_alloc  RGB332",
+		 .tst_fn = filter_mirror_v_alloc__RGB332},
+		{.name = "Filter mirror_v_alloc  CMYK8888",
+		 .tst_fn = filter_mirror_v_alloc__CMYK8888},
+		{.name = "Filter mirror_v_alloc  P2",
+		 .tst_fn = filter_mirror_v_alloc__P2},
+		{.name = "Filter mirror_v_alloc  P4",
+		 .tst_fn = filter_mirror_v_alloc__P4},
+		{.name = "Filter mirror_v_alloc  P8",
+		 .tst_fn = filter_mirror_v_alloc__P8},
+		{.name = "Filter mirror_v_alloc  G1",
+		 .tst_fn = filter_mirror_v_alloc__G1},
+		{.name = "Filter mirror_v_alloc  G2",
+		 .tst_fn = filter_mirror_v_alloc__G2},
+		{.name = "Filter mirror_v_alloc  G4",
+		 .tst_fn = filter_mirror_v_alloc__G4},
+		{.name = "Filter mirror_v_alloc  G8",
+		 .tst_fn = filter_mirror_v_alloc__G8},
+		{.name = "Filter mirror_v_alloc  GA88",
+		 .tst_fn = filter_mirror_v_alloc__GA88},
+		{.name = "Filter mirror_v_alloc  G16",
+		 .tst_fn = filter_mirror_v_alloc__G16},
+		{.name = "Filter mirror_v_alloc  RGBA8888_PM",
+		 .tst_fn = filter_mirror_v_alloc__RGBA8888_PM},
+		{.name = "Filter rotate_90  xRGB8888",
+		 .tst_fn = filter_rotate_90__xRGB8888},
+		{.name = "Filter rotate_90  RGBA8888",
+		 .tst_fn = filter_rotate_90__RGBA8888},
+		{.name = "Filter rotate_90  RGB888",
+		 .tst_fn = filter_rotate_90__RGB888},
+		{.name = "Filter rotate_90  BGR888",
+		 .tst_fn = filter_rotate_90__BGR888},
+		{.name = "Filter rotate_90  RGB555",
+		 .tst_fn = filter_rotate_90__RGB555},
+		{.name = "Filter rotate_90  RGB565",
+		 .tst_fn = filter_rotate_90__RGB565},
+		{.name = "Filter rotate_90  RGB666",
+		 .tst_fn = filter_rotate_90__RGB666},
+		{.name = "Filter rotate_90  RGB332",
+		 .tst_fn = filter_rotate_90__RGB332},
+		{.name = "Filter rotate_90  CMYK8888",
+		 .tst_fn = filter_rotate_90__CMYK8888},
+		{.name = "Filter rotate_90  P2",
+		 .tst_fn = filter_rotate_90__P2},
+		{.name = "Filter rotate_90  P4",
+		 .tst_fn = filter_rotate_90__P4},
+		{.name = "Filter rotate_90  P8",
+		 .tst_fn = filter_rotate_90__P8},
+		{.name = "Filter rotate_90  G1",
+		 .tst_fn = filter_rotate_90__G1},
+		{.name = "Filter rotate_90  G2",
+		 .tst_fn = filter_rotate_90__G2},
+		{.name = "Filter rotate_90  G4",
+		 .tst_fn = filter_rotate_90__G4},
+		{.name = "Filter rotate_90  G8",
+		 .tst_fn = filter_rotate_90__G8},
+		{.name = "Filter rotate_90  GA88",
+		 .tst_fn = filter_rotate_90__GA88},
+		{.name = "Filter rotate_90  G16",
+		 .tst_fn = filter_rotate_90__G16},
+		{.name = "Filter rotate_90  RGBA8888_PM",
+		 .tst_fn = filter_rotate_90__RGBA8888_PM},
+		{.name = "Filter rotate_90_alloc  xRGB8888",
+		 .tst_fn = filter_rotate_90_alloc__xRGB8888},
+		{.name = "Filter rotate_90_alloc  RGBA8888",
+		 .tst_fn = filter_rotate_90_alloc__RGBA8888},
+		{.name = "Filter rotate_90_alloc  RGB888",
+		 .tst_fn = filter_rotate_90_alloc__RGB888},
+		{.name = "Filter rotate_90_alloc  BGR888",
+		 .tst_fn = filter_rotate_90_alloc__BGR888},
+		{.name = "Filter rotate_90_alloc  RGB555",
+		 .tst_fn = filter_rotate_90_alloc__RGB555},
+		{.name = "Filter rotate_90_alloc  RGB565",
+		 .tst_fn = filter_rotate_90_alloc__RGB565},
+		{.name = "Filter rotate_90_alloc  RGB666",
+		 .tst_fn = filter_rotate_90_alloc__RGB666},
+		{.name = "Filter rotate_90_alloc  RGB332",
+		 .tst_fn = filter_rotate_90_alloc__RGB332},
+		{.name = "Filter rotate_90_alloc  CMYK8888",
+		 .tst_fn = filter_rotate_90_alloc__CMYK8888},
+		{.name = "Filter rotate_90_alloc  P2",
+		 .tst_fn = filter_rotate_90_alloc__P2},
+		{.name = "Filter rotate_90_alloc  P4",
+		 .tst_fn = filter_rotate_90_alloc__P4},
+		{.name = "Filter rotate_90_alloc  P8",
+		 .tst_fn = filter_rotate_90_alloc__P8},
+		{.name = "Filter rotate_90_alloc  G1",
+		 .tst_fn = filter_rotate_90_alloc__G1},
+		{.name = "Filter rotate_90_alloc  G2",
+		 .tst_fn = filter_rotate_90_alloc__G2},
+		{.name = "Filter rotate_90_alloc  G4",
+		 .tst_fn = filter_rotate_90_alloc__G4},
+		{.name = "Filter rotate_90_alloc  G8",
+		 .tst_fn = filter_rotate_90_alloc__G8},
+		{.name = "Filter rotate_90_alloc  GA88",
+		 .tst_fn = filter_rotate_90_alloc__GA88},
+		{.name = "Filter rotate_90_alloc  G16",
+		 .tst_fn = filter_rotate_90_alloc__G16},
+		{.name = "Filter rotate_90_alloc  RGBA8888_PM",
+		 .tst_fn = filter_rotate_90_alloc__RGBA8888_PM},
+		{.name = "Filter rotate_180  xRGB8888",
+		 .tst_fn = filter_rotate_180__xRGB8888},
+		{.name = "Filter rotate_180  RGBA8888",
+		 .tst_fn = filter_rotate_180__RGBA8888},
+		{.name = "Filter rotate_180  RGB888",
+		 .tst_fn = filter_rotate_180__RGB888},
+		{.name = "Filter rotate_180  BGR888",
+		 .tst_fn = filter_rotate_180__BGR888},
+		{.name = "Filter rotate_180  RGB555",
+		 .tst_fn = filter_rotate_180__RGB555},
+		{.name = "Filter rotate_180  RGB565",
+		 .tst_fn = filter_rotate_180__RGB565},
+		{.name = "Filter rotate_180  RGB666",
+		 .tst_fn = filter_rotate_180__RGB666},
+		{.name = "Filter rotate_180  RGB332",
+		 .tst_fn = filter_rotate_180__RGB332},
+		{.name = "Filter rotate_180  CMYK8888",
+		 .tst_fn = filter_rotate_180__CMYK8888},
+		{.name = "Filter rotate_180  P2",
+		 .tst_fn = filter_rotate_180__P2},
+		{.name = "Filter rotate_180  P4",
+		 .tst_fn = filter_rotate_180__P4},
+		{.name = "Filter rotate_180  P8",
+		 .tst_fn = filter_rotate_180__P8},
+		{.name = "Filter rotate_180  G1",
+		 .tst_fn = filter_rotate_180__G1},
+		{.name = "Filter rotate_180  G2",
+		 .tst_fn = filter_rotate_180__G2},
+		{.name = "Filter rotate_180  G4",
+		 .tst_fn = filter_rotate_180__G4},
+		{.name = "Filter rotate_180  G8",
+		 .tst_fn = filter_rotate_180__G8},
+		{.name = "Filter rotate_180  GA88",
+		 .tst_fn = filter_rotate_180__GA88},
+		{.name = "Filter rotate_180  G16",
+		 .tst_fn = filter_rotate_180__G16},
+		{.name = "Filter rotate_180  RGBA8888_PM",
+		 .tst_fn = filter_rotate_180__RGBA8888_PM},
+		{.name = "Filter rotate_180_alloc  xRGB8888",
+		 .tst_fn = filter_rotate_180_alloc__xRGB8888},
+		{.name = "Filter rotate_180_alloc  RGBA8888",
+		 .tst_fn = filter_rotate_180_alloc__RGBA8888},
+		{.name = "Filter rotate_180_alloc  RGB888",
+		 .tst_fn = filter_rotate_180_alloc__RGB888},
+		{.name = "Filter rotate_180_alloc  BGR888",
+		 .tst_fn = filter_rotate_180_alloc__BGR888},
+		{.name = "Filter rotate_180_alloc  RGB555",
+		 .tst_fn = filter_rotate_180_alloc__RGB555},
+		{.name = "Filter rotate_180_alloc  RGB565",
+		 .tst_fn = filter_rotate_180_alloc__RGB565},
+		{.name = "Filter rotate_180_alloc  RGB666",
+		 .tst_fn = filter_rotate_180_alloc__RGB666},
+		{.name = "Filter rotate_180_alloc  RGB332",
+		 .tst_fn = filter_rotate_180_alloc__RGB332},
+		{.name = "Filter rotate_180_alloc  CMYK8888",
+		 .tst_fn = filter_rotate_180_alloc__CMYK8888},
+		{.name = "Filter rotate_180_alloc  P2",
+		 .tst_fn = filter_rotate_180_alloc__P2},
+		{.name = "Filter rotate_180_alloc  P4",
+		 .tst_fn = filter_rotate_180_alloc__P4},
+		{.name = "Filter rotate_180_alloc  P8",
+		 .tst_fn = filter_rotate_180_alloc__P8},
+		{.name = "Filter rotate_180_alloc  G1",
+		 .tst_fn = filter_rotate_180_alloc__G1},
+		{.name = "Filter rotate_180_alloc  G2",
+		 .tst_fn = filter_rotate_180_alloc__G2},
+		{.name = "Filter rotate_180_alloc  G4",
+		 .tst_fn = filter_rotate_180_alloc__G4},
+		{.name = "Filter rotate_180_alloc  G8",
+		 .tst_fn = filter_rotate_180_alloc__G8},
+		{.name = "Filter rotate_180_alloc  GA88",
+		 .tst_fn = filter_rotate_180_alloc__GA88},
+		{.name = "Filter rotate_180_alloc  G16",
+		 .tst_fn = filter_rotate_180_alloc__G16},
+		{.name = "Filter rotate_180_alloc  RGBA8888_PM",
+		 .tst_fn = filter_rotate_180_alloc__RGBA8888_PM},
+		{.name = "Filter rotate_270  xRGB8888",
+		 .tst_fn = filter_rotate_270__xRGB8888},
+		{.name = "Filter rotate_270  RGBA8888",
+		 .tst_fn = filter_rotate_270__RGBA8888},
+		{.name = "Filter rotate_270  RGB888",
+		 .tst_fn = filter_rotate_270__RGB888},
+		{.name = "Filter rotate_270  BGR888",
+		 .tst_fn = filter_rotate_270__BGR888},
+		{.name = "Filter rotate_270  RGB555",
+		 .tst_fn = filter_rotate_270__RGB555},
+		{.name = "Filter rotate_270  RGB565",
+		 .tst_fn = filter_rotate_270__RGB565},
+		{.name = "Filter rotate_270  RGB666",
+		 .tst_fn = filter_rotate_270__RGB666},
+		{.name = "Filter rotate_270  RGB332",
+		 .tst_fn = filter_rotate_270__RGB332},
+		{.name = "Filter rotate_270  CMYK8888",
+		 .tst_fn = filter_rotate_270__CMYK8888},
+		{.name = "Filter rotate_270  P2",
+		 .tst_fn = filter_rotate_270__P2},
+		{.name = "Filter rotate_270  P4",
+		 .tst_fn = filter_rotate_270__P4},
+		{.name = "Filter rotate_270  P8",
+		 .tst_fn = filter_rotate_270__P8},
+		{.name = "Filter rotate_270  G1",
+		 .tst_fn = filter_rotate_270__G1},
+		{.name = "Filter rotate_270  G2",
+		 .tst_fn = filter_rotate_270__G2},
+		{.name = "Filter rotate_270  G4",
+		 .tst_fn = filter_rotate_270__G4},
+		{.name = "Filter rotate_270  G8",
+		 .tst_fn = filter_rotate_270__G8},
+		{.name = "Filter rotate_270  GA88",
+		 .tst_fn = filter_rotate_270__GA88},
+		{.name = "Filter rotate_270  G16",
+		 .tst_fn = filter_rotate_270__G16},
+		{.name = "Filter rotate_270  RGBA8888_PM",
+		 .tst_fn = filter_rotate_270__RGBA8888_PM},
+		{.name = "Filter rotate_270_alloc  xRGB8888",
+		 .tst_fn = filter_rotate_270_alloc__xRGB8888},
+		{.name = "Filter rotate_270_alloc  RGBA8888",
+		 .tst_fn = filter_rotate_270_alloc__RGBA8888},
+		{.name = "Filter rotate_270_alloc  RGB888",
+		 .tst_fn = filter_rotate_270_alloc__RGB888},
+		{.name = "Filter rotate_270_alloc  BGR888",
+		 .tst_fn = filter_rotate_270_alloc__BGR888},
+		{.name = "Filter rotate_270_alloc  RGB555",
+		 .tst_fn = filter_rotate_270_alloc__RGB555},
+		{.name = "Filter rotate_270_alloc  RGB565",
+		 .tst_fn = filter_rotate_270_alloc__RGB565},
+		{.name = "Filter rotate_270_alloc  RGB666",
+		 .tst_fn = filter_rotate_270_alloc__RGB666},
+		{.name = "Filter rotate_270_alloc  RGB332",
+		 .tst_fn = filter_rotate_270_alloc__RGB332},
+		{.name = "Filter rotate_270_alloc  CMYK8888",
+		 .tst_fn = filter_rotate_270_alloc__CMYK8888},
+		{.name = "Filter rotate_270_alloc  P2",
+		 .tst_fn = filter_rotate_270_alloc__P2},
+		{.name = "Filter rotate_270_alloc  P4",
+		 .tst_fn = filter_rotate_270_alloc__P4},
+		{.name = "Filter rotate_270_alloc  P8",
+		 .tst_fn = filter_rotate_270_alloc__P8},
+		{.name = "Filter rotate_270_alloc  G1",
+		 .tst_fn = filter_rotate_270_alloc__G1},
+		{.name = "Filter rotate_270_alloc  G2",
+		 .tst_fn = filter_rotate_270_alloc__G2},
+		{.name = "Filter rotate_270_alloc  G4",
+		 .tst_fn = filter_rotate_270_alloc__G4},
+		{.name = "Filter rotate_270_alloc  G8",
+		 .tst_fn = filter_rotate_270_alloc__G8},
+		{.name = "Filter rotate_270_alloc  GA88",
+		 .tst_fn = filter_rotate_270_alloc__GA88},
+		{.name = "Filter rotate_270_alloc  G16",
+		 .tst_fn = filter_rotate_270_alloc__G16},
+		{.name = "Filter rotate_270_alloc  RGBA8888_PM",
+		 .tst_fn = filter_rotate_270_alloc__RGBA8888_PM},
+		{.name = "Filter symmetry H xRGB8888",
+		 .tst_fn = filter_symmetry_H_xRGB8888},
+		{.name = "Filter symmetry H RGBA8888",
+		 .tst_fn = filter_symmetry_H_RGBA8888},
+		{.name = "Filter symmetry H RGB888",
+		 .tst_fn = filter_symmetry_H_RGB888},
+		{.name = "Filter symmetry H BGR888",
+		 .tst_fn = filter_symmetry_H_BGR888},
+		{.name = "Filter symmetry H RGB555",
+		 .tst_fn = filter_symmetry_H_RGB555},
+		{.name = "Filter symmetry H RGB565",
+		 .tst_fn = filter_symmetry_H_RGB565},
+		{.name = "Filter symmetry H RGB666",
+		 .tst_fn = filter_symmetry_H_RGB666},
+		{.name = "Filter symmetry H RGB332",
+		 .tst_fn = filter_symmetry_H_RGB332},
+		{.name = "Filter symmetry H CMYK8888",
+		 .tst_fn = filter_symmetry_H_CMYK8888},
+		{.name = "Filter symmetry H P2",
+		 .tst_fn = filter_symmetry_H_P2},
+		{.name = "Filter symmetry H P4",
+		 .tst_fn = filter_symmetry_H_P4},
+		{.name = "Filter symmetry H P8",
+		 .tst_fn = filter_symmetry_H_P8},
+		{.name = "Filter symmetry H G1",
+		 .tst_fn = filter_symmetry_H_G1},
+		{.name = "Filter symmetry H G2",
+		 .tst_fn = filter_symmetry_H_G2},
+		{.name = "Filter symmetry H G4",
+		 .tst_fn = filter_symmetry_H_G4},
+		{.name = "Filter symmetry H G8",
+		 .tst_fn = filter_symmetry_H_G8},
+		{.name = "Filter symmetry H GA88",
+		 .tst_fn = filter_symmetry_H_GA88},
+		{.name = "Filter symmetry H G16",
+		 .tst_fn = filter_symmetry_H_G16},
+		{.name = "Filter symmetry H RGBA8888_PM",
+		 .tst_fn = filter_symmetry_H_RGBA8888_PM},
+		{.name = "Filter symmetry_alloc H xRGB8888",
+		 .tst_fn = filter_symmetry_alloc_H_xRGB8888},
+		{.name = "Filter symmetry_alloc H RGBA8888",
+		 .tst_fn = filter_symmetry_alloc_H_RGBA8888},
+		{.name = "Filter symmetry_alloc H RGB888",
+		 .tst_fn = filter_symmetry_alloc_H_RGB888},
+		{.name = "Filter symmetry_alloc H BGR888",
+		 .tst_fn = filter_symmetry_alloc_H_BGR888},
+		{.name = "Filter symmetry_alloc H RGB555",
+		 .tst_fn = filter_symmetry_alloc_H_RGB555},
+		{.name = "Filter symmetry_alloc H RGB565",
+		 .tst_fn = filter_symmetry_alloc_H_RGB565},
+		{.name = "Filter symmetry_alloc H RGB666",
+		 .tst_fn = filter_symmetry_alloc_H_RGB666},
+		{.name = "Filter symmetry_alloc H RGB332",
+		 .tst_fn = filter_symmetry_alloc_H_RGB332},
+		{.name = "Filter symmetry_alloc H CMYK8888",
+		 .tst_fn = filter_symmetry_alloc_H_CMYK8888},
+		{.name = "Filter symmetry_alloc H P2",
+		 .tst_fn = filter_symmetry_alloc_H_P2},
+		{.name = "Filter symmetry_alloc H P4",
+		 .tst_fn = filter_symmetry_alloc_H_P4},
+		{.name = "Filter symmetry_alloc H P8",
+		 .tst_fn = filter_symmetry_alloc_H_P8},
+		{.name = "Filter symmetry_alloc H G1",
+		 .tst_fn = filter_symmetry_alloc_H_G1},
+		{.name = "Filter symmetry_alloc H G2",
+		 .tst_fn = filter_symmetry_alloc_H_G2},
+		{.name = "Filter symmetry_alloc H G4",
+		 .tst_fn = filter_symmetry_alloc_H_G4},
+		{.name = "Filter symmetry_alloc H G8",
+		 .tst_fn = filter_symmetry_alloc_H_G8},
+		{.name = "Filter symmetry_alloc H GA88",
+		 .tst_fn = filter_symmetry_alloc_H_GA88},
+		{.name = "Filter symmetry_alloc H G16",
+		 .tst_fn = filter_symmetry_alloc_H_G16},
+		{.name = "Filter symmetry_alloc H RGBA8888_PM",
+		 .tst_fn = filter_symmetry_alloc_H_RGBA8888_PM},
+		{.name = "Filter symmetry V xRGB8888",
+		 .tst_fn = filter_symmetry_V_xRGB8888},
+		{.name = "Filter symmetry V RGBA8888",
+		 .tst_fn = filter_symmetry_V_RGBA8888},
+		{.name = "Filter symmetry V RGB888",
+		 .tst_fn = filter_symmetry_V_RGB888},
+		{.name = "Filter symmetry V BGR888",
+		 .tst_fn = filter_symmetry_V_BGR888},
+		{.name = "Filter symmetry V RGB555",
+		 .tst_fn = filter_symmetry_V_RGB555},
+		{.name = "Filter symmetry V RGB565",
+		 .tst_fn = filter_symmetry_V_RGB565},
+		{.name = "Filter symmetry V RGB666",
+		 .tst_fn = filter_symmetry_V_RGB666},
+		{.name = "Filter symmetry V RGB332",
+		 .tst_fn = filter_symmetry_V_RGB332},
+		{.name = "Filter symmetry V CMYK8888",
+		 .tst_fn = filter_symmetry_V_CMYK8888},
+		{.name = "Filter symmetry V P2",
+		 .tst_fn = filter_symmetry_V_P2},
+		{.name = "Filter symmetry V P4",
+		 .tst_fn = filter_symmetry_V_P4},
+		{.name = "Filter symmetry V P8",
+		 .tst_fn = filter_symmetry_V_P8},
+		{.name = "Filter symmetry V G1",
+		 .tst_fn = filter_symmetry_V_G1},
+		{.name = "Filter symmetry V G2",
+		 .tst_fn = filter_symmetry_V_G2},
+		{.name = "Filter symmetry V G4",
+		 .tst_fn = filter_symmetry_V_G4},
+		{.name = "Filter symmetry V G8",
+		 .tst_fn = filter_symmetry_V_G8},
+		{.name = "Filter symmetry V GA88",
+		 .tst_fn = filter_symmetry_V_GA88},
+		{.name = "Filter symmetry V G16",
+		 .tst_fn = filter_symmetry_V_G16},
+		{.name = "Filter symmetry V RGBA8888_PM",
+		 .tst_fn = filter_symmetry_V_RGBA8888_PM},
+		{.name = "Filter symmetry_alloc V xRGB8888",
+		 .tst_fn = filter_symmetry_alloc_V_xRGB8888},
+		{.name = "Filter symmetry_alloc V RGBA8888",
+		 .tst_fn = filter_symmetry_alloc_V_RGBA8888},
+		{.name = "Filter symmetry_alloc V RGB888",
+		 .tst_fn = filter_symmetry_alloc_V_RGB888},
+		{.name = "Filter symmetry_alloc V BGR888",
+		 .tst_fn = filter_symmetry_alloc_V_BGR888},
+		{.name = "Filter symmetry_alloc V RGB555",
+		 .tst_fn = filter_symmetry_alloc_V_RGB555},
+		{.name = "Filter symmetry_alloc V RGB565",
+		 .tst_fn = filter_symmetry_alloc_V_RGB565},
+		{.name = "Filter symmetry_alloc V RGB666",
+		 .tst_fn = filter_symmetry_alloc_V_RGB666},
+		{.name = "Filter symmetry_alloc V RGB332",
+		 .tst_fn = filter_symmetry_alloc_V_RGB332},
+		{.name = "Filter symmetry_alloc V CMYK8888",
+		 .tst_fn = filter_symmetry_alloc_V_CMYK8888},
+		{.name = "Filter symmetry_alloc V P2",
+		 .tst_fn = filter_symmetry_alloc_V_P2},
+		{.name = "Filter symmetry_alloc V P4",
+		 .tst_fn = filter_symmetry_alloc_V_P4},
+		{.name = "Filter symmetry_alloc V P8",
+		 .tst_fn = filter_symmetry_alloc_V_P8},
+		{.name = "Filter symmetry_alloc V G1",
+		 .tst_fn = filter_symmetry_alloc_V_G1},
+		{.name = "Filter symmetry_alloc V G2",
+		 .tst_fn = filter_symmetry_alloc_V_G2},
+		{.name = "Filter symmetry_alloc V G4",
+		 .tst_fn = filter_symmetry_alloc_V_G4},
+		{.name = "Filter symmetry_alloc V G8",
+		 .tst_fn = filter_symmetry_alloc_V_G8},
+		{.name = "Filter symmetry_alloc V GA88",
+		 .tst_fn = filter_symmetry_alloc_V_GA88},
+		{.name = "Filter symmetry_alloc V G16",
+		 .tst_fn = filter_symmetry_alloc_V_G16},
+		{.name = "Filter symmetry_alloc V RGBA8888_PM",
+		 .tst_fn = filter_symmetry_alloc_V_RGBA8888_PM},
+		{.name = "Filter symmetry 90 xRGB8888",
+		 .tst_fn = filter_symmetry_90_xRGB8888},
+		{.name = "Filter symmetry 90 RGBA8888",
+		 .tst_fn = filter_symmetry_90_RGBA8888},
+		{.name = "Filter symmetry 90 RGB888",
+		 .tst_fn = filter_symmetry_90_RGB888},
+		{.name = "Filter symmetry 90 BGR888",
+		 .tst_fn = filter_symmetry_90_BGR888},
+		{.name = "Filter symmetry 90 RGB555",
+		 .tst_fn = filter_symmetry_90_RGB555},
+		{.name = "Filter symmetry 90 RGB565",
+		 .tst_fn = filter_symmetry_90_RGB565},
+		{.name = "Filter symmetry 90 RGB666",
+		 .tst_fn = filter_symmetry_90_RGB666},
+		{.name = "Filter symmetry 90 RGB332",
+		 .tst_fn = filter_symmetry_90_RGB332},
+		{.name = "Filter symmetry 90 CMYK8888",
+		 .tst_fn = filter_symmetry_90_CMYK8888},
+		{.name = "Filter symmetry 90 P2",
+		 .tst_fn = filter_symmetry_90_P2},
+		{.name = "Filter symmetry 90 P4",
+		 .tst_fn = filter_symmetry_90_P4},
+		{.name = "Filter symmetry 90 P8",
+		 .tst_fn = filter_symmetry_90_P8},
+		{.name = "Filter symmetry 90 G1",
+		 .tst_fn = filter_symmetry_90_G1},
+		{.name = "Filter symmetry 90 G2",
+		 .tst_fn = filter_symmetry_90_G2},
+		{.name = "Filter symmetry 90 G4",
+		 .tst_fn = filter_symmetry_90_G4},
+		{.name = "Filter symmetry 90 G8",
+		 .tst_fn = filter_symmetry_90_G8},
+		{.name = "Filter symmetry 90 GA88",
+		 .tst_fn = filter_symmetry_90_GA88},
+		{.name = "Filter symmetry 90 G16",
+		 .tst_fn = filter_symmetry_90_G16},
+		{.name = "Filter symmetry 90 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_90_RGBA8888_PM},
+		{.name = "Filter symmetry_alloc 90 xRGB8888",
+		 .tst_fn = filter_symmetry_alloc_90_xRGB8888},
+		{.name = "Filter symmetry_alloc 90 RGBA8888",
+		 .tst_fn = filter_symmetry_alloc_90_RGBA8888},
+		{.name = "Filter symmetry_alloc 90 RGB888",
+		 .tst_fn = filter_symmetry_alloc_90_RGB888},
+		{.name = "Filter symmetry_alloc 90 BGR888",
+		 .tst_fn = filter_symmetry_alloc_90_BGR888},
+		{.name = "Filter symmetry_alloc 90 RGB555",
+		 .tst_fn = filter_symmetry_alloc_90_RGB555},
+		{.name = "Filter symmetry_alloc 90 RGB565",
+		 .tst_fn = filter_symmetry_alloc_90_RGB565},
+		{.name = "Filter symmetry_alloc 90 RGB666",
+		 .tst_fn = filter_symmetry_alloc_90_RGB666},
+		{.name = "Filter symmetry_alloc 90 RGB332",
+		 .tst_fn = filter_symmetry_alloc_90_RGB332},
+		{.name = "Filter symmetry_alloc 90 CMYK8888",
+		 .tst_fn = filter_symmetry_alloc_90_CMYK8888},
+		{.name = "Filter symmetry_alloc 90 P2",
+		 .tst_fn = filter_symmetry_alloc_90_P2},
+		{.name = "Filter symmetry_alloc 90 P4",
+		 .tst_fn = filter_symmetry_alloc_90_P4},
+		{.name = "Filter symmetry_alloc 90 P8",
+		 .tst_fn = filter_symmetry_alloc_90_P8},
+		{.name = "Filter symmetry_alloc 90 G1",
+		 .tst_fn = filter_symmetry_alloc_90_G1},
+		{.name = "Filter symmetry_alloc 90 G2",
+		 .tst_fn = filter_symmetry_alloc_90_G2},
+		{.name = "Filter symmetry_alloc 90 G4",
+		 .tst_fn = filter_symmetry_alloc_90_G4},
+		{.name = "Filter symmetry_alloc 90 G8",
+		 .tst_fn = filter_symmetry_alloc_90_G8},
+		{.name = "Filter symmetry_alloc 90 GA88",
+		 .tst_fn = filter_symmetry_alloc_90_GA88},
+		{.name = "Filter symmetry_alloc 90 G16",
+		 .tst_fn = filter_symmetry_alloc_90_G16},
+		{.name = "Filter symmetry_alloc 90 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_alloc_90_RGBA8888_PM},
+		{.name = "Filter symmetry 180 xRGB8888",
+		 .tst_fn = filter_symmetry_180_xRGB8888},
+		{.name = "Filter symmetry 180 RGBA8888",
+		 .tst_fn = filter_symmetry_180_RGBA8888},
+		{.name = "Filter symmetry 180 RGB888",
+		 .tst_fn = filter_symmetry_180_RGB888},
+		{.name = "Filter symmetry 180 BGR888",
+		 .tst_fn = filter_symmetry_180_BGR888},
+		{.name = "Filter symmetry 180 RGB555",
+		 .tst_fn = filter_symmetry_180_RGB555},
+		{.name = "Filter symmetry 180 RGB565",
+		 .tst_fn = filter_symmetry_180_RGB565},
+		{.name = "Filter symmetry 180 RGB666",
+		 .tst_fn = filter_symmetry_180_RGB666},
+		{.name = "Filter symmetry 180 RGB332",
+		 .tst_fn = filter_symmetry_180_RGB332},
+		{.name = "Filter symmetry 180 CMYK8888",
+		 .tst_fn = filter_symmetry_180_CMYK8888},
+		{.name = "Filter symmetry 180 P2",
+		 .tst_fn = filter_symmetry_180_P2},
+		{.name = "Filter symmetry 180 P4",
+		 .tst_fn = filter_symmetry_180_P4},
+		{.name = "Filter symmetry 180 P8",
+		 .tst_fn = filter_symmetry_180_P8},
+		{.name = "Filter symmetry 180 G1",
+		 .tst_fn = filter_symmetry_180_G1},
+		{.name = "Filter symmetry 180 G2",
+		 .tst_fn = filter_symmetry_180_G2},
+		{.name = "Filter symmetry 180 G4",
+		 .tst_fn = filter_symmetry_180_G4},
+		{.name = "Filter symmetry 180 G8",
+		 .tst_fn = filter_symmetry_180_G8},
+		{.name = "Filter symmetry 180 GA88",
+		 .tst_fn = filter_symmetry_180_GA88},
+		{.name = "Filter symmetry 180 G16",
+		 .tst_fn = filter_symmetry_180_G16},
+		{.name = "Filter symmetry 180 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_180_RGBA8888_PM},
+		{.name = "Filter symmetry_alloc 180 xRGB8888",
+		 .tst_fn = filter_symmetry_alloc_180_xRGB8888},
+		{.name = "Filter symmetry_alloc 180 RGBA8888",
+		 .tst_fn = filter_symmetry_alloc_180_RGBA8888},
+		{.name = "Filter symmetry_alloc 180 RGB888",
+		 .tst_fn = filter_symmetry_alloc_180_RGB888},
+		{.name = "Filter symmetry_alloc 180 BGR888",
+		 .tst_fn = filter_symmetry_alloc_180_BGR888},
+		{.name = "Filter symmetry_alloc 180 RGB555",
+		 .tst_fn = filter_symmetry_alloc_180_RGB555},
+		{.name = "Filter symmetry_alloc 180 RGB565",
+		 .tst_fn = filter_symmetry_alloc_180_RGB565},
+		{.name = "Filter symmetry_alloc 180 RGB666",
+		 .tst_fn = filter_symmetry_alloc_180_RGB666},
+		{.name = "Filter symmetry_alloc 180 RGB332",
+		 .tst_fn = filter_symmetry_alloc_180_RGB332},
+		{.name = "Filter symmetry_alloc 180 CMYK8888",
+		 .tst_fn = filter_symmetry_alloc_180_CMYK8888},
+		{.name = "Filter symmetry_alloc 180 P2",
+		 .tst_fn = filter_symmetry_alloc_180_P2},
+		{.name = "Filter symmetry_alloc 180 P4",
+		 .tst_fn = filter_symmetry_alloc_180_P4},
+		{.name = "Filter symmetry_alloc 180 P8",
+		 .tst_fn = filter_symmetry_alloc_180_P8},
+		{.name = "Filter symmetry_alloc 180 G1",
+		 .tst_fn = filter_symmetry_alloc_180_G1},
+		{.name = "Filter symmetry_alloc 180 G2",
+		 .tst_fn = filter_symmetry_alloc_180_G2},
+		{.name = "Filter symmetry_alloc 180 G4",
+		 .tst_fn = filter_symmetry_alloc_180_G4},
+		{.name = "Filter symmetry_alloc 180 G8",
+		 .tst_fn = filter_symmetry_alloc_180_G8},
+		{.name = "Filter symmetry_alloc 180 GA88",
+		 .tst_fn = filter_symmetry_alloc_180_GA88},
+		{.name = "Filter symmetry_alloc 180 G16",
+		 .tst_fn = filter_symmetry_alloc_180_G16},
+		{.name = "Filter symmetry_alloc 180 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_alloc_180_RGBA8888_PM},
+		{.name = "Filter symmetry 270 xRGB8888",
+		 .tst_fn = filter_symmetry_270_xRGB8888},
+		{.name = "Filter symmetry 270 RGBA8888",
+		 .tst_fn = filter_symmetry_270_RGBA8888},
+		{.name = "Filter symmetry 270 RGB888",
+		 .tst_fn = filter_symmetry_270_RGB888},
+		{.name = "Filter symmetry 270 BGR888",
+		 .tst_fn = filter_symmetry_270_BGR888},
+		{.name = "Filter symmetry 270 RGB555",
+		 .tst_fn = filter_symmetry_270_RGB555},
+		{.name = "Filter symmetry 270 RGB565",
+		 .tst_fn = filter_symmetry_270_RGB565},
+		{.name = "Filter symmetry 270 RGB666",
+		 .tst_fn = filter_symmetry_270_RGB666},
+		{.name = "Filter symmetry 270 RGB332",
+		 .tst_fn = filter_symmetry_270_RGB332},
+		{.name = "Filter symmetry 270 CMYK8888",
+		 .tst_fn = filter_symmetry_270_CMYK8888},
+		{.name = "Filter symmetry 270 P2",
+		 .tst_fn = filter_symmetry_270_P2},
+		{.name = "Filter symmetry 270 P4",
+		 .tst_fn = filter_symmetry_270_P4},
+		{.name = "Filter symmetry 270 P8",
+		 .tst_fn = filter_symmetry_270_P8},
+		{.name = "Filter symmetry 270 G1",
+		 .tst_fn = filter_symmetry_270_G1},
+		{.name = "Filter symmetry 270 G2",
+		 .tst_fn = filter_symmetry_270_G2},
+		{.name = "Filter symmetry 270 G4",
+		 .tst_fn = filter_symmetry_270_G4},
+		{.name = "Filter symmetry 270 G8",
+		 .tst_fn = filter_symmetry_270_G8},
+		{.name = "Filter symmetry 270 GA88",
+		 .tst_fn = filter_symmetry_270_GA88},
+		{.name = "Filter symmetry 270 G16",
+		 .tst_fn = filter_symmetry_270_G16},
+		{.name = "Filter symmetry 270 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_270_RGBA8888_PM},
+		{.name = "Filter symmetry_alloc 270 xRGB8888",
+		 .tst_fn = filter_symmetry_alloc_270_xRGB8888},
+		{.name = "Filter symmetry_alloc 270 RGBA8888",
+		 .tst_fn = filter_symmetry_alloc_270_RGBA8888},
+		{.name = "Filter symmetry_alloc 270 RGB888",
+		 .tst_fn = filter_symmetry_alloc_270_RGB888},
+		{.name = "Filter symmetry_alloc 270 BGR888",
+		 .tst_fn = filter_symmetry_alloc_270_BGR888},
+		{.name = "Filter symmetry_alloc 270 RGB555",
+		 .tst_fn = filter_symmetry_alloc_270_RGB555},
+		{.name = "Filter symmetry_alloc 270 RGB565",
+		 .tst_fn = filter_symmetry_alloc_270_RGB565},
+		{.name = "Filter symmetry_alloc 270 RGB666",
+		 .tst_fn = filter_symmetry_alloc_270_RGB666},
+		{.name = "Filter symmetry_alloc 270 RGB332",
+		 .tst_fn = filter_symmetry_alloc_270_RGB332},
+		{.name = "Filter symmetry_alloc 270 CMYK8888",
+		 .tst_fn = filter_symmetry_alloc_270_CMYK8888},
+		{.name = "Filter symmetry_alloc 270 P2",
+		 .tst_fn = filter_symmetry_alloc_270_P2},
+		{.name = "Filter symmetry_alloc 270 P4",
+		 .tst_fn = filter_symmetry_alloc_270_P4},
+		{.name = "Filter symmetry_alloc 270 P8",
+		 .tst_fn = filter_symmetry_alloc_270_P8},
+		{.name = "Filter symmetry_alloc 270 G1",
+		 .tst_fn = filter_symmetry_alloc_270_G1},
+		{.name = "Filter symmetry_alloc 270 G2",
+		 .tst_fn = filter_symmetry_alloc_270_G2},
+		{.name = "Filter symmetry_alloc 270 G4",
+		 .tst_fn = filter_symmetry_alloc_270_G4},
+		{.name = "Filter symmetry_alloc 270 G8",
+		 .tst_fn = filter_symmetry_alloc_270_G8},
+		{.name = "Filter symmetry_alloc 270 GA88",
+		 .tst_fn = filter_symmetry_alloc_270_GA88},
+		{.name = "Filter symmetry_alloc 270 G16",
+		 .tst_fn = filter_symmetry_alloc_270_G16},
+		{.name = "Filter symmetry_alloc 270 RGBA8888_PM",
+		 .tst_fn = filter_symmetry_alloc_270_RGBA8888_PM},
+		{.name = "Filter convolution  xRGB8888",
+		 .tst_fn = filter_convolution__xRGB8888},
+		{.name = "Filter convolution  RGBA8888",
+		 .tst_fn = filter_convolution__RGBA8888},
+		{.name = "Filter convolution  RGB888",
+		 .tst_fn = filter_convolution__RGB888},
+		{.name = "Filter convolution  BGR888",
+		 .tst_fn = filter_convolution__BGR888},
+		{.name = "Filter convolution  RGB555",
+		 .tst_fn = filter_convolution__RGB555},
+		{.name = "Filter convolution  RGB565",
+		 .tst_fn = filter_convolution__RGB565},
+		{.name = "Filter convolution  RGB666",
+		 .tst_fn = filter_convolution__RGB666},
+		{.name = "Filter convolution  RGB332",
+		 .tst_fn = filter_convolution__RGB332},
+		{.name = "Filter convolution  CMYK8888",
+		 .tst_fn = filter_convolution__CMYK8888},
+		{.name = "Filter convolution  P2",
+		 .tst_fn = filter_convolution__P2},
+		{.name = "Filter convolution  P4",
+		 .tst_fn = filter_convolution__P4},
+		{.name = "Filter convolution  P8",
+		 .tst_fn = filter_convolution__P8},
+		{.name = "Filter convolution  G1",
+		 .tst_fn = filter_convolution__G1},
+		{.name = "Filter convolution  G2",
+		 .tst_fn = filter_convolution__G2},
+		{.name = "Filter convolution  G4",
+		 .tst_fn = filter_convolution__G4},
+		{.name = "Filter convolution  G8",
+		 .tst_fn = filter_convolution__G8},
+		{.name = "Filter convolution  GA88",
+		 .tst_fn = filter_convolution__GA88},
+		{.name = "Filter convolution  G16",
+		 .tst_fn = filter_convolution__G16},
+		{.name = "Filter convolution  RGBA8888_PM",
+		 .tst_fn = filter_convolution__RGBA8888_PM},
+		{.name = "Filter convolution_alloc  xRGB8888",
+		 .tst_fn = filter_convolution_alloc__xRGB8888},
+		{.name = "Filter convolution_alloc  RGBA8888",
+		 .tst_fn = filter_convolution_alloc__RGBA8888},
+		{.name = "Filter convolution_alloc  RGB888",
+		 .tst_fn = filter_convolution_alloc__RGB888},
+		{.name = "Filter convolution_alloc  BGR888",
+		 .tst_fn = filter_convolution_alloc__BGR888},
+		{.name = "Filter convolution_alloc  RGB555",
+		 .tst_fn = filter_convolution_alloc__RGB555},
+		{.name = "Filter convolution_alloc  RGB565",
+		 .tst_fn = filter_convolution_alloc__RGB565},
+		{.name = "Filter convolution_alloc  RGB666",
+		 .tst_fn = filter_convolution_alloc__RGB666},
+		{.name = "Filter convolution_alloc  RGB332",
+		 .tst_fn = filter_convolution_alloc__RGB332},
+		{.name = "Filter convolution_alloc  CMYK8888",
+		 .tst_fn = filter_convolution_alloc__CMYK8888},
+		{.name = "Filter convolution_alloc  P2",
+		 .tst_fn = filter_convolution_alloc__P2},
+		{.name = "Filter convolution_alloc  P4",
+		 .tst_fn = filter_convolution_alloc__P4},
+		{.name = "Filter convolution_alloc  P8",
+		 .tst_fn = filter_convolution_alloc__P8},
+		{.name = "Filter convolution_alloc  G1",
+		 .tst_fn = filter_convolution_alloc__G1},
+		{.name = "Filter convolution_alloc  G2",
+		 .tst_fn = filter_convolution_alloc__G2},
+		{.name = "Filter convolution_alloc  G4",
+		 .tst_fn = filter_convolution_alloc__G4},
+		{.name = "Filter convolution_alloc  G8",
+		 .tst_fn = filter_convolution_alloc__G8},
+		{.name = "Filter convolution_alloc  GA88",
+		 .tst_fn = filter_convolution_alloc__GA88},
+		{.name = "Filter convolution_alloc  G16",
+		 .tst_fn = filter_convolution_alloc__G16},
+		{.name = "Filter convolution_alloc  RGBA8888_PM",
+		 .tst_fn = filter_convolution_alloc__RGBA8888_PM},
+		{.name = "Filter gaussian_blur  xRGB8888",
+		 .tst_fn = filter_gaussian_blur__xRGB8888},
+		{.name = "Filter gaussian_blur  RGBA8888",
+		 .tst_fn = filter_gaussian_blur__RGBA8888},
+		{.name = "Filter gaussian_blur  RGB888",
+		 .tst_fn = filter_gaussian_blur__RGB888},
+		{.name = "Filter gaussian_blur  BGR888",
+		 .tst_fn = filter_gaussian_blur__BGR888},
+		{.name = "Filter gaussian_blur  RGB555",
+		 .tst_fn = filter_gaussian_blur__RGB555},
+		{.name = "Filter gaussian_blur  RGB565",
+		 .tst_fn = filter_gaussian_blur__RGB565},
+		{.name = "Filter gaussian_blur  RGB666",
+		 .tst_fn = filter_gaussian_blur__RGB666},
+		{.name = "Filter gaussian_blur  RGB332",
+		 .tst_fn = filter_gaussian_blur__RGB332},
+		{.name = "Filter gaussian_blur  CMYK8888",
+		 .tst_fn = filter_gaussian_blur__CMYK8888},
+		{.name = "Filter gaussian_blur  P2",
+		 .tst_fn = filter_gaussian_blur__P2},
+		{.name = "Filter gaussian_blur  P4",
+		 .tst_fn = filter_gaussian_blur__P4},
+		{.name = "Filter gaussian_blur  P8",
+		 .tst_fn = filter_gaussian_blur__P8},
+		{.name = "Filter gaussian_blur  G1",
+		 .tst_fn = filter_gaussian_blur__G1},
+		{.name = "Filter gaussian_blur  G2",
+		 .tst_fn = filter_gaussian_blur__G2},
+		{.name = "Filter gaussian_blur  G4",
+		 .tst_fn = filter_gaussian_blur__G4},
+		{.name = "Filter gaussian_blur  G8",
+		 .tst_fn = filter_gaussian_blur__G8},
+		{.name = "Filter gaussian_blur  GA88",
+		 .tst_fn = filter_gaussian_blur__GA88},
+		{.name = "Filter gaussian_blur  G16",
+		 .tst_fn = filter_gaussian_blur__G16},
+		{.name = "Filter gaussian_blur  RGBA8888_PM",
+		 .tst_fn = filter_gaussian_blur__RGBA8888_PM},
+		{.name = "Filter gaussian_blur_alloc  xRGB8888",
+		 .tst_fn = filter_gaussian_blur_alloc__xRGB8888},
+		{.name = "Filter gaussian_blur_alloc  RGBA8888",
+		 .tst_fn = filter_gaussian_blur_alloc__RGBA8888},
+		{.name = "Filter gaussian_blur_alloc  RGB888",
+		 .tst_fn = filter_gaussian_blur_alloc__RGB888},
+		{.name = "Filter gaussian_blur_alloc  BGR888",
+		 .tst_fn = filter_gaussian_blur_alloc__BGR888},
+		{.name = "Filter gaussian_blur_alloc  RGB555",
+		 .tst_fn = filter_gaussian_blur_alloc__RGB555},
+		{.name = "Filter gaussian_blur_alloc  RGB565",
+		 .tst_fn = filter_gaussian_blur_alloc__RGB565},
+		{.name = "Filter gaussian_blur_alloc  RGB666",
+		 .tst_fn = filter_gaussian_blur_alloc__RGB666},
+		{.name = "Filter gaussian_blur_alloc  RGB332",
+		 .tst_fn = filter_gaussian_blur_alloc__RGB332},
+		{.name = "Filter gaussian_blur_alloc  CMYK8888",
+		 .tst_fn = filter_gaussian_blur_alloc__CMYK8888},
+		{.name = "Filter gaussian_blur_alloc  P2",
+		 .tst_fn = filter_gaussian_blur_alloc__P2},
+		{.name = "Filter gaussian_blur_alloc  P4",
+		 .tst_fn = filter_gaussian_blur_alloc__P4},
+		{.name = "Filter gaussian_blur_alloc  P8",
+		 .tst_fn = filter_gaussian_blur_alloc__P8},
+		{.name = "Filter gaussian_blur_alloc  G1",
+		 .tst_fn = filter_gaussian_blur_alloc__G1},
+		{.name = "Filter gaussian_blur_alloc  G2",
+		 .tst_fn = filter_gaussian_blur_alloc__G2},
+		{.name = "Filter gaussian_blur_alloc  G4",
+		 .tst_fn = filter_gaussian_blur_alloc__G4},
+		{.name = "Filter gaussian_blur_alloc  G8",
+		 .tst_fn = filter_gaussian_blur_alloc__G8},
+		{.name = "Filter gaussian_blur_alloc  GA88",
+		 .tst_fn = filter_gaussian_blur_alloc__GA88},
+		{.name = "Filter gaussian_blur_alloc  G16",
+		 .tst_fn = filter_gaussian_blur_alloc__G16},
+		{.name = "Filter gaussian_blur_alloc  RGBA8888_PM",
+		 .tst_fn = filter_gaussian_blur_alloc__RGBA8888_PM},
+		{.name = "Filter gaussian_noise_add  xRGB8888",
+		 .tst_fn = filter_gaussian_noise_add__xRGB8888},
+		{.name = "Filter gaussian_noise_add  RGBA8888",
+		 .tst_fn = filter_gaussian_noise_add__RGBA8888},
+		{.name = "Filter gaussian_noise_add  RGB888",
+		 .tst_fn = filter_gaussian_noise_add__RGB888},
+		{.name = "Filter gaussian_noise_add  BGR888",
+		 .tst_fn = filter_gaussian_noise_add__BGR888},
+		{.name = "Filter gaussian_noise_add  RGB555",
+		 .tst_fn = filter_gaussian_noise_add__RGB555},
+		{.name = "Filter gaussian_noise_add  RGB565",
+		 .tst_fn = filter_gaussian_noise_add__RGB565},
+		{.name = "Filter gaussian_noise_add  RGB666",
+		 .tst_fn = filter_gaussian_noise_add__RGB666},
+		{.name = "Filter gaussian_noise_add  RGB332",
+		 .tst_fn = filter_gaussian_noise_add__RGB332},
+		{.name = "Filter gaussian_noise_add  CMYK8888",
+		 .tst_fn = filter_gaussian_noise_add__CMYK8888},
+		{.name = "Filter gaussian_noise_add  P2",
+		 .tst_fn = filter_gaussian_noise_add__P2},
+		{.name = "Filter gaussian_noise_add  P4",
+		 .tst_fn = filter_gaussian_noise_add__P4},
+		{.name = "Filter gaussian_noise_add  P8",
+		 .tst_fn = filter_gaussian_noise_add__P8},
+		{.name = "Filter gaussian_noise_add  G1",
+		 .tst_fn = filter_gaussian_noise_add__G1},
+		{.name = "Filter gaussian_noise_add  G2",
+		 .tst_fn = filter_gaussian_noise_add__G2},
+		{.name = "Filter gaussian_noise_add  G4",
+		 .tst_fn = filter_gaussian_noise_add__G4},
+		{.name = "Filter gaussian_noise_add  G8",
+		 .tst_fn = filter_gaussian_noise_add__G8},
+		{.name = "Filter gaussian_noise_add  GA88",
+		 .tst_fn = filter_gaussian_noise_add__GA88},
+		{.name = "Filter gaussian_noise_add  G16",
+		 .tst_fn = filter_gaussian_noise_add__G16},
+		{.name = "Filter gaussian_noise_add  RGBA8888_PM",
+		 .tst_fn = filter_gaussian_noise_add__RGBA8888_PM},
+		{.name = "Filter gaussian_noise_add_alloc  xRGB8888",
+		 .tst_fn = filter_gaussian_noise_add_alloc__xRGB8888},
+		{.name = "Filter gaussian_noise_add_alloc  RGBA8888",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGBA8888},
+		{.name = "Filter gaussian_noise_add_alloc  RGB888",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGB888},
+		{.name = "Filter gaussian_noise_add_alloc  BGR888",
+		 .tst_fn = filter_gaussian_noise_add_alloc__BGR888},
+		{.name = "Filter gaussian_noise_add_alloc  RGB555",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGB555},
+		{.name = "Filter gaussian_noise_add_alloc  RGB565",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGB565},
+		{.name = "Filter gaussian_noise_add_alloc  RGB666",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGB666},
+		{.name = "Filter gaussian_noise_add_alloc  RGB332",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGB332},
+		{.name = "Filter gaussian_noise_add_alloc  CMYK8888",
+		 .tst_fn = filter_gaussian_noise_add_alloc__CMYK8888},
+		{.name = "Filter gaussian_noise_add_alloc  P2",
+		 .tst_fn = filter_gaussian_noise_add_alloc__P2},
+		{.name = "Filter gaussian_noise_add_alloc  P4",
+		 .tst_fn = filter_gaussian_noise_add_alloc__P4},
+		{.name = "Filter gaussian_noise_add_alloc  P8",
+		 .tst_fn = filter_gaussian_noise_add_alloc__P8},
+		{.name = "Filter gaussian_noise_add_alloc  G1",
+		 .tst_fn = filter_gaussian_noise_add_alloc__G1},
+		{.name = "Filter gaussian_noise_add_alloc  G2",
+		 .tst_fn = filter_gaussian_noise_add_alloc__G2},
+		{.name = "Filter gaussian_noise_add_alloc  G4",
+		 .tst_fn = filter_gaussian_noise_add_alloc__G4},
+		{.name = "Filter gaussian_noise_add_alloc  G8",
+		 .tst_fn = filter_gaussian_noise_add_alloc__G8},
+		{.name = "Filter gaussian_noise_add_alloc  GA88",
+		 .tst_fn = filter_gaussian_noise_add_alloc__GA88},
+		{.name = "Filter gaussian_noise_add_alloc  G16",
+		 .tst_fn = filter_gaussian_noise_add_alloc__G16},
+		{.name = "Filter gaussian_noise_add_alloc  RGBA8888_PM",
+		 .tst_fn = filter_gaussian_noise_add_alloc__RGBA8888_PM},
+		{.name = "Filter median  xRGB8888",
+		 .tst_fn = filter_median__xRGB8888},
+		{.name = "Filter median  RGBA8888",
+		 .tst_fn = filter_median__RGBA8888},
+		{.name = "Filter median  RGB888",
+		 .tst_fn = filter_median__RGB888},
+		{.name = "Filter median  BGR888",
+		 .tst_fn = filter_median__BGR888},
+		{.name = "Filter median  RGB555",
+		 .tst_fn = filter_median__RGB555},
+		{.name = "Filter median  RGB565",
+		 .tst_fn = filter_median__RGB565},
+		{.name = "Filter median  RGB666",
+		 .tst_fn = filter_median__RGB666},
+		{.name = "Filter median  RGB332",
+		 .tst_fn = filter_median__RGB332},
+		{.name = "Filter median  CMYK8888",
+		 .tst_fn = filter_median__CMYK8888},
+		{.name = "Filter median  P2",
+		 .tst_fn = filter_median__P2},
+		{.name = "Filter median  P4",
+		 .tst_fn = filter_median__P4},
+		{.name = "Filter median  P8",
+		 .tst_fn = filter_median__P8},
+		{.name = "Filter median  G1",
+		 .tst_fn = filter_median__G1},
+		{.name = "Filter median  G2",
+		 .tst_fn = filter_median__G2},
+		{.name = "Filter median  G4",
+		 .tst_fn = filter_median__G4},
+		{.name = "Filter median  G8",
+		 .tst_fn = filter_median__G8},
+		{.name = "Filter median  GA88",
+		 .tst_fn = filter_median__GA88},
+		{.name = "Filter median  G16",
+		 .tst_fn = filter_median__G16},
+		{.name = "Filter median  RGBA8888_PM",
+		 .tst_fn = filter_median__RGBA8888_PM},
+		{.name = "Filter median_alloc  xRGB8888",
+		 .tst_fn = filter_median_alloc__xRGB8888},
+		{.name = "Filter median_alloc  RGBA8888",
+		 .tst_fn = filter_median_alloc__RGBA8888},
+		{.name = "Filter median_alloc  RGB888",
+		 .tst_fn = filter_median_alloc__RGB888},
+		{.name = "Filter median_alloc  BGR888",
+		 .tst_fn = filter_median_alloc__BGR888},
+		{.name = "Filter median_alloc  RGB555",
+		 .tst_fn = filter_median_alloc__RGB555},
+		{.name = "Filter median_alloc  RGB565",
+		 .tst_fn = filter_median_alloc__RGB565},
+		{.name = "Filter median_alloc  RGB666",
+		 .tst_fn = filter_median_alloc__RGB666},
+		{.name = "Filter median_alloc  RGB332",
+		 .tst_fn = filter_median_alloc__RGB332},
+		{.name = "Filter median_alloc  CMYK8888",
+		 .tst_fn = filter_median_alloc__CMYK8888},
+		{.name = "Filter median_alloc  P2",
+		 .tst_fn = filter_median_alloc__P2},
+		{.name = "Filter median_alloc  P4",
+		 .tst_fn = filter_median_alloc__P4},
+		{.name = "Filter median_alloc  P8",
+		 .tst_fn = filter_median_alloc__P8},
+		{.name = "Filter median_alloc  G1",
+		 .tst_fn = filter_median_alloc__G1},
+		{.name = "Filter median_alloc  G2",
+		 .tst_fn = filter_median_alloc__G2},
+		{.name = "Filter median_alloc  G4",
+		 .tst_fn = filter_median_alloc__G4},
+		{.name = "Filter median_alloc  G8",
+		 .tst_fn = filter_median_alloc__G8},
+		{.name = "Filter median_alloc  GA88",
+		 .tst_fn = filter_median_alloc__GA88},
+		{.name = "Filter median_alloc  G16",
+		 .tst_fn = filter_median_alloc__G16},
+		{.name = "Filter median_alloc  RGBA8888_PM",
+		 .tst_fn = filter_median_alloc__RGBA8888_PM},
+		{.name = "Filter weighted_median  xRGB8888",
+		 .tst_fn = filter_weighted_median__xRGB8888},
+		{.name = "Filter weighted_median  RGBA8888",
+		 .tst_fn = filter_weighted_median__RGBA8888},
+		{.name = "Filter weighted_median  RGB888",
+		 .tst_fn = filter_weighted_median__RGB888},
+		{.name = "Filter weighted_median  BGR888",
+		 .tst_fn = filter_weighted_median__BGR888},
+		{.name = "Filter weighted_median  RGB555",
+		 .tst_fn = filter_weighted_median__RGB555},
+		{.name = "Filter weighted_median  RGB565",
+		 .tst_fn = filter_weighted_median__RGB565},
+		{.name = "Filter weighted_median  RGB666",
+		 .tst_fn = filter_weighted_median__RGB666},
+		{.name = "Filter weighted_median  RGB332",
+		 .tst_fn = filter_weighted_median__RGB332},
+		{.name = "Filter weighted_median  CMYK8888",
+		 .tst_fn = filter_weighted_median__CMYK8888},
+		{.name = "Filter weighted_median  P2",
+		 .tst_fn = filter_weighted_median__P2},
+		{.name = "Filter weighted_median  P4",
+		 .tst_fn = filter_weighted_median__P4},
+		{.name = "Filter weighted_median  P8",
+		 .tst_fn = filter_weighted_median__P8},
+		{.name = "Filter weighted_median  G1",
+		 .tst_fn = filter_weighted_median__G1},
+		{.name = "Filter weighted_median  G2",
+		 .tst_fn = filter_weighted_median__G2},
+		{.name = "Filter weighted_median  G4",
+		 .tst_fn = filter_weighted_median__G4},
+		{.name = "Filter weighted_median  G8",
+		 .tst_fn = filter_weighted_median__G8},
+		{.name = "Filter weighted_median  GA88",
+		 .tst_fn = filter_weighted_median__GA88},
+		{.name = "Filter weighted_median  G16",
+		 .tst_fn = filter_weighted_median__G16},
+		{.name = "Filter weighted_median  RGBA8888_PM",
+		 .tst_fn = filter_weighted_median__RGBA8888_PM},
+		{.name = "Filter weighted_median_alloc  xRGB8888",
+		 .tst_fn = filter_weighted_median_alloc__xRGB8888},
+		{.name = "Filter weighted_median_alloc  RGBA8888",
+		 .tst_fn = filter_weighted_median_alloc__RGBA8888},
+		{.name = "Filter weighted_median_alloc  RGB888",
+		 .tst_fn = filter_weighted_median_alloc__RGB888},
+		{.name = "Filter weighted_median_alloc  BGR888",
+		 .tst_fn = filter_weighted_median_alloc__BGR888},
+		{.name = "Filter weighted_median_alloc  RGB555",
+		 .tst_fn = filter_weighted_median_alloc__RGB555},
+		{.name = "Filter weighted_median_alloc  RGB565",
+		 .tst_fn = filter_weighted_median_alloc__RGB565},
+		{.name = "Filter weighted_median_alloc  RGB666",
+		 .tst_fn = filter_weighted_median_alloc__RGB666},
+		{.name = "Filter weighted_median_alloc  RGB332",
+		 .tst_fn = filter_weighted_median_alloc__RGB332},
+		{.name = "Filter weighted_median_alloc  CMYK8888",
+		 .tst_fn = filter_weighted_median_alloc__CMYK8888},
+		{.name = "Filter weighted_median_alloc  P2",
+		 .tst_fn = filter_weighted_median_alloc__P2},
+		{.name = "Filter weighted_median_alloc  P4",
+		 .tst_fn = filter_weighted_median_alloc__P4},
+		{.name = "Filter weighted_median_alloc  P8",
+		 .tst_fn = filter_weighted_median_alloc__P8},
+		{.name = "Filter weighted_median_alloc  G1",
+		 .tst_fn = filter_weighted_median_alloc__G1},
+		{.name = "Filter weighted_median_alloc  G2",
+		 .tst_fn = filter_weighted_median_alloc__G2},
+		{.name = "Filter weighted_median_alloc  G4",
+		 .tst_fn = filter_weighted_median_alloc__G4},
+		{.name = "Filter weighted_median_alloc  G8",
+		 .tst_fn = filter_weighted_median_alloc__G8},
+		{.name = "Filter weighted_median_alloc  GA88",
+		 .tst_fn = filter_weighted_median_alloc__GA88},
+		{.name = "Filter weighted_median_alloc  G16",
+		 .tst_fn = filter_weighted_median_alloc__G16},
+		{.name = "Filter weighted_median_alloc  RGBA8888_PM",
+		 .tst_fn = filter_weighted_median_alloc__RGBA8888_PM},
+		{.name = "Filter sigma  xRGB8888",
+		 .tst_fn = filter_sigma__xRGB8888},
+		{.name = "Filter sigma  RGBA8888",
+		 .tst_fn = filter_sigma__RGBA8888},
+		{.name = "Filter sigma  RGB888",
+		 .tst_fn = filter_sigma__RGB888},
+		{.name = "Filter sigma  BGR888",
+		 .tst_fn = filter_sigma__BGR888},
+		{.name = "Filter sigma  RGB555",
+		 .tst_fn = filter_sigma__RGB555},
+		{.name = "Filter sigma  RGB565",
+		 .tst_fn = filter_sigma__RGB565},
+		{.name = "Filter sigma  RGB666",
+		 .tst_fn = filter_sigma__RGB666},
+		{.name = "Filter sigma  RGB332",
+		 .tst_fn = filter_sigma__RGB332},
+		{.name = "Filter sigma  CMYK8888",
+		 .tst_fn = filter_sigma__CMYK8888},
+		{.name = "Filter sigma  P2",
+		 .tst_fn = filter_sigma__P2},
+		{.name = "Filter sigma  P4",
+		 .tst_fn = filter_sigma__P4},
+		{.name = "Filter sigma  P8",
+		 .tst_fn = filter_sigma__P8},
+		{.name = "Filter sigma  G1",
+		 .tst_fn = filter_sigma__G1},
+		{.name = "Filter sigma  G2",
+		 .tst_fn = filter_sigma__G2},
+		{.name = "Filter sigma  G4",
+		 .tst_fn = filter_sigma__G4},
+		{.name = "Filter sigma  G8",
+		 .tst_fn = filter_sigma__G8},
+		{.name = "Filter sigma  GA88",
+		 .tst_fn = filter_sigma__GA88},
+		{.name = "Filter sigma  G16",
+		 .tst_fn = filter_sigma__G16},
+		{.name = "Filter sigma  RGBA8888_PM",
+		 .tst_fn = filter_sigma__RGBA8888_PM},
+		{.name = "Filter sigma_alloc  xRGB8888",
+		 .tst_fn = filter_sigma_alloc__xRGB8888},
+		{.name = "Filter sigma_alloc  RGBA8888",
+		 .tst_fn = filter_sigma_alloc__RGBA8888},
+		{.name = "Filter sigma_alloc  RGB888",
+		 .tst_fn = filter_sigma_alloc__RGB888},
+		{.name = "Filter sigma_alloc  BGR888",
+		 .tst_fn = filter_sigma_alloc__BGR888},
+		{.name = "Filter sigma_alloc  RGB555",
+		 .tst_fn = filter_sigma_alloc__RGB555},
+		{.name = "Filter sigma_alloc  RGB565",
+		 .tst_fn = filter_sigma_alloc__RGB565},
+		{.name = "Filter sigma_alloc  RGB666",
+		 .tst_fn = filter_sigma_alloc__RGB666},
+		{.name = "Filter sigma_alloc  RGB332",
+		 .tst_fn = filter_sigma_alloc__RGB332},
+		{.name = "Filter sigma_alloc  CMYK8888",
+		 .tst_fn = filter_sigma_alloc__CMYK8888},
+		{.name = "Filter sigma_alloc  P2",
+		 .tst_fn = filter_sigma_alloc__P2},
+		{.name = "Filter sigma_alloc  P4",
+		 .tst_fn = filter_sigma_alloc__P4},
+		{.name = "Filter sigma_alloc  P8",
+		 .tst_fn = filter_sigma_alloc__P8},
+		{.name = "Filter sigma_alloc  G1",
+		 .tst_fn = filter_sigma_alloc__G1},
+		{.name = "Filter sigma_alloc  G2",
+		 .tst_fn = filter_sigma_alloc__G2},
+		{.name = "Filter sigma_alloc  G4",
+		 .tst_fn = filter_sigma_alloc__G4},
+		{.name = "Filter sigma_alloc  G8",
+		 .tst_fn = filter_sigma_alloc__G8},
+		{.name = "Filter sigma_alloc  GA88",
+		 .tst_fn = filter_sigma_alloc__GA88},
+		{.name = "Filter sigma_alloc  G16",
+		 .tst_fn = filter_sigma_alloc__G16},
+		{.name = "Filter sigma_alloc  RGBA8888_PM",
+		 .tst_fn = filter_sigma_alloc__RGBA8888_PM},
+		{.name = "Filter resize_nn  xRGB8888",
+		 .tst_fn = filter_resize_nn__xRGB8888},
+		{.name = "Filter resize_nn  RGBA8888",
+		 .tst_fn = filter_resize_nn__RGBA8888},
+		{.name = "Filter resize_nn  RGB888",
+		 .tst_fn = filter_resize_nn__RGB888},
+		{.name = "Filter resize_nn  BGR888",
+		 .tst_fn = filter_resize_nn__BGR888},
+		{.name = "Filter resize_nn  RGB555",
+		 .tst_fn = filter_resize_nn__RGB555},
+		{.name = "Filter resize_nn  RGB565",
+		 .tst_fn = filter_resize_nn__RGB565},
+		{.name = "Filter resize_nn  RGB666",
+		 .tst_fn = filter_resize_nn__RGB666},
+		{.name = "Filter resize_nn  RGB332",
+		 .tst_fn = filter_resize_nn__RGB332},
+		{.name = "Filter resize_nn  CMYK8888",
+		 .tst_fn = filter_resize_nn__CMYK8888},
+		{.name = "Filter resize_nn  P2",
+		 .tst_fn = filter_resize_nn__P2},
+		{.name = "Filter resize_nn  P4",
+		 .tst_fn = filter_resize_nn__P4},
+		{.name = "Filter resize_nn  P8",
+		 .tst_fn = filter_resize_nn__P8},
+		{.name = "Filter resize_nn  G1",
+		 .tst_fn = filter_resize_nn__G1},
+		{.name = "Filter resize_nn  G2",
+		 .tst_fn = filter_resize_nn__G2},
+		{.name = "Filter resize_nn  G4",
+		 .tst_fn = filter_resize_nn__G4},
+		{.name = "Filter resize_nn  G8",
+		 .tst_fn = filter_resize_nn__G8},
+		{.name = "Filter resize_nn  GA88",
+		 .tst_fn = filter_resize_nn__GA88},
+		{.name = "Filter resize_nn  G16",
+		 .tst_fn = filter_resize_nn__G16},
+		{.name = "Filter resize_nn  RGBA8888_PM",
+		 .tst_fn = filter_resize_nn__RGBA8888_PM},
+		{.name = "Filter resize_nn_alloc  xRGB8888",
+		 .tst_fn = filter_resize_nn_alloc__xRGB8888},
+		{.name = "Filter resize_nn_alloc  RGBA8888",
+		 .tst_fn = filter_resize_nn_alloc__RGBA8888},
+		{.name = "Filter resize_nn_alloc  RGB888",
+		 .tst_fn = filter_resize_nn_alloc__RGB888},
+		{.name = "Filter resize_nn_alloc  BGR888",
+		 .tst_fn = filter_resize_nn_alloc__BGR888},
+		{.name = "Filter resize_nn_alloc  RGB555",
+		 .tst_fn = filter_resize_nn_alloc__RGB555},
+		{.name = "Filter resize_nn_alloc  RGB565",
+		 .tst_fn = filter_resize_nn_alloc__RGB565},
+		{.name = "Filter resize_nn_alloc  RGB666",
+		 .tst_fn = filter_resize_nn_alloc__RGB666},
+		{.name = "Filter resize_nn_alloc  RGB332",
+		 .tst_fn = filter_resize_nn_alloc__RGB332},
+		{.name = "Filter resize_nn_alloc  CMYK8888",
+		 .tst_fn = filter_resize_nn_alloc__CMYK8888},
+		{.name = "Filter resize_nn_alloc  P2",
+		 .tst_fn = filter_resize_nn_alloc__P2},
+		{.name = "Filter resize_nn_alloc  P4",
+		 .tst_fn = filter_resize_nn_alloc__P4},
+		{.name = "Filter resize_nn_alloc  P8",
+		 .tst_fn = filter_resize_nn_alloc__P8},
+		{.name = "Filter resize_nn_alloc  G1",
+		 .tst_fn = filter_resize_nn_alloc__G1},
+		{.name = "Filter resize_nn_alloc  G2",
+		 .tst_fn = filter_resize_nn_alloc__G2},
+		{.name = "Filter resize_nn_alloc  G4",
+		 .tst_fn = filter_resize_nn_alloc__G4},
+		{.name = "Filter resize_nn_alloc  G8",
+		 .tst_fn = filter_resize_nn_alloc__G8},
+		{.name = "Filter resize_nn_alloc  GA88",
+		 .tst_fn = filter_resize_nn_alloc__GA88},
+		{.name = "Filter resize_nn_alloc  G16",
+		 .tst_fn = filter_resize_nn_alloc__G16},
+		{.name = "Filter resize_nn_alloc  RGBA8888_PM",
+		 .tst_fn = filter_resize_nn_alloc__RGBA8888_PM},
+		{.name = "Filter floyd_steinberg  xRGB8888",
+		 .tst_fn = filter_floyd_steinberg__xRGB8888},
+		{.name = "Filter floyd_steinberg  RGBA8888",
+		 .tst_fn = filter_floyd_steinberg__RGBA8888},
+		{.name = "Filter floyd_steinberg  RGB888",
+		 .tst_fn = filter_floyd_steinberg__RGB888},
+		{.name = "Filter floyd_steinberg  BGR888",
+		 .tst_fn = filter_floyd_steinberg__BGR888},
+		{.name = "Filter floyd_steinberg  RGB555",
+		 .tst_fn = filter_floyd_steinberg__RGB555},
+		{.name = "Filter floyd_steinberg  RGB565",
+		 .tst_fn = filter_floyd_steinberg__RGB565},
+		{.name = "Filter floyd_steinberg  RGB666",
+		 .tst_fn = filter_floyd_steinberg__RGB666},
+		{.name = "Filter floyd_steinberg  RGB332",
+		 .tst_fn = filter_floyd_steinberg__RGB332},
+		{.name = "Filter floyd_steinberg  CMYK8888",
+		 .tst_fn = filter_floyd_steinberg__CMYK8888},
+		{.name = "Filter floyd_steinberg  P2",
+		 .tst_fn = filter_floyd_steinberg__P2},
+		{.name = "Filter floyd_steinberg  P4",
+		 .tst_fn = filter_floyd_steinberg__P4},
+		{.name = "Filter floyd_steinberg  P8",
+		 .tst_fn = filter_floyd_steinberg__P8},
+		{.name = "Filter floyd_steinberg  G1",
+		 .tst_fn = filter_floyd_steinberg__G1},
+		{.name = "Filter floyd_steinberg  G2",
+		 .tst_fn = filter_floyd_steinberg__G2},
+		{.name = "Filter floyd_steinberg  G4",
+		 .tst_fn = filter_floyd_steinberg__G4},
+		{.name = "Filter floyd_steinberg  G8",
+		 .tst_fn = filter_floyd_steinberg__G8},
+		{.name = "Filter floyd_steinberg  GA88",
+		 .tst_fn = filter_floyd_steinberg__GA88},
+		{.name = "Filter floyd_steinberg  G16",
+		 .tst_fn = filter_floyd_steinberg__G16},
+		{.name = "Filter floyd_steinberg  RGBA8888_PM",
+		 .tst_fn = filter_floyd_steinberg__RGBA8888_PM},
+		{.name = "Filter floyd_steinberg_alloc  xRGB8888",
+		 .tst_fn = filter_floyd_steinberg_alloc__xRGB8888},
+		{.name = "Filter floyd_steinberg_alloc  RGBA8888",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGBA8888},
+		{.name = "Filter floyd_steinberg_alloc  RGB888",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGB888},
+		{.name = "Filter floyd_steinberg_alloc  BGR888",
+		 .tst_fn = filter_floyd_steinberg_alloc__BGR888},
+		{.name = "Filter floyd_steinberg_alloc  RGB555",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGB555},
+		{.name = "Filter floyd_steinberg_alloc  RGB565",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGB565},
+		{.name = "Filter floyd_steinberg_alloc  RGB666",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGB666},
+		{.name = "Filter floyd_steinberg_alloc  RGB332",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGB332},
+		{.name = "Filter floyd_steinberg_alloc  CMYK8888",
+		 .tst_fn = filter_floyd_steinberg_alloc__CMYK8888},
+		{.name = "Filter floyd_steinberg_alloc  P2",
+		 .tst_fn = filter_floyd_steinberg_alloc__P2},
+		{.name = "Filter floyd_steinberg_alloc  P4",
+		 .tst_fn = filter_floyd_steinberg_alloc__P4},
+		{.name = "Filter floyd_steinberg_alloc  P8",
+		 .tst_fn = filter_floyd_steinberg_alloc__P8},
+		{.name = "Filter floyd_steinberg_alloc  G1",
+		 .tst_fn = filter_floyd_steinberg_alloc__G1},
+		{.name = "Filter floyd_steinberg_alloc  G2",
+		 .tst_fn = filter_floyd_steinberg_alloc__G2},
+		{.name = "Filter floyd_steinberg_alloc  G4",
+		 .tst_fn = filter_floyd_steinberg_alloc__G4},
+		{.name = "Filter floyd_steinberg_alloc  G8",
+		 .tst_fn = filter_floyd_steinberg_alloc__G8},
+		{.name = "Filter floyd_steinberg_alloc  GA88",
+		 .tst_fn = filter_floyd_steinberg_alloc__GA88},
+		{.name = "Filter floyd_steinberg_alloc  G16",
+		 .tst_fn = filter_floyd_steinberg_alloc__G16},
+		{.name = "Filter floyd_steinberg_alloc  RGBA8888_PM",
+		 .tst_fn = filter_floyd_steinberg_alloc__RGBA8888_PM},
+		{.name = "Filter hilbert_peano  xRGB8888",
+		 .tst_fn = filter_hilbert_peano__xRGB8888},
+		{.name = "Filter hilbert_peano  RGBA8888",
+		 .tst_fn = filter_hilbert_peano__RGBA8888},
+		{.name = "Filter hilbert_peano  RGB888",
+		 .tst_fn = filter_hilbert_peano__RGB888},
+		{.name = "Filter hilbert_peano  BGR888",
+		 .tst_fn = filter_hilbert_peano__BGR888},
+		{.name = "Filter hilbert_peano  RGB555",
+		 .tst_fn = filter_hilbert_peano__RGB555},
+		{.name = "Filter hilbert_peano  RGB565",
+		 .tst_fn = filter_hilbert_peano__RGB565},
+		{.name = "Filter hilbert_peano  RGB666",
+		 .tst_fn = filter_hilbert_peano__RGB666},
+		{.name = "Filter hilbert_peano  RGB332",
+		 .tst_fn = filter_hilbert_peano__RGB332},
+		{.name = "Filter hilbert_peano  CMYK8888",
+		 .tst_fn = filter_hilbert_peano__CMYK8888},
+		{.name = "Filter hilbert_peano  P2",
+		 .tst_fn = filter_hilbert_peano__P2},
+		{.name = "Filter hilbert_peano  P4",
+		 .tst_fn = filter_hilbert_peano__P4},
+		{.name = "Filter hilbert_peano  P8",
+		 .tst_fn = filter_hilbert_peano__P8},
+		{.name = "Filter hilbert_peano  G1",
+		 .tst_fn = filter_hilbert_peano__G1},
+		{.name = "Filter hilbert_peano  G2",
+		 .tst_fn = filter_hilbert_peano__G2},
+		{.name = "Filter hilbert_peano  G4",
+		 .tst_fn = filter_hilbert_peano__G4},
+		{.name = "Filter hilbert_peano  G8",
+		 .tst_fn = filter_hilbert_peano__G8},
+		{.name = "Filter hilbert_peano  GA88",
+		 .tst_fn = filter_hilbert_peano__GA88},
+		{.name = "Filter hilbert_peano  G16",
+		 .tst_fn = filter_hilbert_peano__G16},
+		{.name = "Filter hilbert_peano  RGBA8888_PM",
+		 .tst_fn = filter_hilbert_peano__RGBA8888_PM},
+		{.name = "Filter hilbert_peano_alloc  xRGB8888",
+		 .tst_fn = filter_hilbert_peano_alloc__xRGB8888},
+		{.name = "Filter hilbert_peano_alloc  RGBA8888",
+		 .tst_fn = filter_hilbert_peano_alloc__RGBA8888},
+		{.name = "Filter hilbert_peano_alloc  RGB888",
+		 .tst_fn = filter_hilbert_peano_alloc__RGB888},
+		{.name = "Filter hilbert_peano_alloc  BGR888",
+		 .tst_fn = filter_hilbert_peano_alloc__BGR888},
+		{.name = "Filter hilbert_peano_alloc  RGB555",
+		 .tst_fn = filter_hilbert_peano_alloc__RGB555},
+		{.name = "Filter hilbert_peano_alloc  RGB565",
+		 .tst_fn = filter_hilbert_peano_alloc__RGB565},
+		{.name = "Filter hilbert_peano_alloc  RGB666",
+		 .tst_fn = filter_hilbert_peano_alloc__RGB666},
+		{.name = "Filter hilbert_peano_alloc  RGB332",
+		 .tst_fn = filter_hilbert_peano_alloc__RGB332},
+		{.name = "Filter hilbert_peano_alloc  CMYK8888",
+		 .tst_fn = filter_hilbert_peano_alloc__CMYK8888},
+		{.name = "Filter hilbert_peano_alloc  P2",
+		 .tst_fn = filter_hilbert_peano_alloc__P2},
+		{.name = "Filter hilbert_peano_alloc  P4",
+		 .tst_fn = filter_hilbert_peano_alloc__P4},
+		{.name = "Filter hilbert_peano_alloc  P8",
+		 .tst_fn = filter_hilbert_peano_alloc__P8},
+		{.name = "Filter hilbert_peano_alloc  G1",
+		 .tst_fn = filter_hilbert_peano_alloc__G1},
+		{.name = "Filter hilbert_peano_alloc  G2",
+		 .tst_fn = filter_hilbert_peano_alloc__G2},
+		{.name = "Filter hilbert_peano_alloc  G4",
+		 .tst_fn = filter_hilbert_peano_alloc__G4},
+		{.name = "Filter hilbert_peano_alloc  G8",
+		 .tst_fn = filter_hilbert_peano_alloc__G8},
+		{.name = "Filter hilbert_peano_alloc  GA88",
+		 .tst_fn = filter_hilbert_peano_alloc__GA88},
+		{.name = "Filter hilbert_peano_alloc  G16",
+		 .tst_fn = filter_hilbert_peano_alloc__G16},
+		{.name = "Filter hilbert_peano_alloc  RGBA8888_PM",
+		 .tst_fn = filter_hilbert_peano_alloc__RGBA8888_PM},
+		{.name = NULL}
+	}
+};
@@ -0,0 +1,429 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Streaming filter pipeline tests, the rows are pushed through the pipeline
+  in bands of different sizes and the result must be exactly the same as the
+  result of the filters applied one after another on whole pixmaps.
+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <filters/gp_filter_pipe.h>
+#include <filters/gp_linear.h>
+#include <filters/gp_laplace.h>
+#include <filters/gp_dither.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+enum op {
+	OP_END,
+	OP_INVERT,
+	OP_CONV,
+	OP_VHCONV,
+	OP_SHARPEN,
+	OP_RESIZE,
+	OP_DITHER,
+	OP_CONVERT,
+};
+
+struct pipe_op {
+	enum op op;
+	gp_size w, h;
+	gp_pixel_type pixel_type;
+};
+
+#define MAX_OPS 5
+
+struct pipe_test {
+	gp_pixel_type pixel_type;
+	gp_size w, h;
+	/* Number of rows pushed at once */
+	gp_size band;
+	struct pipe_op ops[MAX_OPS];
+};
+
+static float kern[] = {1, 2, 3, 2, 1,
+                       0, 1, 2, 1, 0,
+                       1, 1, 1, 1, 1};
+
+static float hkern[] = {1, 4, 6, 4, 1};
+static float vkern[] = {1, 2, 1};
+
+static int invert_tables(gp_filter_tables *tables, const gp_pixmap *pixmap)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixmap->pixel_type);
+	unsigned int i;
+	gp_pixel j;
+
+	if (gp_filter_tables_init(tables, pixmap))
+		return 1;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		gp_pixel max = (1 << desc->channels[i].size) - 1;
+
+		for (j = 0; j <= max; j++)
+			tables->table[i][j] = max - j;
+	}
+
+	return 0;
+}
+
+/*
+ * Applies the filter on a whole pixmap, the src is freed.
+ */
+static gp_pixmap *ref_op(gp_pixmap *src, struct pipe_op *op)
+{
+	gp_pixmap *res = NULL, *tmp;
+	gp_filter_tables tables;
+	gp_resize_plan *plan;
+
+	switch (op->op) {
+	case OP_INVERT:
+		res = gp_pixmap_copy(src, 0);
+		if (!res || invert_tables(&tables, src))
+			break;
+		gp_filter_tables_apply(src, 0, 0, src->w, src->h, res, 0, 0,
+		                       &tables, NULL);
+		gp_filter_tables_free(&tables);
+	break;
+	case OP_CONV:
+		res = gp_pixmap_copy(src, 0);
+		if (res) {
+			gp_filter_linear_convolution_raw(src, 0, 0, src->w, src->h,
+			                                 res, 0, 0, kern, 5, 3,
+			                                 17, NULL);
+		}
+	break;
+	case OP_VHCONV:
+		tmp = gp_pixmap_copy(src, 0);
+		res = gp_pixmap_copy(src, 0);
+		if (tmp && res) {
+			gp_filter_hlinear_convolution_raw(src, 0, 0, src->w, src->h,
+			                                  tmp, 0, 0, hkern, 5, 16,
+			                                  NULL);
+			gp_filter_vlinear_convolution_raw(tmp, 0, 0, src->w, src->h,
+			                                  res, 0, 0, vkern, 3, 4,
+			                                  NULL);
+		}
+		gp_pixmap_free(tmp);
+	break;
+	case OP_SHARPEN:
+		res = gp_filter_edge_sharpening_alloc(src, 0.5, NULL);
+	break;
+	case OP_RESIZE:
+		plan = gp_resize_plan_create(src->w, src->h, op->w, op->h,
+		                             src->pixel_type, GP_INTERP_LINEAR_LF_INT);
+		res = gp_pixmap_alloc(op->w, op->h, src->pixel_type);
+		if (plan && res)
+			gp_resize_plan_exec(plan, src, res, NULL);
+		gp_resize_plan_free(plan);
+	break;
+	case OP_DITHER:
+		res = gp_filter_floyd_steinberg_alloc(src, op->pixel_type, NULL);
+	break;
+	case OP_CONVERT:
+		res = gp_pixmap_convert_alloc(src, op->pixel_type);
+	break;
+	case OP_END:
+	break;
+	}
+
+	gp_pixmap_free(src);
+	return res;
+}
+
+static int add_op(gp_filter_pipe *pipe, struct pipe_op *op,
+                  gp_filter_tables *tables, const gp_pixmap *src)
+{
+	switch (op->op) {
+	case OP_INVERT:
+		if (invert_tables(tables, src))
+			return 1;
+		return gp_filter_pipe_tables(pipe, tables);
+	case OP_CONV:
+		return gp_filter_pipe_convolution(pipe, kern, 5, 3, 17);
+	case OP_VHCONV:
+		return gp_filter_pipe_vhconvolution(pipe, hkern, 5, 16, vkern, 3, 4);
+	case OP_SHARPEN:
+		return gp_filter_pipe_edge_sharpening(pipe, 0.5);
+	case OP_RESIZE:
+		return gp_filter_pipe_resize(pipe, op->w, op->h,
+		                             GP_INTERP_LINEAR_LF_INT);
+	case OP_DITHER:
+		return gp_filter_pipe_floyd_steinberg(pipe, op->pixel_type);
+	case OP_CONVERT:
+		return gp_filter_pipe_convert(pipe, op->pixel_type);
+	case OP_END:
+	break;
+	}
+
+	return 0;
+}
+
+struct sink {
+	gp_pixmap *res;
+	gp_size y;
+	int err;
+};
+
+static int sink(const gp_pixmap *rows, void *priv)
+{
+	struct sink *sink = priv;
+	gp_size y;
+
+	if (rows->w != sink->res->w || rows->pixel_type != sink->res->pixel_type ||
+	    sink->y + rows->h > sink->res->h) {
+		tst_msg("Wrong rows %ux%u %s at %u", rows->w, rows->h,
+		        gp_pixel_type_name(rows->pixel_type), sink->y);
+		sink->err = 1;
+		errno = EINVAL;
+		return 1;
+	}
+
+	for (y = 0; y < rows->h; y++) {
+		memcpy(GP_PIXEL_ADDR(sink->res, 0, sink->y + y),
+		       GP_PIXEL_ADDR(rows, 0, y), rows->bytes_per_row);
+	}
+
+	sink->y += rows->h;
+
+	return 0;
+}
+
+static int filter_pipe(struct pipe_test *test)
+{
+	gp_filter_tables tables[MAX_OPS] = {};
+	gp_pixmap *src, *ref = NULL, rows;
+	struct sink out = {};
+	gp_filter_pipe *pipe;
+	gp_pixel_type pixel_type;
+	int ret = TST_FAILED;
+	gp_size w, h, y;
+	unsigned int i;
+
+	src = gp_pixmap_alloc(test->w, test->h, test->pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	pipe = gp_filter_pipe_create(src->w, src->h, src->pixel_type, sink, &out);
+	if (!pipe) {
+		tst_msg("Failed to create pipeline: %s", tst_strerr(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (i = 0; test->ops[i].op != OP_END; i++) {
+		if (add_op(pipe, &test->ops[i], &tables[i], src)) {
+			tst_msg("Failed to add stage %u: %s", i, tst_strerr(errno));
+			goto end;
+		}
+	}
+
+	gp_filter_pipe_out(pipe, &w, &h, &pixel_type);
+
+	out.res = gp_pixmap_alloc(w, h, pixel_type);
+	ref = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+
+	for (i = 0; ref && test->ops[i].op != OP_END; i++)
+		ref = ref_op(ref, &test->ops[i]);
+
+	if (!out.res || !ref) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	if (ref->w != w || ref->h != h || ref->pixel_type != pixel_type) {
+		tst_msg("Pipeline output %ux%u %s expected %ux%u %s",
+		        w, h, gp_pixel_type_name(pixel_type),
+		        ref->w, ref->h, gp_pixel_type_name(ref->pixel_type));
+		goto end;
+	}
+
+	for (y = 0; y < src->h; y += test->band) {
+		gp_sub_pixmap(src, &rows, 0, y, src->w,
+		              GP_MIN(test->band, src->h - y));
+
+		if (gp_filter_pipe_push(pipe, &rows)) {
+			tst_msg("Failed to push rows: %s", tst_strerr(errno));
+			goto end;
+		}
+	}
+
+	if (out.err)
+		goto end;
+
+	if (out.y != h) {
+		tst_msg("Got %u rows expected %u", out.y, h);
+		goto end;
+	}
+
+	if (tst_pixmap_cmp(ref, out.res))
+		goto end;
+
+	ret = TST_SUCCESS;
+end:
+	for (i = 0; i < MAX_OPS; i++)
+		gp_filter_tables_free(&tables[i]);
+
+	gp_filter_pipe_free(pipe);
+	gp_pixmap_free(out.res);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int dummy_sink(const gp_pixmap GP_UNUSED(*rows), void GP_UNUSED(*priv))
+{
+	return 0;
+}
+
+static int invalid_push(void)
+{
+	gp_filter_pipe *pipe;
+	gp_pixmap *rows;
+	int ret = TST_FAILED;
+
+	pipe = gp_filter_pipe_create(10, 10, GP_PIXEL_RGB888, dummy_sink, NULL);
+	rows = gp_pixmap_alloc(11, 2, GP_PIXEL_RGB888);
+
+	if (!pipe || !rows) {
+		tst_msg("Failed to allocate pipeline: %s", tst_strerr(errno));
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	if (gp_filter_pipe_edge_sharpening(pipe, 0.2)) {
+		tst_msg("Failed to add stage: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	if (!gp_filter_pipe_push(pipe, rows) || errno != EINVAL) {
+		tst_msg("Push of wrong width did not fail with EINVAL");
+		goto end;
+	}
+
+	gp_pixmap_free(rows);
+	rows = gp_pixmap_alloc(10, 11, GP_PIXEL_RGB888);
+	if (!rows) {
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	if (!gp_filter_pipe_push(pipe, rows) || errno != EINVAL) {
+		tst_msg("Push of too many rows did not fail with EINVAL");
+		goto end;
+	}
+
+	rows->h = 5;
+
+	if (gp_filter_pipe_push(pipe, rows)) {
+		tst_msg("Failed to push rows: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	if (!gp_filter_pipe_convert(pipe, GP_PIXEL_G8) || errno != EINVAL) {
+		tst_msg("Adding stage after push did not fail with EINVAL");
+		goto end;
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_pixmap_free(rows);
+	gp_filter_pipe_free(pipe);
+	return ret;
+}
+
+static int unsupported_stage(void)
+{
+	gp_filter_pipe *pipe;
+	int ret = TST_FAILED;
+
+	pipe = gp_filter_pipe_create(10, 10, GP_PIXEL_RGB565, dummy_sink, NULL);
+	if (!pipe) {
+		tst_msg("Failed to create pipeline: %s", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	if (!gp_filter_pipe_resize(pipe, 5, 5, GP_INTERP_LINEAR_INT) ||
+	    errno != ENOSYS) {
+		tst_msg("Resize of RGB565 did not fail with ENOSYS");
+		goto end;
+	}
+
+	if (!gp_filter_pipe_floyd_steinberg(pipe, GP_PIXEL_RGBA8888) ||
+	    errno != ENOSYS) {
+		tst_msg("Dithering into RGBA8888 did not fail with ENOSYS");
+		goto end;
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_filter_pipe_free(pipe);
+	return ret;
+}
+
+#define PIPE_TEST(desc, pt, pw, ph, pband, ...) \
+	{.name = "Filter pipe " desc " " #pt " " #pw "x" #ph " band " #pband, \
+	 .tst_fn = filter_pipe, \
+	 .data = &(struct pipe_test){GP_PIXEL_##pt, pw, ph, pband, {__VA_ARGS__}}, \
+	 .flags = TST_CHECK_MALLOC}
+
+#define INVERT {.op = OP_INVERT}
+#define CONV {.op = OP_CONV}
+#define VHCONV {.op = OP_VHCONV}
+#define SHARPEN {.op = OP_SHARPEN}
+#define RESIZE(rw, rh) {.op = OP_RESIZE, .w = rw, .h = rh}
+#define DITHER(pt) {.op = OP_DITHER, .pixel_type = GP_PIXEL_##pt}
+#define CONVERT(pt) {.op = OP_CONVERT, .pixel_type = GP_PIXEL_##pt}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Filter pipeline testsuite",
+	.tests = {
+		PIPE_TEST("empty", RGB888, 37, 23, 5, {}),
+		PIPE_TEST("invert", RGB888, 37, 23, 5, INVERT),
+		PIPE_TEST("invert", RGB565, 37, 23, 1, INVERT),
+		PIPE_TEST("convolution", G8, 37, 23, 1, CONV),
+		PIPE_TEST("convolution", RGB888, 37, 23, 7, CONV),
+		PIPE_TEST("convolution", RGB888, 37, 2, 1, CONV),
+		PIPE_TEST("vhconvolution", RGB888, 37, 23, 3, VHCONV),
+		PIPE_TEST("vhconvolution", RGB565, 37, 23, 23, VHCONV),
+		PIPE_TEST("sharpen", xRGB8888, 101, 67, 4, SHARPEN),
+		PIPE_TEST("resize", RGB888, 157, 93, 5, RESIZE(41, 17)),
+		PIPE_TEST("resize", G8, 37, 23, 1, RESIZE(101, 67)),
+		PIPE_TEST("resize", RGB888, 301, 203, 203, RESIZE(13, 7)),
+		PIPE_TEST("dither", RGB888, 37, 23, 3, DITHER(G1)),
+		PIPE_TEST("dither", RGB888, 37, 23, 1, DITHER(RGB565)),
+		PIPE_TEST("convert", RGB888, 37, 23, 4, CONVERT(G8)),
+		PIPE_TEST("resize sharpen convert", RGB888, 157, 93, 8,
+		          RESIZE(97, 61), SHARPEN, CONVERT(BGR888)),
+		PIPE_TEST("blur resize invert dither", G8, 93, 157, 2,
+		          VHCONV, RESIZE(61, 97), INVERT, DITHER(G2)),
+		PIPE_TEST("sharpen resize convolution", RGB888, 1000, 300, 17,
+		          SHARPEN, RESIZE(900, 500), CONV, CONVERT(G8)),
+
+		{.name = "Filter pipe invalid push",
+		 .tst_fn = invalid_push,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "Filter pipe unsupported stage",
+		 .tst_fn = unsupported_stage,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
@@ -86,6 +86,16 @@
 @                  ['resize_alloc', ['src', 'src->w', 'src->h',
 @                                   'GP_INTERP_CUBIC', 'NULL']],
 @                 ],
+@                 ['resize_lanczos_int',
+@                  ['resize', ['dst', 'dst', 'GP_INTERP_LANCZOS_INT', 'NULL']],
+@                  ['resize_alloc', ['src', 'src->w', 'src->h',
+@                                   'GP_INTERP_LANCZOS_INT', 'NULL']],
+@                 ],
+@                 ['resize_area_int',
+@                  ['resize', ['dst', 'dst', 'GP_INTERP_AREA_INT', 'NULL']],
+@                  ['resize_alloc', ['src', 'src->w', 'src->h',
+@                                   'GP_INTERP_AREA_INT', 'NULL']],
+@                 ],
 @                 ['laplace',
 @                  ['laplace', ['src', 'dst', 'NULL']],
 @                  ['laplace_alloc', ['src', 'NULL']],
@@ -0,0 +1,207 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Histogram tests, the result is compared against a histogram counted pixel
+  by pixel.
+
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <filters/gp_stats.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct histogram_test {
+	gp_pixel_type pixel_type;
+	gp_size w, h;
+	unsigned int stride;
+	unsigned int threads;
+	/* Counts histogram of a w x h subpixmap at 1x1 */
+	int sub;
+};
+
+static void ref_histogram(gp_histogram *hist, const gp_pixmap *src,
+                          unsigned int stride)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	unsigned int i;
+	gp_size x, y;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		for (x = 0; x < hist->channels[i]->len; x++)
+			hist->channels[i]->hist[x] = 0;
+	}
+
+	for (y = 0; y < src->h; y += stride) {
+		for (x = 0; x < src->w; x += stride) {
+			gp_pixel pix = gp_getpixel_raw(src, x, y);
+
+			for (i = 0; i < desc->numchannels; i++) {
+				gp_pixel val = (pix >> desc->channels[i].offset) &
+				               ((1 << desc->channels[i].size) - 1);
+
+				hist->channels[i]->hist[val]++;
+			}
+		}
+	}
+}
+
+static int cmp_histograms(gp_histogram *ref, gp_histogram *res)
+{
+	unsigned int i, j;
+	gp_pixel min, max;
+
+	for (i = 0; i < gp_pixel_channel_count(ref->pixel_type); i++) {
+		gp_histogram_channel *rc = ref->channels[i];
+		gp_histogram_channel *sc = res->channels[i];
+
+		min = max = rc->hist[0];
+
+		for (j = 0; j < rc->len; j++) {
+			if (rc->hist[j] != sc->hist[j]) {
+				tst_msg("Channel %s value %u count %u expected %u",
+				        rc->chan_name, j, sc->hist[j], rc->hist[j]);
+				return 1;
+			}
+
+			min = GP_MIN(min, rc->hist[j]);
+			max = GP_MAX(max, rc->hist[j]);
+		}
+
+		if (sc->min != min || sc->max != max) {
+			tst_msg("Channel %s min %u max %u expected %u %u",
+			        rc->chan_name, sc->min, sc->max, min, max);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int histogram(struct histogram_test *test)
+{
+	gp_histogram *ref, *res;
+	gp_pixmap *src, sub, *img;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(test->w + 2 * test->sub, test->h + 2 * test->sub,
+	                      test->pixel_type);
+	ref = gp_histogram_alloc(test->pixel_type);
+	res = gp_histogram_alloc(test->pixel_type);
+
+	if (!src || !ref || !res) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	img = src;
+	if (test->sub)
+		img = gp_sub_pixmap(src, &sub, 1, 1, test->w, test->h);
+
+	ref_histogram(ref, img, test->stride);
+
+	gp_nr_threads_set(test->threads);
+
+	if (gp_filter_histogram_stride(res, img, test->stride, NULL)) {
+		tst_msg("Histogram failed: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	if (cmp_histograms(ref, res))
+		goto end;
+
+	ret = TST_SUCCESS;
+end:
+	gp_nr_threads_set(1);
+	gp_histogram_free(res);
+	gp_histogram_free(ref);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int invalid(void)
+{
+	gp_histogram *hist;
+	gp_pixmap *src;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(10, 10, GP_PIXEL_RGB888);
+	hist = gp_histogram_alloc(GP_PIXEL_G8);
+
+	if (!src || !hist) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	if (!gp_filter_histogram(hist, src, NULL) || errno != EINVAL) {
+		tst_msg("Pixel type mismatch not rejected");
+		ret = TST_FAILED;
+	}
+
+	gp_histogram_free(hist);
+	hist = gp_histogram_alloc(GP_PIXEL_RGB888);
+
+	if (!hist) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	if (!gp_filter_histogram_stride(hist, src, 0, NULL) || errno != EINVAL) {
+		tst_msg("Zero stride not rejected");
+		ret = TST_FAILED;
+	}
+
+end:
+	gp_histogram_free(hist);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+#define HISTOGRAM_TEST(pt, w, h, stride, threads, sub) \
+	{.name = "Histogram " #pt " " #w "x" #h " stride=" #stride \
+	         " threads=" #threads " sub=" #sub, \
+	 .tst_fn = histogram, \
+	 .data = &(struct histogram_test){GP_PIXEL_##pt, w, h, \
+	                                  stride, threads, sub}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Histogram testsuite",
+	.tests = {
+		HISTOGRAM_TEST(G8, 37, 23, 1, 1, 0),
+		HISTOGRAM_TEST(G8, 301, 203, 1, 4, 0),
+		HISTOGRAM_TEST(RGB888, 37, 23, 1, 1, 0),
+		HISTOGRAM_TEST(RGB888, 301, 203, 1, 3, 0),
+		HISTOGRAM_TEST(RGB888, 301, 203, 3, 4, 0),
+		HISTOGRAM_TEST(RGB888, 157, 93, 2, 2, 1),
+		HISTOGRAM_TEST(xRGB8888, 301, 203, 1, 4, 0),
+		HISTOGRAM_TEST(RGBA8888, 157, 93, 5, 1, 1),
+		HISTOGRAM_TEST(RGB565, 301, 203, 1, 4, 0),
+		HISTOGRAM_TEST(RGB565, 157, 93, 3, 2, 1),
+		HISTOGRAM_TEST(G1, 301, 203, 1, 4, 0),
+		HISTOGRAM_TEST(G2, 157, 93, 1, 1, 1),
+		HISTOGRAM_TEST(G16, 301, 203, 7, 4, 0),
+		HISTOGRAM_TEST(RGB888, 1, 1, 1, 1, 0),
+		HISTOGRAM_TEST(RGB888, 1000, 1000, 64, 4, 0),
+
+		{.name = "Histogram invalid",
+		 .tst_fn = invalid,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
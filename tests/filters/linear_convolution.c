@@ -3,15 +3,21 @@
  * Copyright (C) 2009-2012 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 #include <sys/stat.h>
 
 #include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_blit.h>
+#include <core/gp_clamp.h>
 #include <loaders/gp_loaders.h>
 #include <filters/gp_convolution.h>
+#include <filters/gp_linear.h>
 
 #include "tst_test.h"
+#include "tst_pixmap.h"
 
 static int load_resources(const char *path1, const char *path2,
                           gp_pixmap **c1, gp_pixmap **c2)
@@ -112,6 +118,142 @@ static int test_v_lin_conv_box_3_raw(void)
 	return TST_SUCCESS;
 }
 
+/*
+ * Straightforward per channel implementation used to check the optimized code.
+ */
+static void ref_lin_conv(const gp_pixmap *src, gp_pixmap *dst, float kernel[],
+                         unsigned int ks, float kern_div, int vert)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(src->pixel_type);
+	int ikernel[ks], ikern_div = kern_div * 1024 + 0.5;
+	gp_coord x, y, xi, yi;
+	unsigned int i, c;
+
+	for (i = 0; i < ks; i++)
+		ikernel[i] = kernel[i] * 1024 + 0.5;
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel res = 0;
+
+			for (c = 0; c < desc->numchannels; c++) {
+				const gp_pixel_channel *ch = &desc->channels[c];
+				gp_pixel max = (1 << ch->size) - 1;
+				int32_t sum = 512;
+
+				for (i = 0; i < ks; i++) {
+					xi = vert ? x : x + (int)i - (int)ks/2;
+					yi = vert ? y + (int)i - (int)ks/2 : y;
+					xi = GP_CLAMP(xi, 0, (int)src->w - 1);
+					yi = GP_CLAMP(yi, 0, (int)src->h - 1);
+
+					gp_pixel pix = gp_getpixel_raw(src, xi, yi);
+
+					sum += ((pix >> ch->offset) & max) * ikernel[i];
+				}
+
+				sum /= ikern_div;
+				sum = GP_CLAMP(sum, 0, (int32_t)max);
+
+				res |= (gp_pixel)sum << ch->offset;
+			}
+
+			gp_putpixel_raw(dst, x, y, res);
+		}
+	}
+}
+
+struct lin_conv_cmp {
+	gp_pixel_type pixel_type;
+	unsigned int ks;
+	float *kernel;
+	float div;
+	int vert;
+	int in_place;
+};
+
+static int test_lin_conv_cmp(struct lin_conv_cmp *params)
+{
+	gp_pixmap *src, *ref, *res;
+	gp_coord x, y;
+	int ret = TST_FAILED;
+
+	src = gp_pixmap_alloc(67, 41, params->pixel_type);
+	ref = gp_pixmap_alloc(67, 41, params->pixel_type);
+	res = gp_pixmap_alloc(67, 41, params->pixel_type);
+
+	if (!src || !ref || !res) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto exit;
+	}
+
+	srandom(params->ks);
+
+	tst_pixmap_fill_rand(src);
+
+	/* Pad bytes of xRGB8888 are not part of the pixel value */
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = gp_getpixel_raw(src, x, y);
+			gp_putpixel_raw(src, x, y, pix);
+		}
+	}
+
+	ref_lin_conv(src, ref, params->kernel, params->ks, params->div, params->vert);
+
+	if (params->in_place) {
+		gp_blit(src, 0, 0, src->w, src->h, res, 0, 0);
+		gp_pixmap_free(src);
+		src = res;
+	}
+
+	if (params->vert) {
+		ret = gp_filter_vlinear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                        res, 0, 0, params->kernel,
+		                                        params->ks, params->div, NULL);
+	} else {
+		ret = gp_filter_hlinear_convolution_raw(src, 0, 0, src->w, src->h,
+		                                        res, 0, 0, params->kernel,
+		                                        params->ks, params->div, NULL);
+	}
+
+	if (params->in_place)
+		src = NULL;
+
+	if (ret) {
+		tst_msg("Convolution failed: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto exit;
+	}
+
+	ret = tst_pixmap_cmp(ref, res) ? TST_FAILED : TST_SUCCESS;
+
+exit:
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static float kernel_7[] = {1, 6, 15, 20, 15, 6, 1};
+static float kernel_8[] = {0.5, 1, 2, 3, 3, 2, 1, 0.5};
+/* Weights too large for 16 bit fixed point */
+static float kernel_3_big[] = {40, -1, 40};
+
+static struct lin_conv_cmp h_rgb888 = {GP_PIXEL_RGB888, 7, kernel_7, 64, 0, 0};
+static struct lin_conv_cmp h_xrgb8888 = {GP_PIXEL_xRGB8888, 8, kernel_8, 13, 0, 0};
+static struct lin_conv_cmp h_rgba8888 = {GP_PIXEL_RGBA8888, 7, kernel_7, 64, 0, 1};
+static struct lin_conv_cmp h_g8 = {GP_PIXEL_G8, 8, kernel_8, 13, 0, 1};
+static struct lin_conv_cmp h_g8_big = {GP_PIXEL_G8, 3, kernel_3_big, 79, 0, 0};
+static struct lin_conv_cmp h_rgb565 = {GP_PIXEL_RGB565, 7, kernel_7, 64, 0, 0};
+static struct lin_conv_cmp v_rgb888 = {GP_PIXEL_RGB888, 7, kernel_7, 64, 1, 0};
+static struct lin_conv_cmp v_xrgb8888 = {GP_PIXEL_xRGB8888, 8, kernel_8, 13, 1, 1};
+static struct lin_conv_cmp v_rgba8888 = {GP_PIXEL_RGBA8888, 7, kernel_7, 64, 1, 1};
+static struct lin_conv_cmp v_g8 = {GP_PIXEL_G8, 8, kernel_8, 13, 1, 0};
+static struct lin_conv_cmp v_g8_big = {GP_PIXEL_G8, 3, kernel_3_big, 79, 1, 1};
+static struct lin_conv_cmp v_rgb565 = {GP_PIXEL_RGB565, 7, kernel_7, 64, 1, 1};
+
 const struct tst_suite tst_suite = {
 	.suite_name = "Linear Convolution Testsuite",
 	.tests = {
@@ -127,6 +269,42 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = test_v_lin_conv_box_3_raw,
 		 .res_path = "data/conv/box_3x3/",
 		 .flags = TST_TMPDIR},
+		{.name = "HLinearConvolution_Raw RGB888",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_rgb888},
+		{.name = "HLinearConvolution_Raw xRGB8888",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_xrgb8888},
+		{.name = "HLinearConvolution_Raw RGBA8888 in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_rgba8888},
+		{.name = "HLinearConvolution_Raw G8 in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_g8},
+		{.name = "HLinearConvolution_Raw G8 big weights",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_g8_big},
+		{.name = "HLinearConvolution_Raw RGB565",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &h_rgb565},
+		{.name = "VLinearConvolution_Raw RGB888",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_rgb888},
+		{.name = "VLinearConvolution_Raw xRGB8888 in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_xrgb8888},
+		{.name = "VLinearConvolution_Raw RGBA8888 in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_rgba8888},
+		{.name = "VLinearConvolution_Raw G8",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_g8},
+		{.name = "VLinearConvolution_Raw G8 big weights in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_g8_big},
+		{.name = "VLinearConvolution_Raw RGB565 in-place",
+		 .tst_fn = test_lin_conv_cmp,
+		 .data = &v_rgb565},
 		{.name = NULL}
 	}
 };
@@ -0,0 +1,127 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Median filter tests, the image is split into stripes that may be processed
+  in threads, the result is compared against a brute force median.
+
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <filters/gp_median.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct median_test {
+	int xmed, ymed;
+	unsigned int threads;
+};
+
+/*
+ * Returns the smallest value v such that there are at least trigger values
+ * smaller or equal to v in the window, which is what the filter computes.
+ */
+static unsigned int brute_median(const gp_pixmap *src, int x, int y,
+                                 int xmed, int ymed, int shift)
+{
+	unsigned int hist[256] = {};
+	unsigned int trigger = ((2*xmed+1)*(2*ymed+1))/2;
+	unsigned int acc = 0, i;
+	int dx, dy;
+
+	for (dy = -ymed; dy <= ymed; dy++) {
+		for (dx = -xmed; dx <= xmed; dx++) {
+			int xi = GP_CLAMP(x + dx, 0, (int)src->w - 1);
+			int yi = GP_CLAMP(y + dy, 0, (int)src->h - 1);
+
+			hist[(gp_getpixel_raw(src, xi, yi) >> shift) & 0xff]++;
+		}
+	}
+
+	for (i = 0; i < 256; i++) {
+		acc += hist[i];
+		if (acc >= trigger)
+			return i;
+	}
+
+	return 0;
+}
+
+static int median(struct median_test *test)
+{
+	gp_pixmap *src, *res;
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+
+	src = gp_pixmap_alloc(1103, 37, GP_PIXEL_RGB888);
+
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+	res = gp_filter_median_ex_alloc(src, 3, 2, src->w - 5, src->h - 4,
+	                                test->xmed, test->ymed, NULL);
+
+	if (!res) {
+		tst_msg("Median filter failed");
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)res->h; y++) {
+		for (x = 0; x < (gp_coord)res->w; x++) {
+			gp_pixel p = gp_getpixel_raw(res, x, y);
+			gp_pixel exp = 0;
+			int shift;
+
+			for (shift = 0; shift < 24; shift += 8) {
+				exp |= brute_median(src, x + 3, y + 2,
+				                    test->xmed, test->ymed, shift) << shift;
+			}
+
+			if (p != exp) {
+				tst_msg("Pixel %ix%i %06x expected %06x", x, y, p, exp);
+				ret = TST_FAILED;
+				goto end;
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+#define MEDIAN_TEST(xmed, ymed, threads) \
+	{.name = "Median " #xmed "x" #ymed " threads=" #threads, \
+	 .tst_fn = median, \
+	 .data = &(struct median_test){xmed, ymed, threads}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Median testsuite",
+	.tests = {
+		MEDIAN_TEST(1, 1, 1),
+		MEDIAN_TEST(9, 9, 1),
+		MEDIAN_TEST(0, 0, 2),
+		MEDIAN_TEST(1, 1, 2),
+		MEDIAN_TEST(1, 1, 4),
+		MEDIAN_TEST(3, 1, 3),
+		MEDIAN_TEST(2, 5, 4),
+		MEDIAN_TEST(9, 9, 5),
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Composed point ops tests, the result must be exactly the same as the result
+  of the point filters applied one after another.
+
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_blit.h>
+#include <filters/gp_point.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+#define MAX_OPS 6
+
+struct point_ops_test {
+	gp_pixel_type pixel_type;
+	unsigned int ops_cnt;
+	gp_point_op ops[MAX_OPS];
+};
+
+static int ref_op(gp_pixmap *p, const gp_point_op *op)
+{
+	switch (op->type) {
+	case GP_POINT_BRIGHTNESS:
+		return gp_filter_brightness(p, p, op->b, NULL);
+	case GP_POINT_CONTRAST:
+		return gp_filter_contrast(p, p, op->c, NULL);
+	case GP_POINT_BRIGHTNESS_CONTRAST:
+		return gp_filter_brightness_contrast(p, p, op->b, op->c, NULL);
+	case GP_POINT_POSTERIZE:
+		return gp_filter_posterize(p, p, op->steps, NULL);
+	case GP_POINT_INVERT:
+		return gp_filter_invert(p, p, NULL);
+	}
+
+	return 1;
+}
+
+static int point_ops(struct point_ops_test *test)
+{
+	gp_pixmap *src, *ref, *res;
+	int ret = TST_FAILED;
+	unsigned int i;
+
+	src = gp_pixmap_alloc(131, 77, test->pixel_type);
+	ref = gp_pixmap_alloc(131, 77, test->pixel_type);
+
+	if (!src || !ref) {
+		tst_msg("Malloc failed");
+		ret = TST_UNTESTED;
+		goto end0;
+	}
+
+	tst_pixmap_fill_rand(src);
+	gp_blit_xywh_raw(src, 0, 0, src->w, src->h, ref, 0, 0);
+
+	for (i = 0; i < test->ops_cnt; i++) {
+		if (ref_op(ref, &test->ops[i])) {
+			tst_msg("Point filter %u failed: %s", i, tst_strerr(errno));
+			ret = TST_UNTESTED;
+			goto end0;
+		}
+	}
+
+	res = gp_filter_point_ops_alloc(src, test->ops, test->ops_cnt, NULL);
+	if (!res) {
+		tst_msg("Point ops failed: %s", tst_strerr(errno));
+		goto end0;
+	}
+
+	if (!gp_pixmap_equal(ref, res)) {
+		tst_msg("Composed point ops differ from point filters");
+		goto end1;
+	}
+
+	ret = TST_SUCCESS;
+end1:
+	gp_pixmap_free(res);
+end0:
+	gp_pixmap_free(ref);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int invalid_ops(void)
+{
+	gp_point_op posterize[] = {GP_POINT_OP_INVERT, GP_POINT_OP_POSTERIZE(0)};
+	gp_point_op too_many[] = {GP_POINT_OP_POSTERIZE(4)};
+	gp_point_op invalid[] = {{.type = 100}};
+	gp_pixmap *src;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(10, 10, GP_PIXEL_G2);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	if (!gp_filter_point_ops(src, src, posterize, 2, NULL) || errno != EINVAL) {
+		tst_msg("Posterize with 0 steps not rejected");
+		ret = TST_FAILED;
+	}
+
+	if (!gp_filter_point_ops(src, src, too_many, 1, NULL) || errno != EINVAL) {
+		tst_msg("Posterize with more steps than values not rejected");
+		ret = TST_FAILED;
+	}
+
+	if (!gp_filter_point_ops(src, src, invalid, 1, NULL) || errno != EINVAL) {
+		tst_msg("Invalid op not rejected");
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(src);
+	return ret;
+}
+
+#define CHAIN GP_POINT_OP_BRIGHTNESS(0.1), GP_POINT_OP_CONTRAST(1.3), \
+              GP_POINT_OP_POSTERIZE(3), GP_POINT_OP_INVERT, \
+              GP_POINT_OP_BRIGHTNESS_CONTRAST(-0.2, 0.8)
+
+#define POINT_OPS_TEST(desc, pt, ...) \
+	{.name = "Point ops " desc " " #pt, \
+	 .tst_fn = point_ops, \
+	 .data = &(struct point_ops_test) { \
+		.pixel_type = GP_PIXEL_##pt, \
+		.ops_cnt = sizeof((gp_point_op[]){__VA_ARGS__})/sizeof(gp_point_op), \
+		.ops = {__VA_ARGS__}, \
+	 }, \
+	 .flags = TST_CHECK_MALLOC}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Point ops testsuite",
+	.tests = {
+		POINT_OPS_TEST("none", RGB888, ),
+		POINT_OPS_TEST("invert", RGB888, GP_POINT_OP_INVERT),
+		POINT_OPS_TEST("brightness contrast", G8,
+		               GP_POINT_OP_BRIGHTNESS(-0.3),
+		               GP_POINT_OP_CONTRAST(2)),
+		POINT_OPS_TEST("chain", RGB888, CHAIN),
+		POINT_OPS_TEST("chain", xRGB8888, CHAIN),
+		POINT_OPS_TEST("chain", RGB565, CHAIN),
+		POINT_OPS_TEST("chain", G4, CHAIN),
+		POINT_OPS_TEST("chain", G16, CHAIN),
+
+		{.name = "Point ops invalid",
+		 .tst_fn = invalid_ops,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,367 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Resize tests for 8 bit per channel pixel types, the fixed point separable
+  resampling is compared against a floating point reference and may differ by
+  at most one due to rounding.
+
+  Resize plans executed repeatedly must produce the same result as
+  gp_filter_resize().
+
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <math.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_threads.h>
+#include <filters/gp_resize.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+enum kern {
+	LINEAR,
+	CUBIC,
+	AREA,
+	LANCZOS,
+};
+
+struct resize_test {
+	gp_pixel_type pixel_type;
+	gp_interpolation_type type;
+	gp_size src_w, src_h;
+	gp_size dst_w, dst_h;
+	unsigned int threads;
+	const char *simd;
+};
+
+static double cubic(double x)
+{
+	x = fabs(x);
+
+	if (x < 1)
+		return 1.5*x*x*x - 2.5*x*x + 1;
+
+	if (x < 2)
+		return -0.5*x*x*x + 2.5*x*x - 4*x + 2;
+
+	return 0;
+}
+
+static double sinc(double x)
+{
+	return x == 0 ? 1 : sin(M_PI * x) / (M_PI * x);
+}
+
+static void lanczos_weights(double *w, gp_size i, gp_size src_size, gp_size dst_size)
+{
+	double scale = fmax(1.00 * src_size / dst_size, 1);
+	double c = (i + 0.5) * src_size / dst_size - 0.5;
+	double sum = 0;
+	int j;
+
+	for (j = floor(c - 3 * scale); j <= ceil(c + 3 * scale); j++) {
+		double x = (j - c) / scale;
+		int jc = j < 0 ? 0 : (j >= (int)src_size ? (int)src_size - 1 : j);
+		double l = fabs(x) < 3 ? sinc(x) * sinc(x / 3) : 0;
+
+		w[jc] += l;
+		sum += l;
+	}
+
+	for (j = 0; j < (int)src_size; j++)
+		w[j] /= sum;
+}
+
+/*
+ * Computes weights for all source pixels, the out of image pixels are clamped
+ * to the image border.
+ */
+static void ref_weights(double *w, enum kern kern, gp_size i,
+                        gp_size src_size, gp_size dst_size)
+{
+	double pos = dst_size > 1 ? 1.00 * i * (src_size - 1) / (dst_size - 1)
+	                          : (src_size - 1) / 2.00;
+	double a = 1.00 * i * src_size / dst_size;
+	double b = 1.00 * (i + 1) * src_size / dst_size;
+	int j;
+
+	for (j = 0; j < (int)src_size; j++)
+		w[j] = 0;
+
+	if (kern == LANCZOS) {
+		lanczos_weights(w, i, src_size, dst_size);
+		return;
+	}
+
+	for (j = floor(pos) - 1; j <= floor(pos) + 2; j++) {
+		int jc = j < 0 ? 0 : (j >= (int)src_size ? (int)src_size - 1 : j);
+
+		switch (kern) {
+		case LINEAR:
+			if (fabs(j - pos) < 1)
+				w[jc] += 1 - fabs(j - pos);
+		break;
+		case CUBIC:
+			w[jc] += cubic(j - pos);
+		break;
+		default:
+		break;
+		}
+	}
+
+	if (kern != AREA)
+		return;
+
+	for (j = floor(a); j < b && j < (int)src_size; j++) {
+		double overlap = fmin(b, j + 1) - fmax(a, j);
+
+		w[j] = overlap / (b - a);
+	}
+}
+
+static void kernels(struct resize_test *test, enum kern *kx, enum kern *ky)
+{
+	switch (test->type) {
+	case GP_INTERP_LINEAR_LF_INT:
+		*kx = test->dst_w < test->src_w ? AREA : LINEAR;
+		*ky = test->dst_h < test->src_h ? AREA : LINEAR;
+	break;
+	case GP_INTERP_CUBIC_INT:
+		*kx = *ky = CUBIC;
+	break;
+	case GP_INTERP_LANCZOS_INT:
+		*kx = *ky = LANCZOS;
+	break;
+	case GP_INTERP_AREA_INT:
+		*kx = *ky = AREA;
+	break;
+	default:
+		*kx = *ky = LINEAR;
+	}
+}
+
+static int pad_byte(gp_pixel_type pixel_type, unsigned int b)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(pixel_type);
+	unsigned int i;
+
+	for (i = 0; i < desc->numchannels; i++) {
+		if (desc->channels[i].offset / 8 == b)
+			return 0;
+	}
+
+	return 1;
+}
+
+static int resize(struct resize_test *test)
+{
+	gp_pixmap *src, *dst;
+	unsigned int bpp = gp_pixel_size(test->pixel_type) / 8;
+	double wx[test->src_w], wy[test->src_h];
+	int ret = TST_SUCCESS;
+	gp_size x, y, sx, sy;
+	unsigned int b;
+	enum kern kx, ky;
+
+	if (test->simd)
+		setenv("GP_SIMD", test->simd, 1);
+
+	src = gp_pixmap_alloc(test->src_w, test->src_h, test->pixel_type);
+	dst = gp_pixmap_alloc(test->dst_w, test->dst_h, test->pixel_type);
+
+	if (!src || !dst) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+
+	if (gp_filter_resize(src, dst, test->type, NULL)) {
+		tst_msg("Resize failed");
+		ret = TST_FAILED;
+		goto end;
+	}
+
+	kernels(test, &kx, &ky);
+
+	for (y = 0; y < dst->h; y++) {
+		ref_weights(wy, ky, y, src->h, dst->h);
+
+		for (x = 0; x < dst->w; x++) {
+			ref_weights(wx, kx, x, src->w, dst->w);
+
+			for (b = 0; b < bpp; b++) {
+				uint8_t res = dst->pixels[y * dst->bytes_per_row + x * bpp + b];
+				double sum = 0;
+				int exp;
+
+				for (sy = 0; sy < src->h; sy++) {
+					double row = 0;
+
+					if (!wy[sy])
+						continue;
+
+					for (sx = 0; sx < src->w; sx++) {
+						row += wx[sx] *
+						       src->pixels[sy * src->bytes_per_row + sx * bpp + b];
+					}
+
+					sum += wy[sy] * row;
+				}
+
+				exp = round(sum);
+				exp = exp < 0 ? 0 : (exp > 255 ? 255 : exp);
+
+				if (pad_byte(test->pixel_type, b))
+					exp = 0;
+
+				if (abs(exp - res) > 1) {
+					tst_msg("Pixel %ux%u byte %u %u expected %i",
+					        x, y, b, res, exp);
+					ret = TST_FAILED;
+					goto end;
+				}
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+static int resize_plan(struct resize_test *test)
+{
+	gp_pixmap *src, *dst, *ref;
+	gp_resize_plan *plan = NULL;
+	int ret = TST_SUCCESS;
+	unsigned int i;
+
+	src = gp_pixmap_alloc(test->src_w, test->src_h, test->pixel_type);
+	dst = gp_pixmap_alloc(test->dst_w, test->dst_h, test->pixel_type);
+	ref = gp_pixmap_alloc(test->dst_w, test->dst_h, test->pixel_type);
+
+	if (!src || !dst || !ref) {
+		tst_msg("Malloc failed :(");
+		ret = TST_UNTESTED;
+		goto end;
+	}
+
+	gp_nr_threads_set(test->threads);
+
+	plan = gp_resize_plan_create(test->src_w, test->src_h,
+	                             test->dst_w, test->dst_h,
+	                             test->pixel_type, test->type);
+	if (!plan) {
+		tst_msg("Failed to create plan: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto end;
+	}
+
+	for (i = 0; i < 3; i++) {
+		tst_pixmap_fill_rand(src);
+
+		if (gp_filter_resize(src, ref, test->type, NULL)) {
+			tst_msg("Resize failed");
+			ret = TST_FAILED;
+			goto end;
+		}
+
+		if (gp_resize_plan_exec(plan, src, dst, NULL)) {
+			tst_msg("Plan exec failed");
+			ret = TST_FAILED;
+			goto end;
+		}
+
+		if (tst_pixmap_cmp(ref, dst)) {
+			tst_msg("Plan exec %u result differs", i);
+			ret = TST_FAILED;
+			goto end;
+		}
+	}
+
+	if (!gp_resize_plan_exec(plan, dst, src, NULL) || errno != EINVAL) {
+		tst_msg("Plan exec with swapped sizes did not fail with EINVAL");
+		ret = TST_FAILED;
+	}
+
+end:
+	gp_resize_plan_free(plan);
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	gp_pixmap_free(ref);
+	return ret;
+}
+
+#define RESIZE_PLAN_TEST(pt, interp, sw, sh, dw, dh, threads) \
+	{.name = "Resize plan " #pt " " #interp " " #sw "x" #sh " -> " #dw "x" #dh \
+	         " threads=" #threads, \
+	 .tst_fn = resize_plan, \
+	 .data = &(struct resize_test){GP_PIXEL_##pt, GP_INTERP_##interp, \
+	                               sw, sh, dw, dh, threads, NULL}}
+
+#define RESIZE_TEST(pt, interp, sw, sh, dw, dh, threads, simd) \
+	{.name = "Resize " #pt " " #interp " " #sw "x" #sh " -> " #dw "x" #dh \
+	         " threads=" #threads " simd=" #simd, \
+	 .tst_fn = resize, \
+	 .data = &(struct resize_test){GP_PIXEL_##pt, GP_INTERP_##interp, \
+	                               sw, sh, dw, dh, threads, simd}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Resize testsuite",
+	.tests = {
+		RESIZE_TEST(G8, LINEAR_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(RGB888, LINEAR_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(RGB888, LINEAR_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(xRGB8888, LINEAR_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(xRGB8888, LINEAR_INT, 37, 23, 101, 67, 1, "none"),
+		RESIZE_TEST(RGB888, LINEAR_INT, 37, 23, 1, 1, 1, NULL),
+		RESIZE_TEST(G8, LINEAR_LF_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(RGB888, LINEAR_LF_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(RGB888, LINEAR_LF_INT, 157, 93, 13, 7, 4, NULL),
+		RESIZE_TEST(RGBA8888, LINEAR_LF_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(RGBA8888, LINEAR_LF_INT, 157, 93, 41, 17, 1, "none"),
+		RESIZE_TEST(xRGB8888, LINEAR_LF_INT, 120, 30, 33, 91, 3, NULL),
+		RESIZE_TEST(RGB888, LINEAR_LF_INT, 30, 120, 91, 33, 1, "none"),
+		RESIZE_TEST(G8, CUBIC_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(G8, CUBIC_INT, 37, 23, 101, 67, 1, "none"),
+		RESIZE_TEST(RGB888, CUBIC_INT, 37, 23, 101, 67, 2, NULL),
+		RESIZE_TEST(RGB888, CUBIC_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(xRGB8888, CUBIC_INT, 37, 23, 101, 67, 4, NULL),
+		RESIZE_TEST(xRGB8888, CUBIC_INT, 3, 2, 17, 9, 1, NULL),
+		RESIZE_TEST(RGBA8888, CUBIC_INT, 97, 61, 97, 61, 1, NULL),
+		RESIZE_TEST(G8, LANCZOS_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(RGB888, LANCZOS_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_TEST(RGB888, LANCZOS_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(RGB888, LANCZOS_INT, 301, 203, 17, 11, 3, NULL),
+		RESIZE_TEST(xRGB8888, LANCZOS_INT, 157, 93, 41, 17, 2, NULL),
+		RESIZE_TEST(xRGB8888, LANCZOS_INT, 157, 93, 41, 17, 1, "none"),
+		RESIZE_TEST(RGBA8888, LANCZOS_INT, 120, 30, 33, 91, 1, NULL),
+		RESIZE_TEST(RGB888, LANCZOS_INT, 5, 3, 2, 1, 1, NULL),
+		RESIZE_TEST(G8, AREA_INT, 157, 93, 41, 17, 1, NULL),
+		RESIZE_TEST(RGB888, AREA_INT, 301, 203, 17, 11, 1, NULL),
+		RESIZE_TEST(RGB888, AREA_INT, 301, 203, 17, 11, 4, "none"),
+		RESIZE_TEST(xRGB8888, AREA_INT, 301, 203, 17, 11, 1, NULL),
+		RESIZE_TEST(RGBA8888, AREA_INT, 37, 23, 101, 67, 1, NULL),
+		RESIZE_PLAN_TEST(RGB888, LINEAR_INT, 37, 23, 101, 67, 1),
+		RESIZE_PLAN_TEST(RGB888, LINEAR_LF_INT, 157, 93, 41, 17, 3),
+		RESIZE_PLAN_TEST(xRGB8888, CUBIC_INT, 37, 23, 101, 67, 2),
+		RESIZE_PLAN_TEST(G8, LANCZOS_INT, 157, 93, 41, 17, 1),
+		RESIZE_PLAN_TEST(RGBA8888, AREA_INT, 301, 203, 17, 11, 4),
+		RESIZE_PLAN_TEST(RGB888, NN, 37, 23, 101, 67, 1),
+		RESIZE_PLAN_TEST(RGB565, LINEAR_LF_INT, 157, 93, 41, 17, 1),
+		{.name = NULL},
+	}
+};
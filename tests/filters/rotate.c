@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Rotation tests, the result is compared against pixel by pixel rotation for
+  odd sizes that do not align with the tiles and for several threads.
+
+ */
+
+#include <stdlib.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_threads.h>
+#include <filters/gp_rotate.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct rotate_test {
+	gp_pixel_type pixel_type;
+	int deg;
+	unsigned int threads;
+};
+
+static int rotate(struct rotate_test *test)
+{
+	gp_pixmap *src, *dst;
+	gp_coord x, y;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(157, 93, test->pixel_type);
+
+	if (!src) {
+		tst_msg("Malloc failed :(");
+		return TST_UNTESTED;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+
+	if (test->deg == 90)
+		dst = gp_filter_rotate_90_alloc(src, NULL);
+	else
+		dst = gp_filter_rotate_270_alloc(src, NULL);
+
+	if (!dst) {
+		tst_msg("Rotate failed");
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel ps = gp_getpixel_raw(src, x, y);
+			gp_pixel pd;
+
+			if (test->deg == 90)
+				pd = gp_getpixel_raw(dst, src->h - y - 1, x);
+			else
+				pd = gp_getpixel_raw(dst, y, src->w - x - 1);
+
+			if (ps != pd) {
+				tst_msg("Pixel %ix%i %08x rotated to %08x",
+				        x, y, ps, pd);
+				ret = TST_FAILED;
+				goto end;
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(dst);
+	return ret;
+}
+
+#define ROTATE_TEST(pt, deg, threads) \
+	{.name = "Rotate " #pt " " #deg " threads=" #threads, \
+	 .tst_fn = rotate, \
+	 .data = &(struct rotate_test){GP_PIXEL_##pt, deg, threads}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Rotate testsuite",
+	.tests = {
+		ROTATE_TEST(G1, 90, 1),
+		ROTATE_TEST(G4, 270, 1),
+		ROTATE_TEST(G8, 90, 1),
+		ROTATE_TEST(G8, 270, 1),
+		ROTATE_TEST(RGB565, 90, 1),
+		ROTATE_TEST(RGB565, 270, 1),
+		ROTATE_TEST(RGB888, 90, 1),
+		ROTATE_TEST(RGB888, 270, 1),
+		ROTATE_TEST(xRGB8888, 90, 1),
+		ROTATE_TEST(xRGB8888, 270, 1),
+		ROTATE_TEST(G8, 90, 4),
+		ROTATE_TEST(G8, 270, 4),
+		ROTATE_TEST(RGB888, 90, 4),
+		ROTATE_TEST(RGB888, 270, 4),
+		ROTATE_TEST(xRGB8888, 90, 3),
+		ROTATE_TEST(xRGB8888, 270, 3),
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,328 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Summed area table and box blur tests, the results are compared against sums
+  computed pixel by pixel.
+
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <filters/gp_sat.h>
+#include <filters/gp_blur.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct sat_test {
+	gp_pixel_type pixel_type;
+	gp_size w, h;
+	/* The table is built for the pixmap without inset pixels on each side */
+	gp_size inset;
+	gp_size rad;
+	unsigned int threads;
+	/* Expected accumulator sizes */
+	uint8_t sum_bits, sqsum_bits;
+};
+
+static gp_pixel chan_val(const gp_pixmap *p, unsigned int chan,
+                         gp_coord x, gp_coord y)
+{
+	const gp_pixel_channel *c = &gp_pixel_desc(p->pixel_type)->channels[chan];
+	gp_pixel pix;
+
+	x = GP_CLAMP(x, 0, (gp_coord)p->w - 1);
+	y = GP_CLAMP(y, 0, (gp_coord)p->h - 1);
+
+	pix = gp_getpixel_raw(p, x, y);
+
+	return (pix >> c->offset) & ((1 << c->size) - 1);
+}
+
+static void ref_sums(const gp_pixmap *p, unsigned int chan,
+                     gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1,
+                     uint64_t *sum, uint64_t *sqsum)
+{
+	gp_coord x, y;
+
+	*sum = 0;
+	*sqsum = 0;
+
+	for (y = y0; y < y1; y++) {
+		for (x = x0; x < x1; x++) {
+			uint64_t v = chan_val(p, chan, x, y);
+
+			*sum += v;
+			*sqsum += v * v;
+		}
+	}
+}
+
+static int check_box(const gp_sat *sat, const gp_pixmap *src, unsigned int chan,
+                     gp_coord off, gp_coord x0, gp_coord y0, gp_coord x1, gp_coord y1)
+{
+	uint64_t sum, sqsum;
+
+	ref_sums(src, chan, x0 + off, y0 + off, x1 + off, y1 + off, &sum, &sqsum);
+
+	if (gp_sat_sum(sat, chan, x0, y0, x1, y1) != sum) {
+		tst_msg("Chan %u box [%i,%i]x[%i,%i] sum %llu expected %llu",
+		        chan, x0, y0, x1, y1,
+		        (unsigned long long)gp_sat_sum(sat, chan, x0, y0, x1, y1),
+		        (unsigned long long)sum);
+		return 1;
+	}
+
+	if (gp_sat_sqsum(sat, chan, x0, y0, x1, y1) != sqsum) {
+		tst_msg("Chan %u box [%i,%i]x[%i,%i] sqsum %llu expected %llu",
+		        chan, x0, y0, x1, y1,
+		        (unsigned long long)gp_sat_sqsum(sat, chan, x0, y0, x1, y1),
+		        (unsigned long long)sqsum);
+		return 1;
+	}
+
+	return 0;
+}
+
+/* Random window start and end inside [-rad, size + rad) */
+static void rand_window(gp_coord size, gp_coord rad, gp_coord *c0, gp_coord *c1)
+{
+	gp_coord max_len;
+
+	*c0 = random() % (size + 2 * rad) - rad;
+	max_len = GP_MIN(2 * rad + 1, size + rad - *c0);
+	*c1 = *c0 + random() % max_len + 1;
+}
+
+static int sat(struct sat_test *test)
+{
+	gp_coord rad = test->rad, off = test->inset;
+	gp_coord w = test->w - 2 * off, h = test->h - 2 * off;
+	int ret = TST_FAILED;
+	unsigned int i, c;
+	gp_pixmap *src;
+	gp_sat *sat;
+
+	src = gp_pixmap_alloc(test->w, test->h, test->pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+
+	sat = gp_sat_alloc_ex(src, off, off, w, h, rad, rad,
+	                      GP_SAT_SQUARES, NULL);
+	if (!sat) {
+		tst_msg("Failed to build table: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	if (sat->sum_bits != test->sum_bits ||
+	    sat->sqsum_bits != test->sqsum_bits) {
+		tst_msg("Accumulators %u %u bits expected %u %u",
+		        sat->sum_bits, sat->sqsum_bits,
+		        test->sum_bits, test->sqsum_bits);
+		goto end;
+	}
+
+	for (c = 0; c < sat->nr_chans; c++) {
+		/* The largest windows in the corners */
+		if (check_box(sat, src, c, off, -rad, -rad, rad + 1, rad + 1) ||
+		    check_box(sat, src, c, off, w - rad - 1, h - rad - 1,
+		              w + rad, h + rad))
+			goto end;
+
+		for (i = 0; i < 100; i++) {
+			gp_coord x0, y0, x1, y1;
+
+			rand_window(w, rad, &x0, &x1);
+			rand_window(h, rad, &y0, &y1);
+
+			if (check_box(sat, src, c, off, x0, y0, x1, y1))
+				goto end;
+		}
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_nr_threads_set(1);
+	gp_sat_free(sat);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+struct box_blur_test {
+	gp_pixel_type pixel_type;
+	gp_size w, h;
+	unsigned int xrad, yrad;
+	unsigned int threads;
+	int in_place;
+};
+
+static int box_blur(struct box_blur_test *test)
+{
+	const gp_pixel_type_desc *desc = gp_pixel_desc(test->pixel_type);
+	int xrad = test->xrad, yrad = test->yrad;
+	uint64_t area = (2 * xrad + 1) * (2 * yrad + 1);
+	gp_pixmap *src, *res;
+	int ret = TST_FAILED;
+	gp_coord x, y;
+	unsigned int c;
+
+	src = gp_pixmap_alloc(test->w, test->h, test->pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+
+	if (test->in_place) {
+		res = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+		if (res && gp_filter_box_blur(res, res, xrad, yrad, NULL)) {
+			gp_pixmap_free(res);
+			res = NULL;
+		}
+	} else {
+		res = gp_filter_box_blur_alloc(src, xrad, yrad, NULL);
+	}
+
+	if (!res) {
+		tst_msg("Box blur failed: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			for (c = 0; c < desc->numchannels; c++) {
+				uint64_t sum, sqsum;
+				gp_pixel val;
+
+				ref_sums(src, c, x - xrad, y - yrad,
+				         x + xrad + 1, y + yrad + 1, &sum, &sqsum);
+
+				val = (sum + area/2) / area;
+
+				if (chan_val(res, c, x, y) != val) {
+					tst_msg("Pixel %ix%i chan %u %u expected %u",
+					        x, y, c, chan_val(res, c, x, y), val);
+					goto end1;
+				}
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+end1:
+	gp_pixmap_free(res);
+end:
+	gp_nr_threads_set(1);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int variance(void)
+{
+	gp_pixmap *src;
+	gp_sat *sat;
+	int ret = TST_SUCCESS;
+	gp_coord x, y;
+
+	src = gp_pixmap_alloc(10, 10, GP_PIXEL_G8);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	/* Checkerboard of 0 and 100, i.e. mean 50 and variance 2500 */
+	for (y = 0; y < 10; y++) {
+		for (x = 0; x < 10; x++)
+			gp_putpixel_raw(src, x, y, (x + y) % 2 ? 100 : 0);
+	}
+
+	sat = gp_sat_alloc(src, GP_SAT_SQUARES, NULL);
+	if (!sat) {
+		tst_msg("Failed to build table: %s", tst_strerr(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	if (gp_sat_mean(sat, 0, 2, 2, 6, 6) != 50 ||
+	    gp_sat_variance(sat, 0, 2, 2, 6, 6) != 2500) {
+		tst_msg("Mean %f variance %f expected 50 2500",
+		        gp_sat_mean(sat, 0, 2, 2, 6, 6),
+		        gp_sat_variance(sat, 0, 2, 2, 6, 6));
+		ret = TST_FAILED;
+	}
+
+	if (gp_sat_variance(sat, 0, 3, 3, 4, 4) != 0) {
+		tst_msg("Variance of single pixel %f",
+		        gp_sat_variance(sat, 0, 3, 3, 4, 4));
+		ret = TST_FAILED;
+	}
+
+	gp_sat_free(sat);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+#define SAT_TEST(pt, w, h, inset, rad, threads, sum_bits, sqsum_bits) \
+	{.name = "SAT " #pt " " #w "x" #h " inset=" #inset " rad=" #rad \
+	         " threads=" #threads, \
+	 .tst_fn = sat, \
+	 .data = &(struct sat_test){GP_PIXEL_##pt, w, h, inset, rad, threads, \
+	                            sum_bits, sqsum_bits}}
+
+#define BOX_BLUR_TEST(pt, w, h, xrad, yrad, threads, in_place) \
+	{.name = "Box blur " #pt " " #w "x" #h " rad=" #xrad "x" #yrad \
+	         " threads=" #threads " in_place=" #in_place, \
+	 .tst_fn = box_blur, \
+	 .data = &(struct box_blur_test){GP_PIXEL_##pt, w, h, xrad, yrad, \
+	                                 threads, in_place}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Summed area table testsuite",
+	.tests = {
+		SAT_TEST(G8, 37, 23, 0, 0, 1, 32, 32),
+		SAT_TEST(RGB888, 37, 23, 0, 3, 1, 32, 32),
+		SAT_TEST(RGB888, 301, 203, 5, 5, 4, 32, 32),
+		SAT_TEST(RGB888, 301, 203, 7, 30, 3, 32, 32),
+		SAT_TEST(RGB888, 301, 203, 0, 128, 2, 32, 32),
+		SAT_TEST(RGB888, 301, 203, 3, 129, 4, 32, 64),
+		SAT_TEST(xRGB8888, 157, 93, 0, 0, 3, 32, 32),
+		SAT_TEST(RGB565, 157, 93, 3, 7, 2, 32, 32),
+		SAT_TEST(G1, 37, 23, 0, 2, 1, 32, 32),
+		SAT_TEST(G16, 157, 93, 0, 1, 4, 32, 64),
+		SAT_TEST(G16, 301, 203, 0, 128, 2, 64, 64),
+		SAT_TEST(RGB888, 1, 1, 0, 2, 1, 32, 32),
+		SAT_TEST(G8, 1100, 1000, 0, 2, 4, 32, 32),
+
+		BOX_BLUR_TEST(RGB888, 37, 23, 1, 1, 1, 0),
+		BOX_BLUR_TEST(RGB888, 157, 93, 7, 3, 4, 0),
+		BOX_BLUR_TEST(RGB888, 157, 93, 40, 60, 2, 1),
+		BOX_BLUR_TEST(G8, 37, 23, 0, 5, 1, 1),
+		BOX_BLUR_TEST(xRGB8888, 101, 67, 4, 4, 3, 0),
+		BOX_BLUR_TEST(RGB565, 101, 67, 2, 3, 1, 0),
+		BOX_BLUR_TEST(G16, 101, 67, 3, 2, 4, 0),
+
+		{.name = "SAT mean and variance",
+		 .tst_fn = variance,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = NULL},
+	}
+};
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Sigma filter tests, the result is compared against the filter computed
+  pixel by pixel for both small and large windows.
+
+ */
+
+#include <stdlib.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <core/gp_clamp.h>
+#include <core/gp_threads.h>
+#include <filters/gp_sigma.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+struct sigma_test {
+	gp_size w, h;
+	int xrad, yrad;
+	unsigned int min;
+	float sigma;
+	unsigned int threads;
+	int in_place;
+	/* Fills the image with few values so that many pixels are in sigma */
+	int flat;
+};
+
+static unsigned int ref_chan(const gp_pixmap *src, gp_coord x, gp_coord y,
+                             struct sigma_test *test, unsigned int shift)
+{
+	unsigned int s = 255 * test->sigma;
+	unsigned int cnt = (2 * test->xrad + 1) * (2 * test->yrad + 1) - 1;
+	unsigned int sum = 0, s_sum = 0, s_cnt = 0;
+	int center = (gp_getpixel_raw(src, x, y) >> shift) & 0xff;
+	gp_coord x1, y1;
+
+	for (y1 = y - test->yrad; y1 <= y + test->yrad; y1++) {
+		for (x1 = x - test->xrad; x1 <= x + test->xrad; x1++) {
+			gp_coord xi = GP_CLAMP(x1, 0, (gp_coord)src->w - 1);
+			gp_coord yi = GP_CLAMP(y1, 0, (gp_coord)src->h - 1);
+			int val = (gp_getpixel_raw(src, xi, yi) >> shift) & 0xff;
+
+			sum += val;
+
+			if ((unsigned int)abs(val - center) < s) {
+				s_sum += val;
+				s_cnt++;
+			}
+		}
+	}
+
+	if (s_cnt >= test->min)
+		return s_sum / s_cnt;
+
+	return (sum - center) / cnt;
+}
+
+static int sigma_filter(struct sigma_test *test)
+{
+	gp_pixmap *src, *res;
+	int ret = TST_FAILED;
+	gp_coord x, y;
+
+	src = gp_pixmap_alloc(test->w, test->h, GP_PIXEL_RGB888);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	if (test->flat)
+		tst_pixmap_fill_rand_range(src, 100, 40);
+	else
+		tst_pixmap_fill_rand(src);
+
+	gp_nr_threads_set(test->threads);
+
+	if (test->in_place) {
+		res = gp_pixmap_copy(src, GP_COPY_WITH_PIXELS);
+		if (res && gp_filter_sigma(res, res, test->xrad, test->yrad,
+		                           test->min, test->sigma, NULL)) {
+			gp_pixmap_free(res);
+			res = NULL;
+		}
+	} else {
+		res = gp_filter_sigma_alloc(src, test->xrad, test->yrad,
+		                            test->min, test->sigma, NULL);
+	}
+
+	if (!res) {
+		tst_msg("Sigma filter failed: %s", tst_strerr(errno));
+		goto end;
+	}
+
+	for (y = 0; y < (gp_coord)src->h; y++) {
+		for (x = 0; x < (gp_coord)src->w; x++) {
+			gp_pixel pix = GP_PIXEL_CREATE_RGB888(ref_chan(src, x, y, test, 16),
+			                                      ref_chan(src, x, y, test, 8),
+			                                      ref_chan(src, x, y, test, 0));
+
+			if (gp_getpixel_raw(res, x, y) != pix) {
+				tst_msg("Pixel %ix%i %06x expected %06x",
+				        x, y, gp_getpixel_raw(res, x, y), pix);
+				goto end1;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+end1:
+	gp_pixmap_free(res);
+end:
+	gp_nr_threads_set(1);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+#define SIGMA_TEST(w, h, xrad, yrad, min, sigma, threads, in_place, flat) \
+	{.name = "Sigma " #w "x" #h " rad=" #xrad "x" #yrad " min=" #min \
+	         " sigma=" #sigma " threads=" #threads " in_place=" #in_place \
+	         " flat=" #flat, \
+	 .tst_fn = sigma_filter, \
+	 .data = &(struct sigma_test){w, h, xrad, yrad, min, sigma, \
+	                              threads, in_place, flat}}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Sigma filter testsuite",
+	.tests = {
+		SIGMA_TEST(37, 23, 1, 1, 3, 0.1, 1, 0, 0),
+		SIGMA_TEST(37, 23, 3, 2, 4, 0.5, 1, 1, 0),
+		SIGMA_TEST(157, 93, 2, 3, 5, 0.05, 4, 0, 1),
+		SIGMA_TEST(157, 93, 5, 5, 10, 0.1, 1, 0, 1),
+		SIGMA_TEST(157, 93, 5, 5, 100, 0.1, 3, 1, 1),
+		SIGMA_TEST(157, 93, 8, 3, 5, 0.3, 4, 0, 0),
+		SIGMA_TEST(301, 97, 20, 12, 20, 0.04, 4, 1, 1),
+		SIGMA_TEST(301, 97, 12, 20, 1, 1.0, 2, 0, 0),
+		SIGMA_TEST(17, 9, 10, 10, 2, 0.02, 1, 0, 1),
+
+		{.name = NULL},
+	}
+};
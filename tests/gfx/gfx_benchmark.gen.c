@@ -0,0 +1,534 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * gfx_benchmark.gen.c
+ *
+ * GENERATED on 2026 10 18 07:52:42 from gfx_benchmark.gen.c.t
+ *
+ * DO NOT MODIFY THIS FILE DIRECTLY!
+ */
+
+#include <core/gp_pixmap.h>
+#include <gfx/gp_gfx.h>
+
+#include "tst_test.h"
+
+static int bench_line(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(800, 600, type);
+
+	if (img == NULL) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 20000; i++) {
+		gp_line(img, 0 + i % 100, 0 - i % 100,
+		        800 - i%200, 600 + i%200, i % 0xff);
+	}
+
+	return TST_SUCCESS;
+}
+
+static int bench_circle(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 10000; i++)
+		gp_circle(img, img->w/2, img->h/2, i % 1000, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_circle_seg(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 10000; i++)
+		gp_circle_seg(img, img->w/2, img->h/2, i % 1000, 0xff, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_fill_circle(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++)
+		gp_fill_circle(img, img->w/2, img->h/2, i/2, i%0xff);
+
+	return TST_SUCCESS;
+}
+
+static int bench_fill_polygon_4(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++) {
+		gp_coord poly[] = {
+			0, 0,
+			i, i,
+			i, 0,
+			0, i,
+		};
+		gp_fill_polygon(img, 4, poly, i%0xff);
+	}
+
+	return TST_SUCCESS;
+}
+
+static int bench_fill_polygon_9(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++) {
+		int s = i/8;
+		gp_coord poly[] = {
+			0, 0,
+			1*s, i,
+			2*s, 0,
+			3*s, i,
+			4*s, 0,
+			5*s, i,
+			6*s, 0,
+			7*s, i,
+			8*s, 0,
+		};
+		gp_fill_polygon(img, 9, poly, i%0xff);
+	}
+
+	return TST_SUCCESS;
+}
+
+static int bench_fill_polygon_17(gp_pixel_type type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(1000, 1000, type);
+
+	if (!img) {
+		tst_err("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	unsigned int i;
+
+	for (i = 0; i < 1000; i++) {
+		int s = i/16;
+		gp_coord poly[] = {
+			0, 0,
+			1*s, i,
+			2*s, 0,
+			3*s, i,
+			4*s, 0,
+			5*s, i,
+			6*s, 0,
+			7*s, i,
+			8*s, 0,
+			9*s, i,
+			10*s, 0,
+			11*s, i,
+			12*s, 0,
+			13*s, i,
+			14*s, 0,
+			15*s, i,
+			16*s, 0
+		};
+		gp_fill_polygon(img, 17, poly, i%0xff);
+	}
+
+	return TST_SUCCESS;
+}
+
+static int bench_line_1BPP(void)
+{
+	return bench_line(GP_PIXEL_G1);
+}
+
+static int bench_line_2BPP(void)
+{
+	return bench_line(GP_PIXEL_G2);
+}
+
+static int bench_line_4BPP(void)
+{
+	return bench_line(GP_PIXEL_G4);
+}
+
+static int bench_line_8BPP(void)
+{
+	return bench_line(GP_PIXEL_G8);
+}
+
+static int bench_line_16BPP(void)
+{
+	return bench_line(GP_PIXEL_RGB565);
+}
+
+static int bench_line_24BPP(void)
+{
+	return bench_line(GP_PIXEL_RGB888);
+}
+
+static int bench_line_32BPP(void)
+{
+	return bench_line(GP_PIXEL_xRGB8888);
+}
+
+static int bench_circle_1BPP(void)
+{
+	return bench_circle(GP_PIXEL_G1);
+}
+
+static int bench_circle_2BPP(void)
+{
+	return bench_circle(GP_PIXEL_G2);
+}
+
+static int bench_circle_4BPP(void)
+{
+	return bench_circle(GP_PIXEL_G4);
+}
+
+static int bench_circle_8BPP(void)
+{
+	return bench_circle(GP_PIXEL_G8);
+}
+
+static int bench_circle_16BPP(void)
+{
+	return bench_circle(GP_PIXEL_RGB565);
+}
+
+static int bench_circle_24BPP(void)
+{
+	return bench_circle(GP_PIXEL_RGB888);
+}
+
+static int bench_circle_32BPP(void)
+{
+	return bench_circle(GP_PIXEL_xRGB8888);
+}
+
+static int bench_circle_seg_1BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G1);
+}
+
+static int bench_circle_seg_2BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G2);
+}
+
+static int bench_circle_seg_4BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G4);
+}
+
+static int bench_circle_seg_8BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_G8);
+}
+
+static int bench_circle_seg_16BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_RGB565);
+}
+
+static int bench_circle_seg_24BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_RGB888);
+}
+
+static int bench_circle_seg_32BPP(void)
+{
+	return bench_circle_seg(GP_PIXEL_xRGB8888);
+}
+
+static int bench_fill_circle_1BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G1);
+}
+
+static int bench_fill_circle_2BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G2);
+}
+
+static int bench_fill_circle_4BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G4);
+}
+
+static int bench_fill_circle_8BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_G8);
+}
+
+static int bench_fill_circle_16BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_RGB565);
+}
+
+static int bench_fill_circle_24BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_RGB888);
+}
+
+static int bench_fill_circle_32BPP(void)
+{
+	return bench_fill_circle(GP_PIXEL_xRGB8888);
+}
+
+static int bench_fill_polygon_4_1BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_G1);
+}
+
+static int bench_fill_polygon_4_2BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_G2);
+}
+
+static int bench_fill_polygon_4_4BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_G4);
+}
+
+static int bench_fill_polygon_4_8BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_G8);
+}
+
+static int bench_fill_polygon_4_16BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_RGB565);
+}
+
+static int bench_fill_polygon_4_24BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_RGB888);
+}
+
+static int bench_fill_polygon_4_32BPP(void)
+{
+	return bench_fill_polygon_4(GP_PIXEL_xRGB8888);
+}
+
+static int bench_fill_polygon_9_1BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_G1);
+}
+
+static int bench_fill_polygon_9_2BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_G2);
+}
+
+static int bench_fill_polygon_9_4BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_G4);
+}
+
+static int bench_fill_polygon_9_8BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_G8);
+}
+
+static int bench_fill_polygon_9_16BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_RGB565);
+}
+
+static int bench_fill_polygon_9_24BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_RGB888);
+}
+
+static int bench_fill_polygon_9_32BPP(void)
+{
+	return bench_fill_polygon_9(GP_PIXEL_xRGB8888);
+}
+
+static int bench_fill_polygon_17_1BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_G1);
+}
+
+static int bench_fill_polygon_17_2BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_G2);
+}
+
+static int bench_fill_polygon_17_4BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_G4);
+}
+
+static int bench_fill_polygon_17_8BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_G8);
+}
+
+static int bench_fill_polygon_17_16BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_RGB565);
+}
+
+static int bench_fill_polygon_17_24BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_RGB888);
+}
+
+static int bench_fill_polygon_17_32BPP(void)
+{
+	return bench_fill_polygon_17(GP_PIXEL_xRGB8888);
+}
+
+
+const struct tst_suite tst_suite = {
+	.suite_name = "GFX benchmark",
+	.tests = {
+		{.name = "line 1BPP", .tst_fn = bench_line_1BPP,
+	         .bench_iter = 10},
+		{.name = "line 2BPP", .tst_fn = bench_line_2BPP,
+	         .bench_iter = 10},
+		{.name = "line 4BPP", .tst_fn = bench_line_4BPP,
+	         .bench_iter = 10},
+		{.name = "line 8BPP", .tst_fn = bench_line_8BPP,
+	         .bench_iter = 10},
+		{.name = "line 16BPP", .tst_fn = bench_line_16BPP,
+	         .bench_iter = 10},
+		{.name = "line 24BPP", .tst_fn = bench_line_24BPP,
+	         .bench_iter = 10},
+		{.name = "line 32BPP", .tst_fn = bench_line_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "circle 1BPP", .tst_fn = bench_circle_1BPP,
+	         .bench_iter = 10},
+		{.name = "circle 2BPP", .tst_fn = bench_circle_2BPP,
+	         .bench_iter = 10},
+		{.name = "circle 4BPP", .tst_fn = bench_circle_4BPP,
+	         .bench_iter = 10},
+		{.name = "circle 8BPP", .tst_fn = bench_circle_8BPP,
+	         .bench_iter = 10},
+		{.name = "circle 16BPP", .tst_fn = bench_circle_16BPP,
+	         .bench_iter = 10},
+		{.name = "circle 24BPP", .tst_fn = bench_circle_24BPP,
+	         .bench_iter = 10},
+		{.name = "circle 32BPP", .tst_fn = bench_circle_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "circle_seg 1BPP", .tst_fn = bench_circle_seg_1BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 2BPP", .tst_fn = bench_circle_seg_2BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 4BPP", .tst_fn = bench_circle_seg_4BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 8BPP", .tst_fn = bench_circle_seg_8BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 16BPP", .tst_fn = bench_circle_seg_16BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 24BPP", .tst_fn = bench_circle_seg_24BPP,
+	         .bench_iter = 10},
+		{.name = "circle_seg 32BPP", .tst_fn = bench_circle_seg_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "fill_circle 1BPP", .tst_fn = bench_fill_circle_1BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 2BPP", .tst_fn = bench_fill_circle_2BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 4BPP", .tst_fn = bench_fill_circle_4BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 8BPP", .tst_fn = bench_fill_circle_8BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 16BPP", .tst_fn = bench_fill_circle_16BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 24BPP", .tst_fn = bench_fill_circle_24BPP,
+	         .bench_iter = 10},
+		{.name = "fill_circle 32BPP", .tst_fn = bench_fill_circle_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "fill_polygon_4 1BPP", .tst_fn = bench_fill_polygon_4_1BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 2BPP", .tst_fn = bench_fill_polygon_4_2BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 4BPP", .tst_fn = bench_fill_polygon_4_4BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 8BPP", .tst_fn = bench_fill_polygon_4_8BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 16BPP", .tst_fn = bench_fill_polygon_4_16BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 24BPP", .tst_fn = bench_fill_polygon_4_24BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_4 32BPP", .tst_fn = bench_fill_polygon_4_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "fill_polygon_9 1BPP", .tst_fn = bench_fill_polygon_9_1BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 2BPP", .tst_fn = bench_fill_polygon_9_2BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 4BPP", .tst_fn = bench_fill_polygon_9_4BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 8BPP", .tst_fn = bench_fill_polygon_9_8BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 16BPP", .tst_fn = bench_fill_polygon_9_16BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 24BPP", .tst_fn = bench_fill_polygon_9_24BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_9 32BPP", .tst_fn = bench_fill_polygon_9_32BPP,
+	         .bench_iter = 10},
+
+		{.name = "fill_polygon_17 1BPP", .tst_fn = bench_fill_polygon_17_1BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 2BPP", .tst_fn = bench_fill_polygon_17_2BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 4BPP", .tst_fn = bench_fill_polygon_17_4BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 8BPP", .tst_fn = bench_fill_polygon_17_8BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 16BPP", .tst_fn = bench_fill_polygon_17_16BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 24BPP", .tst_fn = bench_fill_polygon_17_24BPP,
+	         .bench_iter = 10},
+		{.name = "fill_polygon_17 32BPP", .tst_fn = bench_fill_polygon_17_32BPP,
+	         .bench_iter = 10},
+
+
+		{.name = NULL},
+	}
+};
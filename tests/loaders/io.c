@@ -3,6 +3,7 @@
  * Copyright (C) 2009-2014 Cyril Hrubis <metan@ucw.cz>
  */
 
+#include <stdlib.h>
 #include <string.h>
 #include <errno.h>
 
@@ -295,6 +296,216 @@ static int test_IOFile(void)
 	return TST_SUCCESS;
 }
 
+static int test_IOMmap(void)
+{
+	uint8_t buffer[128];
+	unsigned int i;
+	int ret;
+	gp_io *io;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	io = gp_io_file(TFILE, GP_IO_WRONLY);
+
+	if (!io) {
+		tst_msg("Failed to open file I/O for writing: %s",
+		        strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_io_flush(io, buffer, sizeof(buffer))) {
+		tst_msg("Failed to write: %s", strerror(errno));
+		gp_io_close(io);
+		return TST_FAILED;
+	}
+
+	if (gp_io_close(io)) {
+		tst_msg("Failed to close file I/O: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	io = gp_io_mmap(TFILE);
+
+	if (!io) {
+		tst_msg("Failed to mmap file: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	ret = do_test(io, sizeof(buffer), 0);
+	if (ret) {
+		gp_io_close(io);
+		return ret;
+	}
+
+	if (gp_io_close(io)) {
+		tst_msg("Failed to close mmap I/O: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int test_IOMmap_dir(void)
+{
+	gp_io *io = gp_io_mmap(".");
+
+	if (io) {
+		tst_msg("Mapped a directory");
+		gp_io_close(io);
+		return TST_FAILED;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s expected EINVAL", tst_strerr(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int check_map(gp_io *io, size_t size, int exp_start, off_t exp_off)
+{
+	const uint8_t *ptr = gp_io_map(io, size);
+	off_t off;
+
+	if (exp_start < 0) {
+		if (ptr) {
+			tst_msg("Mapped %zu bytes unexpectedly", size);
+			return 1;
+		}
+
+		if (errno != EIO) {
+			tst_msg("Wrong errno %s expected EIO",
+			        tst_strerr(errno));
+			return 1;
+		}
+	} else {
+		if (!ptr) {
+			tst_msg("Failed to map %zu bytes: %s",
+			        size, tst_strerr(errno));
+			return 1;
+		}
+
+		if (ptr[0] != exp_start || ptr[size-1] != exp_start + size - 1) {
+			tst_msg("Mapped wrong data %u expected %i",
+			        ptr[0], exp_start);
+			return 1;
+		}
+	}
+
+	off = gp_io_tell(io);
+
+	if (off != exp_off) {
+		tst_msg("Wrong offset %zi expected %zi",
+		        (ssize_t)off, (ssize_t)exp_off);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int test_IOMap(void)
+{
+	uint8_t buffer[128];
+	gp_io *io, *pio;
+	unsigned int i;
+	int fail = 0;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	pio = gp_io_mem(buffer, sizeof(buffer), NULL);
+
+	if (!pio) {
+		tst_msg("Failed to initialize memory I/O");
+		return TST_FAILED;
+	}
+
+	fail += check_map(pio, 10, 0, 10);
+	fail += check_map(pio, 100, 10, 110);
+	fail += check_map(pio, 19, -1, 110);
+	fail += check_map(pio, 18, 110, 128);
+
+	gp_io_seek(pio, 10, GP_SEEK_SET);
+
+	io = gp_io_sub_io(pio, 100);
+
+	if (!io) {
+		tst_msg("Failed to initialize sub I/O");
+		gp_io_close(pio);
+		return TST_FAILED;
+	}
+
+	fail += check_map(io, 50, 10, 50);
+	fail += check_map(io, 51, -1, 50);
+	fail += check_map(io, 50, 60, 100);
+
+	gp_io_close(io);
+	gp_io_close(pio);
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
+static int test_IOMap_file(void)
+{
+	gp_io *io = gp_io_file(TFILE, GP_IO_WRONLY);
+	int ret = TST_SUCCESS;
+
+	if (!io) {
+		tst_msg("Failed to open file I/O: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (gp_io_map(io, 1)) {
+		tst_msg("Mapped file I/O");
+		ret = TST_FAILED;
+	} else if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s expected ENOSYS", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+	gp_io_close(io);
+
+	return ret;
+}
+
+static ssize_t app_read(gp_io GP_UNUSED(*self), void GP_UNUSED(*buf),
+                        size_t GP_UNUSED(size))
+{
+	return 0;
+}
+
+static int test_IOMap_app(void)
+{
+	gp_io *io = malloc(sizeof(gp_io));
+	int ret = TST_SUCCESS;
+
+	if (!io) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	/* I/O implemented by an application that does not know about map */
+	memset(io, 0xff, sizeof(gp_io));
+	io->read = app_read;
+
+	if (gp_io_map(io, 1)) {
+		tst_msg("Mapped application I/O");
+		ret = TST_FAILED;
+	} else if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s expected ENOSYS", tst_strerr(errno));
+		ret = TST_FAILED;
+	}
+
+	free(io);
+
+	return ret;
+}
+
 static int test_IOSubIO(void)
 {
 	uint8_t buffer[128];
@@ -366,6 +577,110 @@ failed:
 	return TST_FAILED;
 }
 
+static int test_IORBuffer(void)
+{
+	uint8_t buffer[128];
+	unsigned int i;
+	gp_io *io, *pio;
+	int ret;
+
+	for (i = 0; i < sizeof(buffer); i++)
+		buffer[i] = i;
+
+	pio = gp_io_mem(buffer, sizeof(buffer), NULL);
+
+	if (!pio) {
+		tst_msg("Failed to initialize memory I/O");
+		return TST_FAILED;
+	}
+
+	/* Small buffer so that the reads cross the blocks */
+	io = gp_io_rbuffer(pio, 16);
+
+	if (!io) {
+		tst_msg("Failed to initialize buffered I/O");
+		gp_io_close(pio);
+		return TST_FAILED;
+	}
+
+	ret = do_test(io, sizeof(buffer), 0);
+
+	gp_io_close(io);
+	gp_io_close(pio);
+
+	return ret;
+}
+
+static unsigned int parent_reads;
+
+/* Endless stream that counts the reads */
+static ssize_t count_read(gp_io GP_UNUSED(*io), void GP_UNUSED(*buf),
+                          size_t size)
+{
+	parent_reads++;
+	return size;
+}
+
+static off_t count_seek(gp_io GP_UNUSED(*io), off_t off,
+                        enum gp_seek_whence GP_UNUSED(whence))
+{
+	return off;
+}
+
+static int test_IORBuffer_reads(void)
+{
+	gp_io pio = {.read = count_read, .seek = count_seek};
+	uint8_t buf[1024];
+	unsigned int i;
+	int fail = 0;
+	gp_io *io;
+
+	io = gp_io_rbuffer(&pio, 512);
+	if (!io)
+		return TST_FAILED;
+
+	parent_reads = 0;
+
+	for (i = 0; i < 1024; i++)
+		gp_io_read(io, buf, 2);
+
+	if (parent_reads != 4) {
+		tst_msg("Small reads: parent read %u times expected 4",
+		        parent_reads);
+		fail++;
+	}
+
+	parent_reads = 0;
+
+	/* Seek in the buffer is served without the parent */
+	gp_io_seek(io, -100, GP_SEEK_CUR);
+	gp_io_read(io, buf, 100);
+
+	if (parent_reads) {
+		tst_msg("Seek in the buffer read the parent");
+		fail++;
+	}
+
+	/* Large read bypasses the buffer */
+	if (gp_io_read(io, buf, 1024) != 1024) {
+		tst_msg("Large read failed");
+		fail++;
+	}
+
+	if (parent_reads != 1) {
+		tst_msg("Large read: parent read %u times expected 1",
+		        parent_reads);
+		fail++;
+	}
+
+	gp_io_close(io);
+
+	if (fail)
+		return TST_FAILED;
+
+	return TST_SUCCESS;
+}
+
 static ssize_t test_IOFill_read(gp_io GP_UNUSED(*io), void *buf, size_t size)
 {
 	ssize_t ret = GP_MIN(7u, size);
@@ -546,6 +861,32 @@ const struct tst_suite tst_suite = {
 		 .tst_fn = test_IOFile,
 		 .flags = TST_CHECK_MALLOC | TST_TMPDIR},
 
+		{.name = "IOMmap",
+		 .tst_fn = test_IOMmap,
+		 .flags = TST_CHECK_MALLOC | TST_TMPDIR},
+
+		{.name = "IOMmap directory",
+		 .tst_fn = test_IOMmap_dir,
+		 .flags = TST_TMPDIR},
+
+		{.name = "IOMap",
+		 .tst_fn = test_IOMap,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "IOMap file",
+		 .tst_fn = test_IOMap_file,
+		 .flags = TST_TMPDIR},
+
+		{.name = "IOMap application I/O",
+		 .tst_fn = test_IOMap_app},
+
+		{.name = "IORBuffer",
+		 .tst_fn = test_IORBuffer,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "IORBuffer reads",
+		 .tst_fn = test_IORBuffer_reads},
+
 		{.name = "IOFill",
 		 .tst_fn = test_IOFill},
 
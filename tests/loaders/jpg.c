@@ -75,6 +75,58 @@ static int test_save_jpg(gp_pixel_type pixel_type)
 	}
 }
 
+struct scaled_test {
+	gp_size w, h;
+	gp_size exp_w, exp_h;
+};
+
+static int test_load_jpg_scaled(struct scaled_test *test)
+{
+	gp_pixmap *pixmap, *img = NULL;
+	int ret = TST_SUCCESS;
+
+	pixmap = gp_pixmap_alloc(400, 300, GP_PIXEL_BGR888);
+
+	if (!pixmap) {
+		tst_msg("Failed to allocate pixmap");
+		return TST_UNTESTED;
+	}
+
+	if (gp_save_jpg(pixmap, "test.jpg", NULL)) {
+		if (errno == ENOSYS) {
+			tst_msg("Not Implemented");
+			ret = TST_SKIPPED;
+		} else {
+			tst_msg("Failed to save JPEG: %s", strerror(errno));
+			ret = TST_UNTESTED;
+		}
+		goto end;
+	}
+
+	if (gp_load_image_scaled("test.jpg", &img, NULL, test->w, test->h, NULL)) {
+		tst_msg("Failed to load JPEG: %s", strerror(errno));
+		ret = TST_FAILED;
+		goto end;
+	}
+
+	if (img->w != test->exp_w || img->h != test->exp_h) {
+		tst_msg("Loaded image %ux%u expected %ux%u",
+		        img->w, img->h, test->exp_w, test->exp_h);
+		ret = TST_FAILED;
+	}
+
+end:
+	gp_pixmap_free(pixmap);
+	gp_pixmap_free(img);
+	return ret;
+}
+
+#define SCALED_TEST(w, h, exp_w, exp_h) \
+	{.name = "JPEG Load 400x300 scaled to fit " #w "x" #h, \
+	 .tst_fn = test_load_jpg_scaled, \
+	 .data = &(struct scaled_test){w, h, exp_w, exp_h}, \
+	 .flags = TST_TMPDIR | TST_CHECK_MALLOC}
+
 const struct tst_suite tst_suite = {
 	.suite_name = "JPEG",
 	.tests = {
@@ -103,6 +155,15 @@ const struct tst_suite tst_suite = {
 		 .data = "100x100-grayscale-black.jpeg",
 		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
 
+		/* JPEG shrink on load tests */
+		SCALED_TEST(0, 0, 400, 300),
+		SCALED_TEST(100, 0, 100, 75),
+		SCALED_TEST(0, 75, 100, 75),
+		SCALED_TEST(50, 50, 50, 38),
+		SCALED_TEST(199, 199, 200, 150),
+		SCALED_TEST(800, 150, 200, 150),
+		SCALED_TEST(0, 200, 400, 300),
+
 		/* JPEG save tests */
 		{.name = "JPEG Save 100x100 G8",
 		 .tst_fn = test_save_jpg,
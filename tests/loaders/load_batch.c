@@ -0,0 +1,241 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Batch loader tests, the images are saved with distinct sizes so that the
+  results can be matched to the queued files.
+
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+
+#define IMAGES 16
+
+struct batch_test {
+	unsigned int threads;
+	size_t max_bytes;
+	int flags;
+	int use_io;
+	/* Index of a file that does not exist or -1 */
+	int missing;
+};
+
+static void img_path(char *buf, size_t size, int i)
+{
+	snprintf(buf, size, "img%02i.ppm", i);
+}
+
+static int save_images(void)
+{
+	char path[32];
+	int i;
+
+	for (i = 0; i < IMAGES; i++) {
+		gp_pixmap *img = gp_pixmap_alloc(10 + i, 20 + 3 * i,
+		                                 GP_PIXEL_RGB888);
+
+		if (!img)
+			return 1;
+
+		img_path(path, sizeof(path), i);
+
+		if (gp_save_ppm(img, path, NULL)) {
+			gp_pixmap_free(img);
+			return 1;
+		}
+
+		gp_pixmap_free(img);
+	}
+
+	return 0;
+}
+
+static int check_res(struct batch_test *test, struct gp_load_batch_res *res)
+{
+	int i = (long)res->priv;
+
+	if ((size_t)i != res->idx) {
+		tst_msg("Wrong priv %i for image %zu", i, res->idx);
+		return 1;
+	}
+
+	if (i == test->missing) {
+		if (res->img || res->err != ENOENT) {
+			tst_msg("Missing image %i loaded or wrong errno %s",
+			        i, strerror(res->err));
+			return 1;
+		}
+
+		return 0;
+	}
+
+	if (!res->img) {
+		tst_msg("Failed to load image %i: %s", i, strerror(res->err));
+		return 1;
+	}
+
+	if (res->img->w != 10u + i || res->img->h != 20u + 3 * i) {
+		tst_msg("Image %i has wrong size %ux%u",
+		        i, res->img->w, res->img->h);
+		return 1;
+	}
+
+	return 0;
+}
+
+static int load_batch(struct batch_test *test)
+{
+	gp_io *io[IMAGES] = {};
+	unsigned int seen[IMAGES] = {};
+	struct gp_load_batch_res res;
+	gp_load_batch *batch;
+	int ret = TST_SUCCESS;
+	char path[32];
+	size_t cnt = 0;
+	int i;
+
+	if (save_images()) {
+		tst_msg("Failed to save images: %s", strerror(errno));
+		return TST_UNTESTED;
+	}
+
+	batch = gp_load_batch_create(test->threads, test->max_bytes, test->flags);
+	if (!batch) {
+		tst_msg("Failed to create batch loader: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < IMAGES; i++) {
+		int err;
+
+		img_path(path, sizeof(path), i == test->missing ? 99 : i);
+
+		if (test->use_io) {
+			io[i] = gp_io_file(path, GP_IO_RDONLY);
+			if (!io[i]) {
+				tst_msg("Failed to open '%s'", path);
+				ret = TST_UNTESTED;
+				goto end;
+			}
+			err = gp_load_batch_add_io(batch, io[i], (void*)(long)i);
+		} else {
+			err = gp_load_batch_add(batch, path, (void*)(long)i);
+		}
+
+		if (err) {
+			tst_msg("Failed to add image: %s", strerror(errno));
+			ret = TST_FAILED;
+			goto end;
+		}
+	}
+
+	while (!gp_load_batch_get(batch, &res)) {
+		if (test->flags & GP_LOAD_BATCH_ORDERED && res.idx != cnt) {
+			tst_msg("Got image %zu expected %zu", res.idx, cnt);
+			ret = TST_FAILED;
+		}
+
+		if (check_res(test, &res))
+			ret = TST_FAILED;
+
+		if (res.idx < IMAGES)
+			seen[res.idx]++;
+
+		gp_pixmap_free(res.img);
+		cnt++;
+	}
+
+	if (errno != ENOENT) {
+		tst_msg("Wrong errno at the end %s", strerror(errno));
+		ret = TST_FAILED;
+	}
+
+	for (i = 0; i < IMAGES; i++) {
+		if (seen[i] != 1) {
+			tst_msg("Image %i returned %u times", i, seen[i]);
+			ret = TST_FAILED;
+		}
+	}
+
+end:
+	gp_load_batch_free(batch);
+
+	for (i = 0; i < IMAGES; i++) {
+		if (io[i])
+			gp_io_close(io[i]);
+	}
+
+	return ret;
+}
+
+static int load_batch_free(void)
+{
+	struct gp_load_batch_res res;
+	gp_load_batch *batch;
+	char path[32];
+	int i;
+
+	if (save_images()) {
+		tst_msg("Failed to save images: %s", strerror(errno));
+		return TST_UNTESTED;
+	}
+
+	batch = gp_load_batch_create(2, 0, 0);
+	if (!batch) {
+		tst_msg("Failed to create batch loader: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < IMAGES; i++) {
+		img_path(path, sizeof(path), i);
+		gp_load_batch_add(batch, path, NULL);
+	}
+
+	if (gp_load_batch_get(batch, &res)) {
+		tst_msg("Failed to get image: %s", strerror(errno));
+		gp_load_batch_free(batch);
+		return TST_FAILED;
+	}
+
+	gp_pixmap_free(res.img);
+
+	/* Frees the rest of the images */
+	gp_load_batch_free(batch);
+
+	return TST_SUCCESS;
+}
+
+#define BATCH_TEST(desc, threads, max_bytes, batch_flags, use_io, missing) \
+	{.name = "Batch load " desc, \
+	 .tst_fn = load_batch, \
+	 .data = &(struct batch_test){threads, max_bytes, batch_flags, use_io, missing}, \
+	 .flags = TST_TMPDIR}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Batch loader testsuite",
+	.tests = {
+		BATCH_TEST("ordered 1 thread", 1, 0, GP_LOAD_BATCH_ORDERED, 0, -1),
+		BATCH_TEST("ordered 4 threads", 4, 0, GP_LOAD_BATCH_ORDERED, 0, -1),
+		BATCH_TEST("completed 3 threads", 3, 0, 0, 0, -1),
+		BATCH_TEST("ordered 3 threads budget 1B", 3, 1, GP_LOAD_BATCH_ORDERED, 0, -1),
+		BATCH_TEST("completed 4 threads budget 4kB", 4, 4096, 0, 0, -1),
+		BATCH_TEST("ordered io 2 threads", 2, 0, GP_LOAD_BATCH_ORDERED, 1, -1),
+		BATCH_TEST("completed io 3 threads", 3, 8192, 0, 1, -1),
+		BATCH_TEST("ordered missing file", 2, 0, GP_LOAD_BATCH_ORDERED, 0, 5),
+		BATCH_TEST("completed missing file", 3, 0, 0, 0, 0),
+		{.name = "Batch load free with pending images",
+		 .tst_fn = load_batch_free,
+		 .flags = TST_TMPDIR},
+		{.name = NULL},
+	}
+};
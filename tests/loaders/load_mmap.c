@@ -0,0 +1,324 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Tests for loading uncompressed images mapped directly from a file.
+
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+
+#define W 13
+#define H 7
+
+static uint8_t val(unsigned int x, unsigned int y, unsigned int c)
+{
+	return 3 * x + 37 * y + 101 * c;
+}
+
+/*
+ * Writes a raw PGM (chans = 1) or PPM (chans = 3), rows is the number of
+ * rows actually written.
+ */
+static int write_pnm(const char *path, unsigned int chans, unsigned int rows)
+{
+	FILE *f = fopen(path, "wb");
+	unsigned int x, y, c;
+
+	if (!f)
+		return 1;
+
+	fprintf(f, "P%c\n# comment\n%u %u\n255\n", chans == 1 ? '5' : '6', W, H);
+
+	for (y = 0; y < rows; y++) {
+		for (x = 0; x < W; x++) {
+			for (c = 0; c < chans; c++)
+				fputc(val(x, y, c), f);
+		}
+	}
+
+	return fclose(f);
+}
+
+static gp_pixel exp_pixel(gp_pixel_type type, unsigned int x, unsigned int y)
+{
+	switch (type) {
+	case GP_PIXEL_G8:
+		return val(x, y, 0);
+	case GP_PIXEL_BGR888:
+		return GP_PIXEL_CREATE_BGR888(val(x, y, 2), val(x, y, 1),
+		                              val(x, y, 0));
+	default:
+		return 0;
+	}
+}
+
+static int check_pixels(gp_pixmap *img)
+{
+	unsigned int x, y;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel p = gp_getpixel(img, x, y);
+			gp_pixel e = exp_pixel(img->pixel_type, x, y);
+
+			if (p != e) {
+				tst_msg("Pixel %ux%u %06x expected %06x",
+				        x, y, p, e);
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int load_pnm(unsigned int chans)
+{
+	gp_pixel_type type = chans == 1 ? GP_PIXEL_G8 : GP_PIXEL_BGR888;
+	const char *path = "test.pnm";
+	gp_pixmap *img;
+
+	if (write_pnm(path, chans, H)) {
+		tst_msg("Failed to write image: %s", strerror(errno));
+		return TST_UNTESTED;
+	}
+
+	img = gp_load_image_mmap(path, NULL);
+	if (!img) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (!img->unmap_pixels || img->free_pixels) {
+		tst_msg("Image pixels were not mapped");
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	if (img->pixel_type != type || img->w != W || img->h != H) {
+		tst_msg("Wrong image %ux%u %s", img->w, img->h,
+		        gp_pixel_type_name(img->pixel_type));
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	if (check_pixels(img)) {
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	/* Writes must not propagate to the file */
+	gp_putpixel(img, 0, 0, ~exp_pixel(type, 0, 0));
+	gp_pixmap_free(img);
+
+	img = gp_load_image_mmap(path, NULL);
+	if (!img) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (check_pixels(img)) {
+		tst_msg("Pixel write was written back to the file");
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	gp_pixmap_free(img);
+
+	return TST_SUCCESS;
+}
+
+static int load_pgm(void)
+{
+	return load_pnm(1);
+}
+
+static int load_ppm(void)
+{
+	return load_pnm(3);
+}
+
+static int load_bmp(void)
+{
+	gp_pixmap *src, *img;
+	unsigned int x, y;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(W, H, GP_PIXEL_RGB888);
+	if (!src)
+		return TST_UNTESTED;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_putpixel(src, x, y,
+			            GP_PIXEL_CREATE_RGB888(val(x, y, 0),
+			                                   val(x, y, 1),
+			                                   val(x, y, 2)));
+		}
+	}
+
+	if (gp_save_bmp(src, "test.bmp", NULL)) {
+		tst_msg("Failed to save BMP: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	img = gp_load_image_mmap("test.bmp", NULL);
+	if (!img) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	if (!img->unmap_pixels || !img->y_swap) {
+		tst_msg("Image not mapped or not bottom-up");
+		ret = TST_FAILED;
+		goto end;
+	}
+
+	/* Rows are four byte aligned in BMP */
+	if (img->bytes_per_row != 40) {
+		tst_msg("Wrong bytes_per_row %u", img->bytes_per_row);
+		ret = TST_FAILED;
+		goto end;
+	}
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel p = gp_getpixel(img, x, y);
+			gp_pixel e = gp_getpixel(src, x, y);
+
+			if (p != e) {
+				tst_msg("Pixel %ux%u %06x expected %06x",
+				        x, y, p, e);
+				ret = TST_FAILED;
+				goto end;
+			}
+		}
+	}
+
+end:
+	gp_pixmap_free(img);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int load_fallback(void)
+{
+	gp_pixmap *src, *img;
+	int ret = TST_SUCCESS;
+
+	src = gp_pixmap_alloc(W, H, GP_PIXEL_RGB888);
+	if (!src)
+		return TST_UNTESTED;
+
+	gp_putpixel(src, 1, 1, 0x123456);
+
+	/* PPM is saved as ASCII which cannot be mapped */
+	if (gp_save_ppm(src, "test.ppm", NULL)) {
+		tst_msg("Failed to save PPM: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	img = gp_load_image_mmap("test.ppm", NULL);
+	if (!img) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	if (img->unmap_pixels || !img->free_pixels) {
+		tst_msg("ASCII image was mapped");
+		ret = TST_FAILED;
+	}
+
+	if (gp_getpixel(img, 1, 1) != 0x123456) {
+		tst_msg("Wrong pixel value");
+		ret = TST_FAILED;
+	}
+
+	gp_pixmap_free(img);
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int load_truncated(void)
+{
+	gp_pixmap *img;
+
+	if (write_pnm("test.pgm", 1, H - 1)) {
+		tst_msg("Failed to write image: %s", strerror(errno));
+		return TST_UNTESTED;
+	}
+
+	img = gp_load_image_mmap("test.pgm", NULL);
+	if (img) {
+		tst_msg("Truncated image loaded");
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int load_missing(void)
+{
+	gp_pixmap *img = gp_load_image_mmap("missing.pgm", NULL);
+
+	if (img) {
+		tst_msg("Missing image loaded");
+		gp_pixmap_free(img);
+		return TST_FAILED;
+	}
+
+	if (errno != ENOENT) {
+		tst_msg("Wrong errno %s expected ENOENT", strerror(errno));
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Mapped loader testsuite",
+	.tests = {
+		{.name = "Map raw PGM",
+		 .tst_fn = load_pgm,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Map raw PPM",
+		 .tst_fn = load_ppm,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Map 24bpp BMP",
+		 .tst_fn = load_bmp,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Map fallback ASCII PPM",
+		 .tst_fn = load_fallback,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Map truncated PGM",
+		 .tst_fn = load_truncated,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Map missing file",
+		 .tst_fn = load_missing,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
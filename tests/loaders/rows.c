@@ -0,0 +1,393 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+ * Copyright (C) 2009-2021 Cyril Hrubis <metan@ucw.cz>
+ */
+
+/*
+
+  Tests for the streaming row by row reader and writer.
+
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include <core/gp_pixmap.h>
+#include <core/gp_get_put_pixel.h>
+#include <loaders/gp_loaders.h>
+
+#include "tst_test.h"
+#include "tst_pixmap.h"
+
+#define W 37
+#define H 23
+
+struct rows_test {
+	const char *path;
+	gp_pixel_type pixel_type;
+	/* The written pixels are not preserved exactly */
+	int lossy;
+};
+
+static gp_pixmap *create_pixmap(gp_pixel_type pixel_type)
+{
+	gp_pixmap *img = gp_pixmap_alloc(W, H, pixel_type);
+	unsigned int bpp = gp_pixel_size(pixel_type);
+	gp_pixel mask = bpp < 32 ? (1u << bpp) - 1 : 0xffffffff;
+	unsigned int x, y;
+
+	if (!img)
+		return NULL;
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++)
+			gp_putpixel(img, x, y, (x * 0x030507 + y * 0x110d0b) & mask);
+	}
+
+	return img;
+}
+
+static int write_rows(const char *path, gp_pixmap *src, gp_size band)
+{
+	gp_row_writer *writer;
+	gp_pixmap rows;
+	gp_size y;
+
+	writer = gp_row_writer_open(path, src->w, src->h, src->pixel_type);
+	if (!writer) {
+		tst_msg("Failed to open writer: %s", strerror(errno));
+		return 1;
+	}
+
+	for (y = 0; y < src->h; y += band) {
+		gp_sub_pixmap(src, &rows, 0, y, src->w, GP_MIN(band, src->h - y));
+
+		if (gp_row_writer_write(writer, &rows)) {
+			tst_msg("Failed to write rows: %s", strerror(errno));
+			gp_row_writer_close(writer);
+			return 1;
+		}
+	}
+
+	if (gp_row_writer_close(writer)) {
+		tst_msg("Failed to close writer: %s", strerror(errno));
+		return 1;
+	}
+
+	return 0;
+}
+
+static gp_pixmap *read_rows(const char *path, gp_size band)
+{
+	gp_pixmap *res, *rows = NULL;
+	gp_row_reader *reader;
+	gp_size y = 0;
+	int cnt;
+
+	reader = gp_row_reader_open(path);
+	if (!reader) {
+		tst_msg("Failed to open reader: %s", strerror(errno));
+		return NULL;
+	}
+
+	res = gp_pixmap_alloc(reader->w, reader->h, reader->pixel_type);
+	rows = gp_pixmap_alloc(reader->w, band, reader->pixel_type);
+	if (!res || !rows) {
+		tst_msg("Malloc failed");
+		goto err;
+	}
+
+	while ((cnt = gp_row_reader_read(reader, rows)) > 0) {
+		memcpy(GP_PIXEL_ADDR(res, 0, y), rows->pixels,
+		       cnt * rows->bytes_per_row);
+		y += cnt;
+	}
+
+	if (cnt < 0) {
+		tst_msg("Failed to read rows: %s", strerror(errno));
+		goto err;
+	}
+
+	if (y != res->h) {
+		tst_msg("Read %u rows expected %u", y, res->h);
+		goto err;
+	}
+
+	gp_pixmap_free(rows);
+	gp_row_reader_close(reader);
+	return res;
+err:
+	gp_pixmap_free(rows);
+	gp_pixmap_free(res);
+	gp_row_reader_close(reader);
+	return NULL;
+}
+
+static int round_trip(struct rows_test *test)
+{
+	gp_pixmap *src, *ref = NULL, *res = NULL;
+	int ret = TST_FAILED;
+
+	src = create_pixmap(test->pixel_type);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	if (write_rows(test->path, src, 5))
+		goto end;
+
+	ref = gp_load_image(test->path, NULL);
+	if (!ref) {
+		tst_msg("Failed to load image: %s", strerror(errno));
+		goto end;
+	}
+
+	if (!test->lossy && tst_pixmap_cmp(src, ref))
+		goto end;
+
+	res = read_rows(test->path, 4);
+	if (!res)
+		goto end;
+
+	if (tst_pixmap_cmp(ref, res))
+		goto end;
+
+	ret = TST_SUCCESS;
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(ref);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int read_bottom_up_bmp(void)
+{
+	gp_pixmap *src, *res;
+	int ret = TST_FAILED;
+
+	src = create_pixmap(GP_PIXEL_RGB888);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	/* The regular BMP writer saves the rows bottom-up */
+	if (gp_save_image(src, "test.bmp", NULL)) {
+		tst_msg("Failed to save image: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	res = read_rows("test.bmp", 3);
+
+	if (res && !tst_pixmap_cmp(src, res))
+		ret = TST_SUCCESS;
+
+	gp_pixmap_free(src);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int write_convert(void)
+{
+	gp_pixmap *src, *res;
+	unsigned int x, y;
+	int ret = TST_FAILED;
+
+	src = create_pixmap(GP_PIXEL_BGR888);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	/* BMP saves only RGB888, the rows are converted */
+	if (write_rows("test.bmp", src, 7)) {
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	res = read_rows("test.bmp", 16);
+	if (!res)
+		goto end;
+
+	if (res->pixel_type != GP_PIXEL_RGB888) {
+		tst_msg("Wrong pixel type %s", gp_pixel_type_name(res->pixel_type));
+		goto end;
+	}
+
+	for (y = 0; y < H; y++) {
+		for (x = 0; x < W; x++) {
+			gp_pixel s = gp_getpixel(src, x, y);
+			gp_pixel r = gp_getpixel(res, x, y);
+			gp_pixel e = GP_PIXEL_CREATE_RGB888(GP_PIXEL_GET_R_BGR888(s),
+			                                    GP_PIXEL_GET_G_BGR888(s),
+			                                    GP_PIXEL_GET_B_BGR888(s));
+
+			if (r != e) {
+				tst_msg("Pixel %ux%u %06x expected %06x",
+				        x, y, r, e);
+				goto end;
+			}
+		}
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_pixmap_free(src);
+	gp_pixmap_free(res);
+	return ret;
+}
+
+static int write_incomplete(void)
+{
+	gp_row_writer *writer;
+	gp_pixmap *src, rows;
+	int ret = TST_FAILED;
+
+	src = create_pixmap(GP_PIXEL_G8);
+	if (!src) {
+		tst_msg("Malloc failed");
+		return TST_UNTESTED;
+	}
+
+	writer = gp_row_writer_open("test.png", W, H, GP_PIXEL_G8);
+	if (!writer) {
+		tst_msg("Failed to open writer: %s", strerror(errno));
+		gp_pixmap_free(src);
+		return TST_FAILED;
+	}
+
+	gp_sub_pixmap(src, &rows, 0, 0, W, 3);
+
+	if (gp_row_writer_write(writer, &rows)) {
+		tst_msg("Failed to write rows: %s", strerror(errno));
+		gp_row_writer_close(writer);
+		goto end;
+	}
+
+	if (!gp_row_writer_close(writer)) {
+		tst_msg("Closing incomplete image succeeded");
+		goto end;
+	}
+
+	if (errno != EINVAL) {
+		tst_msg("Wrong errno %s", strerror(errno));
+		goto end;
+	}
+
+	if (!access("test.png", F_OK)) {
+		tst_msg("Incomplete file was not removed");
+		goto end;
+	}
+
+	ret = TST_SUCCESS;
+end:
+	gp_pixmap_free(src);
+	return ret;
+}
+
+static int write_unsupported(void)
+{
+	gp_row_writer *writer;
+
+	writer = gp_row_writer_open("test.pgm", W, H, GP_PIXEL_RGB888);
+	if (writer) {
+		tst_msg("Opened PGM writer for RGB888");
+		gp_row_writer_close(writer);
+		return TST_FAILED;
+	}
+
+	if (errno != ENOSYS) {
+		tst_msg("Wrong errno %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	if (!access("test.pgm", F_OK)) {
+		tst_msg("File was not removed");
+		return TST_FAILED;
+	}
+
+	return TST_SUCCESS;
+}
+
+static int read_wrong_width(void)
+{
+	gp_row_reader *reader;
+	gp_pixmap *src, *rows;
+	int ret = TST_FAILED;
+
+	src = create_pixmap(GP_PIXEL_RGB888);
+	if (!src || gp_save_image(src, "test.ppm", NULL)) {
+		tst_msg("Failed to save image");
+		gp_pixmap_free(src);
+		return TST_UNTESTED;
+	}
+
+	gp_pixmap_free(src);
+
+	reader = gp_row_reader_open("test.ppm");
+	if (!reader) {
+		tst_msg("Failed to open reader: %s", strerror(errno));
+		return TST_FAILED;
+	}
+
+	rows = gp_pixmap_alloc(W + 1, 1, GP_PIXEL_RGB888);
+	if (!rows) {
+		gp_row_reader_close(reader);
+		return TST_UNTESTED;
+	}
+
+	if (gp_row_reader_read(reader, rows) != -1 || errno != EINVAL)
+		tst_msg("Read into wrong width pixmap did not fail with EINVAL");
+	else
+		ret = TST_SUCCESS;
+
+	gp_pixmap_free(rows);
+	gp_row_reader_close(reader);
+	return ret;
+}
+
+#define ROWS_TEST(fname, ptype, is_lossy) \
+	{.name = "Rows round trip " fname " " #ptype, \
+	 .tst_fn = round_trip, \
+	 .data = &(struct rows_test){fname, ptype, is_lossy}, \
+	 .flags = TST_TMPDIR | TST_CHECK_MALLOC}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "Row reader and writer testsuite",
+	.tests = {
+		ROWS_TEST("test.png", GP_PIXEL_RGB888, 0),
+		ROWS_TEST("test.png", GP_PIXEL_G8, 0),
+		ROWS_TEST("test.png", GP_PIXEL_RGBA8888, 0),
+		ROWS_TEST("test.jpg", GP_PIXEL_G8, 1),
+		ROWS_TEST("test.jpg", GP_PIXEL_BGR888, 1),
+		ROWS_TEST("test.ppm", GP_PIXEL_RGB888, 0),
+		ROWS_TEST("test.pgm", GP_PIXEL_G8, 0),
+		ROWS_TEST("test.bmp", GP_PIXEL_RGB888, 0),
+
+		{.name = "Rows read bottom-up BMP",
+		 .tst_fn = read_bottom_up_bmp,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Rows write converted BMP",
+		 .tst_fn = write_convert,
+		 .flags = TST_TMPDIR},
+
+		{.name = "Rows write incomplete image",
+		 .tst_fn = write_incomplete,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "Rows write unsupported pixel type",
+		 .tst_fn = write_unsupported,
+		 .flags = TST_TMPDIR | TST_CHECK_MALLOC},
+
+		{.name = "Rows read wrong width",
+		 .tst_fn = read_wrong_width,
+		 .flags = TST_TMPDIR},
+
+		{.name = NULL},
+	}
+};
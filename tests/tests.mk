@@ -1,10 +1,11 @@
 # Constants for tests build
 
-LDFLAGS+=-L../framework/ -L$(TOPDIR)/build/
+LDFLAGS+=-L../framework/ -L../common/ -L$(TOPDIR)/build/
+LDLIBS+=-ltst_common
 LDLIBS+=$(shell $(TOPDIR)/gfxprim-config --libs --libs-loaders)
 LDLIBS+=-ltst_preload -lm -ldl -ltst -lrt
-CFLAGS+=-I../framework/
+CFLAGS+=-I../framework/ -I../common/
 
-$(APPS): ../framework/libtst.a
+$(APPS): ../framework/libtst.a ../common/libtst_common.a
 
 CLEAN+=log.html log.json
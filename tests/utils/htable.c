@@ -0,0 +1,146 @@
+// SPDX-License-Identifier: GPL-2.1-or-later
+/*
+
+   Copyright (C) 2009-2020 Cyril Hrubis <metan@ucw.cz>
+
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <utils/gp_htable.h>
+
+#include "tst_test.h"
+
+#define KEYS 40
+
+static void key_str(char *buf, size_t size, long i)
+{
+	snprintf(buf, size, "key %li", i);
+}
+
+static int check_keys(gp_htable *table, int removed_mod)
+{
+	char key[32];
+	long i;
+
+	for (i = 0; i < KEYS; i++) {
+		long exp = (removed_mod && !(i % removed_mod)) ? 0 : i + 1;
+		long val;
+
+		key_str(key, sizeof(key), i);
+
+		val = (long)gp_htable_get(table, key);
+
+		if (val != exp) {
+			tst_msg("Key '%s' has value %li expected %li",
+			        key, val, exp);
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+static int test_put_get_rem(void)
+{
+	gp_htable *table = gp_htable_new(0, GP_HTABLE_COPY_KEY);
+	int ret = TST_FAILED;
+	char key[32];
+	long i;
+
+	if (!table) {
+		tst_msg("Failed to allocate hash table");
+		return TST_FAILED;
+	}
+
+	for (i = 0; i < KEYS; i++) {
+		key_str(key, sizeof(key), i);
+		gp_htable_put(table, (void*)(i + 1), key);
+	}
+
+	if (check_keys(table, 0))
+		goto end;
+
+	for (i = 0; i < KEYS; i += 3) {
+		key_str(key, sizeof(key), i);
+
+		if ((long)gp_htable_rem(table, key) != i + 1) {
+			tst_msg("Wrong value removed for key '%s'", key);
+			goto end;
+		}
+	}
+
+	if (gp_htable_rem(table, "key 0")) {
+		tst_msg("Removed key 'key 0' twice");
+		goto end;
+	}
+
+	if (check_keys(table, 3))
+		goto end;
+
+	for (i = 0; i < KEYS; i += 3) {
+		key_str(key, sizeof(key), i);
+		gp_htable_put(table, (void*)(i + 1), key);
+	}
+
+	if (check_keys(table, 0))
+		goto end;
+
+	ret = TST_SUCCESS;
+end:
+	gp_htable_free(table);
+	return ret;
+}
+
+static int test_rem_missing(void)
+{
+	gp_htable *table = gp_htable_new(0, 0);
+	int ret = TST_SUCCESS;
+
+	if (!table) {
+		tst_msg("Failed to allocate hash table");
+		return TST_FAILED;
+	}
+
+	if (gp_htable_rem(table, "missing")) {
+		tst_msg("Removed key from empty table");
+		ret = TST_FAILED;
+	}
+
+	gp_htable_put(table, (void*)1, "a");
+
+	if (gp_htable_rem(table, "missing")) {
+		tst_msg("Removed nonexisting key");
+		ret = TST_FAILED;
+	}
+
+	if (gp_htable_rem(table, "a") != (void*)1) {
+		tst_msg("Failed to remove key 'a'");
+		ret = TST_FAILED;
+	}
+
+	if (gp_htable_get(table, "a")) {
+		tst_msg("Key 'a' found after removal");
+		ret = TST_FAILED;
+	}
+
+	gp_htable_free(table);
+
+	return ret;
+}
+
+const struct tst_suite tst_suite = {
+	.suite_name = "hash table testsuite",
+	.tests = {
+		{.name = "gp_htable put get rem",
+		 .tst_fn = test_put_get_rem,
+		 .flags = TST_CHECK_MALLOC},
+
+		{.name = "gp_htable rem missing",
+		 .tst_fn = test_rem_missing,
+		 .flags = TST_CHECK_MALLOC},
+
+		{}
+	}
+};